@@ -40,6 +40,19 @@ inline void ApplyMathAicpuDefaultCfg(TOpDef& opDef)
     opDef.AICPU().ExtendCfgInfo(OP_INFO_OPS_FLAG.c_str(), CLOSE_OPS_FLAG.c_str());
     opDef.AICPU().ExtendCfgInfo(OP_INFO_SUB_TYPE_OF_INFERSHAPE.c_str(), DEFAULT_SUB_TYPE_OF_INFERSHAPE_1.c_str());
 }
+
+// Optional view_shape_<i>/view_strides_<i>/view_offset_<i> attrs for the first `inputNum` inputs, so a
+// non-contiguous input can be launched over its storage (see aicpu/strided_view.h).
+template <typename TOpDef>
+inline void ApplyStridedViewAttrs(TOpDef& opDef, uint32_t inputNum)
+{
+    for (uint32_t i = 0; i < inputNum; ++i) {
+        const std::string index = std::to_string(i);
+        opDef.Attr(("view_shape_" + index).c_str()).AttrType(OPTIONAL).ListInt({});
+        opDef.Attr(("view_strides_" + index).c_str()).AttrType(OPTIONAL).ListInt({});
+        opDef.Attr(("view_offset_" + index).c_str()).AttrType(OPTIONAL).Int(0);
+    }
+}
 } // namespace ops
 
 #endif
@@ -0,0 +1,244 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file broadcast_binary.h
+ * \brief Broadcast engine shared by the binary elementwise AICPU kernels (Add, Sub, Mul, Div, Pow, Less, ...).
+ *
+ * out = op(x, y) is planned once with BuildStridedBinaryPlan (strided_view.h): size-1 output dims are dropped and
+ * adjacent dims both operands step through as one are collapsed, so most broadcasts end up 1-D or 2-D. The collapsed
+ * plan then picks a path:
+ *   same shape       x[i], y[i]
+ *   scalar x / y     one operand is a single element
+ *   row broadcast    [rows, cols] with one operand a [cols] row repeated for every row
+ *   column broadcast [rows, cols] with one operand a [rows, 1] column
+ *   generic          N-D odometer over the innermost runs of the plan
+ * The output is sharded by cost: every element costs its op (scaled for half and complex types) plus the bytes it
+ * moves, small outputs stay on the calling thread and shards are cut on output cache lines.
+ *
+ * A kernel only provides the per-element functor, TOut op(const TX&, const TY&).
+ */
+
+#ifndef OPS_MATH_COMMON_AICPU_BROADCAST_BINARY_H
+#define OPS_MATH_COMMON_AICPU_BROADCAST_BINARY_H
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+
+#include "Eigen/Core"
+#include "aicpu/strided_view.h"
+#include "cpu_kernel.h"
+#include "cpu_kernel_utils.h"
+#include "log.h"
+#include "status.h"
+#include "utils/kernel_util.h"
+
+namespace aicpu {
+// Cost of one op evaluation, in units of an integer add.
+constexpr int64_t kBinaryCostCheap = 1;
+constexpr int64_t kBinaryCostDiv = 8;
+constexpr int64_t kBinaryCostPow = 32;
+// Outputs costing less than kBinarySerialCost run on the calling thread, every shard costs at least
+// kBinaryMinShardCost and starts on a kBinaryShardAlignBytes line of the output.
+constexpr int64_t kBinarySerialCost = 32 * 1024;
+constexpr int64_t kBinaryMinShardCost = 16 * 1024;
+constexpr int64_t kBinaryShardAlignBytes = 64;
+
+enum class BinaryBcastPath : int32_t {
+    kGeneric = 0,
+    kSameShape,
+    kScalarX,
+    kScalarY,
+    kRowBcast,
+    kColumnBcastX,
+    kColumnBcastY
+};
+
+// Emulated half types and complex arithmetic cost a multiple of the native op.
+template <typename T>
+struct BinaryTypeCost {
+    static constexpr int64_t kFactor = 1;
+};
+template <>
+struct BinaryTypeCost<Eigen::half> {
+    static constexpr int64_t kFactor = 2;
+};
+template <>
+struct BinaryTypeCost<Eigen::bfloat16> {
+    static constexpr int64_t kFactor = 2;
+};
+template <typename T>
+struct BinaryTypeCost<std::complex<T>> {
+    static constexpr int64_t kFactor = 4;
+};
+
+template <typename TX, typename TY, typename TOut>
+inline int64_t BinaryElementCost(int64_t op_cost)
+{
+    const int64_t factor = std::max({BinaryTypeCost<TX>::kFactor, BinaryTypeCost<TY>::kFactor,
+                                     BinaryTypeCost<TOut>::kFactor});
+    const int64_t bytes = static_cast<int64_t>(sizeof(TX) + sizeof(TY) + sizeof(TOut));
+    return std::max<int64_t>(1, op_cost) * factor + (bytes + 3) / 4;
+}
+
+inline BinaryBcastPath ClassifyBinaryPlan(const StridedBinaryPlan& plan)
+{
+    const int64_t* xs = plan.x_strides;
+    const int64_t* ys = plan.y_strides;
+    if (plan.ndims == 1) {
+        if (xs[0] == 1 && ys[0] == 1) {
+            return BinaryBcastPath::kSameShape;
+        }
+        if (xs[0] == 0 && ys[0] == 1) {
+            return BinaryBcastPath::kScalarX;
+        }
+        if (xs[0] == 1 && ys[0] == 0) {
+            return BinaryBcastPath::kScalarY;
+        }
+        return BinaryBcastPath::kGeneric;
+    }
+    if (plan.ndims == 2) {
+        const int64_t cols = plan.out_shape[1];
+        const bool x_dense = (xs[0] == cols && xs[1] == 1);
+        const bool y_dense = (ys[0] == cols && ys[1] == 1);
+        if ((x_dense && ys[0] == 0 && ys[1] == 1) || (y_dense && xs[0] == 0 && xs[1] == 1)) {
+            return BinaryBcastPath::kRowBcast;
+        }
+        if (y_dense && xs[0] == 1 && xs[1] == 0) {
+            return BinaryBcastPath::kColumnBcastX;
+        }
+        if (x_dense && ys[0] == 1 && ys[1] == 0) {
+            return BinaryBcastPath::kColumnBcastY;
+        }
+    }
+    return BinaryBcastPath::kGeneric;
+}
+
+// Elements per shard for a `total` element output, 0 to stay on the calling thread.
+inline int64_t BinaryShardElements(const CpuKernelContext& ctx, int64_t total, int64_t elem_cost, int64_t out_bytes)
+{
+    if (total * elem_cost < kBinarySerialCost) {
+        return 0;
+    }
+    const int64_t cores =
+        std::max<int64_t>(1, static_cast<int64_t>(CpuKernelUtils::GetCPUNum(ctx)) - static_cast<int64_t>(kResvCpuNum));
+    const int64_t min_shard = (kBinaryMinShardCost + elem_cost - 1) / elem_cost;
+    const int64_t shards = std::min(cores, total / min_shard);
+    if (shards <= 1) {
+        return 0;
+    }
+    const int64_t align = std::max<int64_t>(1, kBinaryShardAlignBytes / std::max<int64_t>(1, out_bytes));
+    const int64_t per_shard = (total + shards - 1) / shards;
+    return (per_shard + align - 1) / align * align;
+}
+
+// out[i] = op(x[i * kXStep], y[i * kYStep]); a zero step keeps that operand in a register.
+template <int64_t kXStep, int64_t kYStep, typename TX, typename TY, typename TOut, typename Op>
+inline void BinaryRun(const TX* x, const TY* y, TOut* out, int64_t len, const Op& op)
+{
+    for (int64_t i = 0; i < len; ++i) {
+        out[i] = op(x[i * kXStep], y[i * kYStep]);
+    }
+}
+
+// Output elements [start, end) of a 2-D plan whose rows are runs with inner steps kXStep/kYStep.
+template <int64_t kXStep, int64_t kYStep, typename TX, typename TY, typename TOut, typename Op>
+void BinaryRows(const StridedBinaryPlan& plan, const TX* x, const TY* y, TOut* out, int64_t start, int64_t end,
+                const Op& op)
+{
+    const int64_t cols = plan.out_shape[1];
+    int64_t row = start / cols;
+    int64_t col = start - row * cols;
+    for (int64_t idx = start; idx < end; ++row, col = 0) {
+        const int64_t len = std::min(cols - col, end - idx);
+        BinaryRun<kXStep, kYStep>(x + row * plan.x_strides[0] + col * kXStep,
+                                  y + row * plan.y_strides[0] + col * kYStep, out + idx, len, op);
+        idx += len;
+    }
+}
+
+template <typename TX, typename TY, typename TOut, typename Op>
+void BroadcastBinaryRange(BinaryBcastPath path, const StridedBinaryPlan& plan, const TX* x, const TY* y, TOut* out,
+                          int64_t start, int64_t end, const Op& op)
+{
+    const TX* xp = x + plan.x_offset;
+    const TY* yp = y + plan.y_offset;
+    switch (path) {
+        case BinaryBcastPath::kSameShape:
+            BinaryRun<1, 1>(xp + start, yp + start, out + start, end - start, op);
+            break;
+        case BinaryBcastPath::kScalarX:
+            BinaryRun<0, 1>(xp, yp + start, out + start, end - start, op);
+            break;
+        case BinaryBcastPath::kScalarY:
+            BinaryRun<1, 0>(xp + start, yp, out + start, end - start, op);
+            break;
+        case BinaryBcastPath::kRowBcast:
+            BinaryRows<1, 1>(plan, xp, yp, out, start, end, op);
+            break;
+        case BinaryBcastPath::kColumnBcastX:
+            BinaryRows<0, 1>(plan, xp, yp, out, start, end, op);
+            break;
+        case BinaryBcastPath::kColumnBcastY:
+            BinaryRows<1, 0>(plan, xp, yp, out, start, end, op);
+            break;
+        default:
+            StridedBinaryRange(plan, x, y, out, start, end, op);
+            break;
+    }
+}
+
+// Evaluates `op` for every element of output 0 from inputs 0/1 as described by `plan`. op_cost is the cost of one
+// op evaluation in units of kBinaryCostCheap.
+template <typename TX, typename TY, typename TOut, typename Op>
+uint32_t ComputeBroadcastBinary(const CpuKernelContext& ctx, const StridedBinaryPlan& plan, const Op& op,
+                                int64_t op_cost = kBinaryCostCheap)
+{
+    const TX* x = static_cast<const TX*>(ctx.Input(kFirstInputIndex)->GetData());
+    const TY* y = static_cast<const TY*>(ctx.Input(kSecondInputIndex)->GetData());
+    TOut* out = static_cast<TOut*>(ctx.Output(kFirstOutputIndex)->GetData());
+    const int64_t total = plan.total_elements;
+    if (total == 0) {
+        return KERNEL_STATUS_OK;
+    }
+    const BinaryBcastPath path = ClassifyBinaryPlan(plan);
+    const int64_t per_unit = BinaryShardElements(ctx, total, BinaryElementCost<TX, TY, TOut>(op_cost),
+                                                 static_cast<int64_t>(sizeof(TOut)));
+    KERNEL_LOG_DEBUG("[%s] broadcast binary: path=%d, ndims=%d, total=%ld, per_unit=%ld", ctx.GetOpType().c_str(),
+                     static_cast<int32_t>(path), plan.ndims, total, per_unit);
+    if (per_unit == 0) {
+        BroadcastBinaryRange(path, plan, x, y, out, 0, total, op);
+        return KERNEL_STATUS_OK;
+    }
+    auto shard = [&](int64_t start, int64_t end) { BroadcastBinaryRange(path, plan, x, y, out, start, end, op); };
+    KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, total, per_unit, shard), "[%s] Broadcast compute failed.",
+                        ctx.GetOpType().c_str())
+    return KERNEL_STATUS_OK;
+}
+
+// Plans inputs 0/1 (strided views or contiguous tensors) against output 0 and evaluates `op` over the broadcast.
+template <typename TX, typename TY, typename TOut, typename Op>
+uint32_t BroadcastBinaryCompute(const CpuKernelContext& ctx, const Op& op, int64_t op_cost = kBinaryCostCheap)
+{
+    StridedBinaryPlan plan;
+    KERNEL_HANDLE_ERROR(GetStridedBinaryPlan(ctx, plan), "[%s] Plan broadcast of inputs failed.",
+                        ctx.GetOpType().c_str())
+    return ComputeBroadcastBinary<TX, TY, TOut>(ctx, plan, op, op_cost);
+}
+
+template <typename T, typename Op>
+uint32_t BroadcastBinaryCompute(const CpuKernelContext& ctx, const Op& op, int64_t op_cost = kBinaryCostCheap)
+{
+    return BroadcastBinaryCompute<T, T, T, Op>(ctx, op, op_cost);
+}
+} // namespace aicpu
+
+#endif // OPS_MATH_COMMON_AICPU_BROADCAST_BINARY_H
@@ -0,0 +1,280 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file fft_engine.h
+ * \brief 1-D complex FFT shared by the FFT AICPU kernels (Fft1D, Irfft1D).
+ *
+ * The plan is the Rfft1D one (op_host/fft_factors.h): a length the Rfft1D mixed-radix kernels take is split into the
+ * same Cooley-Tukey levels, every other length goes through Bluestein's chirp-z transform over the same power of two
+ * convolution. Each level is then run as radix passes of its prime factors (4 first, then 2, 3, 5 and the remaining
+ * primes) in a Stockham autosort FFT, so no bit reversal is needed and every pass streams its source and destination
+ * buffers.
+ */
+
+#ifndef OPS_MATH_COMMON_AICPU_FFT_ENGINE_H
+#define OPS_MATH_COMMON_AICPU_FFT_ENGINE_H
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "op_host/fft_factors.h"
+
+namespace aicpu {
+constexpr int64_t kFftMaxRadix = 64;
+constexpr int64_t kFftMaxLength = 262144;
+
+enum FftNormMode : int64_t { kFftNormBackward = 1, kFftNormForward = 2, kFftNormOrtho = 3 };
+
+inline bool IsValidFftNorm(int64_t norm)
+{
+    return norm == kFftNormBackward || norm == kFftNormForward || norm == kFftNormOrtho;
+}
+
+// Scale applied to the output of an unnormalized transform of length n, as torch.fft defines `norm`.
+template <typename T>
+T FftScale(int64_t n, int64_t norm, bool forward)
+{
+    if (norm == kFftNormOrtho) {
+        return static_cast<T>(1.0 / std::sqrt(static_cast<double>(n)));
+    }
+    const bool divide = forward ? (norm == kFftNormForward) : (norm == kFftNormBackward);
+    return divide ? static_cast<T>(1.0 / static_cast<double>(n)) : static_cast<T>(1);
+}
+
+// Plain complex product; std::complex operator* goes through the C99 NaN/Inf recovery path.
+template <typename T>
+inline std::complex<T> FftMul(const std::complex<T>& a, const std::complex<T>& b)
+{
+    return std::complex<T>(a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real());
+}
+
+template <typename T>
+class FftPlan1D {
+public:
+    using Complex = std::complex<T>;
+
+    // Plan an unnormalized transform of length n; inverse uses exp(+2*pi*i*k*j/n).
+    bool Init(int64_t n, bool inverse)
+    {
+        if (n <= 0 || n > kFftMaxLength) {
+            return false;
+        }
+        n_ = n;
+        inverse_ = inverse;
+        uint32_t levels[Ops::Math::FFT_FACTORS_LEN];
+        Ops::Math::CalcFftFactors(static_cast<uint32_t>(n), levels);
+        bluestein_ = Ops::Math::IsFftBluestein(static_cast<uint32_t>(n), levels);
+        return bluestein_ ? InitBluestein() : InitRadix(levels);
+    }
+
+    int64_t Length() const { return n_; }
+
+    bool IsBluestein() const { return bluestein_; }
+
+    // Complex values of scratch Execute needs.
+    int64_t ScratchSize() const { return bluestein_ ? 3 * conv_len_ : n_; }
+
+    // out = DFT(in), unnormalized. in, out and work (ScratchSize() values) must not overlap; in is not written.
+    void Execute(const Complex* in, Complex* out, Complex* work) const
+    {
+        if (bluestein_) {
+            ExecuteBluestein(in, out, work);
+        } else {
+            ExecuteStockham(in, out, work);
+        }
+    }
+
+private:
+    // exp(-+2*pi*i*t/n), evaluated in double.
+    Complex Root(int64_t t, int64_t n) const
+    {
+        const double angle = (inverse_ ? 2.0 : -2.0) * M_PI * static_cast<double>(t) / static_cast<double>(n);
+        return Complex(static_cast<T>(std::cos(angle)), static_cast<T>(std::sin(angle)));
+    }
+
+    // Radix passes of one Cooley-Tukey level; every level is at most 2 * FFT_LAST_FACTOR, so its primes fit a pass.
+    static void SplitLevel(int64_t level, std::vector<int64_t>& radices)
+    {
+        const int64_t preferred[] = {4, 2, 3, 5};
+        for (int64_t radix : preferred) {
+            while (level % radix == 0) {
+                radices.push_back(radix);
+                level /= radix;
+            }
+        }
+        for (int64_t radix = 7; radix <= kFftMaxRadix && level > 1; radix += 2) {
+            while (level % radix == 0) {
+                radices.push_back(radix);
+                level /= radix;
+            }
+        }
+    }
+
+    bool InitRadix(const uint32_t levels[])
+    {
+        radices_.clear();
+        for (uint32_t i = 0; i < Ops::Math::FFT_FACTORS_LEN; i++) {
+            SplitLevel(static_cast<int64_t>(levels[i]), radices_);
+        }
+        twiddles_.resize(static_cast<size_t>(n_));
+        for (int64_t t = 0; t < n_; t++) {
+            twiddles_[t] = Root(t, n_);
+        }
+        return true;
+    }
+
+    // Forward transform of the power of two Bluestein convolution length, always a plain mixed-radix plan.
+    bool InitConvolution(int64_t n)
+    {
+        n_ = n;
+        inverse_ = false;
+        bluestein_ = false;
+        uint32_t levels[Ops::Math::FFT_FACTORS_LEN];
+        if (!Ops::Math::CalcFftFactors(static_cast<uint32_t>(n), levels)) {
+            return false;
+        }
+        return InitRadix(levels);
+    }
+
+    bool InitBluestein()
+    {
+        conv_len_ = static_cast<int64_t>(Ops::Math::CalcFftBluesteinLength(static_cast<uint32_t>(n_)));
+        conv_plan_.reset(new FftPlan1D<T>());
+        if (!conv_plan_->InitConvolution(conv_len_)) {
+            return false;
+        }
+        // chirp[k] = exp(-+pi*i*k^2/n); k^2 is reduced mod 2n first so the angle stays exact for large k.
+        chirp_.resize(static_cast<size_t>(n_));
+        for (int64_t k = 0; k < n_; k++) {
+            const int64_t square = (k * k) % (2 * n_);
+            const double angle = (inverse_ ? 1.0 : -1.0) * M_PI * static_cast<double>(square) / static_cast<double>(n_);
+            chirp_[k] = Complex(static_cast<T>(std::cos(angle)), static_cast<T>(std::sin(angle)));
+        }
+        // Spectrum of the wrapped conj(chirp) kernel, pre-divided by conv_len_ for the inverse convolution FFT.
+        std::vector<Complex> kernel(static_cast<size_t>(conv_len_), Complex(0, 0));
+        kernel[0] = std::conj(chirp_[0]);
+        for (int64_t k = 1; k < n_; k++) {
+            kernel[k] = std::conj(chirp_[k]);
+            kernel[conv_len_ - k] = kernel[k];
+        }
+        kernel_fft_.resize(static_cast<size_t>(conv_len_));
+        std::vector<Complex> work(static_cast<size_t>(conv_plan_->ScratchSize()));
+        conv_plan_->Execute(kernel.data(), kernel_fft_.data(), work.data());
+        const T inv_len = static_cast<T>(1.0 / static_cast<double>(conv_len_));
+        for (auto& value : kernel_fft_) {
+            value *= inv_len;
+        }
+        return true;
+    }
+
+    // One size-p DFT on v, roots read from the length-n twiddle table.
+    void Butterfly(Complex* v, int64_t p, Complex* u) const
+    {
+        if (p == 2) {
+            const Complex a = v[0];
+            v[0] = a + v[1];
+            v[1] = a - v[1];
+            return;
+        }
+        if (p == 4) {
+            const Complex s02 = v[0] + v[2];
+            const Complex d02 = v[0] - v[2];
+            const Complex s13 = v[1] + v[3];
+            const Complex d13 = v[1] - v[3];
+            // -i * d13 forward, +i * d13 inverse.
+            const Complex rot = inverse_ ? Complex(-d13.imag(), d13.real()) : Complex(d13.imag(), -d13.real());
+            v[0] = s02 + s13;
+            v[1] = d02 + rot;
+            v[2] = s02 - s13;
+            v[3] = d02 - rot;
+            return;
+        }
+        const int64_t step = n_ / p;
+        for (int64_t s = 0; s < p; s++) {
+            Complex acc = v[0];
+            for (int64_t r = 1; r < p; r++) {
+                acc += FftMul(v[r], twiddles_[((r * s) % p) * step]);
+            }
+            u[s] = acc;
+        }
+        std::copy(u, u + p, v);
+    }
+
+    void ExecuteStockham(const Complex* in, Complex* out, Complex* work) const
+    {
+        const size_t passes = radices_.size();
+        if (passes == 0) {
+            out[0] = in[0];
+            return;
+        }
+        Complex v[kFftMaxRadix];
+        Complex u[kFftMaxRadix];
+        const Complex* src = in;
+        int64_t ns = 1;
+        for (size_t pass = 0; pass < passes; pass++) {
+            // The last pass lands in out, the ones before alternate so that holds.
+            Complex* dst = ((passes - 1 - pass) % 2 == 0) ? out : work;
+            const int64_t p = radices_[pass];
+            const int64_t m = n_ / p;
+            const int64_t tw_stride = n_ / (ns * p);
+            for (int64_t j = 0; j < m; j++) {
+                const int64_t k = j % ns;
+                v[0] = src[j];
+                for (int64_t r = 1; r < p; r++) {
+                    v[r] = (k == 0) ? src[j + r * m] : FftMul(src[j + r * m], twiddles_[k * r * tw_stride]);
+                }
+                Butterfly(v, p, u);
+                Complex* base = dst + (j / ns) * ns * p + k;
+                for (int64_t s = 0; s < p; s++) {
+                    base[s * ns] = v[s];
+                }
+            }
+            src = dst;
+            ns *= p;
+        }
+    }
+
+    void ExecuteBluestein(const Complex* in, Complex* out, Complex* work) const
+    {
+        Complex* a = work;
+        Complex* spectrum = work + conv_len_;
+        Complex* conv_work = work + 2 * conv_len_;
+        for (int64_t k = 0; k < n_; k++) {
+            a[k] = FftMul(in[k], chirp_[k]);
+        }
+        std::fill(a + n_, a + conv_len_, Complex(0, 0));
+        conv_plan_->Execute(a, spectrum, conv_work);
+        // Inverse convolution FFT as conj(FFT(conj(x))), the 1 / conv_len_ is folded into kernel_fft_.
+        for (int64_t k = 0; k < conv_len_; k++) {
+            spectrum[k] = std::conj(FftMul(spectrum[k], kernel_fft_[k]));
+        }
+        conv_plan_->Execute(spectrum, a, conv_work);
+        for (int64_t k = 0; k < n_; k++) {
+            out[k] = FftMul(std::conj(a[k]), chirp_[k]);
+        }
+    }
+
+    int64_t n_ = 0;
+    bool inverse_ = false;
+    bool bluestein_ = false;
+    std::vector<int64_t> radices_;
+    std::vector<Complex> twiddles_;
+    int64_t conv_len_ = 0;
+    std::vector<Complex> chirp_;
+    std::vector<Complex> kernel_fft_;
+    std::unique_ptr<FftPlan1D<T>> conv_plan_;
+};
+} // namespace aicpu
+#endif // OPS_MATH_COMMON_AICPU_FFT_ENGINE_H
@@ -0,0 +1,301 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file householder_qr.h
+ * \brief Blocked Householder QR shared by the linear algebra AICPU kernels (Qr, Svd).
+ *
+ * Matrices are column-major. Columns are factored in panels of kQrBlockSize: every panel is reduced by unblocked
+ * reflectors H(j) = I - tau(j) * v(j) * v(j)^H (LAPACK geqr2 / larfg conventions, so R has a real diagonal), its
+ * reflectors are accumulated into the compact WY form I - V * T * V^H (larft) and the trailing columns are updated
+ * with that block at once. Q is formed backwards from the stored blocks (orgqr). The column ranges of the block
+ * updates are handed to a LinalgRunner so that a kernel can spread a single large matrix over several cores.
+ */
+
+#ifndef OPS_MATH_COMMON_AICPU_HOUSEHOLDER_QR_H
+#define OPS_MATH_COMMON_AICPU_HOUSEHOLDER_QR_H
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace aicpu {
+constexpr int64_t kQrBlockSize = 32;
+
+template <typename T>
+struct LinalgTraits {
+    using Real = T;
+    static T Conj(const T& v)
+    {
+        return v;
+    }
+    static Real Abs2(const T& v)
+    {
+        return v * v;
+    }
+    static Real RealPart(const T& v)
+    {
+        return v;
+    }
+    static Real ImagPart(const T&)
+    {
+        return static_cast<Real>(0);
+    }
+};
+
+template <typename R>
+struct LinalgTraits<std::complex<R>> {
+    using Real = R;
+    static std::complex<R> Conj(const std::complex<R>& v)
+    {
+        return std::complex<R>(v.real(), -v.imag());
+    }
+    static Real Abs2(const std::complex<R>& v)
+    {
+        return v.real() * v.real() + v.imag() * v.imag();
+    }
+    static Real RealPart(const std::complex<R>& v)
+    {
+        return v.real();
+    }
+    static Real ImagPart(const std::complex<R>& v)
+    {
+        return v.imag();
+    }
+};
+
+// fn(begin, end) over [0, total); a runner may split the range into chunks of at least min_chunk and run them
+// concurrently, chunks never overlap.
+using LinalgRangeFn = std::function<void(int64_t, int64_t)>;
+using LinalgRunner = std::function<void(int64_t total, int64_t min_chunk, const LinalgRangeFn& fn)>;
+
+inline void LinalgRunSerial(int64_t total, int64_t, const LinalgRangeFn& fn)
+{
+    if (total > 0) {
+        fn(0, total);
+    }
+}
+
+template <typename T>
+class HouseholderQr {
+public:
+    using Traits = LinalgTraits<T>;
+    using Real = typename Traits::Real;
+
+    /**
+     * Factors the m x n column-major matrix a in place: R is left in the upper triangle and the reflector tails
+     * below the diagonal, as geqrf does.
+     */
+    void Factor(T* a, int64_t m, int64_t n, const LinalgRunner& run)
+    {
+        m_ = m;
+        n_ = n;
+        const int64_t k = std::min(m, n);
+        tau_.assign(static_cast<size_t>(k), T(0));
+        t_blocks_.assign(static_cast<size_t>(((k + kQrBlockSize - 1) / kQrBlockSize) * kQrBlockSize * kQrBlockSize),
+                         T(0));
+        for (int64_t j0 = 0; j0 < k; j0 += kQrBlockSize) {
+            const int64_t jb = std::min(kQrBlockSize, k - j0);
+            FactorPanel(a, j0, jb);
+            T* t = BlockT(j0);
+            BuildT(a, j0, jb, t);
+            if (j0 + jb < n) {
+                // A(j0:m, j0+jb:n) = (I - V T V^H)^H A(j0:m, j0+jb:n)
+                ApplyBlock(a, t, j0, jb, a, j0 + jb, n, true, run);
+            }
+        }
+    }
+
+    // Writes the first cols columns of Q (m x cols column-major, cols <= m) of the last factored matrix a.
+    void FormQ(const T* a, T* q, int64_t cols, const LinalgRunner& run) const
+    {
+        std::fill(q, q + m_ * cols, T(0));
+        for (int64_t j = 0; j < cols; j++) {
+            q[j * m_ + j] = T(1);
+        }
+        const int64_t k = static_cast<int64_t>(tau_.size());
+        if (k == 0) {
+            return;
+        }
+        // Q = B(0) B(1) ... applied to I from the last block. Columns before j0 are still unit vectors that the
+        // block does not touch.
+        for (int64_t j0 = ((k - 1) / kQrBlockSize) * kQrBlockSize; j0 >= 0; j0 -= kQrBlockSize) {
+            const int64_t jb = std::min(kQrBlockSize, k - j0);
+            if (j0 < cols) {
+                ApplyBlock(a, BlockT(j0), j0, jb, q, j0, cols, false, run);
+            }
+        }
+    }
+
+private:
+    T* BlockT(int64_t j0)
+    {
+        return t_blocks_.data() + (j0 / kQrBlockSize) * kQrBlockSize * kQrBlockSize;
+    }
+
+    const T* BlockT(int64_t j0) const
+    {
+        return t_blocks_.data() + (j0 / kQrBlockSize) * kQrBlockSize * kQrBlockSize;
+    }
+
+    // larfg: turns x (len values) into beta * e1 with x(1:) = v(1:), v(0) = 1 implied, and returns tau.
+    static T GenerateReflector(T* x, int64_t len)
+    {
+        const T alpha = x[0];
+        Real tail = 0;
+        for (int64_t i = 1; i < len; i++) {
+            tail += Traits::Abs2(x[i]);
+        }
+        if (tail == static_cast<Real>(0) && Traits::ImagPart(alpha) == static_cast<Real>(0)) {
+            return T(0);
+        }
+        Real beta = std::sqrt(Traits::Abs2(alpha) + tail);
+        if (Traits::RealPart(alpha) >= static_cast<Real>(0)) {
+            beta = -beta;
+        }
+        const T tau = (T(beta) - alpha) / T(beta);
+        const T scale = T(1) / (alpha - T(beta));
+        for (int64_t i = 1; i < len; i++) {
+            x[i] *= scale;
+        }
+        x[0] = T(beta);
+        return tau;
+    }
+
+    // Unblocked reduction of columns j0 .. j0 + jb - 1, each reflector applied to the rest of the panel only.
+    void FactorPanel(T* a, int64_t j0, int64_t jb)
+    {
+        for (int64_t j = j0; j < j0 + jb; j++) {
+            T* v = a + j * m_ + j;
+            const int64_t len = m_ - j;
+            const T tau = GenerateReflector(v, len);
+            tau_[j] = tau;
+            if (tau == T(0)) {
+                continue;
+            }
+            const T ctau = Traits::Conj(tau);
+            for (int64_t c = j + 1; c < j0 + jb; c++) {
+                T* col = a + c * m_ + j;
+                // H^H col = col - conj(tau) * v * (v^H col)
+                T dot = col[0];
+                for (int64_t i = 1; i < len; i++) {
+                    dot += Traits::Conj(v[i]) * col[i];
+                }
+                dot *= ctau;
+                col[0] -= dot;
+                for (int64_t i = 1; i < len; i++) {
+                    col[i] -= v[i] * dot;
+                }
+            }
+        }
+    }
+
+    // larft (forward, columnwise): upper triangular t (jb x jb column-major) with B = I - V t V^H.
+    void BuildT(const T* a, int64_t j0, int64_t jb, T* t) const
+    {
+        std::fill(t, t + kQrBlockSize * kQrBlockSize, T(0));
+        for (int64_t i = 0; i < jb; i++) {
+            const T tau = tau_[j0 + i];
+            T* ti = t + i * jb;
+            ti[i] = tau;
+            if (tau == T(0)) {
+                continue;
+            }
+            const int64_t row0 = j0 + i;
+            const T* vi = a + (j0 + i) * m_;
+            // ti(0:i) = -tau * V(:, 0:i)^H v(i)
+            for (int64_t c = 0; c < i; c++) {
+                const T* vc = a + (j0 + c) * m_;
+                T dot = Traits::Conj(vc[row0]);
+                for (int64_t r = row0 + 1; r < m_; r++) {
+                    dot += Traits::Conj(vc[r]) * vi[r];
+                }
+                ti[c] = -tau * dot;
+            }
+            // ti(0:i) = t(0:i, 0:i) * ti(0:i), ascending rows only read entries not yet overwritten.
+            for (int64_t r = 0; r < i; r++) {
+                T sum = T(0);
+                for (int64_t c = r; c < i; c++) {
+                    sum += t[c * jb + r] * ti[c];
+                }
+                ti[r] = sum;
+            }
+        }
+    }
+
+    /**
+     * C(j0:m, c0:c1) = B^H C (adjoint) or B C with B = I - V t V^H the block of columns j0 .. j0 + jb - 1. C is
+     * column-major with m rows.
+     */
+    void ApplyBlock(const T* a, const T* t, int64_t j0, int64_t jb, T* c, int64_t c0, int64_t c1, bool adjoint,
+                    const LinalgRunner& run) const
+    {
+        const int64_t m = m_;
+        auto apply = [a, t, j0, jb, c, c0, m, adjoint](int64_t begin, int64_t end) {
+            T w[kQrBlockSize];
+            for (int64_t col = c0 + begin; col < c0 + end; col++) {
+                T* cc = c + col * m;
+                // w = V^H C(:, col)
+                for (int64_t r = 0; r < jb; r++) {
+                    const int64_t row0 = j0 + r;
+                    const T* v = a + row0 * m;
+                    T dot = cc[row0];
+                    for (int64_t i = row0 + 1; i < m; i++) {
+                        dot += Traits::Conj(v[i]) * cc[i];
+                    }
+                    w[r] = dot;
+                }
+                if (adjoint) {
+                    // w = t^H w, lower triangular: descending rows
+                    for (int64_t r = jb - 1; r >= 0; r--) {
+                        T sum = T(0);
+                        for (int64_t k = 0; k <= r; k++) {
+                            sum += Traits::Conj(t[r * jb + k]) * w[k];
+                        }
+                        w[r] = sum;
+                    }
+                } else {
+                    // w = t w, upper triangular: ascending rows
+                    for (int64_t r = 0; r < jb; r++) {
+                        T sum = T(0);
+                        for (int64_t k = r; k < jb; k++) {
+                            sum += t[k * jb + r] * w[k];
+                        }
+                        w[r] = sum;
+                    }
+                }
+                // C(:, col) -= V w
+                for (int64_t r = 0; r < jb; r++) {
+                    const int64_t row0 = j0 + r;
+                    const T* v = a + row0 * m;
+                    const T wr = w[r];
+                    cc[row0] -= wr;
+                    for (int64_t i = row0 + 1; i < m; i++) {
+                        cc[i] -= v[i] * wr;
+                    }
+                }
+            }
+        };
+        // Each column costs about 4 * jb * (m - j0) flops; keep chunks at a few hundred thousand flops.
+        const int64_t col_cost = std::max<int64_t>(1, 4 * jb * (m - j0));
+        run(c1 - c0, std::max<int64_t>(1, (256 * 1024) / col_cost), apply);
+    }
+
+    int64_t m_ = 0;
+    int64_t n_ = 0;
+    std::vector<T> tau_;
+    std::vector<T> t_blocks_;
+};
+} // namespace aicpu
+
+#endif // OPS_MATH_COMMON_AICPU_HOUSEHOLDER_QR_H
@@ -0,0 +1,246 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file lu_determinant.h
+ * \brief Sign and log|det| of square matrices by partial-pivot LU, shared by LogMatrixDeterminant and Logdet.
+ *
+ * Matrices are row-major and factored in place (getrf conventions: P A = L U with unit L). Small matrices are
+ * eliminated row by row; from kLuBlockedMinSize on, kLuBlockSize columns are factored as a panel, U12 is solved
+ * against the panel and the trailing matrix gets one rank-kLuBlockSize update whose rows are handed to a
+ * LinalgRunner, so a single large matrix can be spread over several cores. The determinant is the product of the
+ * pivots with one sign flip per row swap; it is accumulated as a unit sign and a sum of log|pivot| so that it never
+ * overflows. A zero pivot stops the factorization with sign 0 and log|det| -inf, a NaN one with both NaN.
+ */
+
+#ifndef OPS_MATH_COMMON_AICPU_LU_DETERMINANT_H
+#define OPS_MATH_COMMON_AICPU_LU_DETERMINANT_H
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "aicpu/householder_qr.h"
+#include "cpu_kernel.h"
+#include "cpu_kernel_utils.h"
+#include "log.h"
+#include "status.h"
+#include "utils/kernel_util.h"
+
+namespace aicpu {
+constexpr int64_t kLuBlockSize = 64;
+constexpr int64_t kLuBlockedMinSize = 2 * kLuBlockSize;
+// A batch smaller than the core count is factored matrix by matrix from this size on, the trailing updates being
+// split across the cores instead.
+constexpr int64_t kLuSplitElements = 256 * 256;
+// Trailing rows handed to one core at a time.
+constexpr int64_t kLuMinChunkRows = 16;
+
+template <typename T>
+struct LuDeterminant {
+    using Real = typename LinalgTraits<T>::Real;
+    T sign = T(1);
+    Real log_abs = Real(0);
+};
+
+template <typename T>
+class PartialPivotLu {
+public:
+    using Traits = LinalgTraits<T>;
+    using Real = typename Traits::Real;
+
+    // Factors the n x n row-major matrix a in place and returns its determinant as sign and log|det|.
+    LuDeterminant<T> Factor(T* a, int64_t n, const LinalgRunner& run)
+    {
+        a_ = a;
+        n_ = n;
+        sign_ = T(1);
+        log_abs_ = 0;
+        nan_ = false;
+        bool regular = true;
+        if (n < kLuBlockedMinSize) {
+            regular = FactorPanel(0, n, n);
+        } else {
+            for (int64_t k0 = 0; k0 < n && regular; k0 += kLuBlockSize) {
+                const int64_t k1 = std::min(n, k0 + kLuBlockSize);
+                regular = FactorPanel(k0, k1, k1);
+                if (regular && k1 < n) {
+                    SolveU12(k0, k1);
+                    auto update = [this, k0, k1](int64_t begin, int64_t end) {
+                        UpdateTrailing(k0, k1, k1 + begin, k1 + end);
+                    };
+                    run(n - k1, kLuMinChunkRows, update);
+                }
+            }
+        }
+
+        LuDeterminant<T> det;
+        if (nan_) {
+            det.sign = T(std::numeric_limits<Real>::quiet_NaN());
+            det.log_abs = std::numeric_limits<Real>::quiet_NaN();
+            return det;
+        }
+        if (!regular) {
+            det.sign = T(0);
+            det.log_abs = -std::numeric_limits<Real>::infinity();
+            return det;
+        }
+        det.sign = NormalizeSign(sign_);
+        det.log_abs = static_cast<Real>(log_abs_);
+        return det;
+    }
+
+private:
+    static T NormalizeSign(const T& sign)
+    {
+        const Real mag = std::abs(sign);
+        return mag > Real(0) ? sign / mag : sign;
+    }
+
+    /**
+     * Eliminates the columns [k0, k1) over rows [k0, n), swapping whole rows, and updates each row up to column
+     * c1. Returns false on a zero or NaN pivot. Pivots are compared by |v| rather than |v|^2, which would overflow
+     * or underflow in Real for entries beyond about 1e19 or below 1e-19 in float.
+     */
+    bool FactorPanel(int64_t k0, int64_t k1, int64_t c1)
+    {
+        const int64_t n = n_;
+        for (int64_t k = k0; k < k1; k++) {
+            int64_t pivot_row = k;
+            Real pivot_abs = std::abs(a_[k * n + k]);
+            for (int64_t i = k + 1; i < n; i++) {
+                const Real v = std::abs(a_[i * n + k]);
+                if (v != v) {
+                    nan_ = true;
+                    return false;
+                }
+                if (v > pivot_abs) {
+                    pivot_abs = v;
+                    pivot_row = i;
+                }
+            }
+            if (!(pivot_abs > Real(0))) {
+                nan_ = (pivot_abs != pivot_abs);
+                return false;
+            }
+            if (pivot_row != k) {
+                std::swap_ranges(a_ + k * n, a_ + (k + 1) * n, a_ + pivot_row * n);
+                sign_ = -sign_;
+            }
+            const T pivot = a_[k * n + k];
+            sign_ *= pivot / pivot_abs;
+            log_abs_ += std::log(static_cast<double>(pivot_abs));
+
+            const T inv_pivot = T(1) / pivot;
+            const T* pk = a_ + k * n;
+            for (int64_t i = k + 1; i < n; i++) {
+                T* pi = a_ + i * n;
+                const T l = pi[k] * inv_pivot;
+                pi[k] = l;
+                for (int64_t j = k + 1; j < c1; j++) {
+                    pi[j] -= l * pk[j];
+                }
+            }
+        }
+        return true;
+    }
+
+    // U12 = L11^-1 A12 for the panel rows [k0, k1).
+    void SolveU12(int64_t k0, int64_t k1)
+    {
+        const int64_t n = n_;
+        for (int64_t i = k0 + 1; i < k1; i++) {
+            T* pi = a_ + i * n;
+            for (int64_t p = k0; p < i; p++) {
+                const T l = pi[p];
+                const T* pp = a_ + p * n;
+                for (int64_t j = k1; j < n; j++) {
+                    pi[j] -= l * pp[j];
+                }
+            }
+        }
+    }
+
+    // A22 -= L21 U12 for the trailing rows [i0, i1).
+    void UpdateTrailing(int64_t k0, int64_t k1, int64_t i0, int64_t i1) const
+    {
+        const int64_t n = n_;
+        for (int64_t i = i0; i < i1; i++) {
+            T* pi = a_ + i * n;
+            for (int64_t p = k0; p < k1; p++) {
+                const T l = pi[p];
+                const T* pp = a_ + p * n;
+                for (int64_t j = k1; j < n; j++) {
+                    pi[j] -= l * pp[j];
+                }
+            }
+        }
+    }
+
+    T* a_ = nullptr;
+    int64_t n_ = 0;
+    T sign_ = T(1);
+    double log_abs_ = 0;
+    bool nan_ = false;
+};
+
+/**
+ * Factors the batch n x n matrices of input and hands emit(b, det) the determinant of every matrix b. Batches are
+ * shared out over the cores; a batch too small for that factors its matrices one at a time with the trailing
+ * updates split across the cores.
+ */
+template <typename T, typename Emit>
+uint32_t LuDeterminantCompute(const CpuKernelContext& ctx, const T* input, int64_t batch, int64_t n, const Emit& emit,
+                              const char* name)
+{
+    if (batch == 0) {
+        return KERNEL_STATUS_OK;
+    }
+    auto factor = [input, n, &emit](int64_t start, int64_t end, const LinalgRunner& run) {
+        std::vector<T> a(static_cast<size_t>(n * n));
+        PartialPivotLu<T> lu;
+        for (int64_t b = start; b < end; b++) {
+            std::copy(input + b * n * n, input + (b + 1) * n * n, a.begin());
+            emit(b, lu.Factor(a.data(), n, run));
+        }
+    };
+
+    const int64_t cores = std::max<int64_t>(1, static_cast<int64_t>(CpuKernelUtils::GetCPUNum(ctx)));
+    if (cores == 1 || (batch == 1 && n * n < kLuSplitElements)) {
+        factor(0, batch, LinalgRunSerial);
+        return KERNEL_STATUS_OK;
+    }
+    if (batch >= cores || n * n < kLuSplitElements) {
+        KERNEL_LOG_INFO("[%s] lu: path=batch, batch=%ld, n=%ld", name, batch, n);
+        auto shard = [&factor](int64_t start, int64_t end) { factor(start, end, LinalgRunSerial); };
+        KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, batch, (batch + cores - 1) / cores, shard),
+                            "[%s] ParallelFor failed.", name)
+        return KERNEL_STATUS_OK;
+    }
+    KERNEL_LOG_INFO("[%s] lu: path=split, batch=%ld, n=%ld", name, batch, n);
+    uint32_t status = KERNEL_STATUS_OK;
+    auto split_run = [&ctx, &status, cores](int64_t total, int64_t min_chunk, const LinalgRangeFn& fn) {
+        const int64_t per_unit = std::max(min_chunk, (total + cores - 1) / cores);
+        if (total <= per_unit) {
+            LinalgRunSerial(total, min_chunk, fn);
+        } else if (CpuKernelUtils::ParallelFor(ctx, total, per_unit, fn) != KERNEL_STATUS_OK) {
+            status = KERNEL_STATUS_INNER_ERROR;
+        }
+    };
+    factor(0, batch, split_run);
+    KERNEL_CHECK_FALSE(status == KERNEL_STATUS_OK, status, "[%s] ParallelFor failed.", name);
+    return KERNEL_STATUS_OK;
+}
+} // namespace aicpu
+
+#endif // OPS_MATH_COMMON_AICPU_LU_DETERMINANT_H
@@ -0,0 +1,210 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file radix_sort.h
+ * \brief Stable LSD radix sort of (key, index) pairs shared by the sorting AICPU kernels (SegmentSort, Unique).
+ *
+ * Values are first mapped onto unsigned keys by RadixKey<T>::Encode, so every dtype is sorted as plain unsigned
+ * integers 8 bits per pass. RadixSortSerial sorts on the calling thread, RadixSortParallel spreads every pass of
+ * one long range over the cores. Both ping-pong between data and tmp and hand back the buffer holding the result.
+ */
+
+#ifndef OPS_MATH_COMMON_AICPU_RADIX_SORT_H
+#define OPS_MATH_COMMON_AICPU_RADIX_SORT_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "cpu_kernel.h"
+#include "cpu_kernel_utils.h"
+#include "log.h"
+#include "status.h"
+#include "utils/eigen_tensor.h"
+#include "utils/kernel_util.h"
+
+namespace aicpu {
+constexpr int64_t kRadixBits = 8;
+constexpr int64_t kRadixBins = 1 << kRadixBits;
+
+/**
+ * Maps a value onto an unsigned key whose natural order is the ascending order of the values, so every path can
+ * sort plain unsigned integers. Signed integers flip the sign bit; floats flip the sign bit of positives and every
+ * bit of negatives. -0 is folded onto +0 so the two stay in input order, and every NaN maps to the largest key so
+ * NaNs sort last, as in pytorch.
+ */
+template <typename T, typename Enable = void>
+struct RadixKey {
+    using Key = typename std::make_unsigned<T>::type;
+    static Key Encode(T v)
+    {
+        constexpr Key kSignBit = std::is_signed<T>::value ? Key(Key(1) << (sizeof(Key) * 8 - 1)) : Key(0);
+        return static_cast<Key>(static_cast<Key>(v) ^ kSignBit);
+    }
+};
+
+template <typename T, typename K>
+struct FloatRadixKey {
+    using Key = K;
+    static Key Encode(T v)
+    {
+        constexpr Key kSignBit = Key(Key(1) << (sizeof(Key) * 8 - 1));
+        if (v != v) {
+            return std::numeric_limits<Key>::max();
+        }
+        if (v == T(0)) {
+            v = T(0);
+        }
+        Key bits;
+        static_assert(sizeof(T) == sizeof(Key), "key width must match the value width");
+        std::memcpy(&bits, &v, sizeof(Key));
+        return (bits & kSignBit) != 0 ? static_cast<Key>(~bits) : static_cast<Key>(bits | kSignBit);
+    }
+};
+
+template <>
+struct RadixKey<Eigen::half> : FloatRadixKey<Eigen::half, uint16_t> {};
+template <>
+struct RadixKey<Eigen::bfloat16> : FloatRadixKey<Eigen::bfloat16, uint16_t> {};
+template <>
+struct RadixKey<float> : FloatRadixKey<float, uint32_t> {};
+template <>
+struct RadixKey<double> : FloatRadixKey<double, uint64_t> {};
+
+// index is the position inside the sorted range; callers reject ranges that do not fit in 32 bits.
+template <typename Key>
+struct KeyIndex {
+    Key key;
+    uint32_t index;
+};
+
+template <typename Key>
+inline uint32_t Digit(Key key, int64_t pass)
+{
+    return static_cast<uint32_t>(key >> (pass * kRadixBits)) & static_cast<uint32_t>(kRadixBins - 1);
+}
+
+// Stable: an element only moves past strictly greater keys.
+template <typename Key>
+void InsertionSort(KeyIndex<Key>* data, int64_t len)
+{
+    for (int64_t i = 1; i < len; i++) {
+        const KeyIndex<Key> cur = data[i];
+        int64_t j = i - 1;
+        while (j >= 0 && data[j].key > cur.key) {
+            data[j + 1] = data[j];
+            j--;
+        }
+        data[j + 1] = cur;
+    }
+}
+
+/**
+ * LSD radix sort on one core, returning whichever of data / tmp holds the result. The histograms of every digit are
+ * gathered in one sweep, and a digit on which all keys agree costs no pass (e.g. the high bytes of small integers).
+ */
+template <typename Key>
+KeyIndex<Key>* RadixSortSerial(KeyIndex<Key>* data, KeyIndex<Key>* tmp, int64_t len)
+{
+    constexpr int64_t kPasses = static_cast<int64_t>(sizeof(Key));
+    int64_t hist[kPasses][kRadixBins] = {};
+    for (int64_t i = 0; i < len; i++) {
+        for (int64_t p = 0; p < kPasses; p++) {
+            hist[p][Digit(data[i].key, p)]++;
+        }
+    }
+    KeyIndex<Key>* src = data;
+    KeyIndex<Key>* dst = tmp;
+    for (int64_t p = 0; p < kPasses; p++) {
+        if (hist[p][Digit(src[0].key, p)] == len) {
+            continue;
+        }
+        int64_t pos[kRadixBins];
+        int64_t run = 0;
+        for (int64_t d = 0; d < kRadixBins; d++) {
+            pos[d] = run;
+            run += hist[p][d];
+        }
+        for (int64_t i = 0; i < len; i++) {
+            dst[pos[Digit(src[i].key, p)]++] = src[i];
+        }
+        std::swap(src, dst);
+    }
+    return src;
+}
+
+/**
+ * LSD radix sort of one long range over every core. Each pass cuts the range into one chunk per core: the chunks
+ * count their digits, the counts are scanned digit-major then chunk-major into the first slot of every (digit, chunk),
+ * and every chunk scatters its elements in order, which keeps the pass stable.
+ */
+template <typename Key>
+uint32_t RadixSortParallel(const CpuKernelContext& ctx, KeyIndex<Key>* data, KeyIndex<Key>* tmp, int64_t len,
+                           int64_t cores, KeyIndex<Key>** result,
+                           const char* name)
+{
+    constexpr int64_t kPasses = static_cast<int64_t>(sizeof(Key));
+    const int64_t chunk_len = (len + cores - 1) / cores;
+    const int64_t chunks = (len + chunk_len - 1) / chunk_len;
+    std::vector<int64_t> counts(static_cast<size_t>(chunks * kRadixBins));
+    KeyIndex<Key>* src = data;
+    KeyIndex<Key>* dst = tmp;
+    for (int64_t p = 0; p < kPasses; p++) {
+        std::fill(counts.begin(), counts.end(), 0);
+        auto count = [&](int64_t begin, int64_t end) {
+            for (int64_t c = begin; c < end; c++) {
+                int64_t* hist = counts.data() + c * kRadixBins;
+                const int64_t stop = std::min(len, (c + 1) * chunk_len);
+                for (int64_t i = c * chunk_len; i < stop; i++) {
+                    hist[Digit(src[i].key, p)]++;
+                }
+            }
+        };
+        KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, chunks, 1, count),
+                            "[%s] radix count pass failed.", name)
+        int64_t run = 0;
+        bool single_digit = false;
+        for (int64_t d = 0; d < kRadixBins && !single_digit; d++) {
+            const int64_t digit_begin = run;
+            for (int64_t c = 0; c < chunks; c++) {
+                int64_t& slot = counts[c * kRadixBins + d];
+                const int64_t num = slot;
+                slot = run;
+                run += num;
+            }
+            single_digit = (run - digit_begin == len);
+        }
+        if (single_digit) {
+            continue;
+        }
+        auto scatter = [&](int64_t begin, int64_t end) {
+            for (int64_t c = begin; c < end; c++) {
+                int64_t* pos = counts.data() + c * kRadixBins;
+                const int64_t stop = std::min(len, (c + 1) * chunk_len);
+                for (int64_t i = c * chunk_len; i < stop; i++) {
+                    dst[pos[Digit(src[i].key, p)]++] = src[i];
+                }
+            }
+        };
+        KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, chunks, 1, scatter),
+                            "[%s] radix scatter pass failed.", name)
+        std::swap(src, dst);
+    }
+    *result = src;
+    return KERNEL_STATUS_OK;
+}
+} // namespace aicpu
+
+#endif // OPS_MATH_COMMON_AICPU_RADIX_SORT_H
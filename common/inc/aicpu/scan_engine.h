@@ -0,0 +1,282 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file scan_engine.h
+ * \brief Prefix scan along one axis shared by the cumulative AICPU kernels (Cumsum, Cumprod, Cummax, Cummin).
+ *
+ * The scanned axis of length depth splits the tensor into inner (dims before the axis) x outer (dims after it)
+ * independent lines, element (i, d, o) sitting at (i * depth + d) * outer + o. When there are at least as many lines
+ * as cores the lines are shared out, a slice of outer at a time. Otherwise the axis itself is cut into chunks and
+ * scanned in three passes: every chunk reduces to its total, the totals are scanned serially into the carry of each
+ * chunk, and every chunk is scanned again seeded with its carry. The op only has to be associative.
+ *
+ * An op provides State, Identity(), Load(offset, d), Combine(earlier, later) and Store(offset, state); kBytes is the
+ * size of one input element.
+ */
+
+#ifndef OPS_MATH_COMMON_AICPU_SCAN_ENGINE_H
+#define OPS_MATH_COMMON_AICPU_SCAN_ENGINE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "cpu_kernel.h"
+#include "cpu_kernel_utils.h"
+#include "log.h"
+#include "status.h"
+#include "utils/kernel_util.h"
+
+namespace aicpu {
+// Tensors of at most kScanSerialBytes are scanned on the calling thread.
+constexpr int64_t kScanSerialBytes = 512 * 1024;
+// Depth chunks hold at least this many elements, so the chunk totals stay cheap to scan.
+constexpr int64_t kScanMinChunkElements = 16 * 1024;
+constexpr uint32_t kScanReserveCores = 2U;
+
+struct ScanLayout {
+    int64_t inner = 1;
+    int64_t depth = 1;
+    int64_t outer = 1;
+    bool exclusive = false;
+    bool reverse = false;
+};
+
+template <typename T, typename Acc>
+struct ScanSumOp {
+    using State = Acc;
+    static constexpr int64_t kBytes = sizeof(T);
+    const T* input;
+    T* output;
+
+    State Identity() const
+    {
+        return static_cast<Acc>(0);
+    }
+    State Load(int64_t offset, int64_t) const
+    {
+        return static_cast<Acc>(input[offset]);
+    }
+    static State Combine(const State& earlier, const State& later)
+    {
+        return earlier + later;
+    }
+    void Store(int64_t offset, const State& state) const
+    {
+        output[offset] = static_cast<T>(state);
+    }
+};
+
+template <typename T, typename Acc>
+struct ScanProdOp {
+    using State = Acc;
+    static constexpr int64_t kBytes = sizeof(T);
+    const T* input;
+    T* output;
+
+    State Identity() const
+    {
+        return static_cast<Acc>(1);
+    }
+    State Load(int64_t offset, int64_t) const
+    {
+        return static_cast<Acc>(input[offset]);
+    }
+    static State Combine(const State& earlier, const State& later)
+    {
+        return earlier * later;
+    }
+    void Store(int64_t offset, const State& state) const
+    {
+        output[offset] = static_cast<T>(state);
+    }
+};
+
+/**
+ * Running max (kMax) or min with the position of the element along the axis. As in pytorch, a NaN wins over every
+ * number and ties (and later NaNs) move the index to the later element, which keeps Combine associative.
+ */
+template <typename T, typename Acc, typename Idx, bool kMax>
+struct ScanExtremumOp {
+    struct State {
+        Acc value;
+        int64_t index; // -1 for the identity
+    };
+    static constexpr int64_t kBytes = sizeof(T);
+    const T* input;
+    T* values;
+    Idx* indices;
+
+    State Identity() const
+    {
+        return {static_cast<Acc>(0), -1};
+    }
+    State Load(int64_t offset, int64_t d) const
+    {
+        return {static_cast<Acc>(input[offset]), d};
+    }
+    static State Combine(const State& earlier, const State& later)
+    {
+        if (earlier.index < 0) {
+            return later;
+        }
+        const bool later_nan = (later.value != later.value);
+        const bool earlier_nan = (earlier.value != earlier.value);
+        const bool take = later_nan || (!earlier_nan && (kMax ? later.value >= earlier.value
+                                                              : later.value <= earlier.value));
+        return (later.index >= 0 && take) ? later : earlier;
+    }
+    void Store(int64_t offset, const State& state) const
+    {
+        values[offset] = static_cast<T>(state.value);
+        indices[offset] = static_cast<Idx>(state.index);
+    }
+};
+
+// Scans positions [p0, p1) of the lines (i, o0 .. o1), carry holding the running state of every line.
+template <typename Op>
+void ScanLines(const Op& op, const ScanLayout& layout, int64_t i, int64_t o0, int64_t o1, int64_t p0, int64_t p1,
+               typename Op::State* carry)
+{
+    const int64_t width = o1 - o0;
+    for (int64_t p = p0; p < p1; p++) {
+        const int64_t d = layout.reverse ? layout.depth - 1 - p : p;
+        const int64_t row = (i * layout.depth + d) * layout.outer + o0;
+        if (p + 1 < p1) {
+            const int64_t next = layout.reverse ? d - 1 : d + 1;
+            __builtin_prefetch(op.input + (i * layout.depth + next) * layout.outer + o0, 0, 1);
+        }
+        if (layout.exclusive) {
+            for (int64_t o = 0; o < width; o++) {
+                const auto x = op.Load(row + o, d);
+                op.Store(row + o, carry[o]);
+                carry[o] = Op::Combine(carry[o], x);
+            }
+        } else {
+            for (int64_t o = 0; o < width; o++) {
+                carry[o] = Op::Combine(carry[o], op.Load(row + o, d));
+                op.Store(row + o, carry[o]);
+            }
+        }
+    }
+}
+
+// Folds positions [p0, p1) of the lines (i, o0 .. o1) into total without writing anything.
+template <typename Op>
+void ReduceLines(const Op& op, const ScanLayout& layout, int64_t i, int64_t o0, int64_t o1, int64_t p0, int64_t p1,
+                 typename Op::State* total)
+{
+    const int64_t width = o1 - o0;
+    for (int64_t p = p0; p < p1; p++) {
+        const int64_t d = layout.reverse ? layout.depth - 1 - p : p;
+        const int64_t row = (i * layout.depth + d) * layout.outer + o0;
+        for (int64_t o = 0; o < width; o++) {
+            total[o] = Op::Combine(total[o], op.Load(row + o, d));
+        }
+    }
+}
+
+template <typename Op>
+void ScanWholeLines(const Op& op, const ScanLayout& layout, int64_t i, int64_t o0, int64_t o1)
+{
+    std::vector<typename Op::State> carry(static_cast<size_t>(o1 - o0), op.Identity());
+    ScanLines(op, layout, i, o0, o1, 0, layout.depth, carry.data());
+}
+
+// Cuts the axis into chunks when there are fewer lines than cores (e.g. a long 1-D scan).
+template <typename Op>
+uint32_t ScanDepthChunked(const CpuKernelContext& ctx, const Op& op, const ScanLayout& layout, int64_t cores,
+                          const char* name)
+{
+    using State = typename Op::State;
+    const int64_t min_len = std::max<int64_t>(1, kScanMinChunkElements / layout.outer);
+    const int64_t chunk_len = std::max(min_len, (layout.depth + cores - 1) / cores);
+    const int64_t chunks = (layout.depth + chunk_len - 1) / chunk_len;
+    const int64_t units = layout.inner * chunks;
+    const int64_t outer = layout.outer;
+    KERNEL_LOG_INFO("[%s] scan: path=depth_chunked, chunks=%ld, chunk_len=%ld", name, chunks, chunk_len);
+
+    // carries[(i * chunks + c) * outer + o]: total of chunk c first, then the state entering it.
+    std::vector<State> carries(static_cast<size_t>(units * outer), op.Identity());
+    auto reduce = [&](int64_t begin, int64_t end) {
+        for (int64_t u = begin; u < end; u++) {
+            const int64_t c = u % chunks;
+            if (c + 1 < chunks) {
+                ReduceLines(op, layout, u / chunks, 0, outer, c * chunk_len, (c + 1) * chunk_len,
+                            carries.data() + u * outer);
+            }
+        }
+    };
+    KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, units, 1, reduce), "[%s] scan reduce pass failed.", name)
+
+    for (int64_t i = 0; i < layout.inner; i++) {
+        std::vector<State> running(static_cast<size_t>(outer), op.Identity());
+        for (int64_t c = 0; c < chunks; c++) {
+            State* slot = carries.data() + (i * chunks + c) * outer;
+            for (int64_t o = 0; o < outer; o++) {
+                const State total = slot[o];
+                slot[o] = running[o];
+                running[o] = Op::Combine(running[o], total);
+            }
+        }
+    }
+
+    auto scan = [&](int64_t begin, int64_t end) {
+        for (int64_t u = begin; u < end; u++) {
+            const int64_t c = u % chunks;
+            ScanLines(op, layout, u / chunks, 0, outer, c * chunk_len, std::min(layout.depth, (c + 1) * chunk_len),
+                      carries.data() + u * outer);
+        }
+    };
+    KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, units, 1, scan), "[%s] scan pass failed.", name)
+    return KERNEL_STATUS_OK;
+}
+
+template <typename Op>
+uint32_t ScanCompute(const CpuKernelContext& ctx, const Op& op, const ScanLayout& layout, const char* name)
+{
+    const int64_t lines = layout.inner * layout.outer;
+    const int64_t total = lines * layout.depth;
+    if (total == 0) {
+        return KERNEL_STATUS_OK;
+    }
+    const uint32_t cpu_num = CpuKernelUtils::GetCPUNum(ctx);
+    const int64_t cores =
+        static_cast<int64_t>(std::max(1U, std::max(cpu_num, kScanReserveCores) - kScanReserveCores));
+    if (cores == 1 || total * Op::kBytes <= kScanSerialBytes) {
+        for (int64_t i = 0; i < layout.inner; i++) {
+            ScanWholeLines(op, layout, i, 0, layout.outer);
+        }
+        return KERNEL_STATUS_OK;
+    }
+    if (lines < cores && layout.depth >= 2 * kScanMinChunkElements / layout.outer) {
+        return ScanDepthChunked(ctx, op, layout, cores, name);
+    }
+
+    // Every unit scans one inner index over a slice of outer, enough slices per inner index to feed every core.
+    const int64_t slices_per_inner = std::max<int64_t>(1, (cores + layout.inner - 1) / layout.inner);
+    const int64_t slice = std::max<int64_t>(1, (layout.outer + slices_per_inner - 1) / slices_per_inner);
+    const int64_t slices = (layout.outer + slice - 1) / slice;
+    const int64_t units = layout.inner * slices;
+    KERNEL_LOG_INFO("[%s] scan: path=lines, units=%ld, slice=%ld", name, units, slice);
+    auto shard = [&op, &layout, slices, slice](int64_t begin, int64_t end) {
+        for (int64_t u = begin; u < end; u++) {
+            const int64_t o0 = (u % slices) * slice;
+            ScanWholeLines(op, layout, u / slices, o0, std::min(layout.outer, o0 + slice));
+        }
+    };
+    KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, units, std::max<int64_t>(1, units / cores), shard),
+                        "[%s] scan ParallelFor failed.", name)
+    return KERNEL_STATUS_OK;
+}
+} // namespace aicpu
+
+#endif // OPS_MATH_COMMON_AICPU_SCAN_ENGINE_H
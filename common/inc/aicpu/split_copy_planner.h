@@ -0,0 +1,222 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file split_copy_planner.h
+ * \brief Copy planner shared by the split / unstack AICPU kernels (SplitV, SplitD, Unpack).
+ *
+ * The input is viewed as [prefix, axis, inner]. Output i takes the axis slices [offset_i, offset_i + size_i) of every
+ * prefix row, so the work is a grid of prefix x outputs row copies of size_i * inner elements each:
+ *   - When prefix is 1 or a single output takes the whole axis, the rows of an output are contiguous in both the
+ *     input and the output and are merged into one copy, which is then cut into chunks for the cores.
+ *   - Otherwise the (row, output) grid is sharded over the cores in input order, so every core streams a contiguous
+ *     stretch of the input.
+ *   - Runs of at most kSplitTypedCopyBytes are copied with word-sized loads and stores instead of a memcpy call.
+ */
+
+#ifndef OPS_MATH_COMMON_AICPU_SPLIT_COPY_PLANNER_H
+#define OPS_MATH_COMMON_AICPU_SPLIT_COPY_PLANNER_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "cpu_kernel.h"
+#include "cpu_kernel_utils.h"
+#include "log.h"
+#include "status.h"
+#include "utils/kernel_util.h"
+
+namespace aicpu {
+constexpr int64_t kSplitTypedCopyBytes = 128;
+constexpr int64_t kSplitParallelBytes = 256 * 1024;
+constexpr int64_t kSplitMinShardBytes = 64 * 1024;
+constexpr int64_t kSplitChunkBytes = 1024 * 1024;
+
+struct SplitCopyPlan {
+    const uint8_t* input = nullptr;
+    int64_t elem_size = 0;
+    int64_t prefix = 1;
+    int64_t axis = 0;
+    int64_t inner = 1;
+    // Outputs with a non-empty slice, in axis order.
+    std::vector<uint8_t*> outputs;
+    std::vector<int64_t> offsets;
+    std::vector<int64_t> sizes;
+};
+
+// View `shape` as [prefix, shape[axis], inner] around the split axis.
+inline void InitSplitCopyPlan(const void* input, int64_t elem_size, const std::vector<int64_t>& shape, int64_t axis,
+                              SplitCopyPlan& plan)
+{
+    plan.input = static_cast<const uint8_t*>(input);
+    plan.elem_size = elem_size;
+    plan.prefix = 1;
+    plan.inner = 1;
+    for (int64_t i = 0; i < axis; i++) {
+        plan.prefix *= shape[i];
+    }
+    plan.axis = shape[axis];
+    for (size_t i = static_cast<size_t>(axis) + 1; i < shape.size(); i++) {
+        plan.inner *= shape[i];
+    }
+    plan.outputs.clear();
+    plan.offsets.clear();
+    plan.sizes.clear();
+}
+
+// Append the next output along the axis. Empty slices only advance the offset, their data may be null.
+inline void AddSplitOutput(SplitCopyPlan& plan, void* output, int64_t size, int64_t& offset)
+{
+    if (size > 0) {
+        plan.outputs.push_back(static_cast<uint8_t*>(output));
+        plan.offsets.push_back(offset);
+        plan.sizes.push_back(size);
+    }
+    offset += size;
+}
+
+template <typename W>
+inline void CopySplitWords(uint8_t* dst, const uint8_t* src, int64_t bytes)
+{
+    W* d = reinterpret_cast<W*>(dst);
+    const W* s = reinterpret_cast<const W*>(src);
+    const int64_t count = bytes / static_cast<int64_t>(sizeof(W));
+    for (int64_t i = 0; i < count; i++) {
+        d[i] = s[i];
+    }
+}
+
+// Copy one contiguous run. Short runs use the widest word that both addresses and the length are aligned to.
+inline bool CopySplitRun(uint8_t* dst, const uint8_t* src, int64_t bytes)
+{
+    if (bytes > kSplitTypedCopyBytes) {
+        return BiggerMemCpy(dst, static_cast<size_t>(bytes), src, static_cast<size_t>(bytes));
+    }
+    const uintptr_t align = reinterpret_cast<uintptr_t>(dst) | reinterpret_cast<uintptr_t>(src) |
+                            static_cast<uintptr_t>(bytes);
+    if ((align % sizeof(uint64_t)) == 0) {
+        CopySplitWords<uint64_t>(dst, src, bytes);
+    } else if ((align % sizeof(uint32_t)) == 0) {
+        CopySplitWords<uint32_t>(dst, src, bytes);
+    } else if ((align % sizeof(uint16_t)) == 0) {
+        CopySplitWords<uint16_t>(dst, src, bytes);
+    } else {
+        CopySplitWords<uint8_t>(dst, src, bytes);
+    }
+    return true;
+}
+
+inline bool SplitRowsMerged(const SplitCopyPlan& plan)
+{
+    return plan.prefix == 1 || (plan.outputs.size() == 1 && plan.sizes[0] == plan.axis);
+}
+
+// Copy grid units [start, end), unit u being output u % outputs of prefix row u / outputs.
+inline bool RunSplitGridUnits(const SplitCopyPlan& plan, int64_t start, int64_t end)
+{
+    const int64_t out_num = static_cast<int64_t>(plan.outputs.size());
+    const int64_t row_bytes = plan.axis * plan.inner * plan.elem_size;
+    const int64_t slice_bytes = plan.inner * plan.elem_size;
+    int64_t row = start / out_num;
+    int64_t out = start % out_num;
+    for (int64_t unit = start; unit < end; unit++) {
+        const int64_t bytes = plan.sizes[out] * slice_bytes;
+        const uint8_t* src = plan.input + row * row_bytes + plan.offsets[out] * slice_bytes;
+        if (!CopySplitRun(plan.outputs[out] + row * bytes, src, bytes)) {
+            KERNEL_LOG_ERROR("Copy size[%ld] from input to output slice[%ld] of row[%ld] failed.", bytes, out, row);
+            return false;
+        }
+        if (++out == out_num) {
+            out = 0;
+            row++;
+        }
+    }
+    return true;
+}
+
+// Merged plan: every output is one contiguous copy of prefix * size_i * inner elements, cut into kSplitChunkBytes
+// chunks. chunk_starts[i] is the first chunk index of output i.
+inline bool RunSplitChunks(const SplitCopyPlan& plan, const std::vector<int64_t>& chunk_starts, int64_t start,
+                           int64_t end)
+{
+    const int64_t slice_bytes = plan.inner * plan.elem_size;
+    size_t out = static_cast<size_t>(
+        std::upper_bound(chunk_starts.begin(), chunk_starts.end(), start) - chunk_starts.begin() - 1);
+    for (int64_t chunk = start; chunk < end; chunk++) {
+        while (out + 1 < chunk_starts.size() && chunk >= chunk_starts[out + 1]) {
+            out++;
+        }
+        const int64_t total = plan.prefix * plan.sizes[out] * slice_bytes;
+        const int64_t begin = (chunk - chunk_starts[out]) * kSplitChunkBytes;
+        const int64_t bytes = std::min(kSplitChunkBytes, total - begin);
+        // With prefix > 1 the only output spans whole rows, so its offset is 0 and the input is one run too.
+        const uint8_t* src = plan.input + plan.offsets[out] * slice_bytes + begin;
+        if (!CopySplitRun(plan.outputs[out] + begin, src, bytes)) {
+            KERNEL_LOG_ERROR("Copy size[%ld] from input to output slice[%zu] failed.", bytes, out);
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Execute `plan`. Inputs below kSplitParallelBytes are copied inline; larger ones are sharded so each shard moves
+ * at least kSplitMinShardBytes.
+ */
+inline uint32_t RunSplitCopyPlan(const CpuKernelContext& ctx, const SplitCopyPlan& plan)
+{
+    if (plan.outputs.empty() || plan.inner == 0 || plan.prefix == 0) {
+        return KERNEL_STATUS_OK;
+    }
+    const int64_t total_bytes = plan.prefix * plan.axis * plan.inner * plan.elem_size;
+    const int64_t cores = std::max<int64_t>(1, static_cast<int64_t>(CpuKernelUtils::GetCPUNum(ctx)));
+    const bool parallel = cores > 1 && total_bytes >= kSplitParallelBytes;
+
+    int64_t units = 0;
+    std::vector<int64_t> chunk_starts;
+    const bool merged = SplitRowsMerged(plan);
+    if (merged) {
+        const int64_t slice_bytes = plan.inner * plan.elem_size;
+        for (size_t i = 0; i < plan.outputs.size(); i++) {
+            chunk_starts.push_back(units);
+            const int64_t bytes = plan.prefix * plan.sizes[i] * slice_bytes;
+            units += (bytes + kSplitChunkBytes - 1) / kSplitChunkBytes;
+        }
+    } else {
+        units = plan.prefix * static_cast<int64_t>(plan.outputs.size());
+    }
+    auto run_units = [&plan, &chunk_starts, merged](int64_t start, int64_t end) {
+        return merged ? RunSplitChunks(plan, chunk_starts, start, end) : RunSplitGridUnits(plan, start, end);
+    };
+    if (!parallel) {
+        KERNEL_CHECK_FALSE(run_units(0, units), KERNEL_STATUS_INNER_ERROR, "[%s] Split copy failed.",
+                           ctx.GetOpType().c_str());
+        return KERNEL_STATUS_OK;
+    }
+
+    const int64_t unit_bytes = std::max<int64_t>(1, total_bytes / units);
+    const int64_t per_unit =
+        std::max((units + cores - 1) / cores, (kSplitMinShardBytes + unit_bytes - 1) / unit_bytes);
+    std::atomic<bool> failed{false};
+    auto shard = [&run_units, &failed](int64_t start, int64_t end) {
+        if (!failed.load(std::memory_order_relaxed) && !run_units(start, end)) {
+            failed.store(true, std::memory_order_relaxed);
+        }
+    };
+    KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, units, per_unit, shard), "[%s] Split copy ParallelFor failed.",
+                        ctx.GetOpType().c_str())
+    KERNEL_CHECK_FALSE(!failed.load(std::memory_order_relaxed), KERNEL_STATUS_INNER_ERROR, "[%s] Split copy failed.",
+                       ctx.GetOpType().c_str());
+    return KERNEL_STATUS_OK;
+}
+} // namespace aicpu
+#endif // OPS_MATH_COMMON_AICPU_SPLIT_COPY_PLANNER_H
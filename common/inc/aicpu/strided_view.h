@@ -0,0 +1,290 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file strided_view.h
+ * \brief Strided (non-contiguous) operand support for elementwise AICPU kernels.
+ *
+ * An AICPU tensor only carries a data pointer and a shape. The op_api layer launches a non-contiguous aclTensor as a
+ * flat tensor over its whole storage plus three attrs per input, mirroring viewShape/viewStrides/viewOffset:
+ *   view_shape_<i>   ListInt  logical shape of input i
+ *   view_strides_<i> ListInt  element strides of input i
+ *   view_offset_<i>  Int      element offset of input i inside its storage
+ * Inputs without these attrs (or with the empty defaults) are contiguous views of their own data, so kernels read
+ * every operand the same way.
+ */
+
+#ifndef OPS_MATH_COMMON_AICPU_STRIDED_VIEW_H
+#define OPS_MATH_COMMON_AICPU_STRIDED_VIEW_H
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "cpu_kernel.h"
+#include "cpu_kernel_utils.h"
+#include "log.h"
+#include "status.h"
+#include "utils/kernel_util.h"
+
+namespace aicpu {
+constexpr int32_t kStridedMaxDims = 8;
+
+inline std::string ViewShapeAttrName(uint32_t index)
+{
+    return "view_shape_" + std::to_string(index);
+}
+
+inline std::string ViewStridesAttrName(uint32_t index)
+{
+    return "view_strides_" + std::to_string(index);
+}
+
+inline std::string ViewOffsetAttrName(uint32_t index)
+{
+    return "view_offset_" + std::to_string(index);
+}
+
+struct StridedOperand {
+    std::vector<int64_t> shape;
+    std::vector<int64_t> strides;
+    int64_t offset = 0;
+};
+
+// The attrs are optional with empty defaults; a 0-d view is always contiguous and is never launched as strided.
+inline bool HasStridedView(const CpuKernelContext& ctx, uint32_t index)
+{
+    AttrValue* strides = ctx.GetAttr(ViewStridesAttrName(index));
+    return strides != nullptr && strides->ListIntSize() > 0;
+}
+
+// Read input `index` as a strided operand and check that every element of the view lies inside the storage.
+inline uint32_t GetStridedOperand(const CpuKernelContext& ctx, uint32_t index, StridedOperand& operand)
+{
+    Tensor* tensor = ctx.Input(index);
+    KERNEL_CHECK_NULLPTR(tensor, KERNEL_STATUS_PARAM_INVALID, "[%s] Get input[%u] failed.", ctx.GetOpType().c_str(),
+                         index)
+    operand.shape = tensor->GetTensorShape()->GetDimSizes();
+    operand.offset = 0;
+    if (!HasStridedView(ctx, index)) {
+        operand.strides.assign(operand.shape.size(), 1);
+        for (int64_t d = static_cast<int64_t>(operand.shape.size()) - 2; d >= 0; --d) {
+            operand.strides[d] = operand.strides[d + 1] * operand.shape[d + 1];
+        }
+        return KERNEL_STATUS_OK;
+    }
+
+    AttrValue* shape_attr = ctx.GetAttr(ViewShapeAttrName(index));
+    AttrValue* offset_attr = ctx.GetAttr(ViewOffsetAttrName(index));
+    KERNEL_CHECK_NULLPTR(shape_attr, KERNEL_STATUS_PARAM_INVALID, "[%s] Input[%u] has view strides but no view shape.",
+                         ctx.GetOpType().c_str(), index)
+    operand.shape = shape_attr->GetListInt();
+    operand.strides = ctx.GetAttr(ViewStridesAttrName(index))->GetListInt();
+    operand.offset = (offset_attr == nullptr) ? 0 : offset_attr->GetInt();
+    KERNEL_CHECK_FALSE((operand.shape.size() == operand.strides.size() &&
+                        operand.shape.size() <= static_cast<size_t>(kStridedMaxDims)),
+                       KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] Input[%u] view rank [%zu] and strides rank [%zu] are invalid.", ctx.GetOpType().c_str(),
+                       index, operand.shape.size(), operand.strides.size())
+
+    const int64_t elem_size = GetSizeByDataType(tensor->GetDataType());
+    KERNEL_CHECK_FALSE((elem_size > 0), KERNEL_STATUS_PARAM_INVALID, "[%s] Input[%u] data type [%s] is invalid.",
+                       ctx.GetOpType().c_str(), index, DTypeStr(tensor->GetDataType()).c_str())
+    const int64_t storage_num = static_cast<int64_t>(tensor->GetDataSize()) / elem_size;
+    int64_t last = operand.offset;
+    for (size_t d = 0; d < operand.shape.size(); ++d) {
+        KERNEL_CHECK_FALSE((operand.shape[d] >= 0 && operand.strides[d] >= 0), KERNEL_STATUS_PARAM_INVALID,
+                           "[%s] Input[%u] view dim[%zu] has shape [%ld] stride [%ld].", ctx.GetOpType().c_str(),
+                           index, d, operand.shape[d], operand.strides[d])
+        if (operand.shape[d] == 0) {
+            return KERNEL_STATUS_OK;
+        }
+        last += (operand.shape[d] - 1) * operand.strides[d];
+    }
+    KERNEL_CHECK_FALSE((operand.offset >= 0 && last < storage_num), KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] Input[%u] view reaches element [%ld] of a [%ld] element storage.", ctx.GetOpType().c_str(),
+                       index, last, storage_num)
+    return KERNEL_STATUS_OK;
+}
+
+// Iteration plan for out = op(x, y) over a broadcast of two strided operands into a contiguous output.
+// Output dims of size 1 are dropped and adjacent dims are collapsed whenever both operands step through them
+// as one dim, so transposed or sliced operands keep the longest possible innermost runs.
+struct StridedBinaryPlan {
+    int32_t ndims = 0;
+    int64_t out_shape[kStridedMaxDims] = {0};
+    int64_t out_strides[kStridedMaxDims] = {0};
+    int64_t x_strides[kStridedMaxDims] = {0};
+    int64_t y_strides[kStridedMaxDims] = {0};
+    int64_t x_offset = 0;
+    int64_t y_offset = 0;
+    int64_t total_elements = 0;
+};
+
+inline bool BuildStridedBinaryPlan(const StridedOperand& x, const StridedOperand& y, StridedBinaryPlan& plan)
+{
+    const int32_t x_rank = static_cast<int32_t>(x.shape.size());
+    const int32_t y_rank = static_cast<int32_t>(y.shape.size());
+    const int32_t max_rank = std::max(x_rank, y_rank);
+    if (max_rank > kStridedMaxDims) {
+        return false;
+    }
+    plan.x_offset = x.offset;
+    plan.y_offset = y.offset;
+
+    // Align ranks to the right; broadcast dims step with stride 0.
+    int64_t out[kStridedMaxDims];
+    int64_t xs[kStridedMaxDims];
+    int64_t ys[kStridedMaxDims];
+    plan.total_elements = 1;
+    for (int32_t d = 0; d < max_rank; ++d) {
+        const int32_t xd = d - (max_rank - x_rank);
+        const int32_t yd = d - (max_rank - y_rank);
+        const int64_t x_dim = (xd >= 0) ? x.shape[xd] : 1;
+        const int64_t y_dim = (yd >= 0) ? y.shape[yd] : 1;
+        if (x_dim != y_dim && x_dim != 1 && y_dim != 1) {
+            return false;
+        }
+        out[d] = (x_dim == 1) ? y_dim : x_dim;
+        xs[d] = (xd >= 0 && x_dim == out[d]) ? x.strides[xd] : 0;
+        ys[d] = (yd >= 0 && y_dim == out[d]) ? y.strides[yd] : 0;
+        plan.total_elements *= out[d];
+    }
+
+    plan.ndims = 0;
+    for (int32_t d = 0; d < max_rank; ++d) {
+        if (out[d] == 1) {
+            continue;
+        }
+        const int32_t last = plan.ndims - 1;
+        if (last >= 0 && plan.x_strides[last] == xs[d] * out[d] && plan.y_strides[last] == ys[d] * out[d]) {
+            plan.out_shape[last] *= out[d];
+            plan.x_strides[last] = xs[d];
+            plan.y_strides[last] = ys[d];
+            continue;
+        }
+        plan.out_shape[plan.ndims] = out[d];
+        plan.x_strides[plan.ndims] = xs[d];
+        plan.y_strides[plan.ndims] = ys[d];
+        plan.ndims++;
+    }
+    if (plan.ndims == 0) {
+        plan.ndims = 1;
+        plan.out_shape[0] = 1;
+        plan.x_strides[0] = 1;
+        plan.y_strides[0] = 1;
+    }
+    plan.out_strides[plan.ndims - 1] = 1;
+    for (int32_t d = plan.ndims - 2; d >= 0; --d) {
+        plan.out_strides[d] = plan.out_strides[d + 1] * plan.out_shape[d + 1];
+    }
+    return true;
+}
+
+// Read both inputs of a binary elementwise kernel (strided or not) and plan their broadcast into output 0.
+inline uint32_t GetStridedBinaryPlan(const CpuKernelContext& ctx, StridedBinaryPlan& plan)
+{
+    StridedOperand x;
+    StridedOperand y;
+    KERNEL_HANDLE_ERROR(GetStridedOperand(ctx, kFirstInputIndex, x), "[%s] Get strided input[0] failed.",
+                        ctx.GetOpType().c_str())
+    KERNEL_HANDLE_ERROR(GetStridedOperand(ctx, kSecondInputIndex, y), "[%s] Get strided input[1] failed.",
+                        ctx.GetOpType().c_str())
+    KERNEL_CHECK_FALSE(BuildStridedBinaryPlan(x, y, plan), KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] Input views [%s] and [%s] can not broadcast.", ctx.GetOpType().c_str(),
+                       VectorToString(x.shape).c_str(), VectorToString(y.shape).c_str())
+    const int64_t out_num = ctx.Output(kFirstOutputIndex)->NumElements();
+    KERNEL_CHECK_FALSE((plan.total_elements == out_num), KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] Broadcast of input views has [%ld] elements but output has [%ld].",
+                       ctx.GetOpType().c_str(), plan.total_elements, out_num)
+    return KERNEL_STATUS_OK;
+}
+
+// Walk output elements [start, end) of `plan` one innermost run at a time. `run(out_index, x_offset, y_offset, len)`
+// receives storage element offsets; inside a run x and y advance by plan.x_strides/y_strides[ndims - 1].
+// The start coordinate is decomposed once, afterwards only carries propagate between runs.
+template <typename RunFn>
+uint32_t ForEachStridedRun(const StridedBinaryPlan& plan, int64_t start, int64_t end, const RunFn& run)
+{
+    if (start >= end) {
+        return KERNEL_STATUS_OK;
+    }
+    const int32_t ndims = plan.ndims;
+    const int32_t inner = ndims - 1;
+    int64_t coords[kStridedMaxDims] = {0};
+    int64_t x_off = plan.x_offset;
+    int64_t y_off = plan.y_offset;
+    int64_t rem = start;
+    for (int32_t d = 0; d < ndims; ++d) {
+        coords[d] = rem / plan.out_strides[d];
+        rem -= coords[d] * plan.out_strides[d];
+        x_off += coords[d] * plan.x_strides[d];
+        y_off += coords[d] * plan.y_strides[d];
+    }
+
+    int64_t idx = start;
+    while (idx < end) {
+        const int64_t len = std::min(plan.out_shape[inner] - coords[inner], end - idx);
+        const uint32_t ret = run(idx, x_off, y_off, len);
+        if (ret != KERNEL_STATUS_OK) {
+            return ret;
+        }
+        idx += len;
+        coords[inner] += len;
+        x_off += len * plan.x_strides[inner];
+        y_off += len * plan.y_strides[inner];
+        for (int32_t d = inner; d > 0 && coords[d] == plan.out_shape[d]; --d) {
+            x_off += plan.x_strides[d - 1] - coords[d] * plan.x_strides[d];
+            y_off += plan.y_strides[d - 1] - coords[d] * plan.y_strides[d];
+            coords[d] = 0;
+            coords[d - 1]++;
+        }
+    }
+    return KERNEL_STATUS_OK;
+}
+
+// out[i] = op(x[i], y[i]) over output elements [start, end). The innermost stride pattern is loop invariant, so the
+// contiguous and broadcast-scalar runs get their own tight loops.
+template <typename TX, typename TY, typename TOut, typename Op>
+void StridedBinaryRange(const StridedBinaryPlan& plan, const TX* x, const TY* y, TOut* out, int64_t start,
+                        int64_t end, const Op& op)
+{
+    const int64_t x_inner = plan.x_strides[plan.ndims - 1];
+    const int64_t y_inner = plan.y_strides[plan.ndims - 1];
+    (void)ForEachStridedRun(plan, start, end, [&](int64_t idx, int64_t x_off, int64_t y_off, int64_t len) {
+        const TX* xp = x + x_off;
+        const TY* yp = y + y_off;
+        TOut* op_out = out + idx;
+        if (x_inner == 1 && y_inner == 1) {
+            for (int64_t i = 0; i < len; ++i) {
+                op_out[i] = op(xp[i], yp[i]);
+            }
+        } else if (y_inner == 0) {
+            const TY y_val = *yp;
+            for (int64_t i = 0; i < len; ++i) {
+                op_out[i] = op(xp[i * x_inner], y_val);
+            }
+        } else if (x_inner == 0) {
+            const TX x_val = *xp;
+            for (int64_t i = 0; i < len; ++i) {
+                op_out[i] = op(x_val, yp[i * y_inner]);
+            }
+        } else {
+            for (int64_t i = 0; i < len; ++i) {
+                op_out[i] = op(xp[i * x_inner], yp[i * y_inner]);
+            }
+        }
+        return static_cast<uint32_t>(KERNEL_STATUS_OK);
+    });
+}
+
+} // namespace aicpu
+
+#endif // OPS_MATH_COMMON_AICPU_STRIDED_VIEW_H
@@ -0,0 +1,126 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file unique_compact.h
+ * \brief Boundary flag scan and compaction shared by the Unique AICPU kernels (UniqueWithCountsAndSorting,
+ * UniqueConsecutive).
+ *
+ * A sequence of num positions falls into groups of equal neighbours, a group starting wherever op.IsHead(i) holds.
+ * The positions are cut into one chunk per core: every chunk counts its heads, the counts are scanned serially into
+ * the first group id of every chunk, and every chunk then walks its positions again, handing each head to
+ * op.Emit(group, i, unique_num) and every position to op.Assign(group, i). A chunk starting inside a group of the
+ * previous chunk keeps that part of the count aside, so counts are added up without two chunks writing one slot.
+ *
+ * An op provides IsHead(i) (true for i == 0), Emit(group, i, unique_num) and Assign(group, i).
+ */
+
+#ifndef OPS_MATH_COMMON_AICPU_UNIQUE_COMPACT_H
+#define OPS_MATH_COMMON_AICPU_UNIQUE_COMPACT_H
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "cpu_kernel.h"
+#include "cpu_kernel_utils.h"
+#include "log.h"
+#include "status.h"
+#include "utils/kernel_util.h"
+
+namespace aicpu {
+// Sequences of at most kUniqueSerialNum positions are compacted on the calling thread.
+constexpr int64_t kUniqueSerialNum = 64 * 1024;
+
+/**
+ * Groups the num positions of op, writing the size of every group to counts (when not null) and the number of
+ * groups to unique_num.
+ */
+template <typename Op>
+uint32_t UniqueCompact(const CpuKernelContext& ctx, const Op& op, int64_t num, int64_t* counts, int64_t& unique_num,
+                       const char* name)
+{
+    unique_num = 0;
+    if (num == 0) {
+        return KERNEL_STATUS_OK;
+    }
+    const int64_t cores = static_cast<int64_t>(std::max(1U, CpuKernelUtils::GetCPUNum(ctx)));
+    const int64_t chunk_len = (cores == 1 || num <= kUniqueSerialNum) ? num : (num + cores - 1) / cores;
+    const int64_t chunks = (num + chunk_len - 1) / chunk_len;
+
+    // first_group[c]: number of heads before chunk c once scanned; carry[c]: positions of chunk c that belong to the
+    // last group of an earlier chunk.
+    std::vector<int64_t> first_group(static_cast<size_t>(chunks), 0);
+    std::vector<int64_t> carry(static_cast<size_t>(chunks), 0);
+    auto count_heads = [&](int64_t begin, int64_t end) {
+        for (int64_t c = begin; c < end; c++) {
+            int64_t heads = 0;
+            const int64_t stop = std::min(num, (c + 1) * chunk_len);
+            for (int64_t i = c * chunk_len; i < stop; i++) {
+                heads += op.IsHead(i) ? 1 : 0;
+            }
+            first_group[c] = heads;
+        }
+    };
+    auto compact = [&](int64_t begin, int64_t end) {
+        for (int64_t c = begin; c < end; c++) {
+            const int64_t base = first_group[c];
+            int64_t group = base - 1;
+            const int64_t stop = std::min(num, (c + 1) * chunk_len);
+            for (int64_t i = c * chunk_len; i < stop; i++) {
+                if (op.IsHead(i)) {
+                    group++;
+                    op.Emit(group, i, unique_num);
+                    if (counts != nullptr) {
+                        counts[group] = 0;
+                    }
+                }
+                op.Assign(group, i);
+                if (counts == nullptr) {
+                    continue;
+                }
+                if (group < base) {
+                    carry[c]++;
+                } else {
+                    counts[group]++;
+                }
+            }
+        }
+    };
+
+    if (chunks == 1) {
+        count_heads(0, 1);
+    } else {
+        KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, chunks, 1, count_heads), "[%s] head count pass failed.",
+                            name)
+    }
+    for (int64_t c = 0; c < chunks; c++) {
+        const int64_t heads = first_group[c];
+        first_group[c] = unique_num;
+        unique_num += heads;
+    }
+    if (chunks == 1) {
+        compact(0, 1);
+    } else {
+        KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, chunks, 1, compact), "[%s] compaction pass failed.", name)
+    }
+    if (counts != nullptr) {
+        for (int64_t c = 1; c < chunks; c++) {
+            if (carry[c] != 0) {
+                counts[first_group[c] - 1] += carry[c];
+            }
+        }
+    }
+    KERNEL_LOG_INFO("[%s] unique: num=%ld, chunks=%ld, unique_num=%ld", name, num, chunks, unique_num);
+    return KERNEL_STATUS_OK;
+}
+} // namespace aicpu
+
+#endif // OPS_MATH_COMMON_AICPU_UNIQUE_COMPACT_H
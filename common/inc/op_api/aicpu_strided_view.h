@@ -0,0 +1,60 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file aicpu_strided_view.h
+ * \brief Launch non-contiguous inputs of elementwise AICPU kernels without a Contiguous copy.
+ *
+ * AICPU tensors do not carry strides, so a strided input is launched as a 1-D tensor over its whole storage and its
+ * view is passed as the view_shape_<i>/view_strides_<i>/view_offset_<i> attrs decoded by aicpu/strided_view.h.
+ */
+
+#ifndef MATH_COMMON_AICPU_STRIDED_VIEW_H
+#define MATH_COMMON_AICPU_STRIDED_VIEW_H
+
+#include "opdev/op_executor.h"
+#include "opdev/tensor_view_utils.h"
+
+namespace op {
+struct AicpuStridedInput {
+    const aclTensor* storage = nullptr;
+    const aclIntArray* viewShape = nullptr;
+    const aclIntArray* viewStrides = nullptr;
+    int64_t viewOffset = 0;
+};
+
+// True when a binary AICPU launch has to describe its inputs as views (at least one of them is non-contiguous).
+inline bool IsAicpuStridedLaunch(const aclTensor* self, const aclTensor* other)
+{
+    return !IsContiguous(self) || !IsContiguous(other);
+}
+
+// Build the storage tensor and view attrs of one input. Contiguous inputs are described the same way so the kernel
+// walks both operands with one plan.
+inline bool MakeAicpuStridedInput(const aclTensor* tensor, aclOpExecutor* executor, AicpuStridedInput& input)
+{
+    const Shape& viewShape = tensor->GetViewShape();
+    const auto& viewStrides = tensor->GetViewStrides();
+    FVector<int64_t> dims;
+    for (size_t i = 0; i < viewShape.GetDimNum(); i++) {
+        dims.push_back(viewShape.GetDim(i));
+    }
+    const Shape& storageShape = tensor->GetStorageShape();
+    Shape flatShape;
+    flatShape.AppendDim(storageShape.GetShapeSize());
+    input.storage = executor->CreateView(tensor, flatShape, storageShape, Strides{1}, 0);
+    input.viewShape = executor->AllocIntArray(dims.data(), dims.size());
+    input.viewStrides = executor->AllocIntArray(viewStrides.data(), viewStrides.size());
+    input.viewOffset = tensor->GetViewOffset();
+    return input.storage != nullptr && input.viewShape != nullptr && input.viewStrides != nullptr;
+}
+} // namespace op
+
+#endif // MATH_COMMON_AICPU_STRIDED_VIEW_H
@@ -0,0 +1,200 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file fft_plan_cache.h
+ * \brief Process-wide host cache of the DFT / twiddle tables uploaded by the FFT family (Rfft1D, Stft).
+ *
+ * A plan is the fp32 table exactly as it is copied to the device plus the radix factorization it was built from, so
+ * a device-side cache miss (new device, evicted entry, device budget exhausted) only costs a memcpy and the H2D copy
+ * instead of rebuilding O(n^2) trigonometric tables. Entries are evicted in LRU order under a byte budget; a plan
+ * larger than half of the budget is built and returned without being cached.
+ */
+
+#ifndef MATH_COMMON_FFT_PLAN_CACHE_H
+#define MATH_COMMON_FFT_PLAN_CACHE_H
+
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace op {
+static const int64_t DEFAULT_FFT_PLAN_CACHE_MAX_MEMORY = 512LL * 1024 * 1024;
+
+enum class FftPlanKind : int32_t {
+    RFFT1D_DFT = 0,        // Rfft1D, n <= 4096: dense (NZ) DFT matrix
+    RFFT1D_TERMINATOR = 1, // Rfft1D, n > 4096: mixed-radix DFT/twiddle tables, plus Bluestein chirps if needed
+    STFT_DFT = 2,          // Stft AiCore path: (2, K, nFftAlign) DFT matrix
+};
+
+// Everything the table values or layout depend on. Fields that do not apply to a kind are left 0.
+struct FftPlanKey {
+    FftPlanKind kind = FftPlanKind::RFFT1D_DFT;
+    int64_t length = 0;     // transform length (n / nFft)
+    int64_t norm = 0;       // normalization mode folded into the table
+    int32_t dtype = 0;      // op::DataType of the transform input
+    int64_t rows = 0;       // output bins, i.e. onesided ? n / 2 + 1 : n
+    int64_t alignBytes = 0; // row padding of the table
+    uint64_t windowHash = 0;
+
+    bool operator==(const FftPlanKey& other) const
+    {
+        return kind == other.kind && length == other.length && norm == other.norm && dtype == other.dtype &&
+               rows == other.rows && alignBytes == other.alignBytes && windowHash == other.windowHash;
+    }
+};
+
+struct FftPlanKeyHash {
+    std::size_t operator()(const FftPlanKey& key) const
+    {
+        std::size_t seed = std::hash<int32_t>()(static_cast<int32_t>(key.kind));
+        auto combine = [&seed](std::size_t value) { seed ^= value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2); };
+        combine(std::hash<int64_t>()(key.length));
+        combine(std::hash<int64_t>()(key.norm));
+        combine(std::hash<int32_t>()(key.dtype));
+        combine(std::hash<int64_t>()(key.rows));
+        combine(std::hash<int64_t>()(key.alignBytes));
+        combine(std::hash<uint64_t>()(key.windowHash));
+        return seed;
+    }
+};
+
+struct FftPlan {
+    std::vector<float> table;      // device layout, copied as is into the host tensor
+    std::vector<uint32_t> factors; // radix factorization, empty for dense DFT plans
+    bool isBluestein = false;
+
+    int64_t Bytes() const
+    {
+        return static_cast<int64_t>(table.size() * sizeof(float) + factors.size() * sizeof(uint32_t));
+    }
+};
+
+using FftPlanPtr = std::shared_ptr<const FftPlan>;
+using FftPlanBuilder = std::function<FftPlanPtr()>;
+
+class FftPlanCache {
+public:
+    static FftPlanCache& GetInstance()
+    {
+        static FftPlanCache instance;
+        return instance;
+    }
+
+    FftPlanPtr Find(const FftPlanKey& key)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = cacheMap_.find(key);
+        if (it == cacheMap_.end()) {
+            return nullptr;
+        }
+        lruList_.splice(lruList_.begin(), lruList_, it->second.lruIt);
+        return it->second.plan;
+    }
+
+    // Return the cached plan of key, building it with builder on a miss. The build runs outside the lock, so two
+    // threads missing the same key may both build it; the first insert wins and both return that plan.
+    FftPlanPtr GetOrBuild(const FftPlanKey& key, const FftPlanBuilder& builder)
+    {
+        FftPlanPtr plan = Find(key);
+        if (plan != nullptr) {
+            return plan;
+        }
+        plan = builder();
+        if (plan == nullptr) {
+            return nullptr;
+        }
+        return Insert(key, plan);
+    }
+
+    // Insert plan unless key is already cached, returning the cached one.
+    FftPlanPtr Insert(const FftPlanKey& key, const FftPlanPtr& plan)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = cacheMap_.find(key);
+        if (it != cacheMap_.end()) {
+            lruList_.splice(lruList_.begin(), lruList_, it->second.lruIt);
+            return it->second.plan;
+        }
+        const int64_t bytes = plan->Bytes();
+        if (bytes > maxMemory_ / 2) {
+            return plan;
+        }
+        while (usedMemory_ + bytes > maxMemory_ && !lruList_.empty()) {
+            EvictOne();
+        }
+        lruList_.push_front(key);
+        cacheMap_[key] = {plan, lruList_.begin()};
+        usedMemory_ += bytes;
+        return plan;
+    }
+
+    // Drop every plan of kind. Plans still referenced by a caller stay alive until released.
+    void Clear(FftPlanKind kind)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto it = lruList_.begin(); it != lruList_.end();) {
+            if (it->kind != kind) {
+                ++it;
+                continue;
+            }
+            auto mapIt = cacheMap_.find(*it);
+            usedMemory_ -= mapIt->second.plan->Bytes();
+            cacheMap_.erase(mapIt);
+            it = lruList_.erase(it);
+        }
+    }
+
+    void SetMaxMemory(int64_t maxMemory)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        maxMemory_ = maxMemory;
+        while (usedMemory_ > maxMemory_ && !lruList_.empty()) {
+            EvictOne();
+        }
+    }
+
+    int64_t GetUsedMemory()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return usedMemory_;
+    }
+
+private:
+    FftPlanCache() = default;
+
+    void EvictOne()
+    {
+        auto it = cacheMap_.find(lruList_.back());
+        if (it != cacheMap_.end()) {
+            usedMemory_ -= it->second.plan->Bytes();
+            cacheMap_.erase(it);
+        }
+        lruList_.pop_back();
+    }
+
+    struct CacheMapValue {
+        FftPlanPtr plan;
+        std::list<FftPlanKey>::iterator lruIt;
+    };
+
+    std::mutex mutex_;
+    int64_t maxMemory_ = DEFAULT_FFT_PLAN_CACHE_MAX_MEMORY;
+    int64_t usedMemory_ = 0;
+    std::list<FftPlanKey> lruList_; // front = most recently used
+    std::unordered_map<FftPlanKey, CacheMapValue, FftPlanKeyHash> cacheMap_;
+};
+} // namespace op
+
+#endif // MATH_COMMON_FFT_PLAN_CACHE_H
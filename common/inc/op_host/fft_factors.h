@@ -0,0 +1,76 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file fft_factors.h
+ * \brief Radix factorization and Bluestein size of the Rfft1D mixed-radix plan.
+ *
+ * Shared by the Rfft1D tiling, the Rfft1D host twiddle tables and the FFT AICPU kernels (aicpu/fft_engine.h), so
+ * every FFT op picks the same Cooley-Tukey levels and the same Bluestein convolution length for a given n.
+ */
+
+#ifndef OPS_MATH_COMMON_OP_HOST_FFT_FACTORS_H
+#define OPS_MATH_COMMON_OP_HOST_FFT_FACTORS_H
+
+#include <cstdint>
+
+namespace Ops {
+namespace Math {
+static const uint32_t FFT_FACTORS_LEN = 3;
+static const uint32_t FFT_FIRST_FACTOR = 2;
+static const uint32_t FFT_LAST_FACTOR = 64;
+
+// Split n into FFT_FACTORS_LEN levels, largest radix in [FFT_FIRST_FACTOR, FFT_LAST_FACTOR] first, padded with 1.
+// 2 * 64^3 is the one length that needs a 128-point level. Returns false when the levels do not multiply to n.
+inline bool CalcFftFactors(uint32_t n, uint32_t factors[FFT_FACTORS_LEN])
+{
+    for (uint32_t i = 0; i < FFT_FACTORS_LEN; i++) {
+        factors[i] = 1;
+    }
+    if (n == FFT_LAST_FACTOR * FFT_LAST_FACTOR * FFT_LAST_FACTOR * FFT_FIRST_FACTOR) {
+        factors[0] = FFT_LAST_FACTOR * FFT_FIRST_FACTOR;
+        factors[1] = FFT_LAST_FACTOR;
+        factors[2] = FFT_LAST_FACTOR;
+        return true;
+    }
+    uint32_t rest = n;
+    uint32_t count = 0;
+    for (uint32_t radix = FFT_LAST_FACTOR; radix >= FFT_FIRST_FACTOR; radix--) {
+        while (rest % radix == 0) {
+            rest /= radix;
+            if (count < FFT_FACTORS_LEN) {
+                factors[count] = radix;
+            }
+            count++;
+        }
+    }
+    return rest == 1 && count <= FFT_FACTORS_LEN;
+}
+
+// The mixed-radix kernels need n to be a multiple of FFT_LAST_FACTOR and covered by the levels; every other length
+// goes through Bluestein.
+inline bool IsFftBluestein(uint32_t n, const uint32_t factors[FFT_FACTORS_LEN])
+{
+    return (n % FFT_LAST_FACTOR != 0) || (factors[0] * factors[1] * factors[2] != n);
+}
+
+// Bluestein convolution length: the smallest power of two of at least 2 * n points.
+inline uint32_t CalcFftBluesteinLength(uint32_t n)
+{
+    uint32_t pow2 = 1;
+    while (pow2 < n) {
+        pow2 <<= 1;
+    }
+    return FFT_FIRST_FACTOR * pow2;
+}
+} // namespace Math
+} // namespace Ops
+
+#endif // OPS_MATH_COMMON_OP_HOST_FFT_FACTORS_H
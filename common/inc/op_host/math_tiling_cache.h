@@ -0,0 +1,401 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file math_tiling_cache.h
+ * \brief Opt-in memoisation of template tiling results, keyed by the shape signature of the tiling context.
+ *
+ * A hit replays tiling data, tiling key, block dim, schedule mode and workspace sizes of the template that won the
+ * first call, skipping template construction and selection. Anything else a template writes into the context (local
+ * memory size, atomic flag, ...) is not replayed, so ops whose templates set such fields must not opt in.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "exe_graph/runtime/tiling_context.h"
+#include "tiling/platform/platform_ascendc.h"
+#include "log/log.h"
+
+namespace Ops {
+namespace Math {
+namespace OpTiling {
+
+// Appends op specific parts of the key: attrs and value-depend inputs. Returning false bypasses the cache for the
+// call, e.g. when a value-depend input is not const.
+using TilingCacheKeyFunc = bool (*)(gert::TilingContext*, std::string&);
+
+// Appends the compile info fields the templates read. Compile info structs are op specific, so the cache only sees
+// them through this func; the address of the struct is never part of the key.
+using TilingCacheCompileInfoFunc = void (*)(const void*, std::string&);
+
+template <typename T>
+inline void AppendTilingCacheKey(std::string& key, const T& value)
+{
+    key.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+// Compile info func for the common layout with coreNum and ubSize, e.g. BroadcastCompileInfo.
+template <typename CompileInfoT>
+inline void AppendTilingCacheCoreInfo(const void* compileInfo, std::string& key)
+{
+    auto info = static_cast<const CompileInfoT*>(compileInfo);
+    AppendTilingCacheKey(key, static_cast<int64_t>(info->coreNum));
+    AppendTilingCacheKey(key, static_cast<int64_t>(info->ubSize));
+}
+
+inline bool AppendTilingCacheAttrInt(gert::TilingContext* context, size_t index, std::string& key)
+{
+    auto attrs = context->GetAttrs();
+    const int64_t* value = (attrs == nullptr) ? nullptr : attrs->GetInt(index);
+    if (value == nullptr) {
+        return false;
+    }
+    AppendTilingCacheKey(key, *value);
+    return true;
+}
+
+inline bool AppendTilingCacheAttrBool(gert::TilingContext* context, size_t index, std::string& key)
+{
+    auto attrs = context->GetAttrs();
+    const bool* value = (attrs == nullptr) ? nullptr : attrs->GetBool(index);
+    if (value == nullptr) {
+        return false;
+    }
+    AppendTilingCacheKey(key, *value);
+    return true;
+}
+
+inline bool AppendTilingCacheAttrFloat(gert::TilingContext* context, size_t index, std::string& key)
+{
+    auto attrs = context->GetAttrs();
+    const float* value = (attrs == nullptr) ? nullptr : attrs->GetFloat(index);
+    if (value == nullptr) {
+        return false;
+    }
+    AppendTilingCacheKey(key, *value);
+    return true;
+}
+
+inline bool AppendTilingCacheAttrListInt(gert::TilingContext* context, size_t index, std::string& key)
+{
+    auto attrs = context->GetAttrs();
+    auto value = (attrs == nullptr) ? nullptr : attrs->GetListInt(index);
+    if (value == nullptr) {
+        return false;
+    }
+    AppendTilingCacheKey(key, value->GetSize());
+    key.append(reinterpret_cast<const char*>(value->GetData()), value->GetSize() * sizeof(int64_t));
+    return true;
+}
+
+// Value-depend input: the key takes its bytes, so only const (host resident) inputs can be cached.
+inline bool AppendTilingCacheConstInput(gert::TilingContext* context, size_t index, std::string& key)
+{
+    auto tensor = context->GetInputTensor(index);
+    if (tensor == nullptr || tensor->GetAddr() == nullptr) {
+        return false;
+    }
+    AppendTilingCacheKey(key, tensor->GetSize());
+    key.append(reinterpret_cast<const char*>(tensor->GetAddr()), tensor->GetSize());
+    return true;
+}
+
+class TilingCache {
+public:
+    TilingCache(size_t capacity, TilingCacheKeyFunc keyFunc, TilingCacheCompileInfoFunc compileInfoFunc = nullptr)
+        : capacity_(capacity), keyFunc_(keyFunc), compileInfoFunc_(compileInfoFunc)
+    {}
+
+    // Key: soc version, core num / ub size of the node, then shape, dtype and format of every input and output, then
+    // whatever the op's key func appends. Returns false when the core info is unavailable, bypassing the cache.
+    bool MakeKey(gert::TilingContext* context, int32_t socVersion, std::string& key) const
+    {
+        key.clear();
+        AppendTilingCacheKey(key, socVersion);
+        if (!AppendCoreInfoKey(context, key)) {
+            return false;
+        }
+        size_t inputNum = context->GetComputeNodeInputNum();
+        for (size_t i = 0; i < inputNum; i++) {
+            AppendTensorKey(context->GetInputShape(i), context->GetInputDesc(i), key);
+        }
+        size_t outputNum = context->GetComputeNodeOutputNum();
+        for (size_t i = 0; i < outputNum; i++) {
+            AppendTensorKey(context->GetOutputShape(i), context->GetOutputDesc(i), key);
+        }
+        return keyFunc_ == nullptr || keyFunc_(context, key);
+    }
+
+    // Replay a cached result into the context. Returns false on a miss.
+    bool Lookup(const std::string& key, gert::TilingContext* context)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = index_.find(key);
+        if (iter == index_.end()) {
+            misses_++;
+            return false;
+        }
+        const Entry& entry = iter->second->second;
+        auto rawTilingData = context->GetRawTilingData();
+        if (rawTilingData == nullptr || rawTilingData->GetCapacity() < entry.tilingData.size()) {
+            misses_++;
+            return false;
+        }
+        if (!entry.tilingData.empty()) {
+            std::memcpy(rawTilingData->GetData(), entry.tilingData.data(), entry.tilingData.size());
+        }
+        rawTilingData->SetDataSize(entry.tilingData.size());
+        context->SetTilingKey(entry.tilingKey);
+        context->SetBlockDim(entry.blockDim);
+        context->SetScheduleMode(entry.scheduleMode);
+        if (!entry.workspaceSizes.empty()) {
+            size_t* workspaces = context->GetWorkspaceSizes(entry.workspaceSizes.size());
+            if (workspaces == nullptr) {
+                misses_++;
+                return false;
+            }
+            std::copy(entry.workspaceSizes.begin(), entry.workspaceSizes.end(), workspaces);
+        }
+        lru_.splice(lru_.begin(), lru_, iter->second);
+        hits_++;
+        return true;
+    }
+
+    // Record the result of a successful template tiling.
+    void Store(const std::string& key, gert::TilingContext* context)
+    {
+        Entry entry;
+        auto rawTilingData = context->GetRawTilingData();
+        if (rawTilingData != nullptr && rawTilingData->GetDataSize() > 0) {
+            auto data = static_cast<const uint8_t*>(rawTilingData->GetData());
+            entry.tilingData.assign(data, data + rawTilingData->GetDataSize());
+        }
+        entry.tilingKey = context->GetTilingKey();
+        entry.blockDim = context->GetBlockDim();
+        entry.scheduleMode = context->GetScheduleMode();
+        size_t workspaceNum = context->GetWorkspaceNum();
+        if (workspaceNum > 0) {
+            const size_t* workspaces = context->GetWorkspaceSizes(workspaceNum);
+            if (workspaces == nullptr) {
+                return;
+            }
+            entry.workspaceSizes.assign(workspaces, workspaces + workspaceNum);
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (capacity_ == 0 || index_.find(key) != index_.end()) {
+            return;
+        }
+        if (lru_.size() >= capacity_) {
+            index_.erase(lru_.back().first);
+            lru_.pop_back();
+        }
+        lru_.emplace_front(key, std::move(entry));
+        index_[key] = lru_.begin();
+    }
+
+    void Clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        lru_.clear();
+        index_.clear();
+        hits_ = 0;
+        misses_ = 0;
+    }
+
+    uint64_t GetHitCount() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return hits_;
+    }
+
+    uint64_t GetMissCount() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return misses_;
+    }
+
+    size_t GetSize() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return lru_.size();
+    }
+
+private:
+    struct Entry {
+        std::vector<uint8_t> tilingData;
+        uint64_t tilingKey = 0;
+        uint32_t blockDim = 0;
+        uint32_t scheduleMode = 0;
+        std::vector<size_t> workspaceSizes;
+    };
+    using EntryList = std::list<std::pair<std::string, Entry>>;
+
+    // With a compile info func the fields come from the compile info, otherwise from the platform of the node.
+    bool AppendCoreInfoKey(gert::TilingContext* context, std::string& key) const
+    {
+        if (compileInfoFunc_ != nullptr) {
+            const void* compileInfo = context->GetCompileInfo();
+            if (compileInfo == nullptr) {
+                return false;
+            }
+            compileInfoFunc_(compileInfo, key);
+            return true;
+        }
+        fe::PlatFormInfos* platformInfo = context->GetPlatformInfo();
+        if (platformInfo == nullptr) {
+            return false;
+        }
+        auto ascendcPlatform = platform_ascendc::PlatformAscendC(platformInfo);
+        uint64_t ubSize = 0;
+        ascendcPlatform.GetCoreMemSize(platform_ascendc::CoreMemType::UB, ubSize);
+        AppendTilingCacheKey(key, static_cast<int64_t>(ascendcPlatform.GetCoreNum()));
+        AppendTilingCacheKey(key, static_cast<int64_t>(ubSize));
+        return true;
+    }
+
+    static void AppendTensorKey(
+        const gert::StorageShape* shape, const gert::CompileTimeTensorDesc* desc, std::string& key)
+    {
+        // Absent optional tensors still take a slot so that later tensors cannot alias them.
+        if (shape == nullptr || desc == nullptr) {
+            AppendTilingCacheKey(key, static_cast<int64_t>(-1));
+            return;
+        }
+        const gert::Shape& storageShape = shape->GetStorageShape();
+        AppendTilingCacheKey(key, static_cast<int64_t>(storageShape.GetDimNum()));
+        for (size_t i = 0; i < storageShape.GetDimNum(); i++) {
+            AppendTilingCacheKey(key, storageShape.GetDim(i));
+        }
+        const gert::Shape& originShape = shape->GetOriginShape();
+        AppendTilingCacheKey(key, static_cast<int64_t>(originShape.GetDimNum()));
+        for (size_t i = 0; i < originShape.GetDimNum(); i++) {
+            AppendTilingCacheKey(key, originShape.GetDim(i));
+        }
+        AppendTilingCacheKey(key, static_cast<int32_t>(desc->GetDataType()));
+        AppendTilingCacheKey(key, static_cast<int32_t>(desc->GetStorageFormat()));
+        AppendTilingCacheKey(key, static_cast<int32_t>(desc->GetOriginFormat()));
+    }
+
+    const size_t capacity_;
+    const TilingCacheKeyFunc keyFunc_;
+    const TilingCacheCompileInfoFunc compileInfoFunc_;
+    mutable std::mutex mutex_;
+    EntryList lru_;
+    std::unordered_map<std::string, EntryList::iterator> index_;
+    uint64_t hits_ = 0;
+    uint64_t misses_ = 0;
+};
+
+// Per op type caches. Ops opt in with REGISTER_TILING_CACHE, or at runtime through Enable.
+class TilingCacheRegistry {
+public:
+    static TilingCacheRegistry& GetInstance()
+    {
+        static TilingCacheRegistry registry_impl_;
+        return registry_impl_;
+    }
+
+    std::shared_ptr<TilingCache> Enable(const std::string& op_type, size_t capacity, TilingCacheKeyFunc keyFunc,
+                                        TilingCacheCompileInfoFunc compileInfoFunc = nullptr)
+    {
+        OP_CHECK_IF(capacity == 0, OP_LOGE(op_type, "Tiling cache capacity must be positive."), return nullptr);
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto cache = std::make_shared<TilingCache>(capacity, keyFunc, compileInfoFunc);
+        caches_[op_type] = cache;
+        return cache;
+    }
+
+    void Disable(const std::string& op_type)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        caches_.erase(op_type);
+    }
+
+    std::shared_ptr<TilingCache> Find(const char* op_type)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (caches_.empty() || op_type == nullptr) {
+            return nullptr;
+        }
+        auto iter = caches_.find(op_type);
+        return (iter == caches_.end()) ? nullptr : iter->second;
+    }
+
+private:
+    std::mutex mutex_;
+    std::map<std::string, std::shared_ptr<TilingCache>> caches_;
+};
+
+// Wraps one DoTilingImpl call: replays on a hit, otherwise lets the caller run template selection and stores the
+// result if it succeeds.
+class TilingCacheScope {
+public:
+    TilingCacheScope(gert::TilingContext* context, int32_t socVersion)
+        : context_(context), cache_(TilingCacheRegistry::GetInstance().Find(context->GetNodeType()))
+    {
+        if (cache_ != nullptr && !cache_->MakeKey(context_, socVersion, key_)) {
+            cache_ = nullptr;
+        }
+    }
+
+    bool Replay()
+    {
+        if (cache_ == nullptr || !cache_->Lookup(key_, context_)) {
+            return false;
+        }
+        OP_LOGD(context_, "Tiling cache hit.");
+        return true;
+    }
+
+    ge::graphStatus Record(ge::graphStatus status)
+    {
+        if (cache_ != nullptr && status == ge::GRAPH_SUCCESS) {
+            cache_->Store(key_, context_);
+        }
+        return status;
+    }
+
+private:
+    gert::TilingContext* context_;
+    std::shared_ptr<TilingCache> cache_;
+    std::string key_;
+};
+
+class TilingCacheRegister {
+public:
+    TilingCacheRegister(const std::string& op_type, size_t capacity, TilingCacheKeyFunc keyFunc = nullptr,
+                        TilingCacheCompileInfoFunc compileInfoFunc = nullptr)
+    {
+        TilingCacheRegistry::GetInstance().Enable(op_type, capacity, keyFunc, compileInfoFunc);
+    }
+};
+} // namespace OpTiling
+} // namespace Math
+} // namespace Ops
+
+// op_type: 算子名称， capacity: 缓存的shape签名个数上限(LRU淘汰)
+// key_func: 可选, 追加attr和值依赖输入到缓存key中; 有attr或值依赖输入的算子必须提供
+// compile_info_func: 可选, 将模板读取的compile info字段(如AppendTilingCacheCoreInfo<CompileInfo>)写入key;
+//                    不提供时从平台信息读取核数与UB大小
+#define REGISTER_TILING_CACHE(op_type, capacity, ...)                                  \
+    static Ops::Math::OpTiling::TilingCacheRegister __attribute__((unused))            \
+        tiling_cache_##op_type##_register =                                            \
+            Ops::Math::OpTiling::TilingCacheRegister(#op_type, capacity, ##__VA_ARGS__)
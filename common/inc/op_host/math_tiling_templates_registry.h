@@ -20,6 +20,7 @@
 #include <memory>
 #include "exe_graph/runtime/tiling_context.h"
 #include "op_host/tiling_base_class.h"
+#include "op_host/math_tiling_cache.h"
 #include "log/log.h"
 
 namespace Ops {
@@ -110,6 +111,10 @@ public:
                 return ge::GRAPH_FAILED;
             }
         }
+        TilingCacheScope cacheScope(context, soc_version);
+        if (cacheScope.Replay()) {
+            return ge::GRAPH_SUCCESS;
+        }
         auto tilingTemplateRegistryMap = GetTilingTemplates(op_type, soc_version);
         for (auto it = tilingTemplateRegistryMap.begin(); it != tilingTemplateRegistryMap.end(); ++it) {
             auto tilingTemplate = it->second(context);
@@ -117,7 +122,7 @@ public:
                 ge::graphStatus status = tilingTemplate->DoTiling();
                 if (status != ge::GRAPH_PARAM_INVALID) {
                     OP_LOGD(context, "Do general op tiling success priority=%d", it->first);
-                    return status;
+                    return cacheScope.Record(status);
                 }
                 OP_LOGD(context, "Ignore general op tiling priority=%d", it->first);
             }
@@ -240,6 +245,11 @@ public:
     ge::graphStatus DoTilingImpl(gert::TilingContext* context)
     {
         const char* op_type = context->GetNodeType();
+        // No soc version here: the core num / ub size in the cache key already tell platforms apart.
+        TilingCacheScope cacheScope(context, static_cast<int32_t>(-1));
+        if (cacheScope.Replay()) {
+            return ge::GRAPH_SUCCESS;
+        }
         auto tilingTemplateRegistryMap = GetTilingTemplates(op_type);
         for (auto it = tilingTemplateRegistryMap.begin(); it != tilingTemplateRegistryMap.end(); ++it) {
             auto tilingTemplate = it->second(context);
@@ -247,7 +257,7 @@ public:
                 ge::graphStatus status = tilingTemplate->DoTiling();
                 if (status != ge::GRAPH_PARAM_INVALID) {
                     OP_LOGD(context, "Do general op tiling success priority=%d", it->first);
-                    return status;
+                    return cacheScope.Record(status);
                 }
                 OP_LOGD(context, "Ignore general op tiling priority=%d", it->first);
             }
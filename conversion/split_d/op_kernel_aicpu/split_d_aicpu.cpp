@@ -9,6 +9,7 @@
  */
 #include "split_d_aicpu.h"
 #include "utils/kernel_util.h"
+#include "aicpu/split_copy_planner.h"
 
 namespace {
 const char *const kSplitD = "SplitD";
@@ -68,96 +69,14 @@ uint32_t SplitDCpuKernel::CheckAndInitParams(const CpuKernelContext &ctx) {
 }
 
 template <typename T>
-uint32_t SplitDCpuKernel::SplitDWithOneOutput(const T *input_data_ptr,
-                                              std::vector<T *> output_data_vec) {
-  int64_t copy_size = value_num_ * static_cast<int64_t>(sizeof(T));
-  auto mem_ret = BiggerMemCpy(output_data_vec[0], copy_size, input_data_ptr, copy_size);
-  KERNEL_CHECK_FALSE(mem_ret, KERNEL_STATUS_PARAM_INVALID, "Memcpy size[%ld] from input value to output[0] failed.",
-                     copy_size);
-  return KERNEL_STATUS_OK;
-}
-
-template <typename T>
-uint32_t SplitDCpuKernel::SplitDWithDimZero(T *input_data_ptr,
-                                            std::vector<T *> output_data_vec) {
-  int64_t copy_num = value_num_ / value_shape_vec_[0];
-  T *input_copy_ptr = input_data_ptr;
-  int64_t copy_size_per = size_splits_ * copy_num;
-  for (int64_t i = 0; i < num_split_; i++) {
-    int64_t copy_size = copy_size_per * static_cast<int64_t>(sizeof(T));
-    auto mem_ret = BiggerMemCpy(output_data_vec[i], copy_size, input_copy_ptr, copy_size);
-    KERNEL_CHECK_FALSE(mem_ret, KERNEL_STATUS_PARAM_INVALID, "Memcpy size[%ld] from input value to output[%ld] failed.",
-                       copy_size, i);
-    input_copy_ptr += copy_size_per;
-  }
-  return KERNEL_STATUS_OK;
-}
-
-template <typename T>
-uint32_t SplitDCpuKernel::SplitDCompute(T *input_data_ptr,
-                                        std::vector<T *> output_data_vec) {
-  // Calculate dimensions before and after split dimension
-  int64_t pre_dim_size = 1;
-  int32_t dim_idx = 0;
-  while (dim_idx < split_dim_) {
-    pre_dim_size *= value_shape_vec_[dim_idx];
-    dim_idx++;
-  }
-  const int64_t split_dim_size = value_shape_vec_[split_dim_];
-  int64_t post_dim_size = 1;
-  const int32_t total_dims = static_cast<int32_t>(value_shape_vec_.size());
-  dim_idx = split_dim_ + 1;
-  while (dim_idx < total_dims) {
-    post_dim_size *= value_shape_vec_[dim_idx];
-    dim_idx++;
-  }
-
-  const int64_t chunk_elements = post_dim_size * size_splits_;
-  const int64_t bytes_per_chunk = chunk_elements * static_cast<int64_t>(sizeof(T));
-  const int64_t stride_per_iter = post_dim_size * split_dim_size;
-  int64_t cur_offset = 0;
-
-  int64_t out_idx = 0;
-  while (out_idx < num_split_) {
-    T *cur_output = output_data_vec[out_idx];
-    T *cur_input = input_data_ptr + cur_offset;
-    int64_t iter_count = 0;
-    while (iter_count < pre_dim_size) {
-      auto mem_ret = BiggerMemCpy(cur_output, bytes_per_chunk, cur_input, bytes_per_chunk);
-      KERNEL_CHECK_FALSE(mem_ret, KERNEL_STATUS_PARAM_INVALID,
-                         "Memcpy size[%ld] from input value to output[%ld] failed.",
-                         bytes_per_chunk, out_idx);
-      cur_input += stride_per_iter;
-      cur_output += chunk_elements;
-      iter_count++;
-    }
-    cur_offset += chunk_elements;
-    out_idx++;
-  }
-  return KERNEL_STATUS_OK;
-}
-
-template <typename T>
-uint32_t SplitDCpuKernel::DoCompute() {
-  T *input_data_ptr = reinterpret_cast<T *>(value_data_ptr_);
-  std::vector<T *> output_data_vec;
-  output_data_vec.resize(static_cast<std::size_t>(num_split_));
+uint32_t SplitDCpuKernel::DoCompute(const CpuKernelContext &ctx) {
+  SplitCopyPlan plan;
+  InitSplitCopyPlan(value_data_ptr_, static_cast<int64_t>(sizeof(T)), value_shape_vec_, split_dim_, plan);
+  int64_t offset = 0;
   for (int64_t i = 0; i < num_split_; i++) {
-    output_data_vec[i] = reinterpret_cast<T *>(output_ptr_vec_[i]);
-  }
-
-  if (num_split_ == 1) {
-    KERNEL_CHECK_FALSE((SplitDWithOneOutput<T>(input_data_ptr, output_data_vec) == KERNEL_STATUS_OK),
-                       KERNEL_STATUS_PARAM_INVALID, "SplitDWithOneOutput failed.");
-    return KERNEL_STATUS_OK;
-  }
-  if (split_dim_ == 0) {
-    KERNEL_CHECK_FALSE((SplitDWithDimZero<T>(input_data_ptr, output_data_vec) == KERNEL_STATUS_OK),
-                       KERNEL_STATUS_PARAM_INVALID, "SplitDWithDimZero failed.");
-    return KERNEL_STATUS_OK;
+    AddSplitOutput(plan, output_ptr_vec_[i], size_splits_, offset);
   }
-  KERNEL_CHECK_FALSE((SplitDCompute<T>(input_data_ptr, output_data_vec) == KERNEL_STATUS_OK),
-                     KERNEL_STATUS_PARAM_INVALID,
+  KERNEL_CHECK_FALSE((RunSplitCopyPlan(ctx, plan) == KERNEL_STATUS_OK), KERNEL_STATUS_PARAM_INVALID,
                      "SplitD Compute failed.");
   return KERNEL_STATUS_OK;
 }
@@ -178,29 +97,29 @@ uint32_t SplitDCpuKernel::Compute(CpuKernelContext &ctx) {
                      KERNEL_STATUS_PARAM_INVALID, "CheckAndInitParams failed.");
   uint32_t ret = KERNEL_STATUS_OK;
   if (data_type_ == DT_FLOAT16) {
-    ret = DoCompute<Eigen::half>();
+    ret = DoCompute<Eigen::half>(ctx);
   } else if (data_type_ == DT_FLOAT) {
-    ret = DoCompute<float>();
+    ret = DoCompute<float>(ctx);
   } else if (data_type_ == DT_DOUBLE) {
-    ret = DoCompute<double>();
+    ret = DoCompute<double>(ctx);
   } else if (data_type_ == DT_BOOL) {
-    ret = DoCompute<bool>();
+    ret = DoCompute<bool>(ctx);
   } else if (data_type_ == DT_INT8) {
-    ret = DoCompute<int8_t>();
+    ret = DoCompute<int8_t>(ctx);
   } else if (data_type_ == DT_INT16) {
-    ret = DoCompute<int16_t>();
+    ret = DoCompute<int16_t>(ctx);
   } else if (data_type_ == DT_INT32) {
-    ret = DoCompute<int32_t>();
+    ret = DoCompute<int32_t>(ctx);
   } else if (data_type_ == DT_INT64) {
-    ret = DoCompute<int64_t>();
+    ret = DoCompute<int64_t>(ctx);
   } else if (data_type_ == DT_UINT8) {
-    ret = DoCompute<uint8_t>();
+    ret = DoCompute<uint8_t>(ctx);
   } else if (data_type_ == DT_UINT16) {
-    ret = DoCompute<uint16_t>();
+    ret = DoCompute<uint16_t>(ctx);
   } else if (data_type_ == DT_UINT32) {
-    ret = DoCompute<uint32_t>();
+    ret = DoCompute<uint32_t>(ctx);
   } else if (data_type_ == DT_UINT64) {
-    ret = DoCompute<uint64_t>();
+    ret = DoCompute<uint64_t>(ctx);
   } else {
     KERNEL_LOG_WARN("Unsupport datatype[%s]", DTypeStr(data_type_).c_str());
     ret = KERNEL_STATUS_PARAM_INVALID;
@@ -42,19 +42,7 @@ class SplitDCpuKernel : public CpuKernel {
   uint32_t CheckAndInitParams(const CpuKernelContext &ctx);
   
   template <typename T>
-  uint32_t SplitDWithOneOutput(const T *input_data_ptr,
-                               std::vector<T *> output_data_vec);
-
-  template <typename T>
-  uint32_t SplitDWithDimZero(T *input_data_ptr,
-                             std::vector<T *> output_data_vec);
-
-  template <typename T>
-  uint32_t SplitDCompute(T *input_data_ptr,
-                         std::vector<T *> output_data_vec);
-
-  template <typename T>
-  uint32_t DoCompute();
+  uint32_t DoCompute(const CpuKernelContext &ctx);
 
   DataType data_type_;
   int32_t split_dim_;
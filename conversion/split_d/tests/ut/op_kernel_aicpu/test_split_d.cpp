@@ -151,4 +151,34 @@ ADD_CASE_FAILED_1(split_num_not_equal_size_split_num, DT_INT32, int32_t, dim0, 4
 
 ADD_CASE_FAILED(split_num_not_equal_size_split_num, DT_INT16, int16_t, dim2, 2)
 
-ADD_CASE_FAILED(split_num_not_equal_size_split_num, DT_COMPLEX64, std::complex<float>, dim0, 1)
\ No newline at end of file
+ADD_CASE_FAILED(split_num_not_equal_size_split_num, DT_COMPLEX64, std::complex<float>, dim0, 1)
+
+// Split along the last axis of a tensor large enough to shard the (row, output) grid.
+TEST_F(TEST_SPLITD_UT, TestSplitD_LAST_AXIS_SHARDED) {
+  const int64_t rows = 8192;
+  const int64_t cols = 32;
+  const int64_t num_split = 4;
+  vector<float> input(rows * cols);
+  for (size_t i = 0; i < input.size(); i++) {
+    input[i] = static_cast<float>(i);
+  }
+  vector<vector<float>> outputs(num_split, vector<float>(rows * cols / num_split, 0));
+
+  auto node_def = CpuKernelUtils::CpuKernelUtils::CreateNodeDef();
+  NodeDefBuilder node(node_def.get(), "SplitD", "SplitD");
+  node.Input({"x", DT_FLOAT, {rows, cols}, input.data()})
+      .Attr("split_dim", -1)
+      .Attr("num_split", num_split);
+  for (int64_t i = 0; i < num_split; i++) {
+    node.Output({"y", DT_FLOAT, {rows, cols / num_split}, outputs[i].data()});
+  }
+  RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+  bool same = true;
+  const int64_t width = cols / num_split;
+  for (int64_t r = 0; r < rows; r++) {
+    for (int64_t c = 0; c < cols; c++) {
+      same = same && (outputs[c / width][r * width + c % width] == input[r * cols + c]);
+    }
+  }
+  EXPECT_TRUE(same);
+}
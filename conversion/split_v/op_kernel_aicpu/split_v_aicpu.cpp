@@ -14,6 +14,7 @@
  */
 #include "split_v_aicpu.h"
 #include "utils/kernel_util.h"
+#include "aicpu/split_copy_planner.h"
 
 namespace {
 const char *const kSplitV = "SplitV";
@@ -157,89 +158,14 @@ uint32_t SplitVCpuKernel::GetSizeSplits(void *size_splits_data_ptr, int64_t real
 }
 
 template <typename T>
-uint32_t SplitVCpuKernel::SplitVWithOneOutput(const T *input_data_ptr,
-                                              std::vector<T *> output_data_vec) {
-  int64_t copy_size = value_num_ * static_cast<int64_t>(sizeof(T));
-  auto mem_ret = BiggerMemCpy(output_data_vec[0], copy_size, input_data_ptr, copy_size);
-  KERNEL_CHECK_FALSE(mem_ret, KERNEL_STATUS_PARAM_INVALID, "Memcpy size[%ld] from input value to output[0] failed.",
-                     copy_size);
-  return KERNEL_STATUS_OK;
-}
-
-template <typename T>
-uint32_t SplitVCpuKernel::SplitVWithDimZero(T *input_data_ptr,
-                                            std::vector<T *> output_data_vec) {
-  int64_t copy_num = value_num_ / value_shape_vec_[0];
-  T *input_copy_ptr = input_data_ptr;
-  for (int64_t i = 0; i < num_split_; i++) {
-    if (size_splits_[i] == 0L) {
-      continue;
-    }
-    int64_t copy_size_per = size_splits_[i] * copy_num;
-    int64_t copy_size = copy_size_per * static_cast<int64_t>(sizeof(T));
-    auto mem_ret = BiggerMemCpy(output_data_vec[i], copy_size, input_copy_ptr, copy_size);
-    KERNEL_CHECK_FALSE(mem_ret, KERNEL_STATUS_PARAM_INVALID, "Memcpy size[%ld] from input value to output[%ld] failed.",
-                       copy_size, i);
-    input_copy_ptr += copy_size_per;
-  }
-  return KERNEL_STATUS_OK;
-}
-
-template <typename T>
-uint32_t SplitVCpuKernel::SplitVCompute(T *input_data_ptr,
-                                        std::vector<T *> output_data_vec) {
-  int64_t prefix = 1;
-  for (int32_t i = 0; i < split_dim_; i++) {
-    prefix *= value_shape_vec_[i];
-  }
-  int64_t midfix = value_shape_vec_[split_dim_];
-  int64_t subfix = 1;
-  int32_t value_shape_vec_size = static_cast<int32_t>(value_shape_vec_.size());
-  for (int32_t i = split_dim_ + 1; i < value_shape_vec_size; i++) {
-    subfix *= value_shape_vec_[i];
-  }
+uint32_t SplitVCpuKernel::DoCompute(const CpuKernelContext &ctx) {
+  SplitCopyPlan plan;
+  InitSplitCopyPlan(value_data_ptr_, static_cast<int64_t>(sizeof(T)), value_shape_vec_, split_dim_, plan);
   int64_t offset = 0;
   for (int64_t i = 0; i < num_split_; i++) {
-    if (size_splits_[i] == 0L) {
-      continue;
-    }
-    T *output_data_ptr = output_data_vec[i];
-    T *input_copy_ptr = input_data_ptr + offset;
-    int64_t copy_num = subfix * size_splits_[i];
-    int64_t copy_size = copy_num * static_cast<int64_t>(sizeof(T));
-    for (int64_t j = 0; j < prefix; j++) {
-      auto mem_ret = BiggerMemCpy(output_data_ptr, copy_size, input_copy_ptr, copy_size);
-      KERNEL_CHECK_FALSE(mem_ret, KERNEL_STATUS_PARAM_INVALID, "Memcpy size[%ld] from input value to output[%ld] failed.",
-                         copy_size, i);
-      input_copy_ptr += (subfix * midfix);
-      output_data_ptr += copy_num;
-    }
-    offset += copy_num;
-  }
-  return KERNEL_STATUS_OK;
-}
-
-template <typename T>
-uint32_t SplitVCpuKernel::DoCompute() {
-  T *input_data_ptr = reinterpret_cast<T *>(value_data_ptr_);
-  std::vector<T *> output_data_vec;
-  output_data_vec.resize(static_cast<std::size_t>(num_split_));
-  for (int64_t i = 0; i < num_split_; i++) {
-    output_data_vec[i] = reinterpret_cast<T *>(output_ptr_vec_[i]);
+    AddSplitOutput(plan, output_ptr_vec_[i], size_splits_[i], offset);
   }
-
-  if (num_split_ == 1) {
-    KERNEL_CHECK_FALSE((SplitVWithOneOutput<T>(input_data_ptr, output_data_vec) == KERNEL_STATUS_OK),
-                       KERNEL_STATUS_PARAM_INVALID, "SplitVWithOneOutput failed.");
-    return KERNEL_STATUS_OK;
-  }
-  if (split_dim_ == 0) {
-    KERNEL_CHECK_FALSE((SplitVWithDimZero<T>(input_data_ptr, output_data_vec) == KERNEL_STATUS_OK),
-                       KERNEL_STATUS_PARAM_INVALID, "SplitVWithDimZero failed.");
-    return KERNEL_STATUS_OK;
-  }
-  KERNEL_CHECK_FALSE((SplitVCompute<T>(input_data_ptr, output_data_vec) == KERNEL_STATUS_OK),
-                     KERNEL_STATUS_PARAM_INVALID,
+  KERNEL_CHECK_FALSE((RunSplitCopyPlan(ctx, plan) == KERNEL_STATUS_OK), KERNEL_STATUS_PARAM_INVALID,
                      "SplitV Compute failed.");
   return KERNEL_STATUS_OK;
 }
@@ -257,29 +183,29 @@ uint32_t SplitVCpuKernel::Compute(CpuKernelContext &ctx) {
                      KERNEL_STATUS_PARAM_INVALID, "CheckAndInitParams failed.");
   switch (data_type_) {
     case DT_FLOAT16:
-      return DoCompute<Eigen::half>();
+      return DoCompute<Eigen::half>(ctx);
     case DT_FLOAT:
-      return DoCompute<float>();
+      return DoCompute<float>(ctx);
     case DT_DOUBLE:
-      return DoCompute<double>();
+      return DoCompute<double>(ctx);
     case DT_BOOL:
-      return DoCompute<bool>();
+      return DoCompute<bool>(ctx);
     case DT_INT8:
-      return DoCompute<int8_t>();
+      return DoCompute<int8_t>(ctx);
     case DT_INT16:
-      return DoCompute<int16_t>();
+      return DoCompute<int16_t>(ctx);
     case DT_INT32:
-      return DoCompute<int32_t>();
+      return DoCompute<int32_t>(ctx);
     case DT_INT64:
-      return DoCompute<int64_t>();
+      return DoCompute<int64_t>(ctx);
     case DT_UINT8:
-      return DoCompute<uint8_t>();
+      return DoCompute<uint8_t>(ctx);
     case DT_UINT16:
-      return DoCompute<uint16_t>();
+      return DoCompute<uint16_t>(ctx);
     case DT_UINT32:
-      return DoCompute<uint32_t>();
+      return DoCompute<uint32_t>(ctx);
     case DT_UINT64:
-      return DoCompute<uint64_t>();
+      return DoCompute<uint64_t>(ctx);
     default:
       KERNEL_LOG_ERROR("Unsupport datatype[%s]", DTypeStr(data_type_).c_str());
       return KERNEL_STATUS_PARAM_INVALID;
@@ -98,37 +98,12 @@ class SplitVCpuKernel : public CpuKernel {
   uint32_t GetSizeSplits(void *size_splits_data_ptr, int64_t real_dim);
 
   /**
-   * @brief split data when split num is 1
-   * @param input_data_ptr ptr which store input data
-   * @param output_data_vec vector which store all output data ptr
-   * @return status if success
-   */
-  template <typename T>
-  uint32_t SplitVWithOneOutput(const T *input_data_ptr,
-                               std::vector<T *> output_data_vec);
-
-  /**
-   * @brief split data when split dim is 0
-   * @param input_data_ptr ptr which store input data
-   * @param output_data_vec vector which store all output data ptr
-   * @return status if success
-   */
-  template <typename T>
-  uint32_t SplitVWithDimZero(T *input_data_ptr,
-                             std::vector<T *> output_data_vec);
-
-  /**
-   * @brief split data
-   * @param input_data_ptr ptr which store input data
-   * @param output_data_vec vector which store all output data ptr
+   * @brief copy every split out of value through the shared split copy planner
+   * @param ctx cpu kernel context
    * @return status if success
    */
   template <typename T>
-  uint32_t SplitVCompute(T *input_data_ptr,
-                         std::vector<T *> output_data_vec);
-
-  template <typename T>
-  uint32_t DoCompute();
+  uint32_t DoCompute(const CpuKernelContext &ctx);
 
   DataType data_type_;
   int32_t split_dim_;
@@ -176,4 +176,36 @@ TEST_F(TEST_SPLITV_UT, TestSplitV_EMPTY_CASE2) {
       .Output({"y1", DT_DOUBLE, out1_shape, output1})
       .Output({"y2", DT_DOUBLE, out2_shape, output2});
   RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
-}
\ No newline at end of file
+}
+// Large enough to shard: int8 rows of 3 / 0 / 125 bytes exercise the typed-store path, misaligned addresses included.
+TEST_F(TEST_SPLITV_UT, TestSplitV_UNEVEN_SPLITS_SHARDED) {
+  const int64_t rows = 4096;
+  const int64_t cols = 128;
+  vector<int8_t> input(rows * cols);
+  for (size_t i = 0; i < input.size(); i++) {
+    input[i] = static_cast<int8_t>(i * 7);
+  }
+  int64_t size_split[3] = {3, 0, -1};
+  vector<int8_t> output1(rows * 3, 0);
+  vector<int8_t> output3(rows * (cols - 3), 0);
+  int32_t split_dim = 1;
+
+  auto node_def = CpuKernelUtils::CpuKernelUtils::CreateNodeDef();
+  NodeDefBuilder node(node_def.get(), "SplitV", "SplitV");
+  node.Input({"x", DT_INT8, {rows, cols}, input.data()})
+      .Input({"size_splits", DT_INT64, {3}, size_split})
+      .Input({"split_dim", DT_INT32, {}, &split_dim})
+      .Attr("num_split", 3)
+      .Output({"y1", DT_INT8, {rows, 3}, output1.data()})
+      .Output({"y2", DT_INT8, {rows, 0}, nullptr})
+      .Output({"y3", DT_INT8, {rows, cols - 3}, output3.data()});
+  RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+  bool same = true;
+  for (int64_t r = 0; r < rows; r++) {
+    for (int64_t c = 0; c < cols; c++) {
+      int8_t got = (c < 3) ? output1[r * 3 + c] : output3[r * (cols - 3) + c - 3];
+      same = same && (got == input[r * cols + c]);
+    }
+  }
+  EXPECT_TRUE(same);
+}
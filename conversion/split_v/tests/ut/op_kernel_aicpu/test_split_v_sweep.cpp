@@ -0,0 +1,96 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <numeric>
+
+#include "gtest/gtest.h"
+#ifndef private
+#define private public
+#define protected public
+#endif
+#include "utils/aicpu_test_utils.h"
+#include "cpu_kernel_utils.h"
+#include "node_def_builder.h"
+#undef private
+#undef protected
+
+using namespace std;
+using namespace aicpu;
+
+// Sweep of SplitV over every split axis and several split counts of one fp32 tensor. Each run is checked against a
+// reference split, so the sweep also covers the merged, grid and typed-store paths of the split copy planner.
+class TEST_SPLITV_SWEEP_UT : public testing::Test {};
+
+namespace {
+uint32_t RunSplitV(const vector<int64_t>& shape, int32_t split_dim, const vector<int64_t>& sizes,
+                   vector<float>& input, vector<vector<float>>& outputs)
+{
+    auto node_def = CpuKernelUtils::CreateNodeDef();
+    NodeDefBuilder node(node_def.get(), "SplitV", "SplitV");
+    vector<int64_t> size_splits(sizes);
+    node.Input({"x", DT_FLOAT, shape, input.data()})
+        .Input({"size_splits", DT_INT64, {static_cast<int64_t>(sizes.size())}, size_splits.data()})
+        .Input({"split_dim", DT_INT32, {}, &split_dim})
+        .Attr("num_split", static_cast<int64_t>(sizes.size()));
+    for (size_t i = 0; i < sizes.size(); i++) {
+        vector<int64_t> out_shape(shape);
+        out_shape[split_dim] = sizes[i];
+        node.Output({"y", DT_FLOAT, out_shape, outputs[i].data()});
+    }
+    CpuKernelContext ctx(HOST);
+    if (ctx.Init(node_def.get()) != KERNEL_STATUS_OK) {
+        return KERNEL_STATUS_PARAM_INVALID;
+    }
+    return CpuKernelRegister::Instance().RunCpuKernel(ctx);
+}
+
+bool CheckSplit(const vector<int64_t>& shape, int32_t split_dim, const vector<int64_t>& sizes,
+                const vector<float>& input, const vector<vector<float>>& outputs)
+{
+    int64_t prefix = 1;
+    int64_t inner = 1;
+    for (int32_t i = 0; i < split_dim; i++) {
+        prefix *= shape[i];
+    }
+    for (size_t i = split_dim + 1; i < shape.size(); i++) {
+        inner *= shape[i];
+    }
+    int64_t offset = 0;
+    for (size_t s = 0; s < sizes.size(); s++) {
+        const int64_t run = sizes[s] * inner;
+        for (int64_t p = 0; p < prefix; p++) {
+            for (int64_t k = 0; k < run; k++) {
+                if (outputs[s][p * run + k] != input[(p * shape[split_dim] + offset) * inner + k]) {
+                    return false;
+                }
+            }
+        }
+        offset += sizes[s];
+    }
+    return true;
+}
+} // namespace
+
+TEST_F(TEST_SPLITV_SWEEP_UT, split_axis_and_count_sweep)
+{
+    const vector<int64_t> shape = {16, 32, 64, 64};
+    const int64_t total = accumulate(shape.begin(), shape.end(), int64_t{1}, multiplies<int64_t>());
+    vector<float> input(total);
+    for (int64_t i = 0; i < total; i++) {
+        input[i] = static_cast<float>(i);
+    }
+    for (int32_t axis = 0; axis < static_cast<int32_t>(shape.size()); axis++) {
+        for (int64_t count : {2, 8, 16}) {
+            vector<int64_t> sizes(count, shape[axis] / count);
+            vector<vector<float>> outputs(count, vector<float>(total / count));
+            ASSERT_EQ(RunSplitV(shape, axis, sizes, input, outputs), KERNEL_STATUS_OK);
+            ASSERT_TRUE(CheckSplit(shape, axis, sizes, input, outputs)) << "axis " << axis << " count " << count;
+        }
+    }
+}
@@ -9,6 +9,8 @@
  */
 #include "format_transfer_c1hwc0.h"
 
+#include <algorithm>
+
 #include "format_transfer_utils.h"
 #include "formats_definitions.h"
 #include "kernel_util.h"
@@ -103,40 +105,47 @@ struct C1hwc0StrideParams {
     int64_t data_size;
 };
 
-inline void CopyHwcnColumn(const TransArgs& args, const C1hwc0StrideParams& p, int64_t c1i, int64_t hi, int64_t wi)
+// Number of valid c0 lanes in block c1i; the tail block is padded with zeros.
+inline int64_t C1hwc0Lanes(const C1hwc0StrideParams& p, int64_t c1i)
 {
-    for (int64_t c0i = 0; c0i < p.c0; c0i++) {
-        if (((c1i * p.c0) + c0i) >= p.n_dim) {
-            break;
-        }
-        const int64_t idx_c1hwc0 = (c1i * p.hWC0) + (hi * p.wC0) + (wi * p.c0) + c0i;
-        const int64_t idx_4d = hi * p.w_dim * p.n_dim + wi * p.n_dim + (c1i * p.c0) + c0i;
-        copy_data(args.data, args.output, idx_4d, idx_c1hwc0, p.data_size);
-    }
+    return std::min(p.c0, p.n_dim - c1i * p.c0);
 }
 
-inline void CopyNchwColumn(const TransArgs& args, const C1hwc0StrideParams& p, int64_t c1i, int64_t hi, int64_t wi)
+// HWCN keeps n innermost, so a c0 block is contiguous on both sides.
+inline uint32_t CopyHwcnColumn(const TransArgs& args, const C1hwc0StrideParams& p, int64_t c1i, int64_t hi, int64_t wi)
 {
-    for (int64_t c0i = 0; c0i < p.c0; c0i++) {
-        if (((c1i * p.c0) + c0i) >= p.n_dim) {
-            break;
-        }
-        const int64_t idx_c1hwc0 = (c1i * p.hWC0) + (hi * p.wC0) + (wi * p.c0) + c0i;
-        const int64_t idx_4d = ((c1i * p.c0) + c0i) * p.hW + hi * p.w_dim + wi;
-        copy_data(args.data, args.output, idx_4d, idx_c1hwc0, p.data_size);
-    }
+    const int64_t idx_c1hwc0 = (c1i * p.hWC0) + (hi * p.wC0) + (wi * p.c0);
+    const int64_t idx_4d = hi * p.w_dim * p.n_dim + wi * p.n_dim + (c1i * p.c0);
+    return CopyStridedRun(args.data + idx_4d * p.data_size, 1, args.output + idx_c1hwc0 * p.data_size, 1,
+                          C1hwc0Lanes(p, c1i), p.data_size);
+}
+
+// NCHW places consecutive n hW elements apart.
+inline uint32_t CopyNchwColumn(const TransArgs& args, const C1hwc0StrideParams& p, int64_t c1i, int64_t hi, int64_t wi)
+{
+    const int64_t idx_c1hwc0 = (c1i * p.hWC0) + (hi * p.wC0) + (wi * p.c0);
+    const int64_t idx_4d = (c1i * p.c0) * p.hW + hi * p.w_dim + wi;
+    return CopyStridedRun(args.data + idx_4d * p.data_size, p.hW, args.output + idx_c1hwc0 * p.data_size, 1,
+                          C1hwc0Lanes(p, c1i), p.data_size);
 }
 
+// Runs column_fn over every (c1, h, w); one unit per (c1, h) row.
 template <typename ColumnFn>
-void IterateC1hwc0(const TransArgs& args, const C1hwc0StrideParams& p, ColumnFn column_fn)
+uint32_t IterateC1hwc0(const TransArgs& args, const C1hwc0StrideParams& p, int64_t dst_size, ColumnFn column_fn)
 {
-    for (int64_t c1i = 0; c1i < p.c1; c1i++) {
-        for (int64_t hi = 0; hi < p.h; hi++) {
+    return RunTiledFormatTransfer(args, dst_size, true, p.c1 * p.h, [&](int64_t start, int64_t end) -> uint32_t {
+        for (int64_t unit = start; unit < end; unit++) {
+            const int64_t c1i = unit / p.h;
+            const int64_t hi = unit % p.h;
             for (int64_t wi = 0; wi < p.w; wi++) {
-                column_fn(args, p, c1i, hi, wi);
+                const uint32_t ret = column_fn(args, p, c1i, hi, wi);
+                if (ret != KERNEL_STATUS_OK) {
+                    return ret;
+                }
             }
         }
-    }
+        return KERNEL_STATUS_OK;
+    });
 }
 
 uint32_t TransFormatToC1hwc0(const Format& format_4d, const std::vector<int64_t>& shape_4d, const TransArgs& args)
@@ -148,21 +157,17 @@ uint32_t TransFormatToC1hwc0(const Format& format_4d, const std::vector<int64_t>
     if (b.dst_size == 0) {
         return KERNEL_STATUS_OK;
     }
-    BiggerMemSet(args.output, static_cast<size_t>(b.dst_size), 0, static_cast<size_t>(b.dst_size));
 
     const C1hwc0StrideParams p{
         b.c0,           Ceil(b.n_dim, b.c0),      b.n_dim,    b.h_dim, b.w_dim, b.w_dim, b.h_dim * b.w_dim,
         b.w_dim * b.c0, b.h_dim * b.w_dim * b.c0, b.data_size};
     if (format_4d == FORMAT_HWCN) {
-        IterateC1hwc0(args, p, CopyHwcnColumn);
+        return IterateC1hwc0(args, p, b.dst_size, CopyHwcnColumn);
     } else if (format_4d == FORMAT_NCHW) {
-        IterateC1hwc0(args, p, CopyNchwColumn);
-    } else {
-        KERNEL_LOG_ERROR("format should be NCHW or HWCN, but got [%s]", FormatToSerialString(format_4d).c_str());
-        return KERNEL_STATUS_PARAM_INVALID;
+        return IterateC1hwc0(args, p, b.dst_size, CopyNchwColumn);
     }
-
-    return KERNEL_STATUS_OK;
+    KERNEL_LOG_ERROR("format should be NCHW or HWCN, but got [%s]", FormatToSerialString(format_4d).c_str());
+    return KERNEL_STATUS_PARAM_INVALID;
 }
 } // namespace
 
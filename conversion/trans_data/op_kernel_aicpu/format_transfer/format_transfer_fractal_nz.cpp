@@ -10,14 +10,11 @@
 #include "format_transfer_fractal_nz.h"
 
 #include "format_transfer_utils.h"
-#include "cpu_kernel_utils.h"
 #include "kernel_util.h"
 #include "log.h"
 #include "securec.h"
 #include "status.h"
 
-#include <atomic>
-
 using namespace std;
 
 namespace aicpu {
@@ -36,7 +33,6 @@ const size_t kFNzDimCountBackwardsW0 = 1;
 const size_t kFNzDimCountBackwardsW0H0 = 2;
 const size_t kFNzDimCountBackwardsW0H0H1 = 3;
 const size_t kFNzDimCountBackwardsW0H0H1W1 = 4;
-const int64_t kParallelDataSize = 128 * 1024;
 const size_t kNumTwo = 2;
 
 bool IsDataTypeSupport(DataType data_type) { return GetSizeByDataType(data_type) > 0; }
@@ -216,29 +212,24 @@ uint32_t CopyNdToFracNzTail(const TransArgs& args, const NdFracNzParams& p, int6
     return KERNEL_STATUS_OK;
 }
 
-void CopyNdToFracNzRange(const TransArgs& args, const NdFracNzParams& p, int64_t start, int64_t end,
-                         std::atomic<bool>& failed)
+// One unit per (times, h) row; rows of different units never share output.
+uint32_t CopyNdToFracNzRange(const TransArgs& args, const NdFracNzParams& p, int64_t h, int64_t start, int64_t end)
 {
-    // 针对h轴开启多核并行
-    for (int64_t h1h0_idx = start; h1h0_idx < end; h1h0_idx++) {
-        if (failed.load(std::memory_order_relaxed)) {
-            return;
+    for (int64_t unit = start; unit < end; unit++) {
+        const int64_t times_idx = unit / h;
+        const int64_t h1h0_idx = unit % h;
+        const int64_t h1h0_head = times_idx * p.w1h1h0w0 + h1h0_idx * p.w0;
+        const int64_t src_h_head = times_idx * p.hw + h1h0_idx * p.w;
+        uint32_t ret = CopyNdToFracNzBlock(args, p, h1h0_head, src_h_head);
+        if (ret != KERNEL_STATUS_OK) {
+            return ret;
         }
-        const int64_t h1h0_offset = h1h0_idx * p.w0;
-        const int64_t src_h_offset = h1h0_idx * p.w;
-        for (int64_t times_idx = 0; times_idx < p.times; times_idx++) {
-            const int64_t h1h0_head = h1h0_offset + times_idx * p.w1h1h0w0;
-            const int64_t src_h_head = src_h_offset + times_idx * p.hw;
-            if (CopyNdToFracNzBlock(args, p, h1h0_head, src_h_head) != KERNEL_STATUS_OK) {
-                failed.store(true, std::memory_order_relaxed);
-                return;
-            }
-            if (CopyNdToFracNzTail(args, p, h1h0_head, src_h_head) != KERNEL_STATUS_OK) {
-                failed.store(true, std::memory_order_relaxed);
-                return;
-            }
+        ret = CopyNdToFracNzTail(args, p, h1h0_head, src_h_head);
+        if (ret != KERNEL_STATUS_OK) {
+            return ret;
         }
     }
+    return KERNEL_STATUS_OK;
 }
 
 uint32_t TransFormatFromNdToFracNz(const TransArgs& args, const ShapeVector& hw_shape)
@@ -267,25 +258,11 @@ uint32_t TransFormatFromNdToFracNz(const TransArgs& args, const ShapeVector& hw_
     p.w1h1h0w0 = w1 * p.h1h0w0;
     // w0 not equal 0
     p.num_w1 = p.w / p.w0;
-    (void)memset_s(args.output, static_cast<size_t>(p.dst_size), 0, static_cast<size_t>(p.dst_size));
-    std::atomic<bool> sharder_failed{false};
-    auto sharder = [&args, &p, &sharder_failed](int64_t start, int64_t end) {
-        CopyNdToFracNzRange(args, p, start, end, sharder_failed);
+    // The h1h0 padding rows are never written by the copy, so the output is zero-filled first.
+    auto copy_rows = [&args, &p, h](int64_t start, int64_t end) {
+        return CopyNdToFracNzRange(args, p, h, start, end);
     };
-
-    const int64_t parallel_core_number = GetMaxCompilerCoreNum();
-    if (parallel_core_number > 1 && dst_element_shape >= kParallelDataSize) {
-        KERNEL_LOG_DEBUG("parallel_core_number is [%ld]", parallel_core_number);
-        KERNEL_HANDLE_ERROR(aicpu::CpuKernelUtils::ParallelFor(*(args.ctx), h, 1, sharder),
-                            "TransData ParallelFor Compute failed.")
-    } else {
-        sharder(0, h);
-    }
-    if (sharder_failed.load(std::memory_order_relaxed)) {
-        KERNEL_LOG_ERROR("Failed to copy ND to FRACTAL_NZ in sharder.");
-        return KERNEL_STATUS_INNER_ERROR;
-    }
-    return KERNEL_STATUS_OK;
+    return RunTiledFormatTransfer(args, p.dst_size, true, p.times * h, copy_rows);
 }
 
 uint32_t CopyFracNzToNdBlock(const TransArgs& args, const NdFracNzParams& p, int64_t h1h0_head, int64_t dst_h_head)
@@ -330,6 +307,26 @@ uint32_t CopyFracNzToNdTail(const TransArgs& args, const NdFracNzParams& p, int6
     return KERNEL_STATUS_OK;
 }
 
+// One unit per (times, h) row of the ND output.
+uint32_t CopyFracNzToNdRange(const TransArgs& args, const NdFracNzParams& p, int64_t h, int64_t start, int64_t end)
+{
+    for (int64_t unit = start; unit < end; unit++) {
+        const int64_t times_idx = unit / h;
+        const int64_t h1h0_idx = unit % h;
+        const int64_t h1h0_head = times_idx * p.w1h1h0w0 + h1h0_idx * p.w0;
+        const int64_t dst_h_head = times_idx * p.hw + h1h0_idx * p.w;
+        uint32_t ret = CopyFracNzToNdBlock(args, p, h1h0_head, dst_h_head);
+        if (ret != KERNEL_STATUS_OK) {
+            return ret;
+        }
+        ret = CopyFracNzToNdTail(args, p, h1h0_head, dst_h_head);
+        if (ret != KERNEL_STATUS_OK) {
+            return ret;
+        }
+    }
+    return KERNEL_STATUS_OK;
+}
+
 uint32_t TransFormatFromFracNzToNd(const TransArgs& args, const ShapeVector& dst_hw_shape)
 {
     NdFracNzParams p;
@@ -354,23 +351,11 @@ uint32_t TransFormatFromFracNzToNd(const TransArgs& args, const ShapeVector& dst
     p.w1h1h0w0 = w1 * p.h1h0w0;
     p.num_w1 = p.w / p.w0;
 
-    for (int64_t times_idx = 0; times_idx < p.times; times_idx++) {
-        const int64_t times_head = times_idx * p.w1h1h0w0;
-        const int64_t dst_times_head = times_idx * p.hw;
-        for (int64_t h1h0_idx = 0; h1h0_idx < h; h1h0_idx++) {
-            const int64_t h1h0_head = times_head + h1h0_idx * p.w0;
-            const int64_t dst_h_head = dst_times_head + h1h0_idx * p.w;
-            uint32_t ret = CopyFracNzToNdBlock(args, p, h1h0_head, dst_h_head);
-            if (ret != KERNEL_STATUS_OK) {
-                return ret;
-            }
-            ret = CopyFracNzToNdTail(args, p, h1h0_head, dst_h_head);
-            if (ret != KERNEL_STATUS_OK) {
-                return ret;
-            }
-        }
-    }
-    return KERNEL_STATUS_OK;
+    // Every ND element is written exactly once, so no zero fill is needed.
+    auto copy_rows = [&args, &p, h](int64_t start, int64_t end) {
+        return CopyFracNzToNdRange(args, p, h, start, end);
+    };
+    return RunTiledFormatTransfer(args, p.dst_size, false, p.times * h, copy_rows);
 }
 
 uint32_t ValidateFractalNzArgs(const TransArgs& args, bool check_dst_format)
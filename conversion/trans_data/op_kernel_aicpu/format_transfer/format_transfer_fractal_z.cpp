@@ -258,37 +258,44 @@ inline int64_t Compute4dIndexForFractalZ(const Format& format_4d, const FractalZ
     return 0;
 }
 
-inline void CopyFractalZCoutColumn(const TransArgs& args, const Format& format_4d, const FractalZTransCtx& ctx,
-                                   int64_t g, int64_t d, int64_t c, int64_t h, int64_t w, bool reverse)
+// Copies the cout_ori elements of one (g, d, c, h, w) column. Along n the fz index advances by cube_k and the 4D
+// index by a fixed stride, so the whole column is a single strided run.
+inline uint32_t CopyFractalZCoutColumn(const TransArgs& args, const Format& format_4d, const FractalZTransCtx& ctx,
+                                       int64_t g, int64_t d, int64_t c, int64_t h, int64_t w, bool reverse)
 {
-    for (int64_t n = 0; n < ctx.cout_ori; n++) {
-        int64_t e_val = g % ctx.e_mult;
-        int64_t dst_ci = e_val * ctx.cin_ori + c;
-        int64_t dst_co = e_val * ctx.cout_ori + n;
-        int64_t src_co = g * ctx.cout_ori + n;
-        int64_t tempory = dst_ci % ctx.cube_k;
-        int64_t inx_fz = (g / ctx.e_mult) * ctx.d_dim * ctx.c1_dim * ctx.h_dim * ctx.w_dim * ctx.cout_opt * ctx.cube_k +
-                         d * ctx.c1_dim * ctx.h_dim * ctx.w_dim * ctx.cout_opt * ctx.cube_k +
-                         (dst_ci / ctx.cube_k) * ctx.h_dim * ctx.w_dim * ctx.cout_opt * ctx.cube_k +
-                         h * ctx.w_dim * ctx.cout_opt * ctx.cube_k + w * ctx.cout_opt * ctx.cube_k +
-                         dst_co * ctx.cube_k + tempory;
-        int64_t inx_4d = Compute4dIndexForFractalZ(format_4d, ctx, d, h, w, c, src_co);
-        if (!reverse) {
-            copy_data(args.data, args.output, inx_4d, inx_fz, ctx.data_size);
-        } else {
-            copy_data(args.data, args.output, inx_fz, inx_4d, ctx.data_size);
-        }
+    const int64_t e_val = g % ctx.e_mult;
+    const int64_t dst_ci = e_val * ctx.cin_ori + c;
+    const int64_t dst_co = e_val * ctx.cout_ori;
+    const int64_t src_co = g * ctx.cout_ori;
+    const int64_t tempory = dst_ci % ctx.cube_k;
+    const int64_t inx_fz = (g / ctx.e_mult) * ctx.d_dim * ctx.c1_dim * ctx.h_dim * ctx.w_dim * ctx.cout_opt *
+                               ctx.cube_k +
+                           d * ctx.c1_dim * ctx.h_dim * ctx.w_dim * ctx.cout_opt * ctx.cube_k +
+                           (dst_ci / ctx.cube_k) * ctx.h_dim * ctx.w_dim * ctx.cout_opt * ctx.cube_k +
+                           h * ctx.w_dim * ctx.cout_opt * ctx.cube_k + w * ctx.cout_opt * ctx.cube_k +
+                           dst_co * ctx.cube_k + tempory;
+    const int64_t inx_4d = Compute4dIndexForFractalZ(format_4d, ctx, d, h, w, c, src_co);
+    const int64_t stride_4d = Compute4dIndexForFractalZ(format_4d, ctx, d, h, w, c, src_co + 1) - inx_4d;
+    if (!reverse) {
+        return CopyStridedRun(args.data + inx_4d * ctx.data_size, stride_4d, args.output + inx_fz * ctx.data_size,
+                              ctx.cube_k, ctx.cout_ori, ctx.data_size);
     }
+    return CopyStridedRun(args.data + inx_fz * ctx.data_size, ctx.cube_k, args.output + inx_4d * ctx.data_size,
+                          stride_4d, ctx.cout_ori, ctx.data_size);
 }
 
-inline void CopyFractalZHWSlice(const TransArgs& args, const Format& format_4d, const FractalZTransCtx& ctx, int64_t g,
-                                int64_t d, int64_t c, bool reverse)
+inline uint32_t CopyFractalZHWSlice(const TransArgs& args, const Format& format_4d, const FractalZTransCtx& ctx,
+                                    int64_t g, int64_t d, int64_t c, bool reverse)
 {
     for (int64_t h = 0; h < ctx.h_dim; h++) {
         for (int64_t w = 0; w < ctx.w_dim; w++) {
-            CopyFractalZCoutColumn(args, format_4d, ctx, g, d, c, h, w, reverse);
+            const uint32_t ret = CopyFractalZCoutColumn(args, format_4d, ctx, g, d, c, h, w, reverse);
+            if (ret != KERNEL_STATUS_OK) {
+                return ret;
+            }
         }
     }
+    return KERNEL_STATUS_OK;
 }
 
 uint32_t TransFormatWithGroups(const Format& format_4d, const std::vector<int64_t>& shape_4d, const TransArgs& args,
@@ -300,25 +307,40 @@ uint32_t TransFormatWithGroups(const Format& format_4d, const std::vector<int64_
         return ret;
     }
     return RunGroupedFormatTransfer(args, ctx, [&](int64_t g, int64_t d, int64_t c) {
-        CopyFractalZHWSlice(args, format_4d, ctx, g, d, c, reverse);
+        return CopyFractalZHWSlice(args, format_4d, ctx, g, d, c, reverse);
     });
 }
 
-inline void CopyFzC04Nout(const TransArgs& args, const FractalZTransCtx& ctx, int64_t c, int64_t h, int64_t w,
-                          int64_t c1, int64_t n1, bool reverse)
+// Copies the n_dim elements of one (c, h, w) column; the fz index advances by cube_k per n, the HWCN index by 1.
+inline uint32_t CopyFzC04Nout(const TransArgs& args, const FractalZTransCtx& ctx, int64_t c, int64_t h, int64_t w,
+                              int64_t c1, int64_t n1, bool reverse)
+{
+    const int64_t common_factor = h * ctx.w_dim * c1 * kC0 + w * kC0 + c % kC0;
+    const int64_t inx_fz = common_factor / ctx.cube_k * (ctx.cube_k * kNiSize * n1) + common_factor % ctx.cube_k;
+    const int64_t inx_4d = h * ctx.w_dim * ctx.c_dim * ctx.n_dim + w * ctx.c_dim * ctx.n_dim + c * ctx.n_dim;
+    if (!reverse) {
+        return CopyStridedRun(args.data + inx_4d * ctx.data_size, 1, args.output + inx_fz * ctx.data_size,
+                              ctx.cube_k, ctx.n_dim, ctx.data_size);
+    }
+    return CopyStridedRun(args.data + inx_fz * ctx.data_size, ctx.cube_k, args.output + inx_4d * ctx.data_size, 1,
+                          ctx.n_dim, ctx.data_size);
+}
+
+// One unit per (c, h) row of columns.
+uint32_t CopyFzC04Rows(const TransArgs& args, const FractalZTransCtx& ctx, int64_t c1, int64_t n1, bool reverse,
+                       int64_t start, int64_t end)
 {
-    for (int64_t n = 0; n < ctx.n_dim; n++) {
-        int64_t common_factor = h * ctx.w_dim * c1 * kC0 + w * kC0 + c % kC0;
-        int64_t inx_fz = common_factor / ctx.cube_k * (ctx.cube_k * kNiSize * n1) +
-                         (n / kNiSize * (ctx.cube_k * kNiSize)) + (n % kNiSize * ctx.cube_k) +
-                         common_factor % ctx.cube_k;
-        int64_t inx_4d = h * ctx.w_dim * ctx.c_dim * ctx.n_dim + w * ctx.c_dim * ctx.n_dim + c * ctx.n_dim + n;
-        if (!reverse) {
-            copy_data(args.data, args.output, inx_4d, inx_fz, ctx.data_size);
-        } else {
-            copy_data(args.data, args.output, inx_fz, inx_4d, ctx.data_size);
+    for (int64_t unit = start; unit < end; unit++) {
+        const int64_t c = unit / ctx.h_dim;
+        const int64_t h = unit % ctx.h_dim;
+        for (int64_t w = 0; w < ctx.w_dim; w++) {
+            const uint32_t ret = CopyFzC04Nout(args, ctx, c, h, w, c1, n1, reverse);
+            if (ret != KERNEL_STATUS_OK) {
+                return ret;
+            }
         }
     }
+    return KERNEL_STATUS_OK;
 }
 
 uint32_t TransFormatForFzC04(const Format& format_4d, const std::vector<int64_t>& shape_4d, const TransArgs& args,
@@ -330,24 +352,11 @@ uint32_t TransFormatForFzC04(const Format& format_4d, const std::vector<int64_t>
     if (ret != KERNEL_STATUS_OK) {
         return ret;
     }
-    int64_t c1 = ctx.cin_opt / ctx.cube_k;
-    int64_t n1 = Ceil(ctx.e_mult * ctx.cout_ori, static_cast<int64_t>(kCubeSize));
-    if (ctx.dst_size == 0) {
-        return KERNEL_STATUS_OK;
-    }
-    const errno_t mret = memset_s(args.output, static_cast<size_t>(ctx.dst_size), 0, static_cast<size_t>(ctx.dst_size));
-    if (mret != EOK) {
-        KERNEL_LOG_ERROR("memset_s failed, size [%ld], errno [%d].", ctx.dst_size, mret);
-        return KERNEL_STATUS_PARAM_INVALID;
-    }
-    for (int64_t c = 0; c < ctx.c_dim; c++) {
-        for (int64_t h = 0; h < ctx.h_dim; h++) {
-            for (int64_t w = 0; w < ctx.w_dim; w++) {
-                CopyFzC04Nout(args, ctx, c, h, w, c1, n1, reverse);
-            }
-        }
-    }
-    return KERNEL_STATUS_OK;
+    const int64_t c1 = ctx.cin_opt / ctx.cube_k;
+    const int64_t n1 = Ceil(ctx.e_mult * ctx.cout_ori, static_cast<int64_t>(kCubeSize));
+    return RunTiledFormatTransfer(args, ctx.dst_size, true, ctx.c_dim * ctx.h_dim, [&](int64_t start, int64_t end) {
+        return CopyFzC04Rows(args, ctx, c1, n1, reverse, start, end);
+    });
 }
 uint32_t DispatchToFractalZ(FormatTransferFractalZ& transfer, const TransArgs& args, bool reverse, bool is_fz_c04)
 {
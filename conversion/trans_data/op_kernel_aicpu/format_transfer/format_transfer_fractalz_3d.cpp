@@ -178,38 +178,44 @@ inline int64_t Compute5dIndexForFractalz3D(const Format& format_5d, const Fracta
     return 0;
 }
 
-inline void CopyFractalz3DCoutColumn(const TransArgs& args, const Format& format_5d, const Fractalz3DCtx& ctx,
-                                     int64_t g, int64_t d, int64_t c, int64_t h, int64_t w, bool reverse)
+// Copies the cout_ori elements of one (g, d, c, h, w) column as a single strided run: the fz index advances by
+// cube_k per n and the 5D index by a fixed stride.
+inline uint32_t CopyFractalz3DCoutColumn(const TransArgs& args, const Format& format_5d, const Fractalz3DCtx& ctx,
+                                         int64_t g, int64_t d, int64_t c, int64_t h, int64_t w, bool reverse)
 {
-    for (int64_t n = 0; n < ctx.cout_ori; n++) {
-        const int64_t e_val = g % ctx.e_mult;
-        const int64_t dst_ci = e_val * ctx.cin_ori + c;
-        const int64_t dst_co = e_val * ctx.cout_ori + n;
-        const int64_t src_co = g * ctx.cout_ori + n;
-        const int64_t tempory = dst_ci % ctx.cube_k;
-        const int64_t index_fz = (g / ctx.e_mult) * ctx.d_dim * ctx.c1_dim * ctx.h_dim * ctx.w_dim * ctx.cout_opt *
-                                     ctx.cube_k +
-                                 d * ctx.c1_dim * ctx.h_dim * ctx.w_dim * ctx.cout_opt * ctx.cube_k +
-                                 (dst_ci / ctx.cube_k) * ctx.h_dim * ctx.w_dim * ctx.cout_opt * ctx.cube_k +
-                                 h * ctx.w_dim * ctx.cout_opt * ctx.cube_k + w * ctx.cout_opt * ctx.cube_k +
-                                 dst_co * ctx.cube_k + tempory;
-        const int64_t index_5d = Compute5dIndexForFractalz3D(format_5d, ctx, d, h, w, c, src_co);
-        if (!reverse) {
-            copy_data(args.data, args.output, index_5d, index_fz, ctx.data_size);
-        } else {
-            copy_data(args.data, args.output, index_fz, index_5d, ctx.data_size);
-        }
+    const int64_t e_val = g % ctx.e_mult;
+    const int64_t dst_ci = e_val * ctx.cin_ori + c;
+    const int64_t dst_co = e_val * ctx.cout_ori;
+    const int64_t src_co = g * ctx.cout_ori;
+    const int64_t tempory = dst_ci % ctx.cube_k;
+    const int64_t index_fz = (g / ctx.e_mult) * ctx.d_dim * ctx.c1_dim * ctx.h_dim * ctx.w_dim * ctx.cout_opt *
+                                 ctx.cube_k +
+                             d * ctx.c1_dim * ctx.h_dim * ctx.w_dim * ctx.cout_opt * ctx.cube_k +
+                             (dst_ci / ctx.cube_k) * ctx.h_dim * ctx.w_dim * ctx.cout_opt * ctx.cube_k +
+                             h * ctx.w_dim * ctx.cout_opt * ctx.cube_k + w * ctx.cout_opt * ctx.cube_k +
+                             dst_co * ctx.cube_k + tempory;
+    const int64_t index_5d = Compute5dIndexForFractalz3D(format_5d, ctx, d, h, w, c, src_co);
+    const int64_t stride_5d = Compute5dIndexForFractalz3D(format_5d, ctx, d, h, w, c, src_co + 1) - index_5d;
+    if (!reverse) {
+        return CopyStridedRun(args.data + index_5d * ctx.data_size, stride_5d, args.output + index_fz * ctx.data_size,
+                              ctx.cube_k, ctx.cout_ori, ctx.data_size);
     }
+    return CopyStridedRun(args.data + index_fz * ctx.data_size, ctx.cube_k, args.output + index_5d * ctx.data_size,
+                          stride_5d, ctx.cout_ori, ctx.data_size);
 }
 
-inline void CopyFractalz3DHWSlice(const TransArgs& args, const Format& format_5d, const Fractalz3DCtx& ctx, int64_t g,
-                                  int64_t d, int64_t c, bool reverse)
+inline uint32_t CopyFractalz3DHWSlice(const TransArgs& args, const Format& format_5d, const Fractalz3DCtx& ctx,
+                                      int64_t g, int64_t d, int64_t c, bool reverse)
 {
     for (int64_t h = 0; h < ctx.h_dim; h++) {
         for (int64_t w = 0; w < ctx.w_dim; w++) {
-            CopyFractalz3DCoutColumn(args, format_5d, ctx, g, d, c, h, w, reverse);
+            const uint32_t ret = CopyFractalz3DCoutColumn(args, format_5d, ctx, g, d, c, h, w, reverse);
+            if (ret != KERNEL_STATUS_OK) {
+                return ret;
+            }
         }
     }
+    return KERNEL_STATUS_OK;
 }
 
 uint32_t TransFormatWithGroups(const Format& format_5d, const std::vector<int64_t>& shape_5d, const TransArgs& args,
@@ -221,7 +227,7 @@ uint32_t TransFormatWithGroups(const Format& format_5d, const std::vector<int64_
         return ret;
     }
     return RunGroupedFormatTransfer(args, ctx, [&](int64_t g, int64_t d, int64_t c) {
-        CopyFractalz3DHWSlice(args, format_5d, ctx, g, d, c, reverse);
+        return CopyFractalz3DHWSlice(args, format_5d, ctx, g, d, c, reverse);
     });
 }
 
@@ -9,6 +9,8 @@
  */
 #include "format_transfer_ndc1hwc0.h"
 
+#include <algorithm>
+
 #include "format_transfer_utils.h"
 #include "formats_definitions.h"
 #include "kernel_util.h"
@@ -29,65 +31,62 @@ KernelStatus CheckDataTypeSupport(DataType data_type)
     return GetSizeByDataType(data_type) > 0 ? KERNEL_STATUS_OK : KERNEL_STATUS_PARAM_INVALID;
 }
 
-void CopyCLineToNdc1hwc0(const TransArgs& args, uint8_t* dst, int32_t data_size, int64_t c, int64_t c0_div,
-                         int64_t src_base, int64_t src_stride_per_c, int64_t dst_base, int64_t hwc0)
+struct Ndc1hwc0Params {
+    int64_t d;
+    int64_t h;
+    int64_t w;
+    int64_t c;
+    int64_t c0;
+    int64_t c1;
+    int64_t hw;
+    int64_t hwc0;
+    int64_t c1hwc0;
+    int64_t dhwc;
+    int64_t hwc;
+    int64_t wc;
+    int64_t data_size;
+    bool is_ncdhw;
+    // NCDHW [N][C][D][H][W]: advancing c by 1 skips D*H*W elements.
+    // NDHWC [N][D][H][W][C]: advancing c by 1 skips 1 element.
+    int64_t src_stride_per_c;
+};
+
+// Scatters the C line at (n, d, h, w) into its c1 blocks, one strided run of up to c0 elements per block.
+uint32_t CopyCLineToNdc1hwc0(const TransArgs& args, const Ndc1hwc0Params& p, int64_t src_base, int64_t dst_base)
 {
-    if (c0_div == 0) {
-        KERNEL_LOG_ERROR("c0_div must not be 0.");
-        return;
-    }
-    for (int64_t c_idx = 0; c_idx < c; ++c_idx) {
-        const int64_t src_index = src_base + c_idx * src_stride_per_c;
-        const int64_t div_result = (c0_div == 0) ? 0 : (c_idx / c0_div);
-        const int64_t mod_result = (c0_div == 0) ? 0 : (c_idx % c0_div);
-        const int64_t dst_index = dst_base + div_result * hwc0 + mod_result;
-        uint8_t* dst_data = dst + dst_index * data_size;
-        const uint8_t* src_data = args.data + src_index * data_size;
-        for (int64_t index = 0; index < data_size; ++index) {
-            *dst_data++ = *src_data++;
+    for (int64_t c1_idx = 0; c1_idx < p.c1; ++c1_idx) {
+        const int64_t c_head = c1_idx * p.c0;
+        const int64_t src_index = src_base + c_head * p.src_stride_per_c;
+        const int64_t dst_index = dst_base + c1_idx * p.hwc0;
+        const uint32_t ret = CopyStridedRun(args.data + src_index * p.data_size, p.src_stride_per_c,
+                                            args.output + dst_index * p.data_size, 1, std::min(p.c0, p.c - c_head),
+                                            p.data_size);
+        if (ret != KERNEL_STATUS_OK) {
+            return ret;
         }
     }
+    return KERNEL_STATUS_OK;
 }
 
-void TransSrcDataToDstData(const TransArgs& args, const std::vector<int64_t>& shape_ndhwc, uint8_t* dst, int64_t c0,
-                           int32_t data_size)
+// One unit per (n, d, h) row of C lines.
+uint32_t TransSrcDataToDstData(const TransArgs& args, const Ndc1hwc0Params& p, int64_t start, int64_t end)
 {
-    if (c0 <= 0) {
-        KERNEL_LOG_ERROR("C0 must be greater than 0, now is [%ld]", c0);
-        return;
-    }
-    const int64_t n = shape_ndhwc[0];
-    const int64_t d = shape_ndhwc[1];
-    const int64_t h = shape_ndhwc[2];
-    const int64_t w = shape_ndhwc[3];
-    const int64_t c = shape_ndhwc[4];
-    const int64_t c0_div = c0;
-    const int64_t c1 = ((c - 1) / c0_div) + 1;
-    const int64_t hw = h * w;
-    const int64_t hwc0 = hw * c0_div;
-    const int64_t c1hwc0 = c1 * hwc0;
-    const int64_t dc1hwc0 = d * c1hwc0;
-    const int64_t dhw = d * hw;
-    const int64_t dhwc = dhw * c;
-    const int64_t hwc = hw * c;
-    const int64_t wc = w * c;
-    const bool is_ncdhw = (args.src_format == FORMAT_NCDHW);
-    // NCDHW [N][C][D][H][W]: advancing c by 1 skips D*H*W elements.
-    // NDHWC [N][D][H][W][C]: advancing c by 1 skips 1 element.
-    const int64_t src_stride_per_c = is_ncdhw ? dhw : 1;
-
-    for (int64_t n_idx = 0; n_idx < n; ++n_idx) {
-        for (int64_t d_idx = 0; d_idx < d; ++d_idx) {
-            for (int64_t h_idx = 0; h_idx < h; ++h_idx) {
-                for (int64_t w_idx = 0; w_idx < w; ++w_idx) {
-                    const int64_t src_base = is_ncdhw ? (n_idx * dhwc + d_idx * hw + h_idx * w + w_idx) :
-                                                        (n_idx * dhwc + d_idx * hwc + h_idx * wc + w_idx * c);
-                    const int64_t dst_base = n_idx * dc1hwc0 + d_idx * c1hwc0 + h_idx * (w * c0_div) + w_idx * c0_div;
-                    CopyCLineToNdc1hwc0(args, dst, data_size, c, c0_div, src_base, src_stride_per_c, dst_base, hwc0);
-                }
+    const int64_t dh = p.d * p.h;
+    for (int64_t unit = start; unit < end; ++unit) {
+        const int64_t n_idx = unit / dh;
+        const int64_t d_idx = (unit % dh) / p.h;
+        const int64_t h_idx = unit % p.h;
+        for (int64_t w_idx = 0; w_idx < p.w; ++w_idx) {
+            const int64_t src_base = p.is_ncdhw ? (n_idx * p.dhwc + d_idx * p.hw + h_idx * p.w + w_idx) :
+                                                  (n_idx * p.dhwc + d_idx * p.hwc + h_idx * p.wc + w_idx * p.c);
+            const int64_t dst_base = (n_idx * p.d + d_idx) * p.c1hwc0 + h_idx * (p.w * p.c0) + w_idx * p.c0;
+            const uint32_t ret = CopyCLineToNdc1hwc0(args, p, src_base, dst_base);
+            if (ret != KERNEL_STATUS_OK) {
+                return ret;
             }
         }
     }
+    return KERNEL_STATUS_OK;
 }
 
 uint32_t TransDstDataToNdc1hwc0(const TransArgs& args)
@@ -99,11 +98,6 @@ uint32_t TransDstDataToNdc1hwc0(const TransArgs& args)
     if (dst_size == 0) {
         return KERNEL_STATUS_OK;
     }
-    auto ret = BiggerMemSet(args.output, static_cast<size_t>(dst_size), 0, static_cast<size_t>(dst_size));
-    if (!ret) {
-        KERNEL_LOG_ERROR("memset failed.");
-        return KERNEL_STATUS_PARAM_INVALID;
-    }
 
     auto iter = kFormatTable.find(args.src_format);
     if (iter == kFormatTable.end()) {
@@ -112,24 +106,29 @@ uint32_t TransDstDataToNdc1hwc0(const TransArgs& args)
     }
 
     std::string cur_format = iter->second;
-    size_t n_index = cur_format.find('N');
-    size_t d_index = cur_format.find('D');
-    size_t h_index = cur_format.find('H');
-    size_t w_index = cur_format.find('W');
-    size_t c_index = cur_format.find('C');
-    std::vector<int64_t> shape_ndhwc;
-    shape_ndhwc.push_back(args.src_shape.at(n_index));
-    shape_ndhwc.push_back(args.src_shape.at(d_index));
-    shape_ndhwc.push_back(args.src_shape.at(h_index));
-    shape_ndhwc.push_back(args.src_shape.at(w_index));
-    shape_ndhwc.push_back(args.src_shape.at(c_index));
-    const int64_t c0 = GetC0ValueForTransFormat(data_type, args.input_format, args.output_format);
-    if (c0 <= 0) {
-        KERNEL_LOG_ERROR("Failed to get c0, c0 is [%ld]", c0);
+    const int64_t n = args.src_shape.at(cur_format.find('N'));
+    Ndc1hwc0Params p;
+    p.d = args.src_shape.at(cur_format.find('D'));
+    p.h = args.src_shape.at(cur_format.find('H'));
+    p.w = args.src_shape.at(cur_format.find('W'));
+    p.c = args.src_shape.at(cur_format.find('C'));
+    p.c0 = GetC0ValueForTransFormat(data_type, args.input_format, args.output_format);
+    if (p.c0 <= 0) {
+        KERNEL_LOG_ERROR("Failed to get c0, c0 is [%ld]", p.c0);
         return KERNEL_STATUS_PARAM_INVALID;
     }
-    TransSrcDataToDstData(args, shape_ndhwc, args.output, c0, data_size);
-    return KERNEL_STATUS_OK;
+    p.c1 = Ceil(p.c, p.c0);
+    p.hw = p.h * p.w;
+    p.hwc0 = p.hw * p.c0;
+    p.c1hwc0 = p.c1 * p.hwc0;
+    p.dhwc = p.d * p.hw * p.c;
+    p.hwc = p.hw * p.c;
+    p.wc = p.w * p.c;
+    p.data_size = data_size;
+    p.is_ncdhw = (args.src_format == FORMAT_NCDHW);
+    p.src_stride_per_c = p.is_ncdhw ? p.d * p.hw : 1;
+    auto copy_rows = [&args, &p](int64_t start, int64_t end) { return TransSrcDataToDstData(args, p, start, end); };
+    return RunTiledFormatTransfer(args, dst_size, true, n * p.d * p.h, copy_rows);
 }
 
 uint32_t TransShapeToNdc1hwc0(const std::vector<int64_t>& src_shape, const Format& src_format,
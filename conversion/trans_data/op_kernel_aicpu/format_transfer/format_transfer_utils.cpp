@@ -10,6 +10,11 @@
 
 #include "format_transfer_utils.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#include "cpu_kernel_utils.h"
 #include "formats_definitions.h"
 #include "kernel_util.h"
 #include "securec.h"
@@ -21,6 +26,125 @@ using namespace ge;
 
 namespace aicpu {
 namespace formats {
+namespace {
+// Outputs below this size are not worth waking up other cores for.
+const int64_t kTiledParallelBytes = 256 * 1024;
+// Zero-fill granularity of the parallel memset phase.
+const int64_t kZeroFillTileBytes = 1024 * 1024;
+
+template <size_t kBytes>
+void CopyStridedFixed(const uint8_t* src, int64_t src_step, uint8_t* dst, int64_t dst_step, int64_t count)
+{
+    for (int64_t i = 0; i < count; i++) {
+        std::memcpy(dst + i * dst_step, src + i * src_step, kBytes);
+    }
+}
+
+uint32_t ZeroFillTiles(uint8_t* output, int64_t dst_size, int64_t start, int64_t end)
+{
+    for (int64_t tile = start; tile < end; tile++) {
+        const int64_t offset = tile * kZeroFillTileBytes;
+        const size_t len = static_cast<size_t>(std::min(kZeroFillTileBytes, dst_size - offset));
+        const errno_t ret = memset_s(output + offset, len, 0, len);
+        if (ret != EOK) {
+            KERNEL_LOG_ERROR("memset_s failed, offset [%ld], size [%zu], errno [%d].", offset, len, ret);
+            return KERNEL_STATUS_INNER_ERROR;
+        }
+    }
+    return KERNEL_STATUS_OK;
+}
+} // namespace
+
+uint32_t CopyStridedRun(const uint8_t* src, int64_t src_stride, uint8_t* dst, int64_t dst_stride, int64_t count,
+                        int64_t data_size)
+{
+    if (count <= 0) {
+        return KERNEL_STATUS_OK;
+    }
+    if (src_stride == 1 && dst_stride == 1) {
+        const size_t bytes = static_cast<size_t>(count * data_size);
+        const errno_t ret = memcpy_s(dst, bytes, src, bytes);
+        if (ret != EOK) {
+            KERNEL_LOG_ERROR("memcpy_s failed, size [%zu], ret [%d].", bytes, ret);
+            return KERNEL_STATUS_INNER_ERROR;
+        }
+        return KERNEL_STATUS_OK;
+    }
+    const int64_t src_step = src_stride * data_size;
+    const int64_t dst_step = dst_stride * data_size;
+    switch (data_size) {
+        case sizeof(uint8_t):
+            CopyStridedFixed<sizeof(uint8_t)>(src, src_step, dst, dst_step, count);
+            break;
+        case sizeof(uint16_t):
+            CopyStridedFixed<sizeof(uint16_t)>(src, src_step, dst, dst_step, count);
+            break;
+        case sizeof(uint32_t):
+            CopyStridedFixed<sizeof(uint32_t)>(src, src_step, dst, dst_step, count);
+            break;
+        case sizeof(uint64_t):
+            CopyStridedFixed<sizeof(uint64_t)>(src, src_step, dst, dst_step, count);
+            break;
+        default:
+            for (int64_t i = 0; i < count; i++) {
+                std::memcpy(dst + i * dst_step, src + i * src_step, static_cast<size_t>(data_size));
+            }
+            break;
+    }
+    return KERNEL_STATUS_OK;
+}
+
+uint32_t RunTiledFormatTransfer(const TransArgs& args, int64_t dst_size, bool zero_fill, int64_t units,
+                                const std::function<uint32_t(int64_t, int64_t)>& copy_units)
+{
+    if (dst_size <= 0) {
+        return KERNEL_STATUS_OK;
+    }
+    const int64_t cores =
+        (args.ctx == nullptr) ? 1 : static_cast<int64_t>(CpuKernelUtils::GetCPUNum(*(args.ctx)));
+    if (cores <= 1 || dst_size < kTiledParallelBytes) {
+        if (zero_fill && !BiggerMemSet(args.output, static_cast<size_t>(dst_size), 0, static_cast<size_t>(dst_size))) {
+            KERNEL_LOG_ERROR("BiggerMemSet failed, size [%ld].", dst_size);
+            return KERNEL_STATUS_INNER_ERROR;
+        }
+        return (units > 0) ? copy_units(0, units) : static_cast<uint32_t>(KERNEL_STATUS_OK);
+    }
+
+    std::atomic<bool> failed{false};
+    if (zero_fill) {
+        const int64_t tiles = Ceil(dst_size, kZeroFillTileBytes);
+        auto fill = [&args, &failed, dst_size](int64_t start, int64_t end) {
+            if (ZeroFillTiles(args.output, dst_size, start, end) != KERNEL_STATUS_OK) {
+                failed.store(true, std::memory_order_relaxed);
+            }
+        };
+        KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(*(args.ctx), tiles, 1, fill),
+                            "TransData zero fill ParallelFor failed.")
+        if (failed.load(std::memory_order_relaxed)) {
+            return KERNEL_STATUS_INNER_ERROR;
+        }
+    }
+    if (units <= 0) {
+        return KERNEL_STATUS_OK;
+    }
+    auto shard = [&copy_units, &failed](int64_t start, int64_t end) {
+        if (failed.load(std::memory_order_relaxed)) {
+            return;
+        }
+        if (copy_units(start, end) != KERNEL_STATUS_OK) {
+            failed.store(true, std::memory_order_relaxed);
+        }
+    };
+    KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(*(args.ctx), units, Ceil(units, cores), shard),
+                        "TransData copy ParallelFor failed.")
+    if (failed.load(std::memory_order_relaxed)) {
+        KERNEL_LOG_ERROR("Failed to copy [%s] to [%s] in sharder.", FormatToSerialString(args.src_format).c_str(),
+                         FormatToSerialString(args.dst_format).c_str());
+        return KERNEL_STATUS_INNER_ERROR;
+    }
+    return KERNEL_STATUS_OK;
+}
+
 bool IsShapeValid(const vector<int64_t>& shape)
 {
     if (shape.empty()) {
@@ -11,6 +11,7 @@
 #ifndef AICPU_KERNELS_HOST_FORMAT_TRANSFER_FORMAT_TRANSFER_UTILS_H_
 #define AICPU_KERNELS_HOST_FORMAT_TRANSFER_FORMAT_TRANSFER_UTILS_H_
 
+#include <functional>
 #include <string>
 #include <vector>
 #include "kernel_util.h"
@@ -70,25 +71,44 @@ uint32_t ComputeCinCoutOri(int64_t n, int64_t c, int64_t groups, int64_t cube_k,
 uint32_t BuildFzWithGroupsShape(int64_t n, int64_t c, int64_t spatial_dim, int64_t cube_k, int64_t groups,
                                 std::vector<int64_t>& dst_shape);
 
+/**
+ * Copy count elements of data_size bytes from src to dst, where consecutive
+ * elements are src_stride / dst_stride elements apart. Unit strides collapse
+ * into a single memcpy; otherwise the per-element copy has a fixed width so
+ * it compiles down to plain loads and stores.
+ */
+uint32_t CopyStridedRun(const uint8_t* src, int64_t src_stride, uint8_t* dst, int64_t dst_stride, int64_t count,
+                        int64_t data_size);
+
+/**
+ * Tiled driver shared by the layout transfers. The output (dst_size bytes) is
+ * optionally zero-filled tile by tile, then copy_units is called on disjoint
+ * [start, end) ranges of units. Both phases are sharded over the AICPU cores
+ * when args.ctx is set and the output is large enough, otherwise they run
+ * inline. Every unit must write a region of the output no other unit touches.
+ */
+uint32_t RunTiledFormatTransfer(const TransArgs& args, int64_t dst_size, bool zero_fill, int64_t units,
+                                const std::function<uint32_t(int64_t, int64_t)>& copy_units);
+
 // Shared grouped-format loop skeleton used by TransFormatWithGroups in fractal_z / fractalz_3d.
+// Each (g, d, c) slice writes its own output elements, so slices are sharded across cores.
 template <typename Ctx, typename CopyHwSliceFn>
 uint32_t RunGroupedFormatTransfer(const TransArgs& args, const Ctx& ctx, CopyHwSliceFn copy_hw_slice)
 {
-    if (ctx.dst_size == 0) {
-        return KERNEL_STATUS_OK;
-    }
-    if (!BiggerMemSet(args.output, static_cast<size_t>(ctx.dst_size), 0, static_cast<size_t>(ctx.dst_size))) {
-        KERNEL_LOG_ERROR("BiggerMemSet failed, size [%ld].", ctx.dst_size);
-        return KERNEL_STATUS_PARAM_INVALID;
-    }
-    for (int64_t g = 0; g < args.groups; g++) {
-        for (int64_t d = 0; d < ctx.d_dim; d++) {
-            for (int64_t c = 0; c < ctx.c_dim; c++) {
-                copy_hw_slice(g, d, c);
+    const int64_t slices = ctx.d_dim * ctx.c_dim;
+    const int64_t units = args.groups * slices;
+    return RunTiledFormatTransfer(args, ctx.dst_size, true, units, [&](int64_t start, int64_t end) -> uint32_t {
+        for (int64_t unit = start; unit < end; unit++) {
+            const int64_t g = unit / slices;
+            const int64_t d = (unit % slices) / ctx.c_dim;
+            const int64_t c = unit % ctx.c_dim;
+            const uint32_t ret = copy_hw_slice(g, d, c);
+            if (ret != KERNEL_STATUS_OK) {
+                return ret;
             }
         }
-    }
-    return KERNEL_STATUS_OK;
+        return KERNEL_STATUS_OK;
+    });
 }
 
 template <typename T>
@@ -59,5 +59,16 @@ bool FormatTransferExists(const TransArgs& args)
     }
     return dst_builder->second.count(args.dst_format) > 0;
 }
+
+vector<pair<Format, Format>> GetRegisteredFormatTransfers()
+{
+    vector<pair<Format, Format>> pairs;
+    for (const auto& src_iter : GetFormatTransferRegistry().src_dst_builder) {
+        for (const auto& dst_iter : src_iter.second) {
+            pairs.emplace_back(src_iter.first, dst_iter.first);
+        }
+    }
+    return pairs;
+}
 } // namespace formats
 } // namespace aicpu
@@ -12,6 +12,7 @@
 
 #include <functional>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "cpu_types.h"
@@ -69,6 +70,12 @@ public:
 std::shared_ptr<FormatTransfer> BuildFormatTransfer(const TransArgs& args);
 
 bool FormatTransferExists(const TransArgs& args);
+
+/**
+ * List every registered (src, dst) primary format pair, ordered by src then dst
+ * @return
+ */
+std::vector<std::pair<Format, Format>> GetRegisteredFormatTransfers();
 } // namespace formats
 } // namespace aicpu
 #endif
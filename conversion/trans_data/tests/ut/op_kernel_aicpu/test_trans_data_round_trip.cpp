@@ -0,0 +1,169 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <cctype>
+#include <string>
+
+#include "gtest/gtest.h"
+#ifndef private
+#define private public
+#define protected public
+#endif
+#include "utils/aicpu_test_utils.h"
+#include "cpu_kernel_utils.h"
+#include "node_def_builder.h"
+#undef private
+#undef protected
+#include "utils/kernel_util.h"
+#include "../../../op_kernel_aicpu/format_transfer/register_format_transfer.h"
+
+using namespace aicpu;
+
+// Every registered TransData (src, dst) pair runs on weight-sized fp16 tensors and is round-tripped through its
+// reverse transfer when one is registered, a large-shape correctness check of the sharded copy paths.
+class TEST_TRANS_DATA_ROUND_TRIP_UT : public testing::TestWithParam<std::pair<Format, Format>> {};
+
+namespace {
+const int64_t kCube = 16;
+
+// Shapes tried for each plain format. The first one is a typical conv weight; the others satisfy transfers that
+// restrict C (C1HWC0 needs C == 1, FRACTAL_Z_C04 needs C <= 4).
+std::vector<std::vector<int64_t>> PlainShapes(Format format)
+{
+    switch (format) {
+        case FORMAT_NCHW:
+            return {{256, 128, 3, 3}, {512, 1, 28, 28}, {512, 4, 7, 7}};
+        case FORMAT_NHWC:
+            return {{256, 3, 3, 128}};
+        case FORMAT_HWCN:
+            return {{3, 3, 128, 256}, {28, 28, 1, 512}, {7, 7, 4, 512}};
+        case FORMAT_CHWN:
+            return {{128, 3, 3, 256}};
+        case FORMAT_NCDHW:
+            return {{128, 64, 3, 3, 3}};
+        case FORMAT_DHWCN:
+            return {{3, 3, 3, 64, 128}};
+        case FORMAT_NDHWC:
+            return {{128, 3, 3, 3, 64}};
+        case FORMAT_ND:
+            return {{8, 512, 512}};
+        default:
+            return {};
+    }
+}
+
+bool IsFractalNz(Format format)
+{
+    return format == FORMAT_FRACTAL_NZ || format == FORMAT_FRACTAL_NZ_C0_16 || format == FORMAT_FRACTAL_NZ_C0_32;
+}
+
+// FRACTAL_NZ shapes are not derivable by TransShape (h0/w0 are not unique), so they are built directly.
+std::vector<int64_t> FractalNzShape(const std::vector<int64_t>& nd_shape, Format format)
+{
+    const int64_t w0 = (format == FORMAT_FRACTAL_NZ_C0_32) ? 2 * kCube : kCube;
+    const size_t rank = nd_shape.size();
+    std::vector<int64_t> shape(nd_shape.begin(), nd_shape.end() - 2);
+    shape.push_back((nd_shape[rank - 1] + w0 - 1) / w0);
+    shape.push_back((nd_shape[rank - 2] + kCube - 1) / kCube);
+    shape.push_back(kCube);
+    shape.push_back(w0);
+    return shape;
+}
+
+// Pick src/dst shapes for a pair from the plain side's candidates, letting the transfer itself derive the other side.
+bool DeriveShapes(Format src, Format dst, std::vector<int64_t>& src_shape, std::vector<int64_t>& dst_shape)
+{
+    const bool reverse = PlainShapes(src).empty();
+    const Format other = reverse ? src : dst;
+    const std::vector<int64_t> cube_shape = {kCube};
+    for (const auto& plain_shape : PlainShapes(reverse ? dst : src)) {
+        std::vector<int64_t> other_shape;
+        if (IsFractalNz(other)) {
+            other_shape = FractalNzShape(plain_shape, other);
+        } else {
+            formats::TransArgs args{nullptr, nullptr, src, dst, src, dst, reverse ? cube_shape : plain_shape,
+                                    reverse ? plain_shape : cube_shape, DT_FLOAT16, 1, nullptr};
+            auto transfer = formats::BuildFormatTransfer(args);
+            if (transfer == nullptr || transfer->TransShape(args, other_shape, reverse) != KERNEL_STATUS_OK) {
+                continue;
+            }
+        }
+        src_shape = reverse ? other_shape : plain_shape;
+        dst_shape = reverse ? plain_shape : other_shape;
+        return true;
+    }
+    return false;
+}
+
+int64_t NumElements(const std::vector<int64_t>& shape)
+{
+    int64_t num = 1;
+    for (auto dim : shape) {
+        num *= dim;
+    }
+    return num;
+}
+
+uint32_t RunTransData(Format src, Format dst, const std::vector<int64_t>& src_shape,
+                      const std::vector<int64_t>& dst_shape, std::vector<uint16_t>& in, std::vector<uint16_t>& out)
+{
+    auto node_def = CpuKernelUtils::CreateNodeDef();
+    NodeDefBuilder(node_def.get(), "TransData", "TransData")
+        .Input({"src", DT_FLOAT16, src_shape, in.data(), src})
+        .Output({"dst", DT_FLOAT16, dst_shape, out.data(), dst})
+        .Attr("groups", static_cast<int64_t>(1));
+    CpuKernelContext ctx(HOST);
+    if (ctx.Init(node_def.get()) != KERNEL_STATUS_OK) {
+        return KERNEL_STATUS_PARAM_INVALID;
+    }
+    return CpuKernelRegister::Instance().RunCpuKernel(ctx);
+}
+
+// gtest parameter names only allow [A-Za-z0-9_].
+std::string PairName(const testing::TestParamInfo<std::pair<Format, Format>>& info)
+{
+    std::string name = FormatToSerialString(info.param.first) + "_to_" + FormatToSerialString(info.param.second);
+    for (auto& c : name) {
+        if (!std::isalnum(static_cast<unsigned char>(c))) {
+            c = '_';
+        }
+    }
+    return name;
+}
+} // namespace
+
+TEST_P(TEST_TRANS_DATA_ROUND_TRIP_UT, round_trip)
+{
+    const Format src = GetParam().first;
+    const Format dst = GetParam().second;
+    const std::string name = FormatToSerialString(src) + " -> " + FormatToSerialString(dst);
+    std::vector<int64_t> src_shape;
+    std::vector<int64_t> dst_shape;
+    if (!DeriveShapes(src, dst, src_shape, dst_shape)) {
+        GTEST_SKIP() << name << ": no test shape";
+    }
+    std::vector<uint16_t> in(NumElements(src_shape));
+    for (size_t i = 0; i < in.size(); i++) {
+        in[i] = static_cast<uint16_t>(i % 65521 + 1);
+    }
+    std::vector<uint16_t> out(NumElements(dst_shape), 0);
+    ASSERT_EQ(RunTransData(src, dst, src_shape, dst_shape, in, out), KERNEL_STATUS_OK) << name;
+
+    formats::TransArgs back_args{nullptr,   nullptr,   dst,        src, dst,    src,
+                                 dst_shape, src_shape, DT_FLOAT16, 1,   nullptr};
+    if (!PlainShapes(src).empty() && formats::FormatTransferExists(back_args)) {
+        std::vector<uint16_t> back(in.size(), 0);
+        ASSERT_EQ(RunTransData(dst, src, dst_shape, src_shape, out, back), KERNEL_STATUS_OK) << name;
+        EXPECT_TRUE(back == in) << name << " does not round-trip";
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(RegisteredPairs, TEST_TRANS_DATA_ROUND_TRIP_UT,
+                         testing::ValuesIn(formats::GetRegisteredFormatTransfers()), PairName);
@@ -14,6 +14,7 @@
  */
 #include "unpack_aicpu.h"
 #include "utils/kernel_util.h"
+#include "aicpu/split_copy_planner.h"
 
 namespace {
 const char *kUnpack = "Unpack";
@@ -72,118 +73,21 @@ uint32_t UnpackCpuKernel::CheckAndInitParams(CpuKernelContext &ctx) {
   return KERNEL_STATUS_OK;
 }
 
-template <typename T>
-uint32_t UnpackCpuKernel::UnpackWithOneOutput(
-    T *input_data_ptr, std::vector<T *> output_data_vec) {
-  int64_t copy_size = value_num * sizeof(T);
-  auto mem_ret =
-      memcpy_s(output_data_vec[0], copy_size, input_data_ptr, copy_size);
-  KERNEL_CHECK_FALSE((mem_ret == EOK), KERNEL_STATUS_PARAM_INVALID,
-                     "Memcpy size[%zu] from input value to output[0] failed.",
-                     copy_size);
-  return KERNEL_STATUS_OK;
-}
-
-template <typename T>
-uint32_t UnpackCpuKernel::UnpackWithDimZero(T *input_data_ptr,
-                                            std::vector<T *> output_data_vec) {
-  if (value_shape_vec[0] == 0) {
-    KERNEL_CHECK_FALSE(value_shape_vec[0] > 0, KERNEL_STATUS_PARAM_INVALID,
-                       "The shape of input tensor is invalid.");
-  }
-  int64_t copy_num = value_num / value_shape_vec[0];
-  T *input_copy_ptr = input_data_ptr;
-  for (int64_t i = 0; i < unpack_num; i++) {
-    int64_t copy_size_per = copy_num;
-    auto copy_size = copy_size_per * sizeof(T);
-    auto mem_ret =
-        memcpy_s(output_data_vec[i], copy_size, input_copy_ptr, copy_size);
-    KERNEL_CHECK_FALSE(
-        (mem_ret == EOK), KERNEL_STATUS_PARAM_INVALID,
-        "Memcpy size[%zu] from input value to output[%ld] failed.", copy_size,
-        i);
-    input_copy_ptr += copy_size_per;
-  }
-  return KERNEL_STATUS_OK;
-}
-
-template <typename T>
-uint32_t UnpackCpuKernel::UnpackCompute(T *input_data_ptr,
-                                        std::vector<T *> output_data_vec,
-                                        CpuKernelContext &ctx) {
-  int64_t prefix = 1;
-  for (uint64_t i = 0; i < unpack_axis; i++) {
-    if (value_shape_vec[i] == 0) {
-      KERNEL_CHECK_FALSE(value_shape_vec[i] > 0, KERNEL_STATUS_PARAM_INVALID, "The shape of input tensor is invalid.");
-    }
-    prefix *= value_shape_vec[i];
-  }
-  if (unpack_axis >= value_shape_vec.size()) {
-    KERNEL_CHECK_FALSE(unpack_axis < value_shape_vec.size(),
-                       KERNEL_STATUS_PARAM_INVALID, "input attr axis is invalid.");
-  }
-  int64_t midfix = value_shape_vec[unpack_axis];
-  int64_t subfix = 1;
-  for (size_t i = unpack_axis + 1; i < value_shape_vec.size(); i++) {
-    if (value_shape_vec[i] == 0) {
-      KERNEL_CHECK_FALSE(value_shape_vec[i] > 0, KERNEL_STATUS_PARAM_INVALID,
-                         "The shape of input tensor is invalid.");
-    }
-    subfix *= value_shape_vec[i];
-  }
-  uint32_t min_core_num = 1;
-  int64_t max_core_num = std::max(min_core_num, aicpu::CpuKernelUtils::GetCPUNum(ctx) - 2);
-  if (max_core_num > unpack_num) {
-    max_core_num = unpack_num;
-  }
-
-  auto shard_unpack = [&](size_t start, size_t end) {
-    int64_t offset = 0;
-    for (uint64_t i = start; i < end; i++) {
-      offset = i * subfix;
-      T *output_data_ptr = output_data_vec[i];
-      T *input_copy_ptr = input_data_ptr + offset;
-      auto copy_size = subfix * sizeof(T);
-      for (int64_t j = 0; j < prefix; j++) {
-        auto mem_ret = memcpy_s(output_data_ptr, copy_size, input_copy_ptr, copy_size);
-        KERNEL_CHECK_FALSE_VOID((mem_ret == EOK),
-            "Memcpy size[%zu] from input value to output[%ld] failed.", copy_size, i);
-        input_copy_ptr += (subfix * midfix);
-        output_data_ptr += subfix;
-      }
-    }
-  };
-  int64_t thread_num = max_core_num > 0 ? unpack_num / max_core_num : 1;
-  KERNEL_HANDLE_ERROR(
-      CpuKernelUtils::ParallelFor(ctx, unpack_num, thread_num, shard_unpack), "Unpack Compute failed.")
-  return KERNEL_STATUS_OK;
-}
-
 template <typename T>
 uint32_t UnpackCpuKernel::DoCompute(CpuKernelContext &ctx) {
-  T *input_data_ptr = reinterpret_cast<T *>(value_data_ptr);
-  std::vector<T *> output_data_vec;
-  output_data_vec.resize(unpack_num);
-  for (int64_t i = 0; i < unpack_num; i++) {
-    output_data_vec[i] = reinterpret_cast<T *>(output_ptr_vec[i]);
+  // A single output is a plain copy of value, any other unpack needs a non-empty input.
+  for (size_t i = 0; (unpack_num != 1) && (i < value_shape_vec.size()); i++) {
+    KERNEL_CHECK_FALSE(value_shape_vec[i] > 0, KERNEL_STATUS_PARAM_INVALID, "The shape of input tensor is invalid.");
   }
-  if (unpack_num == 1) {
-    KERNEL_CHECK_FALSE(
-        (UnpackWithOneOutput<T>(input_data_ptr, output_data_vec) ==
-         KERNEL_STATUS_OK),
-        KERNEL_STATUS_PARAM_INVALID, "UnpackWithOneOutput failed.");
-    return KERNEL_STATUS_OK;
-  }
-  if (unpack_axis == 0) {
-    KERNEL_CHECK_FALSE((UnpackWithDimZero<T>(input_data_ptr, output_data_vec) ==
-                        KERNEL_STATUS_OK),
-                       KERNEL_STATUS_PARAM_INVALID,
-                       "UnpackWithDimZero failed.");
-    return KERNEL_STATUS_OK;
+  SplitCopyPlan plan;
+  InitSplitCopyPlan(value_data_ptr, static_cast<int64_t>(sizeof(T)), value_shape_vec,
+                    static_cast<int64_t>(unpack_axis), plan);
+  int64_t offset = 0;
+  for (int64_t i = 0; i < unpack_num; i++) {
+    AddSplitOutput(plan, output_ptr_vec[i], 1, offset);
   }
-  KERNEL_CHECK_FALSE((UnpackCompute<T>(input_data_ptr, output_data_vec, ctx) ==
-                      KERNEL_STATUS_OK),
-                     KERNEL_STATUS_PARAM_INVALID, "Unpack Compute failed.");
+  KERNEL_CHECK_FALSE((RunSplitCopyPlan(ctx, plan) == KERNEL_STATUS_OK), KERNEL_STATUS_PARAM_INVALID,
+                     "Unpack Compute failed.");
   return KERNEL_STATUS_OK;
 }
 
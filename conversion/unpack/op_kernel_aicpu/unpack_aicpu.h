@@ -40,18 +40,6 @@ class UnpackCpuKernel : public CpuKernel {
  private:
   uint32_t CheckAndInitParams(CpuKernelContext &ctx);
 
-  template <typename T>
-  uint32_t UnpackWithOneOutput(T *input_data_ptr,
-                               std::vector<T *> output_data_vec);
-
-  template <typename T>
-  uint32_t UnpackWithDimZero(T *input_data_ptr,
-                             std::vector<T *> output_data_vec);
-
-  template <typename T>
-  uint32_t UnpackCompute(T *input_data_ptr, std::vector<T *> output_data_vec,
-                         CpuKernelContext &ctx);
-
   template <typename T>
   uint32_t DoCompute(CpuKernelContext &ctx);
 
@@ -262,4 +262,35 @@ ADD_CASE_FAILED(unpack_axis_illegal, DT_INT16, int16_t, unpack_axis2,
                 unpack_num3)
 
 ADD_CASE_FAILED(unpack_type_illegal, DT_STRING, int16_t, unpack_axis1,
-                unpack_num3)
\ No newline at end of file
+                unpack_num3)
+
+// Unstack the middle axis of a tensor large enough to shard; every copy is a single fp16 pair.
+TEST_F(TEST_UNPACK_UT, TestUnpack_middle_axis_sharded) {
+  const int64_t outer = 65536;
+  const int64_t num = 4;
+  const int64_t inner = 2;
+  vector<Eigen::half> input(outer * num * inner);
+  for (size_t i = 0; i < input.size(); i++) {
+    input[i] = static_cast<Eigen::half>(static_cast<float>(i % 2048));
+  }
+  vector<vector<Eigen::half>> outputs(num, vector<Eigen::half>(outer * inner));
+
+  auto node_def = CpuKernelUtils::CpuKernelUtils::CreateNodeDef();
+  NodeDefBuilder node(node_def.get(), "Unpack", "Unpack");
+  node.Input({"x", DT_FLOAT16, {outer, num, inner}, input.data()})
+      .Attr("num", num)
+      .Attr("axis", 1);
+  for (int64_t i = 0; i < num; i++) {
+    node.Output({"y", DT_FLOAT16, {outer, inner}, outputs[i].data()});
+  }
+  RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+  bool same = true;
+  for (int64_t o = 0; o < outer; o++) {
+    for (int64_t n = 0; n < num; n++) {
+      for (int64_t k = 0; k < inner; k++) {
+        same = same && (outputs[n][o * inner + k] == input[(o * num + n) * inner + k]);
+      }
+    }
+  }
+  EXPECT_TRUE(same);
+}
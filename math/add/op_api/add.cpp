@@ -10,6 +10,7 @@
 
 #include "add.h"
 #include "op_api/aclnn_check.h"
+#include "op_api/aicpu_strided_view.h"
 #include "opdev/aicpu/aicpu_task.h"
 #include "opdev/make_op_executor.h"
 #include "opdev/op_log.h"
@@ -64,8 +65,11 @@ static inline bool IsAiCoreSupport(const aclTensor* self)
 }
 
 bool IsAddSupportNonContiguous(const aclTensor* self, const aclTensor *other) {
-  bool isSupportNonContiguous = IsRegBase();
-  return isSupportNonContiguous && IsAiCoreSupport(self) && IsAiCoreSupport(other);
+  if (IsAiCoreSupport(self) && IsAiCoreSupport(other)) {
+    return IsRegBase();
+  }
+  // AICPU Add reads strided inputs in place (see AddAiCpuStrided)
+  return true;
 }
 
 // AICORE算子kernel
@@ -82,10 +86,37 @@ static const aclTensor* AddAiCore(
     return addOut;
 }
 
+// AICPU算子kernel，输入非连续时以storage + view属性下发，kernel内按stride读取，省去Contiguous拷贝
+static const aclTensor* AddAiCpuStrided(
+    const aclTensor* self, const aclTensor* other, aclTensor* addOut, aclOpExecutor* executor)
+{
+    L0_DFX(AddAiCpuStrided, self, other);
+    AicpuStridedInput x1;
+    AicpuStridedInput x2;
+    OP_CHECK(
+        MakeAicpuStridedInput(self, executor, x1) && MakeAicpuStridedInput(other, executor, x2),
+        OP_LOGE(ACLNN_ERR_INNER_NULLPTR, "AddAiCpuStrided create storage view failed."), return nullptr);
+
+    static internal::AicpuTaskSpace space("Add");
+    auto ret = ADD_TO_LAUNCHER_LIST_AICPU(
+        Add,
+        OP_ATTR_NAMES({"view_shape_0", "view_strides_0", "view_offset_0", "view_shape_1", "view_strides_1",
+                       "view_offset_1"}),
+        OP_INPUT(x1.storage, x2.storage), OP_OUTPUT(addOut),
+        OP_ATTR(x1.viewShape, x1.viewStrides, x1.viewOffset, x2.viewShape, x2.viewStrides, x2.viewOffset));
+    OP_CHECK(
+        ret == ACL_SUCCESS, OP_LOGE(ACLNN_ERR_INNER_NULLPTR, "AddAiCpuStrided ADD_TO_LAUNCHER_LIST_AICPU failed."),
+        return nullptr);
+    return addOut;
+}
+
 // AICPU算子kernel
 static const aclTensor* AddAiCpu(
     const aclTensor* self, const aclTensor* other, aclTensor* addOut, aclOpExecutor* executor)
 {
+    if (IsAicpuStridedLaunch(self, other)) {
+        return AddAiCpuStrided(self, other, addOut, executor);
+    }
     // 使用框架宏ADD_TO_LAUNCHER_LIST_AICPU，将AiCpu Add算子加入任务队列
     // Add是算子的OpType，self、other是算子的输入，addOut是算子的输出
     L0_DFX(AddAiCpu, self, other);
@@ -19,6 +19,7 @@
 #undef private
 #undef protected
 #include "Eigen/Core"
+#include "aicpu/broadcast_binary.h"
 
 using namespace std;
 using namespace aicpu;
@@ -558,3 +559,164 @@ TEST_F(TEST_ADD_UT, FLOAT16_SCALAR_BCAST_SMALL_SERIAL)
 
     EXPECT_EQ(CompareResult(out.data(), exp.data(), n), true);
 }
+
+// x1 is the transpose of a 3x4 storage passed as view attrs; x2 broadcasts along the rows.
+TEST_F(TEST_ADD_UT, FLOAT_STRIDED_VIEW_ADD_SUCC)
+{
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{12}, {3}, {4, 3}};
+
+    float input1[12];
+    for (int i = 0; i < 12; i++) {
+        input1[i] = static_cast<float>(i);
+    }
+    float input2[3] = {100.0f, 200.0f, 300.0f};
+    float output[12] = {0};
+    vector<void*> datas = {(void*)input1, (void*)input2, (void*)output};
+
+    auto node_def = CpuKernelUtils::CreateNodeDef();
+    NodeDefBuilder(node_def.get(), "Add", "Add")
+        .Input({"x1", data_types[0], shapes[0], datas[0]})
+        .Input({"x2", data_types[1], shapes[1], datas[1]})
+        .Output({"y", data_types[2], shapes[2], datas[2]})
+        .Attr("view_shape_0", vector<int64_t>{4, 3})
+        .Attr("view_strides_0", vector<int64_t>{1, 4})
+        .Attr("view_offset_0", static_cast<int64_t>(0));
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+    float output_exp[12];
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 3; j++) {
+            output_exp[i * 3 + j] = input1[j * 4 + i] + input2[j];
+        }
+    }
+    bool compare = CompareResult(output, output_exp, 12);
+    EXPECT_EQ(compare, true);
+}
+
+namespace {
+BinaryBcastPath ClassifyOperands(const StridedOperand& x, const StridedOperand& y)
+{
+    StridedBinaryPlan plan;
+    EXPECT_TRUE(BuildStridedBinaryPlan(x, y, plan));
+    return ClassifyBinaryPlan(plan);
+}
+} // namespace
+
+TEST_F(TEST_ADD_UT, BROADCAST_BINARY_CLASSIFY_PLAN)
+{
+    const StridedOperand dense{{64, 32}, {32, 1}, 0};
+    const StridedOperand row{{32}, {1}, 0};
+    const StridedOperand column{{64, 1}, {1, 1}, 0};
+    const StridedOperand scalar{{1}, {1}, 0};
+    EXPECT_EQ(ClassifyOperands(dense, dense), BinaryBcastPath::kSameShape);
+    EXPECT_EQ(ClassifyOperands(scalar, dense), BinaryBcastPath::kScalarX);
+    EXPECT_EQ(ClassifyOperands(dense, scalar), BinaryBcastPath::kScalarY);
+    EXPECT_EQ(ClassifyOperands(dense, row), BinaryBcastPath::kRowBcast);
+    EXPECT_EQ(ClassifyOperands(row, dense), BinaryBcastPath::kRowBcast);
+    EXPECT_EQ(ClassifyOperands(column, dense), BinaryBcastPath::kColumnBcastX);
+    EXPECT_EQ(ClassifyOperands(dense, column), BinaryBcastPath::kColumnBcastY);
+    EXPECT_EQ(ClassifyOperands(column, row), BinaryBcastPath::kGeneric);
+    // A transposed operand keeps the 2-D shape but is not dense, so it cannot take the row path.
+    const StridedOperand transposed{{64, 32}, {1, 64}, 0};
+    EXPECT_EQ(ClassifyOperands(transposed, row), BinaryBcastPath::kGeneric);
+}
+
+TEST_F(TEST_ADD_UT, BROADCAST_BINARY_SHARD_THRESHOLD)
+{
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{1}, {1}, {1}};
+    float input1[1] = {1.0f};
+    float input2[1] = {2.0f};
+    float output[1] = {0};
+    vector<void*> datas = {(void*)input1, (void*)input2, (void*)output};
+    CREATE_NODEDEF(shapes, data_types, datas);
+    CpuKernelContext ctx(HOST);
+    ASSERT_EQ(ctx.Init(node_def.get()), KERNEL_STATUS_OK);
+
+    // Below the serial cost the output stays on the calling thread.
+    EXPECT_EQ(BinaryShardElements(ctx, kBinarySerialCost - 1, 1, sizeof(float)), 0);
+    EXPECT_EQ(BinaryShardElements(ctx, kBinarySerialCost / kBinaryCostPow - 1, kBinaryCostPow, sizeof(float)), 0);
+
+    // Above it every shard carries at least the minimum cost and starts on an output cache line.
+    const int64_t total = 1 << 20;
+    const int64_t per_unit = BinaryShardElements(ctx, total, 1, sizeof(float));
+    const int64_t cores = std::max<int64_t>(1, static_cast<int64_t>(CpuKernelUtils::GetCPUNum(ctx)) -
+                                                   static_cast<int64_t>(kResvCpuNum));
+    if (cores == 1) {
+        EXPECT_EQ(per_unit, 0);
+    } else {
+        EXPECT_GE(per_unit, kBinaryMinShardCost);
+        EXPECT_EQ(per_unit % (kBinaryShardAlignBytes / static_cast<int64_t>(sizeof(float))), 0);
+        EXPECT_GE(per_unit * cores, total);
+    }
+}
+
+TEST_F(TEST_ADD_UT, FLOAT_ROW_BCAST_LARGE_PARALLEL)
+{
+    const int64_t rows = 512;
+    const int64_t cols = 256;
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{rows, cols}, {cols}, {rows, cols}};
+
+    vector<float> in0(rows * cols), in1(cols), out(rows * cols, 0.0f), exp(rows * cols);
+    for (int64_t j = 0; j < cols; ++j) {
+        in1[j] = static_cast<float>(j) * 0.5f;
+    }
+    for (int64_t i = 0; i < rows * cols; ++i) {
+        in0[i] = static_cast<float>(i % 1000);
+        exp[i] = in0[i] + in1[i % cols];
+    }
+    vector<void*> datas = {(void*)in0.data(), (void*)in1.data(), (void*)out.data()};
+
+    CREATE_NODEDEF(shapes, data_types, datas);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+    EXPECT_EQ(CompareResult(out.data(), exp.data(), rows * cols), true);
+}
+
+TEST_F(TEST_ADD_UT, INT32_COLUMN_BCAST_LARGE_PARALLEL)
+{
+    const int64_t rows = 512;
+    const int64_t cols = 256;
+    vector<DataType> data_types = {DT_INT32, DT_INT32, DT_INT32};
+    vector<vector<int64_t>> shapes = {{rows, 1}, {rows, cols}, {rows, cols}};
+
+    vector<int32_t> in0(rows), in1(rows * cols), out(rows * cols, 0), exp(rows * cols);
+    for (int64_t i = 0; i < rows; ++i) {
+        in0[i] = static_cast<int32_t>(i * 1000);
+    }
+    for (int64_t i = 0; i < rows * cols; ++i) {
+        in1[i] = static_cast<int32_t>(i % cols);
+        exp[i] = in0[i / cols] + in1[i];
+    }
+    vector<void*> datas = {(void*)in0.data(), (void*)in1.data(), (void*)out.data()};
+
+    CREATE_NODEDEF(shapes, data_types, datas);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+    EXPECT_EQ(CompareResult(out.data(), exp.data(), rows * cols), true);
+}
+
+TEST_F(TEST_ADD_UT, INT32_COLUMN_BCAST_RHS_LARGE_PARALLEL)
+{
+    const int64_t rows = 512;
+    const int64_t cols = 256;
+    vector<DataType> data_types = {DT_INT32, DT_INT32, DT_INT32};
+    vector<vector<int64_t>> shapes = {{rows, cols}, {rows, 1}, {rows, cols}};
+
+    vector<int32_t> in0(rows * cols), in1(rows), out(rows * cols, 0), exp(rows * cols);
+    for (int64_t i = 0; i < rows; ++i) {
+        in1[i] = static_cast<int32_t>(-i * 1000);
+    }
+    for (int64_t i = 0; i < rows * cols; ++i) {
+        in0[i] = static_cast<int32_t>(i % cols);
+        exp[i] = in0[i] + in1[i / cols];
+    }
+    vector<void*> datas = {(void*)in0.data(), (void*)in1.data(), (void*)out.data()};
+
+    CREATE_NODEDEF(shapes, data_types, datas);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+    EXPECT_EQ(CompareResult(out.data(), exp.data(), rows * cols), true);
+}
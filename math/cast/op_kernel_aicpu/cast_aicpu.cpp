@@ -14,6 +14,7 @@
 #include <cfloat>
 #include <cmath>
 #include <ctime>
+#include <vector>
 
 #include "Eigen/Core"
 #include "unsupported/Eigen/CXX11/Tensor"
@@ -80,6 +81,14 @@ constexpr int8_t kHif8ManBitsTwo = 2;
 constexpr int8_t kHif8ManBitsThree = 3;
 constexpr uint8_t kHif8NegSignValue = 128;
 constexpr int8_t kHif8DotLeftShift = 3;
+// Conversion tables
+constexpr size_t kCast16TableSize = 65536U;
+constexpr uint64_t kCast16TableMinElements = 65536U;
+constexpr uint32_t kFp32Hif8TableMinBits = 0x34000000U;  // 2^-23, smallest value hif8 does not flush to zero
+constexpr uint32_t kFp32Hif8TableMaxBits = 0x47400000U;  // kHif8OverValue, saturates to the hif8 maximum
+constexpr uint32_t kFp32Hif8TableShift = 19U;            // keep exponent and the top 4 mantissa bits
+constexpr uint32_t kFp32Hif8TableSize = (kFp32Hif8TableMaxBits - kFp32Hif8TableMinBits) >> kFp32Hif8TableShift;
+constexpr uint8_t kHif8SignMask = 0x80U;
 
 inline bool Fp32IsNan(uint32_t x) {
   return ((x & kFp32ExpMask) == kFp32ExpMask) && ((x & kFp32ManMask) != 0);
@@ -286,6 +295,71 @@ void CastTask(Tensor *&x_tensor, Tensor *&y_tensor, const int64_t &start,
   }
 }
 
+// A 16-bit source has only 64K distinct values, so every conversion out of fp16/bf16 can be answered by a table
+// built once from the scalar cast above. Building from static_cast keeps the results bit-exact by construction.
+template <typename T, typename S>
+std::vector<S> BuildCast16Table() {
+  static_assert(sizeof(T) == sizeof(uint16_t), "cast table source must be a 16-bit type");
+  std::vector<S> table(kCast16TableSize);
+  for (size_t i = 0; i < kCast16TableSize; i++) {
+    uint16_t bits = static_cast<uint16_t>(i);
+    T value;
+    (void)memcpy(static_cast<void *>(&value), &bits, sizeof(T));
+    table[i] = static_cast<S>(value);
+  }
+  return table;
+}
+
+template <typename T, typename S>
+const S *GetCast16Table() {
+  static const std::vector<S> table = BuildCast16Table<T, S>();
+  return table.data();
+}
+
+template <typename T, typename S>
+void CastTableTask(Tensor *&x_tensor, Tensor *&y_tensor, const int64_t &start,
+    const int64_t &end) {
+  const uint16_t *inptr = static_cast<const uint16_t *>(x_tensor->GetData());
+  S *outptr = static_cast<S *>(y_tensor->GetData());
+  const S *table = GetCast16Table<T, S>();
+  for (int64_t i = start; i < end; i++) {
+    outptr[i] = table[inptr[i]];
+  }
+}
+
+// Within [2^-23, 49152) the fp32 -> hif8 result only depends on the exponent and the top 4 mantissa bits (the
+// widest hif8 mantissa plus its rounding bit), so those bits index a small table of unsigned results built from
+// Fp32ToHif8Rtne. Zero, tiny, saturating and non-finite inputs keep the scalar path.
+std::vector<uint8_t> BuildFp32Hif8Table() {
+  std::vector<uint8_t> table(kFp32Hif8TableSize);
+  for (uint32_t i = 0; i < kFp32Hif8TableSize; i++) {
+    uint32_t bits = kFp32Hif8TableMinBits + (i << kFp32Hif8TableShift);
+    float value;
+    (void)memcpy(&value, &bits, sizeof(float));
+    table[i] = static_cast<uint8_t>(hif8_impl::Fp32ToHif8Rtne(value).val);
+  }
+  return table;
+}
+
+void CastFp32ToHif8Task(Tensor *&x_tensor, Tensor *&y_tensor, const int64_t &start,
+    const int64_t &end) {
+  const float *inptr = static_cast<const float *>(x_tensor->GetData());
+  uint8_t *outptr = static_cast<uint8_t *>(y_tensor->GetData());
+  static const std::vector<uint8_t> table = BuildFp32Hif8Table();
+  for (int64_t i = start; i < end; i++) {
+    uint32_t bits;
+    (void)memcpy(&bits, inptr + i, sizeof(uint32_t));
+    uint32_t offset = (bits & kFp32AbsMask) - kFp32Hif8TableMinBits;
+    if (offset < kFp32Hif8TableMaxBits - kFp32Hif8TableMinBits) {
+      uint8_t magnitude = table[offset >> kFp32Hif8TableShift];
+      uint8_t sign = static_cast<uint8_t>(bits >> (kFp32SignIndex - 7U)) & kHif8SignMask;
+      outptr[i] = (magnitude == 0) ? magnitude : static_cast<uint8_t>(magnitude | sign);
+    } else {
+      outptr[i] = static_cast<uint8_t>(hif8_impl::Fp32ToHif8Rtne(inptr[i]).val);
+    }
+  }
+}
+
 void CastCpuKernel::SetMap() {
   SetInt8Map();
   SetInt16Map();
@@ -550,10 +624,18 @@ void CastCpuKernel::SetBfloat16Map() {
 
 void CastCpuKernel::SetHif8Map() {
   calls_[DT_FLOAT16][DT_HIFLOAT8] = CastTask<Eigen::half, hif8>;
-  calls_[DT_FLOAT][DT_HIFLOAT8] = CastTask<float, hif8>;
+  calls_[DT_FLOAT][DT_HIFLOAT8] = CastFp32ToHif8Task;
   calls_[DT_BFLOAT16][DT_HIFLOAT8] = CastTask<Eigen::bfloat16, hif8>;
 }
 
+void CastCpuKernel::SetCast16TableMap() {
+  calls_[DT_FLOAT16][DT_FLOAT] = CastTableTask<Eigen::half, float>;
+  calls_[DT_FLOAT16][DT_BFLOAT16] = CastTableTask<Eigen::half, Eigen::bfloat16>;
+  calls_[DT_FLOAT16][DT_HIFLOAT8] = CastTableTask<Eigen::half, hif8>;
+  calls_[DT_BFLOAT16][DT_FLOAT16] = CastTableTask<Eigen::bfloat16, Eigen::half>;
+  calls_[DT_BFLOAT16][DT_HIFLOAT8] = CastTableTask<Eigen::bfloat16, hif8>;
+}
+
 uint32_t CastCpuKernel::ValidateTensors(CpuKernelContext &ctx) {
   x_tensor_ = ctx.Input(0);
   if (x_tensor_ == nullptr) {
@@ -602,6 +684,10 @@ uint32_t CastCpuKernel::ValidateDataType() {
   if (x_data_size_ > y_data_size_) {
     x_data_size_ = y_data_size_;
   }
+  // Tables are only worth building once the tensor is at least as large as the table itself.
+  if (x_data_size_ >= kCast16TableMinElements) {
+    SetCast16TableMap();
+  }
   return KERNEL_STATUS_OK;
 }
 
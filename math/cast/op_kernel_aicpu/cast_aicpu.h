@@ -63,6 +63,7 @@ class CastCpuKernel : public CpuKernel {
   void SetComplexMap();
   void SetBfloat16Map();
   void SetHif8Map();
+  void SetCast16TableMap();
   uint32_t ValidateTensors(CpuKernelContext &ctx);
   uint32_t ValidateDataType();
   uint32_t ExecuteCast(CpuKernelContext &ctx);
@@ -11,6 +11,7 @@
 #include "gtest/gtest.h"
 #include <math.h>
 #include <stdint.h>
+#include <string.h>
 #include <bitset>
 #include <Eigen/Dense>
 #ifndef private
@@ -22,6 +23,7 @@
 #include "cpu_kernel_utils.h"
 #undef private
 #undef protected
+#include "../../../op_kernel_aicpu/cast_aicpu.h"
 
 using namespace std;
 using namespace aicpu;
@@ -295,4 +297,84 @@ TEST_F(TEST_CAST_UT, TestCast_DT_BFLOAT16_To_DT_HIFLOAT8) {
                                  0b11111111, 0b01111111, 0b00000000, 0b10000000, 0b01101111, 0b11101111};
   bool status = CompareBinResult(output, binary_expect, 12);
   EXPECT_EQ(status, true);
-}
\ No newline at end of file
+}
+namespace {
+// Cast every 16-bit pattern of T to S through the kernel. 2^16 elements is large enough to take the table path.
+template <typename T, typename S>
+void RunCast16Sweep(DataType src_type, DataType dst_type, vector<S> &output) {
+  vector<uint16_t> input(65536);
+  for (size_t i = 0; i < input.size(); i++) {
+    input[i] = static_cast<uint16_t>(i);
+  }
+  output.assign(input.size(), S());
+  vector<DataType> data_types = {src_type, dst_type};
+  vector<void *> datas = {(void *)input.data(), (void *)output.data()};
+  vector<vector<int64_t>> shapes = {{256, 256}, {256, 256}};
+  CREATE_NODEDEF(shapes, data_types, datas);
+  RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+}
+
+template <typename T>
+T FromBits(uint16_t bits) {
+  T value;
+  memcpy(static_cast<void *>(&value), &bits, sizeof(T));
+  return value;
+}
+
+template <typename S>
+bool SameBits(const S &lhs, const S &rhs) {
+  return memcmp(&lhs, &rhs, sizeof(S)) == 0;
+}
+}  // namespace
+
+TEST_F(TEST_CAST_UT, TestCast_DT_FLOAT16_Sweep_Bit_Exact) {
+  vector<int8_t> hif8_out;
+  RunCast16Sweep<Eigen::half, int8_t>(DT_FLOAT16, DT_HIFLOAT8, hif8_out);
+  vector<float> float_out;
+  RunCast16Sweep<Eigen::half, float>(DT_FLOAT16, DT_FLOAT, float_out);
+  vector<Eigen::bfloat16> bf16_out;
+  RunCast16Sweep<Eigen::half, Eigen::bfloat16>(DT_FLOAT16, DT_BFLOAT16, bf16_out);
+  int64_t mismatch = 0;
+  for (uint32_t i = 0; i < 65536; i++) {
+    Eigen::half x = FromBits<Eigen::half>(static_cast<uint16_t>(i));
+    mismatch += (hif8_out[i] != hif8_impl::Fp16ToHif8Rtne(x).val);
+    mismatch += !SameBits(float_out[i], static_cast<float>(x));
+    mismatch += !SameBits(bf16_out[i], static_cast<Eigen::bfloat16>(x));
+  }
+  EXPECT_EQ(mismatch, 0);
+}
+
+TEST_F(TEST_CAST_UT, TestCast_DT_BFLOAT16_Sweep_Bit_Exact) {
+  vector<int8_t> hif8_out;
+  RunCast16Sweep<Eigen::bfloat16, int8_t>(DT_BFLOAT16, DT_HIFLOAT8, hif8_out);
+  vector<Eigen::half> fp16_out;
+  RunCast16Sweep<Eigen::bfloat16, Eigen::half>(DT_BFLOAT16, DT_FLOAT16, fp16_out);
+  int64_t mismatch = 0;
+  for (uint32_t i = 0; i < 65536; i++) {
+    Eigen::bfloat16 x = FromBits<Eigen::bfloat16>(static_cast<uint16_t>(i));
+    mismatch += (hif8_out[i] != hif8_impl::Bf16ToHif8Rtne(x).val);
+    mismatch += !SameBits(fp16_out[i], static_cast<Eigen::half>(x));
+  }
+  EXPECT_EQ(mismatch, 0);
+}
+
+// Every fp32 exponent and leading-mantissa pattern, each with a full mantissa and a perturbed tail, against the
+// scalar HiF8 rounding.
+TEST_F(TEST_CAST_UT, TestCast_DT_FLOAT_To_DT_HIFLOAT8_Sweep_Bit_Exact) {
+  vector<float> input(2 * 65536);
+  for (uint32_t i = 0; i < 65536; i++) {
+    uint32_t bits[2] = {(i << 16) | 0xFFFFU, (i << 16) | ((i * 2654435761U) >> 16)};
+    memcpy(&input[2 * i], bits, sizeof(bits));
+  }
+  vector<int8_t> output(input.size(), 0);
+  vector<DataType> data_types = {DT_FLOAT, DT_HIFLOAT8};
+  vector<void *> datas = {(void *)input.data(), (void *)output.data()};
+  vector<vector<int64_t>> shapes = {{2, 65536}, {2, 65536}};
+  CREATE_NODEDEF(shapes, data_types, datas);
+  RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+  int64_t mismatch = 0;
+  for (size_t i = 0; i < input.size(); i++) {
+    mismatch += (output[i] != hif8_impl::Fp32ToHif8Rtne(input[i]).val);
+  }
+  EXPECT_EQ(mismatch, 0);
+}
@@ -58,4 +58,46 @@ TEST_F(CholeskyTiling, cholesky_test_tiling_case0)
     string expectTilingData = "6 3 4294967302 ";
     std::vector<size_t> expectWorkspaces = {16777216};
     ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
-}
\ No newline at end of file
+}
+
+TEST_F(CholeskyTiling, cholesky_test_tiling_lower)
+{
+    CholeskyCompileInfo compileInfo = {48};
+    gert::TilingContextPara tilingContextPara(
+        "Cholesky",
+        {
+            {{{2, 256, 256}, {2, 256, 256}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            {{{2, 256, 256}, {2, 256, 256}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+          gert::TilingContextPara::OpAttr("upper", Ops::Math::AnyValue::CreateFrom<bool>(false))
+        },
+        &compileInfo);
+    uint64_t expectTilingKey = 1;
+    string expectTilingData = "256 2 4294967552 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(CholeskyTiling, cholesky_test_tiling_column)
+{
+    CholeskyCompileInfo compileInfo = {48};
+    gert::TilingContextPara tilingContextPara(
+        "Cholesky",
+        {
+            {{{1, 8192, 8192}, {1, 8192, 8192}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            {{{1, 8192, 8192}, {1, 8192, 8192}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+          gert::TilingContextPara::OpAttr("upper", Ops::Math::AnyValue::CreateFrom<bool>(true))
+        },
+        &compileInfo);
+    uint64_t expectTilingKey = 2;
+    string expectTilingData = "8192 1 137438953728 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
@@ -50,6 +50,8 @@ TEST_F(cholesky_test, cholesky_kernel_test_1) {
     CholeskyTilingData *tilingData = reinterpret_cast<CholeskyTilingData*>(tiling);
     tilingData->matSizeN = 32;
     tilingData->matrixNumCount = 1;
+    tilingData->blockSize = 32;
+    tilingData->blockNum = 1;
 
     ICPU_SET_TILING_KEY(2);
     AscendC::SetKernelMode(KernelMode::AIV_MODE);
@@ -79,6 +81,8 @@ TEST_F(cholesky_test, cholesky_kernel_test_2) {
     CholeskyTilingData *tilingData = reinterpret_cast<CholeskyTilingData*>(tiling);
     tilingData->matSizeN = 32;
     tilingData->matrixNumCount = 2;
+    tilingData->blockSize = 32;
+    tilingData->blockNum = 1;
 
     ICPU_SET_TILING_KEY(1);
     AscendC::SetKernelMode(KernelMode::AIV_MODE);
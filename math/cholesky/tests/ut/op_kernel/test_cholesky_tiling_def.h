@@ -17,7 +17,9 @@
 #pragma pack(1)
 struct CholeskyTilingData {
     uint32_t matSizeN = 0;
-    uint32_t matrixNumCount = 0;
+    uint64_t matrixNumCount = 0;
+    uint32_t blockSize = 0;
+    uint32_t blockNum = 0;
 };
 #pragma pack()
 
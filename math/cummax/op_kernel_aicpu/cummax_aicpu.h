@@ -0,0 +1,30 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef AICPU_KERNELS_CUMMAX_H_
+#define AICPU_KERNELS_CUMMAX_H_
+
+#include "cpu_kernel.h"
+#include "aicpu/scan_engine.h"
+
+namespace aicpu {
+class CummaxCpuKernel : public CpuKernel {
+public:
+    CummaxCpuKernel() = default;
+    ~CummaxCpuKernel() override = default;
+    uint32_t Compute(CpuKernelContext& ctx) override;
+
+private:
+    uint32_t ParseParams(const CpuKernelContext& ctx, ScanLayout& layout) const;
+    template <typename T, typename Acc>
+    uint32_t CummaxCompute(const CpuKernelContext& ctx, const ScanLayout& layout) const;
+};
+} // namespace aicpu
+#endif // AICPU_KERNELS_CUMMAX_H_
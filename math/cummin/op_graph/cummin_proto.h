@@ -0,0 +1,49 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file cummin_proto.h
+ * \brief
+ */
+#ifndef OPS_OP_PROTO_INC_CUMMIN_OPS_H_
+#define OPS_OP_PROTO_INC_CUMMIN_OPS_H_
+
+#include "graph/operator.h"
+#include "graph/operator_reg.h"
+
+namespace ge {
+/**
+* @brief Computes the cumulative minimum of x along axis and the index of every running minimum. \n
+
+* @par Inputs:
+* x: A tensor. Must be one of the following types: float16, bfloat16, float32, double, int8, int16, int32,
+* int64, uint8. \n
+
+* @par Attributes:
+* axis: An optional int. The dimension to scan, in the range [-rank(x), rank(x)). Default: -1. \n
+
+* @par Outputs:
+* @li y: A tensor of the same type and shape as x.
+* @li argmin: A tensor of the same shape as x. Must be one of the following types: int32, int64.
+* A NaN is kept as the minimum once seen. Equal values move the index to the later element. \n
+
+* @par Third-party framework compatibility
+* Compatible with the Pytorch operator cummin.
+*/
+REG_OP(Cummin)
+    .INPUT(x, TensorType({DT_FLOAT16, DT_BF16, DT_FLOAT, DT_DOUBLE, DT_INT8, DT_INT16, DT_INT32, DT_INT64, DT_UINT8}))
+    .OUTPUT(y, TensorType({DT_FLOAT16, DT_BF16, DT_FLOAT, DT_DOUBLE, DT_INT8, DT_INT16, DT_INT32, DT_INT64, DT_UINT8}))
+    .OUTPUT(argmin, TensorType({DT_INT32, DT_INT64}))
+    .ATTR(axis, Int, -1)
+    .OP_END_FACTORY_REG(Cummin)
+
+} // namespace ge
+
+#endif // OPS_OP_PROTO_INC_CUMMIN_OPS_H_
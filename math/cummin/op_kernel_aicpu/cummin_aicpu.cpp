@@ -0,0 +1,115 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "cummin_aicpu.h"
+
+#include <vector>
+
+#include "cpu_kernel_utils.h"
+#include "utils/eigen_tensor.h"
+#include "utils/kernel_util.h"
+
+namespace {
+const char* const kCummin = "Cummin";
+const char* const kCumminAxisAttr = "axis";
+} // namespace
+
+namespace aicpu {
+uint32_t CumminCpuKernel::Compute(CpuKernelContext& ctx)
+{
+    ScanLayout layout;
+    KERNEL_HANDLE_ERROR(ParseParams(ctx, layout), "[%s] check params failed.", kCummin);
+    auto data_type = ctx.Input(kFirstInputIndex)->GetDataType();
+    switch (data_type) {
+        case DT_INT8:
+            return CumminCompute<int8_t, int8_t>(ctx, layout);
+        case DT_INT16:
+            return CumminCompute<int16_t, int16_t>(ctx, layout);
+        case DT_INT32:
+            return CumminCompute<int32_t, int32_t>(ctx, layout);
+        case DT_INT64:
+            return CumminCompute<int64_t, int64_t>(ctx, layout);
+        case DT_UINT8:
+            return CumminCompute<uint8_t, uint8_t>(ctx, layout);
+        case DT_FLOAT16:
+            return CumminCompute<Eigen::half, float>(ctx, layout);
+        case DT_BFLOAT16:
+            return CumminCompute<Eigen::bfloat16, float>(ctx, layout);
+        case DT_FLOAT:
+            return CumminCompute<float, float>(ctx, layout);
+        case DT_DOUBLE:
+            return CumminCompute<double, double>(ctx, layout);
+        default:
+            KERNEL_LOG_ERROR("[%s] invalid input type [%s]", kCummin, DTypeStr(data_type).c_str());
+            return KERNEL_STATUS_PARAM_INVALID;
+    }
+}
+
+uint32_t CumminCpuKernel::ParseParams(const CpuKernelContext& ctx, ScanLayout& layout) const
+{
+    Tensor* input = ctx.Input(kFirstInputIndex);
+    Tensor* values = ctx.Output(kFirstOutputIndex);
+    Tensor* indices = ctx.Output(kSecondOutputIndex);
+    KERNEL_CHECK_NULLPTR(input, KERNEL_STATUS_PARAM_INVALID, "[%s] get input x failed.", kCummin)
+    KERNEL_CHECK_NULLPTR(values, KERNEL_STATUS_PARAM_INVALID, "[%s] get output y failed.", kCummin)
+    KERNEL_CHECK_NULLPTR(indices, KERNEL_STATUS_PARAM_INVALID, "[%s] get output argmin failed.", kCummin)
+    KERNEL_CHECK_NULLPTR(input->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] get input data failed.", kCummin)
+    KERNEL_CHECK_NULLPTR(values->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] get output y data failed.", kCummin)
+    KERNEL_CHECK_NULLPTR(indices->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] get output argmin data failed.",
+                         kCummin)
+    KERNEL_CHECK_FALSE(values->GetDataType() == input->GetDataType(), KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] output y type [%s] should be the same as input type [%s].", kCummin,
+                       DTypeStr(values->GetDataType()).c_str(), DTypeStr(input->GetDataType()).c_str());
+    KERNEL_CHECK_FALSE(indices->GetDataType() == DT_INT32 || indices->GetDataType() == DT_INT64,
+                       KERNEL_STATUS_PARAM_INVALID, "[%s] output argmin type [%s] should be int32 or int64.", kCummin,
+                       DTypeStr(indices->GetDataType()).c_str());
+
+    std::vector<int64_t> dims = input->GetTensorShape()->GetDimSizes();
+    KERNEL_CHECK_FALSE(values->GetTensorShape()->GetDimSizes() == dims &&
+                           indices->GetTensorShape()->GetDimSizes() == dims,
+                       KERNEL_STATUS_PARAM_INVALID, "[%s] output shapes should be the same as input shape.", kCummin);
+    AttrValue* axis_attr = ctx.GetAttr(kCumminAxisAttr);
+    int64_t axis = (axis_attr == nullptr) ? -1 : axis_attr->GetInt();
+    // A scalar is scanned as a single element line.
+    const int64_t rank = static_cast<int64_t>(dims.size());
+    const int64_t axis_rank = std::max<int64_t>(rank, 1);
+    KERNEL_CHECK_FALSE(axis >= -axis_rank && axis < axis_rank, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] axis [%ld] out of range [%ld, %ld).", kCummin, axis, -axis_rank, axis_rank);
+    if (axis < 0) {
+        axis += axis_rank;
+    }
+    for (int64_t i = 0; i < rank; i++) {
+        if (i < axis) {
+            layout.inner *= dims[i];
+        } else if (i > axis) {
+            layout.outer *= dims[i];
+        } else {
+            layout.depth = dims[i];
+        }
+    }
+    return KERNEL_STATUS_OK;
+}
+
+template <typename T, typename Acc>
+uint32_t CumminCpuKernel::CumminCompute(const CpuKernelContext& ctx, const ScanLayout& layout) const
+{
+    const T* input = reinterpret_cast<const T*>(ctx.Input(kFirstInputIndex)->GetData());
+    T* values = reinterpret_cast<T*>(ctx.Output(kFirstOutputIndex)->GetData());
+    Tensor* indices = ctx.Output(kSecondOutputIndex);
+    if (indices->GetDataType() == DT_INT32) {
+        ScanExtremumOp<T, Acc, int32_t, false> op{input, values, reinterpret_cast<int32_t*>(indices->GetData())};
+        return ScanCompute(ctx, op, layout, kCummin);
+    }
+    ScanExtremumOp<T, Acc, int64_t, false> op{input, values, reinterpret_cast<int64_t*>(indices->GetData())};
+    return ScanCompute(ctx, op, layout, kCummin);
+}
+
+REGISTER_CPU_KERNEL(kCummin, CumminCpuKernel);
+} // namespace aicpu
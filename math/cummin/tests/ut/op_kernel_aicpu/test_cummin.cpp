@@ -0,0 +1,196 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "utils/aicpu_test_utils.h"
+#include "cpu_kernel_utils.h"
+#include "node_def_builder.h"
+
+using namespace std;
+using namespace aicpu;
+
+class TEST_CUMMIN_UT : public testing::Test {};
+
+#define CREATE_NODEDEF(shapes, data_types, datas, axis)          \
+    auto node_def = CpuKernelUtils::CreateNodeDef();            \
+    NodeDefBuilder(node_def.get(), "Cummin", "Cummin")          \
+        .Input({"x", data_types[0], shapes[0], datas[0]})       \
+        .Output({"y", data_types[1], shapes[1], datas[1]})      \
+        .Output({"argmin", data_types[2], shapes[2], datas[2]}) \
+        .Attr("axis", (int64_t)(axis))
+
+namespace {
+// Serial reference: NaN sticks once seen, equal values move the index forward.
+template <typename T, typename Idx>
+void ReferenceCummin(const vector<T>& x, int64_t inner, int64_t depth, int64_t outer, vector<T>& y,
+                     vector<Idx>& indices)
+{
+    for (int64_t i = 0; i < inner; i++) {
+        for (int64_t o = 0; o < outer; o++) {
+            T best = x[i * depth * outer + o];
+            int64_t best_idx = 0;
+            for (int64_t d = 0; d < depth; d++) {
+                int64_t idx = (i * depth + d) * outer + o;
+                bool best_nan = (best != best);
+                if (x[idx] != x[idx] || (!best_nan && x[idx] <= best)) {
+                    best = x[idx];
+                    best_idx = d;
+                }
+                y[idx] = best;
+                indices[idx] = static_cast<Idx>(best_idx);
+            }
+        }
+    }
+}
+} // namespace
+
+TEST_F(TEST_CUMMIN_UT, FLOAT_TIES_AND_NAN_SUCC)
+{
+    const float nan = numeric_limits<float>::quiet_NaN();
+    vector<float> x = {1.0f, 3.0f, 3.0f, 2.0f, nan, 5.0f, nan, 0.0f};
+    vector<float> y(8, 0);
+    vector<int64_t> indices(8, -1);
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_INT64};
+    vector<vector<int64_t>> shapes = {{8}, {8}, {8}};
+    vector<void*> datas = {(void*)x.data(), (void*)y.data(), (void*)indices.data()};
+    CREATE_NODEDEF(shapes, data_types, datas, 0);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    vector<int64_t> expect_indices = {0, 0, 0, 0, 4, 4, 6, 6};
+    EXPECT_EQ(indices, expect_indices);
+    EXPECT_EQ(y[3], 1.0f);
+    EXPECT_TRUE(std::isnan(y[4]) && std::isnan(y[5]) && std::isnan(y[7]));
+}
+
+TEST_F(TEST_CUMMIN_UT, INT32_AXIS0_INT32_ARGMIN_SUCC)
+{
+    vector<int32_t> x = {4, 1, 2, 3, 1, 5};
+    vector<int32_t> y(6, 0);
+    vector<int32_t> indices(6, -1);
+    vector<DataType> data_types = {DT_INT32, DT_INT32, DT_INT32};
+    vector<vector<int64_t>> shapes = {{2, 3}, {2, 3}, {2, 3}};
+    vector<void*> datas = {(void*)x.data(), (void*)y.data(), (void*)indices.data()};
+    CREATE_NODEDEF(shapes, data_types, datas, -2);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    vector<int32_t> expect_y = {4, 1, 2, 3, 1, 2};
+    vector<int32_t> expect_indices = {0, 0, 0, 1, 1, 0};
+    EXPECT_EQ(y, expect_y);
+    EXPECT_EQ(indices, expect_indices);
+}
+
+TEST_F(TEST_CUMMIN_UT, DEFAULT_AXIS_SUCC)
+{
+    vector<int64_t> x = {3, 1, 2, 0, 5, 0};
+    vector<int64_t> y(6, 0);
+    vector<int64_t> indices(6, -1);
+    auto node_def = CpuKernelUtils::CreateNodeDef();
+    NodeDefBuilder(node_def.get(), "Cummin", "Cummin")
+        .Input({"x", DT_INT64, {2, 3}, (void*)x.data()})
+        .Output({"y", DT_INT64, {2, 3}, (void*)y.data()})
+        .Output({"argmin", DT_INT64, {2, 3}, (void*)indices.data()});
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    vector<int64_t> expect_y = {3, 1, 1, 0, 0, 0};
+    vector<int64_t> expect_indices = {0, 1, 1, 0, 0, 2};
+    EXPECT_EQ(y, expect_y);
+    EXPECT_EQ(indices, expect_indices);
+}
+
+TEST_F(TEST_CUMMIN_UT, LONG_1D_DEPTH_CHUNKED_SUCC)
+{
+    const int64_t num = 1024 * 1024 + 11;
+    vector<int32_t> x(num);
+    SetRandomValue<int32_t>(x.data(), num, 0, 1000000);
+    vector<int32_t> y(num, 0);
+    vector<int64_t> indices(num, -1);
+    vector<DataType> data_types = {DT_INT32, DT_INT32, DT_INT64};
+    vector<vector<int64_t>> shapes = {{num}, {num}, {num}};
+    vector<void*> datas = {(void*)x.data(), (void*)y.data(), (void*)indices.data()};
+    CREATE_NODEDEF(shapes, data_types, datas, 0);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    vector<int32_t> expect_y(num);
+    vector<int64_t> expect_indices(num);
+    ReferenceCummin(x, 1, num, 1, expect_y, expect_indices);
+    EXPECT_EQ(y, expect_y);
+    EXPECT_EQ(indices, expect_indices);
+}
+
+TEST_F(TEST_CUMMIN_UT, FLOAT_NAN_ACROSS_CHUNKS_SUCC)
+{
+    // Small values with repeats so ties and a NaN land in different chunks.
+    const int64_t num = 512 * 1024;
+    vector<float> x(num);
+    for (int64_t i = 0; i < num; i++) {
+        x[i] = static_cast<float>((i * 7919) % 13);
+    }
+    x[300000] = numeric_limits<float>::quiet_NaN();
+    vector<float> y(num, 0);
+    vector<int32_t> indices(num, -1);
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_INT32};
+    vector<vector<int64_t>> shapes = {{num}, {num}, {num}};
+    vector<void*> datas = {(void*)x.data(), (void*)y.data(), (void*)indices.data()};
+    CREATE_NODEDEF(shapes, data_types, datas, -1);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    vector<float> expect_y(num);
+    vector<int32_t> expect_indices(num);
+    ReferenceCummin(x, 1, num, 1, expect_y, expect_indices);
+    EXPECT_EQ(indices, expect_indices);
+    EXPECT_EQ(y[299999], expect_y[299999]);
+    EXPECT_TRUE(std::isnan(y[num - 1]));
+}
+
+TEST_F(TEST_CUMMIN_UT, FLOAT16_MANY_LINES_PARALLEL_SUCC)
+{
+    const int64_t inner = 32;
+    const int64_t depth = 100;
+    const int64_t outer = 129;
+    const int64_t num = inner * depth * outer;
+    vector<Eigen::half> x(num);
+    SetRandomValue<Eigen::half>(x.data(), num, -10.0, 10.0);
+    vector<Eigen::half> y(num);
+    vector<int64_t> indices(num, -1);
+    vector<DataType> data_types = {DT_FLOAT16, DT_FLOAT16, DT_INT64};
+    vector<vector<int64_t>> shapes = {{inner, depth, outer}, {inner, depth, outer}, {inner, depth, outer}};
+    vector<void*> datas = {(void*)x.data(), (void*)y.data(), (void*)indices.data()};
+    CREATE_NODEDEF(shapes, data_types, datas, 1);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    vector<Eigen::half> expect_y(num);
+    vector<int64_t> expect_indices(num);
+    ReferenceCummin(x, inner, depth, outer, expect_y, expect_indices);
+    EXPECT_EQ(indices, expect_indices);
+    for (int64_t i = 0; i < num; i++) {
+        ASSERT_EQ(static_cast<float>(y[i]), static_cast<float>(expect_y[i]));
+    }
+}
+
+TEST_F(TEST_CUMMIN_UT, ARGMIN_TYPE_FAILED)
+{
+    vector<float> x(4, 1.0f);
+    vector<float> y(4, 0);
+    vector<float> indices(4, 0);
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{4}, {4}, {4}};
+    vector<void*> datas = {(void*)x.data(), (void*)y.data(), (void*)indices.data()};
+    CREATE_NODEDEF(shapes, data_types, datas, 0);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
+}
+
+TEST_F(TEST_CUMMIN_UT, AXIS_OUT_OF_RANGE_FAILED)
+{
+    vector<float> x(4, 1.0f);
+    vector<float> y(4, 0);
+    vector<int64_t> indices(4, 0);
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_INT64};
+    vector<vector<int64_t>> shapes = {{2, 2}, {2, 2}, {2, 2}};
+    vector<void*> datas = {(void*)x.data(), (void*)y.data(), (void*)indices.data()};
+    CREATE_NODEDEF(shapes, data_types, datas, 2);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
+}
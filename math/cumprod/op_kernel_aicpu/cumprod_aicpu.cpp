@@ -0,0 +1,129 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "cumprod_aicpu.h"
+
+#include <complex>
+#include <vector>
+
+#include "cpu_kernel_utils.h"
+#include "utils/eigen_tensor.h"
+#include "utils/kernel_util.h"
+
+namespace {
+const char* const kCumprod = "Cumprod";
+} // namespace
+
+namespace aicpu {
+uint32_t CumprodCpuKernel::Compute(CpuKernelContext& ctx)
+{
+    ScanLayout layout;
+    KERNEL_HANDLE_ERROR(ParseParams(ctx, layout), "[%s] check params failed.", kCumprod);
+    auto data_type = ctx.Input(kFirstInputIndex)->GetDataType();
+    switch (data_type) {
+        case DT_INT8:
+            return CumprodCompute<int8_t, int8_t>(ctx, layout);
+        case DT_INT16:
+            return CumprodCompute<int16_t, int16_t>(ctx, layout);
+        case DT_INT32:
+            return CumprodCompute<int32_t, int32_t>(ctx, layout);
+        case DT_INT64:
+            return CumprodCompute<int64_t, int64_t>(ctx, layout);
+        case DT_UINT8:
+            return CumprodCompute<uint8_t, uint8_t>(ctx, layout);
+        case DT_UINT16:
+            return CumprodCompute<uint16_t, uint16_t>(ctx, layout);
+        case DT_UINT32:
+            return CumprodCompute<uint32_t, uint32_t>(ctx, layout);
+        case DT_UINT64:
+            return CumprodCompute<uint64_t, uint64_t>(ctx, layout);
+        case DT_FLOAT16:
+            return CumprodCompute<Eigen::half, float>(ctx, layout);
+        case DT_BFLOAT16:
+            return CumprodCompute<Eigen::bfloat16, float>(ctx, layout);
+        case DT_FLOAT:
+            return CumprodCompute<float, float>(ctx, layout);
+        case DT_DOUBLE:
+            return CumprodCompute<double, double>(ctx, layout);
+        case DT_COMPLEX64:
+            return CumprodCompute<std::complex<float>, std::complex<float>>(ctx, layout);
+        case DT_COMPLEX128:
+            return CumprodCompute<std::complex<double>, std::complex<double>>(ctx, layout);
+        default:
+            KERNEL_LOG_ERROR("[%s] invalid input type [%s]", kCumprod, DTypeStr(data_type).c_str());
+            return KERNEL_STATUS_PARAM_INVALID;
+    }
+}
+
+uint32_t CumprodCpuKernel::ParseParams(const CpuKernelContext& ctx, ScanLayout& layout) const
+{
+    Tensor* input = ctx.Input(kFirstInputIndex);
+    Tensor* axis = ctx.Input(kSecondInputIndex);
+    Tensor* output = ctx.Output(kFirstOutputIndex);
+    KERNEL_CHECK_NULLPTR(input, KERNEL_STATUS_PARAM_INVALID, "[%s] get input x failed.", kCumprod)
+    KERNEL_CHECK_NULLPTR(axis, KERNEL_STATUS_PARAM_INVALID, "[%s] get input axis failed.", kCumprod)
+    KERNEL_CHECK_NULLPTR(output, KERNEL_STATUS_PARAM_INVALID, "[%s] get output y failed.", kCumprod)
+    KERNEL_CHECK_NULLPTR(input->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] get input data failed.", kCumprod)
+    KERNEL_CHECK_NULLPTR(output->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] get output data failed.", kCumprod)
+    KERNEL_CHECK_NULLPTR(axis->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] get axis data failed.", kCumprod)
+    KERNEL_CHECK_FALSE(output->GetDataType() == input->GetDataType(), KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] output type [%s] should be the same as input type [%s].", kCumprod,
+                       DTypeStr(output->GetDataType()).c_str(), DTypeStr(input->GetDataType()).c_str());
+    KERNEL_CHECK_FALSE(axis->NumElements() == 1, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] axis should hold one value, got [%ld].", kCumprod, axis->NumElements());
+
+    std::vector<int64_t> dims = input->GetTensorShape()->GetDimSizes();
+    KERNEL_CHECK_FALSE(output->GetTensorShape()->GetDimSizes() == dims, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] output shape should be the same as input shape.", kCumprod);
+    int64_t axis_value = 0;
+    if (axis->GetDataType() == DT_INT32) {
+        axis_value = *reinterpret_cast<const int32_t*>(axis->GetData());
+    } else if (axis->GetDataType() == DT_INT64) {
+        axis_value = *reinterpret_cast<const int64_t*>(axis->GetData());
+    } else {
+        KERNEL_LOG_ERROR("[%s] axis type [%s] should be int32 or int64.", kCumprod,
+                         DTypeStr(axis->GetDataType()).c_str());
+        return KERNEL_STATUS_PARAM_INVALID;
+    }
+    // A scalar is scanned as a single element line.
+    const int64_t rank = static_cast<int64_t>(dims.size());
+    const int64_t axis_rank = std::max<int64_t>(rank, 1);
+    KERNEL_CHECK_FALSE(axis_value >= -axis_rank && axis_value < axis_rank, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] axis [%ld] out of range [%ld, %ld).", kCumprod, axis_value, -axis_rank, axis_rank);
+    if (axis_value < 0) {
+        axis_value += axis_rank;
+    }
+    for (int64_t i = 0; i < rank; i++) {
+        if (i < axis_value) {
+            layout.inner *= dims[i];
+        } else if (i > axis_value) {
+            layout.outer *= dims[i];
+        } else {
+            layout.depth = dims[i];
+        }
+    }
+    AttrValue* exclusive = ctx.GetAttr("exclusive");
+    AttrValue* reverse = ctx.GetAttr("reverse");
+    layout.exclusive = (exclusive == nullptr) ? false : exclusive->GetBool();
+    layout.reverse = (reverse == nullptr) ? false : reverse->GetBool();
+    return KERNEL_STATUS_OK;
+}
+
+// float16/bfloat16 accumulate in float, other types in their own type.
+template <typename T, typename Acc>
+uint32_t CumprodCpuKernel::CumprodCompute(const CpuKernelContext& ctx, const ScanLayout& layout) const
+{
+    ScanProdOp<T, Acc> op{reinterpret_cast<const T*>(ctx.Input(kFirstInputIndex)->GetData()),
+                          reinterpret_cast<T*>(ctx.Output(kFirstOutputIndex)->GetData())};
+    return ScanCompute(ctx, op, layout, kCumprod);
+}
+
+REGISTER_CPU_KERNEL(kCumprod, CumprodCpuKernel);
+} // namespace aicpu
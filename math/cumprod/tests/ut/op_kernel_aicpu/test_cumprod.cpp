@@ -0,0 +1,176 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <cmath>
+#include <complex>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "utils/aicpu_test_utils.h"
+#include "cpu_kernel_utils.h"
+#include "node_def_builder.h"
+
+using namespace std;
+using namespace aicpu;
+
+class TEST_CUMPROD_UT : public testing::Test {};
+
+#define CREATE_NODEDEF(shapes, data_types, datas, exclusive, reverse)   \
+    auto node_def = CpuKernelUtils::CreateNodeDef();                    \
+    NodeDefBuilder(node_def.get(), "Cumprod", "Cumprod")                \
+        .Input({"x", data_types[0], shapes[0], datas[0]})               \
+        .Input({"axis", data_types[1], shapes[1], datas[1]})            \
+        .Output({"y", data_types[2], shapes[2], datas[2]})              \
+        .Attr("exclusive", exclusive)                                   \
+        .Attr("reverse", reverse)
+
+namespace {
+// Serial reference of a cumulative product over dims split as inner x depth x outer.
+template <typename T>
+vector<T> ReferenceCumprod(const vector<T>& x, int64_t inner, int64_t depth, int64_t outer, bool exclusive,
+                           bool reverse)
+{
+    vector<T> y(x.size());
+    for (int64_t i = 0; i < inner; i++) {
+        for (int64_t o = 0; o < outer; o++) {
+            T acc = static_cast<T>(1);
+            for (int64_t p = 0; p < depth; p++) {
+                int64_t d = reverse ? depth - 1 - p : p;
+                int64_t idx = (i * depth + d) * outer + o;
+                if (exclusive) {
+                    y[idx] = acc;
+                    acc = acc * x[idx];
+                } else {
+                    acc = acc * x[idx];
+                    y[idx] = acc;
+                }
+            }
+        }
+    }
+    return y;
+}
+} // namespace
+
+TEST_F(TEST_CUMPROD_UT, INT32_AXIS1_SUCC)
+{
+    vector<int32_t> x = {1, 2, 3, 4, -1, 2, -3, 1, 0, 5, 6, 7};
+    int32_t axis = 1;
+    vector<int32_t> y(12, 0);
+    vector<DataType> data_types = {DT_INT32, DT_INT32, DT_INT32};
+    vector<vector<int64_t>> shapes = {{3, 4}, {}, {3, 4}};
+    vector<void*> datas = {(void*)x.data(), (void*)&axis, (void*)y.data()};
+    CREATE_NODEDEF(shapes, data_types, datas, false, false);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    vector<int32_t> expect = {1, 2, 6, 24, -1, -2, 6, 6, 0, 0, 0, 0};
+    EXPECT_EQ(y, expect);
+}
+
+TEST_F(TEST_CUMPROD_UT, FLOAT_AXIS0_EXCLUSIVE_REVERSE_SUCC)
+{
+    vector<float> x = {1.5f, 2.0f, -1.0f, 0.5f, 3.0f, 4.0f};
+    int64_t axis = -2;
+    vector<float> y(6, 0);
+    vector<DataType> data_types = {DT_FLOAT, DT_INT64, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{3, 2}, {1}, {3, 2}};
+    vector<void*> datas = {(void*)x.data(), (void*)&axis, (void*)y.data()};
+    CREATE_NODEDEF(shapes, data_types, datas, true, true);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    vector<float> expect = {-3.0f, 2.0f, 3.0f, 4.0f, 1.0f, 1.0f};
+    EXPECT_EQ(y, expect);
+}
+
+TEST_F(TEST_CUMPROD_UT, COMPLEX64_SUCC)
+{
+    vector<complex<float>> x = {{0, 1}, {0, 1}, {2, 0}, {1, 1}};
+    int32_t axis = 0;
+    vector<complex<float>> y(4);
+    vector<DataType> data_types = {DT_COMPLEX64, DT_INT32, DT_COMPLEX64};
+    vector<vector<int64_t>> shapes = {{4}, {}, {4}};
+    vector<void*> datas = {(void*)x.data(), (void*)&axis, (void*)y.data()};
+    CREATE_NODEDEF(shapes, data_types, datas, false, false);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    vector<complex<float>> expect = {{0, 1}, {-1, 0}, {-2, 0}, {-2, -2}};
+    EXPECT_EQ(y, expect);
+}
+
+TEST_F(TEST_CUMPROD_UT, FLOAT16_FLOAT_ACCUMULATE_SUCC)
+{
+    // 1.001^2048 ~= 7.76; stepping in half rounds every factor back to 1.
+    const int64_t num = 2048;
+    vector<Eigen::half> x(num, Eigen::half(1.001f));
+    int32_t axis = 0;
+    vector<Eigen::half> y(num);
+    vector<DataType> data_types = {DT_FLOAT16, DT_INT32, DT_FLOAT16};
+    vector<vector<int64_t>> shapes = {{num}, {}, {num}};
+    vector<void*> datas = {(void*)x.data(), (void*)&axis, (void*)y.data()};
+    CREATE_NODEDEF(shapes, data_types, datas, false, false);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    const double expect = pow(static_cast<double>(static_cast<float>(x[0])), num);
+    EXPECT_NEAR(static_cast<float>(y[num - 1]), expect, expect * 1e-2);
+}
+
+TEST_F(TEST_CUMPROD_UT, LONG_1D_DEPTH_CHUNKED_SUCC)
+{
+    // Alternating signs keep the product bounded, so every chunk carry matters.
+    const int64_t num = 1024 * 1024 + 5;
+    vector<int64_t> x(num);
+    for (int64_t i = 0; i < num; i++) {
+        x[i] = (i % 3 == 0) ? -1 : 1;
+    }
+    int64_t axis = 0;
+    vector<int64_t> y(num, 0);
+    vector<DataType> data_types = {DT_INT64, DT_INT64, DT_INT64};
+    vector<vector<int64_t>> shapes = {{num}, {1}, {num}};
+    vector<void*> datas = {(void*)x.data(), (void*)&axis, (void*)y.data()};
+    CREATE_NODEDEF(shapes, data_types, datas, true, true);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    EXPECT_EQ(y, ReferenceCumprod(x, 1, num, 1, true, true));
+}
+
+TEST_F(TEST_CUMPROD_UT, DOUBLE_MANY_LINES_PARALLEL_SUCC)
+{
+    const int64_t inner = 64;
+    const int64_t depth = 128;
+    const int64_t outer = 33;
+    const int64_t num = inner * depth * outer;
+    vector<double> x(num);
+    SetRandomValue<double>(x.data(), num, 0.9, 1.1);
+    int32_t axis = 1;
+    vector<double> y(num, 0);
+    vector<DataType> data_types = {DT_DOUBLE, DT_INT32, DT_DOUBLE};
+    vector<vector<int64_t>> shapes = {{inner, depth, outer}, {}, {inner, depth, outer}};
+    vector<void*> datas = {(void*)x.data(), (void*)&axis, (void*)y.data()};
+    CREATE_NODEDEF(shapes, data_types, datas, false, false);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    EXPECT_EQ(y, ReferenceCumprod(x, inner, depth, outer, false, false));
+}
+
+TEST_F(TEST_CUMPROD_UT, AXIS_OUT_OF_RANGE_FAILED)
+{
+    vector<float> x(6, 1.0f);
+    int32_t axis = 2;
+    vector<float> y(6, 0);
+    vector<DataType> data_types = {DT_FLOAT, DT_INT32, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{3, 2}, {}, {3, 2}};
+    vector<void*> datas = {(void*)x.data(), (void*)&axis, (void*)y.data()};
+    CREATE_NODEDEF(shapes, data_types, datas, false, false);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
+}
+
+TEST_F(TEST_CUMPROD_UT, BOOL_UNSUPPORTED_FAILED)
+{
+    bool x[4] = {true, false, true, true};
+    int32_t axis = 0;
+    bool y[4] = {false};
+    vector<DataType> data_types = {DT_BOOL, DT_INT32, DT_BOOL};
+    vector<vector<int64_t>> shapes = {{4}, {}, {4}};
+    vector<void*> datas = {(void*)x, (void*)&axis, (void*)y};
+    CREATE_NODEDEF(shapes, data_types, datas, false, false);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
+}
@@ -25,7 +25,7 @@ private:
 
     void CumsumGetAttr(const CpuKernelContext& ctx, bool& exclusive, bool& reverse) const;
 
-    template <typename T>
+    template <typename T, typename Acc>
     uint32_t CumsumCompute(CpuKernelContext& ctx) const;
 
     void AxesCal(
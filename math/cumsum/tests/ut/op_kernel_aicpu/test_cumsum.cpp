@@ -57,7 +57,7 @@ static const Eigen::half kCumsumOutputF16_ET_RT[60] = {
     static_cast<Eigen::half>(112.7f),   static_cast<Eigen::half>(104.7f),  static_cast<Eigen::half>(101.25f),
     static_cast<Eigen::half>(59.22f),   static_cast<Eigen::half>(0.0f),    static_cast<Eigen::half>(-76.5f),
     static_cast<Eigen::half>(-30.06f),  static_cast<Eigen::half>(58.44f),  static_cast<Eigen::half>(86.0f),
-    static_cast<Eigen::half>(0.0f),     static_cast<Eigen::half>(-14.31f), static_cast<Eigen::half>(-104.75f),
+    static_cast<Eigen::half>(0.0f),     static_cast<Eigen::half>(-14.28f), static_cast<Eigen::half>(-104.75f),
     static_cast<Eigen::half>(-9.22f),   static_cast<Eigen::half>(-49.78f), static_cast<Eigen::half>(0.0f),
     static_cast<Eigen::half>(-36.25f),  static_cast<Eigen::half>(-53.12f), static_cast<Eigen::half>(-128.5f),
     static_cast<Eigen::half>(-66.2f),   static_cast<Eigen::half>(0.0f),    static_cast<Eigen::half>(-221.4f),
@@ -66,8 +66,8 @@ static const Eigen::half kCumsumOutputF16_ET_RT[60] = {
     static_cast<Eigen::half>(18.8f),    static_cast<Eigen::half>(-23.92f), static_cast<Eigen::half>(0.0f),
     static_cast<Eigen::half>(37.28f),   static_cast<Eigen::half>(38.03f),  static_cast<Eigen::half>(-29.22f),
     static_cast<Eigen::half>(61.47f),   static_cast<Eigen::half>(0.0f),    static_cast<Eigen::half>(-48.6f),
-    static_cast<Eigen::half>(-10.875f), static_cast<Eigen::half>(79.4f),   static_cast<Eigen::half>(96.1f),
-    static_cast<Eigen::half>(0.0f),     static_cast<Eigen::half>(29.53f),  static_cast<Eigen::half>(13.56f),
+    static_cast<Eigen::half>(-10.86f), static_cast<Eigen::half>(79.4f),   static_cast<Eigen::half>(96.1f),
+    static_cast<Eigen::half>(0.0f),     static_cast<Eigen::half>(29.5f),  static_cast<Eigen::half>(13.54f),
     static_cast<Eigen::half>(101.3f),   static_cast<Eigen::half>(7.164f),  static_cast<Eigen::half>(0.0f),
 };
 
@@ -84,11 +84,11 @@ static const Eigen::half kCumsumOutputF16_EF_RF[60] = {
     static_cast<Eigen::half>(24.06f),   static_cast<Eigen::half>(64.6f),   static_cast<Eigen::half>(14.84f),
     static_cast<Eigen::half>(-93.3f),   static_cast<Eigen::half>(-76.44f), static_cast<Eigen::half>(-1.0625f),
     static_cast<Eigen::half>(-63.4f),   static_cast<Eigen::half>(-129.6f), static_cast<Eigen::half>(83.44f),
-    static_cast<Eigen::half>(112.6f),   static_cast<Eigen::half>(13.94f),  static_cast<Eigen::half>(-61.62f),
+    static_cast<Eigen::half>(112.6f),   static_cast<Eigen::half>(13.91f),  static_cast<Eigen::half>(-61.62f),
     static_cast<Eigen::half>(-137.9f),  static_cast<Eigen::half>(49.66f),  static_cast<Eigen::half>(17.38f),
     static_cast<Eigen::half>(-63.62f),  static_cast<Eigen::half>(-20.9f),  static_cast<Eigen::half>(-44.8f),
     static_cast<Eigen::half>(71.06f),   static_cast<Eigen::half>(70.3f),   static_cast<Eigen::half>(137.5f),
-    static_cast<Eigen::half>(46.8f),    static_cast<Eigen::half>(108.25f), static_cast<Eigen::half>(-30.89f),
+    static_cast<Eigen::half>(46.88f),    static_cast<Eigen::half>(108.25f), static_cast<Eigen::half>(-30.89f),
     static_cast<Eigen::half>(-68.6f),   static_cast<Eigen::half>(-158.9f), static_cast<Eigen::half>(-175.6f),
     static_cast<Eigen::half>(-79.5f),   static_cast<Eigen::half>(-64.4f),  static_cast<Eigen::half>(-48.4f),
     static_cast<Eigen::half>(-136.1f),  static_cast<Eigen::half>(-42.0f),  static_cast<Eigen::half>(-34.84f)};
@@ -106,11 +106,11 @@ static const Eigen::half kCumsumOutputF16_ET_RF[60] = {
     static_cast<Eigen::half>(119.56f),  static_cast<Eigen::half>(24.06f),  static_cast<Eigen::half>(64.6f),
     static_cast<Eigen::half>(0.0f),     static_cast<Eigen::half>(-93.3f),  static_cast<Eigen::half>(-76.44f),
     static_cast<Eigen::half>(-1.0625f), static_cast<Eigen::half>(-63.4f),  static_cast<Eigen::half>(0.0f),
-    static_cast<Eigen::half>(83.44f),   static_cast<Eigen::half>(112.6f),  static_cast<Eigen::half>(13.94f),
+    static_cast<Eigen::half>(83.44f),   static_cast<Eigen::half>(112.6f),  static_cast<Eigen::half>(13.91f),
     static_cast<Eigen::half>(-61.62f),  static_cast<Eigen::half>(0.0f),    static_cast<Eigen::half>(49.66f),
     static_cast<Eigen::half>(17.38f),   static_cast<Eigen::half>(-63.62f), static_cast<Eigen::half>(-20.9f),
     static_cast<Eigen::half>(0.0f),     static_cast<Eigen::half>(71.06f),  static_cast<Eigen::half>(70.3f),
-    static_cast<Eigen::half>(137.5f),   static_cast<Eigen::half>(46.8f),   static_cast<Eigen::half>(0.0f),
+    static_cast<Eigen::half>(137.5f),   static_cast<Eigen::half>(46.88f),   static_cast<Eigen::half>(0.0f),
     static_cast<Eigen::half>(-30.89f),  static_cast<Eigen::half>(-68.6f),  static_cast<Eigen::half>(-158.9f),
     static_cast<Eigen::half>(-175.6f),  static_cast<Eigen::half>(0.0f),    static_cast<Eigen::half>(-64.4f),
     static_cast<Eigen::half>(-48.4f),   static_cast<Eigen::half>(-136.1f), static_cast<Eigen::half>(-42.0f)};
@@ -124,7 +124,7 @@ static const Eigen::half kCumsumOutputF16_EF_RT[60] = {
     static_cast<Eigen::half>(193.0f),   static_cast<Eigen::half>(112.7f),   static_cast<Eigen::half>(104.7f),
     static_cast<Eigen::half>(101.25f),  static_cast<Eigen::half>(59.22f),   static_cast<Eigen::half>(-113.25f),
     static_cast<Eigen::half>(-76.5f),   static_cast<Eigen::half>(-30.06f),  static_cast<Eigen::half>(58.44f),
-    static_cast<Eigen::half>(86.0f),    static_cast<Eigen::half>(14.81f),   static_cast<Eigen::half>(-14.31f),
+    static_cast<Eigen::half>(86.0f),    static_cast<Eigen::half>(14.84f),   static_cast<Eigen::half>(-14.28f),
     static_cast<Eigen::half>(-104.75f), static_cast<Eigen::half>(-9.22f),   static_cast<Eigen::half>(-49.78f),
     static_cast<Eigen::half>(-129.5f),  static_cast<Eigen::half>(-36.25f),  static_cast<Eigen::half>(-53.12f),
     static_cast<Eigen::half>(-128.5f),  static_cast<Eigen::half>(-66.2f),   static_cast<Eigen::half>(-138.0f),
@@ -133,9 +133,9 @@ static const Eigen::half kCumsumOutputF16_EF_RT[60] = {
     static_cast<Eigen::half>(-62.2f),   static_cast<Eigen::half>(18.8f),    static_cast<Eigen::half>(-23.92f),
     static_cast<Eigen::half>(108.4f),   static_cast<Eigen::half>(37.28f),   static_cast<Eigen::half>(38.03f),
     static_cast<Eigen::half>(-29.22f),  static_cast<Eigen::half>(61.47f),   static_cast<Eigen::half>(-79.5f),
-    static_cast<Eigen::half>(-48.6f),   static_cast<Eigen::half>(-10.875f), static_cast<Eigen::half>(79.4f),
-    static_cast<Eigen::half>(96.1f),    static_cast<Eigen::half>(-34.84f),  static_cast<Eigen::half>(29.53f),
-    static_cast<Eigen::half>(13.56f),   static_cast<Eigen::half>(101.3f),   static_cast<Eigen::half>(7.164f),
+    static_cast<Eigen::half>(-48.6f),   static_cast<Eigen::half>(-10.86f), static_cast<Eigen::half>(79.4f),
+    static_cast<Eigen::half>(96.1f),    static_cast<Eigen::half>(-34.84f),  static_cast<Eigen::half>(29.5f),
+    static_cast<Eigen::half>(13.54f),   static_cast<Eigen::half>(101.3f),   static_cast<Eigen::half>(7.164f),
 };
 
 const complex<float> kCumsumInputComplex64[] = {
@@ -760,4 +760,65 @@ TEST_F(TEST_CUMSUM_UT, LARGE_TENSOR_AXIS0_OUTER_CHUNKING_ET_RT)
     vector<DataType> data_types = {DT_DOUBLE, DT_INT32, DT_DOUBLE};
     vector<vector<int64_t>> shapes = {{128, 1024}, {1}, {128, 1024}};
     RunCumsumKernelWithAxis<double, double>(data_types, shapes, true, true, 0);
-}
\ No newline at end of file
+}
+
+// ==================== Depth-chunked scan along a long axis ====================
+
+TEST_F(TEST_CUMSUM_UT, LONG_1D_DEPTH_CHUNKED)
+{
+    // shape [1M + 3], inner=1, outer=1 => a single line, scanned in depth chunks
+    vector<DataType> data_types = {DT_INT64, DT_INT32, DT_INT64};
+    vector<vector<int64_t>> shapes = {{(1 << 20) + 3}, {1}, {(1 << 20) + 3}};
+    RunCumsumKernelWithAxis<int64_t, int64_t>(data_types, shapes, false, false, 0);
+}
+
+TEST_F(TEST_CUMSUM_UT, LONG_1D_DEPTH_CHUNKED_ET_RT)
+{
+    vector<DataType> data_types = {DT_INT64, DT_INT32, DT_INT64};
+    vector<vector<int64_t>> shapes = {{(1 << 20) + 3}, {1}, {(1 << 20) + 3}};
+    RunCumsumKernelWithAxis<int64_t, int64_t>(data_types, shapes, true, true, 0);
+}
+
+TEST_F(TEST_CUMSUM_UT, LONG_AXIS0_NARROW_OUTER_DEPTH_CHUNKED)
+{
+    // shape [200000, 3], axis=0 => inner=1, outer=3: fewer lines than cores, chunks carry 3 states each
+    vector<DataType> data_types = {DT_INT32, DT_INT32, DT_INT32};
+    vector<vector<int64_t>> shapes = {{200000, 3}, {1}, {200000, 3}};
+    RunCumsumKernelWithAxis<int32_t, int32_t>(data_types, shapes, true, false, 0);
+}
+
+TEST_F(TEST_CUMSUM_UT, LONG_1D_DOUBLE_DEPTH_CHUNKED_EF_RT)
+{
+    vector<DataType> data_types = {DT_DOUBLE, DT_INT32, DT_DOUBLE};
+    vector<vector<int64_t>> shapes = {{300000}, {1}, {300000}};
+    RunCumsumKernelWithAxis<double, double>(data_types, shapes, false, true, 0);
+}
+
+// float16/bfloat16 accumulate in float: 4096 x 0.1 would stall at 256 (float16) or 32 (bfloat16) otherwise.
+template <typename T>
+void RunCumsumHalfAccumulate(DataType data_type)
+{
+    const int64_t num = 4096;
+    vector<T> input(num, static_cast<T>(0.1f));
+    vector<T> output(num);
+    int32_t axis[1] = {0};
+    vector<DataType> data_types = {data_type, DT_INT32, data_type};
+    vector<vector<int64_t>> shapes = {{num}, {1}, {num}};
+    vector<void*> datas = {(void*)input.data(), (void*)axis, (void*)output.data()};
+    CREATE_NODEDEF(shapes, data_types, datas, false, false);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    const float step = static_cast<float>(input[0]);
+    for (int64_t i = 0; i < num; i += 511) {
+        EXPECT_NEAR(static_cast<float>(output[i]), step * (i + 1), (i + 1) * step * 0.01f);
+    }
+}
+
+TEST_F(TEST_CUMSUM_UT, DATA_TYPE_FLOAT16_FLOAT_ACCUMULATE)
+{
+    RunCumsumHalfAccumulate<Eigen::half>(DT_FLOAT16);
+}
+
+TEST_F(TEST_CUMSUM_UT, DATA_TYPE_BFLOAT16_FLOAT_ACCUMULATE)
+{
+    RunCumsumHalfAccumulate<Eigen::bfloat16>(DT_BFLOAT16);
+}
@@ -30,29 +30,6 @@ protected:
 private:
     uint32_t DivParamCheck(CpuKernelContext& ctx);
 
-    template <typename T>
-    uint32_t DivParamCheckZero(CpuKernelContext& ctx);
-
-    template <typename T>
-    uint32_t SpecialComputeInt(
-        BcastShapeType type, int64_t start, int64_t end, const T* input1, const T* input2, T* output);
-
-    template <typename T>
-    uint32_t SpecialCompute(
-        BcastShapeType type, int64_t start, int64_t end, const T* input1, const T* input2, T* output);
-
-    template <typename T>
-    uint32_t NoBcastComputeInt(CpuKernelContext& ctx);
-
-    template <typename T>
-    uint32_t NoBcastCompute(CpuKernelContext& ctx);
-
-    template <typename T>
-    uint32_t BcastComputeInt(CpuKernelContext& ctx, Bcast& bcast);
-
-    template <typename T>
-    uint32_t BcastCompute(CpuKernelContext& ctx, Bcast& bcast);
-
     template <typename T>
     uint32_t DivComputeInt(CpuKernelContext& ctx);
 
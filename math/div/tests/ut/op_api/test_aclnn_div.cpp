@@ -605,3 +605,16 @@ TEST_F(l2_div_test, ascend950_case_inplace_divmods_fp16_scalar_floordiv)
     EXPECT_EQ(aclRet, ACL_SUCCESS);
     op::SetPlatformSocVersion(op::SocVersion::ASCEND910B);
 }
+
+// AICPU路由的dtype（double）非连续输入直接下发RealDiv
+TEST_F(l2_div_test, case_double_non_contiguous_aicpu)
+{
+    auto self_tensor_desc = TensorDesc({5, 4}, ACL_DOUBLE, ACL_FORMAT_ND, {1, 5}, 0, {4, 5}).ValueRange(-2, 2);
+    auto other_tensor_desc = TensorDesc({5, 4}, ACL_DOUBLE, ACL_FORMAT_ND, {1, 5}, 0, {4, 5}).ValueRange(1, 2);
+    auto out_tensor_desc = TensorDesc({5, 4}, ACL_DOUBLE, ACL_FORMAT_ND).Precision(0.0001, 0.0001);
+
+    auto ut = OP_API_UT(aclnnDiv, INPUT(self_tensor_desc, other_tensor_desc), OUTPUT(out_tensor_desc));
+    uint64_t workspace_size = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspace_size);
+    EXPECT_EQ(aclRet, ACL_SUCCESS);
+}
@@ -170,4 +170,48 @@ TEST_F(TEST_DIV_UT, FloatZeroDivisorKeepsOkStatus)
 
     EXPECT_TRUE(std::isinf(output[0]));
     EXPECT_GT(output[0], 0.0f);
-}
\ No newline at end of file
+}
+
+// The divisor view skips the zeros stored between its elements, so only viewed elements are checked.
+TEST_F(TEST_DIV_UT, IntStridedViewSkipsUnviewedZeros)
+{
+    vector<DataType> data_types = {DT_INT32, DT_INT32, DT_INT32};
+    vector<vector<int64_t>> shapes = {{2, 2}, {8}, {2, 2}};
+    int32_t input1[4] = {-7, 7, 9, -9};
+    int32_t input2[8] = {0, 2, 0, -2, 0, 4, 0, 4};
+    int32_t output[4] = {0};
+    vector<void*> datas = {input1, input2, output};
+
+    auto node_def = CpuKernelUtils::CreateNodeDef();
+    NodeDefBuilder(node_def.get(), "Div", "Div")
+        .Input({"x1", data_types[0], shapes[0], datas[0]})
+        .Input({"x2", data_types[1], shapes[1], datas[1]})
+        .Output({"y", data_types[2], shapes[2], datas[2]})
+        .Attr("view_shape_1", vector<int64_t>{2, 2})
+        .Attr("view_strides_1", vector<int64_t>{4, 2})
+        .Attr("view_offset_1", static_cast<int64_t>(1));
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+    int32_t expected[4] = {-4, -4, 2, -3};
+    EXPECT_EQ(CompareResult(output, expected, 4), true);
+}
+
+TEST_F(TEST_DIV_UT, IntStridedViewZeroDivisor)
+{
+    vector<DataType> data_types = {DT_INT32, DT_INT32, DT_INT32};
+    vector<vector<int64_t>> shapes = {{2}, {4}, {2}};
+    int32_t input1[2] = {1, 2};
+    int32_t input2[4] = {1, 1, 0, 1};
+    int32_t output[2] = {0};
+    vector<void*> datas = {input1, input2, output};
+
+    auto node_def = CpuKernelUtils::CreateNodeDef();
+    NodeDefBuilder(node_def.get(), "Div", "Div")
+        .Input({"x1", data_types[0], shapes[0], datas[0]})
+        .Input({"x2", data_types[1], shapes[1], datas[1]})
+        .Output({"y", data_types[2], shapes[2], datas[2]})
+        .Attr("view_shape_1", vector<int64_t>{2})
+        .Attr("view_strides_1", vector<int64_t>{2})
+        .Attr("view_offset_1", static_cast<int64_t>(0));
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_INNER_ERROR);
+}
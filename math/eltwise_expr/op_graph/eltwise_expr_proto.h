@@ -0,0 +1,55 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file eltwise_expr_proto.h
+ * \brief
+ */
+#ifndef OPS_OP_PROTO_INC_ELTWISE_EXPR_H_
+#define OPS_OP_PROTO_INC_ELTWISE_EXPR_H_
+
+#include "graph/operator_reg.h"
+#include "graph/types.h"
+
+namespace ge {
+
+/**
+* @brief Evaluates a fused element-wise expression over up to four tensors in a single pass.
+
+* @par Inputs:
+* @li x0: A tensor. Must be one of: float16, float32, bfloat16.
+* @li x1: An optional tensor with the same shape and dtype as x0.
+* @li x2: An optional tensor with the same shape and dtype as x0.
+* @li x3: An optional tensor with the same shape and dtype as x0.
+* Optional inputs must be provided in order without gaps.
+
+* @par Attributes:
+* @li program: A required listInt attribute. The expression in postfix order, each instruction is
+*              opcode * 256 + operand. Opcodes: 0=push input[operand], 1=push scalars[operand], 2=add, 3=sub,
+*              4=mul, 5=div, 6=neg. The expression must reduce to A or A * B + C, where A, B and C are affine
+*              in the inputs, and divisors must be non-zero constants.
+* @li scalars: A listFloat attribute. Constants referenced by the program. Defaults to empty.
+
+* @par Outputs:
+* y: A tensor with same shape and dtype as x0.
+*/
+REG_OP(EltwiseExpr)
+    .INPUT(x0, TensorType({DT_FLOAT16, DT_FLOAT, DT_BF16}))
+    .OPTIONAL_INPUT(x1, TensorType({DT_FLOAT16, DT_FLOAT, DT_BF16}))
+    .OPTIONAL_INPUT(x2, TensorType({DT_FLOAT16, DT_FLOAT, DT_BF16}))
+    .OPTIONAL_INPUT(x3, TensorType({DT_FLOAT16, DT_FLOAT, DT_BF16}))
+    .OUTPUT(y, TensorType({DT_FLOAT16, DT_FLOAT, DT_BF16}))
+    .REQUIRED_ATTR(program, ListInt)
+    .ATTR(scalars, ListFloat, {})
+    .OP_END_FACTORY_REG(EltwiseExpr)
+
+} // namespace ge
+
+#endif // OPS_OP_PROTO_INC_ELTWISE_EXPR_H_
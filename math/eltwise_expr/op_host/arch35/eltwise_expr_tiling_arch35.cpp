@@ -0,0 +1,417 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file eltwise_expr_tiling_arch35.cpp
+ * \brief EltwiseExpr 算子 Host Tiling 实现（atvoss 框架 - Elewise 模式）
+ *
+ * Tiling 先把 program 属性描述的后缀表达式在 Host 侧符号化执行，化简为 LINEAR 或 MULADD 范式，
+ * 再按 (dtype, 范式, 输入个数, 各仿射项的输入掩码) 选择预实例化的 DAG，系数写入 TilingData。
+ * 仿射项只计算自己引用到的输入，未引用的输入不会以 0 * x 的形式参与计算。
+ * 表达式只需 Host 侧解析一次，Kernel 侧一次搬入、一次搬出完成整条计算链。
+ */
+
+#include <cmath>
+#include <utility>
+#include <vector>
+#include "register/op_def_registry.h"
+#include "atvoss/elewise/elewise_tiling.h"
+#include "op_common/op_host/util/platform_util.h"
+#include "op_common/log/log.h"
+#include "../../op_kernel/arch35/eltwise_expr_dag.h"
+#include "../../op_kernel/arch35/eltwise_expr_tiling_data.h"
+#include "../../op_kernel/arch35/eltwise_expr_struct.h"
+#include "eltwise_expr_tiling_arch35.h"
+
+namespace optiling {
+
+using namespace ge;
+using namespace EltwiseExprOp;
+
+constexpr uint64_t WORKSPACE_RESERVE_BYTE = 0;
+constexpr size_t ATTR_PROGRAM_IDX = 0;
+constexpr size_t ATTR_SCALARS_IDX = 1;
+
+namespace {
+// 按引用关系判断：x - x 仍引用 x，x 为 inf 时结果应为 NaN，不能按常数 0 折叠
+bool IsConstant(const EltwiseExprAffine& a)
+{
+    return a.mask == 0;
+}
+
+EltwiseExprAffine Combine(const EltwiseExprAffine& a, const EltwiseExprAffine& b, float sign)
+{
+    EltwiseExprAffine res;
+    res.constant = a.constant + sign * b.constant;
+    res.mask = a.mask | b.mask;
+    for (size_t i = 0; i < res.coef.size(); i++) {
+        res.coef[i] = a.coef[i] + sign * b.coef[i];
+    }
+    return res;
+}
+
+EltwiseExprAffine Scale(const EltwiseExprAffine& a, float k)
+{
+    EltwiseExprAffine res;
+    res.constant = a.constant * k;
+    res.mask = a.mask;
+    for (size_t i = 0; i < res.coef.size(); i++) {
+        res.coef[i] = a.coef[i] * k;
+    }
+    return res;
+}
+
+EltwiseExprTerm ScaleTerm(const EltwiseExprTerm& t, float k)
+{
+    EltwiseExprTerm res = t;
+    res.lhs = t.isProduct ? Scale(t.lhs, k) : t.lhs;
+    res.addend = Scale(t.addend, k);
+    return res;
+}
+
+// lhs + sign * rhs，最多允许一侧为乘积项
+bool AddTerms(const EltwiseExprTerm& lhs, const EltwiseExprTerm& rhs, float sign, EltwiseExprTerm& out)
+{
+    if (lhs.isProduct && rhs.isProduct) {
+        return false;
+    }
+    if (rhs.isProduct) {
+        out = rhs;
+        out.lhs = Scale(rhs.lhs, sign);
+        out.addend = Combine(lhs.addend, rhs.addend, sign);
+        return true;
+    }
+    out = lhs;
+    out.addend = Combine(lhs.addend, rhs.addend, sign);
+    return true;
+}
+
+bool MulTerms(const EltwiseExprTerm& lhs, const EltwiseExprTerm& rhs, EltwiseExprTerm& out)
+{
+    if (!lhs.isProduct && IsConstant(lhs.addend)) {
+        out = ScaleTerm(rhs, lhs.addend.constant);
+        return true;
+    }
+    if (!rhs.isProduct && IsConstant(rhs.addend)) {
+        out = ScaleTerm(lhs, rhs.addend.constant);
+        return true;
+    }
+    if (lhs.isProduct || rhs.isProduct) {
+        return false;
+    }
+    out = EltwiseExprTerm();
+    out.isProduct = true;
+    out.lhs = lhs.addend;
+    out.rhs = rhs.addend;
+    return true;
+}
+
+// 与 eltwise_expr_dag.h 中 Affine 的系数布局一致：常数项后只写 mask 中各输入的系数
+void AppendAffine(const EltwiseExprAffine& a, float* coeff, size_t& pos)
+{
+    coeff[pos++] = a.constant;
+    for (uint64_t i = 0; i < ELTWISE_EXPR_MAX_INPUT_NUM; i++) {
+        if ((a.mask & (1UL << i)) != 0) {
+            coeff[pos++] = a.coef[i];
+        }
+    }
+}
+
+uint64_t ReferencedInputs(const EltwiseExprTerm& t)
+{
+    return t.isProduct ? (t.lhs.mask | t.rhs.mask | t.addend.mask) : t.addend.mask;
+}
+
+// MULADD 按 A、B、C 都引用全部输入的 DAG 切分：掩码更小的实例节点和缓冲只会更少，同一切分对其同样适用
+template <typename T, int N>
+using FullMulAddForm = NsEltwiseExpr::ExprForm<T, NsEltwiseExpr::FORM_MULADD, N, (1UL << N) - 1, (1UL << N) - 1,
+    (1UL << N) - 1>;
+
+template <typename T>
+ge::graphStatus DoTilingForType(
+    ElewiseBaseTiling& elewiseBaseTiling, EleBaseTilingData& baseTiling, bool isProduct, uint64_t inputNum)
+{
+    if (isProduct) {
+        switch (inputNum) {
+            case 1:
+                return elewiseBaseTiling.DoTiling<typename FullMulAddForm<T, 1>::OpDag>(baseTiling);
+            case 2:
+                return elewiseBaseTiling.DoTiling<typename FullMulAddForm<T, 2>::OpDag>(baseTiling);
+            default:
+                return elewiseBaseTiling.DoTiling<typename FullMulAddForm<T, 3>::OpDag>(baseTiling);
+        }
+    }
+    switch (inputNum) {
+        case 1:
+            return elewiseBaseTiling.DoTiling<typename NsEltwiseExpr::ExprForm<T, NsEltwiseExpr::FORM_LINEAR, 1>::OpDag>(
+                baseTiling);
+        case 2:
+            return elewiseBaseTiling.DoTiling<typename NsEltwiseExpr::ExprForm<T, NsEltwiseExpr::FORM_LINEAR, 2>::OpDag>(
+                baseTiling);
+        case 3:
+            return elewiseBaseTiling.DoTiling<typename NsEltwiseExpr::ExprForm<T, NsEltwiseExpr::FORM_LINEAR, 3>::OpDag>(
+                baseTiling);
+        default:
+            return elewiseBaseTiling.DoTiling<typename NsEltwiseExpr::ExprForm<T, NsEltwiseExpr::FORM_LINEAR, 4>::OpDag>(
+                baseTiling);
+    }
+}
+} // namespace
+
+ge::graphStatus EltwiseExprTiling::CheckInputs()
+{
+    auto inputDesc = tilingContext->GetInputDesc(0);
+    OP_CHECK_NULL_WITH_CONTEXT(tilingContext, inputDesc);
+    dtype = inputDesc->GetDataType();
+    auto inputShape = tilingContext->GetInputShape(0);
+    OP_CHECK_NULL_WITH_CONTEXT(tilingContext, inputShape);
+    const gert::Shape& xShape = inputShape->GetStorageShape();
+
+    // 可选输入必须连续提供：x0, x1, ... x{inputNum-1}
+    inputNum = 1;
+    for (uint64_t i = 1; i < ELTWISE_EXPR_MAX_INPUT_NUM; i++) {
+        auto optionalShape = tilingContext->GetOptionalInputShape(i);
+        if (optionalShape == nullptr) {
+            continue;
+        }
+        OP_CHECK_IF(inputNum != i,
+            OP_LOGE_FOR_INVALID_VALUE_WITH_REASON(tilingContext->GetNodeName(), "inputs",
+                "x" + std::to_string(i), "Optional inputs must be provided in order without gaps"),
+            return ge::GRAPH_FAILED);
+        auto optionalDesc = tilingContext->GetOptionalInputDesc(i);
+        OP_CHECK_NULL_WITH_CONTEXT(tilingContext, optionalDesc);
+        OP_CHECK_IF(optionalDesc->GetDataType() != dtype,
+            OP_LOGE_FOR_INVALID_DTYPES_WITH_REASON(tilingContext->GetNodeName(), "inputs",
+                (Ops::Base::ToString(dtype) + " and " + Ops::Base::ToString(optionalDesc->GetDataType())).c_str(),
+                "The dtypes of all inputs must be the same"),
+            return ge::GRAPH_FAILED);
+        OP_CHECK_IF(optionalShape->GetStorageShape() != xShape,
+            OP_LOGE_FOR_INVALID_SHAPES_WITH_REASON(tilingContext->GetNodeName(), "inputs",
+                (Ops::Base::ToString(xShape) + " and " + Ops::Base::ToString(optionalShape->GetStorageShape())).c_str(),
+                "The shapes of all inputs must be the same"),
+            return ge::GRAPH_FAILED);
+        inputNum++;
+    }
+
+    auto outputDesc = tilingContext->GetOutputDesc(0);
+    OP_CHECK_NULL_WITH_CONTEXT(tilingContext, outputDesc);
+    OP_CHECK_IF(outputDesc->GetDataType() != dtype,
+        OP_LOGE_FOR_INVALID_DTYPES_WITH_REASON(tilingContext->GetNodeName(), "x0 and y",
+            (Ops::Base::ToString(dtype) + " and " + Ops::Base::ToString(outputDesc->GetDataType())).c_str(),
+            "The dtypes of x0 and y must be the same"),
+        return ge::GRAPH_FAILED);
+    auto outputShape = tilingContext->GetOutputShape(0);
+    OP_CHECK_NULL_WITH_CONTEXT(tilingContext, outputShape);
+    OP_CHECK_IF(outputShape->GetStorageShape() != xShape,
+        OP_LOGE_FOR_INVALID_SHAPES_WITH_REASON(tilingContext->GetNodeName(), "x0 and y",
+            (Ops::Base::ToString(xShape) + " and " + Ops::Base::ToString(outputShape->GetStorageShape())).c_str(),
+            "The shapes of x0 and y must be the same"),
+        return ge::GRAPH_FAILED);
+    return ge::GRAPH_SUCCESS;
+}
+
+/**
+ * \brief 符号化执行后缀表达式
+ *
+ * 栈上每个值都是 LINEAR（仿射）或 MULADD（仿射 * 仿射 + 仿射）形式：
+ * - 加减：两侧至多一个乘积项；
+ * - 乘法：任意一侧为常数时缩放另一侧，否则两侧都必须是仿射项；
+ * - 除法：除数必须化简为非零常数。
+ * 超出两种范式的表达式没有对应的预实例化模板，直接报错。
+ * 提供的每个输入都必须被引用；MULADD 范式的输入个数不超过 ELTWISE_EXPR_MAX_MULADD_INPUT_NUM，
+ * 并交换 A、B 使 A 的输入掩码不大于 B，与 Kernel 侧实例化的组合对应。
+ */
+ge::graphStatus EltwiseExprTiling::CompileProgram()
+{
+    auto attrs = tilingContext->GetAttrs();
+    OP_CHECK_NULL_WITH_CONTEXT(tilingContext, attrs);
+    auto program = attrs->GetListInt(ATTR_PROGRAM_IDX);
+    OP_CHECK_NULL_WITH_CONTEXT(tilingContext, program);
+    const size_t programLen = program->GetSize();
+    OP_CHECK_IF(programLen == 0 || programLen > ELTWISE_EXPR_MAX_PROGRAM_LEN,
+        OP_LOGE_FOR_INVALID_VALUE_WITH_REASON(tilingContext->GetNodeName(), "program", std::to_string(programLen),
+            "The length of program must be in [1, " + std::to_string(ELTWISE_EXPR_MAX_PROGRAM_LEN) + "]"),
+        return ge::GRAPH_FAILED);
+    const gert::TypedContinuousVector<float>* scalars = attrs->GetListFloat(ATTR_SCALARS_IDX);
+    const size_t scalarNum = (scalars == nullptr) ? 0 : scalars->GetSize();
+
+    std::vector<EltwiseExprTerm> stack;
+    stack.reserve(programLen);
+    for (size_t pc = 0; pc < programLen; pc++) {
+        const int64_t inst = program->GetData()[pc];
+        const int64_t opcode = inst / ELTWISE_EXPR_OPERAND_RANGE;
+        const int64_t operand = inst % ELTWISE_EXPR_OPERAND_RANGE;
+        const std::string where = "instruction " + std::to_string(pc) + " (" + std::to_string(inst) + ")";
+        OP_CHECK_IF(inst < 0 || opcode > ELTWISE_EXPR_OP_NEG,
+            OP_LOGE_FOR_INVALID_VALUE_WITH_REASON(tilingContext->GetNodeName(), "program", where,
+                "Unknown opcode"),
+            return ge::GRAPH_FAILED);
+        if (opcode == ELTWISE_EXPR_OP_INPUT || opcode == ELTWISE_EXPR_OP_SCALAR) {
+            EltwiseExprTerm value;
+            if (opcode == ELTWISE_EXPR_OP_INPUT) {
+                OP_CHECK_IF(static_cast<uint64_t>(operand) >= inputNum,
+                    OP_LOGE_FOR_INVALID_VALUE_WITH_REASON(tilingContext->GetNodeName(), "program", where,
+                        "The input index must be less than the number of inputs " + std::to_string(inputNum)),
+                    return ge::GRAPH_FAILED);
+                value.addend.coef[operand] = 1.0f;
+                value.addend.mask = 1UL << operand;
+            } else {
+                OP_CHECK_IF(static_cast<size_t>(operand) >= scalarNum,
+                    OP_LOGE_FOR_INVALID_VALUE_WITH_REASON(tilingContext->GetNodeName(), "program", where,
+                        "The scalar index must be less than the length of scalars " + std::to_string(scalarNum)),
+                    return ge::GRAPH_FAILED);
+                value.addend.constant = scalars->GetData()[operand];
+            }
+            stack.push_back(value);
+            continue;
+        }
+        OP_CHECK_IF(operand != 0,
+            OP_LOGE_FOR_INVALID_VALUE_WITH_REASON(tilingContext->GetNodeName(), "program", where,
+                "Arithmetic instructions take no operand"),
+            return ge::GRAPH_FAILED);
+        if (opcode == ELTWISE_EXPR_OP_NEG) {
+            OP_CHECK_IF(stack.empty(),
+                OP_LOGE_FOR_INVALID_VALUE_WITH_REASON(tilingContext->GetNodeName(), "program", where,
+                    "Stack underflow"),
+                return ge::GRAPH_FAILED);
+            stack.back() = ScaleTerm(stack.back(), -1.0f);
+            continue;
+        }
+        OP_CHECK_IF(stack.size() < 2,
+            OP_LOGE_FOR_INVALID_VALUE_WITH_REASON(tilingContext->GetNodeName(), "program", where,
+                "Stack underflow"),
+            return ge::GRAPH_FAILED);
+        EltwiseExprTerm rhs = stack.back();
+        stack.pop_back();
+        EltwiseExprTerm lhs = stack.back();
+        EltwiseExprTerm& res = stack.back();
+        bool covered = true;
+        if (opcode == ELTWISE_EXPR_OP_ADD || opcode == ELTWISE_EXPR_OP_SUB) {
+            covered = AddTerms(lhs, rhs, (opcode == ELTWISE_EXPR_OP_ADD) ? 1.0f : -1.0f, res);
+        } else if (opcode == ELTWISE_EXPR_OP_MUL) {
+            covered = MulTerms(lhs, rhs, res);
+        } else {
+            covered = !rhs.isProduct && IsConstant(rhs.addend) && rhs.addend.constant != 0.0f;
+            if (covered) {
+                res = ScaleTerm(lhs, 1.0f / rhs.addend.constant);
+            }
+        }
+        OP_CHECK_IF(!covered,
+            OP_LOGE_FOR_INVALID_VALUE_WITH_REASON(tilingContext->GetNodeName(), "program", where,
+                "The expression is not covered by a fused template, it must reduce to "
+                "affine or affine * affine + affine, and divisors must be non-zero constants"),
+            return ge::GRAPH_FAILED);
+    }
+    OP_CHECK_IF(stack.size() != 1,
+        OP_LOGE_FOR_INVALID_VALUE_WITH_REASON(tilingContext->GetNodeName(), "program",
+            std::to_string(stack.size()) + " values left", "The program must leave exactly one value"),
+        return ge::GRAPH_FAILED);
+    term = stack.back();
+    OP_CHECK_IF(ReferencedInputs(term) != (1UL << inputNum) - 1,
+        OP_LOGE_FOR_INVALID_VALUE_WITH_REASON(tilingContext->GetNodeName(), "program",
+            "referenced input mask " + std::to_string(ReferencedInputs(term)),
+            "Every provided input must be referenced by the program"),
+        return ge::GRAPH_FAILED);
+    if (term.isProduct) {
+        OP_CHECK_IF(inputNum > ELTWISE_EXPR_MAX_MULADD_INPUT_NUM,
+            OP_LOGE_FOR_INVALID_VALUE_WITH_REASON(tilingContext->GetNodeName(), "inputs", std::to_string(inputNum),
+                "The MULADD form supports at most " + std::to_string(ELTWISE_EXPR_MAX_MULADD_INPUT_NUM) + " inputs"),
+            return ge::GRAPH_FAILED);
+        if (term.lhs.mask > term.rhs.mask) {
+            std::swap(term.lhs, term.rhs);
+        }
+    }
+    return ge::GRAPH_SUCCESS;
+}
+
+ge::graphStatus EltwiseExprTiling::DoElewiseTiling()
+{
+    ElewiseBaseTiling elewiseBaseTiling(tilingContext);
+    switch (dtype) {
+        case ge::DT_FLOAT16:
+            return DoTilingForType<half>(elewiseBaseTiling, tiling->baseTiling, term.isProduct, inputNum);
+        case ge::DT_BF16:
+            return DoTilingForType<bfloat16_t>(elewiseBaseTiling, tiling->baseTiling, term.isProduct, inputNum);
+        case ge::DT_FLOAT:
+            return DoTilingForType<float>(elewiseBaseTiling, tiling->baseTiling, term.isProduct, inputNum);
+        default:
+            OP_LOGE_FOR_INVALID_DTYPE_WITH_REASON(tilingContext->GetNodeName(), "x0",
+                Ops::Base::ToString(dtype).c_str(), "The dtype of x0 must be within the range [DT_FLOAT16, DT_FLOAT, DT_BF16].");
+            return ge::GRAPH_FAILED;
+    }
+}
+
+ge::graphStatus EltwiseExprTiling::SetTilingData()
+{
+    size_t pos = 0;
+    if (term.isProduct) {
+        AppendAffine(term.lhs, tiling->coeff, pos);
+        AppendAffine(term.rhs, tiling->coeff, pos);
+    }
+    AppendAffine(term.addend, tiling->coeff, pos);
+    for (; pos < ELTWISE_EXPR_MAX_COEFF_NUM; pos++) {
+        tiling->coeff[pos] = 0.0f;
+    }
+
+    size_t* currentWorkspace = tilingContext->GetWorkspaceSizes(1);
+    currentWorkspace[0] = WORKSPACE_RESERVE_BYTE;
+    tilingContext->SetBlockDim(tiling->baseTiling.blockNum);
+    return ge::GRAPH_SUCCESS;
+}
+
+ge::graphStatus EltwiseExprTiling::RunTiling()
+{
+    tiling = tilingContext->GetTilingData<EltwiseExprTilingData>();
+    OP_CHECK_NULL_WITH_CONTEXT(tilingContext, tiling);
+    OP_CHECK_IF(CheckInputs() != ge::GRAPH_SUCCESS, OP_LOGE(tilingContext->GetNodeName(), "check inputs failed"),
+        return ge::GRAPH_FAILED);
+    OP_CHECK_IF(CompileProgram() != ge::GRAPH_SUCCESS,
+        OP_LOGE(tilingContext->GetNodeName(), "compile program failed"), return ge::GRAPH_FAILED);
+    ge::graphStatus ret = DoElewiseTiling();
+    OP_CHECK_IF(ret != ge::GRAPH_SUCCESS,
+        OP_LOGE(tilingContext->GetNodeName(), "EltwiseExpr: ElewiseBaseTiling DoTiling failed"), return ret);
+
+    uint64_t dType = (dtype == ge::DT_FLOAT16) ? TPL_FP16 : ((dtype == ge::DT_BF16) ? TPL_BF16 : TPL_FP32);
+    uint64_t form = term.isProduct ? TPL_FORM_MULADD : TPL_FORM_LINEAR;
+    uint64_t lhsMask = term.isProduct ? term.lhs.mask : 0;
+    uint64_t rhsMask = term.isProduct ? term.rhs.mask : 0;
+    uint64_t addMask = term.isProduct ? term.addend.mask : 0;
+    uint64_t tilingKey = GET_TPL_TILING_KEY(static_cast<uint64_t>(tiling->baseTiling.scheMode), dType, form, inputNum,
+        lhsMask, rhsMask, addMask);
+    tilingContext->SetTilingKey(tilingKey);
+    OP_LOGI(tilingContext, "EltwiseExpr: Tiling success, form=%lu, inputNum=%lu, masks=(%lu, %lu, %lu), tilingKey=%lu",
+        form, inputNum, lhsMask, rhsMask, addMask, tilingKey);
+    return SetTilingData();
+}
+
+static ge::graphStatus TilingForEltwiseExpr(gert::TilingContext* context)
+{
+    OP_CHECK_IF(context == nullptr, OP_LOGE(context, "Tiling context is null"), return ge::GRAPH_FAILED);
+    EltwiseExprTiling eltwiseExprTiling(context);
+    return eltwiseExprTiling.RunTiling();
+}
+
+static ge::graphStatus TilingParseForEltwiseExpr(gert::TilingParseContext* context)
+{
+    auto compileInfoPtr = context->GetCompiledInfo<EltwiseExprCompileInfo>();
+    OP_CHECK_NULL_WITH_CONTEXT(context, compileInfoPtr);
+    fe::PlatFormInfos* platformInfoPtr = context->GetPlatformInfo();
+    OP_CHECK_NULL_WITH_CONTEXT(context, platformInfoPtr);
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(platformInfoPtr);
+    compileInfoPtr->coreNum = ascendcPlatform.GetCoreNumAiv();
+    ascendcPlatform.GetCoreMemSize(platform_ascendc::CoreMemType::UB, compileInfoPtr->ubSize);
+    return ge::GRAPH_SUCCESS;
+}
+
+IMPL_OP_OPTILING(EltwiseExpr)
+    .Tiling(TilingForEltwiseExpr)
+    .TilingParse<EltwiseExprCompileInfo>(TilingParseForEltwiseExpr);
+
+} // namespace optiling
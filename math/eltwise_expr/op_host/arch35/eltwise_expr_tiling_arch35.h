@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file eltwise_expr_tiling_arch35.h
+ * \brief EltwiseExpr 算子 Host Tiling 定义
+ */
+
+#ifndef OPS_BUILD_IN_OP_TILING_RUNTIME_ELTWISE_EXPR_TILING_H
+#define OPS_BUILD_IN_OP_TILING_RUNTIME_ELTWISE_EXPR_TILING_H
+
+#include <array>
+#include "register/tilingdata_base.h"
+#include "register/op_impl_registry.h"
+#include "math/eltwise_expr/op_kernel/arch35/eltwise_expr_tiling_data.h"
+
+namespace optiling {
+using namespace Ops::Base;
+
+/**
+ * program 属性的编码：后缀表达式，每条指令为 opcode * ELTWISE_EXPR_OPERAND_RANGE + operand。
+ * INPUT/SCALAR 的 operand 为输入 / scalars 属性的下标，其余指令 operand 必须为 0。
+ */
+constexpr int64_t ELTWISE_EXPR_OPERAND_RANGE = 256;
+constexpr int64_t ELTWISE_EXPR_OP_INPUT = 0;
+constexpr int64_t ELTWISE_EXPR_OP_SCALAR = 1;
+constexpr int64_t ELTWISE_EXPR_OP_ADD = 2;
+constexpr int64_t ELTWISE_EXPR_OP_SUB = 3;
+constexpr int64_t ELTWISE_EXPR_OP_MUL = 4;
+constexpr int64_t ELTWISE_EXPR_OP_DIV = 5;
+constexpr int64_t ELTWISE_EXPR_OP_NEG = 6;
+constexpr size_t ELTWISE_EXPR_MAX_PROGRAM_LEN = 64;
+// MULADD 范式按 A、B、C 的输入掩码组合实例化，输入个数上限小于 LINEAR
+constexpr uint64_t ELTWISE_EXPR_MAX_MULADD_INPUT_NUM = 3;
+
+struct EltwiseExprCompileInfo {
+    uint64_t coreNum;
+    uint64_t ubSize;
+};
+
+// const + coef[0] * x0 + ... + coef[N-1] * x{N-1}，mask 记录程序中实际引用到的输入（与系数是否为 0 无关）
+struct EltwiseExprAffine {
+    float constant = 0.0f;
+    std::array<float, ELTWISE_EXPR_MAX_INPUT_NUM> coef{};
+    uint64_t mask = 0;
+};
+
+// isProduct 为 false 时只有 addend 有效（LINEAR），否则表示 lhs * rhs + addend（MULADD）
+struct EltwiseExprTerm {
+    bool isProduct = false;
+    EltwiseExprAffine lhs;
+    EltwiseExprAffine rhs;
+    EltwiseExprAffine addend;
+};
+
+class EltwiseExprTiling {
+public:
+    explicit EltwiseExprTiling(gert::TilingContext* context) : tilingContext(context) {};
+    ge::graphStatus RunTiling();
+    EltwiseExprTilingData* tiling = nullptr;
+
+protected:
+    ge::graphStatus CheckInputs();
+    ge::graphStatus CompileProgram();
+    ge::graphStatus DoElewiseTiling();
+    ge::graphStatus SetTilingData();
+
+private:
+    gert::TilingContext* tilingContext;
+    ge::DataType dtype = ge::DT_UNDEFINED;
+    uint64_t inputNum = 0;
+    EltwiseExprTerm term;
+};
+
+} // namespace optiling
+#endif // OPS_BUILD_IN_OP_TILING_RUNTIME_ELTWISE_EXPR_TILING_H
@@ -0,0 +1,22 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file eltwise_expr_infershape.cpp
+ * \brief
+ */
+
+#include "infershape_elewise_util.h"
+#include "register/op_def_registry.h"
+
+using namespace ge;
+namespace ops {
+IMPL_OP_INFERSHAPE(EltwiseExpr).InferShape(Ops::Base::InferShape4Elewise);
+}
@@ -0,0 +1,148 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file eltwise_expr_dag.h
+ * \brief EltwiseExpr 算子 DAG 计算图定义（atvoss 框架 - Elewise 模式）
+ *
+ * Host 侧把表达式程序化简为以下两种范式之一：
+ *
+ *   LINEAR : y = c[0] + c[1] * x0 + ... + c[N] * x{N-1}，按输入个数 N（1~4）预先实例化
+ *   MULADD : y = A * B + C，A、B、C 均为仿射形式，按各自引用的输入掩码（N 为 1~3）预先实例化
+ *
+ * 仿射项只展开掩码中的输入：未被引用的输入不参与计算，避免 0 * inf 产生 NaN。
+ * 每个仿射项的系数依次为常数项和掩码中各输入（下标从小到大）的系数，A、B、C 的系数紧密排列。
+ *
+ * 系数通过 Placeholder::Var<float, i> 占位，Kernel 入口按下标 SetVar 注入；
+ * 输入统一 Cast 到 float 计算，结果 Cast 回原 dtype（fp32 场景 Cast 会被模板优化掉）。
+ * 同一输入在多个仿射项中出现时对应同一个 Bind 类型，DAG 只搬运一次。
+ */
+
+#ifndef ELTWISE_EXPR_DAG_H
+#define ELTWISE_EXPR_DAG_H
+
+// Host 编译时 mock __aicore__（Kernel 编译器已内置定义）
+#ifndef __CCE_AICORE__
+#ifndef __aicore__
+#define __aicore__
+#endif
+#endif
+
+#include "atvoss/util/dag.h"
+#include "atvoss/util/vec.h"
+#include "atvoss/util/placeholder.h"
+
+using namespace Ops::Base;
+
+namespace NsEltwiseExpr {
+
+constexpr int CAST_MODE_NONE = 0;
+constexpr int CAST_MODE_RINT = 1;
+
+constexpr uint64_t FORM_LINEAR = 0;
+constexpr uint64_t FORM_MULADD = 1;
+
+template <typename T, int I>
+struct InputOf;
+
+template <typename T>
+struct InputOf<T, 0> {
+    using type = Placeholder::In0<T>;
+};
+
+template <typename T>
+struct InputOf<T, 1> {
+    using type = Placeholder::In1<T>;
+};
+
+template <typename T>
+struct InputOf<T, 2> {
+    using type = Placeholder::In2<T>;
+};
+
+template <typename T>
+struct InputOf<T, 3> {
+    using type = Placeholder::In3<T>;
+};
+
+template <typename T, int I>
+using CastInput = Bind<Vec::Cast<float, T, CAST_MODE_NONE>, Bind<Vec::CopyIn<T>, typename InputOf<T, I>::type>>;
+
+constexpr int MaskPopCount(uint64_t mask)
+{
+    return (mask == 0) ? 0 : static_cast<int>(mask & 1UL) + MaskPopCount(mask >> 1);
+}
+
+constexpr int MaskHighBit(uint64_t mask)
+{
+    return (mask <= 1) ? 0 : 1 + MaskHighBit(mask >> 1);
+}
+
+// c[B] + c[B + 1] * xi + ...，i 取遍 MASK 中的置位，按输入下标从左到右累加
+template <typename T, uint64_t MASK, int B, bool SINGLE = ((MASK & (MASK - 1)) == 0)>
+struct Affine {
+    static constexpr int HIGH = MaskHighBit(MASK);
+    using type = Bind<Vec::Add<float>, typename Affine<T, MASK & ~(1UL << HIGH), B>::type,
+        Bind<Vec::Muls<float>, CastInput<T, HIGH>, Placeholder::Var<float, B + MaskPopCount(MASK)>>>;
+};
+
+template <typename T, uint64_t MASK, int B>
+struct Affine<T, MASK, B, true> {
+    using type = Bind<Vec::Adds<float>,
+        Bind<Vec::Muls<float>, CastInput<T, MaskHighBit(MASK)>, Placeholder::Var<float, B + 1>>,
+        Placeholder::Var<float, B>>;
+};
+
+// Product + C，C 不引用任何输入时退化为加常数
+template <typename T, typename Product, uint64_t MASK, int B>
+struct AddAffine {
+    using type = Bind<Vec::Add<float>, Product, typename Affine<T, MASK, B>::type>;
+};
+
+template <typename T, typename Product, int B>
+struct AddAffine<T, Product, 0, B> {
+    using type = Bind<Vec::Adds<float>, Product, Placeholder::Var<float, B>>;
+};
+
+template <typename T, typename Res>
+struct ExprOutput {
+    using CastY = Bind<Vec::Cast<T, float, CAST_MODE_RINT>, Res>;
+    using OpCopyOut = Bind<Vec::CopyOut<T>, Placeholder::Out0<T>, CastY>;
+    using Outputs = Elems<OpCopyOut>;
+    using MemCfg = MemOptCfg<MemLevel::LEVEL_2>;
+    using OpDag = DAGSch<Outputs, void, MemCfg>;
+};
+
+template <typename T, uint64_t form, int N, uint64_t LHS_MASK = 0, uint64_t RHS_MASK = 0, uint64_t ADD_MASK = 0>
+struct ExprForm;
+
+// LINEAR 范式要求每个输入都被引用，掩码固定为全部 N 个输入
+template <typename T, int N>
+struct ExprForm<T, FORM_LINEAR, N, 0, 0, 0> {
+    static constexpr int COEFF_NUM = N + 1;
+    using Res = typename Affine<T, (1UL << N) - 1, 0>::type;
+    using OpDag = typename ExprOutput<T, Res>::OpDag;
+};
+
+// A、B 至少引用一个输入（否则 Host 侧已折叠为缩放），C 可以只有常数项
+template <typename T, int N, uint64_t LHS_MASK, uint64_t RHS_MASK, uint64_t ADD_MASK>
+struct ExprForm<T, FORM_MULADD, N, LHS_MASK, RHS_MASK, ADD_MASK> {
+    static constexpr int RHS_BASE = 1 + MaskPopCount(LHS_MASK);
+    static constexpr int ADD_BASE = RHS_BASE + 1 + MaskPopCount(RHS_MASK);
+    static constexpr int COEFF_NUM = ADD_BASE + 1 + MaskPopCount(ADD_MASK);
+    using Product = Bind<Vec::Mul<float>, typename Affine<T, LHS_MASK, 0>::type,
+        typename Affine<T, RHS_MASK, RHS_BASE>::type>;
+    using Res = typename AddAffine<T, Product, ADD_MASK, ADD_BASE>::type;
+    using OpDag = typename ExprOutput<T, Res>::OpDag;
+};
+
+} // namespace NsEltwiseExpr
+
+#endif // ELTWISE_EXPR_DAG_H
@@ -0,0 +1,156 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file eltwise_expr_struct.h
+ * \brief EltwiseExpr 算子 TilingKey 定义（schMode + dtype + 范式 + 输入个数 + MULADD 各仿射项的输入掩码）
+ */
+
+#ifndef ELTWISE_EXPR_STRUCT_H_
+#define ELTWISE_EXPR_STRUCT_H_
+
+#include "ascendc/host_api/tiling/template_argument.h"
+
+namespace EltwiseExprOp {
+#define TPL_FP16 1
+#define TPL_BF16 2
+#define TPL_FP32 3
+
+#define TPL_SCH_MODE_0 0
+#define TPL_SCH_MODE_1 1
+
+#define TPL_FORM_LINEAR 0
+#define TPL_FORM_MULADD 1
+
+ASCENDC_TPL_ARGS_DECL(
+    EltwiseExpr,
+    ASCENDC_TPL_UINT_DECL(schMode, 1, ASCENDC_TPL_UI_LIST, TPL_SCH_MODE_0, TPL_SCH_MODE_1),
+    ASCENDC_TPL_DTYPE_DECL(dType, TPL_FP16, TPL_BF16, TPL_FP32),
+    ASCENDC_TPL_UINT_DECL(form, 1, ASCENDC_TPL_UI_LIST, TPL_FORM_LINEAR, TPL_FORM_MULADD),
+    ASCENDC_TPL_UINT_DECL(inputNum, 3, ASCENDC_TPL_UI_RANGE, 1, 1, 4),
+    ASCENDC_TPL_UINT_DECL(lhsMask, 3, ASCENDC_TPL_UI_RANGE, 1, 0, 7),
+    ASCENDC_TPL_UINT_DECL(rhsMask, 3, ASCENDC_TPL_UI_RANGE, 1, 0, 7),
+    ASCENDC_TPL_UINT_DECL(addMask, 3, ASCENDC_TPL_UI_RANGE, 1, 0, 7)
+);
+
+// LINEAR 的掩码固定为 0；MULADD 由 Host 侧交换 A、B 保证 lhsMask <= rhsMask，只实例化这一半组合
+ASCENDC_TPL_SEL(
+    ASCENDC_TPL_ARGS_SEL(
+        ASCENDC_TPL_UINT_SEL(schMode, ASCENDC_TPL_UI_LIST, TPL_SCH_MODE_0, TPL_SCH_MODE_1),
+        ASCENDC_TPL_DTYPE_SEL(dType, TPL_FP16, TPL_BF16, TPL_FP32),
+        ASCENDC_TPL_UINT_SEL(form, ASCENDC_TPL_UI_LIST, TPL_FORM_LINEAR),
+        ASCENDC_TPL_UINT_SEL(inputNum, ASCENDC_TPL_UI_RANGE, 1, 1, 4),
+        ASCENDC_TPL_UINT_SEL(lhsMask, ASCENDC_TPL_UI_LIST, 0),
+        ASCENDC_TPL_UINT_SEL(rhsMask, ASCENDC_TPL_UI_LIST, 0),
+        ASCENDC_TPL_UINT_SEL(addMask, ASCENDC_TPL_UI_LIST, 0)
+    ),
+    ASCENDC_TPL_ARGS_SEL(
+        ASCENDC_TPL_UINT_SEL(schMode, ASCENDC_TPL_UI_LIST, TPL_SCH_MODE_0, TPL_SCH_MODE_1),
+        ASCENDC_TPL_DTYPE_SEL(dType, TPL_FP16, TPL_BF16, TPL_FP32),
+        ASCENDC_TPL_UINT_SEL(form, ASCENDC_TPL_UI_LIST, TPL_FORM_MULADD),
+        ASCENDC_TPL_UINT_SEL(inputNum, ASCENDC_TPL_UI_LIST, 1),
+        ASCENDC_TPL_UINT_SEL(lhsMask, ASCENDC_TPL_UI_LIST, 1),
+        ASCENDC_TPL_UINT_SEL(rhsMask, ASCENDC_TPL_UI_LIST, 1),
+        ASCENDC_TPL_UINT_SEL(addMask, ASCENDC_TPL_UI_LIST, 0, 1)
+    ),
+    ASCENDC_TPL_ARGS_SEL(
+        ASCENDC_TPL_UINT_SEL(schMode, ASCENDC_TPL_UI_LIST, TPL_SCH_MODE_0, TPL_SCH_MODE_1),
+        ASCENDC_TPL_DTYPE_SEL(dType, TPL_FP16, TPL_BF16, TPL_FP32),
+        ASCENDC_TPL_UINT_SEL(form, ASCENDC_TPL_UI_LIST, TPL_FORM_MULADD),
+        ASCENDC_TPL_UINT_SEL(inputNum, ASCENDC_TPL_UI_LIST, 2),
+        ASCENDC_TPL_UINT_SEL(lhsMask, ASCENDC_TPL_UI_LIST, 1),
+        ASCENDC_TPL_UINT_SEL(rhsMask, ASCENDC_TPL_UI_RANGE, 1, 1, 3),
+        ASCENDC_TPL_UINT_SEL(addMask, ASCENDC_TPL_UI_RANGE, 1, 0, 3)
+    ),
+    ASCENDC_TPL_ARGS_SEL(
+        ASCENDC_TPL_UINT_SEL(schMode, ASCENDC_TPL_UI_LIST, TPL_SCH_MODE_0, TPL_SCH_MODE_1),
+        ASCENDC_TPL_DTYPE_SEL(dType, TPL_FP16, TPL_BF16, TPL_FP32),
+        ASCENDC_TPL_UINT_SEL(form, ASCENDC_TPL_UI_LIST, TPL_FORM_MULADD),
+        ASCENDC_TPL_UINT_SEL(inputNum, ASCENDC_TPL_UI_LIST, 2),
+        ASCENDC_TPL_UINT_SEL(lhsMask, ASCENDC_TPL_UI_LIST, 2),
+        ASCENDC_TPL_UINT_SEL(rhsMask, ASCENDC_TPL_UI_RANGE, 1, 2, 3),
+        ASCENDC_TPL_UINT_SEL(addMask, ASCENDC_TPL_UI_RANGE, 1, 0, 3)
+    ),
+    ASCENDC_TPL_ARGS_SEL(
+        ASCENDC_TPL_UINT_SEL(schMode, ASCENDC_TPL_UI_LIST, TPL_SCH_MODE_0, TPL_SCH_MODE_1),
+        ASCENDC_TPL_DTYPE_SEL(dType, TPL_FP16, TPL_BF16, TPL_FP32),
+        ASCENDC_TPL_UINT_SEL(form, ASCENDC_TPL_UI_LIST, TPL_FORM_MULADD),
+        ASCENDC_TPL_UINT_SEL(inputNum, ASCENDC_TPL_UI_LIST, 2),
+        ASCENDC_TPL_UINT_SEL(lhsMask, ASCENDC_TPL_UI_LIST, 3),
+        ASCENDC_TPL_UINT_SEL(rhsMask, ASCENDC_TPL_UI_RANGE, 1, 3, 3),
+        ASCENDC_TPL_UINT_SEL(addMask, ASCENDC_TPL_UI_RANGE, 1, 0, 3)
+    ),
+    ASCENDC_TPL_ARGS_SEL(
+        ASCENDC_TPL_UINT_SEL(schMode, ASCENDC_TPL_UI_LIST, TPL_SCH_MODE_0, TPL_SCH_MODE_1),
+        ASCENDC_TPL_DTYPE_SEL(dType, TPL_FP16, TPL_BF16, TPL_FP32),
+        ASCENDC_TPL_UINT_SEL(form, ASCENDC_TPL_UI_LIST, TPL_FORM_MULADD),
+        ASCENDC_TPL_UINT_SEL(inputNum, ASCENDC_TPL_UI_LIST, 3),
+        ASCENDC_TPL_UINT_SEL(lhsMask, ASCENDC_TPL_UI_LIST, 1),
+        ASCENDC_TPL_UINT_SEL(rhsMask, ASCENDC_TPL_UI_RANGE, 1, 1, 7),
+        ASCENDC_TPL_UINT_SEL(addMask, ASCENDC_TPL_UI_RANGE, 1, 0, 7)
+    ),
+    ASCENDC_TPL_ARGS_SEL(
+        ASCENDC_TPL_UINT_SEL(schMode, ASCENDC_TPL_UI_LIST, TPL_SCH_MODE_0, TPL_SCH_MODE_1),
+        ASCENDC_TPL_DTYPE_SEL(dType, TPL_FP16, TPL_BF16, TPL_FP32),
+        ASCENDC_TPL_UINT_SEL(form, ASCENDC_TPL_UI_LIST, TPL_FORM_MULADD),
+        ASCENDC_TPL_UINT_SEL(inputNum, ASCENDC_TPL_UI_LIST, 3),
+        ASCENDC_TPL_UINT_SEL(lhsMask, ASCENDC_TPL_UI_LIST, 2),
+        ASCENDC_TPL_UINT_SEL(rhsMask, ASCENDC_TPL_UI_RANGE, 1, 2, 7),
+        ASCENDC_TPL_UINT_SEL(addMask, ASCENDC_TPL_UI_RANGE, 1, 0, 7)
+    ),
+    ASCENDC_TPL_ARGS_SEL(
+        ASCENDC_TPL_UINT_SEL(schMode, ASCENDC_TPL_UI_LIST, TPL_SCH_MODE_0, TPL_SCH_MODE_1),
+        ASCENDC_TPL_DTYPE_SEL(dType, TPL_FP16, TPL_BF16, TPL_FP32),
+        ASCENDC_TPL_UINT_SEL(form, ASCENDC_TPL_UI_LIST, TPL_FORM_MULADD),
+        ASCENDC_TPL_UINT_SEL(inputNum, ASCENDC_TPL_UI_LIST, 3),
+        ASCENDC_TPL_UINT_SEL(lhsMask, ASCENDC_TPL_UI_LIST, 3),
+        ASCENDC_TPL_UINT_SEL(rhsMask, ASCENDC_TPL_UI_RANGE, 1, 3, 7),
+        ASCENDC_TPL_UINT_SEL(addMask, ASCENDC_TPL_UI_RANGE, 1, 0, 7)
+    ),
+    ASCENDC_TPL_ARGS_SEL(
+        ASCENDC_TPL_UINT_SEL(schMode, ASCENDC_TPL_UI_LIST, TPL_SCH_MODE_0, TPL_SCH_MODE_1),
+        ASCENDC_TPL_DTYPE_SEL(dType, TPL_FP16, TPL_BF16, TPL_FP32),
+        ASCENDC_TPL_UINT_SEL(form, ASCENDC_TPL_UI_LIST, TPL_FORM_MULADD),
+        ASCENDC_TPL_UINT_SEL(inputNum, ASCENDC_TPL_UI_LIST, 3),
+        ASCENDC_TPL_UINT_SEL(lhsMask, ASCENDC_TPL_UI_LIST, 4),
+        ASCENDC_TPL_UINT_SEL(rhsMask, ASCENDC_TPL_UI_RANGE, 1, 4, 7),
+        ASCENDC_TPL_UINT_SEL(addMask, ASCENDC_TPL_UI_RANGE, 1, 0, 7)
+    ),
+    ASCENDC_TPL_ARGS_SEL(
+        ASCENDC_TPL_UINT_SEL(schMode, ASCENDC_TPL_UI_LIST, TPL_SCH_MODE_0, TPL_SCH_MODE_1),
+        ASCENDC_TPL_DTYPE_SEL(dType, TPL_FP16, TPL_BF16, TPL_FP32),
+        ASCENDC_TPL_UINT_SEL(form, ASCENDC_TPL_UI_LIST, TPL_FORM_MULADD),
+        ASCENDC_TPL_UINT_SEL(inputNum, ASCENDC_TPL_UI_LIST, 3),
+        ASCENDC_TPL_UINT_SEL(lhsMask, ASCENDC_TPL_UI_LIST, 5),
+        ASCENDC_TPL_UINT_SEL(rhsMask, ASCENDC_TPL_UI_RANGE, 1, 5, 7),
+        ASCENDC_TPL_UINT_SEL(addMask, ASCENDC_TPL_UI_RANGE, 1, 0, 7)
+    ),
+    ASCENDC_TPL_ARGS_SEL(
+        ASCENDC_TPL_UINT_SEL(schMode, ASCENDC_TPL_UI_LIST, TPL_SCH_MODE_0, TPL_SCH_MODE_1),
+        ASCENDC_TPL_DTYPE_SEL(dType, TPL_FP16, TPL_BF16, TPL_FP32),
+        ASCENDC_TPL_UINT_SEL(form, ASCENDC_TPL_UI_LIST, TPL_FORM_MULADD),
+        ASCENDC_TPL_UINT_SEL(inputNum, ASCENDC_TPL_UI_LIST, 3),
+        ASCENDC_TPL_UINT_SEL(lhsMask, ASCENDC_TPL_UI_LIST, 6),
+        ASCENDC_TPL_UINT_SEL(rhsMask, ASCENDC_TPL_UI_RANGE, 1, 6, 7),
+        ASCENDC_TPL_UINT_SEL(addMask, ASCENDC_TPL_UI_RANGE, 1, 0, 7)
+    ),
+    ASCENDC_TPL_ARGS_SEL(
+        ASCENDC_TPL_UINT_SEL(schMode, ASCENDC_TPL_UI_LIST, TPL_SCH_MODE_0, TPL_SCH_MODE_1),
+        ASCENDC_TPL_DTYPE_SEL(dType, TPL_FP16, TPL_BF16, TPL_FP32),
+        ASCENDC_TPL_UINT_SEL(form, ASCENDC_TPL_UI_LIST, TPL_FORM_MULADD),
+        ASCENDC_TPL_UINT_SEL(inputNum, ASCENDC_TPL_UI_LIST, 3),
+        ASCENDC_TPL_UINT_SEL(lhsMask, ASCENDC_TPL_UI_LIST, 7),
+        ASCENDC_TPL_UINT_SEL(rhsMask, ASCENDC_TPL_UI_RANGE, 1, 7, 7),
+        ASCENDC_TPL_UINT_SEL(addMask, ASCENDC_TPL_UI_RANGE, 1, 0, 7)
+    )
+);
+} // namespace EltwiseExprOp
+
+#endif // ELTWISE_EXPR_STRUCT_H_
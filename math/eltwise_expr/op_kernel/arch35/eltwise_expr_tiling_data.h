@@ -0,0 +1,38 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file eltwise_expr_tiling_data.h
+ * \brief EltwiseExpr 算子 TilingData 结构体定义（atvoss 框架 - Elewise 模式）
+ */
+
+#ifndef ELTWISE_EXPR_TILING_DATA_H_
+#define ELTWISE_EXPR_TILING_DATA_H_
+
+#include "atvoss/elewise/elewise_base_struct.h"
+
+constexpr uint32_t ELTWISE_EXPR_MAX_INPUT_NUM = 4;
+// MULADD 范式下 A、B、C 三个仿射项各有 1 个常数项和 N 个输入系数
+constexpr uint32_t ELTWISE_EXPR_MAX_COEFF_NUM = 3 * (ELTWISE_EXPR_MAX_INPUT_NUM + 1);
+
+/**
+ * \struct EltwiseExprTilingData
+ * \brief 自定义 TilingData 包装结构体
+ *
+ * 注意：
+ * 1. baseTiling 必须是第一个成员（框架要求）
+ * 2. coeff 为化简后范式的系数，布局见 eltwise_expr_dag.h，通过 Kernel 入口的 SetVar 注入到 DAG
+ */
+struct EltwiseExprTilingData {
+    ::Ops::Base::EleBaseTilingData baseTiling;    // 框架基础部分（必须第一个成员）
+    float coeff[ELTWISE_EXPR_MAX_COEFF_NUM];      // 范式系数（运行时注入）
+};
+
+#endif // ELTWISE_EXPR_TILING_DATA_H_
@@ -0,0 +1,89 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file eltwise_expr_apt.cpp
+ * \brief EltwiseExpr 算子 Kernel 入口（atvoss 框架 - Elewise 模式）
+ */
+
+#include "kernel_operator.h"
+#include "atvoss/elewise/elewise_sch.h"
+#include "arch35/eltwise_expr_dag.h"
+#include "arch35/eltwise_expr_tiling_data.h"
+#include "arch35/eltwise_expr_struct.h"
+
+using namespace Ops::Base;
+using namespace AscendC;
+
+namespace NsEltwiseExpr {
+template <uint64_t dType>
+struct ExprType;
+
+template <>
+struct ExprType<TPL_FP16> {
+    using type = half;
+};
+
+template <>
+struct ExprType<TPL_BF16> {
+    using type = bfloat16_t;
+};
+
+template <>
+struct ExprType<TPL_FP32> {
+    using type = float;
+};
+
+// 依次把 coeff[I..COUNT) 注入到 Placeholder::Var<float, I>
+template <int I, int COUNT, typename Sch>
+__aicore__ inline void SetCoeffVars(Sch& sch, const float* coeff)
+{
+    if constexpr (I < COUNT) {
+        sch.template SetVar<float, I>(coeff[I]);
+        SetCoeffVars<I + 1, COUNT>(sch, coeff);
+    }
+}
+} // namespace NsEltwiseExpr
+
+/**
+ * \brief EltwiseExpr Kernel 入口（Elewise 模式）
+ *
+ * 模板参数说明：
+ * - schMode: 调度模式（从 TilingKey 获取）
+ * - dType: 数据类型 ID
+ * - form: 化简后的范式（LINEAR / MULADD）
+ * - inputNum: 实际参与计算的输入个数，x0 ~ x{inputNum-1}
+ * - lhsMask / rhsMask / addMask: MULADD 范式下 A、B、C 各自引用的输入掩码，LINEAR 范式固定为 0
+ */
+template <uint64_t schMode, uint64_t dType, uint64_t form, uint64_t inputNum, uint64_t lhsMask, uint64_t rhsMask,
+          uint64_t addMask>
+__global__ __aicore__ void eltwise_expr(GM_ADDR x0, GM_ADDR x1, GM_ADDR x2, GM_ADDR x3, GM_ADDR y,
+                                        GM_ADDR workspace, GM_ADDR tiling)
+{
+    KERNEL_TASK_TYPE_DEFAULT(KERNEL_TYPE_AIV_ONLY);
+    REGISTER_TILING_DEFAULT(EltwiseExprTilingData);
+    GET_TILING_DATA_WITH_STRUCT(EltwiseExprTilingData, tilingData, tiling);
+    TPipe pipe;
+
+    using T = typename NsEltwiseExpr::ExprType<dType>::type;
+    using Form = NsEltwiseExpr::ExprForm<T, form, static_cast<int>(inputNum), lhsMask, rhsMask, addMask>;
+    ElementwiseSch<schMode, typename Form::OpDag> sch(&(tilingData.baseTiling), &pipe);
+    NsEltwiseExpr::SetCoeffVars<0, Form::COEFF_NUM>(sch, tilingData.coeff);
+    if constexpr (inputNum == 1) {
+        sch.Init(x0, y);
+    } else if constexpr (inputNum == 2) {
+        sch.Init(x0, x1, y);
+    } else if constexpr (inputNum == 3) {
+        sch.Init(x0, x1, x2, y);
+    } else {
+        sch.Init(x0, x1, x2, x3, y);
+    }
+    sch.Process();
+}
@@ -0,0 +1,206 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <iostream>
+#include <vector>
+#include <gtest/gtest.h>
+#include "tiling_context_faker.h"
+#include "tiling_case_executor.h"
+#include "../../../../op_kernel/arch35/eltwise_expr_tiling_data.h"
+#include "../../../../op_kernel/arch35/eltwise_expr_struct.h"
+#include "../../../../op_host/arch35/eltwise_expr_tiling_arch35.h"
+
+using namespace std;
+using namespace ge;
+using optiling::EltwiseExprCompileInfo;
+
+namespace {
+constexpr int64_t I0 = optiling::ELTWISE_EXPR_OP_INPUT * optiling::ELTWISE_EXPR_OPERAND_RANGE + 0;
+constexpr int64_t I1 = optiling::ELTWISE_EXPR_OP_INPUT * optiling::ELTWISE_EXPR_OPERAND_RANGE + 1;
+constexpr int64_t I2 = optiling::ELTWISE_EXPR_OP_INPUT * optiling::ELTWISE_EXPR_OPERAND_RANGE + 2;
+constexpr int64_t I3 = optiling::ELTWISE_EXPR_OP_INPUT * optiling::ELTWISE_EXPR_OPERAND_RANGE + 3;
+constexpr int64_t S0 = optiling::ELTWISE_EXPR_OP_SCALAR * optiling::ELTWISE_EXPR_OPERAND_RANGE + 0;
+constexpr int64_t S1 = optiling::ELTWISE_EXPR_OP_SCALAR * optiling::ELTWISE_EXPR_OPERAND_RANGE + 1;
+constexpr int64_t ADD = optiling::ELTWISE_EXPR_OP_ADD * optiling::ELTWISE_EXPR_OPERAND_RANGE;
+constexpr int64_t SUB = optiling::ELTWISE_EXPR_OP_SUB * optiling::ELTWISE_EXPR_OPERAND_RANGE;
+constexpr int64_t MUL = optiling::ELTWISE_EXPR_OP_MUL * optiling::ELTWISE_EXPR_OPERAND_RANGE;
+constexpr int64_t DIV = optiling::ELTWISE_EXPR_OP_DIV * optiling::ELTWISE_EXPR_OPERAND_RANGE;
+constexpr int64_t NEG = optiling::ELTWISE_EXPR_OP_NEG * optiling::ELTWISE_EXPR_OPERAND_RANGE;
+
+gert::TilingContextPara MakeExprPara(
+    EltwiseExprCompileInfo& compileInfo, ge::DataType dtype, const std::vector<uint32_t>& inputInstanceNum,
+    const std::vector<int64_t>& program, const std::vector<float>& scalars)
+{
+    gert::StorageShape shape = {{32, 1024}, {32, 1024}};
+    std::vector<gert::TilingContextPara::TensorDescription> inputs;
+    for (uint32_t present : inputInstanceNum) {
+        if (present != 0) {
+            inputs.push_back({shape, dtype, ge::FORMAT_ND});
+        }
+    }
+    return gert::TilingContextPara(
+        "EltwiseExpr", inputs, {{shape, dtype, ge::FORMAT_ND}},
+        {gert::TilingContextPara::OpAttr("program", Ops::Math::AnyValue::CreateFrom<std::vector<int64_t>>(program)),
+         gert::TilingContextPara::OpAttr("scalars", Ops::Math::AnyValue::CreateFrom<std::vector<float>>(scalars))},
+        inputInstanceNum, {1}, &compileInfo);
+}
+
+void ExpectCoeff(const TilingInfo& info, const std::vector<float>& expect)
+{
+    ASSERT_GE(info.tilingDataSize, sizeof(EltwiseExprTilingData));
+    const auto* tilingData = reinterpret_cast<const EltwiseExprTilingData*>(info.tilingData.get());
+    for (size_t i = 0; i < ELTWISE_EXPR_MAX_COEFF_NUM; i++) {
+        float value = (i < expect.size()) ? expect[i] : 0.0f;
+        EXPECT_FLOAT_EQ(tilingData->coeff[i], value) << "coeff index " << i;
+    }
+}
+
+uint64_t ExpectKey(const TilingInfo& info, uint64_t dType, uint64_t form, uint64_t inputNum, uint64_t lhsMask = 0,
+                   uint64_t rhsMask = 0, uint64_t addMask = 0)
+{
+    const auto* tilingData = reinterpret_cast<const EltwiseExprTilingData*>(info.tilingData.get());
+    return GET_TPL_TILING_KEY(static_cast<uint64_t>(tilingData->baseTiling.scheMode), dType, form, inputNum, lhsMask,
+        rhsMask, addMask);
+}
+} // namespace
+
+class EltwiseExprTilingTest : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        std::cout << "EltwiseExprTiling SetUp" << std::endl;
+    }
+
+    static void TearDownTestCase()
+    {
+        std::cout << "EltwiseExprTiling TearDown" << std::endl;
+    }
+
+    void SetUp() override
+    {
+        compileInfo.coreNum = 64;
+        compileInfo.ubSize = 262144;
+    }
+
+    EltwiseExprCompileInfo compileInfo;
+};
+
+// y = x0 * 2 + x1 - 0.5
+TEST_F(EltwiseExprTilingTest, linear_two_inputs_fp32)
+{
+    auto para = MakeExprPara(compileInfo, ge::DT_FLOAT, {1, 1, 0, 0}, {I0, S0, MUL, I1, ADD, S1, SUB}, {2.0f, 0.5f});
+    TilingInfo info;
+    ASSERT_TRUE(ExecuteTiling(para, info));
+    EXPECT_EQ(info.tilingKey, ExpectKey(info, TPL_FP32, TPL_FORM_LINEAR, 2));
+    EXPECT_EQ(info.workspaceSizes, std::vector<size_t>({0}));
+    ExpectCoeff(info, {-0.5f, 2.0f, 1.0f});
+}
+
+// y = -(x0 / 4)
+TEST_F(EltwiseExprTilingTest, linear_single_input_div_neg_fp16)
+{
+    auto para = MakeExprPara(compileInfo, ge::DT_FLOAT16, {1, 0, 0, 0}, {I0, S0, DIV, NEG}, {4.0f});
+    TilingInfo info;
+    ASSERT_TRUE(ExecuteTiling(para, info));
+    EXPECT_EQ(info.tilingKey, ExpectKey(info, TPL_FP16, TPL_FORM_LINEAR, 1));
+    ExpectCoeff(info, {0.0f, -0.25f});
+}
+
+// y = (x0 + x1) * (x2 - 1) + x0 * 0.5
+TEST_F(EltwiseExprTilingTest, muladd_three_inputs_bf16)
+{
+    auto para = MakeExprPara(
+        compileInfo, ge::DT_BF16, {1, 1, 1, 0}, {I0, I1, ADD, I2, S0, SUB, MUL, I0, S1, MUL, ADD}, {1.0f, 0.5f});
+    TilingInfo info;
+    ASSERT_TRUE(ExecuteTiling(para, info));
+    EXPECT_EQ(info.tilingKey, ExpectKey(info, TPL_BF16, TPL_FORM_MULADD, 3, 0b011, 0b100, 0b001));
+    // A = x0 + x1，B = x2 - 1，C = 0.5 * x0，只写各自引用到的输入的系数
+    ExpectCoeff(info, {0.0f, 1.0f, 1.0f, -1.0f, 1.0f, 0.0f, 0.5f});
+}
+
+// y = 3 - x0 * x1 / 2，乘积项在减号右侧时符号折入 A
+TEST_F(EltwiseExprTilingTest, muladd_product_on_rhs_of_sub)
+{
+    auto para = MakeExprPara(compileInfo, ge::DT_FLOAT, {1, 1, 0, 0}, {S0, I0, I1, MUL, S1, DIV, SUB}, {3.0f, 2.0f});
+    TilingInfo info;
+    ASSERT_TRUE(ExecuteTiling(para, info));
+    EXPECT_EQ(info.tilingKey, ExpectKey(info, TPL_FP32, TPL_FORM_MULADD, 2, 0b01, 0b10, 0));
+    ExpectCoeff(info, {0.0f, -0.5f, 0.0f, 1.0f, 3.0f});
+}
+
+// y = x1 * x0 + x1，交换 A、B 使 A 的掩码不大于 B
+TEST_F(EltwiseExprTilingTest, muladd_swaps_factors_by_mask)
+{
+    auto para = MakeExprPara(compileInfo, ge::DT_FLOAT, {1, 1, 0, 0}, {I1, I0, MUL, I1, ADD}, {});
+    TilingInfo info;
+    ASSERT_TRUE(ExecuteTiling(para, info));
+    EXPECT_EQ(info.tilingKey, ExpectKey(info, TPL_FP32, TPL_FORM_MULADD, 2, 0b01, 0b10, 0b10));
+    ExpectCoeff(info, {0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 1.0f});
+}
+
+// y = (x1 - x1) * x0：系数相消的输入仍按引用保留，不折叠为常数 0
+TEST_F(EltwiseExprTilingTest, cancelled_input_keeps_reference)
+{
+    auto para = MakeExprPara(compileInfo, ge::DT_FLOAT, {1, 1, 0, 0}, {I1, I1, SUB, I0, MUL}, {});
+    TilingInfo info;
+    ASSERT_TRUE(ExecuteTiling(para, info));
+    EXPECT_EQ(info.tilingKey, ExpectKey(info, TPL_FP32, TPL_FORM_MULADD, 2, 0b01, 0b10, 0));
+    ExpectCoeff(info, {0.0f, 1.0f, 0.0f, 0.0f, 0.0f});
+}
+
+TEST_F(EltwiseExprTilingTest, muladd_four_inputs_not_covered)
+{
+    auto para = MakeExprPara(compileInfo, ge::DT_FLOAT, {1, 1, 1, 1}, {I0, I1, MUL, I2, ADD, I3, ADD}, {});
+    TilingInfo info;
+    EXPECT_FALSE(ExecuteTiling(para, info));
+}
+
+TEST_F(EltwiseExprTilingTest, product_of_three_inputs_not_covered)
+{
+    auto para = MakeExprPara(compileInfo, ge::DT_FLOAT, {1, 1, 1, 0}, {I0, I1, MUL, I2, MUL}, {});
+    TilingInfo info;
+    EXPECT_FALSE(ExecuteTiling(para, info));
+}
+
+TEST_F(EltwiseExprTilingTest, divide_by_tensor_not_covered)
+{
+    auto para = MakeExprPara(compileInfo, ge::DT_FLOAT, {1, 1, 0, 0}, {I0, I1, DIV}, {});
+    TilingInfo info;
+    EXPECT_FALSE(ExecuteTiling(para, info));
+}
+
+TEST_F(EltwiseExprTilingTest, invalid_program)
+{
+    TilingInfo info;
+    // 引用了未提供的输入
+    auto missingInput = MakeExprPara(compileInfo, ge::DT_FLOAT, {1, 1, 0, 0}, {I0, I2, ADD}, {});
+    EXPECT_FALSE(ExecuteTiling(missingInput, info));
+    // 引用了越界的标量
+    auto missingScalar = MakeExprPara(compileInfo, ge::DT_FLOAT, {1, 0, 0, 0}, {I0, S1, ADD}, {1.0f});
+    EXPECT_FALSE(ExecuteTiling(missingScalar, info));
+    // 栈下溢 / 结束时栈上残留多个值
+    auto underflow = MakeExprPara(compileInfo, ge::DT_FLOAT, {1, 0, 0, 0}, {I0, ADD}, {});
+    EXPECT_FALSE(ExecuteTiling(underflow, info));
+    auto leftover = MakeExprPara(compileInfo, ge::DT_FLOAT, {1, 1, 0, 0}, {I0, I1}, {});
+    EXPECT_FALSE(ExecuteTiling(leftover, info));
+    // 除以常数 0
+    auto divZero = MakeExprPara(compileInfo, ge::DT_FLOAT, {1, 0, 0, 0}, {I0, S0, DIV}, {0.0f});
+    EXPECT_FALSE(ExecuteTiling(divZero, info));
+    // 提供了未被引用的输入
+    auto unused = MakeExprPara(compileInfo, ge::DT_FLOAT, {1, 1, 0, 0}, {I0, S0, MUL}, {2.0f});
+    EXPECT_FALSE(ExecuteTiling(unused, info));
+}
+
+TEST_F(EltwiseExprTilingTest, optional_inputs_with_gap)
+{
+    auto para = MakeExprPara(compileInfo, ge::DT_FLOAT, {1, 0, 1, 0}, {I0}, {});
+    TilingInfo info;
+    EXPECT_FALSE(ExecuteTiling(para, info));
+}
@@ -0,0 +1,203 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file test_eltwise_expr_apt.cpp
+ * \brief
+ */
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <vector>
+#include "gtest/gtest.h"
+#include "tikicpulib.h"
+#include "tiling_case_executor.h"
+#include "../../../op_kernel/arch35/eltwise_expr_tiling_data.h"
+#include "../../../op_kernel/arch35/eltwise_expr_struct.h"
+#include "../../../op_host/arch35/eltwise_expr_tiling_arch35.h"
+
+using namespace EltwiseExprOp;
+
+#include "../../../op_kernel/eltwise_expr_apt.cpp"
+
+namespace {
+constexpr int64_t kRows = 16;
+constexpr int64_t kCols = 1024;
+constexpr int64_t kElementCount = kRows * kCols;
+
+constexpr int64_t I0 = optiling::ELTWISE_EXPR_OP_INPUT * optiling::ELTWISE_EXPR_OPERAND_RANGE + 0;
+constexpr int64_t I1 = optiling::ELTWISE_EXPR_OP_INPUT * optiling::ELTWISE_EXPR_OPERAND_RANGE + 1;
+constexpr int64_t I2 = optiling::ELTWISE_EXPR_OP_INPUT * optiling::ELTWISE_EXPR_OPERAND_RANGE + 2;
+constexpr int64_t S0 = optiling::ELTWISE_EXPR_OP_SCALAR * optiling::ELTWISE_EXPR_OPERAND_RANGE + 0;
+constexpr int64_t S1 = optiling::ELTWISE_EXPR_OP_SCALAR * optiling::ELTWISE_EXPR_OPERAND_RANGE + 1;
+constexpr int64_t ADD = optiling::ELTWISE_EXPR_OP_ADD * optiling::ELTWISE_EXPR_OPERAND_RANGE;
+constexpr int64_t SUB = optiling::ELTWISE_EXPR_OP_SUB * optiling::ELTWISE_EXPR_OPERAND_RANGE;
+constexpr int64_t MUL = optiling::ELTWISE_EXPR_OP_MUL * optiling::ELTWISE_EXPR_OPERAND_RANGE;
+
+inline size_t Align32(size_t size)
+{
+    return (size + 31U) / 32U * 32U;
+}
+
+template <typename T>
+struct GmTensor {
+    explicit GmTensor(int64_t count) : bytes(Align32(count * sizeof(T)))
+    {
+        addr = static_cast<uint8_t*>(AscendC::GmAlloc(bytes));
+        std::memset(addr, 0, bytes);
+    }
+    ~GmTensor()
+    {
+        AscendC::GmFree(addr);
+    }
+    T* Data()
+    {
+        return reinterpret_cast<T*>(addr);
+    }
+
+    size_t bytes;
+    uint8_t* addr;
+};
+
+optiling::EltwiseExprCompileInfo g_compileInfo = {64, 262144};
+
+bool TilingFor(ge::DataType dtype, size_t inputNum, const std::vector<int64_t>& program,
+               const std::vector<float>& scalars, TilingInfo& info)
+{
+    gert::StorageShape shape = {{kRows, kCols}, {kRows, kCols}};
+    std::vector<gert::TilingContextPara::TensorDescription> inputs(inputNum, {shape, dtype, ge::FORMAT_ND});
+    std::vector<uint32_t> instanceNum(optiling::ELTWISE_EXPR_MAX_INPUT_NUM, 0);
+    for (size_t i = 0; i < inputNum; i++) {
+        instanceNum[i] = 1;
+    }
+    gert::TilingContextPara para(
+        "EltwiseExpr", inputs, {{shape, dtype, ge::FORMAT_ND}},
+        {gert::TilingContextPara::OpAttr("program", Ops::Math::AnyValue::CreateFrom<std::vector<int64_t>>(program)),
+         gert::TilingContextPara::OpAttr("scalars", Ops::Math::AnyValue::CreateFrom<std::vector<float>>(scalars))},
+        instanceNum, {1}, &g_compileInfo);
+    return ExecuteTiling(para, info);
+}
+
+// 按 TilingKey 对应的模板参数拉起 kernel，未提供的输入传入占位地址
+template <uint64_t dType, uint64_t form, uint64_t inputNum, uint64_t lhsMask = 0, uint64_t rhsMask = 0,
+          uint64_t addMask = 0>
+void LaunchExpr(const TilingInfo& info, const std::vector<uint8_t*>& xs, uint8_t* y)
+{
+    uint8_t* workspace = static_cast<uint8_t*>(AscendC::GmAlloc(Align32(1024)));
+    uint8_t* tiling = static_cast<uint8_t*>(AscendC::GmAlloc(Align32(info.tilingDataSize)));
+    uint8_t* dummy = static_cast<uint8_t*>(AscendC::GmAlloc(Align32(1)));
+    std::memcpy(tiling, info.tilingData.get(), info.tilingDataSize);
+    uint8_t* x[optiling::ELTWISE_EXPR_MAX_INPUT_NUM] = {dummy, dummy, dummy, dummy};
+    for (size_t i = 0; i < xs.size(); i++) {
+        x[i] = xs[i];
+    }
+    const auto* tilingData = reinterpret_cast<const EltwiseExprTilingData*>(info.tilingData.get());
+
+    AscendC::SetKernelMode(KernelMode::AIV_MODE);
+    ICPU_SET_TILING_KEY(info.tilingKey);
+    if (tilingData->baseTiling.scheMode == TPL_SCH_MODE_0) {
+        ICPU_RUN_KF((eltwise_expr<TPL_SCH_MODE_0, dType, form, inputNum, lhsMask, rhsMask, addMask>), info.blockNum,
+                    x[0], x[1], x[2], x[3], y, workspace, tiling);
+    } else {
+        ICPU_RUN_KF((eltwise_expr<TPL_SCH_MODE_1, dType, form, inputNum, lhsMask, rhsMask, addMask>), info.blockNum,
+                    x[0], x[1], x[2], x[3], y, workspace, tiling);
+    }
+
+    AscendC::GmFree(workspace);
+    AscendC::GmFree(tiling);
+    AscendC::GmFree(dummy);
+}
+
+float Sample(int64_t i, int64_t salt)
+{
+    return static_cast<float>((i * 7 + salt * 13) % 101) * 0.02f - 1.0f;
+}
+} // namespace
+
+class EltwiseExprKernelTest : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        std::cout << "EltwiseExprKernelTest SetUp" << std::endl;
+    }
+
+    static void TearDownTestCase()
+    {
+        std::cout << "EltwiseExprKernelTest TearDown" << std::endl;
+    }
+};
+
+// y = (x0 + x1) * (x2 - 1) + x0 * 0.5
+TEST_F(EltwiseExprKernelTest, muladd_three_inputs_fp32)
+{
+    TilingInfo info;
+    ASSERT_TRUE(TilingFor(ge::DT_FLOAT, 3, {I0, I1, ADD, I2, S0, SUB, MUL, I0, S1, MUL, ADD}, {1.0f, 0.5f}, info));
+
+    GmTensor<float> x0(kElementCount), x1(kElementCount), x2(kElementCount), y(kElementCount);
+    for (int64_t i = 0; i < kElementCount; i++) {
+        x0.Data()[i] = Sample(i, 0);
+        x1.Data()[i] = Sample(i, 1);
+        x2.Data()[i] = Sample(i, 2);
+    }
+    LaunchExpr<TPL_FP32, TPL_FORM_MULADD, 3, 0b011, 0b100, 0b001>(info, {x0.addr, x1.addr, x2.addr}, y.addr);
+
+    for (int64_t i = 0; i < kElementCount; i++) {
+        float a = x0.Data()[i];
+        float expect = (a + x1.Data()[i]) * (x2.Data()[i] - 1.0f) + a * 0.5f;
+        ASSERT_NEAR(y.Data()[i], expect, 1e-5f * (1.0f + std::fabs(expect))) << "index " << i;
+    }
+}
+
+// y = x0 * 2 + x1 - 0.5
+TEST_F(EltwiseExprKernelTest, linear_two_inputs_fp16)
+{
+    TilingInfo info;
+    ASSERT_TRUE(TilingFor(ge::DT_FLOAT16, 2, {I0, S0, MUL, I1, ADD, S1, SUB}, {2.0f, 0.5f}, info));
+
+    GmTensor<half> x0(kElementCount), x1(kElementCount), y(kElementCount);
+    for (int64_t i = 0; i < kElementCount; i++) {
+        x0.Data()[i] = static_cast<half>(Sample(i, 0));
+        x1.Data()[i] = static_cast<half>(Sample(i, 1));
+    }
+    LaunchExpr<TPL_FP16, TPL_FORM_LINEAR, 2>(info, {x0.addr, x1.addr}, y.addr);
+
+    for (int64_t i = 0; i < kElementCount; i++) {
+        float expect = static_cast<float>(x0.Data()[i]) * 2.0f + static_cast<float>(x1.Data()[i]) - 0.5f;
+        ASSERT_NEAR(static_cast<float>(y.Data()[i]), expect, 1e-3f * (1.0f + std::fabs(expect))) << "index " << i;
+    }
+}
+
+// y = x1 * x2 + x0：x0 中的 inf 只出现在 C 中，A、B 不能以 0 * x0 的形式引入 NaN
+TEST_F(EltwiseExprKernelTest, muladd_absent_input_inf_fp32)
+{
+    TilingInfo info;
+    ASSERT_TRUE(TilingFor(ge::DT_FLOAT, 3, {I1, I2, MUL, I0, ADD}, {}, info));
+
+    GmTensor<float> x0(kElementCount), x1(kElementCount), x2(kElementCount), y(kElementCount);
+    for (int64_t i = 0; i < kElementCount; i++) {
+        x0.Data()[i] = (i % 3 == 0) ? INFINITY : Sample(i, 0);
+        x1.Data()[i] = (i % 5 == 0) ? -INFINITY : Sample(i, 1);
+        x2.Data()[i] = Sample(i, 2) + 2.5f;
+    }
+    LaunchExpr<TPL_FP32, TPL_FORM_MULADD, 3, 0b010, 0b100, 0b001>(info, {x0.addr, x1.addr, x2.addr}, y.addr);
+
+    for (int64_t i = 0; i < kElementCount; i++) {
+        float expect = x1.Data()[i] * x2.Data()[i] + x0.Data()[i];
+        if (std::isnan(expect)) {
+            ASSERT_TRUE(std::isnan(y.Data()[i])) << "index " << i;
+        } else if (std::isinf(expect)) {
+            ASSERT_EQ(y.Data()[i], expect) << "index " << i;
+        } else {
+            ASSERT_NEAR(y.Data()[i], expect, 1e-5f * (1.0f + std::fabs(expect))) << "index " << i;
+        }
+    }
+}
@@ -0,0 +1,165 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file test_equal_tiling_cache_arch35.cpp
+ * \brief tiling cache cases, Equal is used as a typical broadcast op
+ */
+
+#include "../../../../op_host/arch35/equal_tiling_arch35.h"
+#include <cstring>
+#include <gtest/gtest.h>
+#include "op_host/math_tiling_cache.h"
+#include "tiling_context_faker.h"
+#include "tiling_case_executor.h"
+
+using namespace std;
+using namespace ge;
+using Ops::Math::OpTiling::AppendTilingCacheCoreInfo;
+using Ops::Math::OpTiling::TilingCache;
+using Ops::Math::OpTiling::TilingCacheRegistry;
+
+namespace {
+const auto kEqualCoreInfo = AppendTilingCacheCoreInfo<optiling::BroadcastCompileInfo>;
+
+gert::TilingContextPara MakeEqualPara(
+    optiling::BroadcastCompileInfo& compileInfo, const gert::StorageShape& x1, const gert::StorageShape& x2,
+    const gert::StorageShape& y)
+{
+    return gert::TilingContextPara(
+        "Equal",
+        {
+            {x1, ge::DT_FLOAT, ge::FORMAT_ND},
+            {x2, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            {y, ge::DT_BOOL, ge::FORMAT_ND},
+        },
+        &compileInfo);
+}
+
+void ExpectSameTiling(const TilingInfo& lhs, const TilingInfo& rhs)
+{
+    EXPECT_EQ(lhs.tilingKey, rhs.tilingKey);
+    EXPECT_EQ(lhs.blockNum, rhs.blockNum);
+    EXPECT_EQ(lhs.workspaceSizes, rhs.workspaceSizes);
+    ASSERT_EQ(lhs.tilingDataSize, rhs.tilingDataSize);
+    EXPECT_EQ(std::memcmp(lhs.tilingData.get(), rhs.tilingData.get(), lhs.tilingDataSize), 0);
+}
+} // namespace
+
+class EqualTilingCacheTest : public testing::Test {
+protected:
+    void SetUp() override
+    {
+        compileInfo.coreNum = 64;
+        compileInfo.ubSize = 245760;
+    }
+
+    void TearDown() override
+    {
+        TilingCacheRegistry::GetInstance().Disable("Equal");
+    }
+
+    optiling::BroadcastCompileInfo compileInfo;
+};
+
+TEST_F(EqualTilingCacheTest, hit_replays_template_result)
+{
+    auto para = MakeEqualPara(
+        compileInfo, {{1, 9, 6, 1, 7, 10}, {1, 9, 6, 1, 7, 10}}, {{13, 1, 6, 2, 7, 1}, {13, 1, 6, 2, 7, 1}},
+        {{13, 9, 6, 2, 7, 10}, {13, 9, 6, 2, 7, 10}});
+    TilingInfo uncached;
+    ASSERT_TRUE(ExecuteTiling(para, uncached));
+
+    auto cache = TilingCacheRegistry::GetInstance().Enable("Equal", 16, nullptr, kEqualCoreInfo);
+    ASSERT_NE(cache, nullptr);
+    TilingInfo first;
+    ASSERT_TRUE(ExecuteTiling(para, first));
+    EXPECT_EQ(cache->GetMissCount(), 1U);
+    EXPECT_EQ(cache->GetHitCount(), 0U);
+    TilingInfo replayed;
+    ASSERT_TRUE(ExecuteTiling(para, replayed));
+    EXPECT_EQ(cache->GetMissCount(), 1U);
+    EXPECT_EQ(cache->GetHitCount(), 1U);
+
+    ExpectSameTiling(uncached, first);
+    ExpectSameTiling(uncached, replayed);
+}
+
+TEST_F(EqualTilingCacheTest, shape_signature_and_lru_eviction)
+{
+    auto paraA = MakeEqualPara(compileInfo, {{64, 128}, {64, 128}}, {{64, 128}, {64, 128}}, {{64, 128}, {64, 128}});
+    auto paraB = MakeEqualPara(compileInfo, {{64, 1}, {64, 1}}, {{64, 128}, {64, 128}}, {{64, 128}, {64, 128}});
+    auto paraC = MakeEqualPara(compileInfo, {{7}, {7}}, {{7}, {7}}, {{7}, {7}});
+    TilingInfo expectB;
+    ASSERT_TRUE(ExecuteTiling(paraB, expectB));
+
+    auto cache = TilingCacheRegistry::GetInstance().Enable("Equal", 2, nullptr, kEqualCoreInfo);
+    ASSERT_NE(cache, nullptr);
+    TilingInfo info;
+    ASSERT_TRUE(ExecuteTiling(paraA, info));
+    ASSERT_TRUE(ExecuteTiling(paraB, info));
+    EXPECT_EQ(cache->GetMissCount(), 2U);
+    EXPECT_EQ(cache->GetSize(), 2U);
+
+    // A broadcast of the same element count must not alias the elementwise entry.
+    TilingInfo replayedB;
+    ASSERT_TRUE(ExecuteTiling(paraB, replayedB));
+    EXPECT_EQ(cache->GetHitCount(), 1U);
+    ExpectSameTiling(expectB, replayedB);
+
+    // C evicts A (least recently used), B stays resident.
+    ASSERT_TRUE(ExecuteTiling(paraC, info));
+    EXPECT_EQ(cache->GetSize(), 2U);
+    ASSERT_TRUE(ExecuteTiling(paraB, info));
+    EXPECT_EQ(cache->GetHitCount(), 2U);
+    ASSERT_TRUE(ExecuteTiling(paraA, info));
+    EXPECT_EQ(cache->GetMissCount(), 4U);
+}
+
+TEST_F(EqualTilingCacheTest, compile_info_is_part_of_key)
+{
+    auto para = MakeEqualPara(compileInfo, {{4096}, {4096}}, {{4096}, {4096}}, {{4096}, {4096}});
+    optiling::BroadcastCompileInfo otherCompileInfo;
+    otherCompileInfo.coreNum = 8;
+    otherCompileInfo.ubSize = 245760;
+    auto otherPara = MakeEqualPara(otherCompileInfo, {{4096}, {4096}}, {{4096}, {4096}}, {{4096}, {4096}});
+
+    auto cache = TilingCacheRegistry::GetInstance().Enable("Equal", 16, nullptr, kEqualCoreInfo);
+    ASSERT_NE(cache, nullptr);
+    TilingInfo info;
+    ASSERT_TRUE(ExecuteTiling(para, info));
+    ASSERT_TRUE(ExecuteTiling(otherPara, info));
+    EXPECT_EQ(cache->GetHitCount(), 0U);
+    EXPECT_EQ(cache->GetMissCount(), 2U);
+}
+
+// The key holds the compile info fields, not the address: an equal compile info of another node hits.
+TEST_F(EqualTilingCacheTest, equal_compile_info_of_another_node_hits)
+{
+    auto para = MakeEqualPara(compileInfo, {{4096}, {4096}}, {{4096}, {4096}}, {{4096}, {4096}});
+    optiling::BroadcastCompileInfo sameCompileInfo;
+    sameCompileInfo.coreNum = compileInfo.coreNum;
+    sameCompileInfo.ubSize = compileInfo.ubSize;
+    auto samePara = MakeEqualPara(sameCompileInfo, {{4096}, {4096}}, {{4096}, {4096}}, {{4096}, {4096}});
+    TilingInfo expect;
+    ASSERT_TRUE(ExecuteTiling(samePara, expect));
+
+    auto cache = TilingCacheRegistry::GetInstance().Enable("Equal", 16, nullptr, kEqualCoreInfo);
+    ASSERT_NE(cache, nullptr);
+    TilingInfo info;
+    ASSERT_TRUE(ExecuteTiling(para, info));
+    TilingInfo replayed;
+    ASSERT_TRUE(ExecuteTiling(samePara, replayed));
+    EXPECT_EQ(cache->GetMissCount(), 1U);
+    EXPECT_EQ(cache->GetHitCount(), 1U);
+    ExpectSameTiling(expect, replayed);
+}
@@ -10,6 +10,8 @@
 
 #include "expand_aicpu.h"
 
+#include <algorithm>
+#include <atomic>
 #include <map>
 #include <vector>
 
@@ -21,6 +23,10 @@ namespace {
 constexpr uint32_t kInputNum = 2;
 constexpr uint32_t kOutputNum = 1;
 const char* const kExpand = "Expand";
+// Units smaller than this are merged into one shard so per-task scheduling does not dominate the copies.
+constexpr int64_t kMinShardBytes = 64 * 1024;
+// Leading dims are folded into the shard grid until each core has at least this many units.
+constexpr int64_t kUnitsPerCore = 4;
 
 #define EXPAND_EMPTY_TENSOR_CASE(DTYPE, TYPE, CTX) \
     case (DTYPE): {                                \
@@ -80,200 +86,237 @@ uint32_t NormalizeExpandShape(std::vector<IndexT>& input_shape, std::vector<Inde
     return aicpu::KERNEL_STATUS_OK;
 }
 
-template <typename T, typename IndexT>
-uint32_t CalculateOutIndex(const std::vector<T>& input_values, std::vector<T>& output_values,
-                           const std::vector<IndexT>& input_shape, uint64_t copy_size, uint64_t expand_factor)
+// Broadcast plan over collapsed output dims. Adjacent dims of the same kind (copied from input or
+// replicated from a size-1 input dim) are merged, so consecutive dims always alternate in kind.
+struct BroadcastPlan {
+    std::vector<int64_t> out_dims;
+    std::vector<int64_t> in_strides;  // element stride into the input, 0 on replicated dims
+    std::vector<int64_t> block_elems; // block_elems[k] = out_dims[k] * ... * out_dims[rank - 1]
+    int64_t total = 1;
+};
+
+template <typename IndexT>
+BroadcastPlan MakeBroadcastPlan(const std::vector<IndexT>& input_shape, const std::vector<IndexT>& target_shape)
 {
-    uint64_t input_size = 1;
-    for (auto dim : input_shape) {
-        input_size *= static_cast<uint64_t>(dim);
+    BroadcastPlan plan;
+    std::vector<bool> replicated;
+    for (size_t i = 0; i < target_shape.size(); ++i) {
+        const int64_t out_dim = static_cast<int64_t>(target_shape[i]);
+        plan.total *= out_dim;
+        if (out_dim == 1) {
+            continue;
+        }
+        const bool is_replicated = (static_cast<int64_t>(input_shape[i]) == 1);
+        if (!plan.out_dims.empty() && (replicated.back() == is_replicated)) {
+            plan.out_dims.back() *= out_dim;
+        } else {
+            plan.out_dims.push_back(out_dim);
+            replicated.push_back(is_replicated);
+        }
     }
 
-    uint64_t copy_num = input_size / copy_size;
-    for (uint64_t i = 0; i < copy_num; ++i) {
-        for (uint64_t j = 0; j < expand_factor; ++j) {
-            output_values.insert(output_values.end(), input_values.begin() + (i * copy_size),
-                                 input_values.begin() + ((i + 1) * copy_size));
+    const size_t rank = plan.out_dims.size();
+    plan.in_strides.assign(rank, 0);
+    plan.block_elems.assign(rank + 1, 1);
+    int64_t in_stride = 1;
+    for (size_t i = rank; i > 0; --i) {
+        plan.block_elems[i - 1] = plan.block_elems[i] * plan.out_dims[i - 1];
+        if (!replicated[i - 1]) {
+            plan.in_strides[i - 1] = in_stride;
+            in_stride *= plan.out_dims[i - 1];
         }
     }
-    return aicpu::KERNEL_STATUS_OK;
+    return plan;
 }
 
-template <typename T, typename IndexT>
-uint32_t CopyExpandIndex(const std::vector<T>& input_values, std::vector<T>& output_values,
-                         const std::vector<IndexT>& input_shape, const std::vector<IndexT>& target_shape)
+// Writes `count` copies of the element at src into dst.
+inline void FillElement(uint8_t* dst, const uint8_t* src, int64_t count, size_t elem_size)
 {
-    output_values.clear();
-    uint64_t expand_factor = 1;
-    uint64_t copy_size = 1;
-    uint64_t break_axis = 0;
-
-    for (int64_t i = static_cast<int64_t>(input_shape.size()) - 1; i >= 0; --i) {
-        if (!aicpu::IsValueEqual<IndexT>(input_shape[static_cast<size_t>(i)], target_shape[static_cast<size_t>(i)])) {
-            if (!aicpu::IsValueEqual<IndexT>(input_shape[static_cast<size_t>(i)], static_cast<IndexT>(1))) {
-                KERNEL_LOG_ERROR("Param error, input_shape[%ld] != 1 when input_shape[%ld] != target_shape[%ld].", i, i,
-                                 i);
-                return aicpu::KERNEL_STATUS_PARAM_INVALID;
-            }
-            if (target_shape[static_cast<size_t>(i)] < 0) {
-                KERNEL_LOG_ERROR("Param error, target_shape[%ld] is invalid at axis[%ld].",
-                                 static_cast<int64_t>(target_shape[static_cast<size_t>(i)]), i);
-                return aicpu::KERNEL_STATUS_PARAM_INVALID;
+    switch (elem_size) {
+        case sizeof(uint8_t):
+            std::fill_n(dst, count, *src);
+            return;
+        case sizeof(uint16_t):
+            std::fill_n(reinterpret_cast<uint16_t*>(dst), count, *reinterpret_cast<const uint16_t*>(src));
+            return;
+        case sizeof(uint32_t):
+            std::fill_n(reinterpret_cast<uint32_t*>(dst), count, *reinterpret_cast<const uint32_t*>(src));
+            return;
+        case sizeof(uint64_t):
+            std::fill_n(reinterpret_cast<uint64_t*>(dst), count, *reinterpret_cast<const uint64_t*>(src));
+            return;
+        default:
+            for (int64_t i = 0; i < count; ++i) {
+                std::copy(src, src + elem_size, dst + static_cast<size_t>(i) * elem_size);
             }
-            expand_factor = static_cast<uint64_t>(target_shape[static_cast<size_t>(i)]);
-            break_axis = static_cast<uint64_t>(i);
-            break;
-        }
+            return;
     }
+}
 
-    if (!input_shape.empty()) {
-        if (break_axis == 0) {
-            for (uint64_t i = input_shape.size() - 1; i > 0; --i) {
-                copy_size *= static_cast<uint64_t>(input_shape[i]);
-            }
-        } else {
-            for (uint64_t i = input_shape.size() - 1; i >= break_axis; --i) {
-                copy_size *= static_cast<uint64_t>(input_shape[i]);
-                if (i == break_axis) {
-                    break;
-                }
-            }
+// dst[0, filled_bytes) already holds one copy of the block; replicate it up to total_bytes by copying
+// the filled prefix onto itself, doubling the filled size on each step.
+inline bool DoublingCopy(uint8_t* dst, size_t filled_bytes, size_t total_bytes)
+{
+    while (filled_bytes < total_bytes) {
+        const size_t copy_bytes = std::min(filled_bytes, total_bytes - filled_bytes);
+        if (!aicpu::BiggerMemCpy(dst + filled_bytes, copy_bytes, dst, copy_bytes)) {
+            return false;
         }
+        filled_bytes += copy_bytes;
     }
-
-    return CalculateOutIndex<T, IndexT>(input_values, output_values, input_shape, copy_size, expand_factor);
+    return true;
 }
 
-template <typename T, typename IndexT>
-uint32_t GetExpandIndex(const std::vector<T>& input_values, std::vector<T>& output_values,
-                        const std::vector<IndexT>& input_shape, const std::vector<IndexT>& target_shape,
-                        std::vector<IndexT>& expanded_shape)
+// Materialises the output block spanned by dims [dim, rank) directly into dst.
+bool FillBlock(const BroadcastPlan& plan, size_t dim, const uint8_t* src, uint8_t* dst, size_t elem_size)
 {
-    IndexT expand_factor = static_cast<IndexT>(1);
-    uint64_t break_axis = 0;
-
-    for (int64_t i = static_cast<int64_t>(input_shape.size()) - 1; i >= 0; --i) {
-        if (!aicpu::IsValueEqual<IndexT>(input_shape[static_cast<size_t>(i)], target_shape[static_cast<size_t>(i)])) {
-            if (!aicpu::IsValueEqual<IndexT>(input_shape[static_cast<size_t>(i)], static_cast<IndexT>(1))) {
-                KERNEL_LOG_ERROR("Param error, input_shape[%ld] != 1 when input_shape[%ld] != target_shape[%ld].", i, i,
-                                 i);
-                return aicpu::KERNEL_STATUS_PARAM_INVALID;
-            }
-            expand_factor = target_shape[static_cast<size_t>(i)];
-            break_axis = static_cast<uint64_t>(i);
-            break;
+    const size_t rank = plan.out_dims.size();
+    const int64_t count = plan.out_dims[dim];
+    const size_t sub_bytes = static_cast<size_t>(plan.block_elems[dim + 1]) * elem_size;
+    const bool innermost = (dim + 1 == rank);
+    if (plan.in_strides[dim] == 0) {
+        if (innermost) {
+            FillElement(dst, src, count, elem_size);
+            return true;
         }
+        if (!FillBlock(plan, dim + 1, src, dst, elem_size)) {
+            return false;
+        }
+        return DoublingCopy(dst, sub_bytes, static_cast<size_t>(count) * sub_bytes);
     }
-
-    std::vector<IndexT> temp_shape = input_shape;
-    temp_shape[break_axis] = expand_factor;
-    if (CopyExpandIndex<T, IndexT>(input_values, output_values, input_shape, temp_shape) != aicpu::KERNEL_STATUS_OK) {
-        return aicpu::KERNEL_STATUS_PARAM_INVALID;
+    if (innermost) {
+        const size_t copy_bytes = static_cast<size_t>(count) * elem_size;
+        return aicpu::BiggerMemCpy(dst, copy_bytes, src, copy_bytes);
     }
-    expanded_shape = std::move(temp_shape);
-    return aicpu::KERNEL_STATUS_OK;
+    const size_t src_step = static_cast<size_t>(plan.in_strides[dim]) * elem_size;
+    for (int64_t i = 0; i < count; ++i) {
+        if (!FillBlock(plan, dim + 1, src + static_cast<size_t>(i) * src_step,
+                       dst + static_cast<size_t>(i) * sub_bytes, elem_size)) {
+            return false;
+        }
+    }
+    return true;
 }
 
-template <typename T, typename IndexT>
-uint32_t ExpandByLayer(std::vector<T> input_values, std::vector<T>& output_values, std::vector<IndexT> input_shape,
-                       const std::vector<IndexT>& target_shape)
+// Rank-1 plan: the output is either a plain copy of the input or one element repeated.
+uint32_t ExpandFlat(const aicpu::CpuKernelContext& ctx, const BroadcastPlan& plan, const uint8_t* input,
+                    uint8_t* output, size_t elem_size)
 {
-    std::vector<IndexT> expanded_shape;
-    bool need_continue = true;
-    while (need_continue) {
-        if (GetExpandIndex<T, IndexT>(input_values, output_values, input_shape, target_shape, expanded_shape) !=
-            aicpu::KERNEL_STATUS_OK) {
-            return aicpu::KERNEL_STATUS_PARAM_INVALID;
+    const bool replicated = (plan.in_strides[0] == 0);
+    std::atomic<bool> shard_ok(true);
+    auto shard = [&shard_ok, replicated, input, output, elem_size](int64_t begin, int64_t end) {
+        uint8_t* dst = output + static_cast<size_t>(begin) * elem_size;
+        if (replicated) {
+            FillElement(dst, input, end - begin, elem_size);
+            return;
         }
-        need_continue = false;
-        for (size_t i = 0; i < input_shape.size(); ++i) {
-            if (!aicpu::IsValueEqual<IndexT>(target_shape[i], expanded_shape[i])) {
-                need_continue = true;
-                break;
-            }
-        }
-        if (need_continue) {
-            input_values = output_values;
-            input_shape = expanded_shape;
+        const size_t copy_bytes = static_cast<size_t>(end - begin) * elem_size;
+        if (!aicpu::BiggerMemCpy(dst, copy_bytes, input + static_cast<size_t>(begin) * elem_size, copy_bytes)) {
+            shard_ok.store(false, std::memory_order_relaxed);
         }
+    };
+    const int64_t cores = static_cast<int64_t>(std::max(1U, aicpu::CpuKernelUtils::GetCPUNum(ctx)));
+    const int64_t min_unit = std::max(static_cast<int64_t>(1), kMinShardBytes / static_cast<int64_t>(elem_size));
+    const int64_t per_unit = std::max(min_unit, (plan.total + cores - 1) / cores);
+    const uint32_t ret = aicpu::CpuKernelUtils::ParallelFor(ctx, plan.total, per_unit, shard);
+    if (ret != aicpu::KERNEL_STATUS_OK) {
+        KERNEL_LOG_ERROR("Expand ParallelFor failed, rc=%u, total=%ld, per_unit=%ld.", ret, plan.total, per_unit);
+        return ret;
+    }
+    if (!shard_ok.load(std::memory_order_relaxed)) {
+        KERNEL_LOG_ERROR("Expand flat copy failed, total=%ld.", plan.total);
+        return aicpu::KERNEL_STATUS_INNER_ERROR;
     }
     return aicpu::KERNEL_STATUS_OK;
 }
 
-template <typename T, typename IndexT>
-uint32_t PrepareExpandShape(std::vector<T>& input_values, std::vector<IndexT>& input_shape,
-                            std::vector<IndexT>& target_shape, const std::vector<int64_t>& origin_shape,
-                            const T* input_data)
+// Shards the output over the leading `split` collapsed dims; every unit builds its block of dims
+// [split, rank) straight from the input, so no intermediate buffers are allocated.
+uint32_t ExpandBlocks(const aicpu::CpuKernelContext& ctx, const BroadcastPlan& plan, const uint8_t* input,
+                      uint8_t* output, size_t elem_size)
 {
-    for (auto dim : origin_shape) {
-        input_shape.push_back(static_cast<IndexT>(dim));
+    const size_t rank = plan.out_dims.size();
+    const int64_t cores = static_cast<int64_t>(std::max(1U, aicpu::CpuKernelUtils::GetCPUNum(ctx)));
+    size_t split = 1;
+    int64_t units = plan.out_dims[0];
+    while ((split + 1 < rank) && (units < cores * kUnitsPerCore)) {
+        units *= plan.out_dims[split];
+        ++split;
     }
+    const size_t unit_bytes = static_cast<size_t>(plan.block_elems[split]) * elem_size;
+
+    std::atomic<bool> shard_ok(true);
+    auto shard = [&shard_ok, &plan, split, unit_bytes, input, output, elem_size](int64_t begin, int64_t end) {
+        for (int64_t unit = begin; unit < end; ++unit) {
+            int64_t rest = unit;
+            int64_t src_offset = 0;
+            for (size_t k = split; k > 0; --k) {
+                src_offset += (rest % plan.out_dims[k - 1]) * plan.in_strides[k - 1];
+                rest /= plan.out_dims[k - 1];
+            }
+            if (!FillBlock(plan, split, input + static_cast<size_t>(src_offset) * elem_size,
+                           output + static_cast<size_t>(unit) * unit_bytes, elem_size)) {
+                shard_ok.store(false, std::memory_order_relaxed);
+                return;
+            }
+        }
+    };
 
-    uint64_t input_num = 1;
-    for (auto dim : input_shape) {
-        input_num *= static_cast<uint64_t>(dim);
+    const int64_t min_unit = std::max(static_cast<int64_t>(1), kMinShardBytes / static_cast<int64_t>(unit_bytes));
+    const int64_t per_unit = std::max(min_unit, (units + cores - 1) / cores);
+    KERNEL_LOG_INFO("Expand broadcast plan: rank=%zu, split=%zu, units=%ld, per_unit=%ld.", rank, split, units,
+                    per_unit);
+    const uint32_t ret = aicpu::CpuKernelUtils::ParallelFor(ctx, units, per_unit, shard);
+    if (ret != aicpu::KERNEL_STATUS_OK) {
+        KERNEL_LOG_ERROR("Expand ParallelFor failed, rc=%u, units=%ld, per_unit=%ld.", ret, units, per_unit);
+        return ret;
     }
-
-    for (uint64_t i = 0; i < input_num; ++i) {
-        input_values.push_back(input_data[i]);
+    if (!shard_ok.load(std::memory_order_relaxed)) {
+        KERNEL_LOG_ERROR("Expand block copy failed, units=%ld.", units);
+        return aicpu::KERNEL_STATUS_INNER_ERROR;
     }
-
-    return NormalizeExpandShape(input_shape, target_shape);
+    return aicpu::KERNEL_STATUS_OK;
 }
 
 template <typename T, typename IndexT>
 uint32_t DoExpandCompute(const aicpu::CpuKernelContext& ctx)
 {
-    const auto* input_data = static_cast<const T*>(ctx.Input(0)->GetData());
+    const auto* input_data = static_cast<const uint8_t*>(ctx.Input(0)->GetData());
     const auto* shape_data = static_cast<const IndexT*>(ctx.Input(1)->GetData());
-    auto* output_data = static_cast<T*>(ctx.Output(0)->GetData());
+    auto* output_data = static_cast<uint8_t*>(ctx.Output(0)->GetData());
 
-    const auto* input_tensor = ctx.Input(0);
-    const auto* shape_tensor = ctx.Input(1);
-
-    std::vector<int64_t> origin_shape = input_tensor->GetTensorShape()->GetDimSizes();
-    const std::vector<int64_t> shape_shape = shape_tensor->GetTensorShape()->GetDimSizes();
+    std::vector<int64_t> origin_shape = ctx.Input(0)->GetTensorShape()->GetDimSizes();
+    const std::vector<int64_t> shape_shape = ctx.Input(1)->GetTensorShape()->GetDimSizes();
     if (origin_shape.empty()) {
         origin_shape.push_back(static_cast<int64_t>(1));
     }
 
-    std::vector<T> output_values;
-    std::vector<T> input_values;
     std::vector<IndexT> input_shape;
     std::vector<IndexT> target_shape;
+    for (auto dim : origin_shape) {
+        input_shape.push_back(static_cast<IndexT>(dim));
+    }
     for (int64_t i = 0; i < shape_shape[0]; ++i) {
         target_shape.push_back(shape_data[i]);
     }
 
-    uint32_t ret = PrepareExpandShape<T, IndexT>(input_values, input_shape, target_shape, origin_shape, input_data);
+    uint32_t ret = NormalizeExpandShape(input_shape, target_shape);
     if (ret != aicpu::KERNEL_STATUS_OK) {
         return ret;
     }
 
-    bool need_expand = false;
-    for (size_t i = 0; i < input_shape.size(); ++i) {
-        if (!aicpu::IsValueEqual<IndexT>(input_shape[i], target_shape[i])) {
-            need_expand = true;
-            break;
-        }
-    }
-
-    if (!need_expand) {
-        for (size_t i = 0; i < input_values.size(); ++i) {
-            output_data[i] = input_values[i];
-        }
+    const BroadcastPlan plan = MakeBroadcastPlan(input_shape, target_shape);
+    if (plan.total == 0) {
         return aicpu::KERNEL_STATUS_OK;
     }
-
-    ret = ExpandByLayer<T, IndexT>(input_values, output_values, input_shape, target_shape);
-    if (ret != aicpu::KERNEL_STATUS_OK) {
-        return ret;
+    if (plan.out_dims.empty()) {
+        *reinterpret_cast<T*>(output_data) = *reinterpret_cast<const T*>(input_data);
+        return aicpu::KERNEL_STATUS_OK;
     }
-
-    for (size_t i = 0; i < output_values.size(); ++i) {
-        output_data[i] = output_values[i];
+    if (plan.out_dims.size() == 1) {
+        return ExpandFlat(ctx, plan, input_data, output_data, sizeof(T));
     }
-    return aicpu::KERNEL_STATUS_OK;
+    return ExpandBlocks(ctx, plan, input_data, output_data, sizeof(T));
 }
 
 template <typename IndexT>
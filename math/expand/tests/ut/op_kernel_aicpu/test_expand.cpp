@@ -150,4 +150,94 @@ TEST_F(TEST_EXPAND_UT, TestExpandNegativeOneUsesInputDim)
     CREATE_EXPAND_NODEDEF(shapes, data_types, datas);
     RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
     EXPECT_TRUE(CompareResult<int32_t>(output, expected, 24));
-}
\ No newline at end of file
+}
+TEST_F(TEST_EXPAND_UT, TestExpandMixedBroadcastAxes)
+{
+    vector<DataType> data_types = {DT_FLOAT, DT_INT64, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{3, 1, 5, 1}, {5}, {2, 3, 4, 5, 6}};
+    vector<float> input(15);
+    for (size_t i = 0; i < input.size(); ++i) {
+        input[i] = static_cast<float>(i);
+    }
+    int64_t shape[5] = {2, 3, 4, 5, 6};
+    vector<float> output(720, 0.0F);
+    vector<float> expected(720);
+    for (int64_t n = 0; n < 2; ++n) {
+        for (int64_t c = 0; c < 3; ++c) {
+            for (int64_t h = 0; h < 4; ++h) {
+                for (int64_t w = 0; w < 5; ++w) {
+                    for (int64_t k = 0; k < 6; ++k) {
+                        expected[(((n * 3 + c) * 4 + h) * 5 + w) * 6 + k] = input[c * 5 + w];
+                    }
+                }
+            }
+        }
+    }
+    vector<void*> datas = {input.data(), shape, output.data()};
+
+    CREATE_EXPAND_NODEDEF(shapes, data_types, datas);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    EXPECT_TRUE(CompareResult<float>(output.data(), expected.data(), 720));
+}
+
+TEST_F(TEST_EXPAND_UT, TestExpandLargeRowBroadcast)
+{
+    constexpr int64_t rows = 512;
+    constexpr int64_t cols = 1024;
+    vector<DataType> data_types = {DT_INT32, DT_INT32, DT_INT32};
+    vector<vector<int64_t>> shapes = {{1, cols}, {2}, {rows, cols}};
+    vector<int32_t> input(cols);
+    for (int64_t i = 0; i < cols; ++i) {
+        input[i] = static_cast<int32_t>(i * 7 - 3);
+    }
+    int32_t shape[2] = {rows, cols};
+    vector<int32_t> output(rows * cols, 0);
+    vector<int32_t> expected(rows * cols);
+    for (int64_t r = 0; r < rows; ++r) {
+        std::copy(input.begin(), input.end(), expected.begin() + r * cols);
+    }
+    vector<void*> datas = {input.data(), shape, output.data()};
+
+    CREATE_EXPAND_NODEDEF(shapes, data_types, datas);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    EXPECT_TRUE(CompareResult<int32_t>(output.data(), expected.data(), rows * cols));
+}
+
+TEST_F(TEST_EXPAND_UT, TestExpandLargeColumnBroadcast)
+{
+    constexpr int64_t rows = 4096;
+    constexpr int64_t cols = 96;
+    vector<DataType> data_types = {DT_FLOAT16, DT_INT64, DT_FLOAT16};
+    vector<vector<int64_t>> shapes = {{rows, 1}, {2}, {rows, cols}};
+    vector<Eigen::half> input(rows);
+    for (int64_t i = 0; i < rows; ++i) {
+        input[i] = static_cast<Eigen::half>(static_cast<float>(i % 2048));
+    }
+    int64_t shape[2] = {rows, cols};
+    vector<Eigen::half> output(rows * cols, static_cast<Eigen::half>(0.0F));
+    vector<Eigen::half> expected(rows * cols);
+    for (int64_t r = 0; r < rows; ++r) {
+        std::fill(expected.begin() + r * cols, expected.begin() + (r + 1) * cols, input[r]);
+    }
+    vector<void*> datas = {input.data(), shape, output.data()};
+
+    CREATE_EXPAND_NODEDEF(shapes, data_types, datas);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    EXPECT_TRUE(CompareResult<Eigen::half>(output.data(), expected.data(), rows * cols));
+}
+
+TEST_F(TEST_EXPAND_UT, TestExpandScalarToLargeVector)
+{
+    constexpr int64_t num = 100000;
+    vector<DataType> data_types = {DT_INT8, DT_INT32, DT_INT8};
+    vector<vector<int64_t>> shapes = {{1}, {1}, {num}};
+    int8_t input[1] = {-5};
+    int32_t shape[1] = {num};
+    vector<int8_t> output(num, 0);
+    vector<int8_t> expected(num, -5);
+    vector<void*> datas = {input, shape, output.data()};
+
+    CREATE_EXPAND_NODEDEF(shapes, data_types, datas);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    EXPECT_TRUE(CompareResult<int8_t>(output.data(), expected.data(), num));
+}
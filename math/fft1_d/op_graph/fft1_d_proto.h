@@ -0,0 +1,51 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file fft1_d_proto.h
+ * \brief
+ */
+#ifndef OPS_OP_PROTO_INC_FFT1_D_OPS_H_
+#define OPS_OP_PROTO_INC_FFT1_D_OPS_H_
+
+#include "graph/operator.h"
+#include "graph/operator_reg.h"
+
+namespace ge {
+/**
+* @brief Computes the complex-to-complex discrete Fourier transform of the last axis of x. \n
+
+* @par Inputs:
+* x: A tensor of complex values. Must be one of the following types: float32, double, complex64, complex128.
+* float32 and double carry every value as a last dimension of 2 (real, imag). \n
+
+* @par Attributes:
+* @li n: An optional int. Length of the transform, the input is zero padded or cropped to it.
+* Default: -1 (length of the input).
+* @li norm: An optional int. Normalization mode, 1 (backward), 2 (forward) or 3 (ortho). Default: 1.
+* @li forward: An optional bool. True for the forward transform, False for the inverse one. Default: True. \n
+
+* @par Outputs:
+* y: A tensor of the same type as x, whose transformed axis has n values. \n
+
+* @par Third-party framework compatibility
+* Compatible with pytorch fft / ifft operator.
+*/
+REG_OP(Fft1D)
+    .INPUT(x, TensorType({DT_FLOAT, DT_DOUBLE, DT_COMPLEX64, DT_COMPLEX128}))
+    .OUTPUT(y, TensorType({DT_FLOAT, DT_DOUBLE, DT_COMPLEX64, DT_COMPLEX128}))
+    .ATTR(n, Int, -1)
+    .ATTR(norm, Int, 1)
+    .ATTR(forward, Bool, true)
+    .OP_END_FACTORY_REG(Fft1D)
+
+} // namespace ge
+
+#endif // OPS_OP_PROTO_INC_FFT1_D_OPS_H_
@@ -0,0 +1,154 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "fft1_d_aicpu.h"
+
+#include <algorithm>
+#include <complex>
+#include <vector>
+
+#include "aicpu/fft_engine.h"
+#include "cpu_kernel_utils.h"
+#include "utils/kernel_util.h"
+
+namespace {
+const char* const kFft1D = "Fft1D";
+// Rows are sharded once rows * n reaches kFftParallelPoints, each shard taking at least kFftMinShardPoints.
+constexpr int64_t kFftParallelPoints = 32 * 1024;
+constexpr int64_t kFftMinShardPoints = 8 * 1024;
+} // namespace
+
+namespace aicpu {
+uint32_t Fft1DCpuKernel::Compute(CpuKernelContext& ctx)
+{
+    Fft1DParams params;
+    KERNEL_HANDLE_ERROR(ParseParams(ctx, params), "[%s] check params failed.", kFft1D);
+    auto data_type = ctx.Input(kFirstInputIndex)->GetDataType();
+    switch (data_type) {
+        case DT_FLOAT:
+        case DT_COMPLEX64:
+            return Fft1DCompute<float>(ctx, params);
+        case DT_DOUBLE:
+        case DT_COMPLEX128:
+            return Fft1DCompute<double>(ctx, params);
+        default:
+            KERNEL_LOG_ERROR("[%s] invalid input type [%s]", kFft1D, DTypeStr(data_type).c_str());
+            return KERNEL_STATUS_PARAM_INVALID;
+    }
+}
+
+// FLOAT/DOUBLE carry complex values as a trailing (re, im) dim of 2, COMPLEX64/COMPLEX128 as elements.
+uint32_t Fft1DCpuKernel::ParseParams(const CpuKernelContext& ctx, Fft1DParams& params) const
+{
+    Tensor* input = ctx.Input(kFirstInputIndex);
+    Tensor* output = ctx.Output(kFirstOutputIndex);
+    KERNEL_CHECK_NULLPTR(input, KERNEL_STATUS_PARAM_INVALID, "[%s] get input failed.", kFft1D)
+    KERNEL_CHECK_NULLPTR(output, KERNEL_STATUS_PARAM_INVALID, "[%s] get output failed.", kFft1D)
+    KERNEL_CHECK_NULLPTR(input->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] get input data failed.", kFft1D)
+    KERNEL_CHECK_NULLPTR(output->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] get output data failed.", kFft1D)
+    KERNEL_CHECK_NULLPTR(input->GetTensorShape(), KERNEL_STATUS_PARAM_INVALID, "[%s] get input shape failed.", kFft1D)
+    KERNEL_CHECK_NULLPTR(output->GetTensorShape(), KERNEL_STATUS_PARAM_INVALID, "[%s] get output shape failed.",
+                         kFft1D)
+    const DataType data_type = input->GetDataType();
+    KERNEL_CHECK_FALSE(output->GetDataType() == data_type, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] output type [%s] should be the same as input type [%s].", kFft1D,
+                       DTypeStr(output->GetDataType()).c_str(), DTypeStr(data_type).c_str());
+
+    const bool pair = (data_type == DT_FLOAT || data_type == DT_DOUBLE);
+    const int32_t transform_dims = pair ? 2 : 1;
+    std::vector<int64_t> in_dims = input->GetTensorShape()->GetDimSizes();
+    std::vector<int64_t> out_dims = output->GetTensorShape()->GetDimSizes();
+    const int32_t rank = static_cast<int32_t>(in_dims.size());
+    KERNEL_CHECK_FALSE(rank >= transform_dims && out_dims.size() == in_dims.size(), KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] input rank [%d] should be at least [%d] and equal to the output rank [%zu].", kFft1D, rank,
+                       transform_dims, out_dims.size());
+    if (pair) {
+        KERNEL_CHECK_FALSE(in_dims[rank - 1] == 2 && out_dims[rank - 1] == 2, KERNEL_STATUS_PARAM_INVALID,
+                           "[%s] the last dim of real typed input and output should be 2 (real, imag).", kFft1D);
+    }
+    const int32_t axis = rank - transform_dims;
+    params.in_len = in_dims[axis];
+
+    AttrValue* n_attr = ctx.GetAttr("n");
+    params.n = (n_attr == nullptr) ? -1 : n_attr->GetInt();
+    if (params.n == -1) {
+        params.n = params.in_len;
+    }
+    KERNEL_CHECK_FALSE(params.n >= 1 && params.n <= kFftMaxLength, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] n [%ld] should be in [1, %ld].", kFft1D, params.n, kFftMaxLength);
+    AttrValue* norm_attr = ctx.GetAttr("norm");
+    params.norm = (norm_attr == nullptr) ? kFftNormBackward : norm_attr->GetInt();
+    KERNEL_CHECK_FALSE(IsValidFftNorm(params.norm), KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] norm [%ld] should be 1 (backward), 2 (forward) or 3 (ortho).", kFft1D, params.norm);
+    AttrValue* forward_attr = ctx.GetAttr("forward");
+    params.forward = (forward_attr == nullptr) ? true : forward_attr->GetBool();
+
+    params.rows = 1;
+    for (int32_t i = 0; i < axis; i++) {
+        KERNEL_CHECK_FALSE(in_dims[i] == out_dims[i], KERNEL_STATUS_PARAM_INVALID,
+                           "[%s] output dim [%d] should be [%ld], but got [%ld].", kFft1D, i, in_dims[i], out_dims[i]);
+        params.rows *= in_dims[i];
+    }
+    KERNEL_CHECK_FALSE(out_dims[axis] == params.n, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] output dim [%d] should be n [%ld], but got [%ld].", kFft1D, axis, params.n,
+                       out_dims[axis]);
+    return KERNEL_STATUS_OK;
+}
+
+template <typename T>
+uint32_t Fft1DCpuKernel::Fft1DCompute(const CpuKernelContext& ctx, const Fft1DParams& params) const
+{
+    using Complex = std::complex<T>;
+    if (params.rows == 0) {
+        return KERNEL_STATUS_OK;
+    }
+    FftPlan1D<T> plan;
+    KERNEL_CHECK_FALSE(plan.Init(params.n, !params.forward), KERNEL_STATUS_INNER_ERROR,
+                       "[%s] plan a transform of length [%ld] failed.", kFft1D, params.n);
+    const T scale = FftScale<T>(params.n, params.norm, params.forward);
+    const Complex* input = reinterpret_cast<const Complex*>(ctx.Input(kFirstInputIndex)->GetData());
+    Complex* output = reinterpret_cast<Complex*>(ctx.Output(kFirstOutputIndex)->GetData());
+    const int64_t n = params.n;
+    const int64_t in_len = params.in_len;
+    const int64_t copy_len = std::min(in_len, n);
+
+    auto run_rows = [&plan, input, output, scale, n, in_len, copy_len](int64_t start, int64_t end) {
+        // Rows of another length are cropped / zero padded into row first.
+        std::vector<Complex> row(in_len == n ? 0 : n, Complex(0, 0));
+        std::vector<Complex> work(static_cast<size_t>(plan.ScratchSize()));
+        for (int64_t r = start; r < end; r++) {
+            const Complex* src = input + r * in_len;
+            if (in_len != n) {
+                std::copy(src, src + copy_len, row.begin());
+                src = row.data();
+            }
+            Complex* dst = output + r * n;
+            plan.Execute(src, dst, work.data());
+            if (scale != static_cast<T>(1)) {
+                for (int64_t k = 0; k < n; k++) {
+                    dst[k] *= scale;
+                }
+            }
+        }
+    };
+
+    const int64_t cores = std::max<int64_t>(1, static_cast<int64_t>(CpuKernelUtils::GetCPUNum(ctx)));
+    if (cores == 1 || params.rows == 1 || params.rows * n < kFftParallelPoints) {
+        run_rows(0, params.rows);
+        return KERNEL_STATUS_OK;
+    }
+    const int64_t per_unit = std::max((params.rows + cores - 1) / cores, (kFftMinShardPoints + n - 1) / n);
+    KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, params.rows, per_unit, run_rows),
+                        "[%s] ParallelFor failed.", kFft1D)
+    return KERNEL_STATUS_OK;
+}
+
+REGISTER_CPU_KERNEL(kFft1D, Fft1DCpuKernel);
+} // namespace aicpu
@@ -0,0 +1,40 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef AICPU_KERNELS_FFT1_D_H_
+#define AICPU_KERNELS_FFT1_D_H_
+
+#include <cstdint>
+
+#include "cpu_kernel.h"
+
+namespace aicpu {
+// Complex input rows of in_len points transformed to n points (cropped or zero padded) along the last axis.
+struct Fft1DParams {
+    int64_t rows = 0;
+    int64_t in_len = 0;
+    int64_t n = 0;
+    int64_t norm = 1;
+    bool forward = true;
+};
+
+class Fft1DCpuKernel : public CpuKernel {
+public:
+    Fft1DCpuKernel() = default;
+    ~Fft1DCpuKernel() override = default;
+    uint32_t Compute(CpuKernelContext& ctx) override;
+
+private:
+    uint32_t ParseParams(const CpuKernelContext& ctx, Fft1DParams& params) const;
+    template <typename T>
+    uint32_t Fft1DCompute(const CpuKernelContext& ctx, const Fft1DParams& params) const;
+};
+} // namespace aicpu
+#endif // AICPU_KERNELS_FFT1_D_H_
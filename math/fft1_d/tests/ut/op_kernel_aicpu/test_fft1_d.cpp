@@ -0,0 +1,191 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <cmath>
+#include <complex>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "utils/aicpu_test_utils.h"
+#include "cpu_kernel_utils.h"
+#include "node_def_builder.h"
+#include "aicpu/fft_engine.h"
+
+using namespace std;
+using namespace aicpu;
+
+class TEST_FFT1_D_UT : public testing::Test {};
+
+#define CREATE_NODEDEF(shapes, data_types, datas, n, norm, forward) \
+    auto node_def = CpuKernelUtils::CreateNodeDef();                \
+    NodeDefBuilder(node_def.get(), "Fft1D", "Fft1D")                \
+        .Input({"x", data_types[0], shapes[0], datas[0]})           \
+        .Output({"y", data_types[1], shapes[1], datas[1]})          \
+        .Attr("n", (int64_t)(n))                                    \
+        .Attr("norm", (int64_t)(norm))                              \
+        .Attr("forward", (bool)(forward))
+
+namespace {
+// Direct O(n^2) transform of every row of in (rows x in_len), cropped / zero padded to n and scaled.
+vector<complex<double>> NaiveFft(const vector<complex<double>>& in, int64_t rows, int64_t in_len, int64_t n,
+                                 bool forward, double scale)
+{
+    vector<complex<double>> out(rows * n);
+    const double sign = forward ? -1.0 : 1.0;
+    for (int64_t r = 0; r < rows; r++) {
+        for (int64_t k = 0; k < n; k++) {
+            complex<double> acc(0, 0);
+            for (int64_t j = 0; j < min(in_len, n); j++) {
+                acc += in[r * in_len + j] * polar(1.0, sign * 2.0 * M_PI * static_cast<double>((j * k) % n) / n);
+            }
+            out[r * n + k] = acc * scale;
+        }
+    }
+    return out;
+}
+
+template <typename T>
+bool CompareComplex(const complex<T>* output, const vector<complex<double>>& expect, double tol)
+{
+    double max_abs = 1.0;
+    for (const auto& value : expect) {
+        max_abs = max(max_abs, abs(value));
+    }
+    for (size_t i = 0; i < expect.size(); i++) {
+        complex<double> got(output[i].real(), output[i].imag());
+        if (abs(got - expect[i]) > tol * max_abs) {
+            cout << "output[" << i << "] = " << got << ", expect_output[" << i << "] = " << expect[i] << endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T>
+vector<complex<T>> RandomComplex(size_t num)
+{
+    vector<T> raw(num * 2);
+    SetRandomValue<T>(raw.data(), raw.size(), -1.0, 1.0);
+    vector<complex<T>> values(num);
+    for (size_t i = 0; i < num; i++) {
+        values[i] = complex<T>(raw[2 * i], raw[2 * i + 1]);
+    }
+    return values;
+}
+
+template <typename T>
+vector<complex<double>> ToDouble(const vector<complex<T>>& values)
+{
+    vector<complex<double>> out(values.size());
+    for (size_t i = 0; i < values.size(); i++) {
+        out[i] = complex<double>(values[i].real(), values[i].imag());
+    }
+    return out;
+}
+} // namespace
+
+TEST_F(TEST_FFT1_D_UT, FLOAT_PAIR_FORWARD_SUCCESS)
+{
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{4, 2}, {4, 2}};
+    float input[8] = {1, 0, 2, 0, 3, 0, 4, 0};
+    float output[8] = {0};
+    vector<void*> datas = {(void*)input, (void*)output};
+    CREATE_NODEDEF(shapes, data_types, datas, -1, 1, true);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+    float output_exp[8] = {10, 0, -2, 2, -2, 0, -2, -2};
+    EXPECT_TRUE(CompareResultAllClose(output, output_exp, 8));
+}
+
+TEST_F(TEST_FFT1_D_UT, COMPLEX64_INVERSE_BLUESTEIN_ORTHO_SUCCESS)
+{
+    const int64_t rows = 3;
+    const int64_t n = 67;
+    vector<DataType> data_types = {DT_COMPLEX64, DT_COMPLEX64};
+    vector<vector<int64_t>> shapes = {{rows, n}, {rows, n}};
+    auto input = RandomComplex<float>(rows * n);
+    vector<complex<float>> output(rows * n);
+    vector<void*> datas = {(void*)input.data(), (void*)output.data()};
+    CREATE_NODEDEF(shapes, data_types, datas, n, 3, false);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+    auto expect = NaiveFft(ToDouble(input), rows, n, n, false, 1.0 / sqrt(static_cast<double>(n)));
+    EXPECT_TRUE(CompareComplex(output.data(), expect, 1e-5));
+}
+
+TEST_F(TEST_FFT1_D_UT, DOUBLE_PAIR_PAD_AND_CROP_SUCCESS)
+{
+    const int64_t rows = 2;
+    const int64_t in_len = 10;
+    vector<DataType> data_types = {DT_DOUBLE, DT_DOUBLE};
+    auto input = RandomComplex<double>(rows * in_len);
+    for (int64_t n : {24L, 6L}) {
+        vector<vector<int64_t>> shapes = {{rows, in_len, 2}, {rows, n, 2}};
+        vector<complex<double>> output(rows * n);
+        vector<void*> datas = {(void*)input.data(), (void*)output.data()};
+        CREATE_NODEDEF(shapes, data_types, datas, n, 2, true);
+        RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+        auto expect = NaiveFft(input, rows, in_len, n, true, 1.0 / static_cast<double>(n));
+        EXPECT_TRUE(CompareComplex(output.data(), expect, 1e-12));
+    }
+}
+
+TEST_F(TEST_FFT1_D_UT, COMPLEX64_MIXED_RADIX_SHARDED_SUCCESS)
+{
+    // 1920 = 64 * 30, two Rfft1D levels
+    const int64_t rows = 48;
+    const int64_t n = 1920;
+    vector<DataType> data_types = {DT_COMPLEX64, DT_COMPLEX64};
+    vector<vector<int64_t>> shapes = {{4, rows / 4, n}, {4, rows / 4, n}};
+    auto input = RandomComplex<float>(rows * n);
+    vector<complex<float>> output(rows * n);
+    vector<void*> datas = {(void*)input.data(), (void*)output.data()};
+    CREATE_NODEDEF(shapes, data_types, datas, -1, 1, true);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+    auto expect = NaiveFft(ToDouble(input), rows, n, n, true, 1.0);
+    EXPECT_TRUE(CompareComplex(output.data(), expect, 1e-5));
+}
+
+// The AICPU plan takes Bluestein exactly where the Rfft1D tiling does.
+TEST_F(TEST_FFT1_D_UT, PLAN_MATCHES_RFFT1D_FACTORS)
+{
+    for (int64_t n : {1L, 64L, 360L, 1920L, 4097L, 4160L, 48000L, 99991L, 262080L, 262144L}) {
+        uint32_t levels[Ops::Math::FFT_FACTORS_LEN];
+        Ops::Math::CalcFftFactors(static_cast<uint32_t>(n), levels);
+        FftPlan1D<float> plan;
+        ASSERT_TRUE(plan.Init(n, false)) << n;
+        EXPECT_EQ(plan.IsBluestein(), Ops::Math::IsFftBluestein(static_cast<uint32_t>(n), levels)) << n;
+    }
+}
+
+TEST_F(TEST_FFT1_D_UT, INVALID_NORM_FAILED)
+{
+    vector<DataType> data_types = {DT_COMPLEX64, DT_COMPLEX64};
+    vector<vector<int64_t>> shapes = {{8}, {8}};
+    complex<float> input[8] = {};
+    complex<float> output[8] = {};
+    vector<void*> datas = {(void*)input, (void*)output};
+    CREATE_NODEDEF(shapes, data_types, datas, -1, 4, true);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
+}
+
+TEST_F(TEST_FFT1_D_UT, FLOAT_LAST_DIM_NOT_PAIR_FAILED)
+{
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{2, 4}, {2, 4}};
+    float input[8] = {0};
+    float output[8] = {0};
+    vector<void*> datas = {(void*)input, (void*)output};
+    CREATE_NODEDEF(shapes, data_types, datas, -1, 1, true);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
+}
@@ -11,15 +11,9 @@
 #define AICPU_KERNELS_NORMALIZED_GREATER_H_
 
 #include "cpu_kernel.h"
-#include "unsupported/Eigen/CXX11/Tensor"
 #include "utils/bcast.h"
 
 namespace aicpu {
-template <typename T>
-using TensorMap =
-    Eigen::TensorMap<Eigen::Tensor<T, 1, Eigen::RowMajor, Eigen::DenseIndex>,
-                     Eigen::Aligned>;
-
 class GreaterCpuKernel : public CpuKernel {
  public:
   GreaterCpuKernel() = default;
@@ -30,10 +24,6 @@ class GreaterCpuKernel : public CpuKernel {
  private:
   template <typename T>
   uint32_t DoCompute(const CpuKernelContext &ctx);
-
-  template <typename T, int32_t RANK>
-  uint32_t BroadcastCompute(TensorMap<T> &x, TensorMap<T> &y,
-                            TensorMap<bool> &out, const Bcast &bcast);
 };
 }  // namespace aicpu
 #endif
\ No newline at end of file
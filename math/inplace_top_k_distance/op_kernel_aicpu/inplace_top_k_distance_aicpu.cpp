@@ -29,6 +29,28 @@ constexpr uint32_t kPqDistanceInputIndex = 3;
 constexpr uint32_t kPqIndexInputIndex = 4;
 constexpr uint32_t kPqIvfInputIndex = 5;
 constexpr const char* kOrderAsc = "asc";
+// Candidate pools below this size are merged on the calling thread.
+constexpr int64_t kParallelCandidateNum = 64 * 1024;
+// Each shard must scan at least this many candidates per kept top-k slot, otherwise the partial heaps cost more
+// to merge than the scan saves.
+constexpr int64_t kMinCandidatesPerSlot = 8;
+
+// Keeps the best `k` items in a heap whose front is the worst kept item, so a candidate only costs a comparison
+// unless it beats that item.
+template <typename Item, typename Better>
+inline void PushBounded(std::vector<Item>& heap, size_t k, const Item& item, const Better& better)
+{
+    if (heap.size() < k) {
+        heap.push_back(item);
+        std::push_heap(heap.begin(), heap.end(), better);
+        return;
+    }
+    if (better(item, heap.front())) {
+        std::pop_heap(heap.begin(), heap.end(), better);
+        heap.back() = item;
+        std::push_heap(heap.begin(), heap.end(), better);
+    }
+}
 } // namespace
 
 namespace aicpu {
@@ -44,10 +66,10 @@ uint32_t InplaceTopKDistanceCpuKernel::Compute(CpuKernelContext& ctx)
     DataType data_type = inputs.topk_pq_distance->GetDataType();
     switch (data_type) {
         case DT_FLOAT16:
-            res = DoCompute<Eigen::half>(inputs);
+            res = DoCompute<Eigen::half>(ctx, inputs);
             break;
         case DT_FLOAT:
-            res = DoCompute<float>(inputs);
+            res = DoCompute<float>(ctx, inputs);
             break;
         default:
             KERNEL_LOG_ERROR("[%s] input topk_pq_distance only support type[DT_FLOAT16, DT_FLOAT], but got type[%s].",
@@ -144,31 +166,115 @@ uint32_t InplaceTopKDistanceCpuKernel::CheckInputElementNum(const Inputs& inputs
 }
 
 template <typename T>
-uint32_t InplaceTopKDistanceCpuKernel::DoCompute(const Inputs& inputs) const
+uint32_t InplaceTopKDistanceCpuKernel::DoCompute(const CpuKernelContext& ctx, const Inputs& inputs) const
 {
     int64_t topk_elements_num = inputs.topk_pq_distance->NumElements();
     int64_t elements_num = inputs.pq_distance->NumElements();
+    if (topk_elements_num == 0) {
+        return KERNEL_STATUS_OK;
+    }
+    const ItemBetter<T> better(inputs.order->GetString() == kOrderAsc);
 
     std::vector<Item<T>> items;
-    items.reserve(static_cast<size_t>(topk_elements_num + elements_num));
+    if ((elements_num >= kParallelCandidateNum) &&
+        (elements_num >= topk_elements_num * kMinCandidatesPerSlot * 2)) {
+        KERNEL_HANDLE_ERROR(ParallelSelect<T>(ctx, inputs, better, items), "[%s] parallel select failed.",
+                            kInplaceTopKDistance)
+        return ModifyInput(items, inputs);
+    }
 
+    // Seed the bounded heap with the current top-k, then stream the new candidates through it: O(n log k) time and
+    // only k items of scratch instead of materialising and sorting all k + n items.
     const T* topk_value_ptr = static_cast<const T*>(inputs.topk_pq_distance->GetData());
     const int32_t* topk_index_ptr = static_cast<const int32_t*>(inputs.topk_pq_index->GetData());
     const int32_t* topk_ivf_ptr = static_cast<const int32_t*>(inputs.topk_pq_ivf->GetData());
+    items.reserve(static_cast<size_t>(topk_elements_num));
     for (int64_t i = 0; i < topk_elements_num; i++) {
         items.push_back({topk_value_ptr[i], topk_index_ptr[i], topk_ivf_ptr[i]});
     }
+    std::make_heap(items.begin(), items.end(), better);
+    SelectCandidates<T>(inputs, 0, elements_num, better, items);
+    std::sort_heap(items.begin(), items.end(), better);
+    return ModifyInput(items, inputs);
+}
 
+template <typename T>
+void InplaceTopKDistanceCpuKernel::SelectCandidates(const Inputs& inputs, int64_t begin, int64_t end,
+                                                    const ItemBetter<T>& better, std::vector<Item<T>>& heap) const
+{
+    const size_t k = static_cast<size_t>(inputs.topk_pq_distance->NumElements());
     const T* new_value_ptr = static_cast<const T*>(inputs.pq_distance->GetData());
     const int32_t* new_index_ptr = static_cast<const int32_t*>(inputs.pq_index->GetData());
     // pq_ivf is a scalar: every new element shares the same bucket number.
     const int32_t new_ivf = *static_cast<const int32_t*>(inputs.pq_ivf->GetData());
-    for (int64_t i = 0; i < elements_num; i++) {
-        items.push_back({new_value_ptr[i], new_index_ptr[i], new_ivf});
+    for (int64_t i = begin; i < end; i++) {
+        PushBounded(heap, k, Item<T>{new_value_ptr[i], new_index_ptr[i], new_ivf}, better);
     }
+}
 
-    std::sort(items.begin(), items.end(), [](const Item<T>& a, const Item<T>& b) { return a.value < b.value; });
-    return ModifyInput(items, inputs);
+template <typename T>
+uint32_t InplaceTopKDistanceCpuKernel::ParallelSelect(const CpuKernelContext& ctx, const Inputs& inputs,
+                                                      const ItemBetter<T>& better, std::vector<Item<T>>& result) const
+{
+    const int64_t topk_elements_num = inputs.topk_pq_distance->NumElements();
+    const int64_t elements_num = inputs.pq_distance->NumElements();
+    const int64_t cpu_num = static_cast<int64_t>(std::max(1U, CpuKernelUtils::GetCPUNum(ctx)));
+    const int64_t min_shard_len = topk_elements_num * kMinCandidatesPerSlot;
+    const int64_t shard_num = std::max(static_cast<int64_t>(1), std::min(cpu_num, elements_num / min_shard_len));
+    const int64_t shard_len = (elements_num + shard_num - 1) / shard_num;
+
+    // Every shard keeps its own partial top-k over a disjoint slice of the candidates; the current top-k buffer is
+    // one more sorted list for the final merge.
+    std::vector<std::vector<Item<T>>> lists(static_cast<size_t>(shard_num + 1));
+    auto shard = [this, &inputs, &better, &lists, shard_len, elements_num](int64_t begin, int64_t end) {
+        for (int64_t s = begin; s < end; s++) {
+            std::vector<Item<T>>& heap = lists[static_cast<size_t>(s)];
+            heap.reserve(static_cast<size_t>(inputs.topk_pq_distance->NumElements()));
+            SelectCandidates<T>(inputs, s * shard_len, std::min(elements_num, (s + 1) * shard_len), better, heap);
+            std::sort_heap(heap.begin(), heap.end(), better);
+        }
+    };
+    KERNEL_LOG_INFO("[%s] parallel select: candidates=%ld, k=%ld, shards=%ld.", kInplaceTopKDistance, elements_num,
+                    topk_elements_num, shard_num);
+    KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, shard_num, 1, shard),
+                        "[%s] ParallelFor failed, shards=%ld.", kInplaceTopKDistance, shard_num)
+
+    const T* topk_value_ptr = static_cast<const T*>(inputs.topk_pq_distance->GetData());
+    const int32_t* topk_index_ptr = static_cast<const int32_t*>(inputs.topk_pq_index->GetData());
+    const int32_t* topk_ivf_ptr = static_cast<const int32_t*>(inputs.topk_pq_ivf->GetData());
+    std::vector<Item<T>>& current = lists.back();
+    current.reserve(static_cast<size_t>(topk_elements_num));
+    for (int64_t i = 0; i < topk_elements_num; i++) {
+        current.push_back({topk_value_ptr[i], topk_index_ptr[i], topk_ivf_ptr[i]});
+    }
+    std::sort(current.begin(), current.end(), better);
+
+    // k-way merge of the sorted lists: the head heap holds one cursor per non-empty list, worst-first under the
+    // reversed comparator so the front is the best remaining head.
+    std::vector<std::pair<size_t, size_t>> heads;
+    heads.reserve(lists.size());
+    for (size_t l = 0; l < lists.size(); l++) {
+        if (!lists[l].empty()) {
+            heads.emplace_back(l, 0);
+        }
+    }
+    auto head_worse = [&lists, &better](const std::pair<size_t, size_t>& a, const std::pair<size_t, size_t>& b) {
+        return better(lists[b.first][b.second], lists[a.first][a.second]);
+    };
+    std::make_heap(heads.begin(), heads.end(), head_worse);
+    result.clear();
+    result.reserve(static_cast<size_t>(topk_elements_num));
+    while ((static_cast<int64_t>(result.size()) < topk_elements_num) && !heads.empty()) {
+        std::pop_heap(heads.begin(), heads.end(), head_worse);
+        std::pair<size_t, size_t>& head = heads.back();
+        result.push_back(lists[head.first][head.second]);
+        if (++head.second < lists[head.first].size()) {
+            std::push_heap(heads.begin(), heads.end(), head_worse);
+        } else {
+            heads.pop_back();
+        }
+    }
+    return KERNEL_STATUS_OK;
 }
 
 template <typename T>
@@ -179,23 +285,11 @@ uint32_t InplaceTopKDistanceCpuKernel::ModifyInput(const std::vector<Item<T>>& i
     int32_t* topk_index_ptr = static_cast<int32_t*>(inputs.topk_pq_index->GetData());
     int32_t* topk_ivf_ptr = static_cast<int32_t*>(inputs.topk_pq_ivf->GetData());
 
-    std::string order = inputs.order->GetString();
-    if (order == kOrderAsc) {
-        // items_vec is sorted ascending: the first topk_elements_num items are the smallest ones.
-        for (int64_t i = 0; i < topk_elements_num; i++) {
-            topk_value_ptr[i] = items_vec[i].value;
-            topk_index_ptr[i] = items_vec[i].index;
-            topk_ivf_ptr[i] = items_vec[i].ivf;
-        }
-    } else {
-        // Take the largest topk_elements_num items and write them back reversed to get descending order.
-        size_t start = items_vec.size() - static_cast<size_t>(topk_elements_num);
-        int64_t j = topk_elements_num - 1;
-        for (size_t i = start; i < items_vec.size(); i++, j--) {
-            topk_value_ptr[j] = items_vec[i].value;
-            topk_index_ptr[j] = items_vec[i].index;
-            topk_ivf_ptr[j] = items_vec[i].ivf;
-        }
+    // items_vec is ordered best first: ascending for "asc", descending otherwise.
+    for (int64_t i = 0; i < topk_elements_num; i++) {
+        topk_value_ptr[i] = items_vec[i].value;
+        topk_index_ptr[i] = items_vec[i].index;
+        topk_ivf_ptr[i] = items_vec[i].ivf;
     }
     return KERNEL_STATUS_OK;
 }
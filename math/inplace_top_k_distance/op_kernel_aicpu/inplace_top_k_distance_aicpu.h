@@ -44,6 +44,21 @@ private:
         int32_t ivf;
     };
 
+    // Orders items so that the better one (smaller for "asc", larger for "desc") compares less. Used as the heap
+    // comparator, the heap front is the worst item currently kept.
+    template <typename T>
+    class ItemBetter {
+    public:
+        explicit ItemBetter(bool asc) : asc_(asc) {}
+        bool operator()(const Item<T>& a, const Item<T>& b) const
+        {
+            return asc_ ? (a.value < b.value) : (b.value < a.value);
+        }
+
+    private:
+        bool asc_;
+    };
+
     uint32_t GetInputAndCheck(const CpuKernelContext& ctx, Inputs& inputs) const;
 
     uint32_t CheckInputDataType(const Inputs& inputs) const;
@@ -51,7 +66,15 @@ private:
     uint32_t CheckInputElementNum(const Inputs& inputs) const;
 
     template <typename T>
-    uint32_t DoCompute(const Inputs& inputs) const;
+    uint32_t DoCompute(const CpuKernelContext& ctx, const Inputs& inputs) const;
+
+    template <typename T>
+    void SelectCandidates(const Inputs& inputs, int64_t begin, int64_t end, const ItemBetter<T>& better,
+                          std::vector<Item<T>>& heap) const;
+
+    template <typename T>
+    uint32_t ParallelSelect(const CpuKernelContext& ctx, const Inputs& inputs, const ItemBetter<T>& better,
+                            std::vector<Item<T>>& result) const;
 
     template <typename T>
     uint32_t ModifyInput(const std::vector<Item<T>>& items_vec, const Inputs& inputs) const;
@@ -19,6 +19,8 @@
 #undef protected
 #include "Eigen/Core"
 
+#include <algorithm>
+#include <utility>
 #include <vector>
 
 using namespace std;
@@ -231,3 +233,66 @@ TEST_F(TEST_INPLACE_TOP_K_DISTANCE_UT, ATTR_ORDER_MISSING_FAIL)
         .Input({"pq_ivf", data_types[5], shapes[5], datas[5]});
     RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
 }
+
+namespace {
+// Runs the kernel on a candidate pool large enough for the sharded partial top-k path and checks it against a full
+// sort of the merged set. Distances are a permutation of distinct integers, so the expected result is tie-free.
+void RunLargeCandidatePool(const string& order)
+{
+    constexpr int64_t kTopK = 16;
+    constexpr int64_t kCandidateNum = 200000;
+    vector<DataType> data_types = {DT_FLOAT, DT_INT32, DT_INT32, DT_FLOAT, DT_INT32, DT_INT32};
+    vector<vector<int64_t>> shapes = {{kTopK}, {kTopK}, {kTopK}, {kCandidateNum}, {kCandidateNum}, {}};
+
+    vector<float> topk_pq_distance(kTopK);
+    vector<int32_t> topk_pq_index(kTopK);
+    vector<int32_t> topk_pq_ivf(kTopK, 1);
+    for (int64_t i = 0; i < kTopK; i++) {
+        // Interleave the existing results with the new pool so both sides contribute to the merged top-k.
+        topk_pq_distance[i] = static_cast<float>(i * 2 + 1) * 0.5f;
+        topk_pq_index[i] = static_cast<int32_t>(1000000 + i);
+    }
+    vector<float> pq_distance(kCandidateNum);
+    vector<int32_t> pq_index(kCandidateNum);
+    for (int64_t i = 0; i < kCandidateNum; i++) {
+        pq_distance[i] = static_cast<float>((i * 7919) % kCandidateNum);
+        pq_index[i] = static_cast<int32_t>(i);
+    }
+    int32_t pq_ivf = 2;
+
+    vector<pair<float, int32_t>> merged;
+    for (int64_t i = 0; i < kTopK; i++) {
+        merged.emplace_back(topk_pq_distance[i], topk_pq_index[i]);
+    }
+    for (int64_t i = 0; i < kCandidateNum; i++) {
+        merged.emplace_back(pq_distance[i], pq_index[i]);
+    }
+    if (order == "asc") {
+        sort(merged.begin(), merged.end());
+    } else {
+        sort(merged.rbegin(), merged.rend());
+    }
+
+    vector<void*> datas = {(void*)topk_pq_distance.data(), (void*)topk_pq_index.data(), (void*)topk_pq_ivf.data(),
+                           (void*)pq_distance.data(),      (void*)pq_index.data(),      (void*)&pq_ivf};
+    auto node_def = CpuKernelUtils::CreateNodeDef();
+    CREATE_NODEDEF(node_def, shapes, data_types, datas);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+    for (int64_t i = 0; i < kTopK; i++) {
+        EXPECT_FLOAT_EQ(topk_pq_distance[i], merged[i].first);
+        EXPECT_EQ(topk_pq_index[i], merged[i].second);
+        EXPECT_EQ(topk_pq_ivf[i], (merged[i].second >= 1000000) ? 1 : 2);
+    }
+}
+} // namespace
+
+TEST_F(TEST_INPLACE_TOP_K_DISTANCE_UT, LARGE_CANDIDATE_POOL_ASC_SUCC)
+{
+    RunLargeCandidatePool("asc");
+}
+
+TEST_F(TEST_INPLACE_TOP_K_DISTANCE_UT, LARGE_CANDIDATE_POOL_DESC_SUCC)
+{
+    RunLargeCandidatePool("desc");
+}
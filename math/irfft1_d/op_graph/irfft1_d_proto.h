@@ -0,0 +1,49 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file irfft1_d_proto.h
+ * \brief
+ */
+#ifndef OPS_OP_PROTO_INC_IRFFT1_D_OPS_H_
+#define OPS_OP_PROTO_INC_IRFFT1_D_OPS_H_
+
+#include "graph/operator.h"
+#include "graph/operator_reg.h"
+
+namespace ge {
+/**
+* @brief Computes the inverse of Rfft1D: the real signal whose one-sided spectrum is the last axis of x. \n
+
+* @par Inputs:
+* x: A tensor holding the non-negative frequency bins. Must be one of the following types: float32, double,
+* complex64, complex128. float32 and double carry every bin as a last dimension of 2 (real, imag). \n
+
+* @par Attributes:
+* @li n: An optional int. Length of the output signal, bins past n / 2 are ignored and missing ones are zero.
+* Default: -1 (2 * (bins - 1)).
+* @li norm: An optional int. Normalization mode, 1 (backward), 2 (forward) or 3 (ortho). Default: 1. \n
+
+* @par Outputs:
+* y: A real tensor whose last axis has n values. float32 for float32 / complex64 input, double otherwise. \n
+
+* @par Third-party framework compatibility
+* Compatible with pytorch irfft operator.
+*/
+REG_OP(Irfft1D)
+    .INPUT(x, TensorType({DT_FLOAT, DT_DOUBLE, DT_COMPLEX64, DT_COMPLEX128}))
+    .OUTPUT(y, TensorType({DT_FLOAT, DT_DOUBLE}))
+    .ATTR(n, Int, -1)
+    .ATTR(norm, Int, 1)
+    .OP_END_FACTORY_REG(Irfft1D)
+
+} // namespace ge
+
+#endif // OPS_OP_PROTO_INC_IRFFT1_D_OPS_H_
@@ -0,0 +1,194 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "irfft1_d_aicpu.h"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <vector>
+
+#include "aicpu/fft_engine.h"
+#include "cpu_kernel_utils.h"
+#include "utils/kernel_util.h"
+
+namespace {
+const char* const kIrfft1D = "Irfft1D";
+// Rows are sharded once rows * n reaches kIrfftParallelPoints, each shard taking at least kIrfftMinShardPoints.
+constexpr int64_t kIrfftParallelPoints = 32 * 1024;
+constexpr int64_t kIrfftMinShardPoints = 8 * 1024;
+} // namespace
+
+namespace aicpu {
+uint32_t Irfft1DCpuKernel::Compute(CpuKernelContext& ctx)
+{
+    Irfft1DParams params;
+    KERNEL_HANDLE_ERROR(ParseParams(ctx, params), "[%s] check params failed.", kIrfft1D);
+    auto data_type = ctx.Input(kFirstInputIndex)->GetDataType();
+    switch (data_type) {
+        case DT_FLOAT:
+        case DT_COMPLEX64:
+            return Irfft1DCompute<float>(ctx, params);
+        case DT_DOUBLE:
+        case DT_COMPLEX128:
+            return Irfft1DCompute<double>(ctx, params);
+        default:
+            KERNEL_LOG_ERROR("[%s] invalid input type [%s]", kIrfft1D, DTypeStr(data_type).c_str());
+            return KERNEL_STATUS_PARAM_INVALID;
+    }
+}
+
+// FLOAT/DOUBLE inputs carry the spectrum as a trailing (re, im) dim of 2, as Rfft1D writes it.
+uint32_t Irfft1DCpuKernel::ParseParams(const CpuKernelContext& ctx, Irfft1DParams& params) const
+{
+    Tensor* input = ctx.Input(kFirstInputIndex);
+    Tensor* output = ctx.Output(kFirstOutputIndex);
+    KERNEL_CHECK_NULLPTR(input, KERNEL_STATUS_PARAM_INVALID, "[%s] get input failed.", kIrfft1D)
+    KERNEL_CHECK_NULLPTR(output, KERNEL_STATUS_PARAM_INVALID, "[%s] get output failed.", kIrfft1D)
+    KERNEL_CHECK_NULLPTR(input->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] get input data failed.", kIrfft1D)
+    KERNEL_CHECK_NULLPTR(output->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] get output data failed.", kIrfft1D)
+    KERNEL_CHECK_NULLPTR(input->GetTensorShape(), KERNEL_STATUS_PARAM_INVALID, "[%s] get input shape failed.",
+                         kIrfft1D)
+    KERNEL_CHECK_NULLPTR(output->GetTensorShape(), KERNEL_STATUS_PARAM_INVALID, "[%s] get output shape failed.",
+                         kIrfft1D)
+    const DataType data_type = input->GetDataType();
+    const DataType out_type = output->GetDataType();
+    const DataType expect_type = (data_type == DT_COMPLEX64) ? DT_FLOAT :
+                                 (data_type == DT_COMPLEX128) ? DT_DOUBLE : data_type;
+    KERNEL_CHECK_FALSE(out_type == expect_type, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] output type [%s] does not match input type [%s].", kIrfft1D, DTypeStr(out_type).c_str(),
+                       DTypeStr(data_type).c_str());
+
+    const bool pair = (data_type == DT_FLOAT || data_type == DT_DOUBLE);
+    std::vector<int64_t> in_dims = input->GetTensorShape()->GetDimSizes();
+    std::vector<int64_t> out_dims = output->GetTensorShape()->GetDimSizes();
+    const int32_t in_rank = static_cast<int32_t>(in_dims.size());
+    const int32_t axis = in_rank - (pair ? 2 : 1);
+    KERNEL_CHECK_FALSE(axis >= 0 && out_dims.size() == static_cast<size_t>(axis + 1), KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] input rank [%d] does not match output rank [%zu].", kIrfft1D, in_rank, out_dims.size());
+    if (pair) {
+        KERNEL_CHECK_FALSE(in_dims[in_rank - 1] == 2, KERNEL_STATUS_PARAM_INVALID,
+                           "[%s] the last dim of a real typed input should be 2 (real, imag).", kIrfft1D);
+    }
+    params.bins = in_dims[axis];
+
+    AttrValue* n_attr = ctx.GetAttr("n");
+    params.n = (n_attr == nullptr) ? -1 : n_attr->GetInt();
+    if (params.n == -1) {
+        params.n = 2 * (params.bins - 1);
+    }
+    KERNEL_CHECK_FALSE(params.n >= 1 && params.n <= kFftMaxLength, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] n [%ld] should be in [1, %ld].", kIrfft1D, params.n, kFftMaxLength);
+    AttrValue* norm_attr = ctx.GetAttr("norm");
+    params.norm = (norm_attr == nullptr) ? kFftNormBackward : norm_attr->GetInt();
+    KERNEL_CHECK_FALSE(IsValidFftNorm(params.norm), KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] norm [%ld] should be 1 (backward), 2 (forward) or 3 (ortho).", kIrfft1D, params.norm);
+
+    params.rows = 1;
+    for (int32_t i = 0; i < axis; i++) {
+        KERNEL_CHECK_FALSE(in_dims[i] == out_dims[i], KERNEL_STATUS_PARAM_INVALID,
+                           "[%s] output dim [%d] should be [%ld], but got [%ld].", kIrfft1D, i, in_dims[i],
+                           out_dims[i]);
+        params.rows *= in_dims[i];
+    }
+    KERNEL_CHECK_FALSE(out_dims[axis] == params.n, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] output dim [%d] should be n [%ld], but got [%ld].", kIrfft1D, axis, params.n,
+                       out_dims[axis]);
+    return KERNEL_STATUS_OK;
+}
+
+/**
+ * Even n runs one complex inverse FFT of n / 2 points: with E / O the spectra of the even / odd samples,
+ * X[k] = E[k] + w^k O[k] and conj(X[n/2 - k]) = E[k] - w^k O[k] (w = exp(-2*pi*i/n)), so
+ * Z[k] = E[k] + i * O[k] is rebuilt from the bins and its inverse holds the samples as (x[2t], x[2t + 1]) pairs.
+ * Odd n mirrors the bins into the full Hermitian spectrum and keeps the real part of an n point inverse.
+ * Like pocketfft the imaginary parts of the DC and Nyquist bins are ignored.
+ */
+template <typename T>
+uint32_t Irfft1DCpuKernel::Irfft1DCompute(const CpuKernelContext& ctx, const Irfft1DParams& params) const
+{
+    using Complex = std::complex<T>;
+    if (params.rows == 0) {
+        return KERNEL_STATUS_OK;
+    }
+    const int64_t n = params.n;
+    const bool even = (n % 2 == 0);
+    const int64_t half = n / 2;
+    FftPlan1D<T> plan;
+    KERNEL_CHECK_FALSE(plan.Init(even ? half : n, true), KERNEL_STATUS_INNER_ERROR,
+                       "[%s] plan a transform of length [%ld] failed.", kIrfft1D, even ? half : n);
+    // Z is rebuilt without the 1 / 2 of E and O, so its unnormalized inverse matches the n point one.
+    const T scale = FftScale<T>(n, params.norm, false);
+    std::vector<Complex> rotation;
+    if (even) {
+        rotation.resize(static_cast<size_t>(half));
+        for (int64_t k = 0; k < half; k++) {
+            const double angle = 2.0 * M_PI * static_cast<double>(k) / static_cast<double>(n);
+            rotation[k] = Complex(static_cast<T>(std::cos(angle)), static_cast<T>(std::sin(angle)));
+        }
+    }
+    const Complex* input = reinterpret_cast<const Complex*>(ctx.Input(kFirstInputIndex)->GetData());
+    T* output = reinterpret_cast<T*>(ctx.Output(kFirstOutputIndex)->GetData());
+    const int64_t bins = params.bins;
+
+    auto run_rows = [&plan, &rotation, input, output, scale, n, even, half, bins](int64_t start, int64_t end) {
+        const int64_t len = even ? half : n;
+        std::vector<Complex> spectrum(static_cast<size_t>(len));
+        std::vector<Complex> samples(even ? 0 : static_cast<size_t>(n));
+        std::vector<Complex> work(static_cast<size_t>(plan.ScratchSize()));
+        for (int64_t r = start; r < end; r++) {
+            const Complex* x = input + r * bins;
+            auto bin = [x, bins, half, even](int64_t k) {
+                if (k >= bins) {
+                    return Complex(0, 0);
+                }
+                return (k == 0 || (even && k == half)) ? Complex(x[k].real(), 0) : x[k];
+            };
+            T* y = output + r * n;
+            if (even) {
+                for (int64_t k = 0; k < half; k++) {
+                    const Complex a = bin(k);
+                    const Complex b = std::conj(bin(half - k));
+                    const Complex e = a + b;
+                    const Complex o = FftMul(a - b, rotation[k]);
+                    spectrum[k] = Complex(e.real() - o.imag(), e.imag() + o.real());
+                }
+                // n real samples are n / 2 interleaved complex values.
+                plan.Execute(spectrum.data(), reinterpret_cast<Complex*>(y), work.data());
+                for (int64_t t = 0; t < n; t++) {
+                    y[t] *= scale;
+                }
+            } else {
+                spectrum[0] = bin(0);
+                for (int64_t k = 1; k <= half; k++) {
+                    spectrum[k] = bin(k);
+                    spectrum[n - k] = std::conj(spectrum[k]);
+                }
+                plan.Execute(spectrum.data(), samples.data(), work.data());
+                for (int64_t t = 0; t < n; t++) {
+                    y[t] = samples[t].real() * scale;
+                }
+            }
+        }
+    };
+
+    const int64_t cores = std::max<int64_t>(1, static_cast<int64_t>(CpuKernelUtils::GetCPUNum(ctx)));
+    if (cores == 1 || params.rows == 1 || params.rows * n < kIrfftParallelPoints) {
+        run_rows(0, params.rows);
+        return KERNEL_STATUS_OK;
+    }
+    const int64_t per_unit = std::max((params.rows + cores - 1) / cores, (kIrfftMinShardPoints + n - 1) / n);
+    KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, params.rows, per_unit, run_rows),
+                        "[%s] ParallelFor failed.", kIrfft1D)
+    return KERNEL_STATUS_OK;
+}
+
+REGISTER_CPU_KERNEL(kIrfft1D, Irfft1DCpuKernel);
+} // namespace aicpu
@@ -0,0 +1,190 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <cmath>
+#include <complex>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "utils/aicpu_test_utils.h"
+#include "cpu_kernel_utils.h"
+#include "node_def_builder.h"
+
+using namespace std;
+using namespace aicpu;
+
+class TEST_IRFFT1_D_UT : public testing::Test {};
+
+#define CREATE_NODEDEF(shapes, data_types, datas, n, norm) \
+    auto node_def = CpuKernelUtils::CreateNodeDef();       \
+    NodeDefBuilder(node_def.get(), "Irfft1D", "Irfft1D")   \
+        .Input({"x", data_types[0], shapes[0], datas[0]})  \
+        .Output({"y", data_types[1], shapes[1], datas[1]}) \
+        .Attr("n", (int64_t)(n))                           \
+        .Attr("norm", (int64_t)(norm))
+
+namespace {
+// Real inverse of every row of bins (rows x num_bins) as the Hermitian spectrum of n points, scaled.
+vector<double> NaiveIrfft(const vector<complex<double>>& bins, int64_t rows, int64_t num_bins, int64_t n,
+                          double scale)
+{
+    vector<double> out(rows * n);
+    for (int64_t r = 0; r < rows; r++) {
+        for (int64_t t = 0; t < n; t++) {
+            double acc = 0;
+            for (int64_t k = 0; k < n; k++) {
+                const int64_t src = (k <= n / 2) ? k : n - k;
+                if (src >= num_bins) {
+                    continue;
+                }
+                complex<double> value = bins[r * num_bins + src];
+                if (src == 0 || (n % 2 == 0 && src == n / 2)) {
+                    value = complex<double>(value.real(), 0);
+                }
+                if (k != src) {
+                    value = conj(value);
+                }
+                acc += (value * polar(1.0, 2.0 * M_PI * static_cast<double>((k * t) % n) / n)).real();
+            }
+            out[r * n + t] = acc * scale;
+        }
+    }
+    return out;
+}
+
+template <typename T>
+bool CompareReal(const T* output, const vector<double>& expect, double tol)
+{
+    double max_abs = 1.0;
+    for (double value : expect) {
+        max_abs = max(max_abs, fabs(value));
+    }
+    for (size_t i = 0; i < expect.size(); i++) {
+        if (fabs(static_cast<double>(output[i]) - expect[i]) > tol * max_abs) {
+            cout << "output[" << i << "] = " << output[i] << ", expect_output[" << i << "] = " << expect[i] << endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T>
+vector<complex<T>> RandomComplex(size_t num)
+{
+    vector<T> raw(num * 2);
+    SetRandomValue<T>(raw.data(), raw.size(), -1.0, 1.0);
+    vector<complex<T>> values(num);
+    for (size_t i = 0; i < num; i++) {
+        values[i] = complex<T>(raw[2 * i], raw[2 * i + 1]);
+    }
+    return values;
+}
+
+template <typename T>
+vector<complex<double>> ToDouble(const vector<complex<T>>& values)
+{
+    vector<complex<double>> out(values.size());
+    for (size_t i = 0; i < values.size(); i++) {
+        out[i] = complex<double>(values[i].real(), values[i].imag());
+    }
+    return out;
+}
+} // namespace
+
+// Inverse of the Rfft1D output of {1, 2, 3, 4, 5, 6, 7, 8}.
+TEST_F(TEST_IRFFT1_D_UT, FLOAT_PAIR_ROUND_TRIP_SUCCESS)
+{
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{5, 2}, {8}};
+    const float h = 4.0f * (1.0f + std::sqrt(2.0f));
+    const float l = 4.0f * (std::sqrt(2.0f) - 1.0f);
+    float input[10] = {36, 0, -4, h, -4, 4, -4, l, -4, 0};
+    float output[8] = {0};
+    vector<void*> datas = {(void*)input, (void*)output};
+    CREATE_NODEDEF(shapes, data_types, datas, -1, 1);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+    float output_exp[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+    EXPECT_TRUE(CompareResultAllClose(output, output_exp, 8));
+}
+
+TEST_F(TEST_IRFFT1_D_UT, COMPLEX64_ODD_FORWARD_NORM_SUCCESS)
+{
+    const int64_t rows = 3;
+    const int64_t n = 9;
+    const int64_t bins = n / 2 + 1;
+    vector<DataType> data_types = {DT_COMPLEX64, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{rows, bins}, {rows, n}};
+    auto input = RandomComplex<float>(rows * bins);
+    vector<float> output(rows * n);
+    vector<void*> datas = {(void*)input.data(), (void*)output.data()};
+    CREATE_NODEDEF(shapes, data_types, datas, n, 2);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+    auto expect = NaiveIrfft(ToDouble(input), rows, bins, n, 1.0);
+    EXPECT_TRUE(CompareReal(output.data(), expect, 1e-5));
+}
+
+TEST_F(TEST_IRFFT1_D_UT, DOUBLE_PAIR_PAD_AND_CROP_BINS_SUCCESS)
+{
+    const int64_t rows = 2;
+    const int64_t bins = 6;
+    vector<DataType> data_types = {DT_DOUBLE, DT_DOUBLE};
+    auto input = RandomComplex<double>(rows * bins);
+    for (int64_t n : {22L, 6L, 134L}) {
+        vector<vector<int64_t>> shapes = {{rows, bins, 2}, {rows, n}};
+        vector<double> output(rows * n);
+        vector<void*> datas = {(void*)input.data(), (void*)output.data()};
+        CREATE_NODEDEF(shapes, data_types, datas, n, 3);
+        RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+        auto expect = NaiveIrfft(input, rows, bins, n, 1.0 / sqrt(static_cast<double>(n)));
+        EXPECT_TRUE(CompareReal(output.data(), expect, 1e-12));
+    }
+}
+
+TEST_F(TEST_IRFFT1_D_UT, FLOAT_PAIR_SHARDED_SUCCESS)
+{
+    const int64_t rows = 64;
+    const int64_t n = 512;
+    const int64_t bins = n / 2 + 1;
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{rows, bins, 2}, {rows, n}};
+    auto input = RandomComplex<float>(rows * bins);
+    vector<float> output(rows * n);
+    vector<void*> datas = {(void*)input.data(), (void*)output.data()};
+    CREATE_NODEDEF(shapes, data_types, datas, n, 1);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+    auto expect = NaiveIrfft(ToDouble(input), rows, bins, n, 1.0 / static_cast<double>(n));
+    EXPECT_TRUE(CompareReal(output.data(), expect, 1e-5));
+}
+
+TEST_F(TEST_IRFFT1_D_UT, OUTPUT_TYPE_MISMATCH_FAILED)
+{
+    vector<DataType> data_types = {DT_COMPLEX64, DT_DOUBLE};
+    vector<vector<int64_t>> shapes = {{5}, {8}};
+    complex<float> input[5] = {};
+    double output[8] = {0};
+    vector<void*> datas = {(void*)input, (void*)output};
+    CREATE_NODEDEF(shapes, data_types, datas, -1, 1);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
+}
+
+TEST_F(TEST_IRFFT1_D_UT, OUTPUT_LENGTH_MISMATCH_FAILED)
+{
+    vector<DataType> data_types = {DT_COMPLEX64, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{5}, {9}};
+    complex<float> input[5] = {};
+    float output[9] = {0};
+    vector<void*> datas = {(void*)input, (void*)output};
+    CREATE_NODEDEF(shapes, data_types, datas, 8, 1);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
+}
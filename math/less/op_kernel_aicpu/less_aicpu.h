@@ -24,16 +24,6 @@ class LessCpuKernel : public CpuKernel {
  private:
   uint32_t LessParamCheck(const CpuKernelContext &ctx) const;
 
-  template <typename T>
-  void SpecialCompute(BcastShapeType type, int64_t start, int64_t end,
-                      const CpuKernelContext &ctx);
-
-  template <typename T>
-  uint32_t NoBcastCompute(const CpuKernelContext &ctx);
-
-  template <typename T>
-  uint32_t BcastCompute(const CpuKernelContext &ctx, const Bcast &bcast);
-
   template <typename T>
   uint32_t LessCompute(const CpuKernelContext &ctx);
 };
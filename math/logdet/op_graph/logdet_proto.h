@@ -0,0 +1,42 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file logdet_proto.h
+ * \brief
+ */
+#ifndef OPS_OP_PROTO_INC_LOGDET_OPS_H_
+#define OPS_OP_PROTO_INC_LOGDET_OPS_H_
+
+#include "graph/operator.h"
+#include "graph/operator_reg.h"
+
+namespace ge {
+/**
+* @brief Computes the log of the determinant of one or more square matrices by partial-pivot LU factorization. \n
+
+* @par Inputs:
+* x: A tensor of shape [..., N, N]. Must be one of the following types: float32, double, complex64, complex128. \n
+
+* @par Outputs:
+* y: A tensor of shape [...], with the same type as x. For real types NaN when the determinant is negative and -inf
+* when it is zero; for complex types log|det| + i * arg(det). \n
+
+* @par Third-party framework compatibility
+* Compatible with pytorch logdet operator.
+*/
+REG_OP(Logdet)
+    .INPUT(x, TensorType({DT_FLOAT, DT_DOUBLE, DT_COMPLEX64, DT_COMPLEX128}))
+    .OUTPUT(y, TensorType({DT_FLOAT, DT_DOUBLE, DT_COMPLEX64, DT_COMPLEX128}))
+    .OP_END_FACTORY_REG(Logdet)
+
+} // namespace ge
+
+#endif // OPS_OP_PROTO_INC_LOGDET_OPS_H_
@@ -10,9 +10,7 @@
 
 #include "aclnn_logdet.h"
 
-#include "../../../add/op_api/add.h"
-#include "../../../log/op_api/log.h"
-#include "../../../slogdet/op_host/op_api/log_matrix_determinant.h"
+#include "logdet.h"
 #include "aclnn_kernels/cast.h"
 #include "aclnn_kernels/contiguous.h"
 #include "aclnn_kernels/reshape.h"
@@ -157,17 +155,8 @@ aclnnStatus aclnnLogdetGetWorkspaceSize(const aclTensor *self, aclTensor *out, u
     selfReshapeOut = selfContiguous;
   }
 
-  auto logMatrixDeterminantOut = l0op::LogMatrixDeterminant(selfReshapeOut, uniqueExecutor.get());
-  auto signValue = std::get<0>(logMatrixDeterminantOut);
-  const float LOG_BASE = -1.0f;
-  const float LOG_SCALE = 1.0f;
-  const float LOG_SHIFT = 0.0f;
-  auto offset = l0op::Log(signValue, LOG_BASE, LOG_SCALE, LOG_SHIFT, uniqueExecutor.get());
-  CHECK_RET(offset != nullptr, ACLNN_ERR_INNER_NULLPTR);
-
-  auto logValue = std::get<1>(logMatrixDeterminantOut);
-  CHECK_RET(logValue != nullptr, ACLNN_ERR_INNER_NULLPTR);
-  logValue = l0op::Add(logValue, offset, uniqueExecutor.get());
+  // LU分解一次得到log(det)，负行列式为NaN，无需再对符号取对数并相加
+  auto logValue = l0op::Logdet(selfReshapeOut, uniqueExecutor.get());
   CHECK_RET(logValue != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
   // 8维以上需要reshape
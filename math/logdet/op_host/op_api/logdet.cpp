@@ -0,0 +1,49 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "logdet.h"
+
+#include "opdev/aicpu/aicpu_task.h"
+#include "opdev/make_op_executor.h"
+#include "opdev/op_def.h"
+#include "opdev/op_dfx.h"
+#include "opdev/op_executor.h"
+#include "opdev/op_log.h"
+#include "opdev/shape_utils.h"
+
+using namespace op;
+
+namespace l0op {
+OP_TYPE_REGISTER(Logdet);
+
+// AICPU算子kernel，LU分解一次得到log|det|与符号，负行列式输出NaN
+static inline const aclTensor *LogdetAiCpu(const aclTensor *self, const aclTensor *out, aclOpExecutor *executor) {
+   L0_DFX(LogdetAiCpu, self, out);
+
+   static internal::AicpuTaskSpace space("Logdet", ge::DEPEND_IN_SHAPE, true);
+   auto ret = ADD_TO_LAUNCHER_LIST_AICPU(Logdet, OP_ATTR_NAMES(), OP_INPUT(self), OP_OUTPUT(out));
+   OP_CHECK(ret == ACLNN_SUCCESS, OP_LOGE(ACLNN_ERR_INNER_NULLPTR, "LogdetAiCpu ADD_TO_LAUNCHER_LIST_AICPU failed."),
+            return nullptr);
+   return out;
+}
+
+const aclTensor *Logdet(const aclTensor *self, aclOpExecutor *executor) {
+   L0_DFX(Logdet, self);
+   auto shapeVec = ToShapeVector(self->GetViewShape());
+   shapeVec.pop_back();
+   shapeVec.pop_back();
+   op::Shape targetShape;
+   ToShape(shapeVec, targetShape);
+
+   auto out = executor->AllocTensor(targetShape, self->GetDataType());
+   CHECK_RET(out != nullptr, nullptr);
+   return LogdetAiCpu(self, out, executor);
+}
+}  // namespace l0op
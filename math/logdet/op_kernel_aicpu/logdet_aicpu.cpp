@@ -0,0 +1,109 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "logdet_aicpu.h"
+
+#include <complex>
+#include <limits>
+#include <vector>
+
+#include "aicpu/lu_determinant.h"
+#include "cpu_kernel_utils.h"
+#include "utils/kernel_util.h"
+
+namespace {
+const char* const kLogdet = "Logdet";
+constexpr int64_t kMatrixRank = 2;
+} // namespace
+
+namespace aicpu {
+namespace {
+// log(det) = log|det| + log(sign): NaN for a negative real determinant, -inf for a singular matrix.
+template <typename T>
+T LogOfDeterminant(const LuDeterminant<T>& det)
+{
+    return det.sign < T(0) ? std::numeric_limits<T>::quiet_NaN() : det.log_abs;
+}
+
+template <typename R>
+std::complex<R> LogOfDeterminant(const LuDeterminant<std::complex<R>>& det)
+{
+    return std::complex<R>(det.log_abs, std::arg(det.sign));
+}
+} // namespace
+
+uint32_t LogdetCpuKernel::Compute(CpuKernelContext& ctx)
+{
+    LogdetParams params;
+    KERNEL_HANDLE_ERROR(ParseParams(ctx, params), "[%s] check params failed.", kLogdet);
+    auto data_type = ctx.Input(kFirstInputIndex)->GetDataType();
+    switch (data_type) {
+        case DT_FLOAT:
+            return LogdetCompute<float>(ctx, params);
+        case DT_DOUBLE:
+            return LogdetCompute<double>(ctx, params);
+        case DT_COMPLEX64:
+            return LogdetCompute<std::complex<float>>(ctx, params);
+        case DT_COMPLEX128:
+            return LogdetCompute<std::complex<double>>(ctx, params);
+        default:
+            KERNEL_LOG_ERROR("[%s] invalid input type [%s]", kLogdet, DTypeStr(data_type).c_str());
+            return KERNEL_STATUS_PARAM_INVALID;
+    }
+}
+
+uint32_t LogdetCpuKernel::ParseParams(const CpuKernelContext& ctx, LogdetParams& params) const
+{
+    Tensor* input = ctx.Input(kFirstInputIndex);
+    Tensor* output = ctx.Output(kFirstOutputIndex);
+    KERNEL_CHECK_NULLPTR(input, KERNEL_STATUS_PARAM_INVALID, "[%s] get input failed.", kLogdet)
+    KERNEL_CHECK_NULLPTR(output, KERNEL_STATUS_PARAM_INVALID, "[%s] get output failed.", kLogdet)
+    KERNEL_CHECK_NULLPTR(input->GetTensorShape(), KERNEL_STATUS_PARAM_INVALID, "[%s] get input shape failed.", kLogdet)
+    KERNEL_CHECK_NULLPTR(output->GetTensorShape(), KERNEL_STATUS_PARAM_INVALID, "[%s] get output shape failed.",
+                         kLogdet)
+    const DataType data_type = input->GetDataType();
+    KERNEL_CHECK_FALSE(output->GetDataType() == data_type, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] output type [%s] should be the input type [%s].", kLogdet,
+                       DTypeStr(output->GetDataType()).c_str(), DTypeStr(data_type).c_str());
+
+    std::vector<int64_t> dims = input->GetTensorShape()->GetDimSizes();
+    const int32_t rank = static_cast<int32_t>(dims.size());
+    KERNEL_CHECK_FALSE(rank >= kMatrixRank, KERNEL_STATUS_PARAM_INVALID, "[%s] input rank [%d] should be at least 2.",
+                       kLogdet, rank);
+    params.n = dims[rank - 1];
+    KERNEL_CHECK_FALSE(dims[rank - 2] == params.n, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] input should be square matrices, got [%ld, %ld].", kLogdet, dims[rank - 2], params.n);
+    std::vector<int64_t> batch_dims(dims.begin(), dims.end() - kMatrixRank);
+    params.batch = 1;
+    for (int64_t d : batch_dims) {
+        params.batch *= d;
+    }
+    KERNEL_CHECK_FALSE(output->GetTensorShape()->GetDimSizes() == batch_dims, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] output should have the batch shape of the input.", kLogdet);
+    if (params.batch * params.n > 0) {
+        KERNEL_CHECK_NULLPTR(input->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] get input data failed.", kLogdet)
+    }
+    if (params.batch > 0) {
+        KERNEL_CHECK_NULLPTR(output->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] get output data failed.", kLogdet)
+    }
+    return KERNEL_STATUS_OK;
+}
+
+template <typename T>
+uint32_t LogdetCpuKernel::LogdetCompute(const CpuKernelContext& ctx, const LogdetParams& params) const
+{
+    const T* input = reinterpret_cast<const T*>(ctx.Input(kFirstInputIndex)->GetData());
+    T* output = reinterpret_cast<T*>(ctx.Output(kFirstOutputIndex)->GetData());
+    auto emit = [output](int64_t b, const LuDeterminant<T>& det) { output[b] = LogOfDeterminant(det); };
+    return LuDeterminantCompute<T>(ctx, input, params.batch, params.n, emit, kLogdet);
+}
+
+REGISTER_CPU_KERNEL(kLogdet, LogdetCpuKernel);
+} // namespace aicpu
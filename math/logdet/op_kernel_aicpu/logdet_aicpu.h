@@ -0,0 +1,37 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef AICPU_KERNELS_LOGDET_H_
+#define AICPU_KERNELS_LOGDET_H_
+
+#include <cstdint>
+
+#include "cpu_kernel.h"
+
+namespace aicpu {
+// batch square matrices of order n.
+struct LogdetParams {
+    int64_t batch = 0;
+    int64_t n = 0;
+};
+
+class LogdetCpuKernel : public CpuKernel {
+public:
+    LogdetCpuKernel() = default;
+    ~LogdetCpuKernel() override = default;
+    uint32_t Compute(CpuKernelContext& ctx) override;
+
+private:
+    uint32_t ParseParams(const CpuKernelContext& ctx, LogdetParams& params) const;
+    template <typename T>
+    uint32_t LogdetCompute(const CpuKernelContext& ctx, const LogdetParams& params) const;
+};
+} // namespace aicpu
+#endif // AICPU_KERNELS_LOGDET_H_
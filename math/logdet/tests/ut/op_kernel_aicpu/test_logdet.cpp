@@ -0,0 +1,174 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "utils/aicpu_test_utils.h"
+#include "cpu_kernel_utils.h"
+#include "node_def_builder.h"
+
+using namespace std;
+using namespace aicpu;
+
+class TEST_LOGDET_UT : public testing::Test {};
+
+#define CREATE_NODEDEF(shapes, data_types, datas)                 \
+    auto node_def = CpuKernelUtils::CreateNodeDef();              \
+    NodeDefBuilder(node_def.get(), "Logdet", "Logdet")            \
+        .Input({"x", data_types[0], shapes[0], datas[0]})         \
+        .Output({"y", data_types[1], shapes[1], datas[1]})
+
+namespace {
+template <typename T>
+vector<T> RandomValues(size_t num)
+{
+    vector<double> values(num);
+    SetRandomValue<double>(values.data(), num, -1.0, 1.0);
+    return vector<T>(values.begin(), values.end());
+}
+
+template <>
+vector<complex<float>> RandomValues<complex<float>>(size_t num)
+{
+    vector<double> re = RandomValues<double>(num);
+    vector<double> im = RandomValues<double>(num);
+    vector<complex<float>> values(num);
+    for (size_t i = 0; i < num; i++) {
+        values[i] = complex<float>(re[i], im[i]);
+    }
+    return values;
+}
+
+// Reference: unblocked Gaussian elimination with partial pivoting in complex<double>.
+template <typename T>
+void ReferenceSlogdet(const T* x, int64_t n, complex<double>& sign, double& log_abs)
+{
+    vector<complex<double>> a(x, x + n * n);
+    sign = 1.0;
+    log_abs = 0.0;
+    for (int64_t k = 0; k < n; k++) {
+        int64_t p = k;
+        for (int64_t i = k + 1; i < n; i++) {
+            if (abs(a[i * n + k]) > abs(a[p * n + k])) {
+                p = i;
+            }
+        }
+        if (abs(a[p * n + k]) == 0.0) {
+            sign = 0.0;
+            log_abs = -numeric_limits<double>::infinity();
+            return;
+        }
+        if (p != k) {
+            for (int64_t j = 0; j < n; j++) {
+                swap(a[k * n + j], a[p * n + j]);
+            }
+            sign = -sign;
+        }
+        const complex<double> pivot = a[k * n + k];
+        sign *= pivot / abs(pivot);
+        log_abs += log(abs(pivot));
+        for (int64_t i = k + 1; i < n; i++) {
+            const complex<double> l = a[i * n + k] / pivot;
+            for (int64_t j = k + 1; j < n; j++) {
+                a[i * n + j] -= l * a[k * n + j];
+            }
+        }
+    }
+}
+
+template <typename T>
+void RunRandom(DataType data_type, int64_t batch, int64_t n, double tol)
+{
+    vector<T> x = RandomValues<T>(static_cast<size_t>(batch * n * n));
+    vector<T> y(batch);
+    vector<DataType> data_types = {data_type, data_type};
+    vector<vector<int64_t>> shapes = {{batch, n, n}, {batch}};
+    vector<void*> datas = {(void*)x.data(), (void*)y.data()};
+    CREATE_NODEDEF(shapes, data_types, datas);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+    for (int64_t b = 0; b < batch; b++) {
+        complex<double> sign;
+        double log_abs;
+        ReferenceSlogdet(x.data() + b * n * n, n, sign, log_abs);
+        const complex<double> got(y[b]);
+        if (is_same<T, float>::value || is_same<T, double>::value) {
+            if (real(sign) < 0) {
+                EXPECT_TRUE(isnan(real(got))) << "batch " << b;
+            } else {
+                EXPECT_NEAR(real(got), log_abs, tol * max(1.0, fabs(log_abs))) << "batch " << b;
+            }
+        } else {
+            EXPECT_NEAR(real(got), log_abs, tol * max(1.0, fabs(log_abs))) << "batch " << b;
+            EXPECT_NEAR(abs(exp(complex<double>(0, imag(got))) - sign), 0.0, tol) << "batch " << b;
+        }
+    }
+}
+} // namespace
+
+TEST_F(TEST_LOGDET_UT, FLOAT_KNOWN_SUCCESS)
+{
+    // det = 6, det = -2, det = 0
+    float x[3][2][2] = {{{2, 1}, {0, 3}}, {{0, 1}, {2, 5}}, {{1, 2}, {2, 4}}};
+    float y[3] = {0};
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{3, 2, 2}, {3}};
+    vector<void*> datas = {(void*)x, (void*)y};
+    CREATE_NODEDEF(shapes, data_types, datas);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    EXPECT_NEAR(y[0], log(6.0f), 1e-6);
+    EXPECT_TRUE(isnan(y[1]));
+    EXPECT_EQ(y[2], -numeric_limits<float>::infinity());
+}
+
+TEST_F(TEST_LOGDET_UT, COMPLEX128_KNOWN_SUCCESS)
+{
+    // det = i * 2: log = log 2 + i * pi / 2
+    complex<double> x[4] = {{0, 1}, {0, 0}, {0, 0}, {2, 0}};
+    complex<double> y[1];
+    vector<DataType> data_types = {DT_COMPLEX128, DT_COMPLEX128};
+    vector<vector<int64_t>> shapes = {{2, 2}, {}};
+    vector<void*> datas = {(void*)x, (void*)y};
+    CREATE_NODEDEF(shapes, data_types, datas);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    EXPECT_NEAR(y[0].real(), log(2.0), 1e-12);
+    EXPECT_NEAR(y[0].imag(), M_PI / 2, 1e-12);
+}
+
+TEST_F(TEST_LOGDET_UT, DOUBLE_BATCH_SUCCESS)
+{
+    RunRandom<double>(DT_DOUBLE, 100, 16, 1e-10);
+}
+
+TEST_F(TEST_LOGDET_UT, DOUBLE_BLOCKED_SPLIT_SUCCESS)
+{
+    RunRandom<double>(DT_DOUBLE, 1, 260, 1e-9);
+}
+
+TEST_F(TEST_LOGDET_UT, COMPLEX64_SUCCESS)
+{
+    RunRandom<complex<float>>(DT_COMPLEX64, 4, 9, 1e-4);
+}
+
+TEST_F(TEST_LOGDET_UT, OUTPUT_SHAPE_FAILED)
+{
+    float x[8] = {0};
+    float y[1] = {0};
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{2, 2, 2}, {1}};
+    vector<void*> datas = {(void*)x, (void*)y};
+    CREATE_NODEDEF(shapes, data_types, datas);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
+}
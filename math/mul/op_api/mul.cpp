@@ -19,6 +19,7 @@
 #include "opdev/shape_utils.h"
 #include "opdev/platform.h"
 #include "op_api/aclnn_check.h"
+#include "op_api/aicpu_strided_view.h"
 
 using namespace op;
 
@@ -102,10 +103,11 @@ inline static bool IsAiCoreSupport(const aclTensor* self)
 
 bool IsMulSupportNonContiguous(const aclTensor* self, const aclTensor* other)
 {
-    bool isSupportNonContiguous = isBroadcastTemplateNonContiguousSupport(self) &&
-                                  isBroadcastTemplateNonContiguousSupport(other);
-    return isSupportNonContiguous &&
-           ((IsAiCoreSupport(self) && IsAiCoreSupport(other)) || IsDoubleSupport(self, other));
+    if ((IsAiCoreSupport(self) && IsAiCoreSupport(other)) || IsDoubleSupport(self, other)) {
+        return isBroadcastTemplateNonContiguousSupport(self) && isBroadcastTemplateNonContiguousSupport(other);
+    }
+    // AICPU Mul按stride读取非连续输入（见MulAiCpuStrided）
+    return true;
 }
 
 // AICORE算子kernel
@@ -119,10 +121,33 @@ static const aclTensor* MulAiCore(const aclTensor* self, const aclTensor* other,
     return mulOut;
 }
 
+// AICPU算子kernel，输入非连续时以storage + view属性下发，kernel内按stride读取，省去Contiguous拷贝
+static const aclTensor* MulAiCpuStrided(
+    const aclTensor* self, const aclTensor* other, const aclTensor* mulOut, aclOpExecutor* executor)
+{
+    L0_DFX(MulAiCpuStrided, self, other);
+    AicpuStridedInput x1;
+    AicpuStridedInput x2;
+    CHECK_RET(MakeAicpuStridedInput(self, executor, x1) && MakeAicpuStridedInput(other, executor, x2), nullptr);
+
+    static internal::AicpuTaskSpace space("Mul");
+    auto ret = ADD_TO_LAUNCHER_LIST_AICPU(
+        Mul,
+        OP_ATTR_NAMES({"view_shape_0", "view_strides_0", "view_offset_0", "view_shape_1", "view_strides_1",
+                       "view_offset_1"}),
+        OP_INPUT(x1.storage, x2.storage), OP_OUTPUT(mulOut),
+        OP_ATTR(x1.viewShape, x1.viewStrides, x1.viewOffset, x2.viewShape, x2.viewStrides, x2.viewOffset));
+    CHECK_RET(ret == ACLNN_SUCCESS, nullptr);
+    return mulOut;
+}
+
 // AICPU算子kernel
 static const aclTensor* MulAiCpu(const aclTensor* self, const aclTensor* other, const aclTensor* mulOut,
                                  aclOpExecutor* executor)
 {
+    if (IsAicpuStridedLaunch(self, other)) {
+        return MulAiCpuStrided(self, other, mulOut, executor);
+    }
     L0_DFX(MulAiCpu, self, other);
     // 使用框架宏ADD_TO_LAUNCHER_LIST_AICPU，将AiCpu Mul算子加入任务队列
     // Mul是算子的OpType，self、other是算子的输入，mulOut是算子的输出
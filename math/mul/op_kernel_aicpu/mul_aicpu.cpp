@@ -10,9 +10,9 @@
 
 #include "mul_aicpu.h"
 
-#include <algorithm>
 #include <unordered_map>
 #include <functional>
+#include "aicpu/broadcast_binary.h"
 #include "cpu_kernel_utils.h"
 #include "cpu_types.h"
 #include "utils/eigen_tensor.h"
@@ -22,9 +22,6 @@ namespace {
 const char* const kMul = "Mul";
 constexpr uint32_t kInputNum = 2;
 constexpr uint32_t kOutputNum = 1;
-constexpr int64_t kParallelDataNum = 6 * 1024;
-constexpr int64_t kParallelDataNumMid = 33 * 1024;
-constexpr int64_t kParallelDataNumSameShape = 7 * 1024;
 } // namespace
 
 namespace aicpu {
@@ -70,136 +67,18 @@ uint32_t MulCpuKernel::MulSameTypeCompute(const CpuKernelContext& ctx)
 template <typename T>
 uint32_t MulCpuKernel::MulCompute(const CpuKernelContext& ctx)
 {
-    BCalcInfo calc_info;
-    calc_info.input_0 = ctx.Input(kFirstInputIndex);
-    calc_info.input_1 = ctx.Input(kSecondInputIndex);
-    calc_info.output = ctx.Output(kFirstOutputIndex);
-    KERNEL_CHECK_NULLPTR(calc_info.input_0->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] Get input 0 data failed",
+    Tensor* input_0 = ctx.Input(kFirstInputIndex);
+    Tensor* input_1 = ctx.Input(kSecondInputIndex);
+    Tensor* output = ctx.Output(kFirstOutputIndex);
+    KERNEL_CHECK_NULLPTR(input_0->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] Get input 0 data failed",
                          ctx.GetOpType().c_str())
-    KERNEL_CHECK_NULLPTR(calc_info.input_1->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] Get input 1 data failed",
+    KERNEL_CHECK_NULLPTR(input_1->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] Get input 1 data failed",
                          ctx.GetOpType().c_str())
-    KERNEL_CHECK_NULLPTR(calc_info.output->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] Get output data failed",
+    KERNEL_CHECK_NULLPTR(output->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] Get output data failed",
                          ctx.GetOpType().c_str())
     KERNEL_LOG_INFO("[%s] Input[0] data size is [%lu], input[1] data size is [%lu], output data size is [%lu].",
-                    ctx.GetOpType().c_str(), calc_info.input_0->GetDataSize(), calc_info.input_1->GetDataSize(),
-                    calc_info.output->GetDataSize());
-
-    Bcast bcast;
-    if (bcast.GenerateBcastInfo(calc_info) != KERNEL_STATUS_OK) {
-        KERNEL_LOG_ERROR("[%s] Generate broadcast info failed.", ctx.GetOpType().c_str());
-        return KERNEL_STATUS_PARAM_INVALID;
-    }
-    bcast.GetBcastVec(calc_info);
-    return MulDispatch<T>(calc_info);
-}
-
-template <typename T>
-uint32_t MulCpuKernel::MulDispatch(BCalcInfo& calc_info)
-{
-    int32_t rank = static_cast<int32_t>(calc_info.shape_out.size());
-    switch (rank) {
-        case 0: {
-            T v0 = *(reinterpret_cast<const T*>(calc_info.input_0->GetData()));
-            T v1 = *(reinterpret_cast<const T*>(calc_info.input_1->GetData()));
-            T* value_out = reinterpret_cast<T*>(calc_info.output->GetData());
-            *(value_out) = v0 * v1;
-            return KERNEL_STATUS_OK;
-        }
-        case kRank1:
-            return MulCalculateWithAlignedCheck<kRank1, T>(calc_info);
-        case kRank2:
-            return MulCalculateWithAlignedCheck<kRank2, T>(calc_info);
-        case kRank3:
-            return MulCalculateWithAlignedCheck<kRank3, T>(calc_info);
-        case kRank4:
-            return MulCalculateWithAlignedCheck<kRank4, T>(calc_info);
-        case kRank5:
-            return MulCalculateWithAlignedCheck<kRank5, T>(calc_info);
-        case kRank6:
-            return MulCalculateWithAlignedCheck<kRank6, T>(calc_info);
-        case kRank7:
-            return MulCalculateWithAlignedCheck<kRank7, T>(calc_info);
-        case kRank8:
-            return MulCalculateWithAlignedCheck<kRank8, T>(calc_info);
-        default:
-            KERNEL_LOG_ERROR("Rank of output should less than 8 but get [%zu].", calc_info.shape_out.size());
-            return KERNEL_STATUS_PARAM_INVALID;
-    }
-}
-
-template <int32_t RANK, typename T>
-uint32_t MulCpuKernel::MulCalculateWithAlignedCheck(BCalcInfo& calc_info)
-{
-    if (AlignedCheck(calc_info)) {
-        return MulCalculate<RANK, T, Eigen::Aligned>(calc_info);
-    }
-    return MulCalculate<RANK, T, Eigen::Unaligned>(calc_info);
-}
-
-bool MulCpuKernel::AlignedCheck(const BCalcInfo& calc_info) const
-{
-    return AddrAlignedCheck(calc_info.input_0->GetData()) && AddrAlignedCheck(calc_info.input_1->GetData()) &&
-           AddrAlignedCheck(calc_info.output->GetData());
-}
-
-template <int32_t RANK, typename T, int32_t OPTION>
-uint32_t MulCpuKernel::MulCalculate(BCalcInfo& calc_info)
-{
-    Eigen::TensorMap<Eigen::Tensor<T, 1>, OPTION> input0(static_cast<T*>(calc_info.input_0->GetData()),
-                                                         calc_info.input_0->GetTensorShape()->NumElements());
-    Eigen::TensorMap<Eigen::Tensor<T, 1>, OPTION> input1(static_cast<T*>(calc_info.input_1->GetData()),
-                                                         calc_info.input_1->GetTensorShape()->NumElements());
-    Eigen::TensorMap<Eigen::Tensor<T, 1>, OPTION> output(static_cast<T*>(calc_info.output->GetData()),
-                                                         calc_info.output->GetTensorShape()->NumElements());
-    auto input_shape_0 = calc_info.input_0->GetTensorShape()->GetDimSizes();
-    auto input_shape_1 = calc_info.input_1->GetTensorShape()->GetDimSizes();
-    if (input_shape_0.empty()) {
-        T v0 = *(reinterpret_cast<const T*>(calc_info.input_0->GetData()));
-        output = v0 * input1;
-        return KERNEL_STATUS_OK;
-    }
-    if (input_shape_1.empty()) {
-        T v1 = *(reinterpret_cast<const T*>(calc_info.input_1->GetData()));
-        output = input0 * v1;
-        return KERNEL_STATUS_OK;
-    }
-
-    Eigen::DSizes<Eigen::DenseIndex, RANK> reshape_0;
-    Eigen::DSizes<Eigen::DenseIndex, RANK> reshape_1;
-    Eigen::DSizes<Eigen::DenseIndex, RANK> shape_out;
-    Eigen::array<Eigen::DenseIndex, RANK> bcast_0;
-    Eigen::array<Eigen::DenseIndex, RANK> bcast_1;
-    for (int32_t i = 0; i < RANK; i++) {
-        reshape_0[(RANK - i) - 1] = calc_info.reshape_0[i];
-        reshape_1[(RANK - i) - 1] = calc_info.reshape_1[i];
-        shape_out[(RANK - i) - 1] = calc_info.shape_out[i];
-        bcast_0[(RANK - i) - 1] = calc_info.bcast_0[i];
-        bcast_1[(RANK - i) - 1] = calc_info.bcast_1[i];
-    }
-    if (input_shape_0 == input_shape_1) {
-        output.reshape(shape_out) = input0.reshape(reshape_0) * input1.reshape(reshape_1);
-    } else {
-        output.reshape(shape_out) = input0.reshape(reshape_0).broadcast(bcast_0) *
-                                    input1.reshape(reshape_1).broadcast(bcast_1);
-    }
-    return KERNEL_STATUS_OK;
-}
-
-int64_t GetMulParallelCoreNum(const CpuKernelContext& ctx, int64_t data_num)
-{
-    uint32_t min_core_num = 1;
-    int64_t max_core_num = std::max(static_cast<int64_t>(min_core_num),
-                                    static_cast<int64_t>(aicpu::CpuKernelUtils::GetCPUNum(ctx)) - kResvCpuNum);
-    if (data_num <= kParallelDataNumMid) {
-        max_core_num = std::min(max_core_num, static_cast<int64_t>(4));
-    }
-    if (max_core_num > data_num) {
-        max_core_num = data_num;
-    }
-    if (max_core_num < 1) {
-        max_core_num = 1;
-    }
-    return max_core_num;
+                    ctx.GetOpType().c_str(), input_0->GetDataSize(), input_1->GetDataSize(), output->GetDataSize());
+    return BroadcastBinaryCompute<T>(ctx, [](const T& a, const T& b) { return a * b; });
 }
 
 template <typename TIn1, typename TIn2, typename TOut>
@@ -221,106 +100,14 @@ typename std::enable_if<!std::is_same<TIn1, TOut>::value && !std::is_same<TIn2,
     output = static_cast<TOut>(a) * static_cast<TOut>(b);
 }
 
-template <typename TIn1, typename TIn2, typename TOut>
-uint32_t BcastCompute(const CpuKernelContext& ctx, const Bcast& bcast)
-{
-    auto in0 = reinterpret_cast<TIn1*>(ctx.Input(0)->GetData());
-    auto in1 = reinterpret_cast<TIn2*>(ctx.Input(1)->GetData());
-    auto out = reinterpret_cast<TOut*>(ctx.Output(0)->GetData());
-    int64_t data_num = ctx.Output(0)->NumElements();
-    if (data_num >= kParallelDataNum) {
-        int64_t max_core_num = GetMulParallelCoreNum(ctx, data_num);
-        if (max_core_num == 0) {
-            KERNEL_LOG_ERROR("Mul max_core_num is zero, division by zero.");
-            return KERNEL_STATUS_PARAM_INVALID;
-        }
-        auto sharder_mul = [&](int64_t start, int64_t end) {
-            for (int64_t i = start; i < end; ++i) {
-                MulImpl(*(in0 + bcast.GetBroadcastXIndex(i)), *(in1 + bcast.GetBroadcastYIndex(i)), *(out + i));
-            }
-        };
-        KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, data_num, data_num / max_core_num, sharder_mul),
-                            "Mul Compute failed.")
-    } else {
-        for (int64_t i = 0; i < data_num; ++i) {
-            MulImpl(*(in0 + bcast.GetBroadcastXIndex(i)), *(in1 + bcast.GetBroadcastYIndex(i)), *(out + i));
-        }
-    }
-    return KERNEL_STATUS_OK;
-}
-
-template <typename TIn1, typename TIn2, typename TOut>
-void SpecialCompute(BcastShapeType type, int64_t start, int64_t end, CpuKernelContext& ctx)
-{
-    auto in1 = reinterpret_cast<TIn1*>(ctx.Input(0)->GetData());
-    auto in2 = reinterpret_cast<TIn2*>(ctx.Input(1)->GetData());
-    auto output = reinterpret_cast<TOut*>(ctx.Output(0)->GetData());
-    switch (type) {
-        case BcastShapeType::SAME_SHAPE:
-            for (int64_t i = start; i < end; ++i) {
-                MulImpl(*(in1 + i), *(in2 + i), *(output + i));
-            }
-            break;
-        case BcastShapeType::X_ONE_ELEMENT:
-            for (int64_t i = start; i < end; ++i) {
-                MulImpl(*in1, *(in2 + i), *(output + i));
-            }
-            break;
-        case BcastShapeType::Y_ONE_ELEMENT:
-            for (int64_t i = start; i < end; ++i) {
-                MulImpl(*(in1 + i), *in2, *(output + i));
-            }
-            break;
-        default:
-            KERNEL_LOG_WARN("Invalid type [%d]", static_cast<int32_t>(type));
-            break;
-    }
-}
-
-template <typename TIn1, typename TIn2, typename TOut>
-uint32_t NoBcastCompute(CpuKernelContext& ctx)
-{
-    int64_t element_num_in0 = ctx.Input(0)->NumElements();
-    int64_t element_num_in1 = ctx.Input(1)->NumElements();
-    int64_t data_num = ctx.Output(0)->NumElements();
-    BcastShapeType type = (element_num_in0 == element_num_in1 ?
-                               BcastShapeType::SAME_SHAPE :
-                               (element_num_in0 == 1 ? BcastShapeType::X_ONE_ELEMENT : BcastShapeType::Y_ONE_ELEMENT));
-    if (data_num >= kParallelDataNumSameShape) {
-        int64_t max_core_num = GetMulParallelCoreNum(ctx, data_num);
-        if (max_core_num == 0) {
-            KERNEL_LOG_ERROR("Mul max_core_num is zero, division by zero.");
-            return KERNEL_STATUS_PARAM_INVALID;
-        }
-        auto sharder_mul = [&](int64_t start, int64_t end) { SpecialCompute<TIn1, TIn2, TOut>(type, start, end, ctx); };
-        KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, data_num, data_num / max_core_num, sharder_mul),
-                            "Mul Compute failed.")
-    } else {
-        SpecialCompute<TIn1, TIn2, TOut>(type, 0, data_num, ctx);
-    }
-    return KERNEL_STATUS_OK;
-}
-
 template <typename TIn1, typename TIn2, typename TOut>
 uint32_t MulDiffTypeCompute(CpuKernelContext& ctx)
 {
-    Tensor* tensor_in0 = ctx.Input(0);
-    auto shape_in0 = tensor_in0->GetTensorShape()->GetDimSizes();
-    Tensor* tensor_in1 = ctx.Input(1);
-    auto shape_in1 = tensor_in1->GetTensorShape()->GetDimSizes();
-
-    bool no_need_bcast = (shape_in0 == shape_in1) || (tensor_in0->NumElements() == 1) ||
-                         (tensor_in1->NumElements() == 1);
-    if (no_need_bcast) {
-        return NoBcastCompute<TIn1, TIn2, TOut>(ctx);
-    }
-
-    Bcast bcast(shape_in0, shape_in1);
-    if (!bcast.IsValid()) {
-        KERNEL_LOG_ERROR("[%s] broadcast failed.", ctx.GetOpType().c_str());
-        return KERNEL_STATUS_PARAM_INVALID;
-    }
-    return BcastCompute<TIn1, TIn2, TOut>(ctx, bcast);
+    return BroadcastBinaryCompute<TIn1, TIn2, TOut>(ctx, [](const TIn1& a, const TIn2& b) {
+        TOut output;
+        MulImpl(a, b, output);
+        return output;
+    });
 }
 
 static const std::unordered_map<int32_t, std::unordered_map<int32_t, std::function<uint32_t(CpuKernelContext&)>>>&
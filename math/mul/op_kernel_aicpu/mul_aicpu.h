@@ -28,17 +28,6 @@ private:
     template <typename T>
     uint32_t MulCompute(const CpuKernelContext& ctx);
 
-    template <typename T>
-    uint32_t MulDispatch(BCalcInfo& calc_info);
-
-    bool AlignedCheck(const BCalcInfo& calc_info) const;
-
-    template <int32_t RANK, typename T>
-    uint32_t MulCalculateWithAlignedCheck(BCalcInfo& calc_info);
-
-    template <int32_t RANK, typename T, int32_t OPTION>
-    uint32_t MulCalculate(BCalcInfo& calc_info);
-
     uint32_t MulSameTypeCompute(const CpuKernelContext& ctx);
 };
 } // namespace aicpu
@@ -24,6 +24,7 @@ public:
         this->Input("x2").ParamType(REQUIRED).DataType(data_types);
         this->Output("y").ParamType(REQUIRED).DataType(data_types);
 
+        ApplyStridedViewAttrs(*this, 2);
         ApplyMathAicpuDefaultCfg(*this);
         this->AICPU().ExtendCfgInfo(OP_INFO_OPS_FLAG.c_str(), OPEN_OPS_FLAG.c_str());
     }
@@ -213,3 +213,14 @@ TEST_F(l2_mul_test, case_wb_miss_zero_stride_broadcast)
     uint64_t workspace_size = 0;
     EXPECT_EQ(ut.TestGetWorkspaceSize(&workspace_size), ACL_SUCCESS);
 }
+
+// AICPU路由的dtype（int16）非连续输入不经过Contiguous
+TEST_F(l2_mul_test, case_int16_non_contiguous_aicpu)
+{
+    auto self_desc = TensorDesc({2, 3}, ACL_INT16, ACL_FORMAT_ND, {1, 2}, 0, {3, 2}).ValueRange(-10, 10);
+    auto other_desc = TensorDesc({2, 3}, ACL_INT16, ACL_FORMAT_ND).ValueRange(-10, 10);
+    auto out_desc = TensorDesc({2, 3}, ACL_INT16, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclnnMul, INPUT(self_desc, other_desc), OUTPUT(out_desc));
+    uint64_t workspace_size = 0;
+    EXPECT_EQ(ut.TestGetWorkspaceSize(&workspace_size), ACL_SUCCESS);
+}
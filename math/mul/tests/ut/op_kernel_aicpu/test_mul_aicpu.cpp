@@ -265,3 +265,49 @@ TEST_F(TEST_MUL_AICPU_UT, INPUT_NULL_EXCEPTION)
     auto node_def = CreateMulNodeDef(shapes, data_types, datas);
     RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
 }
+
+// Both inputs are read through view attrs: x1 is a transposed [3, 2] storage, x2 a stride-2 slice.
+TEST_F(TEST_MUL_AICPU_UT, STRIDED_VIEW_SAME_TYPE)
+{
+    vector<DataType> data_types = {DT_INT64, DT_INT64, DT_INT64};
+    vector<vector<int64_t>> shapes = {{6}, {6}, {2, 3}};
+    int64_t x1[6] = {1, 2, 3, 4, 5, 6};
+    int64_t x2[6] = {10, -1, 20, -1, 30, -1};
+    int64_t output[6] = {0};
+    vector<void*> datas = {static_cast<void*>(x1), static_cast<void*>(x2), static_cast<void*>(output)};
+    auto node_def = CpuKernelUtils::CreateNodeDef();
+    NodeDefBuilder(node_def.get(), "Mul", "Mul")
+        .Input({"x1", data_types[0], shapes[0], datas[0]})
+        .Input({"x2", data_types[1], shapes[1], datas[1]})
+        .Output({"y", data_types[2], shapes[2], datas[2]})
+        .Attr("view_shape_0", vector<int64_t>{2, 3})
+        .Attr("view_strides_0", vector<int64_t>{1, 2})
+        .Attr("view_offset_0", static_cast<int64_t>(0))
+        .Attr("view_shape_1", vector<int64_t>{3})
+        .Attr("view_strides_1", vector<int64_t>{2})
+        .Attr("view_offset_1", static_cast<int64_t>(0));
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    int64_t expect[6] = {1 * 10, 3 * 20, 5 * 30, 2 * 10, 4 * 20, 6 * 30};
+    EXPECT_TRUE(CompareResult(output, expect, 6));
+}
+
+TEST_F(TEST_MUL_AICPU_UT, STRIDED_VIEW_DIFF_TYPE)
+{
+    vector<DataType> data_types = {DT_INT32, DT_FLOAT, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{8}, {2, 2}, {2, 2}};
+    int32_t x1[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+    float x2[4] = {0.5f, 1.5f, 2.5f, 3.5f};
+    float output[4] = {0.0f};
+    vector<void*> datas = {static_cast<void*>(x1), static_cast<void*>(x2), static_cast<void*>(output)};
+    auto node_def = CpuKernelUtils::CreateNodeDef();
+    NodeDefBuilder(node_def.get(), "Mul", "Mul")
+        .Input({"x1", data_types[0], shapes[0], datas[0]})
+        .Input({"x2", data_types[1], shapes[1], datas[1]})
+        .Output({"y", data_types[2], shapes[2], datas[2]})
+        .Attr("view_shape_0", vector<int64_t>{2, 2})
+        .Attr("view_strides_0", vector<int64_t>{4, 1})
+        .Attr("view_offset_0", static_cast<int64_t>(2));
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    float expect[4] = {2 * 0.5f, 3 * 1.5f, 6 * 2.5f, 7 * 3.5f};
+    EXPECT_TRUE(CompareResult(output, expect, 4));
+}
@@ -11,6 +11,7 @@
 #include <cmath>
 #include <stdint.h>
 #include "Eigen/Dense"
+#include "aicpu/broadcast_binary.h"
 #include "cpu_kernel_utils.h"
 #include "cpu_types.h"
 #include "utils/kernel_util.h"
@@ -23,8 +24,6 @@ namespace {
 constexpr uint32_t kOutputNum = 1U;
 constexpr uint32_t kInputNum = 2U;
 const char *const kPow = "Pow";
-constexpr int64_t kParallelDataNum = 25 * 1024;
-constexpr int64_t kParallelDataNumSameShape = 30 * 1024;
 
 // 关于数据类型提升的逻辑，torch和cann内部有所不同
 // 优先级上：complex > float > int, x1 > x2，torch会考虑x1.x2的优先级
@@ -267,122 +266,19 @@ inline PowImpl(TIn1 a, TIn2 b, TOut& output) {
   }
 }
 
-template <typename TIn1, typename TIn2, typename TOut>
-void PowCpuKernel::SpecialCompute(BcastShapeType type, int64_t start,
-                                  int64_t end, CpuKernelContext &ctx) {
-  auto input1 = reinterpret_cast<TIn1 *>(ctx.Input(0)->GetData());
-  auto input2 = reinterpret_cast<TIn2 *>(ctx.Input(1)->GetData());
-  auto output = reinterpret_cast<TOut *>(ctx.Output(0)->GetData());
-  switch (type) {
-    case BcastShapeType::SAME_SHAPE:
-      for (int64_t i = start; i < end; ++i) {
-        PowImpl(*(input1+i), *(input2+i), *(output+i));
-      }
-      break;
-    case BcastShapeType::X_ONE_ELEMENT:
-      for (int64_t i = start; i < end; ++i) {
-        PowImpl(*(input1), *(input2 + i), *(output + i));
-      }
-      break;
-    case BcastShapeType::Y_ONE_ELEMENT:
-      for (int64_t i = start; i < end; ++i) {
-        PowImpl(*(input1 + i), *(input2), *(output + i));
-      }
-      break;
-    default:
-      KERNEL_LOG_WARN("Invalid type [%d]", static_cast<int32_t>(type));
-      break;
-  }
-}
-
-template <typename TIn1, typename TIn2, typename TOut>
-uint32_t PowCpuKernel::NoBcastCompute(CpuKernelContext &ctx) {
-  int64_t in0_elements_nums = ctx.Input(0)->NumElements();
-  int64_t in1_elements_nums = ctx.Input(1)->NumElements();
-  int64_t data_num = ctx.Output(0)->NumElements();
-  BcastShapeType type =
-      in0_elements_nums == in1_elements_nums
-          ? BcastShapeType::SAME_SHAPE
-          : (in0_elements_nums == 1 ? BcastShapeType::X_ONE_ELEMENT : BcastShapeType::Y_ONE_ELEMENT);
-
-  if (data_num >= kParallelDataNumSameShape) {
-    uint32_t min_core_num = 1;
-    uint32_t max_core_num =
-        std::max(min_core_num, aicpu::CpuKernelUtils::GetCPUNum(ctx));
-
-    auto sharder_pow = [&](size_t start, size_t end) {
-      SpecialCompute<TIn1, TIn2, TOut>(type, start, end, ctx);
-    };
-
-    auto per_unit_size = CeilMultiple(data_num, max_core_num);
-    KERNEL_HANDLE_ERROR(
-        CpuKernelUtils::ParallelFor(ctx, data_num, per_unit_size,
-                                    sharder_pow),
-        "Pow Compute failed.")
-  } else {
-    SpecialCompute<TIn1, TIn2, TOut>(type, 0, data_num, ctx);
-  }
-
-  return KERNEL_STATUS_OK;
-}
-
-template <typename TIn1, typename TIn2, typename TOut>
-uint32_t PowCpuKernel::BcastCompute(CpuKernelContext &ctx, Bcast &bcast) {
-  auto in0 = reinterpret_cast<TIn1 *>(ctx.Input(0)->GetData());
-  auto in1 = reinterpret_cast<TIn2 *>(ctx.Input(1)->GetData());
-  auto out = reinterpret_cast<TOut *>(ctx.Output(0)->GetData());
-  int64_t data_num = ctx.Output(0)->NumElements();
-  if (data_num >= kParallelDataNum) {
-    uint32_t min_core_num = 1;
-    uint32_t max_core_num =
-        std::max(min_core_num, aicpu::CpuKernelUtils::GetCPUNum(ctx) - 2);
-
-    auto sharder_pow = [&](int64_t start, int64_t end) {
-      for (int64_t i = start; i < end; i++) {
-        auto input1 =
-            in0 + bcast.GetBroadcastXIndex(i);  // i-th value of input0
-        auto input2 =
-            in1 + bcast.GetBroadcastYIndex(i);  // i-th value of input1
-        PowImpl((*input1), (*input2), *(out + i));
-      }
-    };
-
-    auto per_unit_size = CeilMultiple(data_num, max_core_num);
-    KERNEL_HANDLE_ERROR(
-        CpuKernelUtils::ParallelFor(ctx, data_num, per_unit_size,
-                                    sharder_pow),
-        "Pow Compute failed.")
-  } else {
-    for (int64_t i = 0; i < data_num; i++) {
-      auto input1 = in0 + bcast.GetBroadcastXIndex(i);  // i-th value of input0
-      auto input2 = in1 + bcast.GetBroadcastYIndex(i);  // i-th value of input1
-      PowImpl((*input1), (*input2), *(out + i));
-    }
-  }
-  return KERNEL_STATUS_OK;
-}
-
 template <typename TIn1, typename TIn2, typename TOut>
 uint32_t PowCpuKernel::PowCompute(CpuKernelContext &ctx) {
   Tensor *input0_tensor = ctx.Input(0);
-  auto input0_shape = input0_tensor->GetTensorShape()->GetDimSizes();
-  int64_t input0_elements_nums = input0_tensor->NumElements();
-
   Tensor *input1_tensor = ctx.Input(1);
-  auto input1_shape = input1_tensor->GetTensorShape()->GetDimSizes();
-  int64_t input1_elements_nums = input1_tensor->NumElements();
   if ((input0_tensor->GetDataSize() == 0) || (input1_tensor->GetDataSize() == 0)) {
       KERNEL_LOG_INFO("[%s] Input is empty tensor.", ctx.GetOpType().c_str());
       return KERNEL_STATUS_OK;
   }
-  bool no_need_bcast = (input0_shape == input1_shape) || (input0_elements_nums == 1) ||
-                       (input1_elements_nums == 1);
-  if (no_need_bcast) {
-    return NoBcastCompute<TIn1, TIn2, TOut>(ctx);
-  } else {
-    Bcast bcast(input0_shape, input1_shape);
-    return BcastCompute<TIn1, TIn2, TOut>(ctx, bcast);
-  }
+  return BroadcastBinaryCompute<TIn1, TIn2, TOut>(ctx, [](TIn1 a, TIn2 b) {
+    TOut output;
+    PowImpl(a, b, output);
+    return output;
+  }, kBinaryCostPow);
 }
 
 REGISTER_CPU_KERNEL(kPow, PowCpuKernel);
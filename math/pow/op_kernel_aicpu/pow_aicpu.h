@@ -21,17 +21,6 @@ class PowCpuKernel : public CpuKernel {
 
   template <typename TIn1, typename TIn2, typename TOut>
   static uint32_t PowCompute(CpuKernelContext &ctx);
-
- private:
-  template <typename TIn1, typename TIn2, typename TOut>
-  static void SpecialCompute(BcastShapeType type, int64_t start, int64_t end,
-                             CpuKernelContext &ctx);
-
-  template <typename TIn1, typename TIn2, typename TOut>
-  static uint32_t NoBcastCompute(CpuKernelContext &ctx);
-
-  template <typename TIn1, typename TIn2, typename TOut>
-  static uint32_t BcastCompute(CpuKernelContext &ctx, Bcast &bcast);
 };
 }  // namespace aicpu
 #endif
\ No newline at end of file
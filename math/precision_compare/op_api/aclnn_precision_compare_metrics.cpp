@@ -0,0 +1,66 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include "aclnn_precision_compare_metrics.h"
+#include "precision_compare_metrics_math.h"
+#include "aclnn_kernels/contiguous.h"
+#include "aclnn/aclnn_base.h"
+#include "opdev/common_types.h"
+#include "opdev/op_dfx.h"
+#include "opdev/op_executor.h"
+#include "opdev/op_log.h"
+#include "aclnn_kernels/common/op_error_check.h"
+#include "precision_compare_util_math.h"
+
+using namespace op;
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+ACLNN_API aclnnStatus aclnnPrecisionCompareMetricsGetWorkspaceSize(const aclTensor* golden, const aclTensor* realdata,
+                                                                   double atol, double rtol, aclTensor* metricsOut,
+                                                                   uint64_t* workspaceSize, aclOpExecutor** executor)
+{
+    L2_DFX_PHASE_1(aclnnPrecisionCompareMetrics, DFX_IN(golden, realdata, atol, rtol), DFX_OUT(metricsOut));
+    auto uniqueExecutor = CREATE_EXECUTOR();
+    CHECK_RET(uniqueExecutor.get() != nullptr, ACLNN_ERR_INNER_CREATE_EXECUTOR);
+
+    auto ret = PrecisionCompareMetricsCheckParams(golden, realdata, atol, rtol, metricsOut);
+    CHECK_RET(ret == ACLNN_SUCCESS, ret);
+    if (golden->IsEmpty()) {
+        *workspaceSize = 0;
+        uniqueExecutor.ReleaseTo(executor);
+        return ACLNN_SUCCESS;
+    }
+
+    auto goldenContiguous = l0op::Contiguous(golden, uniqueExecutor.get());
+    CHECK_RET(goldenContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    auto realDataContiguous = l0op::Contiguous(realdata, uniqueExecutor.get());
+    CHECK_RET(realDataContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
+
+    // 所有指标在AI CPU上一次遍历输入得到，直接写入metricsOut
+    auto metrics = l0op::PrecisionCompareMetrics(goldenContiguous, realDataContiguous, static_cast<float>(atol),
+                                                 static_cast<float>(rtol), metricsOut, uniqueExecutor.get());
+    CHECK_RET(metrics != nullptr, ACLNN_ERR_INNER_NULLPTR);
+
+    *workspaceSize = uniqueExecutor->GetWorkspaceSize();
+    uniqueExecutor.ReleaseTo(executor);
+    return ACLNN_SUCCESS;
+}
+
+ACLNN_API aclnnStatus aclnnPrecisionCompareMetrics(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor,
+                                                   aclrtStream stream)
+{
+    L2_DFX_PHASE_2(aclnnPrecisionCompareMetrics);
+    return CommonOpExecutorRun(workspace, workspaceSize, executor, stream);
+}
+
+#ifdef __cplusplus
+}
+#endif
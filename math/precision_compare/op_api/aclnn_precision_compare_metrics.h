@@ -0,0 +1,56 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#ifndef OP_API_INC_PRECISION_COMPARE_METRICS_H_
+#define OP_API_INC_PRECISION_COMPARE_METRICS_H_
+
+#include "aclnn/aclnn_base.h"
+#include "aclnn_util.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/**
+ * @brief aclnnPrecisionCompareMetrics的第一段接口，根据具体的计算流程，计算workspace大小。
+ * @domain aclnn_math
+ * 一次遍历golden与realdata，同时计算多项精度指标，metricsOut依次为：
+ * 最大绝对误差、最大相对误差、|realdata - golden| > atol + rtol * |golden|的元素个数、
+ * NaN不一致的元素个数、Inf不一致的元素个数、余弦相似度。
+ *
+ * @param [in] golden: npu device侧的aclTensor，
+ * 数据类型支持FLOAT16,BFLOAT16,FLOAT数据类型，
+ * golden与realdata数据类型、shape一致
+ * @param [in] realdata: npu device侧的aclTensor，
+ * 数据类型支持FLOAT16,BFLOAT16,FLOAT数据类型，
+ * realdata与golden数据类型、shape一致
+ * @param [in] atol: 绝对误差容限，不能为负数。
+ * @param [in] rtol: 相对误差容限，不能为负数。
+ * @param [in] metricsOut: 输出一个数据类型为DOUBLE、shape为[6]的Tensor。
+ * @param [out] workspaceSize: 返回用户需要在npu device侧申请的workspace大小。
+ * @param [out] executor: 返回op执行器，包含算子计算流程。
+ * @return aclnnStatus: 返回状态码。
+ */
+ACLNN_API aclnnStatus aclnnPrecisionCompareMetricsGetWorkspaceSize(const aclTensor* golden, const aclTensor* realdata,
+                                                                   double atol, double rtol, aclTensor* metricsOut,
+                                                                   uint64_t* workspaceSize, aclOpExecutor** executor);
+/**
+ * @brief aclnnPrecisionCompareMetrics的第二段接口，用于执行计算。
+ * @param [in] workspace: 在npu device侧申请的workspace内存起址。
+ * @param [in] workspaceSize: 在npu device侧申请的workspace大小，由第一段接口
+ * aclnnPrecisionCompareMetricsGetWorkspaceSize获取。
+ * @param [in] stream: acl stream流。
+ * @param [in] executor: op执行器，包含了算子计算流程。
+ * @return aclnnStatus: 返回状态码。
+ */
+ACLNN_API aclnnStatus aclnnPrecisionCompareMetrics(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor,
+                                                   aclrtStream stream);
+#ifdef __cplusplus
+}
+#endif
+#endif // OP_API_INC_PRECISION_COMPARE_METRICS_H_
@@ -0,0 +1,45 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "precision_compare_metrics_math.h"
+#include "opdev/aicpu/aicpu_task.h"
+#include "opdev/make_op_executor.h"
+#include "opdev/op_def.h"
+#include "opdev/op_dfx.h"
+#include "opdev/op_executor.h"
+#include "opdev/op_log.h"
+#include "opdev/shape_utils.h"
+
+using namespace op;
+
+namespace l0op {
+OP_TYPE_REGISTER(PrecisionCompareMetrics);
+static const std::initializer_list<op::DataType> INPUT_DTYPE_SUPPORT_LIST = {
+    op::DataType::DT_FLOAT, op::DataType::DT_FLOAT16, op::DataType::DT_BF16};
+
+const aclTensor* PrecisionCompareMetrics(const aclTensor* golden, const aclTensor* realData, float atol, float rtol,
+                                         aclTensor* metrics, aclOpExecutor* executor)
+{
+    L0_DFX(PrecisionCompareMetrics, golden, realData, atol, rtol, metrics);
+    if (!CheckType(golden->GetDataType(), INPUT_DTYPE_SUPPORT_LIST) ||
+        !CheckType(realData->GetDataType(), INPUT_DTYPE_SUPPORT_LIST)) {
+        OP_LOGE(ACLNN_ERR_PARAM_INVALID,
+                "Level0 check input type failed, golden type is [%s], real data type is [%s], Support list is %s",
+                op::ToString(golden->GetDataType()).GetString(), op::ToString(realData->GetDataType()).GetString(),
+                op::ToString(INPUT_DTYPE_SUPPORT_LIST).GetString());
+        return nullptr;
+    }
+    static internal::AicpuTaskSpace space("PrecisionCompareMetrics");
+    auto ret = ADD_TO_LAUNCHER_LIST_AICPU(PrecisionCompareMetrics, OP_ATTR_NAMES({"atol", "rtol"}),
+                                          OP_INPUT(golden, realData), OP_OUTPUT(metrics), OP_ATTR(atol, rtol));
+    CHECK_RET(ret == ACLNN_SUCCESS, nullptr);
+    return metrics;
+}
+} // namespace l0op
@@ -27,6 +27,8 @@ static const size_t DIM_SUPPORT_MAX = 8;
 static const std::initializer_list<op::DataType> INPUT_DTYPE_SUPPORT_LIST = {
     op::DataType::DT_FLOAT, op::DataType::DT_FLOAT16, op::DataType::DT_BF16};
 static const std::initializer_list<op::DataType> OUT_DTYPE_SUPPORT_LIST = {op::DataType::DT_UINT32};
+static const std::initializer_list<op::DataType> METRICS_DTYPE_SUPPORT_LIST = {op::DataType::DT_DOUBLE};
+static const int64_t METRICS_NUM = 6;
 
 static inline bool CheckNotNull(const aclTensor* golden, const aclTensor* realdata, const aclTensor* out)
 {
@@ -70,6 +72,34 @@ aclnnStatus PrecisionCompareCheckParams(const aclTensor* golden, const aclTensor
     return ACLNN_SUCCESS;
 }
 
+static bool CheckMetricsOut(const aclTensor* metricsOut)
+{
+    OP_CHECK_DTYPE_NOT_SUPPORT(metricsOut, METRICS_DTYPE_SUPPORT_LIST, return false);
+    auto shape = metricsOut->GetViewShape();
+    if (shape.GetDimNum() != 1 || shape.GetDim(0) != METRICS_NUM) {
+        OP_LOGE(ACLNN_ERR_PARAM_INVALID, "MetricsOut must be a 1D tensor of %ld values, but got %s.", METRICS_NUM,
+                op::ToString(shape).GetString());
+        return false;
+    }
+    return true;
+}
+
+aclnnStatus PrecisionCompareMetricsCheckParams(const aclTensor* golden, const aclTensor* realdata, double atol,
+                                               double rtol, const aclTensor* metricsOut)
+{
+    CHECK_RET(CheckNotNull(golden, realdata, metricsOut), ACLNN_ERR_PARAM_NULLPTR);
+    OP_CHECK_DTYPE_NOT_SAME(golden, realdata, return ACLNN_ERR_PARAM_INVALID);
+    OP_CHECK_DTYPE_NOT_SUPPORT(golden, INPUT_DTYPE_SUPPORT_LIST, return ACLNN_ERR_PARAM_INVALID);
+    OP_CHECK_SHAPE_NOT_EQUAL(golden, realdata, return ACLNN_ERR_PARAM_INVALID);
+    OP_CHECK_MAX_DIM(golden, DIM_SUPPORT_MAX, return ACLNN_ERR_PARAM_INVALID);
+    CHECK_RET(CheckMetricsOut(metricsOut), ACLNN_ERR_PARAM_INVALID);
+    if (!(atol >= 0) || !(rtol >= 0)) {
+        OP_LOGE(ACLNN_ERR_PARAM_INVALID, "atol [%f] and rtol [%f] should not be negative.", atol, rtol);
+        return ACLNN_ERR_PARAM_INVALID;
+    }
+    return ACLNN_SUCCESS;
+}
+
 #ifdef __cplusplus
 }
 #endif
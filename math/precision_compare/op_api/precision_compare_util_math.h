@@ -20,6 +20,9 @@ extern "C" {
 
 aclnnStatus PrecisionCompareCheckParams(const aclTensor* golden, const aclTensor* realdata, const aclTensor* out);
 
+aclnnStatus PrecisionCompareMetricsCheckParams(const aclTensor* golden, const aclTensor* realdata, double atol,
+                                               double rtol, const aclTensor* metricsOut);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,91 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "math/precision_compare/op_api/aclnn_precision_compare_metrics.h"
+
+#include "op_api_ut_common/tensor_desc.h"
+#include "op_api_ut_common/scalar_desc.h"
+#include "op_api_ut_common/op_api_ut.h"
+
+using namespace std;
+
+class l2_precision_compare_metrics_test : public testing::Test {
+protected:
+    static void SetUpTestCase() { cout << "precision_compare_metrics_test SetUp" << endl; }
+
+    static void TearDownTestCase() { cout << "precision_compare_metrics_test TearDown" << endl; }
+};
+
+TEST_F(l2_precision_compare_metrics_test, test_golden_is_null_failed)
+{
+    auto tensor_golden = nullptr;
+    auto tensor_realdata = TensorDesc({2, 3}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-10, 10);
+    auto metrics_desc = TensorDesc({6}, ACL_DOUBLE, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclnnPrecisionCompareMetrics, INPUT(tensor_golden, tensor_realdata, 1e-5, 1e-3),
+                        OUTPUT(metrics_desc));
+
+    uint64_t workspace_size = 5;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspace_size);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_NULLPTR);
+}
+
+TEST_F(l2_precision_compare_metrics_test, test_input_dtype_not_same_failed)
+{
+    auto tensor_golden = TensorDesc({2, 3}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-10, 10);
+    auto tensor_realdata = TensorDesc({2, 3}, ACL_FLOAT16, ACL_FORMAT_ND).ValueRange(-10, 10);
+    auto metrics_desc = TensorDesc({6}, ACL_DOUBLE, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclnnPrecisionCompareMetrics, INPUT(tensor_golden, tensor_realdata, 1e-5, 1e-3),
+                        OUTPUT(metrics_desc));
+
+    uint64_t workspace_size = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspace_size);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+}
+
+TEST_F(l2_precision_compare_metrics_test, test_metrics_shape_invalid)
+{
+    auto tensor_golden = TensorDesc({2, 3}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-10, 10);
+    auto tensor_realdata = TensorDesc({2, 3}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-10, 10);
+    auto metrics_desc = TensorDesc({4}, ACL_DOUBLE, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclnnPrecisionCompareMetrics, INPUT(tensor_golden, tensor_realdata, 1e-5, 1e-3),
+                        OUTPUT(metrics_desc));
+
+    uint64_t workspace_size = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspace_size);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+}
+
+TEST_F(l2_precision_compare_metrics_test, test_negative_tolerance_failed)
+{
+    auto tensor_golden = TensorDesc({2, 3}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-10, 10);
+    auto tensor_realdata = TensorDesc({2, 3}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-10, 10);
+    auto metrics_desc = TensorDesc({6}, ACL_DOUBLE, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclnnPrecisionCompareMetrics, INPUT(tensor_golden, tensor_realdata, -1.0, 1e-3),
+                        OUTPUT(metrics_desc));
+
+    uint64_t workspace_size = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspace_size);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+}
+
+TEST_F(l2_precision_compare_metrics_test, test_bf16_success)
+{
+    auto tensor_golden = TensorDesc({4, 16, 32}, ACL_BF16, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto tensor_realdata = TensorDesc({4, 16, 32}, ACL_BF16, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto metrics_desc = TensorDesc({6}, ACL_DOUBLE, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclnnPrecisionCompareMetrics, INPUT(tensor_golden, tensor_realdata, 1e-3, 1e-2),
+                        OUTPUT(metrics_desc));
+
+    uint64_t workspace_size = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspace_size);
+    EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+}
@@ -0,0 +1,49 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file precision_compare_metrics_proto.h
+ * \brief
+ */
+#ifndef OPS_OP_PROTO_INC_PRECISION_COMPARE_METRICS_OPS_H_
+#define OPS_OP_PROTO_INC_PRECISION_COMPARE_METRICS_OPS_H_
+
+#include "graph/operator.h"
+#include "graph/operator_reg.h"
+
+namespace ge {
+/**
+* @brief Compares realdata against golden in a single pass and reports several precision metrics. \n
+
+* @par Inputs:
+* @li golden: A tensor. Must be one of the following types: float16, bfloat16, float32.
+* @li realdata: A tensor of the same type and shape as golden. \n
+
+* @par Attributes:
+* @li atol: An optional float. Absolute tolerance of the mismatch count. Default: 1e-5.
+* @li rtol: An optional float. Relative tolerance of the mismatch count. Default: 1e-3. \n
+
+* @par Outputs:
+* metrics: A 1D double tensor of 6 values: max abs error, max relative error, count of elements with
+* |realdata - golden| > atol + rtol * |golden|, NaN mismatch count, Inf mismatch count and cosine similarity.
+* Elements holding NaN or Inf are left out of the errors and the cosine similarity. Where golden is 0 the
+* relative error is 0 if realdata is also 0 and Inf otherwise. \n
+*/
+REG_OP(PrecisionCompareMetrics)
+    .INPUT(golden, TensorType({DT_FLOAT16, DT_BF16, DT_FLOAT}))
+    .INPUT(realdata, TensorType({DT_FLOAT16, DT_BF16, DT_FLOAT}))
+    .OUTPUT(metrics, TensorType({DT_DOUBLE}))
+    .ATTR(atol, Float, 1e-5)
+    .ATTR(rtol, Float, 1e-3)
+    .OP_END_FACTORY_REG(PrecisionCompareMetrics)
+
+} // namespace ge
+
+#endif // OPS_OP_PROTO_INC_PRECISION_COMPARE_METRICS_OPS_H_
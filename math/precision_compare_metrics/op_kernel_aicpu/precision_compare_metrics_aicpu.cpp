@@ -0,0 +1,243 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "precision_compare_metrics_aicpu.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "cpu_kernel_utils.h"
+#include "utils/eigen_tensor.h"
+#include "utils/kernel_util.h"
+
+namespace {
+const char* const kPrecisionCompareMetrics = "PrecisionCompareMetrics";
+constexpr double kDefaultAtol = 1e-5;
+constexpr double kDefaultRtol = 1e-3;
+// Elements are widened a block at a time into stack buffers, so the metric loops run on plain Acc arrays.
+constexpr int64_t kMetricsBlock = 512;
+// Inputs are split into one contiguous shard per core once they hold kMetricsParallelNum elements.
+constexpr int64_t kMetricsParallelNum = 64 * 1024;
+
+struct MetricsPartial {
+    double max_abs = 0;
+    double max_rel = 0;
+    int64_t mismatch = 0;
+    int64_t nan_mismatch = 0;
+    int64_t inf_mismatch = 0;
+    double dot = 0;
+    double golden_sq = 0;
+    double real_sq = 0;
+
+    void Merge(const MetricsPartial& other)
+    {
+        max_abs = std::max(max_abs, other.max_abs);
+        max_rel = std::max(max_rel, other.max_rel);
+        mismatch += other.mismatch;
+        nan_mismatch += other.nan_mismatch;
+        inf_mismatch += other.inf_mismatch;
+        dot += other.dot;
+        golden_sq += other.golden_sq;
+        real_sq += other.real_sq;
+    }
+};
+
+/**
+ * Error metrics are evaluated in Acc (float for float16/bfloat16, double for float), the cosine sums always in
+ * double. Elements where either side is NaN or Inf only feed the mismatch counters: a block holding any of them is
+ * compacted to its finite pairs first, so the arithmetic loop below never branches on the values.
+ */
+template <typename T, typename Acc>
+void AccumulateRange(const T* golden, const T* real, int64_t begin, int64_t end, Acc atol, Acc rtol,
+                     MetricsPartial& part)
+{
+    Acc g[kMetricsBlock];
+    Acc r[kMetricsBlock];
+    for (int64_t base = begin; base < end; base += kMetricsBlock) {
+        int64_t len = std::min(kMetricsBlock, end - base);
+        Acc probe = 0;
+        for (int64_t i = 0; i < len; i++) {
+            g[i] = static_cast<Acc>(static_cast<float>(golden[base + i]));
+            r[i] = static_cast<Acc>(static_cast<float>(real[base + i]));
+            probe += g[i] * Acc(0) + r[i] * Acc(0);
+        }
+        if (std::isnan(probe)) {
+            int64_t finite = 0;
+            for (int64_t i = 0; i < len; i++) {
+                const bool g_nan = std::isnan(g[i]);
+                const bool r_nan = std::isnan(r[i]);
+                if (g_nan || r_nan) {
+                    part.nan_mismatch += (g_nan != r_nan) ? 1 : 0;
+                    part.mismatch += (g_nan != r_nan) ? 1 : 0;
+                } else if (std::isinf(g[i]) || std::isinf(r[i])) {
+                    part.inf_mismatch += (g[i] != r[i]) ? 1 : 0;
+                    part.mismatch += (g[i] != r[i]) ? 1 : 0;
+                } else {
+                    g[finite] = g[i];
+                    r[finite] = r[i];
+                    finite++;
+                }
+            }
+            len = finite;
+        }
+        Acc max_abs = 0;
+        Acc max_rel = 0;
+        int64_t mismatch = 0;
+        double dot = 0;
+        double golden_sq = 0;
+        double real_sq = 0;
+        for (int64_t i = 0; i < len; i++) {
+            const Acc diff = std::abs(r[i] - g[i]);
+            const Acc ref = std::abs(g[i]);
+            max_abs = std::max(max_abs, diff);
+            // golden == 0 with a nonzero diff has an unbounded relative error, not zero.
+            const Acc rel = ref > Acc(0) ? diff / ref : (diff > Acc(0) ? std::numeric_limits<Acc>::infinity() : Acc(0));
+            max_rel = std::max(max_rel, rel);
+            mismatch += (diff > atol + rtol * ref) ? 1 : 0;
+            const double gd = static_cast<double>(g[i]);
+            const double rd = static_cast<double>(r[i]);
+            dot += gd * rd;
+            golden_sq += gd * gd;
+            real_sq += rd * rd;
+        }
+        part.max_abs = std::max(part.max_abs, static_cast<double>(max_abs));
+        part.max_rel = std::max(part.max_rel, static_cast<double>(max_rel));
+        part.mismatch += mismatch;
+        part.dot += dot;
+        part.golden_sq += golden_sq;
+        part.real_sq += real_sq;
+    }
+}
+
+double CosineSimilarity(const MetricsPartial& total)
+{
+    if (total.golden_sq == 0.0 && total.real_sq == 0.0) {
+        return 1.0;
+    }
+    if (total.golden_sq == 0.0 || total.real_sq == 0.0) {
+        return 0.0;
+    }
+    return total.dot / (std::sqrt(total.golden_sq) * std::sqrt(total.real_sq));
+}
+} // namespace
+
+namespace aicpu {
+uint32_t PrecisionCompareMetricsCpuKernel::Compute(CpuKernelContext& ctx)
+{
+    PrecisionCompareMetricsParams params;
+    KERNEL_HANDLE_ERROR(ParseParams(ctx, params), "[%s] check params failed.", kPrecisionCompareMetrics);
+    auto data_type = ctx.Input(kFirstInputIndex)->GetDataType();
+    switch (data_type) {
+        case DT_FLOAT16:
+            return MetricsCompute<Eigen::half, float>(ctx, params);
+        case DT_BFLOAT16:
+            return MetricsCompute<Eigen::bfloat16, float>(ctx, params);
+        case DT_FLOAT:
+            return MetricsCompute<float, double>(ctx, params);
+        default:
+            KERNEL_LOG_ERROR("[%s] invalid input type [%s]", kPrecisionCompareMetrics, DTypeStr(data_type).c_str());
+            return KERNEL_STATUS_PARAM_INVALID;
+    }
+}
+
+uint32_t PrecisionCompareMetricsCpuKernel::ParseParams(const CpuKernelContext& ctx,
+                                                       PrecisionCompareMetricsParams& params) const
+{
+    Tensor* golden = ctx.Input(kFirstInputIndex);
+    Tensor* real = ctx.Input(kSecondInputIndex);
+    Tensor* metrics = ctx.Output(kFirstOutputIndex);
+    KERNEL_CHECK_NULLPTR(golden, KERNEL_STATUS_PARAM_INVALID, "[%s] get input golden failed.",
+                         kPrecisionCompareMetrics)
+    KERNEL_CHECK_NULLPTR(real, KERNEL_STATUS_PARAM_INVALID, "[%s] get input realdata failed.",
+                         kPrecisionCompareMetrics)
+    KERNEL_CHECK_NULLPTR(metrics, KERNEL_STATUS_PARAM_INVALID, "[%s] get output metrics failed.",
+                         kPrecisionCompareMetrics)
+    KERNEL_CHECK_NULLPTR(metrics->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] get output data failed.",
+                         kPrecisionCompareMetrics)
+    KERNEL_CHECK_FALSE(real->GetDataType() == golden->GetDataType(), KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] realdata type [%s] should be the same as golden type [%s].", kPrecisionCompareMetrics,
+                       DTypeStr(real->GetDataType()).c_str(), DTypeStr(golden->GetDataType()).c_str());
+    KERNEL_CHECK_FALSE(metrics->GetDataType() == DT_DOUBLE, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] metrics type [%s] should be double.", kPrecisionCompareMetrics,
+                       DTypeStr(metrics->GetDataType()).c_str());
+    KERNEL_CHECK_FALSE(metrics->NumElements() == kMetricNum, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] metrics should hold [%ld] values, but got [%ld].", kPrecisionCompareMetrics,
+                       static_cast<int64_t>(kMetricNum), metrics->NumElements());
+    KERNEL_CHECK_NULLPTR(golden->GetTensorShape(), KERNEL_STATUS_PARAM_INVALID, "[%s] get golden shape failed.",
+                         kPrecisionCompareMetrics)
+    KERNEL_CHECK_NULLPTR(real->GetTensorShape(), KERNEL_STATUS_PARAM_INVALID, "[%s] get realdata shape failed.",
+                         kPrecisionCompareMetrics)
+    KERNEL_CHECK_FALSE(golden->GetTensorShape()->GetDimSizes() == real->GetTensorShape()->GetDimSizes(),
+                       KERNEL_STATUS_PARAM_INVALID, "[%s] golden and realdata should have the same shape.",
+                       kPrecisionCompareMetrics);
+    params.num = golden->NumElements();
+    if (params.num > 0) {
+        KERNEL_CHECK_NULLPTR(golden->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] get golden data failed.",
+                             kPrecisionCompareMetrics)
+        KERNEL_CHECK_NULLPTR(real->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] get realdata data failed.",
+                             kPrecisionCompareMetrics)
+    }
+
+    AttrValue* atol_attr = ctx.GetAttr("atol");
+    AttrValue* rtol_attr = ctx.GetAttr("rtol");
+    params.atol = (atol_attr == nullptr) ? kDefaultAtol : static_cast<double>(atol_attr->GetFloat());
+    params.rtol = (rtol_attr == nullptr) ? kDefaultRtol : static_cast<double>(rtol_attr->GetFloat());
+    KERNEL_CHECK_FALSE(params.atol >= 0 && params.rtol >= 0, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] atol [%f] and rtol [%f] should not be negative.", kPrecisionCompareMetrics, params.atol,
+                       params.rtol);
+    return KERNEL_STATUS_OK;
+}
+
+template <typename T, typename Acc>
+uint32_t PrecisionCompareMetricsCpuKernel::MetricsCompute(const CpuKernelContext& ctx,
+                                                          const PrecisionCompareMetricsParams& params) const
+{
+    const T* golden = reinterpret_cast<const T*>(ctx.Input(kFirstInputIndex)->GetData());
+    const T* real = reinterpret_cast<const T*>(ctx.Input(kSecondInputIndex)->GetData());
+    double* metrics = reinterpret_cast<double*>(ctx.Output(kFirstOutputIndex)->GetData());
+    const Acc atol = static_cast<Acc>(params.atol);
+    const Acc rtol = static_cast<Acc>(params.rtol);
+    const int64_t num = params.num;
+
+    MetricsPartial total;
+    const int64_t cores = std::max<int64_t>(1, static_cast<int64_t>(CpuKernelUtils::GetCPUNum(ctx)));
+    if (cores == 1 || num < kMetricsParallelNum) {
+        AccumulateRange<T, Acc>(golden, real, 0, num, atol, rtol, total);
+    } else {
+        // One partial per shard, merged in shard order so the sums do not depend on thread scheduling.
+        const int64_t shard_len = (((num + cores - 1) / cores + kMetricsBlock - 1) / kMetricsBlock) * kMetricsBlock;
+        const int64_t shards = (num + shard_len - 1) / shard_len;
+        std::vector<MetricsPartial> partials(static_cast<size_t>(shards));
+        auto shard = [&](int64_t start, int64_t end) {
+            for (int64_t s = start; s < end; s++) {
+                AccumulateRange<T, Acc>(golden, real, s * shard_len, std::min(num, (s + 1) * shard_len), atol, rtol,
+                                        partials[s]);
+            }
+        };
+        KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, shards, 1, shard), "[%s] ParallelFor failed.",
+                            kPrecisionCompareMetrics)
+        for (const auto& part : partials) {
+            total.Merge(part);
+        }
+    }
+
+    metrics[kMetricMaxAbsError] = total.max_abs;
+    metrics[kMetricMaxRelError] = total.max_rel;
+    metrics[kMetricMismatchCount] = static_cast<double>(total.mismatch);
+    metrics[kMetricNanMismatchCount] = static_cast<double>(total.nan_mismatch);
+    metrics[kMetricInfMismatchCount] = static_cast<double>(total.inf_mismatch);
+    metrics[kMetricCosineSimilarity] = CosineSimilarity(total);
+    return KERNEL_STATUS_OK;
+}
+
+REGISTER_CPU_KERNEL(kPrecisionCompareMetrics, PrecisionCompareMetricsCpuKernel);
+} // namespace aicpu
@@ -0,0 +1,48 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef AICPU_KERNELS_PRECISION_COMPARE_METRICS_H_
+#define AICPU_KERNELS_PRECISION_COMPARE_METRICS_H_
+
+#include <cstdint>
+
+#include "cpu_kernel.h"
+
+namespace aicpu {
+// Layout of the metrics output.
+enum PrecisionMetricIndex : int64_t {
+    kMetricMaxAbsError = 0,
+    kMetricMaxRelError,
+    kMetricMismatchCount,
+    kMetricNanMismatchCount,
+    kMetricInfMismatchCount,
+    kMetricCosineSimilarity,
+    kMetricNum
+};
+
+struct PrecisionCompareMetricsParams {
+    int64_t num = 0;
+    double atol = 0;
+    double rtol = 0;
+};
+
+class PrecisionCompareMetricsCpuKernel : public CpuKernel {
+public:
+    PrecisionCompareMetricsCpuKernel() = default;
+    ~PrecisionCompareMetricsCpuKernel() override = default;
+    uint32_t Compute(CpuKernelContext& ctx) override;
+
+private:
+    uint32_t ParseParams(const CpuKernelContext& ctx, PrecisionCompareMetricsParams& params) const;
+    template <typename T, typename Acc>
+    uint32_t MetricsCompute(const CpuKernelContext& ctx, const PrecisionCompareMetricsParams& params) const;
+};
+} // namespace aicpu
+#endif // AICPU_KERNELS_PRECISION_COMPARE_METRICS_H_
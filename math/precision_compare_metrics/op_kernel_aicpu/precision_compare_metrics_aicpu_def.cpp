@@ -0,0 +1,31 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "register/op_def_registry.h"
+#include "../../../common/inc/aicpu/aicpu_op_def.h"
+
+namespace ops {
+class PrecisionCompareMetrics : public OpDef {
+public:
+    explicit PrecisionCompareMetrics(const char* name) : OpDef(name)
+    {
+        this->Input("golden").DataType({ge::DT_FLOAT16, ge::DT_BF16, ge::DT_FLOAT});
+        this->Input("realdata").DataType({ge::DT_FLOAT16, ge::DT_BF16, ge::DT_FLOAT});
+        this->Output("metrics").DataType({ge::DT_DOUBLE, ge::DT_DOUBLE, ge::DT_DOUBLE});
+        this->Attr("atol").AttrType(OPTIONAL).Float(1e-5);
+        this->Attr("rtol").AttrType(OPTIONAL).Float(1e-3);
+
+        ApplyMathAicpuDefaultCfg(*this);
+        this->AICPU().ExtendCfgInfo(OP_INFO_OPS_FLAG.c_str(), OPEN_OPS_FLAG.c_str());
+    }
+};
+
+OP_ADD(PrecisionCompareMetrics);
+} // namespace ops
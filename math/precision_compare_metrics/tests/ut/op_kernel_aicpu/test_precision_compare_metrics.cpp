@@ -0,0 +1,233 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "utils/aicpu_test_utils.h"
+#include "cpu_kernel_utils.h"
+#include "node_def_builder.h"
+
+using namespace std;
+using namespace aicpu;
+
+class TEST_PRECISION_COMPARE_METRICS_UT : public testing::Test {};
+
+#define CREATE_NODEDEF(shapes, data_types, datas, atol, rtol)                                  \
+    auto node_def = CpuKernelUtils::CreateNodeDef();                                           \
+    NodeDefBuilder(node_def.get(), "PrecisionCompareMetrics", "PrecisionCompareMetrics")       \
+        .Input({"golden", data_types[0], shapes[0], datas[0]})                                 \
+        .Input({"realdata", data_types[1], shapes[1], datas[1]})                               \
+        .Output({"metrics", data_types[2], shapes[2], datas[2]})                               \
+        .Attr("atol", (float)(atol))                                                           \
+        .Attr("rtol", (float)(rtol))
+
+namespace {
+constexpr int64_t kMetricNum = 6;
+
+// max abs, max rel, mismatch, nan mismatch, inf mismatch, cosine, all finite inputs.
+vector<double> ReferenceMetrics(const vector<float>& golden, const vector<float>& real, double atol, double rtol)
+{
+    vector<double> expect(kMetricNum, 0.0);
+    double dot = 0;
+    double gg = 0;
+    double rr = 0;
+    for (size_t i = 0; i < golden.size(); i++) {
+        double g = golden[i];
+        double r = real[i];
+        double diff = fabs(r - g);
+        expect[0] = max(expect[0], diff);
+        if (g != 0) {
+            expect[1] = max(expect[1], diff / fabs(g));
+        } else if (diff > 0) {
+            expect[1] = numeric_limits<double>::infinity();
+        }
+        expect[2] += (diff > atol + rtol * fabs(g)) ? 1 : 0;
+        dot += g * r;
+        gg += g * g;
+        rr += r * r;
+    }
+    expect[5] = dot / (sqrt(gg) * sqrt(rr));
+    return expect;
+}
+} // namespace
+
+TEST_F(TEST_PRECISION_COMPARE_METRICS_UT, FLOAT_SUCCESS)
+{
+    float golden[6] = {1.0f, -2.0f, 4.0f, 0.0f, 10.0f, 3.0f};
+    float real[6] = {1.0f, -2.5f, 4.001f, 0.5f, 10.0f, 3.0f};
+    double metrics[kMetricNum] = {0};
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_DOUBLE};
+    vector<vector<int64_t>> shapes = {{2, 3}, {2, 3}, {kMetricNum}};
+    vector<void*> datas = {(void*)golden, (void*)real, (void*)metrics};
+    CREATE_NODEDEF(shapes, data_types, datas, 1e-5, 1e-3);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+    auto expect = ReferenceMetrics(vector<float>(golden, golden + 6), vector<float>(real, real + 6), 1e-5, 1e-3);
+    EXPECT_DOUBLE_EQ(metrics[0], 0.5);
+    // golden 0 against real 0.5 has no finite relative error.
+    EXPECT_EQ(metrics[1], numeric_limits<double>::infinity());
+    EXPECT_EQ(metrics[1], expect[1]);
+    EXPECT_EQ(metrics[2], 2);
+    EXPECT_EQ(metrics[3], 0);
+    EXPECT_EQ(metrics[4], 0);
+    EXPECT_NEAR(metrics[5], expect[5], 1e-12);
+}
+
+TEST_F(TEST_PRECISION_COMPARE_METRICS_UT, FLOAT_MATCHING_ZERO_GOLDEN_SUCCESS)
+{
+    float golden[6] = {1.0f, -2.0f, 4.0f, 0.0f, 10.0f, 0.0f};
+    float real[6] = {1.0f, -2.5f, 4.001f, 0.0f, 10.0f, 0.0f};
+    double metrics[kMetricNum] = {0};
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_DOUBLE};
+    vector<vector<int64_t>> shapes = {{6}, {6}, {kMetricNum}};
+    vector<void*> datas = {(void*)golden, (void*)real, (void*)metrics};
+    CREATE_NODEDEF(shapes, data_types, datas, 1e-5, 1e-3);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+    // Zeros that match exactly contribute no relative error.
+    auto expect = ReferenceMetrics(vector<float>(golden, golden + 6), vector<float>(real, real + 6), 1e-5, 1e-3);
+    EXPECT_DOUBLE_EQ(metrics[1], 0.25);
+    EXPECT_EQ(metrics[1], expect[1]);
+    EXPECT_EQ(metrics[2], expect[2]);
+}
+
+TEST_F(TEST_PRECISION_COMPARE_METRICS_UT, FLOAT16_NAN_INF_SUCCESS)
+{
+    const float inf = numeric_limits<float>::infinity();
+    const float nan = numeric_limits<float>::quiet_NaN();
+    vector<float> golden_f = {1.0f, nan, nan, inf, inf, -inf, 2.0f, 3.0f};
+    vector<float> real_f = {1.0f, nan, 1.0f, inf, -inf, 5.0f, inf, 3.5f};
+    vector<Eigen::half> golden(golden_f.size());
+    vector<Eigen::half> real(real_f.size());
+    for (size_t i = 0; i < golden_f.size(); i++) {
+        golden[i] = Eigen::half(golden_f[i]);
+        real[i] = Eigen::half(real_f[i]);
+    }
+    double metrics[kMetricNum] = {0};
+    vector<DataType> data_types = {DT_FLOAT16, DT_FLOAT16, DT_DOUBLE};
+    vector<vector<int64_t>> shapes = {{8}, {8}, {kMetricNum}};
+    vector<void*> datas = {(void*)golden.data(), (void*)real.data(), (void*)metrics};
+    CREATE_NODEDEF(shapes, data_types, datas, 1e-3, 1e-3);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+    // Finite pairs: (1, 1) and (3, 3.5); (inf, -inf), (-inf, 5) and (2, inf) are Inf mismatches.
+    EXPECT_DOUBLE_EQ(metrics[0], 0.5);
+    EXPECT_NEAR(metrics[1], 0.5 / 3.0, 1e-6);
+    EXPECT_EQ(metrics[2], 5);
+    EXPECT_EQ(metrics[3], 1);
+    EXPECT_EQ(metrics[4], 3);
+    EXPECT_NEAR(metrics[5], 11.5 / (sqrt(10.0) * sqrt(13.25)), 1e-6);
+}
+
+TEST_F(TEST_PRECISION_COMPARE_METRICS_UT, BFLOAT16_SUCCESS)
+{
+    const int64_t num = 3000;
+    vector<float> golden_f(num);
+    vector<float> real_f(num);
+    SetRandomValue<float>(golden_f.data(), num, -4.0, 4.0);
+    vector<Eigen::bfloat16> golden(num);
+    vector<Eigen::bfloat16> real(num);
+    for (int64_t i = 0; i < num; i++) {
+        golden[i] = Eigen::bfloat16(golden_f[i]);
+        real[i] = Eigen::bfloat16(golden_f[i] * ((i % 7 == 0) ? 1.05f : 1.0f));
+        golden_f[i] = static_cast<float>(golden[i]);
+        real_f[i] = static_cast<float>(real[i]);
+    }
+    double metrics[kMetricNum] = {0};
+    vector<DataType> data_types = {DT_BFLOAT16, DT_BFLOAT16, DT_DOUBLE};
+    vector<vector<int64_t>> shapes = {{num}, {num}, {kMetricNum}};
+    vector<void*> datas = {(void*)golden.data(), (void*)real.data(), (void*)metrics};
+    CREATE_NODEDEF(shapes, data_types, datas, 1e-2, 1e-2);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+    auto expect = ReferenceMetrics(golden_f, real_f, 1e-2, 1e-2);
+    EXPECT_NEAR(metrics[0], expect[0], 1e-6);
+    EXPECT_NEAR(metrics[1], expect[1], 1e-6);
+    EXPECT_EQ(metrics[2], expect[2]);
+    EXPECT_NEAR(metrics[5], expect[5], 1e-9);
+}
+
+TEST_F(TEST_PRECISION_COMPARE_METRICS_UT, FLOAT_LARGE_PARALLEL_SUCCESS)
+{
+    const int64_t num = 4 * 1024 * 1024 + 77;
+    vector<float> golden(num);
+    vector<float> real(num);
+    SetRandomValue<float>(golden.data(), num, -1.0, 1.0);
+    for (int64_t i = 0; i < num; i++) {
+        real[i] = golden[i] + ((i % 1001 == 0) ? 1e-2f : 1e-7f);
+    }
+    double metrics[kMetricNum] = {0};
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_DOUBLE};
+    vector<vector<int64_t>> shapes = {{num}, {num}, {kMetricNum}};
+    vector<void*> datas = {(void*)golden.data(), (void*)real.data(), (void*)metrics};
+    CREATE_NODEDEF(shapes, data_types, datas, 1e-4, 1e-3);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+    auto expect = ReferenceMetrics(golden, real, 1e-4, 1e-3);
+    EXPECT_NEAR(metrics[0], expect[0], 1e-12);
+    EXPECT_NEAR(metrics[1], expect[1], expect[1] * 1e-12);
+    EXPECT_EQ(metrics[2], expect[2]);
+    EXPECT_EQ(metrics[3], 0);
+    EXPECT_EQ(metrics[4], 0);
+    EXPECT_NEAR(metrics[5], expect[5], 1e-12);
+}
+
+TEST_F(TEST_PRECISION_COMPARE_METRICS_UT, ZERO_INPUTS_SUCCESS)
+{
+    float golden[4] = {0};
+    float real[4] = {0};
+    double metrics[kMetricNum] = {0};
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_DOUBLE};
+    vector<vector<int64_t>> shapes = {{4}, {4}, {kMetricNum}};
+    vector<void*> datas = {(void*)golden, (void*)real, (void*)metrics};
+    CREATE_NODEDEF(shapes, data_types, datas, 1e-5, 1e-3);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    EXPECT_EQ(metrics[2], 0);
+    EXPECT_EQ(metrics[5], 1.0);
+}
+
+TEST_F(TEST_PRECISION_COMPARE_METRICS_UT, INPUT_DTYPE_MISMATCH_FAILED)
+{
+    float golden[4] = {0};
+    Eigen::half real[4];
+    double metrics[kMetricNum] = {0};
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT16, DT_DOUBLE};
+    vector<vector<int64_t>> shapes = {{4}, {4}, {kMetricNum}};
+    vector<void*> datas = {(void*)golden, (void*)real, (void*)metrics};
+    CREATE_NODEDEF(shapes, data_types, datas, 1e-5, 1e-3);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
+}
+
+TEST_F(TEST_PRECISION_COMPARE_METRICS_UT, METRICS_SHAPE_FAILED)
+{
+    float golden[4] = {0};
+    float real[4] = {0};
+    double metrics[4] = {0};
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_DOUBLE};
+    vector<vector<int64_t>> shapes = {{4}, {4}, {4}};
+    vector<void*> datas = {(void*)golden, (void*)real, (void*)metrics};
+    CREATE_NODEDEF(shapes, data_types, datas, 1e-5, 1e-3);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
+}
+
+TEST_F(TEST_PRECISION_COMPARE_METRICS_UT, SHAPE_MISMATCH_FAILED)
+{
+    float golden[4] = {0};
+    float real[4] = {0};
+    double metrics[kMetricNum] = {0};
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_DOUBLE};
+    vector<vector<int64_t>> shapes = {{4}, {2, 2}, {kMetricNum}};
+    vector<void*> datas = {(void*)golden, (void*)real, (void*)metrics};
+    CREATE_NODEDEF(shapes, data_types, datas, 1e-5, 1e-3);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
+}
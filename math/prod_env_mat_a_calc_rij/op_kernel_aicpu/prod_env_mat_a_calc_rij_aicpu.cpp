@@ -45,6 +45,9 @@ constexpr int32_t kMeshSectionsBeforeNeigh = 2; // ilist + numneigh sections, ea
 // Per core-region atom the mesh tensor reserves 1026 = 2 + kNeighborMaxNum int32 slots when it also carries the
 // nallmaptable, so this stride is used to locate that optional table.
 constexpr uint32_t kMeshDataLength = 1026;
+// Lower bound on core-region atoms per ParallelFor shard, so scheduling and scratch setup stay small next to the
+// per-atom neighbor scan.
+constexpr int32_t kMinAtomsPerShard = 32;
 } // namespace
 
 namespace aicpu {
@@ -200,8 +203,13 @@ uint32_t ProdEnvMatACalcRijCpuKernel::ProdEnvMatARijCal(FPTYPE* rij, const CpuKe
         blk.meshdata.nallmaptable = &p_mesh[kMeshHeaderNum + kMeshDataLength * blk.meshdata.nlocnum];
     }
 
-    return CpuKernelUtils::ParallelFor(ctx, nloc, 1,
-                                       [this, &blk](int32_t start, int32_t end) { ComputeRijBlock(blk, start, end); });
+    // One shard per core (at least kMinAtomsPerShard atoms) instead of one atom per task.
+    const int32_t cpu_num = static_cast<int32_t>(std::max(1U, CpuKernelUtils::GetCPUNum(ctx)));
+    const int32_t per_unit = std::max(kMinAtomsPerShard, (nloc + cpu_num - 1) / cpu_num);
+    return CpuKernelUtils::ParallelFor(
+        ctx, nloc, per_unit, [this, &blk](int64_t start, int64_t end) {
+            ComputeRijBlock(blk, static_cast<int32_t>(start), static_cast<int32_t>(end));
+        });
 }
 
 template <typename FPTYPE>
@@ -216,6 +224,7 @@ void ProdEnvMatACalcRijCpuKernel::ComputeRijBlock(const RijBlock<FPTYPE>& blk, i
     (void)memset_s(blk.rij_x + start * blk.nnei, rijaxeslen, 0x00, rijaxeslen);
     (void)memset_s(blk.rij_y + start * blk.nnei, rijaxeslen, 0x00, rijaxeslen);
     (void)memset_s(blk.rij_z + start * blk.nnei, rijaxeslen, 0x00, rijaxeslen);
+    NeighborScratch scratch(blk.atom_types);
     for (int32_t ii = start; ii < end; ii++) {
         int32_t num_neighbor = blk.meshdata.numneigh[ii];
         if (num_neighbor == -1) {
@@ -227,20 +236,18 @@ void ProdEnvMatACalcRijCpuKernel::ComputeRijBlock(const RijBlock<FPTYPE>& blk, i
         FPTYPE i_x = blk.coord[core_natom_index * kCoordinateXyzNum];
         FPTYPE i_y = blk.coord[core_natom_index * kCoordinateXyzNum + 1];
         FPTYPE i_z = blk.coord[core_natom_index * kCoordinateXyzNum + 2];
-        std::vector<std::vector<NeighborInfo>> sel = CollectSortedNeighbors(blk, ii, num_neighbor, i_x, i_y, i_z);
-        WriteAtomResults(blk, ii, i_x, i_y, i_z, sel);
+        CollectNearestNeighbors(blk, ii, num_neighbor, i_x, i_y, i_z, scratch);
+        WriteAtomResults(blk, ii, i_x, i_y, i_z, scratch);
     }
 }
 
 template <typename FPTYPE>
-std::vector<std::vector<ProdEnvMatACalcRijCpuKernel::NeighborInfo>> ProdEnvMatACalcRijCpuKernel::CollectSortedNeighbors(
-    const RijBlock<FPTYPE>& blk, int32_t ii, int32_t num_neighbor, FPTYPE i_x, FPTYPE i_y, FPTYPE i_z) const
+void ProdEnvMatACalcRijCpuKernel::CollectNearestNeighbors(const RijBlock<FPTYPE>& blk, int32_t ii,
+                                                          int32_t num_neighbor, FPTYPE i_x, FPTYPE i_y, FPTYPE i_z,
+                                                          NeighborScratch& scratch) const
 {
     const int32_t* neighbors = blk.meshdata.firstneigh[ii];
-    std::vector<std::vector<NeighborInfo>> sel(blk.atom_types, std::vector<NeighborInfo>());
-    for (auto& one_type : sel) {
-        one_type.reserve(static_cast<size_t>(num_neighbor));
-    }
+    std::fill(scratch.counts.begin(), scratch.counts.end(), 0);
     for (int32_t j = 0; j < num_neighbor; j++) {
         int32_t j_idx = neighbors[j];
         FPTYPE dx = blk.coord[j_idx * kCoordinateXyzNum] - i_x;
@@ -249,22 +256,28 @@ std::vector<std::vector<ProdEnvMatACalcRijCpuKernel::NeighborInfo>> ProdEnvMatAC
         FPTYPE rr = dx * dx + dy * dy + dz * dz;
         if (rr < blk.rcutsquared) {
             // Guard the type-indexed bucket: a type value outside [0, atom_types) — including every value when sel_a
-            // is empty and atom_types is 0 — would otherwise index sel out of range.
+            // is empty and atom_types is 0 — would otherwise index the scratch out of range.
             int32_t j_type = blk.type[j_idx];
             if (j_type >= 0 && j_type < blk.atom_types) {
-                sel[j_type].emplace_back(static_cast<float>(rr), j_idx);
+                scratch.Bucket(j_type)[scratch.counts[j_type]++] = NeighborInfo(static_cast<float>(rr), j_idx);
             }
         }
     }
-    for (auto& one_type : sel) {
-        std::sort(one_type.begin(), one_type.end());
+    // Only the sel_a[type] nearest neighbors of each type are written out, so order just that prefix.
+    const std::vector<int64_t>& sec_a = *blk.sec_a;
+    for (int32_t t = 0; t < blk.atom_types; t++) {
+        NeighborInfo* bucket = scratch.Bucket(t);
+        const int32_t count = scratch.counts[t];
+        const int64_t quota = std::max(sec_a[t + 1] - sec_a[t], static_cast<int64_t>(0));
+        const int32_t keep = static_cast<int32_t>(std::min(quota, static_cast<int64_t>(count)));
+        std::partial_sort(bucket, bucket + keep, bucket + count);
+        scratch.counts[t] = keep;
     }
-    return sel;
 }
 
 template <typename FPTYPE>
 void ProdEnvMatACalcRijCpuKernel::WriteAtomResults(const RijBlock<FPTYPE>& blk, int32_t ii, FPTYPE i_x, FPTYPE i_y,
-                                                   FPTYPE i_z, const std::vector<std::vector<NeighborInfo>>& sel) const
+                                                   FPTYPE i_z, const NeighborScratch& scratch) const
 {
     FPTYPE* cur_rij = blk.rij + ii * blk.nnei * kCoordinateXyzNum;
     int32_t* cur_nlist = blk.nlist + ii * blk.nnei;
@@ -273,13 +286,13 @@ void ProdEnvMatACalcRijCpuKernel::WriteAtomResults(const RijBlock<FPTYPE>& blk,
     FPTYPE* cur_rij_y = blk.rij_y + ii * blk.nnei;
     FPTYPE* cur_rij_z = blk.rij_z + ii * blk.nnei;
     const std::vector<int64_t>& sec_a = *blk.sec_a;
-    for (uint32_t m_k = 0; m_k < sel.size(); m_k++) {
-        uint32_t sorted_idx = 0;
-        int64_t cnt_size = std::min(sec_a[m_k + 1], sec_a[m_k] + static_cast<int64_t>(sel[m_k].size()));
-        for (int64_t res_idx = sec_a[m_k]; res_idx < cnt_size; res_idx++) {
-            int32_t cur_atom_idx = sel[m_k][sorted_idx].index;
+    for (int32_t m_k = 0; m_k < blk.atom_types; m_k++) {
+        const NeighborInfo* sorted = scratch.Bucket(m_k);
+        int64_t cnt_size = sec_a[m_k] + scratch.counts[m_k];
+        for (int64_t res_idx = sec_a[m_k]; res_idx < cnt_size; res_idx++, sorted++) {
+            int32_t cur_atom_idx = sorted->index;
             cur_nlist[res_idx] = blk.needmap ? blk.meshdata.nallmaptable[cur_atom_idx] : cur_atom_idx;
-            cur_dist[res_idx] = sel[m_k][sorted_idx].dist;
+            cur_dist[res_idx] = sorted->dist;
             FPTYPE dx = blk.coord[cur_atom_idx * kCoordinateXyzNum] - i_x;
             FPTYPE dy = blk.coord[cur_atom_idx * kCoordinateXyzNum + 1] - i_y;
             FPTYPE dz = blk.coord[cur_atom_idx * kCoordinateXyzNum + 2] - i_z;
@@ -289,7 +302,6 @@ void ProdEnvMatACalcRijCpuKernel::WriteAtomResults(const RijBlock<FPTYPE>& blk,
             cur_rij_x[res_idx] = dx;
             cur_rij_y[res_idx] = dy;
             cur_rij_z[res_idx] = dz;
-            sorted_idx++;
         }
     }
 }
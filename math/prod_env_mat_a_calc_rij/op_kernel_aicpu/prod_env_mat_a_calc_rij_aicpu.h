@@ -72,6 +72,21 @@ private:
         float rcutsquared;
     };
 
+    // Per-shard scratch reused across the atoms of one ComputeRijBlock call: one fixed kNeighborMaxNum slot per atom
+    // type, so collecting a neighbor never allocates.
+    struct NeighborScratch {
+        std::vector<NeighborInfo> items;
+        std::vector<int32_t> counts;
+        explicit NeighborScratch(int32_t atom_types)
+            : items(static_cast<size_t>(atom_types) * kNeighborMaxNum), counts(static_cast<size_t>(atom_types), 0)
+        {}
+        NeighborInfo* Bucket(int32_t type) { return items.data() + static_cast<size_t>(type) * kNeighborMaxNum; }
+        const NeighborInfo* Bucket(int32_t type) const
+        {
+            return items.data() + static_cast<size_t>(type) * kNeighborMaxNum;
+        }
+    };
+
     uint32_t GetInputAndCheck(const CpuKernelContext& ctx) const;
     uint32_t DoCompute(const CpuKernelContext& ctx) const;
     template <typename FPTYPE>
@@ -83,12 +98,11 @@ private:
     template <typename FPTYPE>
     void ComputeRijBlock(const RijBlock<FPTYPE>& blk, int32_t start, int32_t end) const;
     template <typename FPTYPE>
-    std::vector<std::vector<NeighborInfo>> CollectSortedNeighbors(const RijBlock<FPTYPE>& blk, int32_t ii,
-                                                                  int32_t num_neighbor, FPTYPE i_x, FPTYPE i_y,
-                                                                  FPTYPE i_z) const;
+    void CollectNearestNeighbors(const RijBlock<FPTYPE>& blk, int32_t ii, int32_t num_neighbor, FPTYPE i_x,
+                                 FPTYPE i_y, FPTYPE i_z, NeighborScratch& scratch) const;
     template <typename FPTYPE>
     void WriteAtomResults(const RijBlock<FPTYPE>& blk, int32_t ii, FPTYPE i_x, FPTYPE i_y, FPTYPE i_z,
-                          const std::vector<std::vector<NeighborInfo>>& sel) const;
+                          const NeighborScratch& scratch) const;
 };
 } // namespace aicpu
 #endif
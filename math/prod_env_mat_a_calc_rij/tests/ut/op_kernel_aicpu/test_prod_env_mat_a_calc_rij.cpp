@@ -18,6 +18,8 @@
 #undef private
 #undef protected
 
+#include <algorithm>
+#include <utility>
 #include <vector>
 
 using namespace std;
@@ -225,6 +227,98 @@ TEST_F(TEST_PROD_ENV_MAT_A_CALC_RIJ_UT, TYPE_OUT_OF_RANGE_SKIPPED_SUCC)
     }
 }
 
+// 200 core atoms on a jittered grid, two atom types, every other atom listed as a candidate neighbor. sel_a keeps
+// fewer slots than there are in-cutoff neighbors of each type, so only the nearest prefix of each type is written;
+// the result is checked against a full sort of the candidates.
+TEST_F(TEST_PROD_ENV_MAT_A_CALC_RIJ_UT, MANY_ATOMS_NEAREST_SELECTION_SUCC)
+{
+    constexpr int32_t kAtomNum = 200;
+    constexpr int32_t kCandidateNum = 120;
+    const std::vector<int64_t> sel_a = {6, 4};
+    constexpr int32_t kManyNnei = 10;
+    constexpr float kRcut = 3.0f;
+    constexpr int32_t kManyMeshLen = kMeshHeaderNum + kMeshSectionsBeforeNeigh * kAtomNum + kAtomNum * kNeighborMaxNum;
+
+    std::vector<float> coord(kAtomNum * kCoordinateXyzNum);
+    std::vector<int32_t> type(kAtomNum);
+    for (int32_t i = 0; i < kAtomNum; i++) {
+        // Distinct squared distances: a 6x6x6 lattice with per-atom jitter that never repeats.
+        coord[i * kCoordinateXyzNum] = static_cast<float>(i % 6) + 0.001f * static_cast<float>(i);
+        coord[i * kCoordinateXyzNum + 1] = static_cast<float>((i / 6) % 6) + 0.0007f * static_cast<float>(i * i % 97);
+        coord[i * kCoordinateXyzNum + 2] = static_cast<float>(i / 36) + 0.0003f * static_cast<float>(i * 7 % 89);
+        type[i] = i % 2;
+    }
+    std::vector<int32_t> mesh(kManyMeshLen, 0);
+    mesh[0] = kAtomNum;
+    for (int32_t i = 0; i < kAtomNum; i++) {
+        mesh[kMeshHeaderNum + i] = i;
+        mesh[kMeshHeaderNum + kAtomNum + i] = kCandidateNum;
+        int32_t* firstneigh = &mesh[kMeshHeaderNum + kMeshSectionsBeforeNeigh * kAtomNum + i * kNeighborMaxNum];
+        for (int32_t j = 0; j < kCandidateNum; j++) {
+            firstneigh[j] = (i + 1 + j) % kAtomNum;
+        }
+    }
+
+    vector<DataType> data_types = {DT_FLOAT, DT_INT32, DT_INT32, DT_FLOAT, DT_INT32, DT_FLOAT,
+                                   DT_INT32, DT_FLOAT, DT_FLOAT, DT_FLOAT, DT_FLOAT};
+    const int64_t result_num = static_cast<int64_t>(kAtomNum) * kManyNnei;
+    vector<vector<int64_t>> shapes = {{1, kAtomNum * kCoordinateXyzNum},
+                                      {1, kAtomNum},
+                                      {3},
+                                      {1, 9},
+                                      {static_cast<int64_t>(kManyMeshLen)},
+                                      {1, result_num * kCoordinateXyzNum},
+                                      {1, result_num},
+                                      {1, result_num},
+                                      {1, result_num},
+                                      {1, result_num},
+                                      {1, result_num}};
+    int32_t natoms[3] = {kAtomNum, kAtomNum, kAtomNum};
+    float box[9] = {0.0f};
+    std::vector<float> rij(result_num * kCoordinateXyzNum, 0.0f);
+    std::vector<int32_t> nlist(result_num, 0);
+    std::vector<float> distance(result_num, 0.0f);
+    std::vector<float> rij_x(result_num, 0.0f);
+    std::vector<float> rij_y(result_num, 0.0f);
+    std::vector<float> rij_z(result_num, 0.0f);
+
+    vector<void*> datas = {(void*)coord.data(), (void*)type.data(),     (void*)natoms,       (void*)box,
+                           (void*)mesh.data(),  (void*)rij.data(),      (void*)nlist.data(), (void*)distance.data(),
+                           (void*)rij_x.data(), (void*)rij_y.data(),    (void*)rij_z.data()};
+    auto node_def = CpuKernelUtils::CreateNodeDef();
+    CREATE_NODEDEF(node_def, shapes, data_types, datas, sel_a, kRcut);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+    for (int32_t i = 0; i < kAtomNum; i++) {
+        std::vector<std::pair<float, int32_t>> by_type[2];
+        for (int32_t j = 0; j < kCandidateNum; j++) {
+            int32_t j_idx = (i + 1 + j) % kAtomNum;
+            float dx = coord[j_idx * kCoordinateXyzNum] - coord[i * kCoordinateXyzNum];
+            float dy = coord[j_idx * kCoordinateXyzNum + 1] - coord[i * kCoordinateXyzNum + 1];
+            float dz = coord[j_idx * kCoordinateXyzNum + 2] - coord[i * kCoordinateXyzNum + 2];
+            float rr = dx * dx + dy * dy + dz * dz;
+            if (rr < kRcut * kRcut) {
+                by_type[type[j_idx]].emplace_back(rr, j_idx);
+            }
+        }
+        int32_t slot = 0;
+        for (int32_t t = 0; t < 2; t++) {
+            std::sort(by_type[t].begin(), by_type[t].end());
+            for (int64_t k = 0; k < sel_a[t]; k++, slot++) {
+                const int64_t out = static_cast<int64_t>(i) * kManyNnei + slot;
+                if (k < static_cast<int64_t>(by_type[t].size())) {
+                    EXPECT_EQ(nlist[out], by_type[t][k].second);
+                    EXPECT_FLOAT_EQ(distance[out], by_type[t][k].first);
+                    EXPECT_FLOAT_EQ(rij_x[out], coord[by_type[t][k].second * kCoordinateXyzNum] -
+                                                    coord[i * kCoordinateXyzNum]);
+                } else {
+                    EXPECT_EQ(nlist[out], -1);
+                }
+            }
+        }
+    }
+}
+
 // sel_a empty -> atom_types = 0, nnei = 0: a neighbor within rcut must not index the empty sel bucket (would crash).
 TEST_F(TEST_PROD_ENV_MAT_A_CALC_RIJ_UT, EMPTY_SEL_A_NO_CRASH_SUCC)
 {
@@ -0,0 +1,48 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file qr_proto.h
+ * \brief
+ */
+#ifndef OPS_OP_PROTO_INC_QR_OPS_H_
+#define OPS_OP_PROTO_INC_QR_OPS_H_
+
+#include "graph/operator.h"
+#include "graph/operator_reg.h"
+
+namespace ge {
+/**
+* @brief Computes the QR decompositions of one or more matrices. \n
+
+* @par Inputs:
+* x: A tensor of shape [..., M, N]. Must be one of the following types: float32, double, complex64, complex128. \n
+
+* @par Attributes:
+* full_matrices: An optional bool. If true, compute full-sized q and r, otherwise only the leading min(M, N)
+* columns of q and rows of r. Default: False. \n
+
+* @par Outputs:
+* @li q: Orthonormal basis of x, of shape [..., M, M] (full_matrices) or [..., M, min(M, N)].
+* @li r: Upper triangular factor, of shape [..., M, N] (full_matrices) or [..., min(M, N), N]. \n
+
+* @par Third-party framework compatibility
+* Compatible with tensorflow Qr operator.
+*/
+REG_OP(Qr)
+    .INPUT(x, TensorType({DT_FLOAT, DT_DOUBLE, DT_COMPLEX64, DT_COMPLEX128}))
+    .OUTPUT(q, TensorType({DT_FLOAT, DT_DOUBLE, DT_COMPLEX64, DT_COMPLEX128}))
+    .OUTPUT(r, TensorType({DT_FLOAT, DT_DOUBLE, DT_COMPLEX64, DT_COMPLEX128}))
+    .ATTR(full_matrices, Bool, false)
+    .OP_END_FACTORY_REG(Qr)
+
+} // namespace ge
+
+#endif // OPS_OP_PROTO_INC_QR_OPS_H_
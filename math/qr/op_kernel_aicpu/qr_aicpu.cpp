@@ -0,0 +1,171 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "qr_aicpu.h"
+
+#include <algorithm>
+#include <complex>
+#include <vector>
+
+#include "aicpu/householder_qr.h"
+#include "cpu_kernel_utils.h"
+#include "utils/kernel_util.h"
+
+namespace {
+const char* const kQr = "Qr";
+constexpr int64_t kMatrixRank = 2;
+// A batch smaller than the core count is factored matrix by matrix, splitting the block updates of matrices of
+// at least kQrSplitElements elements across the cores instead.
+constexpr int64_t kQrSplitElements = 128 * 128;
+} // namespace
+
+namespace aicpu {
+uint32_t QrCpuKernel::Compute(CpuKernelContext& ctx)
+{
+    QrParams params;
+    KERNEL_HANDLE_ERROR(ParseParams(ctx, params), "[%s] check params failed.", kQr);
+    auto data_type = ctx.Input(kFirstInputIndex)->GetDataType();
+    switch (data_type) {
+        case DT_FLOAT:
+            return QrCompute<float>(ctx, params);
+        case DT_DOUBLE:
+            return QrCompute<double>(ctx, params);
+        case DT_COMPLEX64:
+            return QrCompute<std::complex<float>>(ctx, params);
+        case DT_COMPLEX128:
+            return QrCompute<std::complex<double>>(ctx, params);
+        default:
+            KERNEL_LOG_ERROR("[%s] invalid input type [%s]", kQr, DTypeStr(data_type).c_str());
+            return KERNEL_STATUS_PARAM_INVALID;
+    }
+}
+
+uint32_t QrCpuKernel::ParseParams(const CpuKernelContext& ctx, QrParams& params) const
+{
+    Tensor* input = ctx.Input(kFirstInputIndex);
+    Tensor* q = ctx.Output(kFirstOutputIndex);
+    Tensor* r = ctx.Output(kSecondOutputIndex);
+    KERNEL_CHECK_NULLPTR(input, KERNEL_STATUS_PARAM_INVALID, "[%s] get input failed.", kQr)
+    KERNEL_CHECK_NULLPTR(q, KERNEL_STATUS_PARAM_INVALID, "[%s] get output q failed.", kQr)
+    KERNEL_CHECK_NULLPTR(r, KERNEL_STATUS_PARAM_INVALID, "[%s] get output r failed.", kQr)
+    KERNEL_CHECK_NULLPTR(input->GetTensorShape(), KERNEL_STATUS_PARAM_INVALID, "[%s] get input shape failed.", kQr)
+    KERNEL_CHECK_NULLPTR(q->GetTensorShape(), KERNEL_STATUS_PARAM_INVALID, "[%s] get q shape failed.", kQr)
+    KERNEL_CHECK_NULLPTR(r->GetTensorShape(), KERNEL_STATUS_PARAM_INVALID, "[%s] get r shape failed.", kQr)
+    const DataType data_type = input->GetDataType();
+    KERNEL_CHECK_FALSE(q->GetDataType() == data_type && r->GetDataType() == data_type, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] q [%s] and r [%s] should have the input type [%s].", kQr,
+                       DTypeStr(q->GetDataType()).c_str(), DTypeStr(r->GetDataType()).c_str(),
+                       DTypeStr(data_type).c_str());
+
+    std::vector<int64_t> dims = input->GetTensorShape()->GetDimSizes();
+    const int32_t rank = static_cast<int32_t>(dims.size());
+    KERNEL_CHECK_FALSE(rank >= kMatrixRank, KERNEL_STATUS_PARAM_INVALID, "[%s] input rank [%d] should be at least 2.",
+                       kQr, rank);
+    params.m = dims[rank - 2];
+    params.n = dims[rank - 1];
+    AttrValue* full_attr = ctx.GetAttr("full_matrices");
+    const bool full_matrices = (full_attr == nullptr) ? false : full_attr->GetBool();
+    params.q_cols = full_matrices ? params.m : std::min(params.m, params.n);
+    params.batch = 1;
+    for (int32_t i = 0; i < rank - kMatrixRank; i++) {
+        params.batch *= dims[i];
+    }
+
+    std::vector<int64_t> q_dims(dims.begin(), dims.end() - kMatrixRank);
+    std::vector<int64_t> r_dims = q_dims;
+    q_dims.push_back(params.m);
+    q_dims.push_back(params.q_cols);
+    r_dims.push_back(params.q_cols);
+    r_dims.push_back(params.n);
+    KERNEL_CHECK_FALSE(q->GetTensorShape()->GetDimSizes() == q_dims, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] q shape should be [..., %ld, %ld].", kQr, params.m, params.q_cols);
+    KERNEL_CHECK_FALSE(r->GetTensorShape()->GetDimSizes() == r_dims, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] r shape should be [..., %ld, %ld].", kQr, params.q_cols, params.n);
+    if (params.batch * params.m * params.n > 0) {
+        KERNEL_CHECK_NULLPTR(input->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] get input data failed.", kQr)
+    }
+    if (params.batch * params.m * params.q_cols > 0) {
+        KERNEL_CHECK_NULLPTR(q->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] get q data failed.", kQr)
+    }
+    if (params.batch * params.q_cols * params.n > 0) {
+        KERNEL_CHECK_NULLPTR(r->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] get r data failed.", kQr)
+    }
+    return KERNEL_STATUS_OK;
+}
+
+template <typename T>
+uint32_t QrCpuKernel::QrCompute(const CpuKernelContext& ctx, const QrParams& params) const
+{
+    const int64_t m = params.m;
+    const int64_t n = params.n;
+    const int64_t q_cols = params.q_cols;
+    const int64_t k = std::min(m, n);
+    const T* input = reinterpret_cast<const T*>(ctx.Input(kFirstInputIndex)->GetData());
+    T* q_out = reinterpret_cast<T*>(ctx.Output(kFirstOutputIndex)->GetData());
+    T* r_out = reinterpret_cast<T*>(ctx.Output(kSecondOutputIndex)->GetData());
+
+    auto factor = [input, q_out, r_out, m, n, q_cols, k](int64_t start, int64_t end, const LinalgRunner& run) {
+        std::vector<T> a(static_cast<size_t>(m * n));
+        std::vector<T> q(static_cast<size_t>(m * q_cols));
+        HouseholderQr<T> qr;
+        for (int64_t b = start; b < end; b++) {
+            const T* x = input + b * m * n;
+            for (int64_t i = 0; i < m; i++) {
+                for (int64_t j = 0; j < n; j++) {
+                    a[j * m + i] = x[i * n + j];
+                }
+            }
+            qr.Factor(a.data(), m, n, run);
+            T* r = r_out + b * q_cols * n;
+            for (int64_t i = 0; i < q_cols; i++) {
+                for (int64_t j = 0; j < n; j++) {
+                    r[i * n + j] = (i <= j && i < k) ? a[j * m + i] : T(0);
+                }
+            }
+            qr.FormQ(a.data(), q.data(), q_cols, run);
+            T* q_row = q_out + b * m * q_cols;
+            for (int64_t i = 0; i < m; i++) {
+                for (int64_t j = 0; j < q_cols; j++) {
+                    q_row[i * q_cols + j] = q[j * m + i];
+                }
+            }
+        }
+    };
+
+    const int64_t cores = std::max<int64_t>(1, static_cast<int64_t>(CpuKernelUtils::GetCPUNum(ctx)));
+    if (params.batch == 0) {
+        return KERNEL_STATUS_OK;
+    }
+    if (cores == 1 || (params.batch == 1 && m * n < kQrSplitElements)) {
+        factor(0, params.batch, LinalgRunSerial);
+        return KERNEL_STATUS_OK;
+    }
+    if (params.batch >= cores || m * n < kQrSplitElements) {
+        auto shard = [&factor](int64_t start, int64_t end) { factor(start, end, LinalgRunSerial); };
+        KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, params.batch, (params.batch + cores - 1) / cores, shard),
+                            "[%s] ParallelFor failed.", kQr)
+        return KERNEL_STATUS_OK;
+    }
+    uint32_t status = KERNEL_STATUS_OK;
+    auto split_run = [&ctx, &status, cores](int64_t total, int64_t min_chunk, const LinalgRangeFn& fn) {
+        const int64_t per_unit = std::max(min_chunk, (total + cores - 1) / cores);
+        if (total <= per_unit) {
+            LinalgRunSerial(total, min_chunk, fn);
+        } else if (CpuKernelUtils::ParallelFor(ctx, total, per_unit, fn) != KERNEL_STATUS_OK) {
+            status = KERNEL_STATUS_INNER_ERROR;
+        }
+    };
+    factor(0, params.batch, split_run);
+    KERNEL_CHECK_FALSE(status == KERNEL_STATUS_OK, status, "[%s] ParallelFor failed.", kQr);
+    return KERNEL_STATUS_OK;
+}
+
+REGISTER_CPU_KERNEL(kQr, QrCpuKernel);
+} // namespace aicpu
@@ -0,0 +1,39 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef AICPU_KERNELS_QR_H_
+#define AICPU_KERNELS_QR_H_
+
+#include <cstdint>
+
+#include "cpu_kernel.h"
+
+namespace aicpu {
+// batch matrices of m x n; Q is m x q_cols and R is q_cols x n with q_cols = m (full_matrices) or min(m, n).
+struct QrParams {
+    int64_t batch = 0;
+    int64_t m = 0;
+    int64_t n = 0;
+    int64_t q_cols = 0;
+};
+
+class QrCpuKernel : public CpuKernel {
+public:
+    QrCpuKernel() = default;
+    ~QrCpuKernel() override = default;
+    uint32_t Compute(CpuKernelContext& ctx) override;
+
+private:
+    uint32_t ParseParams(const CpuKernelContext& ctx, QrParams& params) const;
+    template <typename T>
+    uint32_t QrCompute(const CpuKernelContext& ctx, const QrParams& params) const;
+};
+} // namespace aicpu
+#endif // AICPU_KERNELS_QR_H_
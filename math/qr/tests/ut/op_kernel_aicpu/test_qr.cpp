@@ -0,0 +1,254 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <cmath>
+#include <complex>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "utils/aicpu_test_utils.h"
+#include "cpu_kernel_utils.h"
+#include "node_def_builder.h"
+
+using namespace std;
+using namespace aicpu;
+
+class TEST_QR_UT : public testing::Test {};
+
+#define CREATE_NODEDEF(shapes, data_types, datas, full_matrices) \
+    auto node_def = CpuKernelUtils::CreateNodeDef();             \
+    NodeDefBuilder(node_def.get(), "Qr", "Qr")                   \
+        .Input({"x", data_types[0], shapes[0], datas[0]})        \
+        .Output({"q", data_types[1], shapes[1], datas[1]})       \
+        .Output({"r", data_types[2], shapes[2], datas[2]})       \
+        .Attr("full_matrices", (bool)(full_matrices))
+
+namespace {
+double Abs(double v)
+{
+    return fabs(v);
+}
+
+template <typename R>
+double Abs(const complex<R>& v)
+{
+    return abs(complex<double>(v.real(), v.imag()));
+}
+
+double Conj(double v)
+{
+    return v;
+}
+
+template <typename R>
+complex<double> Conj(const complex<R>& v)
+{
+    return complex<double>(v.real(), -v.imag());
+}
+
+double Widen(float v)
+{
+    return v;
+}
+
+double Widen(double v)
+{
+    return v;
+}
+
+template <typename R>
+complex<double> Widen(const complex<R>& v)
+{
+    return complex<double>(v.real(), v.imag());
+}
+
+template <typename T>
+vector<T> RandomMatrix(size_t num);
+
+template <>
+vector<float> RandomMatrix<float>(size_t num)
+{
+    vector<float> values(num);
+    SetRandomValue<float>(values.data(), num, -1.0, 1.0);
+    return values;
+}
+
+template <>
+vector<double> RandomMatrix<double>(size_t num)
+{
+    vector<double> values(num);
+    SetRandomValue<double>(values.data(), num, -1.0, 1.0);
+    return values;
+}
+
+template <>
+vector<complex<float>> RandomMatrix<complex<float>>(size_t num)
+{
+    vector<float> raw = RandomMatrix<float>(num * 2);
+    vector<complex<float>> values(num);
+    for (size_t i = 0; i < num; i++) {
+        values[i] = complex<float>(raw[2 * i], raw[2 * i + 1]);
+    }
+    return values;
+}
+
+// Checks Q^H Q = I, R upper triangular and Q R = A for every matrix of the batch.
+template <typename T>
+bool CheckQr(const vector<T>& a, const vector<T>& q, const vector<T>& r, int64_t batch, int64_t m, int64_t n,
+             int64_t q_cols, double tol)
+{
+    for (int64_t b = 0; b < batch; b++) {
+        const T* ab = a.data() + b * m * n;
+        const T* qb = q.data() + b * m * q_cols;
+        const T* rb = r.data() + b * q_cols * n;
+        for (int64_t i = 0; i < q_cols; i++) {
+            for (int64_t j = 0; j < q_cols; j++) {
+                decltype(Widen(qb[0])) dot = 0;
+                for (int64_t t = 0; t < m; t++) {
+                    dot += Conj(qb[t * q_cols + i]) * Widen(qb[t * q_cols + j]);
+                }
+                if (Abs(dot - (i == j ? 1.0 : 0.0)) > tol) {
+                    return false;
+                }
+            }
+        }
+        for (int64_t i = 0; i < q_cols; i++) {
+            for (int64_t j = 0; j < min(i, n); j++) {
+                if (Abs(rb[i * n + j]) != 0.0) {
+                    return false;
+                }
+            }
+        }
+        for (int64_t i = 0; i < m; i++) {
+            for (int64_t j = 0; j < n; j++) {
+                decltype(Widen(qb[0])) sum = 0;
+                for (int64_t t = 0; t < q_cols; t++) {
+                    sum += Widen(qb[i * q_cols + t]) * Widen(rb[t * n + j]);
+                }
+                if (Abs(sum - Widen(ab[i * n + j])) > tol) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+template <typename T>
+bool RunQr(DataType data_type, int64_t batch, int64_t m, int64_t n, bool full_matrices, double tol)
+{
+    const int64_t q_cols = full_matrices ? m : min(m, n);
+    vector<DataType> data_types = {data_type, data_type, data_type};
+    vector<vector<int64_t>> shapes = {{batch, m, n}, {batch, m, q_cols}, {batch, q_cols, n}};
+    auto a = RandomMatrix<T>(batch * m * n);
+    vector<T> q(batch * m * q_cols);
+    vector<T> r(batch * q_cols * n);
+    vector<void*> datas = {(void*)a.data(), (void*)q.data(), (void*)r.data()};
+    CREATE_NODEDEF(shapes, data_types, datas, full_matrices);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    return CheckQr(a, q, r, batch, m, n, q_cols, tol);
+}
+} // namespace
+
+TEST_F(TEST_QR_UT, FLOAT_REDUCED_SUCCESS)
+{
+    float a[6] = {3, 1, 4, 1, 0, 2};
+    float q[6] = {0};
+    float r[4] = {0};
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{3, 2}, {3, 2}, {2, 2}};
+    vector<void*> datas = {(void*)a, (void*)q, (void*)r};
+    CREATE_NODEDEF(shapes, data_types, datas, false);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+    // Householder QR gives every diagonal entry of R the sign opposite to the head of its reduced column.
+    float r_exp[4] = {-5, -1.4f, 0, std::sqrt(4.04f)};
+    EXPECT_TRUE(CompareResultAllClose(r, r_exp, 4));
+}
+
+TEST_F(TEST_QR_UT, FLOAT_BATCH_TALL_AND_WIDE_SUCCESS)
+{
+    EXPECT_TRUE(RunQr<float>(DT_FLOAT, 3, 45, 37, false, 1e-4));
+    EXPECT_TRUE(RunQr<float>(DT_FLOAT, 2, 20, 70, false, 1e-4));
+}
+
+TEST_F(TEST_QR_UT, DOUBLE_FULL_MATRICES_SUCCESS)
+{
+    EXPECT_TRUE(RunQr<double>(DT_DOUBLE, 2, 70, 33, true, 1e-12));
+    EXPECT_TRUE(RunQr<double>(DT_DOUBLE, 1, 5, 9, true, 1e-12));
+}
+
+TEST_F(TEST_QR_UT, COMPLEX64_FULL_MATRICES_SUCCESS)
+{
+    EXPECT_TRUE(RunQr<complex<float>>(DT_COMPLEX64, 4, 40, 35, true, 1e-4));
+}
+
+TEST_F(TEST_QR_UT, DOUBLE_SINGLE_LARGE_MATRIX_SUCCESS)
+{
+    EXPECT_TRUE(RunQr<double>(DT_DOUBLE, 1, 160, 130, false, 1e-11));
+}
+
+TEST_F(TEST_QR_UT, FLOAT_RANK_DEFICIENT_SUCCESS)
+{
+    const int64_t m = 6;
+    const int64_t n = 4;
+    vector<float> a(m * n, 0.0f);
+    for (int64_t i = 0; i < m; i++) {
+        a[i * n] = static_cast<float>(i + 1);
+        a[i * n + 2] = 2.0f * static_cast<float>(i + 1);
+    }
+    vector<float> q(m * m);
+    vector<float> r(m * n);
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{m, n}, {m, m}, {m, n}};
+    vector<void*> datas = {(void*)a.data(), (void*)q.data(), (void*)r.data()};
+    CREATE_NODEDEF(shapes, data_types, datas, true);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    EXPECT_TRUE(CheckQr(a, q, r, 1, m, n, m, 1e-4));
+}
+
+TEST_F(TEST_QR_UT, FLOAT_BATCH_64X64_SUCCESS)
+{
+    const int64_t batch = 256;
+    const int64_t m = 64;
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{batch, m, m}, {batch, m, m}, {batch, m, m}};
+    auto a = RandomMatrix<float>(batch * m * m);
+    vector<float> q(batch * m * m);
+    vector<float> r(batch * m * m);
+    vector<void*> datas = {(void*)a.data(), (void*)q.data(), (void*)r.data()};
+    CREATE_NODEDEF(shapes, data_types, datas, false);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    EXPECT_TRUE(CheckQr(a, q, r, 4, m, m, m, 1e-4));
+}
+
+TEST_F(TEST_QR_UT, Q_SHAPE_MISMATCH_FAILED)
+{
+    float a[6] = {0};
+    float q[9] = {0};
+    float r[4] = {0};
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{3, 2}, {3, 3}, {2, 2}};
+    vector<void*> datas = {(void*)a, (void*)q, (void*)r};
+    CREATE_NODEDEF(shapes, data_types, datas, false);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
+}
+
+TEST_F(TEST_QR_UT, OUTPUT_TYPE_MISMATCH_FAILED)
+{
+    float a[4] = {0};
+    double q[4] = {0};
+    float r[4] = {0};
+    vector<DataType> data_types = {DT_FLOAT, DT_DOUBLE, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{2, 2}, {2, 2}, {2, 2}};
+    vector<void*> datas = {(void*)a, (void*)q, (void*)r};
+    CREATE_NODEDEF(shapes, data_types, datas, false);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
+}
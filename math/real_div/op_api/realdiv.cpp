@@ -17,6 +17,7 @@
 #include "opdev/op_log.h"
 #include "opdev/shape_utils.h"
 #include "op_api/aclnn_check.h"
+#include "op_api/aicpu_strided_view.h"
 
 using namespace op;
 
@@ -68,8 +69,11 @@ static bool is910BInt32Supported(const aclTensor* self, const aclTensor* other)
 
 bool IsRealDivSupportNonContiguous(const aclTensor* self)
 {
-    bool isSupportNonContiguous = IsRegBase();
-    return isSupportNonContiguous && IsAiCoreSupport(self);
+    if (IsAiCoreSupport(self)) {
+        return IsRegBase();
+    }
+    // AICPU RealDiv按stride读取非连续输入（见RealDivAiCpuStrided）
+    return true;
 }
 
 // AICORE算子kernel
@@ -83,10 +87,33 @@ static const aclTensor* RealDivAiCore(const aclTensor* self, const aclTensor* ot
     return divOut;
 }
 
+// AICPU算子kernel，输入非连续时以storage + view属性下发，kernel内按stride读取，省去Contiguous拷贝
+static const aclTensor* RealDivAiCpuStrided(
+    const aclTensor* self, const aclTensor* other, aclTensor* divOut, aclOpExecutor* executor)
+{
+    L0_DFX(RealDivAiCpuStrided, self, other);
+    AicpuStridedInput x1;
+    AicpuStridedInput x2;
+    CHECK_RET(MakeAicpuStridedInput(self, executor, x1) && MakeAicpuStridedInput(other, executor, x2), nullptr);
+
+    static internal::AicpuTaskSpace space("RealDiv");
+    auto ret = ADD_TO_LAUNCHER_LIST_AICPU(
+        RealDiv,
+        OP_ATTR_NAMES({"view_shape_0", "view_strides_0", "view_offset_0", "view_shape_1", "view_strides_1",
+                       "view_offset_1"}),
+        OP_INPUT(x1.storage, x2.storage), OP_OUTPUT(divOut),
+        OP_ATTR(x1.viewShape, x1.viewStrides, x1.viewOffset, x2.viewShape, x2.viewStrides, x2.viewOffset));
+    CHECK_RET(ret == ACLNN_SUCCESS, nullptr);
+    return divOut;
+}
+
 // AICPU算子kernel
 static const aclTensor* RealDivAiCpu(const aclTensor* self, const aclTensor* other, aclTensor* divOut,
                                      aclOpExecutor* executor)
 {
+    if (IsAicpuStridedLaunch(self, other)) {
+        return RealDivAiCpuStrided(self, other, divOut, executor);
+    }
     L0_DFX(RealDivAiCpu);
     static internal::AicpuTaskSpace space("RealDiv");
     auto ret = ADD_TO_LAUNCHER_LIST_AICPU(RealDiv, OP_ATTR_NAMES(), OP_INPUT(self, other), OP_OUTPUT(divOut));
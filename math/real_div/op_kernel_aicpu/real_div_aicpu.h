@@ -23,8 +23,6 @@ class RealDivKernel : public CpuKernel {
  private:
   uint32_t RealDivSameTypeCompute(const CpuKernelContext &ctx, DataType data_type);
   template <typename T>
-  bool IsInputHasZero(T *input_data, const int64_t num_of_elems);
-  template <typename T>
   uint32_t RealDivCompute(const CpuKernelContext &ctx, const bool verify_zero = true);
 };
 }  // namespace aicpu
@@ -26,6 +26,7 @@ public:
                                     ge::DT_UINT16, ge::DT_INT16, ge::DT_INT32, ge::DT_INT64, ge::DT_COMPLEX64,
                                     ge::DT_COMPLEX128});
 
+        ApplyStridedViewAttrs(*this, 2);
         ApplyMathAicpuDefaultCfg(*this);
         this->AICPU().ExtendCfgInfo(OP_INFO_FORMAT_AGNOSTIC.c_str(), TRUE_FORMAT_AGNOSTIC.c_str());
         this->AICPU().ExtendCfgInfo(OP_INFO_OPS_FLAG.c_str(), OPEN_OPS_FLAG.c_str());
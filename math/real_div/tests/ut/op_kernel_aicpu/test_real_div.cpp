@@ -391,4 +391,38 @@ TEST_F(TEST_REALDIV_UT, TestRealDiv_VectorDivScalar_LargeParallel) {
     RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
     std::vector<float> expect_out(num, 10.0f);
     CompareResult<float>(output.data(), expect_out.data(), num);
-}
\ No newline at end of file
+}
+
+// ==================== strided view inputs ====================
+TEST_F(TEST_REALDIV_UT, TestRealDiv_StridedView_Transposed) {
+    const int64_t rows = 64;
+    const int64_t cols = 48;
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{cols * rows}, {cols}, {rows, cols}};
+    std::vector<float> input1(rows * cols);
+    for (int64_t i = 0; i < rows * cols; i++) {
+        input1[i] = static_cast<float>(i);
+    }
+    std::vector<float> input2(cols);
+    for (int64_t j = 0; j < cols; j++) {
+        input2[j] = static_cast<float>(j + 1);
+    }
+    std::vector<float> output(rows * cols, 0.0f);
+    vector<void *> datas = {input1.data(), input2.data(), output.data()};
+    auto node_def = CpuKernelUtils::CreateNodeDef();
+    NodeDefBuilder(node_def.get(), "RealDiv", "RealDiv")
+        .Input({"x1", data_types[0], shapes[0], datas[0]})
+        .Input({"x2", data_types[1], shapes[1], datas[1]})
+        .Output({"y", data_types[2], shapes[2], datas[2]})
+        .Attr("view_shape_0", vector<int64_t>{rows, cols})
+        .Attr("view_strides_0", vector<int64_t>{1, rows})
+        .Attr("view_offset_0", static_cast<int64_t>(0));
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    std::vector<float> expect_out(rows * cols);
+    for (int64_t i = 0; i < rows; i++) {
+        for (int64_t j = 0; j < cols; j++) {
+            expect_out[i * cols + j] = input1[j * rows + i] / input2[j];
+        }
+    }
+    EXPECT_TRUE(CompareResult<float>(output.data(), expect_out.data(), rows * cols));
+}
@@ -12,6 +12,7 @@
 
 #include <algorithm>
 #include <complex>
+#include <type_traits>
 
 #include "cpu_kernel_utils.h"
 #include "utils/eigen_tensor.h"
@@ -21,8 +22,18 @@ namespace {
 const uint32_t kReduceSumInputNum = 2;
 const uint32_t kReduceSumOutputNum = 1;
 const char *const kReduceSum = "ReduceSum";
-constexpr int64_t kParallelDataNums = 256;
 constexpr int64_t kParallelElements = 2 * 1024 * 1024;
+// Input elements each ParallelFor unit should cover at least, so scheduling stays small next to the summation.
+constexpr int64_t kMinShardElements = 64 * 1024;
+// Contiguous runs up to this length are summed with interleaved lane accumulators; longer runs are split in half
+// recursively (pairwise summation), so rounding error grows with log(n) instead of n.
+constexpr int64_t kPairwiseBlock = 4096;
+constexpr int64_t kSumLanes = 8;
+// Column tile kept in the accumulator while all reduced rows are streamed through it.
+constexpr int64_t kColumnTile = 2048;
+// Fixed block size of the full reduction. The partial sums do not depend on the core count, so the result is
+// identical however many threads run it.
+constexpr int64_t kFullReduceBlock = 64 * 1024;
 
 #define REDUCESUM_COMPUTE_CASE(DTYPE, TYPE, CTX)                                                                  \
     case (DTYPE): {                                                                                               \
@@ -46,6 +57,276 @@ constexpr int64_t kParallelElements = 2 * 1024 * 1024;
 }  // namespace
 
 namespace aicpu {
+namespace {
+// fp16/bf16 are accumulated in fp32; every other type accumulates in itself.
+template <typename T>
+struct ReduceSumAccType {
+    using Type = T;
+};
+
+template <>
+struct ReduceSumAccType<Eigen::half> {
+    using Type = float;
+};
+
+template <>
+struct ReduceSumAccType<Eigen::bfloat16> {
+    using Type = float;
+};
+
+// fp16/bf16 sums that are accumulated one addend at a time (across rows or runs) are Kahan-compensated: once the fp32
+// running sum is large, plain addition drops the low bits of every small addend, and over millions of rows that drift
+// exceeds the output rounding.
+template <typename T>
+struct ReduceSumCompensated {
+    static constexpr bool value = !std::is_same<T, typename ReduceSumAccType<T>::Type>::value;
+};
+
+template <typename AccT>
+inline void CompensatedAdd(AccT &sum, AccT &comp, AccT value)
+{
+    const AccT y = value - comp;
+    const AccT t = sum + y;
+    comp = (t - sum) - y;
+    sum = t;
+}
+
+// Input shape with size-1 dims dropped and adjacent dims of the same kind (reduced or kept) merged, so consecutive
+// dims always alternate in kind.
+struct ReduceSumPlan {
+    std::vector<int64_t> dims;
+    std::vector<int64_t> strides;
+    std::vector<bool> reduced;
+    int64_t outputs = 1;
+    int64_t inputs = 1;
+};
+
+ReduceSumPlan MakeReduceSumPlan(const std::vector<int64_t> &input_shape, const std::vector<int64_t> &axes)
+{
+    std::vector<bool> is_reduced(input_shape.size(), false);
+    for (auto axis : axes) {
+        is_reduced[axis] = true;
+    }
+    ReduceSumPlan plan;
+    for (size_t i = 0; i < input_shape.size(); i++) {
+        plan.inputs *= input_shape[i];
+        if (input_shape[i] == 1) {
+            continue;
+        }
+        if (!is_reduced[i]) {
+            plan.outputs *= input_shape[i];
+        }
+        if (!plan.dims.empty() && (plan.reduced.back() == is_reduced[i])) {
+            plan.dims.back() *= input_shape[i];
+        } else {
+            plan.dims.push_back(input_shape[i]);
+            plan.reduced.push_back(is_reduced[i]);
+        }
+    }
+    plan.strides.assign(plan.dims.size(), 1);
+    for (size_t i = plan.dims.size(); i > 1; i--) {
+        plan.strides[i - 2] = plan.strides[i - 1] * plan.dims[i - 1];
+    }
+    return plan;
+}
+
+template <typename T, typename AccT>
+AccT SumContiguous(const T *data, int64_t len)
+{
+    if (len > kPairwiseBlock) {
+        const int64_t half = len / 2;
+        return SumContiguous<T, AccT>(data, half) + SumContiguous<T, AccT>(data + half, len - half);
+    }
+    AccT lanes[kSumLanes] = {};
+    int64_t i = 0;
+    for (; i + kSumLanes <= len; i += kSumLanes) {
+        for (int64_t l = 0; l < kSumLanes; l++) {
+            lanes[l] += static_cast<AccT>(data[i + l]);
+        }
+    }
+    AccT acc = ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) + ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+    for (; i < len; i++) {
+        acc += static_cast<AccT>(data[i]);
+    }
+    return acc;
+}
+
+// Odometer over a subset of the plan dims, yielding the input offset of every index combination.
+class PlanOdometer {
+public:
+    PlanOdometer(const ReduceSumPlan &plan, const std::vector<size_t> &axes) : plan_(plan), axes_(axes),
+        index_(axes.size(), 0)
+    {}
+
+    // Positions the odometer at the linear index `linear` (row-major over axes_) and returns its offset.
+    int64_t Seek(int64_t linear)
+    {
+        offset_ = 0;
+        for (size_t k = axes_.size(); k > 0; k--) {
+            const size_t dim = axes_[k - 1];
+            index_[k - 1] = linear % plan_.dims[dim];
+            linear /= plan_.dims[dim];
+            offset_ += index_[k - 1] * plan_.strides[dim];
+        }
+        return offset_;
+    }
+
+    int64_t Next()
+    {
+        for (size_t k = axes_.size(); k > 0; k--) {
+            const size_t dim = axes_[k - 1];
+            offset_ += plan_.strides[dim];
+            if (++index_[k - 1] < plan_.dims[dim]) {
+                return offset_;
+            }
+            offset_ -= index_[k - 1] * plan_.strides[dim];
+            index_[k - 1] = 0;
+        }
+        return offset_;
+    }
+
+private:
+    const ReduceSumPlan &plan_;
+    const std::vector<size_t> &axes_;
+    std::vector<int64_t> index_;
+    int64_t offset_ = 0;
+};
+
+template <typename Shard>
+uint32_t RunReduceSumShards(const CpuKernelContext &ctx, int64_t units, int64_t unit_elements, int64_t total_elements,
+    const Shard &shard)
+{
+    if (total_elements < kParallelElements || units <= 1) {
+        shard(0, units);
+        return KERNEL_STATUS_OK;
+    }
+    const int64_t cores = std::max(static_cast<int64_t>(1),
+        static_cast<int64_t>(CpuKernelUtils::GetCPUNum(ctx)) - static_cast<int64_t>(kResvCpuNum));
+    const int64_t min_units = std::max(static_cast<int64_t>(1), kMinShardElements / std::max(unit_elements,
+        static_cast<int64_t>(1)));
+    const int64_t per_unit = std::max(min_units, (units + cores - 1) / cores);
+    KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, units, per_unit, shard),
+        "ReduceSum ParallelFor failed, units=%ld, per_unit=%ld.", units, per_unit);
+    return KERNEL_STATUS_OK;
+}
+
+template <typename T>
+uint32_t ReduceSumAll(const CpuKernelContext &ctx, const T *input_data, int64_t data_num, T *output_data)
+{
+    using AccT = typename ReduceSumAccType<T>::Type;
+    const int64_t blocks = (data_num + kFullReduceBlock - 1) / kFullReduceBlock;
+    std::vector<AccT> partials(static_cast<size_t>(blocks));
+    auto shard = [input_data, data_num, &partials](int64_t start, int64_t end) {
+        for (int64_t b = start; b < end; b++) {
+            const int64_t begin = b * kFullReduceBlock;
+            partials[b] = SumContiguous<T, AccT>(input_data + begin, std::min(kFullReduceBlock, data_num - begin));
+        }
+    };
+    KERNEL_HANDLE_ERROR(RunReduceSumShards(ctx, blocks, kFullReduceBlock, data_num, shard),
+        "ReduceSum full reduction failed.");
+    output_data[0] = static_cast<T>(SumContiguous<AccT, AccT>(partials.data(), blocks));
+    return KERNEL_STATUS_OK;
+}
+
+// Innermost plan dim is reduced: every output sums contiguous runs, one per combination of the outer reduced dims.
+template <typename T>
+uint32_t ReduceSumRows(const CpuKernelContext &ctx, const T *input_data, const ReduceSumPlan &plan, T *output_data)
+{
+    using AccT = typename ReduceSumAccType<T>::Type;
+    std::vector<size_t> kept_axes;
+    std::vector<size_t> reduced_axes;
+    for (size_t i = 0; i + 1 < plan.dims.size(); i++) {
+        (plan.reduced[i] ? reduced_axes : kept_axes).push_back(i);
+    }
+    const int64_t run = plan.dims.back();
+    const int64_t runs_per_output = plan.inputs / plan.outputs / run;
+    auto shard = [&](int64_t start, int64_t end) {
+        PlanOdometer kept(plan, kept_axes);
+        PlanOdometer reduced(plan, reduced_axes);
+        int64_t base = kept.Seek(start);
+        for (int64_t out = start; out < end; out++, base = kept.Next()) {
+            AccT acc = static_cast<AccT>(0);
+            AccT comp = static_cast<AccT>(0);
+            int64_t offset = reduced.Seek(0);
+            for (int64_t r = 0; r < runs_per_output; r++, offset = reduced.Next()) {
+                const AccT run_sum = SumContiguous<T, AccT>(input_data + base + offset, run);
+                if (ReduceSumCompensated<T>::value) {
+                    CompensatedAdd(acc, comp, run_sum);
+                } else {
+                    acc += run_sum;
+                }
+            }
+            output_data[out] = static_cast<T>(acc);
+        }
+    };
+    return RunReduceSumShards(ctx, plan.outputs, plan.inputs / plan.outputs, plan.inputs, shard);
+}
+
+template <typename T, typename AccT>
+inline void AccumulateRow(const T *__restrict__ in, int64_t cols, AccT *__restrict__ acc)
+{
+    for (int64_t c = 0; c < cols; c++) {
+        acc[c] += static_cast<AccT>(in[c]);
+    }
+}
+
+template <typename T, typename AccT>
+inline void AccumulateRowCompensated(const T *__restrict__ in, int64_t cols, AccT *__restrict__ acc,
+    AccT *__restrict__ comp)
+{
+    for (int64_t c = 0; c < cols; c++) {
+        CompensatedAdd(acc[c], comp[c], static_cast<AccT>(in[c]));
+    }
+}
+
+// Innermost plan dim is kept: every output row accumulates whole input row segments, tiled by kColumnTile columns so
+// the accumulator stays in cache and the inner add loop vectorizes.
+template <typename T>
+uint32_t ReduceSumColumns(const CpuKernelContext &ctx, const T *input_data, const ReduceSumPlan &plan,
+    T *output_data)
+{
+    using AccT = typename ReduceSumAccType<T>::Type;
+    std::vector<size_t> kept_axes;
+    std::vector<size_t> reduced_axes;
+    for (size_t i = 0; i + 1 < plan.dims.size(); i++) {
+        (plan.reduced[i] ? reduced_axes : kept_axes).push_back(i);
+    }
+    const int64_t width = plan.dims.back();
+    const int64_t rows = plan.outputs / width;
+    const int64_t tiles = (width + kColumnTile - 1) / kColumnTile;
+    const int64_t reduce_num = plan.inputs / plan.outputs;
+    auto shard = [&](int64_t start, int64_t end) {
+        PlanOdometer kept(plan, kept_axes);
+        PlanOdometer reduced(plan, reduced_axes);
+        const size_t tile = static_cast<size_t>(std::min(width, kColumnTile));
+        std::vector<AccT> acc(tile);
+        std::vector<AccT> comp(ReduceSumCompensated<T>::value ? tile : 0);
+        for (int64_t unit = start; unit < end; unit++) {
+            const int64_t row = unit / tiles;
+            const int64_t col_begin = (unit % tiles) * kColumnTile;
+            const int64_t cols = std::min(kColumnTile, width - col_begin);
+            const int64_t base = kept.Seek(row) + col_begin;
+            AccT *acc_data = acc.data();
+            std::fill(acc_data, acc_data + cols, static_cast<AccT>(0));
+            std::fill(comp.begin(), comp.end(), static_cast<AccT>(0));
+            int64_t offset = reduced.Seek(0);
+            for (int64_t r = 0; r < reduce_num; r++, offset = reduced.Next()) {
+                if (ReduceSumCompensated<T>::value) {
+                    AccumulateRowCompensated(input_data + base + offset, cols, acc_data, comp.data());
+                } else {
+                    AccumulateRow(input_data + base + offset, cols, acc_data);
+                }
+            }
+            T *out = output_data + row * width + col_begin;
+            for (int64_t c = 0; c < cols; c++) {
+                out[c] = static_cast<T>(acc_data[c]);
+            }
+        }
+    };
+    return RunReduceSumShards(ctx, rows * tiles, reduce_num * std::min(width, kColumnTile), plan.inputs, shard);
+}
+}  // namespace
+
 uint32_t ReduceSumCpuKernel::Compute(CpuKernelContext &ctx)
 {
     KERNEL_HANDLE_ERROR(
@@ -55,6 +336,7 @@ uint32_t ReduceSumCpuKernel::Compute(CpuKernelContext &ctx)
     auto input_data_type = ctx.Input(kFirstInputIndex)->GetDataType();
     switch (input_data_type) {
         REDUCESUM_COMPUTE_CASE(DT_FLOAT16, Eigen::half, ctx)
+        REDUCESUM_COMPUTE_CASE(DT_BFLOAT16, Eigen::bfloat16, ctx)
         REDUCESUM_COMPUTE_CASE(DT_FLOAT, float, ctx)
         REDUCESUM_COMPUTE_CASE(DT_DOUBLE, double, ctx)
         REDUCESUM_COMPUTE_CASE(DT_INT8, int8_t, ctx)
@@ -139,52 +421,29 @@ uint32_t ReduceSumCpuKernel::ReduceSumCompute(const CpuKernelContext &ctx)
     } else {
         KERNEL_HANDLE_ERROR(ReduceSumDedupAxes<int64_t>(ctx, axes_value), "ReduceSum deduplicate failed.");
     }
-    if ((axes_value.size() == 1) && ((axes_value[0] + 1) == static_cast<int64_t>(input_shape.size()))) {
-        KERNEL_LOG_INFO("Reduce sum last axes compute");
-        return ReduceSumLastAxes<T>(ctx, input_data, input_shape, output_data);
-    }
-
-    int64_t output_num = y->NumElements();
-    uint32_t axes_idx = 0;
-    KERNEL_HANDLE_ERROR(ReduceSumOneAxes<T>(input_data, input_shape, output_data, output_num, axes_value, axes_idx),
-        "Reduce sum compute failed.");
-    return KERNEL_STATUS_OK;
+    return ReduceSumPlanned<T>(ctx, input_data, input_shape, axes_value, output_data);
 }
 
 template <typename T>
-uint32_t ReduceSumCpuKernel::ReduceSumLastAxes(
-    const CpuKernelContext &ctx, const T *input_data, std::vector<int64_t> &input_shape, T *output_data)
+uint32_t ReduceSumCpuKernel::ReduceSumPlanned(const CpuKernelContext &ctx, const T *input_data,
+    const std::vector<int64_t> &input_shape, const std::vector<int64_t> &axes, T *output_data) const
 {
-    int64_t rank = input_shape.size() - 1;
-    int64_t datanum = 1;
-    int64_t i = 0;
-    for (i = 0; i < rank; i++) {
-        datanum *= input_shape[i];
-    }
-    int64_t depth = input_shape[i];
-    auto shard_reduce = [&](int64_t start, int64_t end) {
-        for (int64_t inner_index = start; inner_index < end; inner_index++) {
-            auto accumulator = static_cast<T>(0);
-            int64_t inout_index = inner_index * depth;
-            for (int64_t depth_index = 0; depth_index < depth; depth_index++) {
-                int64_t index = inout_index + depth_index;
-                accumulator += input_data[index];
-            }
-            output_data[inner_index] = accumulator;
-        }
-    };
-    if ((datanum < kParallelDataNums) || ((datanum * depth) < kParallelElements)) {
-        shard_reduce(0, datanum);
-    } else {
-        uint32_t min_core_num = 1;
-        int64_t max_core_num = std::max(min_core_num, aicpu::CpuKernelUtils::GetCPUNum(ctx) - kResvCpuNum);
-        if (max_core_num > datanum) {
-            max_core_num = datanum;
-        }
-        KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, datanum, datanum / max_core_num, shard_reduce),
-            "ReduceSum Compute failed.");
+    const ReduceSumPlan plan = MakeReduceSumPlan(input_shape, axes);
+    if (plan.outputs == plan.inputs) {
+        // Every reduced axis has size 1: the reduction is a plain copy.
+        std::copy(input_data, input_data + plan.inputs, output_data);
+        return KERNEL_STATUS_OK;
     }
-    return KERNEL_STATUS_OK;
+    if (plan.outputs == 1) {
+        KERNEL_LOG_INFO("Reduce sum planned: full reduction, elements=%ld.", plan.inputs);
+        return ReduceSumAll<T>(ctx, input_data, plan.inputs, output_data);
+    }
+    if (plan.reduced.back()) {
+        KERNEL_LOG_INFO("Reduce sum planned: row reduction, rank=%zu, outputs=%ld.", plan.dims.size(), plan.outputs);
+        return ReduceSumRows<T>(ctx, input_data, plan, output_data);
+    }
+    KERNEL_LOG_INFO("Reduce sum planned: column reduction, rank=%zu, outputs=%ld.", plan.dims.size(), plan.outputs);
+    return ReduceSumColumns<T>(ctx, input_data, plan, output_data);
 }
 
 template <typename T>
@@ -234,50 +493,12 @@ bool ReduceSumCpuKernel::ReduceSumSimpleCompute(
         }
     }
     if (full_computer) {
-        auto accumulator = static_cast<T>(0);
-        for (int64_t i = 0; i < data_num; i++) {
-            accumulator += input_data[i];
-        }
-        output_data[0] = accumulator;
         KERNEL_LOG_INFO("Reduce sum full compute");
-        return true;
+        return ReduceSumAll<T>(ctx, input_data, data_num, output_data) == KERNEL_STATUS_OK;
     }
     return false;
 }
 
-template <typename T>
-uint32_t ReduceSumCpuKernel::ReduceSumOneAxes(const T *input_data, std::vector<int64_t> &input_shape, T *output_data,
-    int64_t output_num, std::vector<int64_t> &axes, uint32_t &axes_idx)
-{
-    if (axes_idx >= axes.size()) {
-        for (int64_t i = 0; i < output_num; i++) {
-            output_data[i] = input_data[i];
-        }
-        return KERNEL_STATUS_OK;
-    }
-    int64_t inner = 1;
-    int64_t outer = 1;
-    int64_t depth = 1;
-    KERNEL_HANDLE_ERROR(ReduceSumParseAxes(input_shape, axes, axes_idx, inner, outer, depth), "parse axes failed.");
-    auto *output_data_temp = new (std::nothrow) T[inner * outer];
-    KERNEL_CHECK_NULLPTR(output_data_temp, KERNEL_STATUS_INNER_ERROR, "apply memory failed.");
-    for (int64_t outer_index = 0; outer_index < outer; ++outer_index) {
-        for (int64_t inner_index = 0; inner_index < inner; inner_index++) {
-            auto accumulator = static_cast<T>(0);
-            int64_t inout_index = outer_index + inner_index * depth * outer;
-            for (int64_t depth_index = 0; depth_index < depth; depth_index++) {
-                int64_t index = inout_index + depth_index * outer;
-                accumulator += input_data[index];
-            }
-            int64_t output_index = outer_index + inner_index * outer;
-            output_data_temp[output_index] = accumulator;
-        }
-    }
-    uint32_t result = ReduceSumOneAxes<T>(output_data_temp, input_shape, output_data, output_num, axes, axes_idx);
-    delete[] output_data_temp;
-    return result;
-}
-
 template <typename T, typename T2>
 uint32_t ReduceSumCpuKernel::ReduceSumCompute2(const CpuKernelContext &ctx)
 {
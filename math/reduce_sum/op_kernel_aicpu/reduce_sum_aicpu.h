@@ -39,12 +39,8 @@ private:
     bool IsReduceSumFullCompute(const CpuKernelContext &ctx, std::vector<int64_t> &input_shape);
 
     template <typename T>
-    uint32_t ReduceSumLastAxes(
-        const CpuKernelContext &ctx, const T *input_data, std::vector<int64_t> &input_shape, T *output_data);
-
-    template <typename T>
-    uint32_t ReduceSumOneAxes(const T *input_data, std::vector<int64_t> &input_shape, T *output_data,
-        int64_t output_num, std::vector<int64_t> &axes, uint32_t &axes_idx);
+    uint32_t ReduceSumPlanned(const CpuKernelContext &ctx, const T *input_data,
+        const std::vector<int64_t> &input_shape, const std::vector<int64_t> &axes, T *output_data) const;
 
     template <typename T, typename T2>
     uint32_t ReduceSumCompute2(const CpuKernelContext &ctx);
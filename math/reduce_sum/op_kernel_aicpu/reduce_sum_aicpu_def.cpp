@@ -17,12 +17,12 @@ class ReduceSum : public OpDef {
 public:
     explicit ReduceSum(const char *name) : OpDef(name)
     {
-        this->Input("x").DataType({ge::DT_FLOAT16, ge::DT_FLOAT, ge::DT_DOUBLE, ge::DT_INT8, ge::DT_INT16,
-            ge::DT_INT32, ge::DT_INT64, ge::DT_UINT8, ge::DT_UINT16, ge::DT_UINT32, ge::DT_UINT64,
+        this->Input("x").DataType({ge::DT_FLOAT16, ge::DT_BFLOAT16, ge::DT_FLOAT, ge::DT_DOUBLE, ge::DT_INT8,
+            ge::DT_INT16, ge::DT_INT32, ge::DT_INT64, ge::DT_UINT8, ge::DT_UINT16, ge::DT_UINT32, ge::DT_UINT64,
             ge::DT_COMPLEX64, ge::DT_COMPLEX128});
         this->Input("axes").DataType({ge::DT_INT32, ge::DT_INT64});
-        this->Output("y").DataType({ge::DT_FLOAT16, ge::DT_FLOAT, ge::DT_DOUBLE, ge::DT_INT8, ge::DT_INT16,
-            ge::DT_INT32, ge::DT_INT64, ge::DT_UINT8, ge::DT_UINT16, ge::DT_UINT32, ge::DT_UINT64,
+        this->Output("y").DataType({ge::DT_FLOAT16, ge::DT_BFLOAT16, ge::DT_FLOAT, ge::DT_DOUBLE, ge::DT_INT8,
+            ge::DT_INT16, ge::DT_INT32, ge::DT_INT64, ge::DT_UINT8, ge::DT_UINT16, ge::DT_UINT32, ge::DT_UINT64,
             ge::DT_COMPLEX64, ge::DT_COMPLEX128});
 
         this->Attr("keep_dims").AttrType(OPTIONAL).Bool(false);
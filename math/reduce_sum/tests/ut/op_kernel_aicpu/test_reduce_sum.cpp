@@ -10,6 +10,7 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
 #include <complex>
 #include <cstdint>
 #include <vector>
@@ -37,6 +38,24 @@ inline aicpu::DataType ToDataType<std::int64_t>()
     return aicpu::DataType::DT_INT64;
 }
 
+template <>
+inline aicpu::DataType ToDataType<float>()
+{
+    return aicpu::DataType::DT_FLOAT;
+}
+
+template <>
+inline aicpu::DataType ToDataType<Eigen::half>()
+{
+    return aicpu::DataType::DT_FLOAT16;
+}
+
+template <>
+inline aicpu::DataType ToDataType<Eigen::bfloat16>()
+{
+    return aicpu::DataType::DT_BFLOAT16;
+}
+
 template <>
 inline aicpu::DataType ToDataType<double>()
 {
@@ -79,6 +98,36 @@ void CreateAndRunReduceSum(const std::vector<std::int64_t> &input_shape, const s
         .Attr("noop_with_empty_axes", noop_with_empty_axes);
     RunKernelReduceSum(node_def, status);
 }
+
+// Naive reference: every input element is added to the output slot obtained by dropping its reduced coordinates.
+template <typename T, typename AccT>
+std::vector<AccT> ReduceSumReference(const std::vector<T> &input, const std::vector<std::int64_t> &input_shape,
+    const std::vector<std::int64_t> &axes)
+{
+    std::vector<bool> reduced(input_shape.size(), false);
+    for (auto axis : axes) {
+        reduced[axis] = true;
+    }
+    std::int64_t output_num = 1;
+    for (size_t i = 0; i < input_shape.size(); i++) {
+        output_num *= reduced[i] ? 1 : input_shape[i];
+    }
+    std::vector<AccT> output(output_num, static_cast<AccT>(0));
+    std::vector<std::int64_t> index(input_shape.size(), 0);
+    for (const auto &value : input) {
+        std::int64_t out = 0;
+        for (size_t i = 0; i < input_shape.size(); i++) {
+            if (!reduced[i]) {
+                out = out * input_shape[i] + index[i];
+            }
+        }
+        output[out] += static_cast<AccT>(value);
+        for (size_t i = input_shape.size(); i > 0 && ++index[i - 1] == input_shape[i - 1]; i--) {
+            index[i - 1] = 0;
+        }
+    }
+    return output;
+}
 }  // namespace
 
 class TEST_REDUCE_SUM_UT : public testing::Test {};
@@ -178,4 +227,138 @@ TEST_F(TEST_REDUCE_SUM_UT, INVALID_AXIS)
 
     CreateAndRunReduceSum(
         input_shape, axes_shape, output_shape, false, input, axes, output, aicpu::KERNEL_STATUS_PARAM_INVALID);
-}
\ No newline at end of file
+}
+TEST_F(TEST_REDUCE_SUM_UT, NON_ADJACENT_AXES_WITH_UNIT_DIMS)
+{
+    const std::vector<std::int64_t> input_shape{4, 1, 5, 6, 1, 7};
+    const std::vector<std::int64_t> axes_shape{3};
+    const std::vector<std::int64_t> output_shape{1, 5, 1, 7};
+    std::vector<std::int64_t> input(4 * 5 * 6 * 7);
+    for (size_t i = 0; i < input.size(); i++) {
+        input[i] = static_cast<std::int64_t>(i * 7 % 31) - 15;
+    }
+    std::vector<std::int64_t> axes{0, 3, 4};
+    std::vector<std::int64_t> output(5 * 7, 0);
+    auto expect = ReduceSumReference<std::int64_t, std::int64_t>(input, input_shape, axes);
+
+    CreateAndRunReduceSum(input_shape, axes_shape, output_shape, false, input, axes, output);
+    EXPECT_EQ(CompareResult(output.data(), expect.data(), expect.size()), true);
+}
+
+TEST_F(TEST_REDUCE_SUM_UT, INNER_AXES_ROW_REDUCTION)
+{
+    const std::vector<std::int64_t> input_shape{3, 4, 5, 6};
+    const std::vector<std::int64_t> axes_shape{2};
+    const std::vector<std::int64_t> output_shape{4, 6};
+    std::vector<std::int32_t> input(3 * 4 * 5 * 6);
+    for (size_t i = 0; i < input.size(); i++) {
+        input[i] = static_cast<std::int32_t>(i % 13);
+    }
+    std::vector<std::int32_t> axes{-2, 0};
+    std::vector<std::int32_t> output(4 * 6, 0);
+    auto expect = ReduceSumReference<std::int32_t, std::int32_t>(input, input_shape, {0, 2});
+
+    CreateAndRunReduceSum(input_shape, axes_shape, output_shape, false, input, axes, output);
+    EXPECT_EQ(CompareResult(output.data(), expect.data(), expect.size()), true);
+}
+
+TEST_F(TEST_REDUCE_SUM_UT, LARGE_LEADING_AXIS_COLUMN_REDUCTION)
+{
+    const std::vector<std::int64_t> input_shape{512, 3, 2500};
+    const std::vector<std::int64_t> axes_shape{1};
+    const std::vector<std::int64_t> output_shape{3, 2500};
+    std::vector<float> input(512 * 3 * 2500);
+    for (size_t i = 0; i < input.size(); i++) {
+        input[i] = static_cast<float>(i % 17) * 0.25f;
+    }
+    std::vector<std::int64_t> axes{0};
+    std::vector<float> output(3 * 2500, 0.0f);
+    auto expect = ReduceSumReference<float, float>(input, input_shape, {0});
+
+    CreateAndRunReduceSum(input_shape, axes_shape, output_shape, false, input, axes, output);
+    EXPECT_EQ(CompareResult(output.data(), expect.data(), expect.size()), true);
+}
+
+TEST_F(TEST_REDUCE_SUM_UT, LARGE_FLOAT16_ACCUMULATES_IN_FLOAT)
+{
+    const std::vector<std::int64_t> input_shape{16, 256 * 1024};
+    const std::vector<std::int64_t> axes_shape{1};
+    const std::vector<std::int64_t> output_shape{16};
+    std::vector<Eigen::half> input(16 * 256 * 1024);
+    for (size_t i = 0; i < input.size(); i++) {
+        input[i] = static_cast<Eigen::half>(static_cast<float>(i % 7) * 0.0625f);
+    }
+    std::vector<std::int32_t> axes{1};
+    std::vector<Eigen::half> output(16, static_cast<Eigen::half>(0));
+    auto expect = ReduceSumReference<Eigen::half, double>(input, input_shape, {1});
+
+    CreateAndRunReduceSum(input_shape, axes_shape, output_shape, false, input, axes, output);
+    for (size_t i = 0; i < expect.size(); i++) {
+        // A half accumulator would stall far below the true sum; fp32 accumulation leaves only output rounding.
+        EXPECT_NEAR(static_cast<double>(output[i]), expect[i], expect[i] * 1e-3);
+    }
+}
+
+TEST_F(TEST_REDUCE_SUM_UT, LARGE_BFLOAT16_COLUMN_REDUCTION_IS_COMPENSATED)
+{
+    // 4M rows streamed into one fp32 accumulator per column: without compensation the low bits of every 0.1-ish
+    // addend are lost once the sum passes 2^18, and the result drifts by several percent.
+    const std::int64_t rows = 4 * 1024 * 1024;
+    const std::vector<std::int64_t> input_shape{rows, 2};
+    const std::vector<std::int64_t> axes_shape{1};
+    const std::vector<std::int64_t> output_shape{2};
+    std::vector<Eigen::bfloat16> input(rows * 2);
+    for (size_t i = 0; i < input.size(); i++) {
+        input[i] = static_cast<Eigen::bfloat16>(0.1f * static_cast<float>(1 + i % 3));
+    }
+    std::vector<std::int32_t> axes{0};
+    std::vector<Eigen::bfloat16> output(2, static_cast<Eigen::bfloat16>(0));
+    auto expect = ReduceSumReference<Eigen::bfloat16, double>(input, input_shape, {0});
+
+    CreateAndRunReduceSum(input_shape, axes_shape, output_shape, false, input, axes, output);
+    for (size_t i = 0; i < expect.size(); i++) {
+        // Only the bf16 output rounding (2^-9 relative) remains.
+        EXPECT_NEAR(static_cast<double>(output[i]), expect[i], expect[i] * 4e-3);
+    }
+}
+
+TEST_F(TEST_REDUCE_SUM_UT, LARGE_BFLOAT16_ROW_RUNS_ARE_COMPENSATED)
+{
+    // Reducing the outer and inner axes sums 512K short runs per output, adding every run sum to one fp32 total.
+    const std::int64_t outer = 512 * 1024;
+    const std::vector<std::int64_t> input_shape{outer, 2, 8};
+    const std::vector<std::int64_t> axes_shape{2};
+    const std::vector<std::int64_t> output_shape{2};
+    std::vector<Eigen::bfloat16> input(outer * 2 * 8);
+    for (size_t i = 0; i < input.size(); i++) {
+        input[i] = static_cast<Eigen::bfloat16>(0.1f * static_cast<float>(1 + i % 3));
+    }
+    std::vector<std::int32_t> axes{0, 2};
+    std::vector<Eigen::bfloat16> output(2, static_cast<Eigen::bfloat16>(0));
+    auto expect = ReduceSumReference<Eigen::bfloat16, double>(input, input_shape, {0, 2});
+
+    CreateAndRunReduceSum(input_shape, axes_shape, output_shape, false, input, axes, output);
+    for (size_t i = 0; i < expect.size(); i++) {
+        EXPECT_NEAR(static_cast<double>(output[i]), expect[i], expect[i] * 4e-3);
+    }
+}
+
+TEST_F(TEST_REDUCE_SUM_UT, LARGE_FULL_REDUCTION_IS_DETERMINISTIC)
+{
+    const std::vector<std::int64_t> input_shape{1000, 3001};
+    const std::vector<std::int64_t> axes_shape{2};
+    const std::vector<std::int64_t> output_shape{};
+    std::vector<float> input(1000 * 3001);
+    for (size_t i = 0; i < input.size(); i++) {
+        input[i] = std::sin(static_cast<float>(i));
+    }
+    std::vector<std::int32_t> axes{0, 1};
+    std::vector<float> first(1, 0.0f);
+    std::vector<float> second(1, 0.0f);
+    auto expect = ReduceSumReference<float, double>(input, input_shape, {0, 1});
+
+    CreateAndRunReduceSum(input_shape, axes_shape, output_shape, false, input, axes, first);
+    CreateAndRunReduceSum(input_shape, axes_shape, output_shape, false, input, axes, second);
+    EXPECT_EQ(first[0], second[0]);
+    EXPECT_NEAR(first[0], expect[0], 1e-2);
+}
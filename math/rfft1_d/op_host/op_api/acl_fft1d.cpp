@@ -0,0 +1,160 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "acl_fft1d.h"
+#include "fft_axis_utils.h"
+#include "aclnn_kernels/common/op_error_check.h"
+#include "aclnn_kernels/contiguous.h"
+#include "opdev/op_log.h"
+#include "opdev/op_dfx.h"
+#include "opdev/common_types.h"
+#include "opdev/data_type_utils.h"
+#include "opdev/make_op_executor.h"
+#include "op_api/aclnn_check.h"
+
+using namespace op;
+
+static const std::initializer_list<DataType> DTYPE_SUPPORT_LIST = {DataType::DT_FLOAT};
+static const size_t MIN_INPUT_DIM_NUM = 2;
+static const size_t MAX_INPUT_DIM_NUM = 8;
+
+static bool CheckNotNull(const aclTensor* self, const aclTensor* out)
+{
+    OP_CHECK_NULL(self, return false);
+    OP_CHECK_NULL(out, return false);
+    return true;
+}
+
+static bool CheckComplexTensor(const aclTensor* self)
+{
+    OP_CHECK_DTYPE_NOT_SUPPORT(self, DTYPE_SUPPORT_LIST, return false);
+    OP_CHECK_MIN_DIM(self, MIN_INPUT_DIM_NUM, return false);
+    OP_CHECK_MAX_DIM(self, MAX_INPUT_DIM_NUM, return false);
+    auto const& shape = self->GetViewShape();
+    if (shape.GetDim(shape.GetDimNum() - 1) != fft::COMPLEX_PAIR) {
+        OP_LOGE(ACLNN_ERR_PARAM_INVALID, "The last dim of self should be 2 (real, imag), but got shape %s.",
+                op::ToString(shape).GetString());
+        return false;
+    }
+    return true;
+}
+
+// dim counts the complex dims only, i.e. excludes the trailing (real, imag) dim.
+static bool CheckDim(int64_t dim, int64_t dims)
+{
+    if (!((dim >= -dims) && (dim < dims))) {
+        OP_LOGE(ACLNN_ERR_PARAM_INVALID, "'dim' out of range (expected to be in range of [%ld, %ld], but got %ld",
+                -dims, dims - 1, dim);
+        return false;
+    }
+    return true;
+}
+
+static bool CheckLength(int64_t n, int64_t dimLength)
+{
+    if (!fft::IsValidLength(n) || (n == -1 && dimLength > fft::FFT_BORDER_VALUE)) {
+        OP_LOGE(ACLNN_ERR_PARAM_INVALID, "'n' should be in [1, 262144] or -1 with a dim length of at most 262144");
+        return false;
+    }
+    return true;
+}
+
+static bool CheckNorm(int64_t norm)
+{
+    if (!fft::IsValidNorm(norm)) {
+        OP_LOGE(ACLNN_ERR_PARAM_INVALID,
+                "'norm' should be equal {BACKWARD, FORWARD, ORTHO} via pytorch call or {1, 2, 3} in other cases");
+        return false;
+    }
+    return true;
+}
+
+static aclnnStatus FinishWithResult(const aclTensor* result, aclTensor* out, UniqueExecutor& uniqueExecutor,
+                                    uint64_t* workspaceSize, aclOpExecutor** executor)
+{
+    CHECK_RET(result != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    CHECK_RET(CheckShapeAndScalarSame(result, out), ACLNN_ERR_PARAM_INVALID);
+    auto viewCopyResult = l0op::ViewCopy(result, out, uniqueExecutor.get());
+    CHECK_RET(viewCopyResult != nullptr, ACLNN_ERR_INNER_NULLPTR);
+
+    *workspaceSize = uniqueExecutor->GetWorkspaceSize();
+    uniqueExecutor.ReleaseTo(executor);
+    return ACLNN_SUCCESS;
+}
+
+aclnnStatus aclFft1DGetWorkspaceSize(const aclTensor* self, int64_t n, int64_t dim, int64_t norm, bool forward,
+                                     aclTensor* out, uint64_t* workspaceSize, aclOpExecutor** executor)
+{
+    L2_DFX_PHASE_1(aclFft1D, DFX_IN(self, n, dim, norm, forward), DFX_OUT(out));
+    OP_LOGD("Fft1D: n %ld, dim %ld, norm %ld, forward %d", n, dim, norm, forward);
+
+    auto uniqueExecutor = CREATE_EXECUTOR();
+    CHECK_RET(uniqueExecutor.get() != nullptr, ACLNN_ERR_INNER_CREATE_EXECUTOR);
+    CHECK_RET(CheckNotNull(self, out), ACLNN_ERR_PARAM_NULLPTR);
+    if (self->IsEmpty()) {
+        *workspaceSize = 0;
+        uniqueExecutor.ReleaseTo(executor);
+        return ACLNN_SUCCESS;
+    }
+    CHECK_RET(CheckComplexTensor(self), ACLNN_ERR_PARAM_INVALID);
+    int64_t dims = static_cast<int64_t>(self->GetViewShape().GetDimNum()) - 1;
+    CHECK_RET(CheckDim(dim, dims) && CheckNorm(norm), ACLNN_ERR_PARAM_INVALID);
+    dim = dim < 0 ? dim + dims : dim;
+    CHECK_RET(CheckLength(n, self->GetViewShape().GetDim(dim)), ACLNN_ERR_PARAM_INVALID);
+
+    auto result = fft::Fft1DAlongDim(self, n, dim, norm, forward, uniqueExecutor.get());
+    return FinishWithResult(result, out, uniqueExecutor, workspaceSize, executor);
+}
+
+aclnnStatus aclFft1D(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream)
+{
+    L2_DFX_PHASE_2(aclFft1D);
+    return CommonOpExecutorRun(workspace, workspaceSize, executor, stream);
+}
+
+aclnnStatus aclFft2DGetWorkspaceSize(const aclTensor* self, int64_t n0, int64_t n1, int64_t dim0, int64_t dim1,
+                                     int64_t norm, bool forward, aclTensor* out, uint64_t* workspaceSize,
+                                     aclOpExecutor** executor)
+{
+    L2_DFX_PHASE_1(aclFft2D, DFX_IN(self, n0, n1, dim0, dim1, norm, forward), DFX_OUT(out));
+    OP_LOGD("Fft2D: n (%ld, %ld), dim (%ld, %ld), norm %ld, forward %d", n0, n1, dim0, dim1, norm, forward);
+
+    auto uniqueExecutor = CREATE_EXECUTOR();
+    CHECK_RET(uniqueExecutor.get() != nullptr, ACLNN_ERR_INNER_CREATE_EXECUTOR);
+    CHECK_RET(CheckNotNull(self, out), ACLNN_ERR_PARAM_NULLPTR);
+    if (self->IsEmpty()) {
+        *workspaceSize = 0;
+        uniqueExecutor.ReleaseTo(executor);
+        return ACLNN_SUCCESS;
+    }
+    CHECK_RET(CheckComplexTensor(self), ACLNN_ERR_PARAM_INVALID);
+    int64_t dims = static_cast<int64_t>(self->GetViewShape().GetDimNum()) - 1;
+    CHECK_RET(CheckDim(dim0, dims) && CheckDim(dim1, dims) && CheckNorm(norm), ACLNN_ERR_PARAM_INVALID);
+    dim0 = dim0 < 0 ? dim0 + dims : dim0;
+    dim1 = dim1 < 0 ? dim1 + dims : dim1;
+    if (dim0 == dim1) {
+        OP_LOGE(ACLNN_ERR_PARAM_INVALID, "'dim0' and 'dim1' should be different, but both are %ld", dim0);
+        return ACLNN_ERR_PARAM_INVALID;
+    }
+    CHECK_RET(CheckLength(n0, self->GetViewShape().GetDim(dim0)) && CheckLength(n1, self->GetViewShape().GetDim(dim1)),
+              ACLNN_ERR_PARAM_INVALID);
+
+    // A 2-D DFT is separable: 1-D transforms along dim1 of the 1-D transforms along dim0.
+    auto partial = fft::Fft1DAlongDim(self, n0, dim0, norm, forward, uniqueExecutor.get());
+    CHECK_RET(partial != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    auto result = fft::Fft1DAlongDim(partial, n1, dim1, norm, forward, uniqueExecutor.get());
+    return FinishWithResult(result, out, uniqueExecutor, workspaceSize, executor);
+}
+
+aclnnStatus aclFft2D(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream)
+{
+    L2_DFX_PHASE_2(aclFft2D);
+    return CommonOpExecutorRun(workspace, workspaceSize, executor, stream);
+}
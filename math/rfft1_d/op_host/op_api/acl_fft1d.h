@@ -0,0 +1,80 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef OP_API_INC_LEVEL2_ACL_FFT1D_H_
+#define OP_API_INC_LEVEL2_ACL_FFT1D_H_
+
+#include "aclnn/aclnn_base.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief aclFft1D First segment interface. Calculate the workspace size based on the specific calculation process.
+ * Function description: Calculates the complex-to-complex FFT (or its inverse) of the input along dim.
+ * Calculation formula:
+ * $$ out[k] = scale \sum_{j=0}^{n-1} self[j] e^{\mp 2\pi i jk / n} $$
+ * Calculation chart:
+ ```mermaid
+ * graph LR
+ * A[(self)]--->B([l0op::Transpose])
+ * B--->C([l0op::Fft1D])
+ * C--->D([l0op::Transpose])
+ * D--->E([l0op::ViewCopy])
+ * E--->F[(out)]
+ * ` ` `
+ * @domain aclnn_ops_infer
+ * Parameter description:
+ * @param [in] self: Input tensor. The type is FLOAT, complex values are stored as a last dim of 2 (real, imag) as
+ * aclRfft1D writes them. The data format supports ND.
+ * @param [in] n: transform length in [1, 262144], the dim is cropped or zero padded to it. -1 keeps the dim length.
+ * @param [in] dim: transformed dim, counted without the last (real, imag) dim.
+ * @param [in] norm: normalization mode, 1 (backward), 2 (forward) or 3 (ortho).
+ * @param [in] forward: true for the forward transform, false for the inverse one.
+ * @param [in] out: Output tensor. The type is FLOAT, the shape is self with dim set to n.
+ * @param [out] workspace_size: Returns the workspace size that a user needs to apply for on the NPU device.
+ * @param [out] executor: Return the op executor, including the operator calculation process.
+ * @return aclnnStatus: Return the status code.
+ */
+aclnnStatus aclFft1DGetWorkspaceSize(const aclTensor* self, int64_t n, int64_t dim, int64_t norm, bool forward,
+                                     aclTensor* out, uint64_t* workspaceSize, aclOpExecutor** executor);
+
+/**
+ * @brief A second interface of aclFft1D, used to perform calculation.
+ * @param [in] workspace: start address of the workspace memory allocated on the NPU device.
+ * @param [in] workspace_size: size of the workspace applied on the NPU device, which is obtained by calling the first
+ * segment interface aclFft1DGetWorkspaceSize.
+ * @param [in] exector: op executor, including the operator calculation process.
+ * @param [in] stream: acl stream.
+ * @return aclnnStatus: returned status code
+ */
+aclnnStatus aclFft1D(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream);
+
+/**
+ * @brief aclFft2D First segment interface. Calculates the 2-D complex-to-complex FFT over (dim0, dim1) as 1-D
+ * transforms along dim0 and then dim1. n0 / n1, dim0 / dim1, norm and forward follow aclFft1DGetWorkspaceSize, norm
+ * applies to each 1-D transform so that the product is the 2-D normalization.
+ * @domain aclnn_ops_infer
+ */
+aclnnStatus aclFft2DGetWorkspaceSize(const aclTensor* self, int64_t n0, int64_t n1, int64_t dim0, int64_t dim1,
+                                     int64_t norm, bool forward, aclTensor* out, uint64_t* workspaceSize,
+                                     aclOpExecutor** executor);
+
+/**
+ * @brief A second interface of aclFft2D, used to perform calculation.
+ */
+aclnnStatus aclFft2D(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OP_API_INC_LEVEL2_ACL_FFT1D_H_
@@ -0,0 +1,78 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef OP_API_INC_LEVEL2_ACL_IRFFT1D_H_
+#define OP_API_INC_LEVEL2_ACL_IRFFT1D_H_
+
+#include "aclnn/aclnn_base.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief aclIrfft1D First segment interface. Calculate the workspace size based on the specific calculation process.
+ * Function description: Calculates the real inverse FFT of a one-sided spectrum along dim, the inverse of aclRfft1D.
+ * Calculation formula:
+ * $$ out = Irfft(self) $$
+ * Calculation chart:
+ ```mermaid
+ * graph LR
+ * A[(self)]--->B([l0op::Transpose])
+ * B--->C([l0op::Irfft1D])
+ * C--->D([l0op::Transpose])
+ * D--->E([l0op::ViewCopy])
+ * E--->F[(out)]
+ * ` ` `
+ * @domain aclnn_ops_infer
+ * Parameter description:
+ * @param [in] self: Input tensor. The type is FLOAT, the n / 2 + 1 spectrum bins are stored with a last dim of 2
+ * (real, imag) as aclRfft1D writes them. Missing bins are taken as zero and extra ones are ignored. The data format
+ * supports ND.
+ * @param [in] n: real output length in [1, 262144], -1 gives 2 * (bins - 1).
+ * @param [in] dim: transformed dim, counted without the last (real, imag) dim.
+ * @param [in] norm: normalization mode, 1 (backward), 2 (forward) or 3 (ortho).
+ * @param [in] out: Output tensor. The type is FLOAT, the shape is self without the last dim and with dim set to n.
+ * @param [out] workspace_size: Returns the workspace size that a user needs to apply for on the NPU device.
+ * @param [out] executor: Return the op executor, including the operator calculation process.
+ * @return aclnnStatus: Return the status code.
+ */
+aclnnStatus aclIrfft1DGetWorkspaceSize(const aclTensor* self, int64_t n, int64_t dim, int64_t norm, aclTensor* out,
+                                       uint64_t* workspaceSize, aclOpExecutor** executor);
+
+/**
+ * @brief A second interface of aclIrfft1D, used to perform calculation.
+ * @param [in] workspace: start address of the workspace memory allocated on the NPU device.
+ * @param [in] workspace_size: size of the workspace applied on the NPU device, which is obtained by calling the first
+ * segment interface aclIrfft1DGetWorkspaceSize.
+ * @param [in] exector: op executor, including the operator calculation process.
+ * @param [in] stream: acl stream.
+ * @return aclnnStatus: returned status code
+ */
+aclnnStatus aclIrfft1D(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream);
+
+/**
+ * @brief aclIrfft2D First segment interface. Calculates the 2-D real inverse FFT whose one-sided dim is dim1: an
+ * inverse C2C transform of n0 points along dim0 followed by aclIrfft1D of n1 points along dim1.
+ * @domain aclnn_ops_infer
+ */
+aclnnStatus aclIrfft2DGetWorkspaceSize(const aclTensor* self, int64_t n0, int64_t n1, int64_t dim0, int64_t dim1,
+                                       int64_t norm, aclTensor* out, uint64_t* workspaceSize, aclOpExecutor** executor);
+
+/**
+ * @brief A second interface of aclIrfft2D, used to perform calculation.
+ */
+aclnnStatus aclIrfft2D(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OP_API_INC_LEVEL2_ACL_IRFFT1D_H_
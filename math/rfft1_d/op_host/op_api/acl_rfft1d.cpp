@@ -15,6 +15,8 @@
 #include <iterator>
 #include <valarray>
 #include <map>
+#include <memory>
+#include <mutex>
 #include "acl_rfft1d.h"
 #include "rfft1d.h"
 #include "aclnn_kernels/pad.h"
@@ -33,13 +35,13 @@
 #include "conversion/concat_d/op_api/concat_d.h"
 #include "math/mul/op_api/mul.h"
 #include "op_api/aclnn_check.h"
+#include "op_api/fft_plan_cache.h"
+#include "op_host/fft_factors.h"
 
 using namespace op;
 
 static const uint32_t COMPLEX = 2;
 static const uint32_t MIN_OUTPUT_DIMS = 2;
-static const uint32_t LAST_DIM = 2;
-static const uint32_t POWER_OF_TWO = 2;
 static const uint32_t NZ_BORDER = 8;
 static const uint32_t NZ_BLOCK = 16;
 static const uint32_t MAX_FACTORS_LEN = 3;
@@ -48,8 +50,6 @@ static const uint32_t RFFT_BORDER_VALUE = 262144;
 static const uint32_t DEFAULT_MEMORY_SIZE = 100000;
 static const uint32_t HASH_KEY_DEVICE_CONSTANT = 10000000;
 static const uint32_t HASH_KEY_NORM_CONSTANT = 1000000;
-static const uint32_t FIRST_FACTOR = 2;
-static const uint32_t LAST_FACTOR = 64;
 static const double INIT_VALUE = 0.;
 static const std::string PAD_MODE = "constant";
 static const int64_t PAD_VALUE = 0;
@@ -68,8 +68,13 @@ private:
     std::mutex planCacheMutex;
 
     std::map<int32_t, int> deviceCacheNum;
-    std::map<int64_t, void*> planCache;
-    std::map<int64_t, int64_t> tensorLenCache;
+    // Device table address and its element count, keyed by (len, deviceId, norm).
+    std::map<int64_t, std::pair<void*, int64_t>> planCache;
+
+    static int64_t PlanKey(int64_t len, int32_t deviceId, int64_t norm)
+    {
+        return len + HASH_KEY_DEVICE_CONSTANT * static_cast<int64_t>(deviceId) + HASH_KEY_NORM_CONSTANT * norm;
+    }
 
 public:
     static Rfft1DSingleton& GetInstance()
@@ -90,23 +95,22 @@ public:
         return deviceCacheNum[deviceId];
     }
 
-    void AddPlanCache(int64_t len, int32_t deviceId, void* planDevice, int64_t norm)
+    void AddPlanCache(int64_t len, int32_t deviceId, void* planDevice, int64_t norm, int64_t tensorLen)
     {
-        int64_t key = len + HASH_KEY_DEVICE_CONSTANT * deviceId + HASH_KEY_NORM_CONSTANT * norm;
-        planCache[key] = planDevice;
+        std::lock_guard<std::mutex> lock(planCacheMutex);
+        planCache[PlanKey(len, deviceId, norm)] = {planDevice, tensorLen};
     }
 
-    void* FindPlanCache(int64_t len, int32_t deviceId, int64_t norm)
+    void* FindPlanCache(int64_t len, int32_t deviceId, int64_t norm, int64_t& tensorLen)
     {
-        int64_t key = len + HASH_KEY_DEVICE_CONSTANT * deviceId + HASH_KEY_NORM_CONSTANT * norm;
-        return planCache[key];
+        std::lock_guard<std::mutex> lock(planCacheMutex);
+        auto it = planCache.find(PlanKey(len, deviceId, norm));
+        if (it == planCache.end()) {
+            return nullptr;
+        }
+        tensorLen = it->second.second;
+        return it->second.first;
     }
-
-    void AddTensorLen(int64_t len, int64_t tensorLen) { tensorLenCache[len] = tensorLen; }
-
-    int64_t FindTensorLen(int64_t len) { return tensorLenCache[len]; }
-
-    bool operator<(const Rfft1DSingleton& other) const { return deviceCacheNum < other.deviceCacheNum; }
 };
 
 static const std::initializer_list<DataType>& GetDtypeSupportList()
@@ -376,97 +380,20 @@ static std::vector<double> GenerateAlphaBeta(const int64_t& len, const uint64_t&
     return ret;
 }
 
-static const aclTensor* GenerateDftMatrix(int64_t len, int64_t norm, aclOpExecutor* executor)
+static FftPlanPtr BuildDftPlan(int64_t len, int64_t norm)
 {
-    auto deviceId = GetCurrentPlatformInfo().GetDeviceId();
-
-    void* planDevice = Rfft1DSingleton::GetInstance().FindPlanCache(len, deviceId, norm);
-    if (planDevice != nullptr) {
-        int64_t tensorLen = Rfft1DSingleton::GetInstance().FindTensorLen(len);
-        auto dft = executor->AllocTensor({tensorLen}, op::DataType::DT_FLOAT);
-        dft->SetFromWorkspace(false);
-        dft->SetStorageAddr(planDevice);
-        executor->AbandonCache();
-        return dft;
-    }
-
     auto dft = Rfft1DDftGen(len, norm);
-    auto dftMatrix = executor->AllocHostTensor({static_cast<int64_t>(dft.size())}, op::DataType::DT_FLOAT);
-    float* addrStart = static_cast<float*>(dftMatrix->GetStorageAddr());
-
-    for (size_t i = 0; i < dft.size(); ++i) {
-        *(addrStart + i) = float(dft[i]);
-    }
-
-    const aclTensor* deviceTensor = nullptr;
-    auto deviceIdCacheNum = Rfft1DSingleton::GetInstance().FindCacheNum(deviceId);
-    Rfft1DSingleton::GetInstance().AddTensorLen(len, dft.size());
-    if (deviceIdCacheNum < DEVICE_MAX_CACHE_NUM) {
-        Rfft1DSingleton::GetInstance().AddCacheNum(deviceId);
-        deviceTensor = op::CopyToNpuSync(dftMatrix, executor);
-        CHECK_RET(deviceTensor != nullptr, nullptr);
-        Rfft1DSingleton::GetInstance().AddPlanCache(len, deviceId, deviceTensor->GetData(), norm);
-    } else {
-        deviceTensor = op::CopyToNpu(dftMatrix, executor);
-        CHECK_RET(deviceTensor != nullptr, nullptr);
-    }
-
-    return deviceTensor;
-}
-
-static void CalculateIntermediateFactors(std::vector<uint32_t>& interFactors, std::vector<uint32_t> availableFactors,
-                                         uint32_t tmpN, int curFactorsIndex)
-{
-    while (curFactorsIndex >= 0) {
-        while (tmpN % availableFactors[curFactorsIndex] == 0) {
-            tmpN /= availableFactors[curFactorsIndex];
-            interFactors.emplace_back(availableFactors[curFactorsIndex]);
-        }
-        curFactorsIndex -= 1;
-    }
-    while (interFactors.size() < MAX_FACTORS_LEN) {
-        interFactors.emplace_back(1);
-    }
+    auto plan = std::make_shared<FftPlan>();
+    plan->table.assign(dft.begin(), dft.end());
+    return plan;
 }
 
 static void CalculateFactors(uint32_t factors[], int64_t len, bool& isBluestein)
 {
-    std::vector<uint32_t> availableFactors(LAST_FACTOR - FIRST_FACTOR + 1);
-    std::iota(availableFactors.begin(), availableFactors.end(), FIRST_FACTOR);
-    std::vector<uint32_t> factorsTmp, factorsTmpBluestein;
-
-    int curFactorsIndex = availableFactors.size() - 1;
-    uint32_t tmpN = len;
-
-    if (tmpN == LAST_FACTOR * LAST_FACTOR * LAST_FACTOR * COMPLEX) {
-        factorsTmp.emplace_back(LAST_FACTOR * COMPLEX);
-        factorsTmp.emplace_back(LAST_FACTOR);
-        factorsTmp.emplace_back(LAST_FACTOR);
-        tmpN = 1;
-    } else {
-        CalculateIntermediateFactors(factorsTmp, availableFactors, tmpN, curFactorsIndex);
-    }
-    for (size_t i = 0; i < MAX_FACTORS_LEN; ++i) {
-        factors[i] = factorsTmp[i];
-    }
-
-    isBluestein = (len % LAST_FACTOR != 0) || (factors[0] * factors[1] * factors[LAST_DIM] != len);
-
+    Ops::Math::CalcFftFactors(static_cast<uint32_t>(len), factors);
+    isBluestein = Ops::Math::IsFftBluestein(static_cast<uint32_t>(len), factors);
     if (isBluestein) {
-        tmpN = uint32_t(POWER_OF_TWO * std::pow(POWER_OF_TWO, std::ceil(std::log2(double(len)))));
-        curFactorsIndex = availableFactors.size() - 1;
-
-        if (tmpN != LAST_FACTOR * LAST_FACTOR * LAST_FACTOR * COMPLEX) {
-            CalculateIntermediateFactors(factorsTmpBluestein, availableFactors, tmpN, curFactorsIndex);
-        } else {
-            factorsTmpBluestein.emplace_back(LAST_FACTOR * COMPLEX);
-            factorsTmpBluestein.emplace_back(LAST_FACTOR);
-            factorsTmpBluestein.emplace_back(LAST_FACTOR);
-            tmpN = 1;
-        }
-        for (size_t i = 0; i < MAX_FACTORS_LEN; ++i) {
-            factors[i] = factorsTmpBluestein[i];
-        }
+        Ops::Math::CalcFftFactors(Ops::Math::CalcFftBluesteinLength(static_cast<uint32_t>(len)), factors);
     }
 }
 
@@ -564,7 +491,7 @@ static void CalculationMatricesValues(std::vector<double>& dftRealVal, std::vect
     twiddleRealCurVal.clear(), twiddleImagCurVal.clear(), twiddleImagBackCurVal.clear();
 }
 
-static void SetMatricesValues(std::vector<double> matrix, float* addrStart, size_t& i)
+static void SetMatricesValues(const std::vector<double>& matrix, float* addrStart, size_t& i)
 {
     size_t j = 0;
     size_t temp = i;
@@ -575,12 +502,13 @@ static void SetMatricesValues(std::vector<double> matrix, float* addrStart, size
     }
 }
 
-static const aclTensor* FinalCalculation(std::vector<double> dftRealVal, std::vector<double> dftImagVal,
-                                         std::vector<double> twiddleRealVal, std::vector<double> twiddleImagVal,
-                                         std::vector<double> dftRealBackVal, std::vector<double> dftImagBackVal,
-                                         std::vector<double> twiddleImagBackVal, int64_t len, bool isBluestein,
-                                         uint32_t& tensorLen, aclOpExecutor* executor)
+static void FinalCalculation(const std::vector<double>& dftRealVal, const std::vector<double>& dftImagVal,
+                             const std::vector<double>& twiddleRealVal, const std::vector<double>& twiddleImagVal,
+                             const std::vector<double>& dftRealBackVal, const std::vector<double>& dftImagBackVal,
+                             const std::vector<double>& twiddleImagBackVal, int64_t len, bool isBluestein,
+                             std::vector<float>& table)
 {
+    size_t tensorLen = dftRealVal.size() + dftImagVal.size() + twiddleRealVal.size() + twiddleImagVal.size();
     std::vector<double> bluesteinRet;
     if (isBluestein) {
         uint64_t pow2 = uint64_t(2 * std::pow(2, std::ceil(std::log2(double(len)))));
@@ -589,39 +517,24 @@ static const aclTensor* FinalCalculation(std::vector<double> dftRealVal, std::ve
                      bluesteinRet.size();
     }
 
-    auto dftMatrix = executor->AllocHostTensor({tensorLen}, op::DataType::DT_FLOAT);
-    float* addrStart = static_cast<float*>(dftMatrix->GetStorageAddr());
-
-    for (size_t i = 0; i < tensorLen;) {
-        SetMatricesValues(dftRealVal, addrStart, i);
-        SetMatricesValues(dftImagVal, addrStart, i);
+    table.resize(tensorLen);
+    float* addrStart = table.data();
+    size_t i = 0;
+    SetMatricesValues(dftRealVal, addrStart, i);
+    SetMatricesValues(dftImagVal, addrStart, i);
+    SetMatricesValues(twiddleRealVal, addrStart, i);
+    SetMatricesValues(twiddleImagVal, addrStart, i);
+    if (isBluestein) {
+        SetMatricesValues(dftRealBackVal, addrStart, i);
+        SetMatricesValues(dftImagBackVal, addrStart, i);
         SetMatricesValues(twiddleRealVal, addrStart, i);
-        SetMatricesValues(twiddleImagVal, addrStart, i);
-
-        if (isBluestein) {
-            SetMatricesValues(dftRealBackVal, addrStart, i);
-            SetMatricesValues(dftImagBackVal, addrStart, i);
-            SetMatricesValues(twiddleRealVal, addrStart, i);
-            SetMatricesValues(twiddleImagBackVal, addrStart, i);
-            SetMatricesValues(bluesteinRet, addrStart, i);
-        }
+        SetMatricesValues(twiddleImagBackVal, addrStart, i);
+        SetMatricesValues(bluesteinRet, addrStart, i);
     }
-    return dftMatrix;
 }
 
-static const aclTensor* GenerateTerminatorMatrix(int64_t len, int64_t norm, aclOpExecutor* executor)
+static FftPlanPtr BuildTerminatorPlan(int64_t len, int64_t norm)
 {
-    auto deviceId = GetCurrentPlatformInfo().GetDeviceId();
-    void* planDevice = Rfft1DSingleton::GetInstance().FindPlanCache(len, deviceId, norm);
-    if (planDevice != nullptr) {
-        int64_t tensorLen = Rfft1DSingleton::GetInstance().FindTensorLen(len);
-        auto dft = executor->AllocTensor({tensorLen}, op::DataType::DT_FLOAT);
-        dft->SetFromWorkspace(false);
-        dft->SetStorageAddr(planDevice);
-        executor->AbandonCache();
-        return dft;
-    }
-
     std::vector<double> dftRealVal, dftImagVal, dftRealBackVal, dftImagBackVal, twiddleRealVal, twiddleImagVal,
         twiddleImagBackVal;
 
@@ -653,19 +566,55 @@ static const aclTensor* GenerateTerminatorMatrix(int64_t len, int64_t norm, aclO
         prevFactors *= curFactor;
     }
 
-    uint32_t tensorLen = dftRealVal.size() + dftImagVal.size() + twiddleRealVal.size() + twiddleImagVal.size();
+    auto plan = std::make_shared<FftPlan>();
+    FinalCalculation(dftRealVal, dftImagVal, twiddleRealVal, twiddleImagVal, dftRealBackVal, dftImagBackVal,
+                     twiddleImagBackVal, len, isBluestein, plan->table);
+    plan->factors.assign(factors, factors + MAX_FACTORS_LEN);
+    plan->isBluestein = isBluestein;
+    return plan;
+}
 
-    auto dftMatrix = FinalCalculation(dftRealVal, dftImagVal, twiddleRealVal, twiddleImagVal, dftRealBackVal,
-                                      dftImagBackVal, twiddleImagBackVal, len, isBluestein, tensorLen, executor);
+// Host plan of (len, norm): the dense DFT matrix up to DFT_BORDER_VALUE, the mixed-radix tables above it.
+static FftPlanPtr GetRfft1DPlan(int64_t len, int64_t norm)
+{
+    FftPlanKey key;
+    key.kind = len <= DFT_BORDER_VALUE ? FftPlanKind::RFFT1D_DFT : FftPlanKind::RFFT1D_TERMINATOR;
+    key.length = len;
+    key.norm = norm;
+    key.dtype = static_cast<int32_t>(DataType::DT_FLOAT);
+    key.rows = len / COMPLEX + 1;
+    return FftPlanCache::GetInstance().GetOrBuild(key, [len, norm, &key]() {
+        return key.kind == FftPlanKind::RFFT1D_DFT ? BuildDftPlan(len, norm) : BuildTerminatorPlan(len, norm);
+    });
+}
+
+static const aclTensor* GeneratePlanMatrix(int64_t len, int64_t norm, aclOpExecutor* executor)
+{
+    auto deviceId = GetCurrentPlatformInfo().GetDeviceId();
+    int64_t tensorLen = 0;
+    void* planDevice = Rfft1DSingleton::GetInstance().FindPlanCache(len, deviceId, norm, tensorLen);
+    if (planDevice != nullptr) {
+        auto dft = executor->AllocTensor({tensorLen}, op::DataType::DT_FLOAT);
+        dft->SetFromWorkspace(false);
+        dft->SetStorageAddr(planDevice);
+        executor->AbandonCache();
+        return dft;
+    }
+
+    FftPlanPtr plan = GetRfft1DPlan(len, norm);
+    CHECK_RET(plan != nullptr, nullptr);
+    tensorLen = static_cast<int64_t>(plan->table.size());
+    auto dftMatrix = executor->AllocHostTensor({tensorLen}, op::DataType::DT_FLOAT);
+    CHECK_RET(dftMatrix != nullptr, nullptr);
+    std::copy(plan->table.begin(), plan->table.end(), static_cast<float*>(dftMatrix->GetStorageAddr()));
 
     const aclTensor* deviceTensor = nullptr;
     auto deviceIdCacheNum = Rfft1DSingleton::GetInstance().FindCacheNum(deviceId);
-    Rfft1DSingleton::GetInstance().AddTensorLen(len, tensorLen);
     if (deviceIdCacheNum < DEVICE_MAX_CACHE_NUM) {
         Rfft1DSingleton::GetInstance().AddCacheNum(deviceId);
         deviceTensor = op::CopyToNpuSync(dftMatrix, executor);
         CHECK_RET(deviceTensor != nullptr, nullptr);
-        Rfft1DSingleton::GetInstance().AddPlanCache(len, deviceId, deviceTensor->GetData(), norm);
+        Rfft1DSingleton::GetInstance().AddPlanCache(len, deviceId, deviceTensor->GetData(), norm, tensorLen);
     } else {
         deviceTensor = op::CopyToNpu(dftMatrix, executor);
         CHECK_RET(deviceTensor != nullptr, nullptr);
@@ -827,8 +776,7 @@ aclnnStatus aclRfft1DGetWorkspaceSize(const aclTensor* self, int64_t n, int64_t
         OP_LOGD("Rfft1D: aicore");
     }
 
-    const aclTensor* dftMatrix = n <= DFT_BORDER_VALUE ? GenerateDftMatrix(n, norm, uniqueExecutor.get()) :
-                                                         GenerateTerminatorMatrix(n, norm, uniqueExecutor.get());
+    const aclTensor* dftMatrix = GeneratePlanMatrix(n, norm, uniqueExecutor.get());
 
     auto outResult = l0op::Rfft1D(selfContiguous, dftMatrix, n, norm, uniqueExecutor.get());
     CHECK_RET(outResult != nullptr, ACLNN_ERR_INNER_NULLPTR);
@@ -849,3 +797,24 @@ aclnnStatus aclRfft1D(void* workspace, uint64_t workspaceSize, aclOpExecutor* ex
     L2_DFX_PHASE_2(aclRfft1D);
     return CommonOpExecutorRun(workspace, workspaceSize, executor, stream);
 }
+
+aclnnStatus aclRfft1DPlanCachePrewarm(int64_t n, int64_t norm)
+{
+    if (n <= 0 || n > RFFT_BORDER_VALUE) {
+        OP_LOGE(ACLNN_ERR_PARAM_INVALID, "'n' should be in [1, 262144], but got %ld", n);
+        return ACLNN_ERR_PARAM_INVALID;
+    }
+    if (!((norm == BACKWARD) || (norm == FORWARD) || (norm == ORTHO))) {
+        OP_LOGE(ACLNN_ERR_PARAM_INVALID, "'norm' should be in {1, 2, 3}, but got %ld", norm);
+        return ACLNN_ERR_PARAM_INVALID;
+    }
+    CHECK_RET(GetRfft1DPlan(n, norm) != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    return ACLNN_SUCCESS;
+}
+
+aclnnStatus aclRfft1DPlanCacheClear()
+{
+    FftPlanCache::GetInstance().Clear(FftPlanKind::RFFT1D_DFT);
+    FftPlanCache::GetInstance().Clear(FftPlanKind::RFFT1D_TERMINATOR);
+    return ACLNN_SUCCESS;
+}
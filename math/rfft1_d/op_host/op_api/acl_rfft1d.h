@@ -55,6 +55,22 @@ aclnnStatus aclRfft1DGetWorkspaceSize(const aclTensor* self, int64_t n, int64_t
 
 aclnnStatus aclRfft1D(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream);
 
+/**
+ * @brief Build the host DFT/twiddle plan of (n, norm) ahead of the first aclRfft1DGetWorkspaceSize call.
+ * Plans are kept in a process-wide LRU cache shared by all devices; the first call on each device then only copies
+ * the cached plan to the device.
+ * @param [in] n: transform length, in [1, 262144].
+ * @param [in] norm: normalization mode, 1 (backward), 2 (forward) or 3 (ortho).
+ * @return aclnnStatus: returned status code
+ */
+aclnnStatus aclRfft1DPlanCachePrewarm(int64_t n, int64_t norm);
+
+/**
+ * @brief Release the host plans cached by Rfft1D. Plans already copied to a device are not affected.
+ * @return aclnnStatus: returned status code
+ */
+aclnnStatus aclRfft1DPlanCacheClear();
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,42 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "fft1d.h"
+#include "opdev/make_op_executor.h"
+#include "opdev/aicpu/aicpu_task.h"
+#include "opdev/op_def.h"
+#include "opdev/op_dfx.h"
+#include "opdev/op_executor.h"
+#include "opdev/op_log.h"
+#include "opdev/shape_utils.h"
+
+using namespace op;
+
+namespace l0op {
+OP_TYPE_REGISTER(Fft1D);
+
+static const size_t COMPLEX_PAIR_DIMS = 2;
+
+const aclTensor* Fft1D(const aclTensor* self, int64_t n, int64_t norm, bool forward, aclOpExecutor* executor)
+{
+    op::Shape outShape = self->GetViewShape();
+    outShape.SetDim(outShape.GetDimNum() - COMPLEX_PAIR_DIMS, n);
+    auto out = executor->AllocTensor(outShape, self->GetDataType());
+    CHECK_RET(out != nullptr, nullptr);
+
+    L0_DFX(Fft1D, self, n, norm, forward, out);
+
+    static internal::AicpuTaskSpace space("Fft1D");
+    auto ret = ADD_TO_LAUNCHER_LIST_AICPU(Fft1D, OP_ATTR_NAMES({"n", "norm", "forward"}), OP_INPUT(self),
+                                          OP_OUTPUT(out), OP_ATTR(n, norm, forward));
+    CHECK_RET(ret == ACLNN_SUCCESS, nullptr);
+    return out;
+}
+} // namespace l0op
@@ -0,0 +1,21 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef OP_API_INC_LEVEL0_FFT1D_H_
+#define OP_API_INC_LEVEL0_FFT1D_H_
+
+#include "opdev/op_executor.h"
+
+namespace l0op {
+// C2C transform of n points along the second to last dim of self, a (..., len, 2) FLOAT tensor.
+const aclTensor* Fft1D(const aclTensor* self, int64_t n, int64_t norm, bool forward, aclOpExecutor* executor);
+} // namespace l0op
+
+#endif // OP_API_INC_LEVEL0_FFT1D_H_
@@ -0,0 +1,93 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef OP_API_INC_FFT_AXIS_UTILS_H_
+#define OP_API_INC_FFT_AXIS_UTILS_H_
+
+#include <vector>
+#include "fft1d.h"
+#include "irfft1d.h"
+#include "aclnn_kernels/contiguous.h"
+#include "aclnn_kernels/transpose.h"
+#include "opdev/op_executor.h"
+#include "opdev/op_log.h"
+
+namespace op {
+namespace fft {
+// Complex tensors are FLOAT tensors with a trailing (real, imag) dim of 2.
+constexpr int64_t COMPLEX_PAIR = 2;
+constexpr int64_t FFT_BORDER_VALUE = 262144;
+constexpr int64_t BACKWARD = 1;
+constexpr int64_t FORWARD = 2;
+constexpr int64_t ORTHO = 3;
+
+inline bool IsValidNorm(int64_t norm)
+{
+    return norm == BACKWARD || norm == FORWARD || norm == ORTHO;
+}
+
+inline bool IsValidLength(int64_t n)
+{
+    return (n > 0 && n <= FFT_BORDER_VALUE) || n == -1;
+}
+
+/**
+ * Swap dim with the last transform dim of x, i.e. the one before the trailing pairDims dims, so that the 1-D kernels
+ * which transform the innermost axis can run on it. The swap is its own inverse and moves the result back.
+ */
+inline const aclTensor* SwapToTransformDim(const aclTensor* x, int64_t dim, int64_t pairDims, aclOpExecutor* executor)
+{
+    auto xContiguous = l0op::Contiguous(x, executor);
+    CHECK_RET(xContiguous != nullptr, nullptr);
+    int64_t dims = static_cast<int64_t>(xContiguous->GetViewShape().GetDimNum());
+    int64_t last = dims - pairDims - 1;
+    if (dim == last) {
+        return xContiguous;
+    }
+    std::vector<int64_t> valuePerm(dims);
+    for (int64_t i = 0; i < dims; i++) {
+        valuePerm[i] = i;
+    }
+    std::swap(valuePerm[dim], valuePerm[last]);
+    auto perm = executor->AllocIntArray(valuePerm.data(), dims);
+    return l0op::Transpose(xContiguous, perm, executor);
+}
+
+// C2C transform of n points (-1 keeps the length) along dim of a (..., 2) tensor.
+inline const aclTensor* Fft1DAlongDim(const aclTensor* x, int64_t n, int64_t dim, int64_t norm, bool forward,
+                                      aclOpExecutor* executor)
+{
+    auto moved = SwapToTransformDim(x, dim, 1, executor);
+    CHECK_RET(moved != nullptr, nullptr);
+    if (n == -1) {
+        n = moved->GetViewShape().GetDim(moved->GetViewShape().GetDimNum() - COMPLEX_PAIR);
+    }
+    auto result = l0op::Fft1D(moved, n, norm, forward, executor);
+    CHECK_RET(result != nullptr, nullptr);
+    return SwapToTransformDim(result, dim, 1, executor);
+}
+
+// Real inverse of n points (-1 gives 2 * (bins - 1)) along dim of a (..., 2) one-sided spectrum.
+inline const aclTensor* Irfft1DAlongDim(const aclTensor* x, int64_t n, int64_t dim, int64_t norm,
+                                        aclOpExecutor* executor)
+{
+    auto moved = SwapToTransformDim(x, dim, 1, executor);
+    CHECK_RET(moved != nullptr, nullptr);
+    if (n == -1) {
+        n = COMPLEX_PAIR * (moved->GetViewShape().GetDim(moved->GetViewShape().GetDimNum() - COMPLEX_PAIR) - 1);
+    }
+    auto result = l0op::Irfft1D(moved, n, norm, executor);
+    CHECK_RET(result != nullptr, nullptr);
+    return SwapToTransformDim(result, dim, 0, executor);
+}
+} // namespace fft
+} // namespace op
+
+#endif // OP_API_INC_FFT_AXIS_UTILS_H_
@@ -0,0 +1,52 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "irfft1d.h"
+#include "opdev/make_op_executor.h"
+#include "opdev/aicpu/aicpu_task.h"
+#include "opdev/op_def.h"
+#include "opdev/op_dfx.h"
+#include "opdev/op_executor.h"
+#include "opdev/op_log.h"
+#include "opdev/shape_utils.h"
+
+using namespace op;
+
+namespace l0op {
+OP_TYPE_REGISTER(Irfft1D);
+
+static op::Shape GetOutputShape(const aclTensor* self, int64_t n)
+{
+    op::Shape inputShape = self->GetViewShape();
+    // (..., bins, 2) -> (..., n)
+    size_t dims = inputShape.GetDimNum() - 1;
+    op::Shape outputShape;
+    outputShape.SetDimNum(dims);
+    for (size_t i = 0; i + 1 < dims; i++) {
+        outputShape.SetDim(i, inputShape.GetDim(i));
+    }
+    outputShape.SetDim(dims - 1, n);
+    return outputShape;
+}
+
+const aclTensor* Irfft1D(const aclTensor* self, int64_t n, int64_t norm, aclOpExecutor* executor)
+{
+    auto out = executor->AllocTensor(GetOutputShape(self, n), self->GetDataType());
+    CHECK_RET(out != nullptr, nullptr);
+
+    L0_DFX(Irfft1D, self, n, norm, out);
+
+    static internal::AicpuTaskSpace space("Irfft1D");
+    auto ret = ADD_TO_LAUNCHER_LIST_AICPU(Irfft1D, OP_ATTR_NAMES({"n", "norm"}), OP_INPUT(self), OP_OUTPUT(out),
+                                          OP_ATTR(n, norm));
+    CHECK_RET(ret == ACLNN_SUCCESS, nullptr);
+    return out;
+}
+} // namespace l0op
@@ -16,18 +16,16 @@
 #include "register/op_def_registry.h"
 #include "exe_graph/runtime/shape.h"
 #include "rfft1_d_tiling_base.h"
+#include "op_host/fft_factors.h"
 #include <iostream>
 #include <cmath>
-#include <numeric>
 #include <vector>
 
 static const uint8_t MAX_FACTORS_LEN = 3;
 static const uint32_t USER_WORKSPACE_SIZE = 2147483648;
-static const uint32_t LAST_FACTOR = 64;
 static const uint32_t COMPLEX_PART = 2;
 static const uint32_t MATMUL_SIZE_MULTIPLIER = 24;
 static const uint32_t SIZE_PER_BATCH_MULTIPLIER = 4;
-static const uint32_t FIRST_FACTOR = 2;
 static const uint32_t BYTES_ALIGN = 8;
 static const uint32_t ROW_PAD = 16;
 static const uint32_t COL_PAD = 8;
@@ -92,68 +90,6 @@ ge::graphStatus Rfft1DTiling::GetWorkspaceSize()
     return ge::GRAPH_SUCCESS;
 }
 
-static void CalcColleyTukeyFactors(uint32_t factors[], std::vector<uint32_t> availableFactors, const uint32_t len)
-{
-    std::vector<uint32_t> factorsTmp;
-    int curFactorIndex = availableFactors.size() - 1;
-    uint32_t tmpN = len;
-
-    if (tmpN == LAST_FACTOR * LAST_FACTOR * LAST_FACTOR * COMPLEX_PART) {
-        for (size_t i = 0; i < MAX_FACTORS_LEN; i++) {
-            factors[i] = LAST_FACTOR;
-        }
-        factors[0] = LAST_FACTOR * COMPLEX_PART;
-    } else if (tmpN > DFT_BORDER_VALUE) {
-        while (curFactorIndex >= 0) {
-            uint32_t curFactor = availableFactors[curFactorIndex];
-
-            while (tmpN % curFactor == 0) {
-                tmpN /= curFactor;
-                factorsTmp.emplace_back(curFactor);
-            }
-            curFactorIndex -= 1;
-        }
-
-        while (factorsTmp.size() < MAX_FACTORS_LEN) {
-            factorsTmp.emplace_back(1);
-        }
-        for (size_t i = 0; i < MAX_FACTORS_LEN; i++) {
-            factors[i] = factorsTmp[i];
-        }
-    }
-}
-
-static void CalcBluesteinFactors(uint32_t factors[], std::vector<uint32_t> availableFactors, const uint32_t pow2)
-{
-    std::vector<uint32_t> factorsTmpBluestein;
-    if (pow2 == LAST_FACTOR * LAST_FACTOR * LAST_FACTOR * COMPLEX_PART) {
-        for (size_t i = 0; i < MAX_FACTORS_LEN; i++) {
-            factors[i] = LAST_FACTOR;
-        }
-        factors[0] = LAST_FACTOR * COMPLEX_PART;
-    } else {
-        uint32_t tmpN = pow2;
-        int curFactorIndex = availableFactors.size() - 1;
-
-        while (curFactorIndex >= 0) {
-            uint32_t curFactor = availableFactors[curFactorIndex];
-            while (tmpN % curFactor == 0) {
-                tmpN /= curFactor;
-                factorsTmpBluestein.emplace_back(curFactor);
-            }
-            curFactorIndex -= 1;
-        }
-
-        while (factorsTmpBluestein.size() < MAX_FACTORS_LEN) {
-            factorsTmpBluestein.emplace_back(1);
-        }
-
-        for (size_t i = 0; i < MAX_FACTORS_LEN; ++i) {
-            factors[i] = factorsTmpBluestein[i];
-        }
-    }
-}
-
 void Rfft1DTiling::CalcDftSizes(const uint32_t factors[], const bool isBluestein, const uint32_t len)
 {
     uint32_t dftRealOverallSize = 0;
@@ -221,18 +157,17 @@ ge::graphStatus Rfft1DTiling::DoOpTiling()
     uint32_t nextRadices[MAX_FACTORS_LEN] = {len / factors[0], 1, 1};
     uint8_t prevRadicesAlign[MAX_FACTORS_LEN] = {0, 1, 1};
 
-    // Calculate factors
-    std::vector<uint32_t> availableFactors(LAST_FACTOR - 1);
-    std::iota(availableFactors.begin(), availableFactors.end(), COMPLEX_PART);
-
-    CalcColleyTukeyFactors(factors, availableFactors, len);
+    // Calculate factors, up to DFT_BORDER_VALUE the whole transform is a single DFT matrix
+    if (len > DFT_BORDER_VALUE) {
+        Ops::Math::CalcFftFactors(len, factors);
+    }
 
-    const bool isBluestein = (len % LAST_FACTOR != 0) || (factors[0] * factors[1] * factors[2] != len);
-    const uint32_t pow2 = COMPLEX_PART * uint32_t(std::pow(2, std::ceil(std::log2(double(len)))));
+    const bool isBluestein = Ops::Math::IsFftBluestein(len, factors);
+    const uint32_t pow2 = Ops::Math::CalcFftBluesteinLength(len);
     const uint32_t lengthPad = isBluestein ? pow2 : len;
 
     if (isBluestein) {
-        CalcBluesteinFactors(factors, availableFactors, pow2);
+        Ops::Math::CalcFftFactors(pow2, factors);
     }
 
     for (uint8_t i = 1; i < MAX_FACTORS_LEN; ++i) {
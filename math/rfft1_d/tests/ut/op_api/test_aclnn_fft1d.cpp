@@ -0,0 +1,213 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <array>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "../../../op_host/op_api/acl_fft1d.h"
+
+#include "op_api_ut_common/op_api_ut.h"
+#include "op_api_ut_common/scalar_desc.h"
+#include "op_api_ut_common/tensor_desc.h"
+
+using namespace std;
+
+class l2_fft1d_test : public testing::Test {
+protected:
+    static void SetUpTestCase() { cout << "fft1d_test SetUp" << endl; }
+
+    static void TearDownTestCase() { cout << "fft1d_test TearDown" << endl; }
+};
+
+TEST_F(l2_fft1d_test, case_001_forward_pow2)
+{
+    auto selfDesc = TensorDesc({8, 64, 2}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto outDesc = TensorDesc({8, 64, 2}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclFft1D, INPUT(selfDesc, 64, -1, 1, true), OUTPUT(outDesc));
+
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+}
+
+TEST_F(l2_fft1d_test, case_002_inverse_bluestein_ortho)
+{
+    auto selfDesc = TensorDesc({97, 4, 2}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto outDesc = TensorDesc({97, 4, 2}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclFft1D, INPUT(selfDesc, 97, 0, 3, false), OUTPUT(outDesc));
+
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+}
+
+TEST_F(l2_fft1d_test, case_003_crop_and_pad)
+{
+    auto selfDesc = TensorDesc({3, 60, 2}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto outDesc = TensorDesc({3, 48, 2}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclFft1D, INPUT(selfDesc, 48, 1, 2, true), OUTPUT(outDesc));
+
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+}
+
+TEST_F(l2_fft1d_test, case_004_default_length)
+{
+    auto selfDesc = TensorDesc({2, 3, 30, 2}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto outDesc = TensorDesc({2, 3, 30, 2}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclFft1D, INPUT(selfDesc, -1, -1, 1, true), OUTPUT(outDesc));
+
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+}
+
+TEST_F(l2_fft1d_test, case_005_empty_self)
+{
+    auto selfDesc = TensorDesc({0, 16, 2}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto outDesc = TensorDesc({0, 16, 2}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclFft1D, INPUT(selfDesc, 16, -1, 1, true), OUTPUT(outDesc));
+
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+}
+
+TEST_F(l2_fft1d_test, case_006_self_nullptr)
+{
+    auto outDesc = TensorDesc({16, 2}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclFft1D, INPUT((aclTensor*)nullptr, 16, -1, 1, true), OUTPUT(outDesc));
+
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_NULLPTR);
+}
+
+TEST_F(l2_fft1d_test, case_007_out_nullptr)
+{
+    auto selfDesc = TensorDesc({16, 2}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclFft1D, INPUT(selfDesc, 16, -1, 1, true), OUTPUT((aclTensor*)nullptr));
+
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_NULLPTR);
+}
+
+TEST_F(l2_fft1d_test, case_008_dtype_not_support)
+{
+    auto selfDesc = TensorDesc({16, 2}, ACL_FLOAT16, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto outDesc = TensorDesc({16, 2}, ACL_FLOAT16, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclFft1D, INPUT(selfDesc, 16, -1, 1, true), OUTPUT(outDesc));
+
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+}
+
+TEST_F(l2_fft1d_test, case_009_last_dim_not_complex)
+{
+    auto selfDesc = TensorDesc({16, 3}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto outDesc = TensorDesc({16, 3}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclFft1D, INPUT(selfDesc, 16, -1, 1, true), OUTPUT(outDesc));
+
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+}
+
+TEST_F(l2_fft1d_test, case_010_dim_out_of_range)
+{
+    auto selfDesc = TensorDesc({4, 16, 2}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto outDesc = TensorDesc({4, 16, 2}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclFft1D, INPUT(selfDesc, 16, 2, 1, true), OUTPUT(outDesc));
+
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+}
+
+TEST_F(l2_fft1d_test, case_011_invalid_norm)
+{
+    auto selfDesc = TensorDesc({4, 16, 2}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto outDesc = TensorDesc({4, 16, 2}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclFft1D, INPUT(selfDesc, 16, -1, 4, true), OUTPUT(outDesc));
+
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+}
+
+TEST_F(l2_fft1d_test, case_012_invalid_length)
+{
+    auto selfDesc = TensorDesc({4, 16, 2}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto outDesc = TensorDesc({4, 262145, 2}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclFft1D, INPUT(selfDesc, 262145, -1, 1, true), OUTPUT(outDesc));
+
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+}
+
+TEST_F(l2_fft1d_test, case_013_out_shape_mismatch)
+{
+    auto selfDesc = TensorDesc({4, 16, 2}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto outDesc = TensorDesc({4, 15, 2}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclFft1D, INPUT(selfDesc, 16, -1, 1, true), OUTPUT(outDesc));
+
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+}
+
+TEST_F(l2_fft1d_test, case_101_fft2d_forward)
+{
+    auto selfDesc = TensorDesc({16, 12, 2}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto outDesc = TensorDesc({16, 12, 2}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclFft2D, INPUT(selfDesc, 16, 12, 0, 1, 1, true), OUTPUT(outDesc));
+
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+}
+
+TEST_F(l2_fft1d_test, case_102_fft2d_inverse_batched)
+{
+    auto selfDesc = TensorDesc({5, 8, 7, 2}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto outDesc = TensorDesc({5, 10, 7, 2}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclFft2D, INPUT(selfDesc, 10, 7, -2, -1, 3, false), OUTPUT(outDesc));
+
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+}
+
+TEST_F(l2_fft1d_test, case_103_fft2d_same_dim)
+{
+    auto selfDesc = TensorDesc({16, 12, 2}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto outDesc = TensorDesc({16, 12, 2}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclFft2D, INPUT(selfDesc, 16, 16, 0, -2, 1, true), OUTPUT(outDesc));
+
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+}
+
+TEST_F(l2_fft1d_test, case_104_fft2d_dim_out_of_range)
+{
+    auto selfDesc = TensorDesc({16, 12, 2}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto outDesc = TensorDesc({16, 12, 2}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclFft2D, INPUT(selfDesc, 16, 12, 0, 2, 1, true), OUTPUT(outDesc));
+
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+}
@@ -0,0 +1,192 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <array>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "../../../op_host/op_api/acl_irfft1d.h"
+
+#include "op_api_ut_common/op_api_ut.h"
+#include "op_api_ut_common/scalar_desc.h"
+#include "op_api_ut_common/tensor_desc.h"
+
+using namespace std;
+
+class l2_irfft1d_test : public testing::Test {
+protected:
+    static void SetUpTestCase() { cout << "irfft1d_test SetUp" << endl; }
+
+    static void TearDownTestCase() { cout << "irfft1d_test TearDown" << endl; }
+};
+
+TEST_F(l2_irfft1d_test, case_001_even_length)
+{
+    auto selfDesc = TensorDesc({8, 33, 2}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto outDesc = TensorDesc({8, 64}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclIrfft1D, INPUT(selfDesc, 64, -1, 1), OUTPUT(outDesc));
+
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+}
+
+TEST_F(l2_irfft1d_test, case_002_odd_length_ortho)
+{
+    auto selfDesc = TensorDesc({8, 32, 2}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto outDesc = TensorDesc({8, 63}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclIrfft1D, INPUT(selfDesc, 63, -1, 3), OUTPUT(outDesc));
+
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+}
+
+TEST_F(l2_irfft1d_test, case_003_default_length)
+{
+    auto selfDesc = TensorDesc({17, 3, 2}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto outDesc = TensorDesc({32, 3}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclIrfft1D, INPUT(selfDesc, -1, 0, 2), OUTPUT(outDesc));
+
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+}
+
+TEST_F(l2_irfft1d_test, case_004_missing_bins_padded)
+{
+    auto selfDesc = TensorDesc({2, 20, 2}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto outDesc = TensorDesc({2, 100}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclIrfft1D, INPUT(selfDesc, 100, -1, 1), OUTPUT(outDesc));
+
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+}
+
+TEST_F(l2_irfft1d_test, case_005_empty_self)
+{
+    auto selfDesc = TensorDesc({0, 9, 2}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto outDesc = TensorDesc({0, 16}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclIrfft1D, INPUT(selfDesc, 16, -1, 1), OUTPUT(outDesc));
+
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+}
+
+TEST_F(l2_irfft1d_test, case_006_self_nullptr)
+{
+    auto outDesc = TensorDesc({16}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclIrfft1D, INPUT((aclTensor*)nullptr, 16, -1, 1), OUTPUT(outDesc));
+
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_NULLPTR);
+}
+
+TEST_F(l2_irfft1d_test, case_007_dtype_not_support)
+{
+    auto selfDesc = TensorDesc({9, 2}, ACL_INT32, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto outDesc = TensorDesc({16}, ACL_INT32, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclIrfft1D, INPUT(selfDesc, 16, -1, 1), OUTPUT(outDesc));
+
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+}
+
+TEST_F(l2_irfft1d_test, case_008_last_dim_not_complex)
+{
+    auto selfDesc = TensorDesc({9, 1}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto outDesc = TensorDesc({16}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclIrfft1D, INPUT(selfDesc, 16, -1, 1), OUTPUT(outDesc));
+
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+}
+
+TEST_F(l2_irfft1d_test, case_009_single_bin_default_length)
+{
+    auto selfDesc = TensorDesc({4, 1, 2}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto outDesc = TensorDesc({4, 0}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclIrfft1D, INPUT(selfDesc, -1, -1, 1), OUTPUT(outDesc));
+
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+}
+
+TEST_F(l2_irfft1d_test, case_010_invalid_norm)
+{
+    auto selfDesc = TensorDesc({9, 2}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto outDesc = TensorDesc({16}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclIrfft1D, INPUT(selfDesc, 16, -1, 0), OUTPUT(outDesc));
+
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+}
+
+TEST_F(l2_irfft1d_test, case_011_out_shape_mismatch)
+{
+    auto selfDesc = TensorDesc({9, 2}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto outDesc = TensorDesc({9, 2}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclIrfft1D, INPUT(selfDesc, 16, -1, 1), OUTPUT(outDesc));
+
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+}
+
+TEST_F(l2_irfft1d_test, case_101_irfft2d)
+{
+    auto selfDesc = TensorDesc({16, 16, 2}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto outDesc = TensorDesc({16, 30}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclIrfft2D, INPUT(selfDesc, 16, 30, 0, 1, 1), OUTPUT(outDesc));
+
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+}
+
+TEST_F(l2_irfft1d_test, case_102_irfft2d_batched_default)
+{
+    auto selfDesc = TensorDesc({3, 8, 9, 2}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto outDesc = TensorDesc({3, 8, 16}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclIrfft2D, INPUT(selfDesc, -1, -1, -2, -1, 3), OUTPUT(outDesc));
+
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+}
+
+TEST_F(l2_irfft1d_test, case_103_irfft2d_same_dim)
+{
+    auto selfDesc = TensorDesc({16, 9, 2}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto outDesc = TensorDesc({16, 16}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclIrfft2D, INPUT(selfDesc, 16, 16, 1, -1, 1), OUTPUT(outDesc));
+
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+}
+
+TEST_F(l2_irfft1d_test, case_104_irfft2d_invalid_length)
+{
+    auto selfDesc = TensorDesc({16, 9, 2}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto outDesc = TensorDesc({16, 16}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(aclIrfft2D, INPUT(selfDesc, 0, 16, 0, 1, 1), OUTPUT(outDesc));
+
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+}
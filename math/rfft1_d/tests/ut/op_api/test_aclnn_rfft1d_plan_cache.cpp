@@ -0,0 +1,171 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <memory>
+#include "gtest/gtest.h"
+
+#include "../../../op_host/op_api/acl_rfft1d.h"
+#include "opdev/common_types.h"
+#include "op_api/fft_plan_cache.h"
+
+using namespace op;
+using namespace std;
+
+class l2_rfft1d_plan_cache_test : public testing::Test {
+protected:
+    void SetUp() override
+    {
+        ClearAll();
+    }
+
+    void TearDown() override
+    {
+        ClearAll();
+        FftPlanCache::GetInstance().SetMaxMemory(DEFAULT_FFT_PLAN_CACHE_MAX_MEMORY);
+    }
+
+    static void ClearAll()
+    {
+        FftPlanCache::GetInstance().Clear(FftPlanKind::RFFT1D_DFT);
+        FftPlanCache::GetInstance().Clear(FftPlanKind::RFFT1D_TERMINATOR);
+        FftPlanCache::GetInstance().Clear(FftPlanKind::STFT_DFT);
+    }
+
+    static FftPlanKey MakeKey(FftPlanKind kind, int64_t length, int64_t norm)
+    {
+        FftPlanKey key;
+        key.kind = kind;
+        key.length = length;
+        key.norm = norm;
+        key.dtype = static_cast<int32_t>(DataType::DT_FLOAT);
+        key.rows = length / 2 + 1;
+        return key;
+    }
+
+    static FftPlanPtr MakePlan(size_t tableSize)
+    {
+        auto plan = make_shared<FftPlan>();
+        plan->table.assign(tableSize, 1.0f);
+        return plan;
+    }
+};
+
+// 同一key第二次查询命中缓存，不再调用builder
+TEST_F(l2_rfft1d_plan_cache_test, plan_cache_hit)
+{
+    auto& cache = FftPlanCache::GetInstance();
+    int builds = 0;
+    auto builder = [&builds]() {
+        ++builds;
+        return MakePlan(64);
+    };
+    FftPlanKey key = MakeKey(FftPlanKind::RFFT1D_DFT, 128, 1);
+
+    FftPlanPtr first = cache.GetOrBuild(key, builder);
+    FftPlanPtr second = cache.GetOrBuild(key, builder);
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(builds, 1);
+    EXPECT_EQ(cache.GetUsedMemory(), first->Bytes());
+
+    // norm不同则为另一个plan
+    FftPlanPtr other = cache.GetOrBuild(MakeKey(FftPlanKind::RFFT1D_DFT, 128, 2), builder);
+    EXPECT_NE(other, first);
+    EXPECT_EQ(builds, 2);
+}
+
+// 超出内存上限时按LRU淘汰，超过上限一半的plan不进缓存
+TEST_F(l2_rfft1d_plan_cache_test, plan_cache_lru_eviction)
+{
+    auto& cache = FftPlanCache::GetInstance();
+    const int64_t planBytes = MakePlan(256)->Bytes();
+    cache.SetMaxMemory(planBytes * 2);
+
+    FftPlanKey keyA = MakeKey(FftPlanKind::RFFT1D_DFT, 16, 1);
+    FftPlanKey keyB = MakeKey(FftPlanKind::RFFT1D_DFT, 32, 1);
+    FftPlanKey keyC = MakeKey(FftPlanKind::RFFT1D_DFT, 64, 1);
+    cache.Insert(keyA, MakePlan(256));
+    cache.Insert(keyB, MakePlan(256));
+    EXPECT_NE(cache.Find(keyA), nullptr);
+    cache.Insert(keyC, MakePlan(256));
+    EXPECT_NE(cache.Find(keyA), nullptr);
+    EXPECT_EQ(cache.Find(keyB), nullptr);
+    EXPECT_NE(cache.Find(keyC), nullptr);
+    EXPECT_EQ(cache.GetUsedMemory(), planBytes * 2);
+
+    FftPlanKey keyLarge = MakeKey(FftPlanKind::RFFT1D_DFT, 128, 1);
+    FftPlanPtr large = cache.Insert(keyLarge, MakePlan(512));
+    EXPECT_NE(large, nullptr);
+    EXPECT_EQ(cache.Find(keyLarge), nullptr);
+    EXPECT_EQ(cache.GetUsedMemory(), planBytes * 2);
+}
+
+// Clear只释放指定kind的plan，调用方持有的plan仍然有效
+TEST_F(l2_rfft1d_plan_cache_test, plan_cache_clear_by_kind)
+{
+    auto& cache = FftPlanCache::GetInstance();
+    FftPlanKey rfftKey = MakeKey(FftPlanKind::RFFT1D_DFT, 128, 1);
+    FftPlanKey stftKey = MakeKey(FftPlanKind::STFT_DFT, 128, 1);
+    FftPlanPtr held = cache.Insert(rfftKey, MakePlan(64));
+    cache.Insert(stftKey, MakePlan(64));
+
+    cache.Clear(FftPlanKind::RFFT1D_DFT);
+    EXPECT_EQ(cache.Find(rfftKey), nullptr);
+    EXPECT_NE(cache.Find(stftKey), nullptr);
+    EXPECT_EQ(cache.GetUsedMemory(), held->Bytes());
+    EXPECT_EQ(held->table.size(), 64U);
+}
+
+// Prewarm构建的plan进入缓存，重复Prewarm不重复构建
+TEST_F(l2_rfft1d_plan_cache_test, aclRfft1DPlanCachePrewarm_dft_and_terminator)
+{
+    auto& cache = FftPlanCache::GetInstance();
+    EXPECT_EQ(aclRfft1DPlanCachePrewarm(1024, 1), ACLNN_SUCCESS);
+    FftPlanPtr dft = cache.Find(MakeKey(FftPlanKind::RFFT1D_DFT, 1024, 1));
+    ASSERT_NE(dft, nullptr);
+    EXPECT_FALSE(dft->table.empty());
+
+    EXPECT_EQ(aclRfft1DPlanCachePrewarm(48000, 2), ACLNN_SUCCESS);
+    FftPlanPtr terminator = cache.Find(MakeKey(FftPlanKind::RFFT1D_TERMINATOR, 48000, 2));
+    ASSERT_NE(terminator, nullptr);
+    EXPECT_FALSE(terminator->factors.empty());
+
+    const int64_t used = cache.GetUsedMemory();
+    EXPECT_EQ(used, dft->Bytes() + terminator->Bytes());
+    EXPECT_EQ(aclRfft1DPlanCachePrewarm(1024, 1), ACLNN_SUCCESS);
+    EXPECT_EQ(cache.Find(MakeKey(FftPlanKind::RFFT1D_DFT, 1024, 1)), dft);
+    EXPECT_EQ(cache.GetUsedMemory(), used);
+}
+
+// Prewarm参数非法
+TEST_F(l2_rfft1d_plan_cache_test, aclRfft1DPlanCachePrewarm_invalid_param)
+{
+    EXPECT_EQ(aclRfft1DPlanCachePrewarm(0, 1), ACLNN_ERR_PARAM_INVALID);
+    EXPECT_EQ(aclRfft1DPlanCachePrewarm(262145, 1), ACLNN_ERR_PARAM_INVALID);
+    EXPECT_EQ(aclRfft1DPlanCachePrewarm(1024, 0), ACLNN_ERR_PARAM_INVALID);
+    EXPECT_EQ(aclRfft1DPlanCachePrewarm(1024, 4), ACLNN_ERR_PARAM_INVALID);
+    EXPECT_EQ(FftPlanCache::GetInstance().GetUsedMemory(), 0);
+}
+
+// Clear释放Rfft1D的两类plan，不影响Stft的plan
+TEST_F(l2_rfft1d_plan_cache_test, aclRfft1DPlanCacheClear)
+{
+    auto& cache = FftPlanCache::GetInstance();
+    ASSERT_EQ(aclRfft1DPlanCachePrewarm(512, 3), ACLNN_SUCCESS);
+    ASSERT_EQ(aclRfft1DPlanCachePrewarm(8192, 3), ACLNN_SUCCESS);
+    FftPlanKey stftKey = MakeKey(FftPlanKind::STFT_DFT, 512, 3);
+    FftPlanPtr stft = cache.Insert(stftKey, MakePlan(64));
+
+    EXPECT_EQ(aclRfft1DPlanCacheClear(), ACLNN_SUCCESS);
+    EXPECT_EQ(cache.Find(MakeKey(FftPlanKind::RFFT1D_DFT, 512, 3)), nullptr);
+    EXPECT_EQ(cache.Find(MakeKey(FftPlanKind::RFFT1D_TERMINATOR, 8192, 3)), nullptr);
+    EXPECT_EQ(cache.Find(stftKey), stft);
+    EXPECT_EQ(cache.GetUsedMemory(), stft->Bytes());
+}
@@ -14,6 +14,7 @@
 #include <atomic>
 #include <numeric>
 #include <utility>
+#include <vector>
 
 #include "Eigen/Core"
 #include "cpu_kernel_utils.h"
@@ -25,11 +26,18 @@ namespace {
 const char* const kSearchSorted = "SearchSorted";
 constexpr size_t kOutputSize = 1;
 constexpr int64_t kParallelDataNum = 8 * 1024;
+// A row is gathered through the sorter into contiguous scratch once it serves at least len / kGatherRatio values;
+// below that, probing through the sorter is cheaper than the gather.
+constexpr int64_t kGatherRatio = 16;
+// Rows at least this large no longer stay cache resident, so once a row serves at least len / kMergeRatio values
+// the values are sorted and answered by one linear sweep instead of independent binary searches.
+constexpr int64_t kMergeMinRowBytes = 256 * 1024;
+constexpr int64_t kMergeRatio = 8;
 } // namespace
 
 namespace aicpu {
 template <typename S>
-int64_t CustomizedLowerBound(int64_t seq_start, int64_t seq_end, const S key, const S* sequence, int64_t* sort)
+int64_t CustomizedLowerBound(int64_t seq_start, int64_t seq_end, const S key, const S* sequence, const int64_t* sort)
 {
     const int64_t orig_start = seq_start;
     while (seq_start < seq_end) {
@@ -47,7 +55,7 @@ int64_t CustomizedLowerBound(int64_t seq_start, int64_t seq_end, const S key, co
 }
 
 template <typename S>
-int64_t CustomizedUpperBound(int64_t seq_start, int64_t seq_end, const S key, const S* sequence, int64_t* sort)
+int64_t CustomizedUpperBound(int64_t seq_start, int64_t seq_end, const S key, const S* sequence, const int64_t* sort)
 {
     const int64_t orig_start = seq_start;
     while (seq_start < seq_end) {
@@ -64,6 +72,125 @@ int64_t CustomizedUpperBound(int64_t seq_start, int64_t seq_end, const S key, co
     return seq_start;
 }
 
+// True if `x` sits before the insertion point of `key`: x < key for the left side, x <= key for the right side.
+// Written with the same negated comparisons as CustomizedLowerBound/UpperBound so NaN keys land at the row end.
+template <bool Right, typename S>
+inline bool BeforeKey(const S& x, const S& key)
+{
+    return Right ? !(x > key) : !(x >= key);
+}
+
+template <bool Right, typename S>
+inline int64_t BranchlessBound(const S* row, int64_t len, const S& key)
+{
+    const S* base = row;
+    int64_t n = len;
+    while (n > 1) {
+        const int64_t half = n >> 1;
+        base = BeforeKey<Right>(base[half], key) ? base + half : base;
+        n -= half;
+    }
+    return (base - row) + static_cast<int64_t>(BeforeKey<Right>(*base, key));
+}
+
+template <typename S>
+struct SearchSortedScratch {
+    std::vector<S> row;
+    std::vector<std::pair<S, int64_t>> order;
+};
+
+template <typename S, typename T>
+struct SearchSortedArgs {
+    const S* sequence;
+    const int64_t* sort;
+    const S* values;
+    T* output;
+    size_t seq_dim;
+    int64_t search_len;
+    int64_t search_repeat;
+};
+
+// A NaN in the row makes BeforeKey non-monotone along it (a NaN element is "before" every key), so the answer depends
+// on which elements the search probes. NaN sorts last, so such rows are recognised by their tail element.
+template <typename S>
+inline bool RowEndsWithNaN(const S* row, int64_t len)
+{
+    return (len > 0) && (row[len - 1] != row[len - 1]);
+}
+
+// Sorts the values (NaN last) and walks the row once, so every row element is read at most once.
+// Only valid while BeforeKey is monotone along the row, i.e. the row holds no NaN.
+template <bool Right, typename S, typename T>
+void MergeSweep(const S* row, int64_t len, const S* values, int64_t count, T* output, SearchSortedScratch<S>& scratch)
+{
+    auto& order = scratch.order;
+    order.resize(static_cast<size_t>(count));
+    for (int64_t i = 0; i < count; i++) {
+        order[i] = std::make_pair(values[i], i);
+    }
+    std::sort(order.begin(), order.end(), [](const std::pair<S, int64_t>& a, const std::pair<S, int64_t>& b) {
+        return (a.first < b.first) || ((b.first != b.first) && (a.first == a.first));
+    });
+    int64_t pos = 0;
+    for (const auto& item : order) {
+        while ((pos < len) && BeforeKey<Right>(row[pos], item.first)) {
+            pos++;
+        }
+        output[item.second] = static_cast<T>(pos);
+    }
+}
+
+// Answers `count` consecutive values that all search the same sequence row.
+template <bool Right, typename S, typename T>
+void SearchSortedRow(const S* row, const int64_t* row_sort, int64_t len, const S* values, int64_t count, T* output,
+                     SearchSortedScratch<S>& scratch)
+{
+    if (row_sort != nullptr) {
+        if (count * kGatherRatio < len) {
+            for (int64_t i = 0; i < count; i++) {
+                output[i] = static_cast<T>(Right ? CustomizedUpperBound(0, len, values[i], row, row_sort) :
+                                                   CustomizedLowerBound(0, len, values[i], row, row_sort));
+            }
+            return;
+        }
+        scratch.row.resize(static_cast<size_t>(len));
+        for (int64_t j = 0; j < len; j++) {
+            scratch.row[j] = row[row_sort[j]];
+        }
+        row = scratch.row.data();
+    }
+    // Neither the branchless probe order nor the sweep reproduces the reference search on a NaN-tailed row.
+    if (RowEndsWithNaN(row, len)) {
+        for (int64_t i = 0; i < count; i++) {
+            output[i] = static_cast<T>(Right ? CustomizedUpperBound<S>(0, len, values[i], row, nullptr) :
+                                               CustomizedLowerBound<S>(0, len, values[i], row, nullptr));
+        }
+        return;
+    }
+    if ((len * static_cast<int64_t>(sizeof(S)) >= kMergeMinRowBytes) && (count * kMergeRatio >= len)) {
+        MergeSweep<Right>(row, len, values, count, output, scratch);
+        return;
+    }
+    for (int64_t i = 0; i < count; i++) {
+        output[i] = static_cast<T>(BranchlessBound<Right>(row, len, values[i]));
+    }
+}
+
+template <bool Right, typename S, typename T>
+void SearchSortedRange(const SearchSortedArgs<S, T>& args, int64_t start, int64_t end)
+{
+    SearchSortedScratch<S> scratch;
+    int64_t i = start;
+    while (i < end) {
+        const int64_t row = (args.seq_dim == 1) ? 0 : (i / args.search_repeat);
+        const int64_t row_end = (args.seq_dim == 1) ? end : std::min(end, (row + 1) * args.search_repeat);
+        const int64_t seq_start = row * args.search_len;
+        SearchSortedRow<Right>(args.sequence + seq_start, (args.sort != nullptr) ? (args.sort + seq_start) : nullptr,
+                               args.search_len, args.values + i, row_end - i, args.output + i, scratch);
+        i = row_end;
+    }
+}
+
 inline bool matched_before_last_dim(const std::vector<int64_t>& sequence_dims, const std::vector<int64_t>& values_dims)
 {
     if (sequence_dims.size() != values_dims.size()) {
@@ -191,13 +318,12 @@ KernelStatus CalSearchSorted(bool right, const Tensor* sequence_t, const Tensor*
     if (sort_t != nullptr) {
         sort = static_cast<int64_t*>(sort_t->GetData());
     }
-    auto task = [&seq_dim, &search_repeat, &search_len, &values, &sequence, &sort, &output, &right](int64_t start,
-                                                                                                    int64_t end) {
-        for (int64_t i = start; i < end; i++) {
-            int64_t seq_start = (seq_dim == 1) ? 0 : (i / search_repeat) * search_len;
-            int64_t pos = right ? CustomizedUpperBound(seq_start, seq_start + search_len, values[i], sequence, sort) :
-                                  CustomizedLowerBound(seq_start, seq_start + search_len, values[i], sequence, sort);
-            output[i] = static_cast<T>(pos - seq_start);
+    const SearchSortedArgs<S, T> args{sequence, sort, values, output, seq_dim, search_len, search_repeat};
+    auto task = [&args, right](int64_t start, int64_t end) {
+        if (right) {
+            SearchSortedRange<true>(args, start, end);
+        } else {
+            SearchSortedRange<false>(args, start, end);
         }
     };
     int64_t elem_num = values_t->NumElements();
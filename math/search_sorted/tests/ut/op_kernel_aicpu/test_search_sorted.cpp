@@ -19,6 +19,8 @@
 #undef private
 #undef protected
 #include "Eigen/Core"
+#include <algorithm>
+#include <cmath>
 
 using namespace std;
 using namespace aicpu;
@@ -456,4 +458,147 @@ TEST_F(TEST_SearchSorted_UTest, EMPTY_VALUE_TENSOR)
         .Attr("dtype", data_type[1])
         .Attr("right", false);
     RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
-}
\ No newline at end of file
+}
+// Plain binary search with the kernel's negated comparisons, so NaN keys and NaN row tails land where
+// CustomizedLowerBound/UpperBound put them.
+int64_t ReferenceBound(const vector<float>& row, float key, bool right)
+{
+    int64_t lo = 0;
+    int64_t hi = static_cast<int64_t>(row.size());
+    while (lo < hi) {
+        const int64_t mid = lo + ((hi - lo) >> 1);
+        const bool before = right ? !(row[mid] > key) : !(row[mid] >= key);
+        if (before) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+// Compares the kernel against a reference binary search on rows gathered through the sorter.
+void RunSearchSortedAgainstReference(
+    const vector<int64_t>& seq_shape, const vector<int64_t>& values_shape, vector<float>& sequence,
+    vector<float>& values, vector<int64_t>& sorter, bool right)
+{
+    const int64_t len = seq_shape.back();
+    const int64_t repeat = values_shape.back();
+    vector<int64_t> expect(values.size());
+    vector<float> row(len);
+    int64_t row_start = -1;
+    for (size_t i = 0; i < values.size(); i++) {
+        const int64_t seq_start = (seq_shape.size() == 1) ? 0 : static_cast<int64_t>(i) / repeat * len;
+        for (int64_t j = 0; (seq_start != row_start) && (j < len); j++) {
+            row[j] = sorter.empty() ? sequence[seq_start + j] : sequence[seq_start + sorter[seq_start + j]];
+        }
+        row_start = seq_start;
+        expect[i] = ReferenceBound(row, values[i], right);
+    }
+    vector<int64_t> output(values.size(), -1);
+    auto node_def = CpuKernelUtils::CpuKernelUtils::CreateNodeDef();
+    NodeDefBuilder builder(node_def.get(), "SearchSorted", "SearchSorted");
+    builder.Input({"sorted_sequence", DT_FLOAT, seq_shape, (void*)sequence.data()})
+        .Input({"values", DT_FLOAT, values_shape, (void*)values.data()});
+    if (!sorter.empty()) {
+        builder.Input({"sorter", DT_INT64, seq_shape, (void*)sorter.data()});
+    }
+    builder.Output({"out", DT_INT64, values_shape, (void*)output.data()})
+        .Attr("dtype", DT_INT64)
+        .Attr("right", right);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    EXPECT_EQ(output, expect);
+}
+
+TEST_F(TEST_SearchSorted_UTest, BUCKETIZE_WITH_SORTER_SUCC)
+{
+    // Few-thousand boundaries given out of order through a sorter, many values: the row is gathered once.
+    const int64_t len = 3000;
+    const int64_t num = 100000;
+    vector<float> sequence(len);
+    vector<int64_t> sorter(len);
+    for (int64_t j = 0; j < len; j++) {
+        sorter[j] = (j * 7) % len;
+        sequence[sorter[j]] = static_cast<float>(j / 2);
+    }
+    vector<float> values(num);
+    for (int64_t i = 0; i < num; i++) {
+        values[i] = static_cast<float>((i * 37) % 3200) * 0.5f - 50.0f;
+    }
+    RunSearchSortedAgainstReference({len}, {num}, sequence, values, sorter, false);
+    RunSearchSortedAgainstReference({len}, {num}, sequence, values, sorter, true);
+}
+
+TEST_F(TEST_SearchSorted_UTest, FEW_VALUES_WITH_SORTER_SUCC)
+{
+    const int64_t len = 5000;
+    vector<float> sequence(len);
+    vector<int64_t> sorter(len);
+    for (int64_t j = 0; j < len; j++) {
+        sorter[j] = len - 1 - j;
+        sequence[j] = static_cast<float>(len - j);
+    }
+    vector<float> values{-1.0f, 17.0f, 17.5f, 4999.0f, 6000.0f};
+    RunSearchSortedAgainstReference({len}, {5}, sequence, values, sorter, false);
+    RunSearchSortedAgainstReference({len}, {5}, sequence, values, sorter, true);
+}
+
+TEST_F(TEST_SearchSorted_UTest, LARGE_ROWS_MERGE_SWEEP_SUCC)
+{
+    // Rows too large for cache with many values each: values are sorted and swept, NaN values land at the end.
+    const int64_t rows = 3;
+    const int64_t len = 80000;
+    const int64_t repeat = 40000;
+    vector<float> sequence(rows * len);
+    for (int64_t r = 0; r < rows; r++) {
+        for (int64_t j = 0; j < len; j++) {
+            sequence[r * len + j] = static_cast<float>(r + j / 3);
+        }
+    }
+    vector<float> values(rows * repeat);
+    for (int64_t i = 0; i < rows * repeat; i++) {
+        values[i] = (i % 997 == 0) ? std::nanf("") : static_cast<float>((i * 131) % 28000) - 100.0f;
+    }
+    vector<int64_t> sorter;
+    RunSearchSortedAgainstReference({rows, len}, {rows, repeat}, sequence, values, sorter, false);
+    RunSearchSortedAgainstReference({rows, len}, {rows, repeat}, sequence, values, sorter, true);
+}
+
+TEST_F(TEST_SearchSorted_UTest, NAN_ROW_TAIL_SUCC)
+{
+    // Short rows take the branchless search, which probes in a different order than the reference search; with a
+    // NaN tail the probe order decides the answer ([1, NaN] with key 0 gives 2), so both must agree.
+    vector<float> pair{1.0f, std::nanf("")};
+    vector<float> pair_values{0.0f, 1.0f, 2.0f, std::nanf("")};
+    vector<float> row{0.0f, 1.0f, 2.0f, 5.0f, std::nanf("")};
+    vector<float> row_values{-1.0f, 1.5f, 4.0f, 5.0f, 6.0f, std::nanf("")};
+    vector<int64_t> sorter;
+    RunSearchSortedAgainstReference({2}, {4}, pair, pair_values, sorter, false);
+    RunSearchSortedAgainstReference({2}, {4}, pair, pair_values, sorter, true);
+    RunSearchSortedAgainstReference({5}, {6}, row, row_values, sorter, false);
+    RunSearchSortedAgainstReference({5}, {6}, row, row_values, sorter, true);
+}
+
+TEST_F(TEST_SearchSorted_UTest, LARGE_NAN_ROW_TAIL_SUCC)
+{
+    // Rows large enough for the merge sweep whose NaN tail covers the first probe of the reference search, answered
+    // directly and through a sorter.
+    const int64_t len = 80000;
+    const int64_t finite_num = 30000;
+    const int64_t num = 100000;
+    vector<float> sequence(len);
+    vector<int64_t> sorter(len);
+    for (int64_t j = 0; j < len; j++) {
+        sequence[j] = (j >= finite_num) ? std::nanf("") : static_cast<float>(j / 2);
+        sorter[j] = j;
+    }
+    vector<float> values(num);
+    for (int64_t i = 0; i < num; i++) {
+        values[i] = (i % 101 == 0) ? std::nanf("") : static_cast<float>((i * 131) % 16000) - 500.0f;
+    }
+    vector<int64_t> no_sorter;
+    RunSearchSortedAgainstReference({len}, {num}, sequence, values, no_sorter, false);
+    RunSearchSortedAgainstReference({len}, {num}, sequence, values, no_sorter, true);
+    RunSearchSortedAgainstReference({len}, {num}, sequence, values, sorter, false);
+    RunSearchSortedAgainstReference({len}, {num}, sequence, values, sorter, true);
+}
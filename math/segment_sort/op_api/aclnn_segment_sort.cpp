@@ -0,0 +1,127 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "aclnn_segment_sort.h"
+#include "segment_sort.h"
+#include "aclnn_kernels/contiguous.h"
+#include "aclnn/aclnn_base.h"
+#include "opdev/common_types.h"
+#include "opdev/data_type_utils.h"
+#include "opdev/op_dfx.h"
+#include "opdev/op_executor.h"
+#include "opdev/op_log.h"
+#include "aclnn_kernels/common/op_error_check.h"
+#include "op_api/level2_base.h"
+
+using namespace op;
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static const std::initializer_list<op::DataType> SELF_DTYPE_SUPPORT_LIST = {
+    op::DataType::DT_FLOAT16, op::DataType::DT_BF16,  op::DataType::DT_FLOAT, op::DataType::DT_DOUBLE,
+    op::DataType::DT_INT8,    op::DataType::DT_UINT8, op::DataType::DT_INT16, op::DataType::DT_INT32,
+    op::DataType::DT_INT64};
+
+static const std::initializer_list<op::DataType> OFFSETS_DTYPE_SUPPORT_LIST = {op::DataType::DT_INT32,
+                                                                               op::DataType::DT_INT64};
+
+static bool CheckDtypeValid(const aclTensor* self, const aclTensor* offsets, const aclTensor* valuesOut,
+                            const aclTensor* indicesOut)
+{
+    OP_CHECK_DTYPE_NOT_SUPPORT(self, SELF_DTYPE_SUPPORT_LIST, return false);
+    OP_CHECK_DTYPE_NOT_SUPPORT(offsets, OFFSETS_DTYPE_SUPPORT_LIST, return false);
+    OP_CHECK_DTYPE_NOT_MATCH(valuesOut, self->GetDataType(), return false);
+    OP_CHECK_DTYPE_NOT_MATCH(indicesOut, op::DataType::DT_INT64, return false);
+    return true;
+}
+
+static bool CheckShapeValid(const aclTensor* self, const aclTensor* offsets, const aclTensor* valuesOut,
+                            const aclTensor* indicesOut)
+{
+    OP_CHECK_WRONG_DIMENSION(self, 1, return false);
+    OP_CHECK_WRONG_DIMENSION(offsets, 1, return false);
+    // offsets至少包含起始边界0，其余取值约束（单调不减、末元素等于N）由kernel在执行时校验
+    if (offsets->GetViewShape().GetDim(0) < 1) {
+        OP_LOGE(ACLNN_ERR_PARAM_INVALID, "offsets should contain at least one element, but got %s.",
+                op::ToString(offsets->GetViewShape()).GetString());
+        return false;
+    }
+    OP_CHECK_SHAPE_NOT_EQUAL(valuesOut, self, return false);
+    OP_CHECK_SHAPE_NOT_EQUAL(indicesOut, self, return false);
+    return true;
+}
+
+static aclnnStatus CheckParams(const aclTensor* self, const aclTensor* offsets, const aclTensor* valuesOut,
+                               const aclTensor* indicesOut)
+{
+    // 1. 检查参数是否为空指针
+    CHECK_RET(CheckNotNull4Tensor(self, offsets, valuesOut, indicesOut), ACLNN_ERR_PARAM_NULLPTR);
+
+    // 2. 检查输入的数据类型是否在API支持的数据类型范围之内
+    CHECK_RET(CheckDtypeValid(self, offsets, valuesOut, indicesOut), ACLNN_ERR_PARAM_INVALID);
+
+    // 3. 检查shape是否支持
+    CHECK_RET(CheckShapeValid(self, offsets, valuesOut, indicesOut), ACLNN_ERR_PARAM_INVALID);
+
+    return ACLNN_SUCCESS;
+}
+
+aclnnStatus aclnnSegmentSortGetWorkspaceSize(const aclTensor* self, const aclTensor* offsets, bool descending,
+                                             aclTensor* valuesOut, aclTensor* indicesOut, uint64_t* workspaceSize,
+                                             aclOpExecutor** executor)
+{
+    OP_CHECK_COMM_INPUT(workspaceSize, executor);
+
+    L2_DFX_PHASE_1(aclnnSegmentSort, DFX_IN(self, offsets, descending), DFX_OUT(valuesOut, indicesOut));
+
+    auto ret = CheckParams(self, offsets, valuesOut, indicesOut);
+    CHECK_RET(ret == ACLNN_SUCCESS, ret);
+
+    auto uniqueExecutor = CREATE_EXECUTOR();
+    CHECK_RET(uniqueExecutor.get() != nullptr, ACLNN_ERR_INNER_CREATE_EXECUTOR);
+
+    if (self->IsEmpty()) {
+        *workspaceSize = 0;
+        uniqueExecutor.ReleaseTo(executor);
+        return ACLNN_SUCCESS;
+    }
+
+    auto selfContiguous = l0op::Contiguous(self, uniqueExecutor.get());
+    CHECK_RET(selfContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    auto offsetsContiguous = l0op::Contiguous(offsets, uniqueExecutor.get());
+    CHECK_RET(offsetsContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
+
+    auto sortResult = l0op::SegmentSort(selfContiguous, offsetsContiguous, descending, uniqueExecutor.get());
+    const aclTensor* valuesResult = std::get<0>(sortResult);
+    CHECK_RET(valuesResult != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    const aclTensor* indicesResult = std::get<1>(sortResult);
+    CHECK_RET(indicesResult != nullptr, ACLNN_ERR_INNER_NULLPTR);
+
+    auto valuesViewCopyResult = l0op::ViewCopy(valuesResult, valuesOut, uniqueExecutor.get());
+    CHECK_RET(valuesViewCopyResult != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    auto indicesViewCopyResult = l0op::ViewCopy(indicesResult, indicesOut, uniqueExecutor.get());
+    CHECK_RET(indicesViewCopyResult != nullptr, ACLNN_ERR_INNER_NULLPTR);
+
+    *workspaceSize = uniqueExecutor->GetWorkspaceSize();
+    uniqueExecutor.ReleaseTo(executor);
+
+    return ACLNN_SUCCESS;
+}
+
+aclnnStatus aclnnSegmentSort(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream)
+{
+    L2_DFX_PHASE_2(aclnnSegmentSort);
+    return CommonOpExecutorRun(workspace, workspaceSize, executor, stream);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,64 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef OP_API_INC_LEVEL2_ACLNN_SEGMENT_SORT_H_
+#define OP_API_INC_LEVEL2_ACLNN_SEGMENT_SORT_H_
+
+#include "aclnn/aclnn_base.h"
+#include "aclnn_util.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * 算子功能：对按offsets首尾相接存放的变长分段一维数据逐段独立稳定排序，返回排序后的值以及每个值在所属分段内的原始位置。
+ * 计算公式：第s段为  = self[offsets[s], offsets[s + 1])$，
+ * 18101
+ * valuesOut_s = sort(self_s), \quad valuesOut_s[i] = self_s[indicesOut_s[i]]
+ * 18101
+ */
+
+/**
+ * @brief aclnnSegmentSort的第一段接口，根据具体的计算流程，计算workspace大小。
+ * @domain aclnn_ops_infer
+ * @param [in] self: npu device侧的aclTensor，数据类型支持FLOAT16、BFLOAT16、FLOAT、DOUBLE、INT8、UINT8、INT16、INT32、
+ * INT64，shape为[N]，支持非连续的Tensor，数据格式支持ND。
+ * @param [in] offsets: npu device侧的aclTensor，数据类型支持INT32、INT64，shape为[S + 1]，第s段为
+ * self[offsets[s], offsets[s + 1])。offsets[0]需为0，单调不减且最后一个元素等于N，支持非连续的Tensor，数据格式支持ND。
+ * @param [in] descending: host侧的BOOL类型，为true时按降序排序，否则按升序排序。
+ * @param [in] valuesOut：npu device侧的aclTensor，数据类型与self一致，shape与self一致，支持非连续的Tensor，
+ * 数据格式支持ND。
+ * @param [in] indicesOut：npu device侧的aclTensor，数据类型支持INT64，shape与self一致，支持非连续的Tensor，
+ * 数据格式支持ND。
+ * @param [out] workspaceSize: 返回用户需要在npu device侧申请的workspace大小。
+ * @param [out] executor: 返回op执行器，包含了算子计算流程。
+ * @return aclnnStatus: 返回状态码。
+ */
+ACLNN_API aclnnStatus aclnnSegmentSortGetWorkspaceSize(const aclTensor* self, const aclTensor* offsets,
+                                                       bool descending, aclTensor* valuesOut, aclTensor* indicesOut,
+                                                       uint64_t* workspaceSize, aclOpExecutor** executor);
+
+/**
+ * @brief aclnnSegmentSort的第二段接口，用于执行计算。
+ * @param [in] workspace: 在npu device侧申请的workspace内存起址。
+ * @param [in] workspaceSize: 在npu device侧申请的workspace大小，由第一段接口aclnnSegmentSortGetWorkspaceSize获取。
+ * @param [in] executor: op执行器，包含了算子计算流程。
+ * @param [in] stream: acl stream流。
+ * @return aclnnStatus: 返回状态码。
+ */
+ACLNN_API aclnnStatus aclnnSegmentSort(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor,
+                                       aclrtStream stream);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OP_API_INC_LEVEL2_ACLNN_SEGMENT_SORT_H_
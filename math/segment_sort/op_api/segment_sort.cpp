@@ -0,0 +1,47 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "segment_sort.h"
+#include "opdev/aicpu/aicpu_task.h"
+#include "opdev/data_type_utils.h"
+#include "opdev/make_op_executor.h"
+#include "opdev/op_def.h"
+#include "opdev/op_dfx.h"
+#include "opdev/op_executor.h"
+#include "opdev/op_log.h"
+
+using namespace op;
+
+namespace l0op {
+OP_TYPE_REGISTER(SegmentSort);
+
+// AICPU算子kernel
+std::tuple<aclTensor*, aclTensor*> SegmentSort(const aclTensor* self, const aclTensor* offsets, bool descending,
+                                               aclOpExecutor* executor)
+{
+    L0_DFX(SegmentSort, self, offsets, descending);
+    // 根据输入shape申请输出tensor
+    auto valuesOut = executor->AllocTensor(self->GetViewShape(), self->GetDataType(), self->GetViewFormat());
+    auto indicesOut = executor->AllocTensor(self->GetViewShape(), DataType::DT_INT64, self->GetViewFormat());
+    if (valuesOut == nullptr || indicesOut == nullptr) {
+        OP_LOGE(ACLNN_ERR_INNER_NULLPTR, "alloc out tensor failed.");
+        return {nullptr, nullptr};
+    }
+
+    static internal::AicpuTaskSpace space("SegmentSort");
+    auto ret = ADD_TO_LAUNCHER_LIST_AICPU(SegmentSort, OP_ATTR_NAMES({"descending"}), OP_INPUT(self, offsets),
+                                          OP_OUTPUT(valuesOut, indicesOut), OP_ATTR(descending));
+    if (ret != ACL_SUCCESS) {
+        OP_LOGE(ACLNN_ERR_INNER_NULLPTR, "SegmentSortAiCpu ADD_TO_LAUNCHER_LIST_AICPU failed.");
+        return {nullptr, nullptr};
+    }
+    return {valuesOut, indicesOut};
+}
+} // namespace l0op
@@ -0,0 +1,49 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef OPS_OP_PROTO_SEGMENT_SORT_H_
+#define OPS_OP_PROTO_SEGMENT_SORT_H_
+
+#include "graph/operator_reg.h"
+
+namespace ge {
+/**
+ * @brief Sorts every segment of a ragged 1D tensor independently and returns the sorted values together with the
+ * stable position of every value inside its segment. \n
+ *
+ * @par Inputs:
+ * @li x: A 1D Tensor of N elements, the segments stored back to back. Must be one of the following types: float16,
+ * bfloat16, float32, double, int8, uint8, int16, int32, int64.
+ * @li offsets: A 1D Tensor of S + 1 elements, segment s being x[offsets[s], offsets[s + 1]). offsets[0] must be 0,
+ * the offsets non-decreasing and offsets[S] equal to N; empty segments are allowed. Must be one of the following
+ * types: int32, int64. \n
+ *
+ * @par Attributes:
+ * descending: An optional bool. Sorts every segment in descending order if true. Default: false. \n
+ *
+ * @par Outputs:
+ * @li y: A 1D Tensor of N elements, every segment of x sorted in place. Has the same type as x.
+ * @li indices: A 1D Tensor of type int64 and N elements, the position inside its segment of every value of y.
+ * Equal values keep their input order. NaN is ordered after every number in ascending order and before every number
+ * in descending order, and -0 equals +0. \n
+ *
+ * @par Restrictions:
+ * Warning: THIS FUNCTION IS EXPERIMENTAL.  Please do not use.
+ */
+REG_OP(SegmentSort)
+    .INPUT(x, TensorType({DT_FLOAT16, DT_BF16, DT_FLOAT, DT_DOUBLE, DT_INT8, DT_UINT8, DT_INT16, DT_INT32, DT_INT64}))
+    .INPUT(offsets, TensorType({DT_INT32, DT_INT64}))
+    .OUTPUT(y, TensorType({DT_FLOAT16, DT_BF16, DT_FLOAT, DT_DOUBLE, DT_INT8, DT_UINT8, DT_INT16, DT_INT32, DT_INT64}))
+    .OUTPUT(indices, TensorType({DT_INT64}))
+    .ATTR(descending, Bool, false)
+    .OP_END_FACTORY_REG(SegmentSort)
+} // namespace ge
+
+#endif // OPS_OP_PROTO_SEGMENT_SORT_H_
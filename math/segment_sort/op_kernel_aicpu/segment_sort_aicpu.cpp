@@ -0,0 +1,330 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "segment_sort_aicpu.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include "aicpu/radix_sort.h"
+#include "cpu_kernel_utils.h"
+#include "utils/kernel_util.h"
+
+namespace {
+const char* const kSegmentSort = "SegmentSort";
+const char* const kDescending = "descending";
+// Segments of at most kSegmentInsertionMax elements are insertion sorted in place.
+constexpr int64_t kSegmentInsertionMax = 16;
+// Up to kSegmentMergeMax elements a merge sort beats the fixed cost of the radix histograms.
+constexpr int64_t kSegmentMergeMax = 256;
+// A segment of at least kSegmentMultiCoreMin elements is radix sorted by every core, one such segment at a time.
+constexpr int64_t kSegmentMultiCoreMin = 256 * 1024;
+// Shorter segments are grouped into units of about kSegmentUnitElements elements shared out over the cores.
+constexpr int64_t kSegmentUnitElements = 16 * 1024;
+// Inputs of at most kSegmentSerialNum elements are sorted on the calling thread.
+constexpr int64_t kSegmentSerialNum = 64 * 1024;
+} // namespace
+
+namespace aicpu {
+namespace {
+
+template <typename T>
+struct SegmentSortIo {
+    using Key = typename RadixKey<T>::Key;
+    const T* x;
+    T* y;
+    int64_t* indices;
+    // All ones for descending: inverting the keys reverses their order, ties keep input order and NaNs come first.
+    Key flip;
+
+    void Encode(int64_t base, int64_t begin, int64_t end, KeyIndex<Key>* data) const
+    {
+        for (int64_t i = begin; i < end; i++) {
+            data[i].key = static_cast<Key>(RadixKey<T>::Encode(x[base + i]) ^ flip);
+            data[i].index = static_cast<uint32_t>(i);
+        }
+    }
+
+    void Emit(int64_t base, int64_t begin, int64_t end, const KeyIndex<Key>* sorted) const
+    {
+        for (int64_t i = begin; i < end; i++) {
+            const uint32_t src = sorted[i].index;
+            y[base + i] = x[base + src];
+            indices[base + i] = static_cast<int64_t>(src);
+        }
+    }
+};
+
+// Sorts [base, base + len) on the calling thread; data and tmp hold at least len elements.
+template <typename T>
+void SortSegment(const SegmentSortIo<T>& io, int64_t base, int64_t len, KeyIndex<typename RadixKey<T>::Key>* data,
+                 KeyIndex<typename RadixKey<T>::Key>* tmp)
+{
+    using Key = typename RadixKey<T>::Key;
+    if (len == 0) {
+        return;
+    }
+    io.Encode(base, 0, len, data);
+    KeyIndex<Key>* sorted = data;
+    if (len <= kSegmentInsertionMax) {
+        InsertionSort(data, len);
+    } else if (len <= kSegmentMergeMax) {
+        // Runs of kSegmentInsertionMax are insertion sorted, then merged pairwise between data and tmp.
+        for (int64_t s = 0; s < len; s += kSegmentInsertionMax) {
+            InsertionSort(data + s, std::min(kSegmentInsertionMax, len - s));
+        }
+        KeyIndex<Key>* src = data;
+        KeyIndex<Key>* dst = tmp;
+        auto less = [](const KeyIndex<Key>& a, const KeyIndex<Key>& b) { return a.key < b.key; };
+        for (int64_t width = kSegmentInsertionMax; width < len; width *= 2) {
+            for (int64_t s = 0; s < len; s += 2 * width) {
+                const int64_t mid = std::min(len, s + width);
+                const int64_t stop = std::min(len, s + 2 * width);
+                std::merge(src + s, src + mid, src + mid, src + stop, dst + s, less);
+            }
+            std::swap(src, dst);
+        }
+        sorted = src;
+    } else {
+        sorted = RadixSortSerial(data, tmp, len);
+    }
+    io.Emit(base, 0, len, sorted);
+}
+} // namespace
+
+uint32_t SegmentSortCpuKernel::Compute(CpuKernelContext& ctx)
+{
+    SegmentSortParams params;
+    KERNEL_HANDLE_ERROR(ParseParams(ctx, params), "[%s] check params failed.", kSegmentSort);
+    auto data_type = ctx.Input(kFirstInputIndex)->GetDataType();
+    switch (data_type) {
+        case DT_FLOAT16:
+            return SortCompute<Eigen::half>(ctx, params);
+        case DT_BFLOAT16:
+            return SortCompute<Eigen::bfloat16>(ctx, params);
+        case DT_FLOAT:
+            return SortCompute<float>(ctx, params);
+        case DT_DOUBLE:
+            return SortCompute<double>(ctx, params);
+        case DT_INT8:
+            return SortCompute<int8_t>(ctx, params);
+        case DT_UINT8:
+            return SortCompute<uint8_t>(ctx, params);
+        case DT_INT16:
+            return SortCompute<int16_t>(ctx, params);
+        case DT_INT32:
+            return SortCompute<int32_t>(ctx, params);
+        case DT_INT64:
+            return SortCompute<int64_t>(ctx, params);
+        default:
+            KERNEL_LOG_ERROR("[%s] invalid input type [%s]", kSegmentSort, DTypeStr(data_type).c_str());
+            return KERNEL_STATUS_PARAM_INVALID;
+    }
+}
+
+uint32_t SegmentSortCpuKernel::ParseParams(const CpuKernelContext& ctx, SegmentSortParams& params) const
+{
+    Tensor* x = ctx.Input(kFirstInputIndex);
+    Tensor* offsets = ctx.Input(kSecondInputIndex);
+    Tensor* y = ctx.Output(kFirstOutputIndex);
+    Tensor* indices = ctx.Output(kSecondOutputIndex);
+    KERNEL_CHECK_NULLPTR(x, KERNEL_STATUS_PARAM_INVALID, "[%s] get input x failed.", kSegmentSort)
+    KERNEL_CHECK_NULLPTR(offsets, KERNEL_STATUS_PARAM_INVALID, "[%s] get input offsets failed.", kSegmentSort)
+    KERNEL_CHECK_NULLPTR(y, KERNEL_STATUS_PARAM_INVALID, "[%s] get output y failed.", kSegmentSort)
+    KERNEL_CHECK_NULLPTR(indices, KERNEL_STATUS_PARAM_INVALID, "[%s] get output indices failed.", kSegmentSort)
+    KERNEL_CHECK_NULLPTR(offsets->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] get offsets data failed.",
+                         kSegmentSort)
+
+    auto x_shape = x->GetTensorShape();
+    auto offsets_shape = offsets->GetTensorShape();
+    KERNEL_CHECK_NULLPTR(x_shape, KERNEL_STATUS_PARAM_INVALID, "[%s] get x shape failed.", kSegmentSort)
+    KERNEL_CHECK_NULLPTR(offsets_shape, KERNEL_STATUS_PARAM_INVALID, "[%s] get offsets shape failed.", kSegmentSort)
+    KERNEL_CHECK_FALSE(x_shape->GetDims() == 1, KERNEL_STATUS_PARAM_INVALID, "[%s] x must be 1-D, got rank [%d].",
+                       kSegmentSort, x_shape->GetDims());
+    KERNEL_CHECK_FALSE(offsets_shape->GetDims() == 1 && offsets->NumElements() >= 1, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] offsets must be 1-D with at least one element.", kSegmentSort);
+    KERNEL_CHECK_FALSE(y->GetDataType() == x->GetDataType(), KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] y type [%s] should be the same as x type [%s].", kSegmentSort,
+                       DTypeStr(y->GetDataType()).c_str(), DTypeStr(x->GetDataType()).c_str());
+    KERNEL_CHECK_FALSE(indices->GetDataType() == DT_INT64, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] indices type [%s] should be int64.", kSegmentSort,
+                       DTypeStr(indices->GetDataType()).c_str());
+    params.num = x->NumElements();
+    KERNEL_CHECK_FALSE(y->NumElements() == params.num && indices->NumElements() == params.num,
+                       KERNEL_STATUS_PARAM_INVALID, "[%s] y and indices must hold [%ld] elements like x.",
+                       kSegmentSort, params.num);
+    if (params.num > 0) {
+        KERNEL_CHECK_NULLPTR(x->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] get x data failed.", kSegmentSort)
+        KERNEL_CHECK_NULLPTR(y->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] get y data failed.", kSegmentSort)
+        KERNEL_CHECK_NULLPTR(indices->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] get indices data failed.",
+                             kSegmentSort)
+    }
+
+    params.descending = false;
+    AttrValue* descending = ctx.GetAttr(kDescending);
+    if (descending != nullptr) {
+        params.descending = descending->GetBool();
+    }
+
+    switch (offsets->GetDataType()) {
+        case DT_INT32:
+            return ParseOffsets<int32_t>(offsets, params);
+        case DT_INT64:
+            return ParseOffsets<int64_t>(offsets, params);
+        default:
+            KERNEL_LOG_ERROR("[%s] offsets type [%s] should be int32 or int64.", kSegmentSort,
+                             DTypeStr(offsets->GetDataType()).c_str());
+            return KERNEL_STATUS_PARAM_INVALID;
+    }
+}
+
+template <typename Idx>
+uint32_t SegmentSortCpuKernel::ParseOffsets(const Tensor* offsets, SegmentSortParams& params) const
+{
+    const Idx* data = static_cast<const Idx*>(offsets->GetData());
+    const int64_t count = offsets->NumElements();
+    params.segments = count - 1;
+    params.offsets.resize(static_cast<size_t>(count));
+    KERNEL_CHECK_FALSE(data[0] == 0, KERNEL_STATUS_PARAM_INVALID, "[%s] offsets[0] must be 0, got [%ld].",
+                       kSegmentSort, static_cast<int64_t>(data[0]));
+    for (int64_t s = 0; s < count; s++) {
+        params.offsets[s] = static_cast<int64_t>(data[s]);
+        if (s == 0) {
+            continue;
+        }
+        const int64_t len = params.offsets[s] - params.offsets[s - 1];
+        KERNEL_CHECK_FALSE(len >= 0 && params.offsets[s] <= params.num, KERNEL_STATUS_PARAM_INVALID,
+                           "[%s] offsets must be non-decreasing and within [0, %ld], got offsets[%ld] = [%ld].",
+                           kSegmentSort, params.num, s, params.offsets[s]);
+        KERNEL_CHECK_FALSE(len <= static_cast<int64_t>(std::numeric_limits<uint32_t>::max()),
+                           KERNEL_STATUS_PARAM_INVALID, "[%s] segment [%ld] of [%ld] elements is too long.",
+                           kSegmentSort, s - 1, len);
+    }
+    KERNEL_CHECK_FALSE(params.offsets[count - 1] == params.num, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] last offset [%ld] must equal the number of elements [%ld].", kSegmentSort,
+                       params.offsets[count - 1], params.num);
+    return KERNEL_STATUS_OK;
+}
+
+/**
+ * Segments are bucketed by length: short ones (insertion or merge sort) and medium ones (radix sort on one core) are
+ * grouped into units of about kSegmentUnitElements elements and the units are shared out over the cores, while every
+ * huge segment is radix sorted by all cores in turn so one long segment does not serialize the op.
+ */
+template <typename T>
+uint32_t SegmentSortCpuKernel::SortCompute(const CpuKernelContext& ctx, const SegmentSortParams& params) const
+{
+    using Key = typename RadixKey<T>::Key;
+    if (params.num == 0) {
+        return KERNEL_STATUS_OK;
+    }
+    SegmentSortIo<T> io;
+    io.x = static_cast<const T*>(ctx.Input(kFirstInputIndex)->GetData());
+    io.y = static_cast<T*>(ctx.Output(kFirstOutputIndex)->GetData());
+    io.indices = static_cast<int64_t*>(ctx.Output(kSecondOutputIndex)->GetData());
+    io.flip = params.descending ? std::numeric_limits<Key>::max() : Key(0);
+    const int64_t* offsets = params.offsets.data();
+
+    const int64_t cores = static_cast<int64_t>(std::max(1U, CpuKernelUtils::GetCPUNum(ctx)));
+    if (cores == 1 || params.num <= kSegmentSerialNum) {
+        int64_t max_len = 0;
+        for (int64_t s = 0; s < params.segments; s++) {
+            max_len = std::max(max_len, offsets[s + 1] - offsets[s]);
+        }
+        std::vector<KeyIndex<Key>> data(static_cast<size_t>(max_len));
+        std::vector<KeyIndex<Key>> tmp(static_cast<size_t>(max_len));
+        for (int64_t s = 0; s < params.segments; s++) {
+            SortSegment(io, offsets[s], offsets[s + 1] - offsets[s], data.data(), tmp.data());
+        }
+        return KERNEL_STATUS_OK;
+    }
+
+    // Unit u covers segments [units[2u], units[2u + 1]); huge segments close the open unit and join none.
+    std::vector<int64_t> units;
+    std::vector<int64_t> huge;
+    int64_t unit_elements = 0;
+    bool unit_open = false;
+    for (int64_t s = 0; s < params.segments; s++) {
+        const int64_t len = offsets[s + 1] - offsets[s];
+        if (len >= kSegmentMultiCoreMin) {
+            huge.push_back(s);
+            if (unit_open) {
+                units.push_back(s);
+                unit_open = false;
+            }
+            continue;
+        }
+        if (!unit_open) {
+            units.push_back(s);
+            unit_open = true;
+            unit_elements = 0;
+        }
+        unit_elements += len;
+        if (unit_elements >= kSegmentUnitElements) {
+            units.push_back(s + 1);
+            unit_open = false;
+        }
+    }
+    if (unit_open) {
+        units.push_back(params.segments);
+    }
+    const int64_t unit_num = static_cast<int64_t>(units.size()) / 2;
+    KERNEL_LOG_INFO("[%s] segments=%ld, units=%ld, huge segments=%zu", kSegmentSort, params.segments, unit_num,
+                    huge.size());
+
+    if (unit_num > 0) {
+        auto shard = [&io, &units, offsets](int64_t begin, int64_t end) {
+            int64_t max_len = 0;
+            for (int64_t u = begin; u < end; u++) {
+                for (int64_t s = units[u * 2]; s < units[u * 2 + 1]; s++) {
+                    max_len = std::max(max_len, offsets[s + 1] - offsets[s]);
+                }
+            }
+            std::vector<KeyIndex<Key>> data(static_cast<size_t>(max_len));
+            std::vector<KeyIndex<Key>> tmp(static_cast<size_t>(max_len));
+            for (int64_t u = begin; u < end; u++) {
+                for (int64_t s = units[u * 2]; s < units[u * 2 + 1]; s++) {
+                    SortSegment(io, offsets[s], offsets[s + 1] - offsets[s], data.data(), tmp.data());
+                }
+            }
+        };
+        KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, unit_num, std::max<int64_t>(1, unit_num / cores), shard),
+                            "[%s] segment ParallelFor failed.", kSegmentSort)
+    }
+
+    if (!huge.empty()) {
+        int64_t max_len = 0;
+        for (int64_t s : huge) {
+            max_len = std::max(max_len, offsets[s + 1] - offsets[s]);
+        }
+        std::vector<KeyIndex<Key>> data(static_cast<size_t>(max_len));
+        std::vector<KeyIndex<Key>> tmp(static_cast<size_t>(max_len));
+        const int64_t per_unit = std::max<int64_t>(1, (max_len + cores - 1) / cores);
+        for (int64_t s : huge) {
+            const int64_t base = offsets[s];
+            const int64_t len = offsets[s + 1] - base;
+            const int64_t slice = std::min(per_unit, len);
+            auto encode = [&](int64_t begin, int64_t end) { io.Encode(base, begin, end, data.data()); };
+            KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, len, slice, encode), "[%s] encode pass failed.",
+                                kSegmentSort)
+            KeyIndex<Key>* sorted = nullptr;
+            KERNEL_HANDLE_ERROR(RadixSortParallel(ctx, data.data(), tmp.data(), len, cores, &sorted, kSegmentSort),
+                                "[%s] radix sort of segment [%ld] failed.", kSegmentSort, s)
+            auto emit = [&](int64_t begin, int64_t end) { io.Emit(base, begin, end, sorted); };
+            KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, len, slice, emit), "[%s] emit pass failed.",
+                                kSegmentSort)
+        }
+    }
+    return KERNEL_STATUS_OK;
+}
+
+REGISTER_CPU_KERNEL(kSegmentSort, SegmentSortCpuKernel);
+} // namespace aicpu
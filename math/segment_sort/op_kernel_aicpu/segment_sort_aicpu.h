@@ -0,0 +1,42 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef AICPU_KERNELS_NORMALIZED_SEGMENT_SORT_H_
+#define AICPU_KERNELS_NORMALIZED_SEGMENT_SORT_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "cpu_kernel.h"
+
+namespace aicpu {
+struct SegmentSortParams {
+    int64_t num = 0;
+    int64_t segments = 0;
+    bool descending = false;
+    // offsets widened to int64, segments + 1 entries.
+    std::vector<int64_t> offsets;
+};
+
+class SegmentSortCpuKernel : public CpuKernel {
+public:
+    SegmentSortCpuKernel() = default;
+    ~SegmentSortCpuKernel() override = default;
+    uint32_t Compute(CpuKernelContext& ctx) override;
+
+private:
+    uint32_t ParseParams(const CpuKernelContext& ctx, SegmentSortParams& params) const;
+    template <typename Idx>
+    uint32_t ParseOffsets(const Tensor* offsets, SegmentSortParams& params) const;
+    template <typename T>
+    uint32_t SortCompute(const CpuKernelContext& ctx, const SegmentSortParams& params) const;
+};
+} // namespace aicpu
+#endif // AICPU_KERNELS_NORMALIZED_SEGMENT_SORT_H_
@@ -0,0 +1,172 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "../../../op_api/aclnn_segment_sort.h"
+#include <vector>
+#include "gtest/gtest.h"
+#include "op_api_ut_common/tensor_desc.h"
+#include "op_api_ut_common/op_api_ut.h"
+
+using namespace std;
+
+class l2_segment_sort_test : public testing::Test {
+protected:
+    static void SetUpTestCase() { cout << "segment_sort_test SetUp" << endl; }
+
+    static void TearDownTestCase() { cout << "segment_sort_test TearDown" << endl; }
+};
+
+// 正常场景：全部数据类型，offsets为INT32/INT64
+TEST_F(l2_segment_sort_test, l2_segment_sort_all_datatype)
+{
+    vector<aclDataType> dtypes{ACL_FLOAT16, ACL_BF16, ACL_FLOAT, ACL_DOUBLE, ACL_INT8,
+                               ACL_UINT8,   ACL_INT16, ACL_INT32, ACL_INT64};
+    vector<aclDataType> offsetsDtypes{ACL_INT32, ACL_INT64};
+    for (auto dtype : dtypes) {
+        for (auto offsetsDtype : offsetsDtypes) {
+            auto self_desc = TensorDesc({10}, dtype, ACL_FORMAT_ND).ValueRange(-50, 50);
+            auto offsets_desc = TensorDesc({4}, offsetsDtype, ACL_FORMAT_ND);
+            auto values_desc = TensorDesc({10}, dtype, ACL_FORMAT_ND);
+            auto indices_desc = TensorDesc({10}, ACL_INT64, ACL_FORMAT_ND);
+
+            auto ut = OP_API_UT(aclnnSegmentSort, INPUT(self_desc, offsets_desc, false),
+                                OUTPUT(values_desc, indices_desc));
+            uint64_t workspace_size = 0;
+            aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspace_size);
+            EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+        }
+    }
+}
+
+// 降序、非连续输入
+TEST_F(l2_segment_sort_test, l2_segment_sort_descending_non_contiguous)
+{
+    auto self_desc = TensorDesc({6}, ACL_FLOAT, ACL_FORMAT_ND, {2}, 0, {12}).ValueRange(-50, 50);
+    auto offsets_desc = TensorDesc({3}, ACL_INT64, ACL_FORMAT_ND).Value(vector<int64_t>{0, 2, 6});
+    auto values_desc = TensorDesc({6}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto indices_desc = TensorDesc({6}, ACL_INT64, ACL_FORMAT_ND);
+
+    auto ut = OP_API_UT(aclnnSegmentSort, INPUT(self_desc, offsets_desc, true), OUTPUT(values_desc, indices_desc));
+    uint64_t workspace_size = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspace_size);
+    EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+}
+
+// 空tensor
+TEST_F(l2_segment_sort_test, l2_segment_sort_empty)
+{
+    auto self_desc = TensorDesc({0}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto offsets_desc = TensorDesc({1}, ACL_INT64, ACL_FORMAT_ND).Value(vector<int64_t>{0});
+    auto values_desc = TensorDesc({0}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto indices_desc = TensorDesc({0}, ACL_INT64, ACL_FORMAT_ND);
+
+    auto ut = OP_API_UT(aclnnSegmentSort, INPUT(self_desc, offsets_desc, false), OUTPUT(values_desc, indices_desc));
+    uint64_t workspace_size = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspace_size);
+    EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+}
+
+// 空指针
+TEST_F(l2_segment_sort_test, l2_segment_sort_nullptr)
+{
+    auto self_desc = TensorDesc({10}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto values_desc = TensorDesc({10}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto indices_desc = TensorDesc({10}, ACL_INT64, ACL_FORMAT_ND);
+
+    auto ut = OP_API_UT(aclnnSegmentSort, INPUT(self_desc, (aclTensor*)nullptr, false),
+                        OUTPUT(values_desc, indices_desc));
+    uint64_t workspace_size = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspace_size);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_NULLPTR);
+}
+
+// 不支持的数据类型
+TEST_F(l2_segment_sort_test, l2_segment_sort_dtype_invalid)
+{
+    auto self_desc = TensorDesc({10}, ACL_BOOL, ACL_FORMAT_ND);
+    auto offsets_desc = TensorDesc({2}, ACL_INT64, ACL_FORMAT_ND).Value(vector<int64_t>{0, 10});
+    auto values_desc = TensorDesc({10}, ACL_BOOL, ACL_FORMAT_ND);
+    auto indices_desc = TensorDesc({10}, ACL_INT64, ACL_FORMAT_ND);
+
+    auto ut = OP_API_UT(aclnnSegmentSort, INPUT(self_desc, offsets_desc, false), OUTPUT(values_desc, indices_desc));
+    uint64_t workspace_size = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspace_size);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+}
+
+// values与self数据类型不一致
+TEST_F(l2_segment_sort_test, l2_segment_sort_values_dtype_mismatch)
+{
+    auto self_desc = TensorDesc({10}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto offsets_desc = TensorDesc({2}, ACL_INT64, ACL_FORMAT_ND).Value(vector<int64_t>{0, 10});
+    auto values_desc = TensorDesc({10}, ACL_FLOAT16, ACL_FORMAT_ND);
+    auto indices_desc = TensorDesc({10}, ACL_INT64, ACL_FORMAT_ND);
+
+    auto ut = OP_API_UT(aclnnSegmentSort, INPUT(self_desc, offsets_desc, false), OUTPUT(values_desc, indices_desc));
+    uint64_t workspace_size = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspace_size);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+}
+
+// indices不为INT64
+TEST_F(l2_segment_sort_test, l2_segment_sort_indices_dtype_invalid)
+{
+    auto self_desc = TensorDesc({10}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto offsets_desc = TensorDesc({2}, ACL_INT64, ACL_FORMAT_ND).Value(vector<int64_t>{0, 10});
+    auto values_desc = TensorDesc({10}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto indices_desc = TensorDesc({10}, ACL_INT32, ACL_FORMAT_ND);
+
+    auto ut = OP_API_UT(aclnnSegmentSort, INPUT(self_desc, offsets_desc, false), OUTPUT(values_desc, indices_desc));
+    uint64_t workspace_size = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspace_size);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+}
+
+// self不为1维
+TEST_F(l2_segment_sort_test, l2_segment_sort_self_not_1d)
+{
+    auto self_desc = TensorDesc({2, 5}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto offsets_desc = TensorDesc({2}, ACL_INT64, ACL_FORMAT_ND).Value(vector<int64_t>{0, 10});
+    auto values_desc = TensorDesc({2, 5}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto indices_desc = TensorDesc({2, 5}, ACL_INT64, ACL_FORMAT_ND);
+
+    auto ut = OP_API_UT(aclnnSegmentSort, INPUT(self_desc, offsets_desc, false), OUTPUT(values_desc, indices_desc));
+    uint64_t workspace_size = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspace_size);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+}
+
+// offsets为空
+TEST_F(l2_segment_sort_test, l2_segment_sort_offsets_empty)
+{
+    auto self_desc = TensorDesc({10}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto offsets_desc = TensorDesc({0}, ACL_INT64, ACL_FORMAT_ND);
+    auto values_desc = TensorDesc({10}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto indices_desc = TensorDesc({10}, ACL_INT64, ACL_FORMAT_ND);
+
+    auto ut = OP_API_UT(aclnnSegmentSort, INPUT(self_desc, offsets_desc, false), OUTPUT(values_desc, indices_desc));
+    uint64_t workspace_size = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspace_size);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+}
+
+// 输出shape与self不一致
+TEST_F(l2_segment_sort_test, l2_segment_sort_out_shape_mismatch)
+{
+    auto self_desc = TensorDesc({10}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto offsets_desc = TensorDesc({2}, ACL_INT64, ACL_FORMAT_ND).Value(vector<int64_t>{0, 10});
+    auto values_desc = TensorDesc({10}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto indices_desc = TensorDesc({8}, ACL_INT64, ACL_FORMAT_ND);
+
+    auto ut = OP_API_UT(aclnnSegmentSort, INPUT(self_desc, offsets_desc, false), OUTPUT(values_desc, indices_desc));
+    uint64_t workspace_size = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspace_size);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+}
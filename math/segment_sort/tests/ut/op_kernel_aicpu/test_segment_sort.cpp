@@ -0,0 +1,278 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "gtest/gtest.h"
+#include "utils/aicpu_test_utils.h"
+#include "cpu_kernel_utils.h"
+#include "node_def_builder.h"
+#include "Eigen/Core"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using namespace std;
+using namespace aicpu;
+
+class TEST_SEGMENT_SORT_UT : public testing::Test {};
+
+namespace {
+template <typename T>
+double ToDouble(T v)
+{
+    return static_cast<double>(v);
+}
+template <>
+double ToDouble(Eigen::half v)
+{
+    return static_cast<double>(static_cast<float>(v));
+}
+template <>
+double ToDouble(Eigen::bfloat16 v)
+{
+    return static_cast<double>(static_cast<float>(v));
+}
+
+#define CREATE_NODEDEF(node_def, shapes, data_types, datas, descending)   \
+    NodeDefBuilder(node_def.get(), "SegmentSort", "SegmentSort")         \
+        .Input({"x", data_types[0], shapes[0], datas[0]})                \
+        .Input({"offsets", data_types[1], shapes[1], datas[1]})          \
+        .Output({"y", data_types[2], shapes[2], datas[2]})               \
+        .Output({"indices", data_types[3], shapes[3], datas[3]})         \
+        .Attr("descending", (bool)(descending))
+
+// Stable sort of every segment on doubles, NaN after every number (before it when descending).
+template <typename T>
+void ReferenceSort(const vector<T>& x, const vector<int64_t>& offsets, bool descending, vector<int64_t>& indices)
+{
+    indices.assign(x.size(), 0);
+    for (size_t s = 0; s + 1 < offsets.size(); s++) {
+        const int64_t base = offsets[s];
+        vector<int64_t> order(offsets[s + 1] - base);
+        iota(order.begin(), order.end(), 0);
+        auto rank = [&](int64_t i) {
+            const double w = ToDouble(x[base + i]);
+            return make_pair(std::isnan(w) ? 1 : 0, std::isnan(w) ? 0.0 : w);
+        };
+        stable_sort(order.begin(), order.end(),
+                    [&](int64_t a, int64_t b) { return descending ? rank(b) < rank(a) : rank(a) < rank(b); });
+        copy(order.begin(), order.end(), indices.begin() + base);
+    }
+}
+
+template <typename T>
+void RunAndCheck(const vector<T>& x, const vector<int64_t>& offsets, bool descending, DataType data_type)
+{
+    const int64_t num = static_cast<int64_t>(x.size());
+    vector<T> y(num);
+    vector<int64_t> indices(num, -1);
+    vector<DataType> data_types = {data_type, DT_INT64, data_type, DT_INT64};
+    vector<vector<int64_t>> shapes = {{num}, {static_cast<int64_t>(offsets.size())}, {num}, {num}};
+    vector<void*> datas = {(void*)x.data(), (void*)offsets.data(), (void*)y.data(), (void*)indices.data()};
+    auto node_def = CpuKernelUtils::CreateNodeDef();
+    CREATE_NODEDEF(node_def, shapes, data_types, datas, descending);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+    vector<int64_t> expect;
+    ReferenceSort(x, offsets, descending, expect);
+    for (size_t s = 0; s + 1 < offsets.size(); s++) {
+        for (int64_t i = offsets[s]; i < offsets[s + 1]; i++) {
+            ASSERT_EQ(indices[i], expect[i]) << "segment " << s << " position " << i - offsets[s];
+            const T ref = x[offsets[s] + expect[i]];
+            ASSERT_EQ(memcmp(&y[i], &ref, sizeof(T)), 0) << "segment " << s << " position " << i - offsets[s];
+        }
+    }
+}
+
+// Segment lengths covering the insertion, merge and single core radix paths, plus empty segments.
+vector<int64_t> MixedOffsets(int64_t segments, uint32_t seed)
+{
+    mt19937 gen(seed);
+    const int64_t lens[] = {0, 1, 2, 7, 16, 17, 100, 256, 257, 1000, 5000};
+    vector<int64_t> offsets = {0};
+    for (int64_t s = 0; s < segments; s++) {
+        offsets.push_back(offsets.back() + lens[gen() % (sizeof(lens) / sizeof(lens[0]))]);
+    }
+    return offsets;
+}
+} // namespace
+
+TEST_F(TEST_SEGMENT_SORT_UT, FLOAT_SMALL_SUCCESS)
+{
+    vector<float> x = {3.0f, 1.0f, 2.0f, 1.0f, 5.0f, -1.0f, 4.0f, 4.0f, -2.0f};
+    vector<int32_t> offsets = {0, 4, 4, 5, 9};
+    vector<float> y(9);
+    vector<int64_t> indices(9);
+    vector<DataType> data_types = {DT_FLOAT, DT_INT32, DT_FLOAT, DT_INT64};
+    vector<vector<int64_t>> shapes = {{9}, {5}, {9}, {9}};
+    vector<void*> datas = {(void*)x.data(), (void*)offsets.data(), (void*)y.data(), (void*)indices.data()};
+    auto node_def = CpuKernelUtils::CreateNodeDef();
+    CREATE_NODEDEF(node_def, shapes, data_types, datas, false);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+    vector<float> expect_y = {1.0f, 1.0f, 2.0f, 3.0f, 5.0f, -2.0f, -1.0f, 4.0f, 4.0f};
+    vector<int64_t> expect_indices = {1, 3, 2, 0, 0, 3, 0, 1, 2};
+    EXPECT_EQ(y, expect_y);
+    EXPECT_EQ(indices, expect_indices);
+}
+
+TEST_F(TEST_SEGMENT_SORT_UT, FLOAT_NAN_ZERO_SUCCESS)
+{
+    const float nan = numeric_limits<float>::quiet_NaN();
+    const float inf = numeric_limits<float>::infinity();
+    vector<float> x = {nan, 0.0f, -0.0f, inf, -inf, nan, 1.0f, -0.0f, 0.0f, 2.0f};
+    vector<int64_t> offsets = {0, 10};
+    RunAndCheck(x, offsets, false, DT_FLOAT);
+    RunAndCheck(x, offsets, true, DT_FLOAT);
+}
+
+TEST_F(TEST_SEGMENT_SORT_UT, FLOAT_MIXED_LENGTHS_SUCCESS)
+{
+    auto offsets = MixedOffsets(200, 1);
+    vector<float> x(offsets.back());
+    SetRandomValue<float>(x.data(), x.size(), -100.0, 100.0);
+    for (size_t i = 0; i < x.size(); i += 5) {
+        x[i] = roundf(x[i]);
+    }
+    RunAndCheck(x, offsets, false, DT_FLOAT);
+    RunAndCheck(x, offsets, true, DT_FLOAT);
+}
+
+TEST_F(TEST_SEGMENT_SORT_UT, FLOAT16_DUPLICATES_SUCCESS)
+{
+    auto offsets = MixedOffsets(60, 2);
+    vector<Eigen::half> x(offsets.back());
+    mt19937 gen(3);
+    for (auto& v : x) {
+        v = Eigen::half(static_cast<float>(static_cast<int>(gen() % 41) - 20) * 0.25f);
+    }
+    RunAndCheck(x, offsets, false, DT_FLOAT16);
+    RunAndCheck(x, offsets, true, DT_FLOAT16);
+}
+
+TEST_F(TEST_SEGMENT_SORT_UT, BFLOAT16_SUCCESS)
+{
+    auto offsets = MixedOffsets(40, 4);
+    vector<float> xf(offsets.back());
+    SetRandomValue<float>(xf.data(), xf.size(), -8.0, 8.0);
+    vector<Eigen::bfloat16> x(xf.size());
+    for (size_t i = 0; i < xf.size(); i++) {
+        x[i] = Eigen::bfloat16(xf[i]);
+    }
+    RunAndCheck(x, offsets, false, DT_BFLOAT16);
+}
+
+TEST_F(TEST_SEGMENT_SORT_UT, DOUBLE_SUCCESS)
+{
+    auto offsets = MixedOffsets(40, 5);
+    vector<double> x(offsets.back());
+    SetRandomValue<double>(x.data(), x.size(), -1e6, 1e6);
+    RunAndCheck(x, offsets, true, DT_DOUBLE);
+}
+
+TEST_F(TEST_SEGMENT_SORT_UT, INT_TYPES_SUCCESS)
+{
+    auto offsets = MixedOffsets(50, 6);
+    const size_t num = offsets.back();
+    mt19937 gen(7);
+    vector<int8_t> x8(num);
+    vector<uint8_t> xu8(num);
+    vector<int16_t> x16(num);
+    vector<int32_t> x32(num);
+    vector<int64_t> x64(num);
+    for (size_t i = 0; i < num; i++) {
+        const uint32_t r = gen();
+        x8[i] = static_cast<int8_t>(r);
+        xu8[i] = static_cast<uint8_t>(r >> 8);
+        x16[i] = static_cast<int16_t>(r);
+        x32[i] = static_cast<int32_t>(r % 1000) - 500;
+        x64[i] = (static_cast<int64_t>(r) << 20) * ((i % 2 == 0) ? 1 : -1);
+    }
+    RunAndCheck(x8, offsets, false, DT_INT8);
+    RunAndCheck(xu8, offsets, true, DT_UINT8);
+    RunAndCheck(x16, offsets, false, DT_INT16);
+    RunAndCheck(x32, offsets, true, DT_INT32);
+    RunAndCheck(x64, offsets, false, DT_INT64);
+}
+
+TEST_F(TEST_SEGMENT_SORT_UT, FLOAT_HUGE_SEGMENT_SUCCESS)
+{
+    vector<int64_t> offsets = {0, 3, 300 * 1024 + 3, 300 * 1024 + 1003, 300 * 1024 + 1003};
+    vector<float> x(offsets.back());
+    SetRandomValue<float>(x.data(), x.size(), -1000.0, 1000.0);
+    for (size_t i = 0; i < x.size(); i += 3) {
+        x[i] = roundf(x[i]);
+    }
+    RunAndCheck(x, offsets, false, DT_FLOAT);
+    RunAndCheck(x, offsets, true, DT_FLOAT);
+}
+
+TEST_F(TEST_SEGMENT_SORT_UT, INT32_HUGE_SEGMENTS_SUCCESS)
+{
+    vector<int64_t> offsets = {0, 262144, 262144 + 5000, 2 * 262144 + 5000};
+    vector<int32_t> x(offsets.back());
+    mt19937 gen(8);
+    for (auto& v : x) {
+        v = static_cast<int32_t>(gen() % 3000);
+    }
+    RunAndCheck(x, offsets, false, DT_INT32);
+}
+
+TEST_F(TEST_SEGMENT_SORT_UT, EMPTY_INPUT_SUCCESS)
+{
+    vector<float> x;
+    vector<int64_t> offsets = {0, 0, 0};
+    RunAndCheck(x, offsets, false, DT_FLOAT);
+}
+
+TEST_F(TEST_SEGMENT_SORT_UT, OFFSETS_NOT_MONOTONIC_FAILED)
+{
+    vector<float> x(6, 1.0f);
+    vector<int64_t> offsets = {0, 4, 2, 6};
+    vector<float> y(6);
+    vector<int64_t> indices(6);
+    vector<DataType> data_types = {DT_FLOAT, DT_INT64, DT_FLOAT, DT_INT64};
+    vector<vector<int64_t>> shapes = {{6}, {4}, {6}, {6}};
+    vector<void*> datas = {(void*)x.data(), (void*)offsets.data(), (void*)y.data(), (void*)indices.data()};
+    auto node_def = CpuKernelUtils::CreateNodeDef();
+    CREATE_NODEDEF(node_def, shapes, data_types, datas, false);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
+}
+
+TEST_F(TEST_SEGMENT_SORT_UT, OFFSETS_LAST_MISMATCH_FAILED)
+{
+    vector<float> x(6, 1.0f);
+    vector<int32_t> offsets = {0, 2, 5};
+    vector<float> y(6);
+    vector<int64_t> indices(6);
+    vector<DataType> data_types = {DT_FLOAT, DT_INT32, DT_FLOAT, DT_INT64};
+    vector<vector<int64_t>> shapes = {{6}, {3}, {6}, {6}};
+    vector<void*> datas = {(void*)x.data(), (void*)offsets.data(), (void*)y.data(), (void*)indices.data()};
+    auto node_def = CpuKernelUtils::CreateNodeDef();
+    CREATE_NODEDEF(node_def, shapes, data_types, datas, false);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
+}
+
+TEST_F(TEST_SEGMENT_SORT_UT, INDICES_TYPE_FAILED)
+{
+    vector<float> x(4, 1.0f);
+    vector<int64_t> offsets = {0, 4};
+    vector<float> y(4);
+    vector<int32_t> indices(4);
+    vector<DataType> data_types = {DT_FLOAT, DT_INT64, DT_FLOAT, DT_INT32};
+    vector<vector<int64_t>> shapes = {{4}, {2}, {4}, {4}};
+    vector<void*> datas = {(void*)x.data(), (void*)offsets.data(), (void*)y.data(), (void*)indices.data()};
+    auto node_def = CpuKernelUtils::CreateNodeDef();
+    CREATE_NODEDEF(node_def, shapes, data_types, datas, false);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
+}
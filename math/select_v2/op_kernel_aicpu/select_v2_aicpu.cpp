@@ -11,37 +11,138 @@
 #include "select_v2_aicpu.h"
 
 #include <algorithm>
-#include <unordered_set>
 
 #include "cpu_kernel_utils.h"
-#include "utils/eigen_tensor.h"
 
 namespace {
 const char* const kSelectV2 = "SelectV2";
 const uint32_t kInputNum = 3;
 const int64_t kNoBroadcastValue = 1;
-const int64_t kNoRepeatElements = 2;
+const int64_t kSelectV2ParallelElements = 32 * 1024;
+const int64_t kSelectV2MinShardElements = 8 * 1024;
 
-#define SELECTV2_COMPUTE_CASE(DTYPE, TYPE)                 \
-  case (DTYPE): {                                          \
-    KernelStatus result = Selectv2BuildBcast<TYPE>(ctx);   \
-    if (result != KERNEL_STATUS_OK) {                      \
-      KERNEL_LOG_ERROR("SelectV2 kernel compute failed."); \
-      return static_cast<uint32_t>(result);                \
-    }                                                      \
-    break;                                                 \
+// complex128 element, moved as two 64 bit words.
+struct SelectV2Word128 {
+  uint64_t lo;
+  uint64_t hi;
+};
+
+template <typename W>
+inline W SelectV2Blend(uint8_t cond, W then_value, W else_value) {
+  const W mask = static_cast<W>(static_cast<W>(0) - static_cast<W>(cond != 0));
+  return static_cast<W>((then_value & mask) | (else_value & static_cast<W>(~mask)));
+}
+
+template <>
+inline SelectV2Word128 SelectV2Blend(uint8_t cond, SelectV2Word128 then_value,
+                                     SelectV2Word128 else_value) {
+  const uint64_t mask = static_cast<uint64_t>(0) - static_cast<uint64_t>(cond != 0);
+  return {(then_value.lo & mask) | (else_value.lo & ~mask),
+          (then_value.hi & mask) | (else_value.hi & ~mask)};
+}
+
+// One innermost run of `len` output elements. The stride pattern is loop
+// invariant: a broadcast condition copies or fills from the chosen input, a
+// contiguous one is a branchless blend.
+template <typename W>
+void SelectV2Run(const uint8_t* cond, int64_t cond_step, const W* then_data,
+                 int64_t then_step, const W* else_data, int64_t else_step,
+                 W* out, int64_t len) {
+  if (cond_step == 0) {
+    const bool take_then = (*cond != 0);
+    const W* src = take_then ? then_data : else_data;
+    const int64_t step = take_then ? then_step : else_step;
+    if (step == 1) {
+      std::copy_n(src, len, out);
+    } else if (step == 0) {
+      std::fill_n(out, len, *src);
+    } else {
+      for (int64_t i = 0; i < len; ++i) {
+        out[i] = src[i * step];
+      }
+    }
+    return;
+  }
+  if (cond_step == 1 && then_step == 1 && else_step == 1) {
+    for (int64_t i = 0; i < len; ++i) {
+      out[i] = SelectV2Blend(cond[i], then_data[i], else_data[i]);
+    }
+    return;
+  }
+  for (int64_t i = 0; i < len; ++i) {
+    out[i] = (cond[i * cond_step] != 0) ? then_data[i * then_step]
+                                        : else_data[i * else_step];
+  }
+}
+
+// Output elements [start, end). The start coordinate is decomposed once,
+// afterwards only carries propagate between runs.
+template <typename W>
+void SelectV2Range(const aicpu::SelectV2Plan& plan, const uint8_t* cond,
+                   const W* then_data, const W* else_data, W* out,
+                   int64_t start, int64_t end) {
+  const size_t ndims = plan.out_shape.size();
+  const size_t inner = ndims - 1;
+  std::vector<int64_t> coords(ndims, 0);
+  int64_t cond_off = 0;
+  int64_t then_off = 0;
+  int64_t else_off = 0;
+  int64_t rem = start;
+  for (size_t d = 0; d < ndims; ++d) {
+    coords[d] = rem / plan.out_strides[d];
+    rem -= coords[d] * plan.out_strides[d];
+    cond_off += coords[d] * plan.cond_strides[d];
+    then_off += coords[d] * plan.then_strides[d];
+    else_off += coords[d] * plan.else_strides[d];
+  }
+
+  int64_t idx = start;
+  while (idx < end) {
+    const int64_t len = std::min(plan.out_shape[inner] - coords[inner], end - idx);
+    SelectV2Run(cond + cond_off, plan.cond_strides[inner], then_data + then_off,
+                plan.then_strides[inner], else_data + else_off,
+                plan.else_strides[inner], out + idx, len);
+    idx += len;
+    coords[inner] += len;
+    cond_off += len * plan.cond_strides[inner];
+    then_off += len * plan.then_strides[inner];
+    else_off += len * plan.else_strides[inner];
+    for (size_t d = inner; d > 0 && coords[d] == plan.out_shape[d]; --d) {
+      cond_off += plan.cond_strides[d - 1] - coords[d] * plan.cond_strides[d];
+      then_off += plan.then_strides[d - 1] - coords[d] * plan.then_strides[d];
+      else_off += plan.else_strides[d - 1] - coords[d] * plan.else_strides[d];
+      coords[d] = 0;
+      coords[d - 1]++;
+    }
   }
+}
 
-#define SELECTV2_DIM_CASE(RANK)                               \
-  case (RANK): {                                              \
-    KernelStatus result =                                     \
-        SelectV2CalculateWithAlignedCheck<RANK, T>(calc_info); \
-    if (result != KERNEL_STATUS_OK) {                         \
-      KERNEL_LOG_ERROR("SelectV2 kernel compute failed.");    \
-      return result;                                          \
-    }                                                         \
-    break;                                                    \
+// Right-aligned dims of `shape` padded to `rank` with 1, and the contiguous
+// strides of those dims with 0 on the dims that broadcast to `out`.
+void SelectV2AlignedStrides(const std::vector<int64_t>& shape,
+                            const std::vector<int64_t>& out,
+                            std::vector<int64_t>& strides) {
+  const size_t rank = out.size();
+  const size_t pad = rank - shape.size();
+  strides.assign(rank, 0);
+  int64_t stride = 1;
+  for (size_t d = rank; d > pad; --d) {
+    const int64_t dim = shape[d - 1 - pad];
+    strides[d - 1] = (dim == out[d - 1]) ? stride : 0;
+    stride *= dim;
   }
+}
+
+// Output dim of three right-aligned input dims, -1 when they can not broadcast.
+int64_t SelectV2BroadcastDim(int64_t x, int64_t y, int64_t z) {
+  const int64_t dim = std::max({x, y, z});
+  for (int64_t value : {x, y, z}) {
+    if (value != dim && value != kNoBroadcastValue) {
+      return -1;
+    }
+  }
+  return dim;
+}
 }  // namespace
 
 namespace aicpu {
@@ -50,31 +151,69 @@ uint32_t Selectv2CpuKernel::Compute(CpuKernelContext& ctx) {
   if (Selectv2ParamCheck(ctx) != KERNEL_STATUS_OK) {
     return static_cast<uint32_t>(KERNEL_STATUS_PARAM_INVALID);
   }
-  // choose compute function depend on dataType
   auto data_type =
       static_cast<DataType>(ctx.Input(kSecondInputIndex)->GetDataType());
   switch (data_type) {
-    SELECTV2_COMPUTE_CASE(DT_FLOAT16, Eigen::half);
-    SELECTV2_COMPUTE_CASE(DT_FLOAT, float);
-    SELECTV2_COMPUTE_CASE(DT_DOUBLE, double);
-    SELECTV2_COMPUTE_CASE(DT_INT8, int8_t);
-    SELECTV2_COMPUTE_CASE(DT_INT16, int16_t);
-    SELECTV2_COMPUTE_CASE(DT_INT32, int32_t);
-    SELECTV2_COMPUTE_CASE(DT_INT64, int64_t);
-    SELECTV2_COMPUTE_CASE(DT_UINT8, uint8_t);
-    SELECTV2_COMPUTE_CASE(DT_UINT16, uint16_t);
-    SELECTV2_COMPUTE_CASE(DT_UINT32, uint32_t);
-    SELECTV2_COMPUTE_CASE(DT_UINT64, uint64_t);
-    SELECTV2_COMPUTE_CASE(DT_COMPLEX64, std::complex<float>);
-    SELECTV2_COMPUTE_CASE(DT_COMPLEX128, std::complex<double>);
-    SELECTV2_COMPUTE_CASE(DT_BOOL, bool);
+    case DT_FLOAT16:
+    case DT_FLOAT:
+    case DT_DOUBLE:
+    case DT_INT8:
+    case DT_INT16:
+    case DT_INT32:
+    case DT_INT64:
+    case DT_UINT8:
+    case DT_UINT16:
+    case DT_UINT32:
+    case DT_UINT64:
+    case DT_COMPLEX64:
+    case DT_COMPLEX128:
+    case DT_BOOL:
+      break;
     default:
       KERNEL_LOG_ERROR(
           "[%s] Data type of input is not support, input data type is [%s].",
           ctx.GetOpType().c_str(), DTypeStr(data_type).c_str());
       return static_cast<uint32_t>(KERNEL_STATUS_PARAM_INVALID);
   }
-  return static_cast<uint32_t>(KERNEL_STATUS_OK);
+
+  for (uint32_t i = 0; i < kInputNum; ++i) {
+    if (ctx.Input(i)->GetDataSize() == 0) {
+      KERNEL_LOG_WARN("SelectV2 kernel input tensor is empty.");
+      return static_cast<uint32_t>(KERNEL_STATUS_OK);
+    }
+  }
+  SelectV2Plan plan;
+  if (SelectV2BuildPlan(ctx, plan) != KERNEL_STATUS_OK) {
+    KERNEL_LOG_ERROR("[%s] Generate broadcast info failed.", kSelectV2);
+    return static_cast<uint32_t>(KERNEL_STATUS_PARAM_INVALID);
+  }
+
+  uint32_t result = KERNEL_STATUS_OK;
+  switch (GetSizeByDataType(data_type)) {
+    case sizeof(uint8_t):
+      result = SelectV2Compute<uint8_t>(ctx, plan);
+      break;
+    case sizeof(uint16_t):
+      result = SelectV2Compute<uint16_t>(ctx, plan);
+      break;
+    case sizeof(uint32_t):
+      result = SelectV2Compute<uint32_t>(ctx, plan);
+      break;
+    case sizeof(uint64_t):
+      result = SelectV2Compute<uint64_t>(ctx, plan);
+      break;
+    case sizeof(SelectV2Word128):
+      result = SelectV2Compute<SelectV2Word128>(ctx, plan);
+      break;
+    default:
+      KERNEL_LOG_ERROR("[%s] Data type [%s] has unexpected size.",
+                       ctx.GetOpType().c_str(), DTypeStr(data_type).c_str());
+      return static_cast<uint32_t>(KERNEL_STATUS_PARAM_INVALID);
+  }
+  if (result != KERNEL_STATUS_OK) {
+    KERNEL_LOG_ERROR("SelectV2 kernel compute failed.");
+  }
+  return result;
 }
 
 KernelStatus Selectv2CpuKernel::Selectv2ParamCheck(
@@ -122,224 +261,126 @@ KernelStatus Selectv2CpuKernel::Selectv2ParamCheck(
   return KERNEL_STATUS_OK;
 }
 
-template <typename T>
-KernelStatus Selectv2CpuKernel::Selectv2BuildBcast(
-    const CpuKernelContext& ctx) {
-  Tensor* input_0 = ctx.Input(kFirstInputIndex);
-  Tensor* input_1 = ctx.Input(kSecondInputIndex);
-  Tensor* input_2 = ctx.Input(kThirdInputIndex);
-  Tensor* output = ctx.Output(kFirstOutputIndex);
-
-  if (input_0->GetDataSize() == 0 || input_1->GetDataSize() == 0 ||
-      input_2->GetDataSize() == 0) {
-    KERNEL_LOG_WARN("SelectV2 kernel input tensor is empty.");
-    return KERNEL_STATUS_OK;
-  }
-
-  KERNEL_LOG_DEBUG(
-      "Selectv2CpuKernel[%s], input0: size[%lu];"
-      "input1: size[%lu], input2: size[%lu], output: size[%lu].",
-      ctx.GetOpType().c_str(), input_0->GetDataSize(), input_1->GetDataSize(),
-      input_2->GetDataSize(), output->GetDataSize());
-
-  SelectV2BCalcInfo calc_info;
-  calc_info.input_0 = input_0;
-  calc_info.input_1 = input_1;
-  calc_info.input_2 = input_2;
-  calc_info.output = output;
-
-  // broadcast input
-  if (Selectv2GenerateBcastInfo(calc_info) != KERNEL_STATUS_OK) {
-    KERNEL_LOG_ERROR("[%s] Generate broadcast info failed.", kSelectV2);
-    return KERNEL_STATUS_PARAM_INVALID;
-  }
-  SelectV2GetBcastVec(calc_info);
-  int32_t rank = static_cast<int32_t>(calc_info.shape_out.size());
-  switch (rank) {
-    case SCALAR: {
-      bool v0 = *(reinterpret_cast<const bool*>(calc_info.input_0->GetData()));
-      T v1 = *(reinterpret_cast<const T*>(calc_info.input_1->GetData()));
-      T v2 = *(reinterpret_cast<const T*>(calc_info.input_2->GetData()));
-      T* value_out = reinterpret_cast<T*>(calc_info.output->GetData());
-      *(value_out) = (v0 == true) ? v1 : v2;
-      return KERNEL_STATUS_OK;
-    }
-    SELECTV2_DIM_CASE(ONE_DIM);
-    SELECTV2_DIM_CASE(TWO_DIM);
-    SELECTV2_DIM_CASE(THREE_DIM);
-    SELECTV2_DIM_CASE(FOUR_DIM);
-    SELECTV2_DIM_CASE(FIVE_DIM);
-    SELECTV2_DIM_CASE(SIX_DIM);
-    SELECTV2_DIM_CASE(SEVEN_DIM);
-    SELECTV2_DIM_CASE(EIGHT_DIM);
-    default:
-      KERNEL_LOG_ERROR("[%s] Rank of output should less than 9 but get [%zu].",
-                       ctx.GetOpType().c_str(), calc_info.shape_out.size());
-      return KERNEL_STATUS_PARAM_INVALID;
-  }
-  return KERNEL_STATUS_OK;
-}
-
-template <int32_t RANK, typename T>
-KernelStatus Selectv2CpuKernel::SelectV2CalculateWithAlignedCheck(
-    SelectV2BCalcInfo& calc_info) {
-  if (AlignedCheck(calc_info)) {
-    return SelectV2Calculate<RANK, T, Eigen::Aligned>(calc_info);
-  }
-  return SelectV2Calculate<RANK, T, Eigen::Unaligned>(calc_info);
-}
-
-bool Selectv2CpuKernel::AlignedCheck(const SelectV2BCalcInfo& calc_info) const {
-  return AddrAlignedCheck(calc_info.input_0->GetData()) &&
-         AddrAlignedCheck(calc_info.input_1->GetData()) &&
-         AddrAlignedCheck(calc_info.input_2->GetData()) &&
-         AddrAlignedCheck(calc_info.output->GetData());
-}
-
-template <int32_t RANK, typename T, int32_t OPTION>
-KernelStatus Selectv2CpuKernel::SelectV2Calculate(SelectV2BCalcInfo& calc_info) {
-  Eigen::TensorMap<Eigen::Tensor<bool, 1>, OPTION> input0(
-      static_cast<bool*>(calc_info.input_0->GetData()),
-      calc_info.input_0->GetTensorShape()->NumElements());
-  Eigen::TensorMap<Eigen::Tensor<T, 1>, OPTION> input1(
-      static_cast<T*>(calc_info.input_1->GetData()),
-      calc_info.input_1->GetTensorShape()->NumElements());
-  Eigen::TensorMap<Eigen::Tensor<T, 1>, OPTION> input2(
-      static_cast<T*>(calc_info.input_2->GetData()),
-      calc_info.input_2->GetTensorShape()->NumElements());
-  Eigen::TensorMap<Eigen::Tensor<T, 1>, OPTION> output(
-      static_cast<T*>(calc_info.output->GetData()),
-      calc_info.output->GetTensorShape()->NumElements());
-
-  Eigen::DSizes<Eigen::DenseIndex, RANK> reshape0;
-  Eigen::DSizes<Eigen::DenseIndex, RANK> reshape1;
-  Eigen::DSizes<Eigen::DenseIndex, RANK> reshape2;
-  Eigen::DSizes<Eigen::DenseIndex, RANK> shape_out;
-  Eigen::array<Eigen::DenseIndex, RANK> bcast0;
-  Eigen::array<Eigen::DenseIndex, RANK> bcast1;
-  Eigen::array<Eigen::DenseIndex, RANK> bcast2;
-
-  for (size_t i = 0; i < static_cast<size_t>(RANK); ++i) {
-    size_t index = (static_cast<size_t>(RANK) - i) - 1UL;
-    reshape0[index] = calc_info.reshape_0[i];
-    reshape1[index] = calc_info.reshape_1[i];
-    reshape2[index] = calc_info.reshape_2[i];
-    shape_out[index] = calc_info.shape_out[i];
-    bcast0[index] = calc_info.bcast_0[i];
-    bcast1[index] = calc_info.bcast_1[i];
-    bcast2[index] = calc_info.bcast_2[i];
-  }
-
-  output.reshape(shape_out) = input0.reshape(reshape0).broadcast(bcast0).select(
-      input1.reshape(reshape1).broadcast(bcast1),
-      input2.reshape(reshape2).broadcast(bcast2));
-  return KERNEL_STATUS_OK;
-}
-
-KernelStatus Selectv2CpuKernel::Selectv2GenerateBcastInfo(
-    const SelectV2BCalcInfo& calc_info) {
-  x_reshape_ = calc_info.input_0->GetTensorShape()->GetDimSizes();
-  y_reshape_ = calc_info.input_1->GetTensorShape()->GetDimSizes();
-  z_reshape_ = calc_info.input_2->GetTensorShape()->GetDimSizes();
-  shape_out_ = calc_info.output->GetTensorShape()->GetDimSizes();
-
-  std::reverse(x_reshape_.begin(), x_reshape_.end());
-  std::reverse(y_reshape_.begin(), y_reshape_.end());
-  std::reverse(z_reshape_.begin(), z_reshape_.end());
-
-  size_t dim_num_x = x_reshape_.size();
-  size_t dim_num_y = y_reshape_.size();
-  size_t dim_num_z = z_reshape_.size();
-
-  size_t max_size = std::max({dim_num_x, dim_num_y, dim_num_z});
-  if (dim_num_x != max_size) {
-    x_reshape_.resize(max_size, kNoBroadcastValue);
-  }
-  if (dim_num_y != max_size) {
-    y_reshape_.resize(max_size, kNoBroadcastValue);
-  }
-  if (dim_num_z != max_size) {
-    z_reshape_.resize(max_size, kNoBroadcastValue);
-  }
-  std::reverse(x_reshape_.begin(), x_reshape_.end());
-  std::reverse(y_reshape_.begin(), y_reshape_.end());
-  std::reverse(z_reshape_.begin(), z_reshape_.end());
+KernelStatus Selectv2CpuKernel::SelectV2BuildPlan(const CpuKernelContext& ctx,
+                                                  SelectV2Plan& plan) const {
+  const std::vector<int64_t> cond_shape =
+      ctx.Input(kFirstInputIndex)->GetTensorShape()->GetDimSizes();
+  const std::vector<int64_t> then_shape =
+      ctx.Input(kSecondInputIndex)->GetTensorShape()->GetDimSizes();
+  const std::vector<int64_t> else_shape =
+      ctx.Input(kThirdInputIndex)->GetTensorShape()->GetDimSizes();
+  const std::vector<int64_t> shape_out =
+      ctx.Output(kFirstOutputIndex)->GetTensorShape()->GetDimSizes();
+  const size_t rank = std::max({cond_shape.size(), then_shape.size(), else_shape.size()});
   // Check if shape match
-  if (shape_out_.size() != max_size) {
-    KERNEL_LOG_ERROR("shape mismatch, max_dim_in=%zu, dim_out=%zu.", max_size,
-                     shape_out_.size());
+  if (shape_out.size() != rank) {
+    KERNEL_LOG_ERROR("shape mismatch, max_dim_in=%zu, dim_out=%zu.", rank,
+                     shape_out.size());
     return KERNEL_STATUS_PARAM_INVALID;
   }
-  for (size_t i = 0; i < max_size; ++i) {
-    if (shape_out_[i] !=
-        std::max({x_reshape_[i], y_reshape_[i], z_reshape_[i]})) {
+  auto aligned_dim = [rank](const std::vector<int64_t>& shape, size_t d) {
+    const size_t pad = rank - shape.size();
+    return (d < pad) ? kNoBroadcastValue : shape[d - pad];
+  };
+  for (size_t d = 0; d < rank; ++d) {
+    const int64_t dim_x = aligned_dim(cond_shape, d);
+    const int64_t dim_y = aligned_dim(then_shape, d);
+    const int64_t dim_z = aligned_dim(else_shape, d);
+    if (SelectV2BroadcastDim(dim_x, dim_y, dim_z) != shape_out[d]) {
       KERNEL_LOG_ERROR(
-          "shape mismatch, index=%zu, dim_x=%ld, dim_y=%ld, dim_z=%ld"
+          "shape mismatch, index=%zu, dim_x=%ld, dim_y=%ld, dim_z=%ld, "
           "dim_out=%ld.",
-          i, x_reshape_[i], y_reshape_[i], z_reshape_[i], shape_out_[i]);
+          d, dim_x, dim_y, dim_z, shape_out[d]);
       return KERNEL_STATUS_PARAM_INVALID;
     }
   }
 
-  // genarate broarcast info
-  if (SelectV2BcastInfo(max_size) != KERNEL_STATUS_OK) {
-    KERNEL_LOG_ERROR("SelectV2 genarate broarcast info failed.");
-    return KERNEL_STATUS_PARAM_INVALID;
+  std::vector<int64_t> cond_strides;
+  std::vector<int64_t> then_strides;
+  std::vector<int64_t> else_strides;
+  SelectV2AlignedStrides(cond_shape, shape_out, cond_strides);
+  SelectV2AlignedStrides(then_shape, shape_out, then_strides);
+  SelectV2AlignedStrides(else_shape, shape_out, else_strides);
+  // A single condition value reads only one of the inputs; planning the other
+  // with the same strides keeps it from blocking the collapse, so the whole
+  // output becomes one copy when the chosen input is not broadcast.
+  if (ctx.Input(kFirstInputIndex)->NumElements() == 1) {
+    const bool take_then =
+        (*static_cast<const uint8_t*>(ctx.Input(kFirstInputIndex)->GetData()) != 0);
+    if (take_then) {
+      else_strides = then_strides;
+    } else {
+      then_strides = else_strides;
+    }
   }
-  return KERNEL_STATUS_OK;
-}
 
-KernelStatus Selectv2CpuKernel::SelectV2BcastInfo(size_t max_size) {
-  // genarate broarcast info
-  x_bcast_.resize(max_size, kNoBroadcastValue);
-  y_bcast_.resize(max_size, kNoBroadcastValue);
-  z_bcast_.resize(max_size, kNoBroadcastValue);
-  for (size_t i = 0; i < max_size; ++i) {
-    // no need broadcast
-    if ((x_reshape_[i] == y_reshape_[i]) && (y_reshape_[i] == z_reshape_[i])) {
+  plan = SelectV2Plan();
+  plan.total_elements = 1;
+  for (size_t d = 0; d < rank; ++d) {
+    plan.total_elements *= shape_out[d];
+    if (shape_out[d] == 1) {
       continue;
     }
-
-    if (SelectV2BcastCheck(x_reshape_[i], y_reshape_[i], z_reshape_[i]) !=
-        KERNEL_STATUS_OK) {
-      KERNEL_LOG_ERROR("Broadcast not support, dim_x[%zu]=%ld, dim_y[%zu]=%ld.",
-                       i, x_reshape_[i], i, y_reshape_[i]);
-      return KERNEL_STATUS_PARAM_INVALID;
-    }
-    if (x_reshape_[i] == kNoBroadcastValue) {
-      x_bcast_[i] = std::max(y_reshape_[i], z_reshape_[i]);
-    }
-    if (y_reshape_[i] == kNoBroadcastValue) {
-      y_bcast_[i] = std::max(x_reshape_[i], z_reshape_[i]);
-    }
-    if (z_reshape_[i] == kNoBroadcastValue) {
-      z_bcast_[i] = std::max(x_reshape_[i], y_reshape_[i]);
+    if (!plan.out_shape.empty()) {
+      const size_t last = plan.out_shape.size() - 1;
+      if (plan.cond_strides[last] == cond_strides[d] * shape_out[d] &&
+          plan.then_strides[last] == then_strides[d] * shape_out[d] &&
+          plan.else_strides[last] == else_strides[d] * shape_out[d]) {
+        plan.out_shape[last] *= shape_out[d];
+        plan.cond_strides[last] = cond_strides[d];
+        plan.then_strides[last] = then_strides[d];
+        plan.else_strides[last] = else_strides[d];
+        continue;
+      }
     }
+    plan.out_shape.push_back(shape_out[d]);
+    plan.cond_strides.push_back(cond_strides[d]);
+    plan.then_strides.push_back(then_strides[d]);
+    plan.else_strides.push_back(else_strides[d]);
   }
-  return KERNEL_STATUS_OK;
-}
-
-KernelStatus Selectv2CpuKernel::SelectV2BcastCheck(const int64_t x,
-                                                   const int64_t y,
-                                                   const int64_t z) const {
-  std::unordered_set<int64_t> set_tmp{x, y, z};
-  if (set_tmp.size() != kNoRepeatElements) {
-    return KERNEL_STATUS_PARAM_INVALID;
+  if (plan.out_shape.empty()) {
+    plan.out_shape = {1};
+    plan.cond_strides = {0};
+    plan.then_strides = {0};
+    plan.else_strides = {0};
   }
-  if (x != 1 && y != 1 && z != 1) {
-    return KERNEL_STATUS_PARAM_INVALID;
+  plan.out_strides.assign(plan.out_shape.size(), 1);
+  for (size_t d = plan.out_shape.size() - 1; d > 0; --d) {
+    plan.out_strides[d - 1] = plan.out_strides[d] * plan.out_shape[d];
   }
   return KERNEL_STATUS_OK;
 }
 
-void Selectv2CpuKernel::SelectV2GetBcastVec(SelectV2BCalcInfo& calc_info) const {
-  calc_info.reshape_0 = std::move(x_reshape_);
-  calc_info.reshape_1 = std::move(y_reshape_);
-  calc_info.reshape_2 = std::move(z_reshape_);
-  calc_info.shape_out = std::move(shape_out_);
-  calc_info.bcast_0 = std::move(x_bcast_);
-  calc_info.bcast_1 = std::move(y_bcast_);
-  calc_info.bcast_2 = std::move(z_bcast_);
+template <typename W>
+uint32_t Selectv2CpuKernel::SelectV2Compute(const CpuKernelContext& ctx,
+                                            const SelectV2Plan& plan) const {
+  const uint8_t* cond =
+      static_cast<const uint8_t*>(ctx.Input(kFirstInputIndex)->GetData());
+  const W* then_data = static_cast<const W*>(ctx.Input(kSecondInputIndex)->GetData());
+  const W* else_data = static_cast<const W*>(ctx.Input(kThirdInputIndex)->GetData());
+  Tensor* output = ctx.Output(kFirstOutputIndex);
+  W* out = static_cast<W*>(output->GetData());
+  const int64_t total = plan.total_elements;
+  KERNEL_CHECK_FALSE(
+      (output->GetDataSize() >= static_cast<uint64_t>(total) * sizeof(W)),
+      KERNEL_STATUS_PARAM_INVALID,
+      "[%s] Output size [%lu] is less than [%ld] elements of [%zu] bytes.",
+      ctx.GetOpType().c_str(), output->GetDataSize(), total, sizeof(W));
+
+  if (total < kSelectV2ParallelElements) {
+    SelectV2Range(plan, cond, then_data, else_data, out, 0, total);
+    return KERNEL_STATUS_OK;
+  }
+  const int64_t cores = std::max<int64_t>(
+      1, static_cast<int64_t>(CpuKernelUtils::GetCPUNum(ctx)));
+  const int64_t per_unit =
+      std::max((total + cores - 1) / cores, kSelectV2MinShardElements);
+  auto shard = [&](int64_t start, int64_t end) {
+    SelectV2Range(plan, cond, then_data, else_data, out, start, end);
+  };
+  KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, total, per_unit, shard),
+                      "[%s] SelectV2 compute failed.", ctx.GetOpType().c_str())
+  return KERNEL_STATUS_OK;
 }
 REGISTER_CPU_KERNEL(kSelectV2, Selectv2CpuKernel);
-}  // namespace aicpu
\ No newline at end of file
+}  // namespace aicpu
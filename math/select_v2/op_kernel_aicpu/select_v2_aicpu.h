@@ -10,68 +10,41 @@
 #ifndef AICPU_KERNELS_NORMALIZED_SELECTV2_CPU_KERNEL_H
 #define AICPU_KERNELS_NORMALIZED_SELECTV2_CPU_KERNEL_H
 
+#include <vector>
+
 #include "cpu_kernel.h"
 #include "cpu_types.h"
 #include "utils/kernel_util.h"
 
 namespace aicpu {
-struct SelectV2BCalcInfo {
-  SelectV2BCalcInfo()
-      : input_0(nullptr), input_1(nullptr), input_2(nullptr), output(nullptr) {}
-  Tensor *input_0;
-  Tensor *input_1;
-  Tensor *input_2;
-  Tensor *output;
-  std::vector<int64_t> reshape_0;
-  std::vector<int64_t> reshape_1;
-  std::vector<int64_t> reshape_2;
-  std::vector<int64_t> shape_out;
-  std::vector<int64_t> bcast_0;
-  std::vector<int64_t> bcast_1;
-  std::vector<int64_t> bcast_2;
+// Iteration plan of result = condition ? then : else over the broadcast of the three inputs. Output dims of size 1
+// are dropped and adjacent dims are collapsed whenever every input steps through them as one dim, so the innermost
+// run is as long as the broadcast allows. Broadcast dims step with stride 0.
+struct SelectV2Plan {
+  std::vector<int64_t> out_shape;
+  std::vector<int64_t> out_strides;
+  std::vector<int64_t> cond_strides;
+  std::vector<int64_t> then_strides;
+  std::vector<int64_t> else_strides;
+  int64_t total_elements = 0;
 };
+
 class Selectv2CpuKernel : public CpuKernel {
 public:
   Selectv2CpuKernel() = default;
   ~Selectv2CpuKernel() = default;
   uint32_t Compute(CpuKernelContext &ctx) override;
-  std::vector<int64_t> x_reshape_;
-  std::vector<int64_t> y_reshape_;
-  std::vector<int64_t> z_reshape_;
-  std::vector<int64_t> shape_out_;
-  std::vector<int64_t> x_bcast_;
-  std::vector<int64_t> y_bcast_;
-  std::vector<int64_t> z_bcast_;
 
 private:
-  KernelStatus Selectv2GenerateBcastInfo(const SelectV2BCalcInfo &calc_info);
-  void SelectV2GetBcastVec(SelectV2BCalcInfo &calc_info) const;
   KernelStatus Selectv2ParamCheck(const CpuKernelContext &ctx) const;
-  KernelStatus SelectV2BcastCheck(const int64_t x, const int64_t y,
-                                  const int64_t z) const;
-
-  template <typename T>
-  KernelStatus Selectv2BuildBcast(const CpuKernelContext &ctx);
-
-  bool AlignedCheck(const SelectV2BCalcInfo &calc_info) const;
-
-  template <int32_t RANK, typename T>
-  KernelStatus SelectV2CalculateWithAlignedCheck(SelectV2BCalcInfo &calc_info);
+  KernelStatus SelectV2BuildPlan(const CpuKernelContext &ctx,
+                                 SelectV2Plan &plan) const;
 
-  template <int32_t RANK, typename T, int32_t OPTION>
-  KernelStatus SelectV2Calculate(SelectV2BCalcInfo &calc_info);
-  KernelStatus SelectV2BcastInfo(size_t max_size);
-  enum Dim {
-    SCALAR,
-    ONE_DIM,
-    TWO_DIM,
-    THREE_DIM,
-    FOUR_DIM,
-    FIVE_DIM,
-    SIX_DIM,
-    SEVEN_DIM,
-    EIGHT_DIM
-  };
+  // Then/else/result are moved as opaque words, so one instantiation serves
+  // every data type of the same byte width.
+  template <typename W>
+  uint32_t SelectV2Compute(const CpuKernelContext &ctx,
+                           const SelectV2Plan &plan) const;
 };
 }  // namespace aicpu
-#endif  // AICPU_KERNELS_NORMALIZED_SELECTV2_CPU_KERNEL_H
\ No newline at end of file
+#endif  // AICPU_KERNELS_NORMALIZED_SELECTV2_CPU_KERNEL_H
@@ -335,4 +335,76 @@ TEST_F(TEST_SELECTV2_UT, TestSelectV2_LargeTensor) {
     float expected = (i % 2 == 0) ? static_cast<float>(i) : static_cast<float>(i + 1000);
     EXPECT_NEAR(output[i], expected, 1e-6);
   }
-}
\ No newline at end of file
+}
+// ---- normal: row broadcast condition, then broadcast along rows ----
+TEST_F(TEST_SELECTV2_UT, TestSelectV2_RowBroadcastCondition) {
+  vector<DataType> data_types = {DT_BOOL, DT_INT16, DT_INT16, DT_INT16};
+  vector<vector<int64_t>> shapes = {{1, 3}, {2, 1}, {2, 3}, {2, 3}};
+  bool condition[3] = {true, false, true};
+  int16_t then_val[2] = {-1, -2};
+  int16_t else_val[6] = {1, 2, 3, 4, 5, 6};
+  int16_t output[6] = {0};
+  vector<void *> datas = {(void *)condition, (void *)then_val, (void *)else_val, (void *)output};
+  CREATE_NODEDEF(shapes, data_types, datas);
+  RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+  int16_t output_exp[6] = {-1, 2, -1, -2, 5, -2};
+  EXPECT_EQ(CompareResult<int16_t>(output, output_exp, 6), true);
+}
+
+// ---- normal: scalar condition selects an input that broadcasts ----
+TEST_F(TEST_SELECTV2_UT, TestSelectV2_ScalarConditionBroadcast) {
+  vector<DataType> data_types = {DT_BOOL, DT_DOUBLE, DT_DOUBLE, DT_DOUBLE};
+  vector<vector<int64_t>> shapes = {{}, {3}, {2, 3}, {2, 3}};
+  bool condition[1] = {true};
+  double then_val[3] = {1.0, 2.0, 3.0};
+  double else_val[6] = {4.0, 5.0, 6.0, 7.0, 8.0, 9.0};
+  double output[6] = {0.0};
+  vector<void *> datas = {(void *)condition, (void *)then_val, (void *)else_val, (void *)output};
+  CREATE_NODEDEF(shapes, data_types, datas);
+  RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+  double output_exp[6] = {1.0, 2.0, 3.0, 1.0, 2.0, 3.0};
+  EXPECT_EQ(CompareResult<double>(output, output_exp, 6), true);
+}
+
+// ---- normal: rank above 8 with a per-row condition, sharded across cores ----
+TEST_F(TEST_SELECTV2_UT, TestSelectV2_HighRankSharded) {
+  vector<DataType> data_types = {DT_BOOL, DT_COMPLEX128, DT_COMPLEX128, DT_COMPLEX128};
+  vector<vector<int64_t>> shapes = {{2, 1, 2, 1, 2, 1, 2, 64, 1},
+                                    {2, 2, 2, 2, 2, 2, 2, 64, 64},
+                                    {64},
+                                    {2, 2, 2, 2, 2, 2, 2, 64, 64}};
+  const int64_t rows = 128 * 64;
+  const int64_t cols = 64;
+  vector<uint8_t> condition(16 * 64);
+  for (size_t i = 0; i < condition.size(); i++) {
+    condition[i] = (i % 3 == 0) ? 1 : 0;
+  }
+  vector<std::complex<double>> then_val(rows * cols);
+  for (size_t i = 0; i < then_val.size(); i++) {
+    then_val[i] = std::complex<double>(static_cast<double>(i), -1.0);
+  }
+  vector<std::complex<double>> else_val(cols);
+  for (int64_t i = 0; i < cols; i++) {
+    else_val[i] = std::complex<double>(-1.0, static_cast<double>(i));
+  }
+  vector<std::complex<double>> output(rows * cols);
+  vector<void *> datas = {(void *)condition.data(), (void *)then_val.data(), (void *)else_val.data(),
+                          (void *)output.data()};
+  CREATE_NODEDEF(shapes, data_types, datas);
+  RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+  bool same = true;
+  for (int64_t r = 0; r < rows; r++) {
+    // Row r = (a, b, c, d, e, f, g, h) with dims of size 2 except h (64); the condition keeps a, c, e, g, h.
+    const int64_t h = r % 64;
+    const int64_t g = (r / 64) % 2;
+    const int64_t e = (r / 256) % 2;
+    const int64_t c = (r / 1024) % 2;
+    const int64_t a = (r / 4096) % 2;
+    const bool take_then = condition[(((a * 2 + c) * 2 + e) * 2 + g) * 64 + h] != 0;
+    for (int64_t col = 0; col < cols; col++) {
+      const auto expect = take_then ? then_val[r * cols + col] : else_val[col];
+      same = same && (output[r * cols + col] == expect);
+    }
+  }
+  EXPECT_TRUE(same);
+}
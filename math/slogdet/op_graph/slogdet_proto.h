@@ -0,0 +1,46 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file slogdet_proto.h
+ * \brief
+ */
+#ifndef OPS_OP_PROTO_INC_SLOGDET_OPS_H_
+#define OPS_OP_PROTO_INC_SLOGDET_OPS_H_
+
+#include "graph/operator.h"
+#include "graph/operator_reg.h"
+
+namespace ge {
+/**
+* @brief Computes the sign and the log of the absolute value of the determinant of one or more square matrices by
+* partial-pivot LU factorization. \n
+
+* @par Inputs:
+* x: A tensor of shape [..., N, N]. Must be one of the following types: float32, double, complex64, complex128. \n
+
+* @par Outputs:
+* @li sign: A tensor of shape [...], with the same type as x. The sign of the determinant: -1, 0 or 1 for real
+* types, a complex number of modulus 1 (or 0) for complex types.
+* @li y: A tensor of shape [...], with the same type as x. The log of the absolute value of the determinant, -inf
+* for a singular matrix. \n
+
+* @par Third-party framework compatibility
+* Compatible with tensorflow LogMatrixDeterminant operator.
+*/
+REG_OP(LogMatrixDeterminant)
+    .INPUT(x, TensorType({DT_FLOAT, DT_DOUBLE, DT_COMPLEX64, DT_COMPLEX128}))
+    .OUTPUT(sign, TensorType({DT_FLOAT, DT_DOUBLE, DT_COMPLEX64, DT_COMPLEX128}))
+    .OUTPUT(y, TensorType({DT_FLOAT, DT_DOUBLE, DT_COMPLEX64, DT_COMPLEX128}))
+    .OP_END_FACTORY_REG(LogMatrixDeterminant)
+
+} // namespace ge
+
+#endif // OPS_OP_PROTO_INC_SLOGDET_OPS_H_
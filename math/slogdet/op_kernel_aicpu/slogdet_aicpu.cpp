@@ -0,0 +1,112 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "slogdet_aicpu.h"
+
+#include <complex>
+#include <vector>
+
+#include "aicpu/lu_determinant.h"
+#include "cpu_kernel_utils.h"
+#include "utils/kernel_util.h"
+
+namespace {
+const char* const kLogMatrixDeterminant = "LogMatrixDeterminant";
+constexpr int64_t kMatrixRank = 2;
+} // namespace
+
+namespace aicpu {
+uint32_t LogMatrixDeterminantCpuKernel::Compute(CpuKernelContext& ctx)
+{
+    LogMatrixDeterminantParams params;
+    KERNEL_HANDLE_ERROR(ParseParams(ctx, params), "[%s] check params failed.", kLogMatrixDeterminant);
+    auto data_type = ctx.Input(kFirstInputIndex)->GetDataType();
+    switch (data_type) {
+        case DT_FLOAT:
+            return LogMatrixDeterminantCompute<float>(ctx, params);
+        case DT_DOUBLE:
+            return LogMatrixDeterminantCompute<double>(ctx, params);
+        case DT_COMPLEX64:
+            return LogMatrixDeterminantCompute<std::complex<float>>(ctx, params);
+        case DT_COMPLEX128:
+            return LogMatrixDeterminantCompute<std::complex<double>>(ctx, params);
+        default:
+            KERNEL_LOG_ERROR("[%s] invalid input type [%s]", kLogMatrixDeterminant, DTypeStr(data_type).c_str());
+            return KERNEL_STATUS_PARAM_INVALID;
+    }
+}
+
+uint32_t LogMatrixDeterminantCpuKernel::ParseParams(const CpuKernelContext& ctx,
+                                                    LogMatrixDeterminantParams& params) const
+{
+    Tensor* input = ctx.Input(kFirstInputIndex);
+    Tensor* sign = ctx.Output(kFirstOutputIndex);
+    Tensor* log_abs = ctx.Output(kSecondOutputIndex);
+    KERNEL_CHECK_NULLPTR(input, KERNEL_STATUS_PARAM_INVALID, "[%s] get input failed.", kLogMatrixDeterminant)
+    KERNEL_CHECK_NULLPTR(sign, KERNEL_STATUS_PARAM_INVALID, "[%s] get output sign failed.", kLogMatrixDeterminant)
+    KERNEL_CHECK_NULLPTR(log_abs, KERNEL_STATUS_PARAM_INVALID, "[%s] get output y failed.", kLogMatrixDeterminant)
+    KERNEL_CHECK_NULLPTR(input->GetTensorShape(), KERNEL_STATUS_PARAM_INVALID, "[%s] get input shape failed.",
+                         kLogMatrixDeterminant)
+    KERNEL_CHECK_NULLPTR(sign->GetTensorShape(), KERNEL_STATUS_PARAM_INVALID, "[%s] get sign shape failed.",
+                         kLogMatrixDeterminant)
+    KERNEL_CHECK_NULLPTR(log_abs->GetTensorShape(), KERNEL_STATUS_PARAM_INVALID, "[%s] get y shape failed.",
+                         kLogMatrixDeterminant)
+    const DataType data_type = input->GetDataType();
+    KERNEL_CHECK_FALSE(sign->GetDataType() == data_type && log_abs->GetDataType() == data_type,
+                       KERNEL_STATUS_PARAM_INVALID, "[%s] sign [%s] and y [%s] should have the input type [%s].",
+                       kLogMatrixDeterminant, DTypeStr(sign->GetDataType()).c_str(),
+                       DTypeStr(log_abs->GetDataType()).c_str(), DTypeStr(data_type).c_str());
+
+    std::vector<int64_t> dims = input->GetTensorShape()->GetDimSizes();
+    const int32_t rank = static_cast<int32_t>(dims.size());
+    KERNEL_CHECK_FALSE(rank >= kMatrixRank, KERNEL_STATUS_PARAM_INVALID, "[%s] input rank [%d] should be at least 2.",
+                       kLogMatrixDeterminant, rank);
+    params.n = dims[rank - 1];
+    KERNEL_CHECK_FALSE(dims[rank - 2] == params.n, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] input should be square matrices, got [%ld, %ld].", kLogMatrixDeterminant,
+                       dims[rank - 2], params.n);
+    std::vector<int64_t> batch_dims(dims.begin(), dims.end() - kMatrixRank);
+    params.batch = 1;
+    for (int64_t d : batch_dims) {
+        params.batch *= d;
+    }
+    KERNEL_CHECK_FALSE(sign->GetTensorShape()->GetDimSizes() == batch_dims &&
+                           log_abs->GetTensorShape()->GetDimSizes() == batch_dims,
+                       KERNEL_STATUS_PARAM_INVALID, "[%s] sign and y should have the batch shape of the input.",
+                       kLogMatrixDeterminant);
+    if (params.batch * params.n > 0) {
+        KERNEL_CHECK_NULLPTR(input->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] get input data failed.",
+                             kLogMatrixDeterminant)
+    }
+    if (params.batch > 0) {
+        KERNEL_CHECK_NULLPTR(sign->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] get sign data failed.",
+                             kLogMatrixDeterminant)
+        KERNEL_CHECK_NULLPTR(log_abs->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] get y data failed.",
+                             kLogMatrixDeterminant)
+    }
+    return KERNEL_STATUS_OK;
+}
+
+template <typename T>
+uint32_t LogMatrixDeterminantCpuKernel::LogMatrixDeterminantCompute(const CpuKernelContext& ctx,
+                                                                    const LogMatrixDeterminantParams& params) const
+{
+    const T* input = reinterpret_cast<const T*>(ctx.Input(kFirstInputIndex)->GetData());
+    T* sign = reinterpret_cast<T*>(ctx.Output(kFirstOutputIndex)->GetData());
+    T* log_abs = reinterpret_cast<T*>(ctx.Output(kSecondOutputIndex)->GetData());
+    auto emit = [sign, log_abs](int64_t b, const LuDeterminant<T>& det) {
+        sign[b] = det.sign;
+        log_abs[b] = T(det.log_abs);
+    };
+    return LuDeterminantCompute<T>(ctx, input, params.batch, params.n, emit, kLogMatrixDeterminant);
+}
+
+REGISTER_CPU_KERNEL(kLogMatrixDeterminant, LogMatrixDeterminantCpuKernel);
+} // namespace aicpu
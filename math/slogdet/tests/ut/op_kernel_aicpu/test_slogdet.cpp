@@ -0,0 +1,222 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "utils/aicpu_test_utils.h"
+#include "cpu_kernel_utils.h"
+#include "node_def_builder.h"
+
+using namespace std;
+using namespace aicpu;
+
+class TEST_LOG_MATRIX_DETERMINANT_UT : public testing::Test {};
+
+#define CREATE_NODEDEF(shapes, data_types, datas)                                         \
+    auto node_def = CpuKernelUtils::CreateNodeDef();                                      \
+    NodeDefBuilder(node_def.get(), "LogMatrixDeterminant", "LogMatrixDeterminant")        \
+        .Input({"x", data_types[0], shapes[0], datas[0]})                                 \
+        .Output({"sign", data_types[1], shapes[1], datas[1]})                             \
+        .Output({"y", data_types[2], shapes[2], datas[2]})
+
+namespace {
+template <typename T>
+vector<T> RandomValues(size_t num)
+{
+    vector<double> values(num);
+    SetRandomValue<double>(values.data(), num, -1.0, 1.0);
+    return vector<T>(values.begin(), values.end());
+}
+
+template <>
+vector<complex<float>> RandomValues<complex<float>>(size_t num)
+{
+    vector<double> re = RandomValues<double>(num);
+    vector<double> im = RandomValues<double>(num);
+    vector<complex<float>> values(num);
+    for (size_t i = 0; i < num; i++) {
+        values[i] = complex<float>(re[i], im[i]);
+    }
+    return values;
+}
+
+// Reference: unblocked Gaussian elimination with partial pivoting in complex<double>.
+template <typename T>
+void ReferenceSlogdet(const T* x, int64_t n, complex<double>& sign, double& log_abs)
+{
+    vector<complex<double>> a(x, x + n * n);
+    sign = 1.0;
+    log_abs = 0.0;
+    for (int64_t k = 0; k < n; k++) {
+        int64_t p = k;
+        for (int64_t i = k + 1; i < n; i++) {
+            if (abs(a[i * n + k]) > abs(a[p * n + k])) {
+                p = i;
+            }
+        }
+        if (abs(a[p * n + k]) == 0.0) {
+            sign = 0.0;
+            log_abs = -numeric_limits<double>::infinity();
+            return;
+        }
+        if (p != k) {
+            for (int64_t j = 0; j < n; j++) {
+                swap(a[k * n + j], a[p * n + j]);
+            }
+            sign = -sign;
+        }
+        const complex<double> pivot = a[k * n + k];
+        sign *= pivot / abs(pivot);
+        log_abs += log(abs(pivot));
+        for (int64_t i = k + 1; i < n; i++) {
+            const complex<double> l = a[i * n + k] / pivot;
+            for (int64_t j = k + 1; j < n; j++) {
+                a[i * n + j] -= l * a[k * n + j];
+            }
+        }
+    }
+}
+
+template <typename T>
+void CheckAgainstReference(const vector<T>& x, int64_t batch, int64_t n, const vector<T>& sign,
+                           const vector<T>& log_abs, double tol)
+{
+    for (int64_t b = 0; b < batch; b++) {
+        complex<double> expect_sign;
+        double expect_log_abs;
+        ReferenceSlogdet(x.data() + b * n * n, n, expect_sign, expect_log_abs);
+        const complex<double> got_sign(sign[b]);
+        EXPECT_NEAR(abs(got_sign - expect_sign), 0.0, tol) << "batch " << b;
+        EXPECT_NEAR(real(complex<double>(log_abs[b])), expect_log_abs, tol * max(1.0, fabs(expect_log_abs)))
+            << "batch " << b;
+    }
+}
+
+// Entries are drawn from [-scale, scale].
+template <typename T>
+void RunRandom(DataType data_type, int64_t batch, int64_t n, double tol, double scale = 1.0)
+{
+    vector<T> x = RandomValues<T>(static_cast<size_t>(batch * n * n));
+    for (auto& v : x) {
+        v *= static_cast<T>(scale);
+    }
+    vector<T> sign(batch);
+    vector<T> log_abs(batch);
+    vector<DataType> data_types = {data_type, data_type, data_type};
+    vector<vector<int64_t>> shapes = {{batch, n, n}, {batch}, {batch}};
+    vector<void*> datas = {(void*)x.data(), (void*)sign.data(), (void*)log_abs.data()};
+    CREATE_NODEDEF(shapes, data_types, datas);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    CheckAgainstReference(x, batch, n, sign, log_abs, tol);
+}
+} // namespace
+
+TEST_F(TEST_LOG_MATRIX_DETERMINANT_UT, FLOAT_KNOWN_SUCCESS)
+{
+    // det = 6, det = -2 (one row swap), det = 0
+    float x[3][2][2] = {{{2, 1}, {0, 3}}, {{0, 1}, {2, 5}}, {{1, 2}, {2, 4}}};
+    float sign[3] = {0};
+    float log_abs[3] = {0};
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{3, 2, 2}, {3}, {3}};
+    vector<void*> datas = {(void*)x, (void*)sign, (void*)log_abs};
+    CREATE_NODEDEF(shapes, data_types, datas);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    EXPECT_EQ(sign[0], 1.0f);
+    EXPECT_NEAR(log_abs[0], log(6.0f), 1e-6);
+    EXPECT_EQ(sign[1], -1.0f);
+    EXPECT_NEAR(log_abs[1], log(2.0f), 1e-6);
+    EXPECT_EQ(sign[2], 0.0f);
+    EXPECT_EQ(log_abs[2], -numeric_limits<float>::infinity());
+}
+
+TEST_F(TEST_LOG_MATRIX_DETERMINANT_UT, DOUBLE_BATCH_SUCCESS)
+{
+    RunRandom<double>(DT_DOUBLE, 200, 24, 1e-10);
+}
+
+TEST_F(TEST_LOG_MATRIX_DETERMINANT_UT, FLOAT_BLOCKED_BATCH_SUCCESS)
+{
+    RunRandom<float>(DT_FLOAT, 3, 150, 1e-3);
+}
+
+TEST_F(TEST_LOG_MATRIX_DETERMINANT_UT, DOUBLE_BLOCKED_SPLIT_SUCCESS)
+{
+    RunRandom<double>(DT_DOUBLE, 1, 300, 1e-9);
+}
+
+TEST_F(TEST_LOG_MATRIX_DETERMINANT_UT, COMPLEX64_SUCCESS)
+{
+    RunRandom<complex<float>>(DT_COMPLEX64, 5, 7, 1e-4);
+}
+
+// |v|^2 of these entries overflows or underflows float, the pivot search must not square them.
+TEST_F(TEST_LOG_MATRIX_DETERMINANT_UT, FLOAT_LARGE_SCALE_SUCCESS)
+{
+    RunRandom<float>(DT_FLOAT, 4, 24, 1e-4, 1e25);
+}
+
+TEST_F(TEST_LOG_MATRIX_DETERMINANT_UT, FLOAT_SMALL_SCALE_SUCCESS)
+{
+    RunRandom<float>(DT_FLOAT, 4, 24, 1e-4, 1e-25);
+}
+
+TEST_F(TEST_LOG_MATRIX_DETERMINANT_UT, FLOAT_BLOCKED_LARGE_SCALE_SUCCESS)
+{
+    RunRandom<float>(DT_FLOAT, 1, 150, 1e-3, 1e25);
+}
+
+TEST_F(TEST_LOG_MATRIX_DETERMINANT_UT, COMPLEX64_SCALED_SUCCESS)
+{
+    RunRandom<complex<float>>(DT_COMPLEX64, 3, 7, 1e-4, 1e25);
+    RunRandom<complex<float>>(DT_COMPLEX64, 3, 7, 1e-4, 1e-25);
+}
+
+TEST_F(TEST_LOG_MATRIX_DETERMINANT_UT, EMPTY_MATRIX_SUCCESS)
+{
+    double x[1] = {0};
+    double sign[2] = {0};
+    double log_abs[2] = {1, 1};
+    vector<DataType> data_types = {DT_DOUBLE, DT_DOUBLE, DT_DOUBLE};
+    vector<vector<int64_t>> shapes = {{2, 0, 0}, {2}, {2}};
+    vector<void*> datas = {(void*)x, (void*)sign, (void*)log_abs};
+    CREATE_NODEDEF(shapes, data_types, datas);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    EXPECT_EQ(sign[0], 1.0);
+    EXPECT_EQ(log_abs[1], 0.0);
+}
+
+TEST_F(TEST_LOG_MATRIX_DETERMINANT_UT, NOT_SQUARE_FAILED)
+{
+    float x[6] = {0};
+    float sign[1] = {0};
+    float log_abs[1] = {0};
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{1, 2, 3}, {1}, {1}};
+    vector<void*> datas = {(void*)x, (void*)sign, (void*)log_abs};
+    CREATE_NODEDEF(shapes, data_types, datas);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
+}
+
+TEST_F(TEST_LOG_MATRIX_DETERMINANT_UT, OUTPUT_DTYPE_FAILED)
+{
+    float x[4] = {0};
+    double sign[1] = {0};
+    float log_abs[1] = {0};
+    vector<DataType> data_types = {DT_FLOAT, DT_DOUBLE, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{1, 2, 2}, {1}, {1}};
+    vector<void*> datas = {(void*)x, (void*)sign, (void*)log_abs};
+    CREATE_NODEDEF(shapes, data_types, datas);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
+}
@@ -28,6 +28,12 @@ OP_TYPE_REGISTER(Sort);
 static const std::initializer_list<op::DataType> AICORE_DTYPE_SUPPORT_LIST = {
     op::DataType::DT_FLOAT, op::DataType::DT_FLOAT16, op::DataType::DT_BF16};
 
+// regbase上AI Core Sort注册的dtype，与sort_def.cpp保持一致
+static const std::initializer_list<op::DataType> REGBASE_AICORE_DTYPE_SUPPORT_LIST = {
+    op::DataType::DT_INT32,  op::DataType::DT_INT16, op::DataType::DT_INT8,    op::DataType::DT_UINT32,
+    op::DataType::DT_UINT16, op::DataType::DT_UINT8, op::DataType::DT_BF16,    op::DataType::DT_FLOAT16,
+    op::DataType::DT_FLOAT,  op::DataType::DT_INT64, op::DataType::DT_UINT64};
+
 static const int64_t DATA_LIMIT = 100000;
 static const int64_t AXIS_LIMIT = 8;
 static const int64_t NON_LAST_SMALL_AXIS_MIN = 2;
@@ -70,10 +76,10 @@ static bool SocSupportDtype(const aclTensor* self)
     return false;
 }
 
-static bool IsAiCoreSupport(const aclTensor* self, bool stable, bool descending)
+bool IsSortAiCoreSupported(const aclTensor* self, bool stable, bool descending)
 {
     if (IsRegBase()) {
-        return true;
+        return CheckType(self->GetDataType(), REGBASE_AICORE_DTYPE_SUPPORT_LIST);
     } else if (GetCurrentPlatformInfo().GetSocVersion() == SocVersion::ASCEND310B && stable && !descending) {
         return false;
     } else {
@@ -220,7 +226,7 @@ const std::tuple<aclTensor*, aclTensor*> Sort(const aclTensor* self, int64_t dim
     auto outputs = AllocateSortOutputs(self, selfShape, selfFormat, indicesType, executor);
     auto values = std::get<0>(outputs);
     auto indices = std::get<1>(outputs);
-    if (IsAiCoreSupport(self, stable, descending)) {
+    if (IsSortAiCoreSupported(self, stable, descending)) {
         if (IsRegBase()) {
             SortAiCoreForDavid(self, stable, dim, descending, values, indices, indicesType, executor);
         } else {
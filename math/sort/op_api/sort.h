@@ -15,6 +15,9 @@
 #include "opdev/fast_vector.h"
 
 namespace l0op {
+// Sort对self最后一维排序时是否走AI Core，不满足时Sort回退AI CPU
+bool IsSortAiCoreSupported(const aclTensor* self, bool stable, bool descending);
+
 const std::tuple<aclTensor*, aclTensor*> Sort(const aclTensor* self, int64_t dim, bool descending, bool stable,
                                               op::DataType indicesType, aclOpExecutor* executor);
 }
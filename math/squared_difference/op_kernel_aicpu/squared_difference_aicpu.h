@@ -23,16 +23,6 @@ class SquaredDifferenceCpuKernel : public CpuKernel {
  private:
   uint32_t SquaredDifferenceCheck(const CpuKernelContext &ctx) const;
 
-  template <typename T>
-  void SpecialCompute(BcastShapeType type, int64_t start, int64_t end,
-                      const T *input1, const T *input2, T *output);
-
-  template <typename T>
-  uint32_t NoBcastCompute(const CpuKernelContext &ctx);
-
-  template <typename T>
-  uint32_t BcastCompute(const CpuKernelContext &ctx, const Bcast &bcast);
-
   template <typename T>
   uint32_t SquaredDifferenceCompute(const CpuKernelContext &ctx);
 };
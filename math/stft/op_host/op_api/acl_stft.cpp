@@ -18,6 +18,8 @@
 #include <list>
 #include <unordered_map>
 #include <string>
+#include <algorithm>
+#include <memory>
 #include "aclnn_kernels/contiguous.h"
 #include "opdev/op_log.h"
 #include "opdev/op_dfx.h"
@@ -31,6 +33,7 @@
 #include "conversion/pad_v3/op_api/padv3.h"
 #include "math/mul/op_api/mul.h"
 #include "math/ones_like/op_api/ones_like.h"
+#include "op_api/fft_plan_cache.h"
 #include "stft.h"
 #include "acl_stft.h"
 
@@ -182,10 +185,10 @@ private:
     std::unordered_map<DftCacheKey, CacheMapValue, DftCacheKeyHash> cacheMap_;
 };
 
-static int64_t nFftToAlign(const aclTensor* self, int64_t nfft, int alignBytes)
+static int64_t nFftToAlign(DataType dtype, int64_t nfft, int alignBytes)
 {
     int64_t nFftAlign = 0;
-    switch (self->GetDataType()) {
+    switch (dtype) {
         case DataType::DT_FLOAT: {
             int alignNum = alignBytes / FP32_BYTES;
             nFftAlign = (nfft + alignNum - 1) / alignNum * alignNum;
@@ -198,6 +201,11 @@ static int64_t nFftToAlign(const aclTensor* self, int64_t nfft, int alignBytes)
     return nFftAlign;
 }
 
+static int64_t nFftToAlign(const aclTensor* self, int64_t nfft, int alignBytes)
+{
+    return nFftToAlign(self->GetDataType(), nfft, alignBytes);
+}
+
 static int NfftAlignBytes(int64_t nfft, int64_t hopLength, bool normalized, bool onesided, bool returnComplex)
 {
     if (nfft == X1_NFFT && hopLength == X1_HOP && normalized == false && onesided == true && returnComplex == false) {
@@ -266,6 +274,38 @@ static void CalcRealAndImag(int m, int n, float* out)
     out0[1] = s;
 }
 
+// 构造host侧DFT矩阵(2, K, colSizeAlign)，实部与虚部按行交错
+static FftPlanPtr BuildStftDftPlan(int64_t rowSize, int64_t colSize, int64_t colSizeAlign)
+{
+    auto plan = std::make_shared<FftPlan>();
+    plan->table.assign(static_cast<size_t>(REAL_IMAG_NUM * rowSize * colSizeAlign), 0.0f);
+    float out[2];
+    for (int i = 0; i < rowSize; i++) {
+        float* addrReal = plan->table.data() + REAL_IMAG_NUM * i * colSizeAlign;
+        float* addrImag = addrReal + colSizeAlign;
+        for (int j = 0; j < colSize; j++) {
+            CalcRealAndImag(-1 * i * j, colSize, out);
+            addrReal[j] = out[0];
+            addrImag[j] = out[1];
+        }
+    }
+    return plan;
+}
+
+// host侧DFT矩阵缓存：设备侧缓存未命中(新设备、被淘汰或超出显存预算)时直接复用，避免重复计算三角函数
+static FftPlanPtr GetStftDftPlan(DataType dtype, int64_t rowSize, int64_t colSize, int nfftAlignBytes)
+{
+    int64_t colSizeAlign = nFftToAlign(dtype, colSize, nfftAlignBytes);
+    FftPlanKey key;
+    key.kind = FftPlanKind::STFT_DFT;
+    key.length = colSize;
+    key.dtype = static_cast<int32_t>(dtype);
+    key.rows = rowSize;
+    key.alignBytes = nfftAlignBytes;
+    return FftPlanCache::GetInstance().GetOrBuild(
+        key, [rowSize, colSize, colSizeAlign]() { return BuildStftDftPlan(rowSize, colSize, colSizeAlign); });
+}
+
 static bool HasEmptyTensor(const aclTensor* self)
 {
     // 检查张量是否存在空维
@@ -476,31 +516,11 @@ static const aclTensor* GenerateDftMatrix(const aclTensor* self, int64_t rowSize
     // 未命中plan cache
     OP_LOGI("DftMatrix cache MISS: K=%lld, nFft=%lld, alignBytes=%d, deviceId=%d, constructing matrix...",
             (long long)rowSize, (long long)colSize, nfftAlignBytes, deviceId);
+    FftPlanPtr plan = GetStftDftPlan(self->GetDataType(), rowSize, colSize, nfftAlignBytes);
+    CHECK_RET(plan != nullptr, nullptr);
     auto dftMatrix = executor->AllocHostTensor({2, rowSize, colSizeAlign}, op::DataType::DT_FLOAT);
-    float* addrReal = static_cast<float*>(dftMatrix->GetStorageAddr());
-    float* addrImag = static_cast<float*>(dftMatrix->GetStorageAddr()) + rowSize * colSizeAlign;
-    float out[2];
-
-    // 实部及虚部交错
-    addrImag = static_cast<float*>(dftMatrix->GetStorageAddr()) + colSizeAlign;
-    for (int i = 0; i < rowSize; i++) {
-        if (i > 0) {
-            addrReal += colSizeAlign;
-            addrImag += colSizeAlign;
-        }
-        for (int j = 0; j < colSizeAlign; j++) {
-            if (j < colSize) {
-                CalcRealAndImag(-1 * i * j, colSize, out);
-                *addrReal = out[0];
-                *addrImag = out[1];
-            } else {
-                *addrReal = 0;
-                *addrImag = 0;
-            }
-            addrReal++;
-            addrImag++;
-        }
-    }
+    CHECK_RET(dftMatrix != nullptr, nullptr);
+    std::copy(plan->table.begin(), plan->table.end(), static_cast<float*>(dftMatrix->GetStorageAddr()));
 
     // 同步拷贝到NPU
     auto deviceTensor = op::CopyToNpuSync(dftMatrix, executor);
@@ -610,3 +630,23 @@ aclnnStatus aclStft(void* workspace, uint64_t workspaceSize, aclOpExecutor* exec
 
     return CommonOpExecutorRun(workspace, workspaceSize, executor, stream);
 }
+
+aclnnStatus aclStftPlanCachePrewarm(int64_t nFft, int64_t hopLength, bool normalized, bool onesided,
+                                    bool returnComplex)
+{
+    if (nFft <= 0 || hopLength <= 0) {
+        OP_LOGE(ACLNN_ERR_PARAM_INVALID, "expect nFft > 0 and hopLength > 0");
+        return ACLNN_ERR_PARAM_INVALID;
+    }
+    // 仅AiCore路径构造DFT矩阵，且只有FLOAT32输入需要
+    int nfftAlignBytes = NfftAlignBytes(nFft, hopLength, normalized, onesided, returnComplex);
+    const int64_t K = onesided ? (nFft / 2) + 1 : nFft;
+    CHECK_RET(GetStftDftPlan(DataType::DT_FLOAT, K, nFft, nfftAlignBytes) != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    return ACLNN_SUCCESS;
+}
+
+aclnnStatus aclStftPlanCacheClear()
+{
+    FftPlanCache::GetInstance().Clear(FftPlanKind::STFT_DFT);
+    return ACLNN_SUCCESS;
+}
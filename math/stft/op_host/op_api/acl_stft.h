@@ -71,6 +71,26 @@ ACLNN_API aclnnStatus aclStftGetWorkspaceSize(
  */
 ACLNN_API aclnnStatus aclStft(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream);
 
+/**
+ * @brief 预先构造aclStft AiCore路径所需的host侧DFT矩阵并放入进程级plan cache(LRU淘汰，带内存上限)，
+ * 之后各device首次调用aclStftGetWorkspaceSize时只需拷贝该矩阵。参数含义与aclStftGetWorkspaceSize一致，
+ * 仅对FLOAT32输入生效。
+ * @param [in] nFft: 必选参数，Host侧的int，FFT的点数（大于0）。
+ * @param [in] hopLength: 必选参数，Host侧的int，滑动窗口的间隔（大于0）。
+ * @param [in] normalized: 必选参数，Host侧的bool，是否对傅里叶变换结果进行标准化。
+ * @param [in] onesided: 必选参数，Host侧的bool，是否返回全部的结果或者一半结果。
+ * @param [in] returnComplex: 必选参数，Host侧的bool，确认返回值是complex tensor或者是实部、虚部分开的tensor。
+ * @return aclnnStatus: 返回状态码
+ */
+ACLNN_API aclnnStatus aclStftPlanCachePrewarm(int64_t nFft, int64_t hopLength, bool normalized, bool onesided,
+                                              bool returnComplex);
+
+/**
+ * @brief 释放aclStft缓存的host侧DFT矩阵，已拷贝到device侧的矩阵不受影响。
+ * @return aclnnStatus: 返回状态码
+ */
+ACLNN_API aclnnStatus aclStftPlanCacheClear();
+
 #ifdef __cplusplus
 }
 #endif
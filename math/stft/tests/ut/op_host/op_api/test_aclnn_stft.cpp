@@ -373,6 +373,39 @@ TEST_F(l2_stft_test, ascend910B3_case_plan_cache)
     }
 }
 
+TEST_F(l2_stft_test, ascend910B2_case_plan_cache_prewarm)
+{
+    int64_t nFft = 512L;
+    int64_t hopLength = 128L;
+    int64_t winLength = 512L;
+    bool normalized = false;
+    bool onesided = true;
+    bool returnComplex = false;
+    EXPECT_EQ(aclStftPlanCachePrewarm(nFft, hopLength, normalized, onesided, returnComplex), ACL_SUCCESS);
+
+    auto self_tensor_desc = TensorDesc({4, 16000}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto out_tensor_desc =
+        TensorDesc({4, nFft / 2 + 1, (16000 - winLength) / hopLength + 1, 2}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto ut = OP_API_UT(
+        aclStft,
+        INPUT(
+            self_tensor_desc, (aclTensor*)nullptr, out_tensor_desc, nFft, hopLength, winLength, normalized, onesided,
+            returnComplex),
+        OUTPUT());
+
+    uint64_t workspace_size = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspace_size);
+    EXPECT_EQ(aclRet, ACL_SUCCESS);
+
+    EXPECT_EQ(aclStftPlanCacheClear(), ACL_SUCCESS);
+}
+
+TEST_F(l2_stft_test, ascend910B2_case_plan_cache_prewarm_invalid)
+{
+    EXPECT_EQ(aclStftPlanCachePrewarm(0, 160, false, true, false), ACLNN_ERR_PARAM_INVALID);
+    EXPECT_EQ(aclStftPlanCachePrewarm(400, 0, false, true, false), ACLNN_ERR_PARAM_INVALID);
+}
+
 TEST_F(l2_stft_test, ascend910B2_case_invalid_nfft)
 {
     auto self_tensor_desc = TensorDesc({16, 25000}, ACL_FLOAT, ACL_FORMAT_ND);
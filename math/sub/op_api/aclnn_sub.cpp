@@ -325,21 +325,34 @@ aclnnStatus aclnnSubGetWorkspaceSize(
         promoteType = promoteType == DataType::DT_DOUBLE ? DataType::DT_DOUBLE : DataType::DT_FLOAT;
     }
 
-    // 固定写法，将输入self转换成连续的tensor
-    auto selfContiguous = l0op::Contiguous(self, uniqueExecutor.get());
-    CHECK_RET(selfContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    // 无需类型转换且直接调用Sub时，支持非连续输入的kernel跳过Contiguous
+    const aclTensor* selfCasted = nullptr;
+    const aclTensor* otherCasted = nullptr;
+    if (self->GetDataType() == promoteType && other->GetDataType() == promoteType && IsEqualToOne(promoteType, alpha) &&
+        l0op::IsSubSupportNonContiguous(self, other)) {
+        selfCasted = uniqueExecutor.get()->CreateView(
+            self, self->GetViewShape(), self->GetStorageShape(), self->GetViewStrides(), self->GetViewOffset());
+        CHECK_RET(selfCasted != nullptr, ACLNN_ERR_INNER_NULLPTR);
+        otherCasted = uniqueExecutor.get()->CreateView(
+            other, other->GetViewShape(), other->GetStorageShape(), other->GetViewStrides(), other->GetViewOffset());
+        CHECK_RET(otherCasted != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    } else {
+        // 固定写法，将输入self转换成连续的tensor
+        auto selfContiguous = l0op::Contiguous(self, uniqueExecutor.get());
+        CHECK_RET(selfContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
-    // 将输入self的数据类型转换成隐式数据类型
-    auto selfCasted = l0op::Cast(selfContiguous, promoteType, uniqueExecutor.get());
-    CHECK_RET(selfCasted != nullptr, ACLNN_ERR_INNER_NULLPTR);
+        // 将输入self的数据类型转换成隐式数据类型
+        selfCasted = l0op::Cast(selfContiguous, promoteType, uniqueExecutor.get());
+        CHECK_RET(selfCasted != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
-    // 固定写法，将输入other转换成连续的tensor
-    auto otherContiguous = l0op::Contiguous(other, uniqueExecutor.get());
-    CHECK_RET(otherContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
+        // 固定写法，将输入other转换成连续的tensor
+        auto otherContiguous = l0op::Contiguous(other, uniqueExecutor.get());
+        CHECK_RET(otherContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
-    // 将输入other的数据类型转换成隐式数据类型
-    auto otherCasted = l0op::Cast(otherContiguous, promoteType, uniqueExecutor.get());
-    CHECK_RET(otherCasted != nullptr, ACLNN_ERR_INNER_NULLPTR);
+        // 将输入other的数据类型转换成隐式数据类型
+        otherCasted = l0op::Cast(otherContiguous, promoteType, uniqueExecutor.get());
+        CHECK_RET(otherCasted != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    }
 
     // alpha非1时右输入带缩放计算
     const aclTensor* subOpOut = nullptr;
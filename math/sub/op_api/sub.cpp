@@ -19,6 +19,7 @@
 #include "opdev/op_log.h"
 #include "opdev/shape_utils.h"
 #include "opdev/platform.h"
+#include "op_api/aicpu_strided_view.h"
 
 using namespace op;
 
@@ -54,6 +55,12 @@ static bool IsAiCoreSupport(const aclTensor* self)
     return CheckType(self->GetDataType(), ASCEND910_AICORE_DTYPE_SUPPORT_LIST);
 }
 
+bool IsSubSupportNonContiguous(const aclTensor* self, [[maybe_unused]] const aclTensor* other)
+{
+    // 与Sub的分支选择一致，按self的dtype决定；AICPU Sub按stride读取非连续输入（见SubAiCpuStrided）
+    return !IsAiCoreSupport(self);
+}
+
 // AICORE算子kernel
 static const aclTensor* SubAiCore(
     const aclTensor* self, const aclTensor* other, aclTensor* subOut, aclOpExecutor* executor)
@@ -65,10 +72,33 @@ static const aclTensor* SubAiCore(
     return subOut;
 }
 
+// AICPU算子kernel，输入非连续时以storage + view属性下发，kernel内按stride读取，省去Contiguous拷贝
+static const aclTensor* SubAiCpuStrided(
+    const aclTensor* self, const aclTensor* other, aclTensor* subOut, aclOpExecutor* executor)
+{
+    L0_DFX(SubAiCpuStrided, self, other);
+    AicpuStridedInput x1;
+    AicpuStridedInput x2;
+    CHECK_RET(MakeAicpuStridedInput(self, executor, x1) && MakeAicpuStridedInput(other, executor, x2), nullptr);
+
+    static internal::AicpuTaskSpace space("Sub");
+    auto ret = ADD_TO_LAUNCHER_LIST_AICPU(
+        Sub,
+        OP_ATTR_NAMES({"view_shape_0", "view_strides_0", "view_offset_0", "view_shape_1", "view_strides_1",
+                       "view_offset_1"}),
+        OP_INPUT(x1.storage, x2.storage), OP_OUTPUT(subOut),
+        OP_ATTR(x1.viewShape, x1.viewStrides, x1.viewOffset, x2.viewShape, x2.viewStrides, x2.viewOffset));
+    CHECK_RET(ret == ACLNN_SUCCESS, nullptr);
+    return subOut;
+}
+
 // AICPU算子kernel
 static const aclTensor* SubAiCpu(
     const aclTensor* self, const aclTensor* other, aclTensor* subOut, aclOpExecutor* executor)
 {
+    if (IsAicpuStridedLaunch(self, other)) {
+        return SubAiCpuStrided(self, other, subOut, executor);
+    }
     // 使用框架宏ADD_TO_LAUNCHER_LIST_AICPU，将AiCpu Sub算子加入任务队列
     // Sub是算子的OpType，self、other是算子的输入，subOut是算子的输出
     L0_DFX(SubAiCpu, self, other);
@@ -15,6 +15,7 @@
 
 namespace l0op {
 const aclTensor* Sub(const aclTensor* self, const aclTensor* other, aclOpExecutor* executor);
+bool IsSubSupportNonContiguous(const aclTensor* self, const aclTensor* other);
 
 }
 
@@ -13,6 +13,7 @@
 #include <complex>
 #include <iostream>
 
+#include "aicpu/broadcast_binary.h"
 #include "cpu_kernel_utils.h"
 #include "utils/kernel_util.h"
 
@@ -24,76 +25,16 @@ const uint32_t kInputNum = 2;
 const uint32_t kOutputNum = 1;
 }  // namespace
 namespace aicpu {
-template <typename T, int32_t RANK>
-uint32_t SubCpuKernel::BroadcastCompute(TensorMap<T> &x, TensorMap<T> &y,
-                                        TensorMap<T> &out, const Bcast &bcast) {
-  Eigen::DSizes<Eigen::DenseIndex, RANK> x_reshape;
-  Eigen::DSizes<Eigen::DenseIndex, RANK> y_reshape;
-  Eigen::DSizes<Eigen::DenseIndex, RANK> result_shape;
-  Eigen::array<Eigen::DenseIndex, RANK> x_bcast;
-  Eigen::array<Eigen::DenseIndex, RANK> y_bcast;
-
-  for (int32_t i = 0; i < RANK; i++) {
-    x_reshape[i] = bcast.XReshape()[i];
-    y_reshape[i] = bcast.YReshape()[i];
-    result_shape[i] = bcast.ResultShape()[i];
-    x_bcast[i] = bcast.XBcast()[i];
-    y_bcast[i] = bcast.YBcast()[i];
-  }
-  out.reshape(result_shape) = x.reshape(x_reshape).broadcast(x_bcast) -
-                              y.reshape(y_reshape).broadcast(y_bcast);
-  return KERNEL_STATUS_OK;
-}
 template <typename T>
 uint32_t SubCpuKernel::DoCompute(const CpuKernelContext &ctx) {
-  auto input0_tensor = ctx.Input(0);
-  auto input1_tensor = ctx.Input(1);
-  DataType input0_dt = input0_tensor->GetDataType();
-  DataType input1_dt = input1_tensor->GetDataType();
+  DataType input0_dt = ctx.Input(0)->GetDataType();
+  DataType input1_dt = ctx.Input(1)->GetDataType();
   KERNEL_CHECK_FALSE((input0_dt == input1_dt), KERNEL_STATUS_INNER_ERROR,
                      "Input[x1] data type[%s] and input[x2] data type[%s] "
                      "must be same.",
                      DTypeStr(input0_dt).c_str(), DTypeStr(input1_dt).c_str());
-  auto input0_shape = input0_tensor->GetTensorShape()->GetDimSizes();
-  auto input0_elements_num = input0_tensor->NumElements();
-  TensorMap<T> input0(reinterpret_cast<T *>(input0_tensor->GetData()),
-                      input0_elements_num);
-  auto input1_shape = input1_tensor->GetTensorShape()->GetDimSizes();
-  auto input1_elements_num = input1_tensor->NumElements();
-  TensorMap<T> input1(reinterpret_cast<T *>(input1_tensor->GetData()),
-                      input1_elements_num);
-  auto output_tensor = ctx.Output(kFirstOutputIndex);
-  auto output_elements_num = output_tensor->NumElements();
-  TensorMap<T> output(reinterpret_cast<T *>(output_tensor->GetData()),
-                      output_elements_num);
-
-  Bcast bcast(input0_shape, input1_shape);
-  if (!bcast.IsValid()) {
-    KERNEL_LOG_ERROR("[%s] broadcast failed.", ctx.GetOpType().c_str());
-    return KERNEL_STATUS_PARAM_INVALID;
-  }
-  int32_t rank = static_cast<int32_t>(bcast.XReshape().size());
-  switch (rank) {
-    case kRank1:
-      return BroadcastCompute<T, kRank1>(input0, input1, output, bcast);
-    case kRank2:
-      return BroadcastCompute<T, kRank2>(input0, input1, output, bcast);
-    case kRank3:
-      return BroadcastCompute<T, kRank3>(input0, input1, output, bcast);
-    case kRank4:
-      return BroadcastCompute<T, kRank4>(input0, input1, output, bcast);
-    case kRank5:
-      return BroadcastCompute<T, kRank5>(input0, input1, output, bcast);
-    case kRank6:
-      return BroadcastCompute<T, kRank6>(input0, input1, output, bcast);
-    case kRank7:
-      return BroadcastCompute<T, kRank7>(input0, input1, output, bcast);
-    case kRank8:
-      return BroadcastCompute<T, kRank8>(input0, input1, output, bcast);
-    default:
-      KERNEL_LOG_ERROR("sub kernel rank exceed %d.", rank);
-      return KERNEL_STATUS_PARAM_INVALID;
-  }
+  return BroadcastBinaryCompute<T>(
+      ctx, [](const T &a, const T &b) { return a - b; });
 }
 
 uint32_t SubCpuKernel::Compute(CpuKernelContext &ctx) {
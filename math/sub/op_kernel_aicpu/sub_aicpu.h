@@ -12,15 +12,9 @@
 #define AICPU_KERNELS_NORMALIZED_SUB_H
 
 #include "cpu_kernel.h"
-#include "unsupported/Eigen/CXX11/Tensor"
 #include "utils/bcast.h"
 
 namespace aicpu {
-template <typename T>
-using TensorMap =
-    Eigen::TensorMap<Eigen::Tensor<T, 1, Eigen::RowMajor, Eigen::DenseIndex>,
-                     Eigen::Aligned>;
-
 class SubCpuKernel : public CpuKernel {
  public:
   SubCpuKernel() = default;
@@ -31,10 +25,6 @@ class SubCpuKernel : public CpuKernel {
  private:
   template <typename T>
   uint32_t DoCompute(const CpuKernelContext &ctx);
-
-  template <typename T, int32_t RANK>
-  uint32_t BroadcastCompute(TensorMap<T> &x, TensorMap<T> &y, TensorMap<T> &out,
-                            const Bcast &bcast);
 };
 }  // namespace aicpu
 #endif
@@ -23,6 +23,7 @@ public:
         this->Output("y").DataType({ge::DT_FLOAT, ge::DT_FLOAT16, ge::DT_DOUBLE, ge::DT_UINT8, ge::DT_INT8, ge::DT_UINT16,
                                     ge::DT_INT16, ge::DT_INT32, ge::DT_INT64, ge::DT_COMPLEX64, ge::DT_COMPLEX128});
 
+        ApplyStridedViewAttrs(*this, 2);
         ApplyMathAicpuDefaultCfg(*this);
     }
 };
@@ -534,4 +534,19 @@ TEST_F(l2_sub_test, Ascend950PR_89_case_005)
 
     // SAMPLE: precision simulate
     // ut.TestPrecision();
-}
\ No newline at end of file
+}
+
+// AICPU路由的dtype（int16）非连续输入不经过Contiguous
+TEST_F(l2_sub_test, case_int16_non_contiguous_aicpu)
+{
+    auto self_tensor_desc = TensorDesc({2, 3}, ACL_INT16, ACL_FORMAT_ND, {1, 2}, 0, {3, 2}).ValueRange(-10, 10);
+    auto other_tensor_desc = TensorDesc({2, 3}, ACL_INT16, ACL_FORMAT_ND, {1, 2}, 0, {3, 2}).ValueRange(-10, 10);
+    auto out_tensor_desc = TensorDesc({2, 3}, ACL_INT16, ACL_FORMAT_ND);
+    auto scalar_desc = ScalarDesc(static_cast<int16_t>(1));
+
+    auto ut = OP_API_UT(aclnnSub, INPUT(self_tensor_desc, other_tensor_desc, scalar_desc), OUTPUT(out_tensor_desc));
+
+    uint64_t workspace_size = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspace_size);
+    EXPECT_EQ(aclRet, ACL_SUCCESS);
+}
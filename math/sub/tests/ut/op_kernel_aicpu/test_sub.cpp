@@ -476,3 +476,53 @@ TEST_F(TEST_SUB_UT, LARGE_DATA_BCAST_PARALLEL_SUCC)
     bool compare = CompareResult(output, output_exp, output_size);
     EXPECT_EQ(compare, true);
 }
+
+// x2 is a [2, 3] slice with row stride 8 and column stride 2 starting at element 1 of a 16 element storage.
+TEST_F(TEST_SUB_UT, DATA_TYPE_INT32_STRIDED_VIEW_SUCC)
+{
+    vector<DataType> data_types = {DT_INT32, DT_INT32, DT_INT32};
+    vector<vector<int64_t>> shapes = {{2, 3}, {16}, {2, 3}};
+
+    int32_t input1[6] = {10, 20, 30, 40, 50, 60};
+    int32_t input2[16];
+    for (int32_t i = 0; i < 16; ++i) {
+        input2[i] = i;
+    }
+    int32_t output[6] = {0};
+    vector<void*> datas = {(void*)input1, (void*)input2, (void*)output};
+
+    auto node_def = CpuKernelUtils::CreateNodeDef();
+    NodeDefBuilder(node_def.get(), "Sub", "Sub")
+        .Input({"x1", data_types[0], shapes[0], datas[0]})
+        .Input({"x2", data_types[1], shapes[1], datas[1]})
+        .Output({"y", data_types[2], shapes[2], datas[2]})
+        .Attr("view_shape_1", vector<int64_t>{2, 3})
+        .Attr("view_strides_1", vector<int64_t>{8, 2})
+        .Attr("view_offset_1", static_cast<int64_t>(1));
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+    int32_t output_exp[6] = {10 - 1, 20 - 3, 30 - 5, 40 - 9, 50 - 11, 60 - 13};
+    bool compare = CompareResult(output, output_exp, 6);
+    EXPECT_EQ(compare, true);
+}
+
+TEST_F(TEST_SUB_UT, STRIDED_VIEW_OUT_OF_STORAGE_FAIL)
+{
+    vector<DataType> data_types = {DT_INT32, DT_INT32, DT_INT32};
+    vector<vector<int64_t>> shapes = {{2, 3}, {8}, {2, 3}};
+
+    int32_t input1[6] = {0};
+    int32_t input2[8] = {0};
+    int32_t output[6] = {0};
+    vector<void*> datas = {(void*)input1, (void*)input2, (void*)output};
+
+    auto node_def = CpuKernelUtils::CreateNodeDef();
+    NodeDefBuilder(node_def.get(), "Sub", "Sub")
+        .Input({"x1", data_types[0], shapes[0], datas[0]})
+        .Input({"x2", data_types[1], shapes[1], datas[1]})
+        .Output({"y", data_types[2], shapes[2], datas[2]})
+        .Attr("view_shape_1", vector<int64_t>{2, 3})
+        .Attr("view_strides_1", vector<int64_t>{8, 2})
+        .Attr("view_offset_1", static_cast<int64_t>(1));
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
+}
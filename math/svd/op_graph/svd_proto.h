@@ -0,0 +1,52 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file svd_proto.h
+ * \brief
+ */
+#ifndef OPS_OP_PROTO_INC_SVD_OPS_H_
+#define OPS_OP_PROTO_INC_SVD_OPS_H_
+
+#include "graph/operator.h"
+#include "graph/operator_reg.h"
+
+namespace ge {
+/**
+* @brief Computes the singular value decompositions of one or more matrices, x = u * diag(sigma) * v^H. \n
+
+* @par Inputs:
+* x: A tensor of shape [..., M, N]. Must be one of the following types: float32, double, complex64, complex128. \n
+
+* @par Attributes:
+* @li compute_uv: An optional bool. If true, u and v are computed, otherwise only sigma. Default: True.
+* @li full_matrices: An optional bool. If true, u and v are square, otherwise they only have min(M, N) columns.
+* Default: False. \n
+
+* @par Outputs:
+* @li sigma: Singular values in descending order, of shape [..., min(M, N)].
+* @li u: Left singular vectors, of shape [..., M, M] (full_matrices) or [..., M, min(M, N)].
+* @li v: Right singular vectors, of shape [..., N, N] (full_matrices) or [..., N, min(M, N)]. \n
+
+* @par Third-party framework compatibility
+* Compatible with tensorflow Svd operator.
+*/
+REG_OP(Svd)
+    .INPUT(x, TensorType({DT_FLOAT, DT_DOUBLE, DT_COMPLEX64, DT_COMPLEX128}))
+    .OUTPUT(sigma, TensorType({DT_FLOAT, DT_DOUBLE, DT_COMPLEX64, DT_COMPLEX128}))
+    .OUTPUT(u, TensorType({DT_FLOAT, DT_DOUBLE, DT_COMPLEX64, DT_COMPLEX128}))
+    .OUTPUT(v, TensorType({DT_FLOAT, DT_DOUBLE, DT_COMPLEX64, DT_COMPLEX128}))
+    .ATTR(compute_uv, Bool, true)
+    .ATTR(full_matrices, Bool, false)
+    .OP_END_FACTORY_REG(Svd)
+
+} // namespace ge
+
+#endif // OPS_OP_PROTO_INC_SVD_OPS_H_
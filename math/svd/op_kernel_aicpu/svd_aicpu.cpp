@@ -0,0 +1,459 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "svd_aicpu.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include "aicpu/householder_qr.h"
+#include "cpu_kernel_utils.h"
+#include "utils/kernel_util.h"
+
+namespace {
+const char* const kSvd = "Svd";
+constexpr int64_t kMatrixRank = 2;
+constexpr int64_t kSvdMaxSweeps = 40;
+// Same batch / single matrix split as the Qr kernel.
+constexpr int64_t kSvdSplitElements = 128 * 128;
+
+/**
+ * One-sided Jacobi SVD of a p x q (p >= q) column-major matrix b, preconditioned by QR (Drmac & Veselic):
+ * b = Q [R; 0] and the Jacobi sweeps orthogonalize the columns of X = R^H, i.e. X J = W. Working on the q x q
+ * triangular factor instead of b keeps every rotation at O(q) and the transposed factor converges in fewer sweeps.
+ * Then R = J Sigma U_x^H with U_x = W / Sigma, so b = (Q diag(J, I)) Sigma U_x^H.
+ */
+template <typename T>
+class JacobiSvd {
+public:
+    using Traits = aicpu::LinalgTraits<T>;
+    using Real = typename Traits::Real;
+
+    // b (p x q, p >= q) is overwritten. u_cols is p (full) or q; u_cols == 0 skips the singular vectors.
+    void Compute(T* b, int64_t p, int64_t q, int64_t u_cols, const aicpu::LinalgRunner& run)
+    {
+        p_ = p;
+        q_ = q;
+        const bool vectors = u_cols > 0;
+        qr_.Factor(b, p, q, run);
+        x_.assign(static_cast<size_t>(q * q), T(0));
+        for (int64_t j = 0; j < q; j++) {
+            for (int64_t i = j; i < q; i++) {
+                x_[j * q + i] = Traits::Conj(b[i * p + j]);
+            }
+        }
+        j_.assign(vectors ? static_cast<size_t>(q * q) : 0, T(0));
+        for (int64_t i = 0; vectors && i < q; i++) {
+            j_[i * q + i] = T(1);
+        }
+        Sweep(vectors, run);
+
+        sigma_.assign(static_cast<size_t>(q), static_cast<Real>(0));
+        for (int64_t j = 0; j < q; j++) {
+            sigma_[j] = std::sqrt(ColumnNorm2(x_.data() + j * q));
+        }
+        order_.resize(static_cast<size_t>(q));
+        std::iota(order_.begin(), order_.end(), 0);
+        std::stable_sort(order_.begin(), order_.end(), [this](int64_t l, int64_t r) { return sigma_[l] > sigma_[r]; });
+        if (!vectors) {
+            return;
+        }
+        // U = Q diag(J, I) with the columns of J in singular value order.
+        u_.resize(static_cast<size_t>(p * u_cols));
+        qr_.FormQ(b, u_.data(), u_cols, run);
+        std::vector<T> row(static_cast<size_t>(q));
+        for (int64_t i = 0; i < p; i++) {
+            for (int64_t c = 0; c < q; c++) {
+                T sum = T(0);
+                for (int64_t t = 0; t < q; t++) {
+                    sum += u_[t * p + i] * j_[order_[c] * q + t];
+                }
+                row[c] = sum;
+            }
+            for (int64_t c = 0; c < q; c++) {
+                u_[c * p + i] = row[c];
+            }
+        }
+        BuildRightVectors();
+    }
+
+    Real Sigma(int64_t j) const
+    {
+        return sigma_[order_[j]];
+    }
+
+    // U (p x u_cols) and V (q x q), column-major.
+    const T* U() const
+    {
+        return u_.data();
+    }
+
+    const T* V() const
+    {
+        return v_.data();
+    }
+
+private:
+    Real ColumnNorm2(const T* col) const
+    {
+        Real sum = 0;
+        for (int64_t i = 0; i < q_; i++) {
+            sum += Traits::Abs2(col[i]);
+        }
+        return sum;
+    }
+
+    /**
+     * Cyclic sweeps in tournament order: every step pairs up all the columns, so the q / 2 rotations of a step
+     * touch disjoint columns and can run concurrently.
+     */
+    void Sweep(bool vectors, const aicpu::LinalgRunner& run)
+    {
+        const int64_t q = q_;
+        if (q < 2) {
+            return;
+        }
+        const int64_t players = q + (q % 2);
+        std::vector<int64_t> seat(static_cast<size_t>(players));
+        const Real tol = std::numeric_limits<Real>::epsilon() * static_cast<Real>(q);
+        for (int64_t sweep = 0; sweep < kSvdMaxSweeps; sweep++) {
+            std::atomic<bool> rotated(false);
+            std::iota(seat.begin(), seat.end(), 0);
+            for (int64_t step = 0; step < players - 1; step++) {
+                auto rotate_pairs = [this, &seat, &rotated, players, q, tol, vectors](int64_t begin, int64_t end) {
+                    for (int64_t k = begin; k < end; k++) {
+                        const int64_t l = std::min(seat[k], seat[players - 1 - k]);
+                        const int64_t r = std::max(seat[k], seat[players - 1 - k]);
+                        if (r < q && Rotate(l, r, tol, vectors)) {
+                            rotated.store(true, std::memory_order_relaxed);
+                        }
+                    }
+                };
+                // A rotation costs about 8 * q flops (16 * q with vectors).
+                run(players / 2, std::max<int64_t>(1, (64 * 1024) / (16 * q)), rotate_pairs);
+                std::rotate(seat.begin() + 1, seat.end() - 1, seat.end());
+            }
+            if (!rotated.load()) {
+                break;
+            }
+        }
+    }
+
+    // Orthogonalizes columns l and r of X; returns whether a rotation was applied.
+    bool Rotate(int64_t l, int64_t r, Real tol, bool vectors)
+    {
+        const int64_t q = q_;
+        T* xl = x_.data() + l * q;
+        T* xr = x_.data() + r * q;
+        Real alpha = 0;
+        Real beta = 0;
+        T gamma = T(0);
+        for (int64_t i = 0; i < q; i++) {
+            alpha += Traits::Abs2(xl[i]);
+            beta += Traits::Abs2(xr[i]);
+            gamma += Traits::Conj(xl[i]) * xr[i];
+        }
+        const Real g = std::sqrt(Traits::Abs2(gamma));
+        if (alpha == static_cast<Real>(0) || beta == static_cast<Real>(0) || g <= tol * std::sqrt(alpha * beta)) {
+            return false;
+        }
+        // Real rotation of xl and e^{-i arg(gamma)} xr, then the phase is moved back onto the right column.
+        const Real zeta = (beta - alpha) / (static_cast<Real>(2) * g);
+        const Real t = (zeta >= 0 ? static_cast<Real>(1) : static_cast<Real>(-1)) /
+                       (std::fabs(zeta) + std::sqrt(static_cast<Real>(1) + zeta * zeta));
+        const Real c = static_cast<Real>(1) / std::sqrt(static_cast<Real>(1) + t * t);
+        const Real s = c * t;
+        const T phase = gamma / T(g);
+        const T s_right = T(s) * phase;
+        const T s_left = T(s) * Traits::Conj(phase);
+        ApplyRotation(xl, xr, q, c, s_left, s_right);
+        if (vectors) {
+            ApplyRotation(j_.data() + l * q, j_.data() + r * q, q, c, s_left, s_right);
+        }
+        return true;
+    }
+
+    // [xl, xr] = [xl, xr] * [[c, s_right], [-s_left, c]]
+    static void ApplyRotation(T* xl, T* xr, int64_t len, Real c, const T& s_left, const T& s_right)
+    {
+        for (int64_t i = 0; i < len; i++) {
+            const T left = xl[i];
+            const T right = xr[i];
+            xl[i] = T(c) * left - s_left * right;
+            xr[i] = s_right * left + T(c) * right;
+        }
+    }
+
+    // U_x = W / Sigma; columns of (numerically) zero singular values are completed to an orthonormal basis.
+    void BuildRightVectors()
+    {
+        const int64_t q = q_;
+        v_.assign(static_cast<size_t>(q * q), T(0));
+        const Real floor = (q > 0 ? sigma_[order_[0]] : static_cast<Real>(0)) * std::numeric_limits<Real>::epsilon() *
+                           static_cast<Real>(q);
+        std::vector<int64_t> missing;
+        for (int64_t c = 0; c < q; c++) {
+            const Real s = sigma_[order_[c]];
+            if (s <= floor || s == static_cast<Real>(0)) {
+                missing.push_back(c);
+                continue;
+            }
+            const T* w = x_.data() + order_[c] * q;
+            for (int64_t i = 0; i < q; i++) {
+                v_[c * q + i] = w[i] / T(s);
+            }
+        }
+        int64_t candidate = 0;
+        for (int64_t c : missing) {
+            T* v = v_.data() + c * q;
+            for (; candidate < q; candidate++) {
+                std::fill(v, v + q, T(0));
+                v[candidate] = T(1);
+                // Two Gram-Schmidt passes against every column filled so far.
+                for (int pass = 0; pass < 2; pass++) {
+                    for (int64_t o = 0; o < q; o++) {
+                        if (o == c) {
+                            continue;
+                        }
+                        const T* u = v_.data() + o * q;
+                        T dot = T(0);
+                        for (int64_t i = 0; i < q; i++) {
+                            dot += Traits::Conj(u[i]) * v[i];
+                        }
+                        for (int64_t i = 0; i < q; i++) {
+                            v[i] -= u[i] * dot;
+                        }
+                    }
+                }
+                const Real norm = std::sqrt(ColumnNorm2(v));
+                if (norm > static_cast<Real>(0.5)) {
+                    for (int64_t i = 0; i < q; i++) {
+                        v[i] /= T(norm);
+                    }
+                    candidate++;
+                    break;
+                }
+            }
+        }
+    }
+
+    int64_t p_ = 0;
+    int64_t q_ = 0;
+    aicpu::HouseholderQr<T> qr_;
+    std::vector<T> x_;
+    std::vector<T> j_;
+    std::vector<T> u_;
+    std::vector<T> v_;
+    std::vector<Real> sigma_;
+    std::vector<int64_t> order_;
+};
+} // namespace
+
+namespace aicpu {
+uint32_t SvdCpuKernel::Compute(CpuKernelContext& ctx)
+{
+    SvdParams params;
+    KERNEL_HANDLE_ERROR(ParseParams(ctx, params), "[%s] check params failed.", kSvd);
+    auto data_type = ctx.Input(kFirstInputIndex)->GetDataType();
+    switch (data_type) {
+        case DT_FLOAT:
+            return SvdCompute<float>(ctx, params);
+        case DT_DOUBLE:
+            return SvdCompute<double>(ctx, params);
+        case DT_COMPLEX64:
+            return SvdCompute<std::complex<float>>(ctx, params);
+        case DT_COMPLEX128:
+            return SvdCompute<std::complex<double>>(ctx, params);
+        default:
+            KERNEL_LOG_ERROR("[%s] invalid input type [%s]", kSvd, DTypeStr(data_type).c_str());
+            return KERNEL_STATUS_PARAM_INVALID;
+    }
+}
+
+uint32_t SvdCpuKernel::ParseParams(const CpuKernelContext& ctx, SvdParams& params) const
+{
+    Tensor* input = ctx.Input(kFirstInputIndex);
+    Tensor* sigma = ctx.Output(kFirstOutputIndex);
+    KERNEL_CHECK_NULLPTR(input, KERNEL_STATUS_PARAM_INVALID, "[%s] get input failed.", kSvd)
+    KERNEL_CHECK_NULLPTR(sigma, KERNEL_STATUS_PARAM_INVALID, "[%s] get output sigma failed.", kSvd)
+    KERNEL_CHECK_NULLPTR(input->GetTensorShape(), KERNEL_STATUS_PARAM_INVALID, "[%s] get input shape failed.", kSvd)
+    KERNEL_CHECK_NULLPTR(sigma->GetTensorShape(), KERNEL_STATUS_PARAM_INVALID, "[%s] get sigma shape failed.", kSvd)
+    const DataType data_type = input->GetDataType();
+    const DataType real_type = (data_type == DT_COMPLEX64) ? DT_FLOAT :
+                               (data_type == DT_COMPLEX128) ? DT_DOUBLE : data_type;
+    params.complex_sigma = (sigma->GetDataType() == data_type && data_type != real_type);
+    KERNEL_CHECK_FALSE(sigma->GetDataType() == data_type || sigma->GetDataType() == real_type,
+                       KERNEL_STATUS_PARAM_INVALID, "[%s] sigma type [%s] should be [%s] or [%s].", kSvd,
+                       DTypeStr(sigma->GetDataType()).c_str(), DTypeStr(data_type).c_str(),
+                       DTypeStr(real_type).c_str());
+
+    std::vector<int64_t> dims = input->GetTensorShape()->GetDimSizes();
+    const int32_t rank = static_cast<int32_t>(dims.size());
+    KERNEL_CHECK_FALSE(rank >= kMatrixRank, KERNEL_STATUS_PARAM_INVALID, "[%s] input rank [%d] should be at least 2.",
+                       kSvd, rank);
+    params.m = dims[rank - 2];
+    params.n = dims[rank - 1];
+    params.batch = 1;
+    for (int32_t i = 0; i < rank - kMatrixRank; i++) {
+        params.batch *= dims[i];
+    }
+    AttrValue* full_attr = ctx.GetAttr("full_matrices");
+    params.full_matrices = (full_attr == nullptr) ? false : full_attr->GetBool();
+    AttrValue* uv_attr = ctx.GetAttr("compute_uv");
+    params.compute_uv = (uv_attr == nullptr) ? true : uv_attr->GetBool();
+
+    const int64_t k = std::min(params.m, params.n);
+    std::vector<int64_t> batch_dims(dims.begin(), dims.end() - kMatrixRank);
+    std::vector<int64_t> sigma_dims = batch_dims;
+    sigma_dims.push_back(k);
+    KERNEL_CHECK_FALSE(sigma->GetTensorShape()->GetDimSizes() == sigma_dims, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] sigma shape should be [..., %ld].", kSvd, k);
+    if (params.batch * params.m * params.n > 0) {
+        KERNEL_CHECK_NULLPTR(input->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] get input data failed.", kSvd)
+    }
+    if (params.batch * k > 0) {
+        KERNEL_CHECK_NULLPTR(sigma->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] get sigma data failed.", kSvd)
+    }
+    if (!params.compute_uv) {
+        return KERNEL_STATUS_OK;
+    }
+
+    params.u_cols = params.full_matrices ? params.m : k;
+    params.v_cols = params.full_matrices ? params.n : k;
+    Tensor* u = ctx.Output(kSecondOutputIndex);
+    Tensor* v = ctx.Output(kThirdOutputIndex);
+    KERNEL_CHECK_NULLPTR(u, KERNEL_STATUS_PARAM_INVALID, "[%s] get output u failed.", kSvd)
+    KERNEL_CHECK_NULLPTR(v, KERNEL_STATUS_PARAM_INVALID, "[%s] get output v failed.", kSvd)
+    KERNEL_CHECK_NULLPTR(u->GetTensorShape(), KERNEL_STATUS_PARAM_INVALID, "[%s] get u shape failed.", kSvd)
+    KERNEL_CHECK_NULLPTR(v->GetTensorShape(), KERNEL_STATUS_PARAM_INVALID, "[%s] get v shape failed.", kSvd)
+    KERNEL_CHECK_FALSE(u->GetDataType() == data_type && v->GetDataType() == data_type, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] u [%s] and v [%s] should have the input type [%s].", kSvd,
+                       DTypeStr(u->GetDataType()).c_str(), DTypeStr(v->GetDataType()).c_str(),
+                       DTypeStr(data_type).c_str());
+    std::vector<int64_t> u_dims = batch_dims;
+    std::vector<int64_t> v_dims = batch_dims;
+    u_dims.push_back(params.m);
+    u_dims.push_back(params.u_cols);
+    v_dims.push_back(params.n);
+    v_dims.push_back(params.v_cols);
+    KERNEL_CHECK_FALSE(u->GetTensorShape()->GetDimSizes() == u_dims, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] u shape should be [..., %ld, %ld].", kSvd, params.m, params.u_cols);
+    KERNEL_CHECK_FALSE(v->GetTensorShape()->GetDimSizes() == v_dims, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] v shape should be [..., %ld, %ld].", kSvd, params.n, params.v_cols);
+    if (params.batch * params.m * params.u_cols > 0) {
+        KERNEL_CHECK_NULLPTR(u->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] get u data failed.", kSvd)
+    }
+    if (params.batch * params.n * params.v_cols > 0) {
+        KERNEL_CHECK_NULLPTR(v->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] get v data failed.", kSvd)
+    }
+    return KERNEL_STATUS_OK;
+}
+
+/**
+ * A wide matrix is decomposed through its adjoint: A^H = U' S V'^H gives A = V' S U'^H, so u and v swap roles.
+ * full_matrices only changes how many columns of the tall side's basis are written.
+ */
+template <typename T>
+uint32_t SvdCpuKernel::SvdCompute(const CpuKernelContext& ctx, const SvdParams& params) const
+{
+    using Traits = LinalgTraits<T>;
+    using Real = typename Traits::Real;
+    const int64_t m = params.m;
+    const int64_t n = params.n;
+    const bool tall = m >= n;
+    const int64_t p = tall ? m : n;
+    const int64_t q = tall ? n : m;
+    const bool compute_uv = params.compute_uv;
+    // Columns of the tall side basis, i.e. of u for a tall matrix and of v for a wide one.
+    const int64_t tall_cols = compute_uv ? (params.full_matrices ? p : q) : 0;
+    const bool complex_sigma = params.complex_sigma;
+    const T* input = reinterpret_cast<const T*>(ctx.Input(kFirstInputIndex)->GetData());
+    void* sigma_out = ctx.Output(kFirstOutputIndex)->GetData();
+    T* u_out = compute_uv ? reinterpret_cast<T*>(ctx.Output(kSecondOutputIndex)->GetData()) : nullptr;
+    T* v_out = compute_uv ? reinterpret_cast<T*>(ctx.Output(kThirdOutputIndex)->GetData()) : nullptr;
+    const int64_t u_cols = params.u_cols;
+    const int64_t v_cols = params.v_cols;
+
+    auto decompose = [=](int64_t start, int64_t end, const LinalgRunner& run) {
+        std::vector<T> b(static_cast<size_t>(p * q));
+        JacobiSvd<T> svd;
+        for (int64_t batch = start; batch < end; batch++) {
+            const T* a = input + batch * m * n;
+            for (int64_t i = 0; i < m; i++) {
+                for (int64_t j = 0; j < n; j++) {
+                    if (tall) {
+                        b[j * p + i] = a[i * n + j];
+                    } else {
+                        b[i * p + j] = Traits::Conj(a[i * n + j]);
+                    }
+                }
+            }
+            svd.Compute(b.data(), p, q, tall_cols, run);
+            for (int64_t j = 0; j < q; j++) {
+                if (complex_sigma) {
+                    reinterpret_cast<T*>(sigma_out)[batch * q + j] = T(svd.Sigma(j));
+                } else {
+                    reinterpret_cast<Real*>(sigma_out)[batch * q + j] = svd.Sigma(j);
+                }
+            }
+            if (!compute_uv) {
+                continue;
+            }
+            // Tall side basis is p x tall_cols, the other one q x q; both column-major.
+            T* tall_out = tall ? u_out + batch * m * u_cols : v_out + batch * n * v_cols;
+            T* short_out = tall ? v_out + batch * n * v_cols : u_out + batch * m * u_cols;
+            for (int64_t i = 0; i < p; i++) {
+                for (int64_t j = 0; j < tall_cols; j++) {
+                    tall_out[i * tall_cols + j] = svd.U()[j * p + i];
+                }
+            }
+            for (int64_t i = 0; i < q; i++) {
+                for (int64_t j = 0; j < q; j++) {
+                    short_out[i * q + j] = svd.V()[j * q + i];
+                }
+            }
+        }
+    };
+
+    if (params.batch == 0) {
+        return KERNEL_STATUS_OK;
+    }
+    const int64_t cores = std::max<int64_t>(1, static_cast<int64_t>(CpuKernelUtils::GetCPUNum(ctx)));
+    if (cores == 1 || (params.batch == 1 && m * n < kSvdSplitElements)) {
+        decompose(0, params.batch, LinalgRunSerial);
+        return KERNEL_STATUS_OK;
+    }
+    if (params.batch >= cores || m * n < kSvdSplitElements) {
+        auto shard = [&decompose](int64_t start, int64_t end) { decompose(start, end, LinalgRunSerial); };
+        KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, params.batch, (params.batch + cores - 1) / cores, shard),
+                            "[%s] ParallelFor failed.", kSvd)
+        return KERNEL_STATUS_OK;
+    }
+    uint32_t status = KERNEL_STATUS_OK;
+    auto split_run = [&ctx, &status, cores](int64_t total, int64_t min_chunk, const LinalgRangeFn& fn) {
+        const int64_t per_unit = std::max(min_chunk, (total + cores - 1) / cores);
+        if (total <= per_unit) {
+            LinalgRunSerial(total, min_chunk, fn);
+        } else if (CpuKernelUtils::ParallelFor(ctx, total, per_unit, fn) != KERNEL_STATUS_OK) {
+            status = KERNEL_STATUS_INNER_ERROR;
+        }
+    };
+    decompose(0, params.batch, split_run);
+    KERNEL_CHECK_FALSE(status == KERNEL_STATUS_OK, status, "[%s] ParallelFor failed.", kSvd);
+    return KERNEL_STATUS_OK;
+}
+
+REGISTER_CPU_KERNEL(kSvd, SvdCpuKernel);
+} // namespace aicpu
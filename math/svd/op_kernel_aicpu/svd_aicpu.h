@@ -0,0 +1,44 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef AICPU_KERNELS_SVD_H_
+#define AICPU_KERNELS_SVD_H_
+
+#include <cstdint>
+
+#include "cpu_kernel.h"
+
+namespace aicpu {
+// batch matrices of m x n; u is m x u_cols and v is n x v_cols, both unused unless compute_uv.
+struct SvdParams {
+    int64_t batch = 0;
+    int64_t m = 0;
+    int64_t n = 0;
+    int64_t u_cols = 0;
+    int64_t v_cols = 0;
+    bool full_matrices = false;
+    bool compute_uv = true;
+    // sigma has the complex input type (imaginary parts zero) instead of the matching real type.
+    bool complex_sigma = false;
+};
+
+class SvdCpuKernel : public CpuKernel {
+public:
+    SvdCpuKernel() = default;
+    ~SvdCpuKernel() override = default;
+    uint32_t Compute(CpuKernelContext& ctx) override;
+
+private:
+    uint32_t ParseParams(const CpuKernelContext& ctx, SvdParams& params) const;
+    template <typename T>
+    uint32_t SvdCompute(const CpuKernelContext& ctx, const SvdParams& params) const;
+};
+} // namespace aicpu
+#endif // AICPU_KERNELS_SVD_H_
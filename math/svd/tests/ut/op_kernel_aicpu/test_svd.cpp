@@ -0,0 +1,299 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <cmath>
+#include <complex>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "utils/aicpu_test_utils.h"
+#include "cpu_kernel_utils.h"
+#include "node_def_builder.h"
+
+using namespace std;
+using namespace aicpu;
+
+class TEST_SVD_UT : public testing::Test {};
+
+#define CREATE_NODEDEF(shapes, data_types, datas, compute_uv, full_matrices) \
+    auto node_def = CpuKernelUtils::CreateNodeDef();                         \
+    NodeDefBuilder(node_def.get(), "Svd", "Svd")                             \
+        .Input({"x", data_types[0], shapes[0], datas[0]})                    \
+        .Output({"sigma", data_types[1], shapes[1], datas[1]})               \
+        .Output({"u", data_types[2], shapes[2], datas[2]})                   \
+        .Output({"v", data_types[3], shapes[3], datas[3]})                   \
+        .Attr("compute_uv", (bool)(compute_uv))                              \
+        .Attr("full_matrices", (bool)(full_matrices))
+
+namespace {
+double Widen(float v)
+{
+    return v;
+}
+
+double Widen(double v)
+{
+    return v;
+}
+
+template <typename R>
+complex<double> Widen(const complex<R>& v)
+{
+    return complex<double>(v.real(), v.imag());
+}
+
+double Conj(double v)
+{
+    return v;
+}
+
+complex<double> Conj(const complex<double>& v)
+{
+    return conj(v);
+}
+
+template <typename T>
+vector<T> RandomMatrix(size_t num);
+
+template <>
+vector<float> RandomMatrix<float>(size_t num)
+{
+    vector<float> values(num);
+    SetRandomValue<float>(values.data(), num, -1.0, 1.0);
+    return values;
+}
+
+template <>
+vector<double> RandomMatrix<double>(size_t num)
+{
+    vector<double> values(num);
+    SetRandomValue<double>(values.data(), num, -1.0, 1.0);
+    return values;
+}
+
+template <>
+vector<complex<float>> RandomMatrix<complex<float>>(size_t num)
+{
+    vector<float> raw = RandomMatrix<float>(num * 2);
+    vector<complex<float>> values(num);
+    for (size_t i = 0; i < num; i++) {
+        values[i] = complex<float>(raw[2 * i], raw[2 * i + 1]);
+    }
+    return values;
+}
+
+// Columns of the rows x cols row-major matrix x are orthonormal.
+template <typename T>
+bool CheckOrthonormal(const T* x, int64_t rows, int64_t cols, double tol)
+{
+    for (int64_t i = 0; i < cols; i++) {
+        for (int64_t j = 0; j < cols; j++) {
+            decltype(Widen(x[0])) dot = 0;
+            for (int64_t t = 0; t < rows; t++) {
+                dot += Conj(Widen(x[t * cols + i])) * Widen(x[t * cols + j]);
+            }
+            if (abs(dot - (i == j ? 1.0 : 0.0)) > tol) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// sigma is descending and U diag(sigma) V^H rebuilds every matrix of the batch.
+template <typename T, typename S>
+bool CheckSvd(const vector<T>& a, const vector<S>& sigma, const vector<T>& u, const vector<T>& v, int64_t batch,
+              int64_t m, int64_t n, bool full_matrices, double tol)
+{
+    const int64_t k = min(m, n);
+    const int64_t u_cols = full_matrices ? m : k;
+    const int64_t v_cols = full_matrices ? n : k;
+    for (int64_t b = 0; b < batch; b++) {
+        const T* ab = a.data() + b * m * n;
+        const S* sb = sigma.data() + b * k;
+        const T* ub = u.data() + b * m * u_cols;
+        const T* vb = v.data() + b * n * v_cols;
+        for (int64_t j = 1; j < k; j++) {
+            if (abs(Widen(sb[j])) > abs(Widen(sb[j - 1])) + tol) {
+                return false;
+            }
+        }
+        if (!CheckOrthonormal(ub, m, u_cols, tol) || !CheckOrthonormal(vb, n, v_cols, tol)) {
+            return false;
+        }
+        for (int64_t i = 0; i < m; i++) {
+            for (int64_t j = 0; j < n; j++) {
+                decltype(Widen(ab[0])) sum = 0;
+                for (int64_t t = 0; t < k; t++) {
+                    sum += Widen(ub[i * u_cols + t]) * abs(Widen(sb[t])) * Conj(Widen(vb[j * v_cols + t]));
+                }
+                if (abs(sum - Widen(ab[i * n + j])) > tol) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+template <typename T, typename S>
+bool RunSvd(DataType data_type, DataType sigma_type, int64_t batch, int64_t m, int64_t n, bool full_matrices,
+            double tol)
+{
+    const int64_t k = min(m, n);
+    const int64_t u_cols = full_matrices ? m : k;
+    const int64_t v_cols = full_matrices ? n : k;
+    vector<DataType> data_types = {data_type, sigma_type, data_type, data_type};
+    vector<vector<int64_t>> shapes = {{batch, m, n}, {batch, k}, {batch, m, u_cols}, {batch, n, v_cols}};
+    auto a = RandomMatrix<T>(batch * m * n);
+    vector<S> sigma(batch * k);
+    vector<T> u(batch * m * u_cols);
+    vector<T> v(batch * n * v_cols);
+    vector<void*> datas = {(void*)a.data(), (void*)sigma.data(), (void*)u.data(), (void*)v.data()};
+    CREATE_NODEDEF(shapes, data_types, datas, true, full_matrices);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    return CheckSvd(a, sigma, u, v, batch, m, n, full_matrices, tol);
+}
+} // namespace
+
+TEST_F(TEST_SVD_UT, FLOAT_DIAGONAL_SUCCESS)
+{
+    float a[6] = {0, 2, 0, 3, 0, 0};
+    float sigma[2] = {0};
+    float u[4] = {0};
+    float v[6] = {0};
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_FLOAT, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{2, 3}, {2}, {2, 2}, {3, 2}};
+    vector<void*> datas = {(void*)a, (void*)sigma, (void*)u, (void*)v};
+    CREATE_NODEDEF(shapes, data_types, datas, true, false);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+    float sigma_exp[2] = {3, 2};
+    EXPECT_TRUE(CompareResultAllClose(sigma, sigma_exp, 2));
+}
+
+TEST_F(TEST_SVD_UT, FLOAT_TALL_AND_WIDE_SUCCESS)
+{
+    bool tall = RunSvd<float, float>(DT_FLOAT, DT_FLOAT, 3, 40, 25, false, 1e-4);
+    bool wide = RunSvd<float, float>(DT_FLOAT, DT_FLOAT, 2, 17, 50, false, 1e-4);
+    EXPECT_TRUE(tall);
+    EXPECT_TRUE(wide);
+}
+
+TEST_F(TEST_SVD_UT, DOUBLE_FULL_MATRICES_SUCCESS)
+{
+    bool tall = RunSvd<double, double>(DT_DOUBLE, DT_DOUBLE, 2, 45, 30, true, 1e-11);
+    bool wide = RunSvd<double, double>(DT_DOUBLE, DT_DOUBLE, 2, 9, 33, true, 1e-11);
+    EXPECT_TRUE(tall);
+    EXPECT_TRUE(wide);
+}
+
+TEST_F(TEST_SVD_UT, COMPLEX64_FULL_MATRICES_SUCCESS)
+{
+    bool real_sigma = RunSvd<complex<float>, float>(DT_COMPLEX64, DT_FLOAT, 2, 30, 21, true, 1e-4);
+    bool complex_sigma = RunSvd<complex<float>, complex<float>>(DT_COMPLEX64, DT_COMPLEX64, 2, 12, 20, false, 1e-4);
+    EXPECT_TRUE(real_sigma);
+    EXPECT_TRUE(complex_sigma);
+}
+
+TEST_F(TEST_SVD_UT, DOUBLE_RANK_DEFICIENT_FULL_MATRICES_SUCCESS)
+{
+    const int64_t m = 7;
+    const int64_t n = 5;
+    vector<double> a(m * n, 0.0);
+    for (int64_t i = 0; i < m; i++) {
+        a[i * n + 1] = static_cast<double>(i + 1);
+        a[i * n + 3] = -0.5 * static_cast<double>(i + 1);
+    }
+    vector<double> sigma(n);
+    vector<double> u(m * m);
+    vector<double> v(n * n);
+    vector<DataType> data_types = {DT_DOUBLE, DT_DOUBLE, DT_DOUBLE, DT_DOUBLE};
+    vector<vector<int64_t>> shapes = {{m, n}, {n}, {m, m}, {n, n}};
+    vector<void*> datas = {(void*)a.data(), (void*)sigma.data(), (void*)u.data(), (void*)v.data()};
+    CREATE_NODEDEF(shapes, data_types, datas, true, true);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    EXPECT_TRUE(CheckSvd(a, sigma, u, v, 1, m, n, true, 1e-10));
+    EXPECT_NEAR(sigma[1], 0.0, 1e-10);
+}
+
+TEST_F(TEST_SVD_UT, FLOAT_SIGMA_ONLY_SUCCESS)
+{
+    const int64_t batch = 2;
+    const int64_t m = 24;
+    const int64_t n = 31;
+    auto a = RandomMatrix<float>(batch * m * n);
+    vector<float> sigma(batch * m);
+    vector<float> sigma_uv(batch * m);
+    vector<float> u(batch * m * m);
+    vector<float> v(batch * n * m);
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_FLOAT, DT_FLOAT};
+    {
+        vector<vector<int64_t>> shapes = {{batch, m, n}, {batch, m}, {}, {}};
+        vector<void*> datas = {(void*)a.data(), (void*)sigma.data(), nullptr, nullptr};
+        CREATE_NODEDEF(shapes, data_types, datas, false, false);
+        RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    }
+    {
+        vector<vector<int64_t>> shapes = {{batch, m, n}, {batch, m}, {batch, m, m}, {batch, n, m}};
+        vector<void*> datas = {(void*)a.data(), (void*)sigma_uv.data(), (void*)u.data(), (void*)v.data()};
+        CREATE_NODEDEF(shapes, data_types, datas, true, false);
+        RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    }
+    EXPECT_TRUE(CompareResultAllClose(sigma.data(), sigma_uv.data(), batch * m));
+}
+
+TEST_F(TEST_SVD_UT, DOUBLE_SINGLE_LARGE_MATRIX_SUCCESS)
+{
+    bool ok = RunSvd<double, double>(DT_DOUBLE, DT_DOUBLE, 1, 150, 130, false, 1e-10);
+    EXPECT_TRUE(ok);
+}
+
+TEST_F(TEST_SVD_UT, FLOAT_BATCH_64X64_SUCCESS)
+{
+    const int64_t batch = 128;
+    const int64_t m = 64;
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_FLOAT, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{batch, m, m}, {batch, m}, {batch, m, m}, {batch, m, m}};
+    auto a = RandomMatrix<float>(batch * m * m);
+    vector<float> sigma(batch * m);
+    vector<float> u(batch * m * m);
+    vector<float> v(batch * m * m);
+    vector<void*> datas = {(void*)a.data(), (void*)sigma.data(), (void*)u.data(), (void*)v.data()};
+    CREATE_NODEDEF(shapes, data_types, datas, true, false);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    EXPECT_TRUE(CheckSvd(a, sigma, u, v, 4, m, m, false, 1e-4));
+}
+
+TEST_F(TEST_SVD_UT, SIGMA_SHAPE_MISMATCH_FAILED)
+{
+    float a[6] = {0};
+    float sigma[3] = {0};
+    float u[4] = {0};
+    float v[6] = {0};
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_FLOAT, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{2, 3}, {3}, {2, 2}, {3, 2}};
+    vector<void*> datas = {(void*)a, (void*)sigma, (void*)u, (void*)v};
+    CREATE_NODEDEF(shapes, data_types, datas, true, false);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
+}
+
+TEST_F(TEST_SVD_UT, U_TYPE_MISMATCH_FAILED)
+{
+    float a[4] = {0};
+    float sigma[2] = {0};
+    double u[4] = {0};
+    float v[4] = {0};
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_DOUBLE, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{2, 2}, {2}, {2, 2}, {2, 2}};
+    vector<void*> datas = {(void*)a, (void*)sigma, (void*)u, (void*)v};
+    CREATE_NODEDEF(shapes, data_types, datas, true, false);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
+}
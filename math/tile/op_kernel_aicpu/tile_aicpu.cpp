@@ -1,180 +1,46 @@
 /**
- * Copyright (c) 2026 Huawei Technologies Co., Ltd.
- * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
- * CANN Open Software License Agreement Version 2.0 (the "License").
- * Please refer to the License for details. You may not use this file except in compliance with the License.
- * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
- * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
- * See LICENSE in the root of the software repository for the full text of the License.
- */
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
 
 #include "tile_aicpu.h"
 
-#include <complex>
-#include <iostream>
+#include <algorithm>
+#include <atomic>
 
-#include "Eigen/Core"
 #include "aicpu/math_aicpu_register.h"
 #include "cpu_kernel_utils.h"
-#include "securec.h"
-#include "utils/eigen_tensor.h"
 #include "utils/kernel_util.h"
 
 namespace {
 const char *const kTile = "Tile";
 constexpr uint32_t kInputNum = 2;
 constexpr uint32_t kOutputNum = 1;
-constexpr int32_t kIndexZero = 0;
-constexpr int32_t kIndexOne = 1;
-constexpr int32_t kIndexTwo = 2;
-constexpr int32_t kDim0 = 0;
-constexpr int32_t kDim1 = 1;
-constexpr int32_t kDim2 = 2;
-constexpr int32_t kDim3 = 3;
-constexpr int32_t kDim4 = 4;
-constexpr int32_t kDim5 = 5;
-constexpr int32_t kDim6 = 6;
-constexpr int32_t kDim7 = 7;
-constexpr int32_t kDim8 = 8;
-constexpr int32_t kParallelShapeSize = 5 * 1024;
-
-#define TILE_COMPUTE_CASE(DTYPE, TYPE, CTX)            \
-  case (DTYPE): {                                      \
-    if (TileCompute<TYPE>(CTX) != KERNEL_STATUS_OK) {  \
-      KERNEL_LOG_ERROR("Tile kernel compute failed."); \
-      return KERNEL_STATUS_INNER_ERROR;                \
-    }                                                  \
-    break;                                             \
-  }
-
-#define TILE_COMPUTE_GET_MULTIPLE(input_dims, mul_value) \
-  for (int32_t i = 0; i < (input_dims); ++i) {           \
-    (mul_value)[i] = multiples_.at(i);                   \
-  }
-
-#define TILE_COMPUTE_DIM2(input_x_data, shape_x, output_data, shape_output) \
-  do {                                                                      \
-    typedef Eigen::TensorMap<Eigen::Tensor<T, kDim2, Eigen::RowMajor>,      \
-                             Eigen::Aligned>                                \
-        EigenTensorNd;                                                    \
-    EigenTensorNd input_nd((input_x_data), (shape_x).at(0),               \
-                             (shape_x).at(1));                              \
-    EigenTensorNd output_nd((output_data), (shape_output).at(0),          \
-                              (shape_output).at(1));                        \
-    Eigen::array<Eigen::DenseIndex, kDim2> mtp_2d;                          \
-    TILE_COMPUTE_GET_MULTIPLE(kDim2, mtp_2d)                                \
-    output_nd = input_nd.broadcast(mtp_2d);                                 \
-  } while (0)
-
-#define TILE_COMPUTE_DIM3(input_x_data, shape_x, output_data, shape_output)    \
-  do {                                                                         \
-    typedef Eigen::TensorMap<Eigen::Tensor<T, kDim3, Eigen::RowMajor>,         \
-                             Eigen::Aligned>                                   \
-        EigenTensorNd;                                                       \
-    EigenTensorNd input_nd((input_x_data), (shape_x).at(0), (shape_x).at(1), \
-                             (shape_x).at(2));                                 \
-    EigenTensorNd output_nd((output_data), (shape_output).at(0),             \
-                              (shape_output).at(1), (shape_output).at(2));     \
-    Eigen::array<Eigen::DenseIndex, kDim3> mtp_3d;                             \
-    TILE_COMPUTE_GET_MULTIPLE(kDim3, mtp_3d)                                   \
-    output_nd = input_nd.broadcast(mtp_3d);                                    \
-  } while (0)
-
-#define TILE_COMPUTE_DIM4(input_x_data, shape_x, output_data, shape_output)    \
-  do {                                                                         \
-    typedef Eigen::TensorMap<Eigen::Tensor<T, kDim4, Eigen::RowMajor>,         \
-                             Eigen::Aligned>                                   \
-        EigenTensorNd;                                                       \
-    EigenTensorNd input_nd((input_x_data), (shape_x).at(0), (shape_x).at(1), \
-                             (shape_x).at(kDim2), (shape_x).at(kDim3));        \
-    EigenTensorNd output_nd((output_data), (shape_output).at(0),             \
-                              (shape_output).at(1), (shape_output).at(kDim2),  \
-                              (shape_output).at(kDim3));                       \
-    Eigen::array<Eigen::DenseIndex, kDim4> mtp_4d;                             \
-    TILE_COMPUTE_GET_MULTIPLE(kDim4, mtp_4d)                                   \
-    output_nd = input_nd.broadcast(mtp_4d);                                    \
-  } while (0)
-
-#define TILE_COMPUTE_DIM5(input_x_data, shape_x, output_data, shape_output)    \
-  do {                                                                         \
-    typedef Eigen::TensorMap<Eigen::Tensor<T, kDim5, Eigen::RowMajor>,         \
-                             Eigen::Aligned>                                   \
-        EigenTensorNd;                                                       \
-    EigenTensorNd input_nd((input_x_data), (shape_x).at(0), (shape_x).at(1), \
-                             (shape_x).at(kDim2), (shape_x).at(kDim3),         \
-                             (shape_x).at(kDim4));                             \
-    EigenTensorNd output_nd((output_data), (shape_output).at(0),             \
-                              (shape_output).at(1), (shape_output).at(kDim2),  \
-                              (shape_output).at(kDim3),                        \
-                              (shape_output).at(kDim4));                       \
-    Eigen::array<Eigen::DenseIndex, kDim5> mtp_5d;                             \
-    TILE_COMPUTE_GET_MULTIPLE(kDim5, mtp_5d)                                   \
-    output_nd = input_nd.broadcast(mtp_5d);                                    \
-  } while (0)
-
-#define TILE_COMPUTE_DIM6(input_x_data, shape_x, output_data, shape_output)    \
-  do {                                                                         \
-    typedef Eigen::TensorMap<Eigen::Tensor<T, kDim6, Eigen::RowMajor>,         \
-                             Eigen::Aligned>                                   \
-        EigenTensorNd;                                                       \
-    EigenTensorNd input_nd((input_x_data), (shape_x).at(0), (shape_x).at(1), \
-                             (shape_x).at(kDim2), (shape_x).at(kDim3),         \
-                             (shape_x).at(kDim4), (shape_x).at(kDim5));        \
-    EigenTensorNd output_nd(                                                 \
-        (output_data), (shape_output).at(0), (shape_output).at(1),             \
-        (shape_output).at(kDim2), (shape_output).at(kDim3),                    \
-        (shape_output).at(kDim4), (shape_output).at(kDim5));                   \
-    Eigen::array<Eigen::DenseIndex, kDim6> mtp_6d;                             \
-    TILE_COMPUTE_GET_MULTIPLE(kDim6, mtp_6d)                                   \
-    output_nd = input_nd.broadcast(mtp_6d);                                    \
-  } while (0)
-
-#define TILE_COMPUTE_DIM7(input_x_data, shape_x, output_data, shape_output)    \
-  do {                                                                         \
-    typedef Eigen::TensorMap<Eigen::Tensor<T, kDim7, Eigen::RowMajor>,         \
-                             Eigen::Aligned>                                   \
-        EigenTensorNd;                                                       \
-    EigenTensorNd input_nd((input_x_data), (shape_x).at(0), (shape_x).at(1), \
-                             (shape_x).at(kDim2), (shape_x).at(kDim3),         \
-                             (shape_x).at(kDim4), (shape_x).at(kDim5),         \
-                             (shape_x).at(kDim6));                             \
-    EigenTensorNd output_nd(                                                 \
-        (output_data), (shape_output).at(0), (shape_output).at(1),             \
-        (shape_output).at(kDim2), (shape_output).at(kDim3),                    \
-        (shape_output).at(kDim4), (shape_output).at(kDim5),                    \
-        (shape_output).at(kDim6));                                             \
-    Eigen::array<Eigen::DenseIndex, kDim7> mtp_7d;                             \
-    TILE_COMPUTE_GET_MULTIPLE(kDim7, mtp_7d)                                   \
-    output_nd = input_nd.broadcast(mtp_7d);                                    \
-  } while (0)
-
-#define TILE_COMPUTE_DIM8(input_x_data, shape_x, output_data, shape_output)    \
-  do {                                                                         \
-    typedef Eigen::TensorMap<Eigen::Tensor<T, kDim8, Eigen::RowMajor>,         \
-                             Eigen::Aligned>                                   \
-        EigenTensorNd;                                                       \
-    EigenTensorNd input_nd((input_x_data), (shape_x).at(0), (shape_x).at(1), \
-                             (shape_x).at(kDim2), (shape_x).at(kDim3),         \
-                             (shape_x).at(kDim4), (shape_x).at(kDim5),         \
-                             (shape_x).at(kDim6), (shape_x).at(kDim7));        \
-    EigenTensorNd output_nd(                                                 \
-        (output_data), (shape_output).at(0), (shape_output).at(1),             \
-        (shape_output).at(kDim2), (shape_output).at(kDim3),                    \
-        (shape_output).at(kDim4), (shape_output).at(kDim5),                    \
-        (shape_output).at(kDim6), (shape_output).at(kDim7));                   \
-    Eigen::array<Eigen::DenseIndex, kDim8> mtp_8d;                             \
-    TILE_COMPUTE_GET_MULTIPLE(kDim8, mtp_8d)                                   \
-    output_nd = input_nd.broadcast(mtp_8d);                                    \
-  } while (0)
+// Below kTileParallelBytes a phase runs inline; shards move at least kTileMinShardBytes.
+constexpr int64_t kTileParallelBytes = 256 * 1024;
+constexpr int64_t kTileMinShardBytes = 64 * 1024;
+// Parallel replication first doubles the block up to kTileSeedBytes, then copies the seed in chunks.
+constexpr int64_t kTileSeedBytes = 64 * 1024;
+constexpr int64_t kTileChunkBytes = 1024 * 1024;
+
+// complex128 element, moved as two 64 bit words.
+struct TileWord128 {
+  uint64_t lo;
+  uint64_t hi;
+};
 }  // namespace
 
 namespace aicpu {
 uint32_t TileCpuKernel::TileComputeUsingMemcpy(
     void *dst_addr, void *src_addr, size_t copy_len) const
 {
-    auto ret = memcpy_s(dst_addr, copy_len, src_addr, copy_len);
-    if (ret != 0) {
-      KERNEL_LOG_ERROR("failed to call memcpy_s copy len %zu.", copy_len);
+    if (!BiggerMemCpy(dst_addr, copy_len, src_addr, copy_len)) {
+      KERNEL_LOG_ERROR("failed to call memcpy copy len %zu.", copy_len);
       return KERNEL_STATUS_INNER_ERROR;
     }
     return KERNEL_STATUS_OK;
@@ -192,170 +58,187 @@ uint32_t TileCpuKernel::TileComputeUsingSdma(
     return KERNEL_STATUS_OK;
 }
 
-template <typename T>
-uint32_t TileCpuKernel::TileComputeWith2DNotUsingEigen(const CpuKernelContext &ctx) {
-  Tensor *input_x = ctx.Input(kFirstInputIndex);
-  Tensor *output = ctx.Output(kFirstOutputIndex);
-  auto input_x_data = static_cast<T *>(input_x->GetData());
-  auto output_data = static_cast<T *>(output->GetData());
-  const std::vector<int64_t> input_x_dims = input_x->GetTensorShape()->GetDimSizes();
-  const int64_t x_first_dim = input_x_dims[kIndexZero];
-  const int64_t mul_first_dim = multiples_[kIndexZero];
-  const int64_t x_second_dim = input_x_dims[kIndexOne];
-  const int64_t mul_second_dim = multiples_[kIndexOne];
-  KERNEL_CHECK_FALSE(CheckInt64MulOverflow(x_second_dim, mul_second_dim),
-                     KERNEL_STATUS_INNER_ERROR, "int64 mul over flow");
-  const int64_t last_axes_dims = x_second_dim * mul_second_dim;
-  const uint64_t output_data_size = output->GetDataSize();
-  KERNEL_CHECK_FALSE((output_data_size >= static_cast<uint64_t>(x_second_dim * sizeof(T))),
-                     KERNEL_STATUS_INNER_ERROR, "memcpy size=[%ld] should less or equal to output data size=[%lu]",
-                     x_second_dim * sizeof(T), output_data_size);
-  uint32_t result = KERNEL_STATUS_OK;
-  auto first_sharder = [&](int64_t start, int64_t end) {
-    for (int64_t i = start; i < end; i++) {
-      result = CallCopyHook(output_data + i * mul_second_dim * x_second_dim,
-                            input_x_data + i * x_second_dim, x_second_dim * sizeof(T));
+uint32_t TileCpuKernel::TileBuildPlan(const std::vector<int64_t> &input_x_dims, int64_t elem_size,
+                                      TilePlan &plan) const {
+  plan = TilePlan();
+  plan.elem_size = elem_size;
+  for (size_t i = 0; i < input_x_dims.size(); ++i) {
+    const int64_t x_dim = input_x_dims[i];
+    const int64_t mul_dim = multiples_[i];
+    if (x_dim == 1 && mul_dim == 1) {
+      continue;
     }
-    return result;
-  };
-  (void)CpuKernelUtils::ParallelFor(ctx, x_first_dim, 1, first_sharder);
-  auto second_sharder = [&](int64_t start, int64_t end) {
-    for (int64_t i = start; i < end; i++) {
-      for (int64_t j = 1; j < mul_second_dim; j++) {
-        result = CallCopyHook(output_data + i * last_axes_dims + j * x_second_dim,
-                              output_data + i * last_axes_dims, x_second_dim * sizeof(T));
-      }
+    if (!plan.in_dims.empty() && mul_dim == 1) {
+      KERNEL_CHECK_FALSE(CheckInt64MulOverflow(plan.in_dims.back(), x_dim), KERNEL_STATUS_INNER_ERROR,
+                         "int64 mul over flow");
+      plan.in_dims.back() *= x_dim;
+      continue;
     }
-    return result;
-  };
-  (void)CpuKernelUtils::ParallelFor(ctx, x_first_dim, 1, second_sharder);
-  KERNEL_CHECK_FALSE((output_data_size >= static_cast<uint64_t>(x_first_dim * last_axes_dims * sizeof(T))),
-                     KERNEL_STATUS_INNER_ERROR, "memcpy size=[%ld] should less or equal to output data size=[%lu]",
-                     x_first_dim * last_axes_dims * sizeof(T), output_data_size);
-  auto third_sharder = [&](int64_t start, int64_t end) {
-    int64_t cpy_size = x_first_dim * last_axes_dims;
-    for (int64_t i = start; i < end; i++) {
-      if (i != 0) {
-        result = CallCopyHook(output_data + i * cpy_size, output_data, cpy_size * sizeof(T));
-      }
+    if (!plan.in_dims.empty() && plan.in_dims.back() == 1 && x_dim == 1) {
+      KERNEL_CHECK_FALSE(CheckInt64MulOverflow(plan.multiples.back(), mul_dim), KERNEL_STATUS_INNER_ERROR,
+                         "int64 mul over flow");
+      plan.multiples.back() *= mul_dim;
+      continue;
     }
-    return result;
-  };
-  (void)CpuKernelUtils::ParallelFor(ctx, mul_first_dim, 1, third_sharder);
-  return result;
-}
+    plan.in_dims.push_back(x_dim);
+    plan.multiples.push_back(mul_dim);
+  }
+  if (plan.in_dims.empty()) {
+    plan.in_dims.push_back(1);
+    plan.multiples.push_back(1);
+  }
 
-template <typename T>
-uint32_t TileCpuKernel::TileComputeWith3DNotUsingEigen(const CpuKernelContext &ctx) {
-  Tensor *input_x = ctx.Input(kFirstInputIndex);
-  Tensor *output = ctx.Output(kFirstOutputIndex);
-  auto input_x_data = static_cast<T *>(input_x->GetData());
-  auto output_data = static_cast<T *>(output->GetData());
-  const std::vector<int64_t> input_x_dims = input_x->GetTensorShape()->GetDimSizes();
-  const int64_t x_first_dim = input_x_dims[kIndexZero];
-  const int64_t x_second_dim = input_x_dims[kIndexOne];
-  const int64_t x_third_dim = input_x_dims[kIndexTwo];
-  const int64_t mul_first_dim = multiples_[kIndexZero];
-  const int64_t mul_second_dim = multiples_[kIndexOne];
-  const int64_t mul_third_dim = multiples_[kIndexTwo];
-  const int64_t last_axes_dims = x_third_dim * mul_third_dim;
-  KERNEL_CHECK_FALSE(CheckInt64MulOverflow(x_third_dim, mul_third_dim),
-                     KERNEL_STATUS_INNER_ERROR, "int64 mul over flow");
-  const int64_t second_axes_dims = x_second_dim * mul_second_dim;
-  KERNEL_CHECK_FALSE(CheckInt64MulOverflow(last_axes_dims, second_axes_dims),
+  const size_t levels = plan.in_dims.size();
+  plan.in_block_bytes.assign(levels, elem_size);
+  plan.out_block_bytes.assign(levels, elem_size);
+  for (size_t d = levels - 1; d > 0; --d) {
+    int64_t out_dim = 0;
+    KERNEL_CHECK_FALSE(CheckInt64MulOverflow(plan.in_dims[d], plan.multiples[d]), KERNEL_STATUS_INNER_ERROR,
+                       "int64 mul over flow");
+    out_dim = plan.in_dims[d] * plan.multiples[d];
+    KERNEL_CHECK_FALSE(CheckInt64MulOverflow(plan.out_block_bytes[d], out_dim), KERNEL_STATUS_INNER_ERROR,
+                       "int64 mul over flow");
+    plan.in_block_bytes[d - 1] = plan.in_block_bytes[d] * plan.in_dims[d];
+    plan.out_block_bytes[d - 1] = plan.out_block_bytes[d] * out_dim;
+  }
+  KERNEL_CHECK_FALSE(CheckInt64MulOverflow(plan.in_dims[0], plan.multiples[0]), KERNEL_STATUS_INNER_ERROR,
+                     "int64 mul over flow");
+  KERNEL_CHECK_FALSE(CheckInt64MulOverflow(plan.out_block_bytes[0], plan.in_dims[0] * plan.multiples[0]),
                      KERNEL_STATUS_INNER_ERROR, "int64 mul over flow");
-  const int64_t last_two_axes_dims = last_axes_dims * second_axes_dims;
-  const uint64_t output_data_size = output->GetDataSize();
-  KERNEL_CHECK_FALSE((output_data_size >= static_cast<uint64_t>(x_third_dim * sizeof(T))),
-                     KERNEL_STATUS_INNER_ERROR,
-                     "memcpy size=[%ld] should less or equal to output data size=[%lu]",
-                     x_third_dim * sizeof(T), output_data_size);
-  KERNEL_HANDLE_ERROR(TileCompute3DSharderFirst<T>(ctx, input_x_data, output_data,
-                                                   x_first_dim, x_second_dim, x_third_dim,
-                                                   last_axes_dims, second_axes_dims));
-
-  KERNEL_HANDLE_ERROR(TileCompute3DSharderSecond<T>(ctx, output_data, x_first_dim, x_second_dim, x_third_dim,
-                                                    mul_third_dim, last_axes_dims, last_two_axes_dims));
-
-  KERNEL_CHECK_FALSE((output_data_size >= static_cast<uint64_t>(last_axes_dims * x_second_dim * sizeof(T))),
-                     KERNEL_STATUS_INNER_ERROR,
-                     "memcpy size=[%ld] should less or equal to output data size=[%lu]",
-                     last_axes_dims * x_second_dim * sizeof(T), output_data_size);
-  KERNEL_HANDLE_ERROR(TileCompute3DSharderThird<T>(ctx, output_data, x_first_dim, x_second_dim, mul_second_dim,
-                                                   last_axes_dims, last_two_axes_dims));
-
-  KERNEL_CHECK_FALSE((output_data_size >= static_cast<uint64_t>(last_two_axes_dims * x_first_dim * sizeof(T))),
-                     KERNEL_STATUS_INNER_ERROR,
-                     "memcpy size=[%ld] should less or equal to output data size=[%lu]",
-                     last_two_axes_dims * x_first_dim * sizeof(T), output_data_size);
-  KERNEL_HANDLE_ERROR(TileCompute3DSharderFourth<T>(ctx, output_data, mul_first_dim, last_two_axes_dims, x_first_dim));
+  plan.total_bytes = plan.out_block_bytes[0] * plan.in_dims[0] * plan.multiples[0];
+  return KERNEL_STATUS_OK;
+}
 
+// Fill copies 1..multiple-1 of the block at the start of `block` by doubling: each memcpy copies everything
+// written so far, so `multiple` copies take log2(multiple) calls.
+uint32_t TileCpuKernel::TileReplicate(uint8_t *block, int64_t block_bytes, int64_t multiple) {
+  int64_t done = 1;
+  while (done < multiple) {
+    const int64_t copies = std::min(done, multiple - done);
+    KERNEL_HANDLE_ERROR(CallCopyHook(block + done * block_bytes, block, static_cast<size_t>(copies * block_bytes)),
+                        "Tile replicate copy failed.");
+    done += copies;
+  }
   return KERNEL_STATUS_OK;
 }
 
-template <typename T>
-uint32_t TileCpuKernel::TileKernelCompute(const CpuKernelContext &ctx) {
-  Tensor *input_x = ctx.Input(kFirstInputIndex), *output = ctx.Output(kFirstOutputIndex);
-  auto x_shape = input_x->GetTensorShape();
-  KERNEL_CHECK_NULLPTR(x_shape, KERNEL_STATUS_PARAM_INVALID, "x shape ptr is nullptr.");
-  auto output_shape = output->GetTensorShape();
-  KERNEL_CHECK_NULLPTR(output_shape, KERNEL_STATUS_PARAM_INVALID, "output shape ptr is nullptr.");
-  const int32_t input_rank = x_shape->GetDims();
-  const int64_t output_rank = output_shape->GetDims();
-  KERNEL_CHECK_FALSE((input_rank == output_rank), KERNEL_STATUS_PARAM_INVALID,
-                     "output rank must be equal to input rank, current input "
-                     "rand [%d], output rank [%ld]", input_rank, output_rank);
-  const std::vector<int64_t> input_x_dims = x_shape->GetDimSizes(), output_dims = output_shape->GetDimSizes();
-  auto input_x_data = static_cast<T *>(input_x->GetData());
-  auto output_data = static_cast<T *>(output->GetData());
-  bool use_eigen = (std::count(multiples_.begin(), multiples_.end(), 0) > 0) ||
-                     (input_x->NumElements() < kParallelShapeSize);
-  switch (input_rank) {
-    case kDim0:
-      *output_data = *input_x_data;
-      break;
-    case kDim1:
-      KERNEL_HANDLE_ERROR(
-          TileComputeWith1D<T>(input_x_data, output_data, input_x_dims[kIndexZero], multiples_[kIndexZero]),
-          "Tile 1D handle failed.");
-      break;
-    case kDim2:
-      if (use_eigen) {
-        TILE_COMPUTE_DIM2(input_x_data, input_x_dims, output_data, output_dims);
-      } else {
-        KERNEL_HANDLE_ERROR(TileComputeWith2DNotUsingEigen<T>(ctx), "Tile 2D handle failed.");
+uint32_t TileCpuKernel::TileReplicateParallel(const CpuKernelContext &ctx, uint8_t *block, int64_t block_bytes,
+                                              int64_t multiple) {
+  const int64_t total = block_bytes * multiple;
+  const int64_t cores = std::max<int64_t>(1, static_cast<int64_t>(CpuKernelUtils::GetCPUNum(ctx)));
+  if (multiple <= 1 || cores == 1 || total < kTileParallelBytes) {
+    return TileReplicate(block, block_bytes, multiple);
+  }
+  int64_t seed_copies = 1;
+  while (seed_copies * 2 <= multiple && seed_copies * block_bytes < kTileSeedBytes) {
+    seed_copies *= 2;
+  }
+  KERNEL_HANDLE_ERROR(TileReplicate(block, block_bytes, seed_copies), "Tile seed replicate failed.");
+  // The output repeats with period block_bytes and the seed holds whole blocks, so byte p is byte p % seed.
+  const int64_t seed = seed_copies * block_bytes;
+  const int64_t units = (total - seed + kTileChunkBytes - 1) / kTileChunkBytes;
+  const int64_t per_unit = std::max<int64_t>(1, (units + cores - 1) / cores);
+  std::atomic<bool> failed{false};
+  auto shard = [&](int64_t start, int64_t end) {
+    for (int64_t chunk = start; chunk < end && !failed.load(std::memory_order_relaxed); ++chunk) {
+      int64_t pos = seed + chunk * kTileChunkBytes;
+      const int64_t chunk_end = std::min(pos + kTileChunkBytes, total);
+      while (pos < chunk_end) {
+        const int64_t offset = pos % seed;
+        const int64_t bytes = std::min(seed - offset, chunk_end - pos);
+        if (CallCopyHook(block + pos, block + offset, static_cast<size_t>(bytes)) != KERNEL_STATUS_OK) {
+          failed.store(true, std::memory_order_relaxed);
+          return;
+        }
+        pos += bytes;
       }
-      break;
-    case kDim3:
-      if (use_eigen) {
-        TILE_COMPUTE_DIM3(input_x_data, input_x_dims, output_data, output_dims);
-      } else {
-        KERNEL_HANDLE_ERROR(TileComputeWith3DNotUsingEigen<T>(ctx), "Tile 3D handle failed.");
+    }
+  };
+  KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, units, per_unit, shard), "Tile replicate ParallelFor failed.");
+  KERNEL_CHECK_FALSE(!failed.load(std::memory_order_relaxed), KERNEL_STATUS_INNER_ERROR, "Tile replicate failed.");
+  return KERNEL_STATUS_OK;
+}
+
+template <typename W>
+uint32_t TileCpuKernel::TileFillLevel(const TilePlan &plan, size_t level, uint8_t *src, uint8_t *dst) {
+  const int64_t x_dim = plan.in_dims[level];
+  const int64_t mul_dim = plan.multiples[level];
+  if (level + 1 == plan.in_dims.size()) {
+    if (x_dim == 1) {
+      std::fill_n(reinterpret_cast<W *>(dst), mul_dim, *reinterpret_cast<const W *>(src));
+      return KERNEL_STATUS_OK;
+    }
+    KERNEL_HANDLE_ERROR(CallCopyHook(dst, src, static_cast<size_t>(x_dim * plan.elem_size)), "Tile copy failed.");
+  } else {
+    for (int64_t i = 0; i < x_dim; ++i) {
+      KERNEL_HANDLE_ERROR(TileFillLevel<W>(plan, level + 1, src + i * plan.in_block_bytes[level],
+                                           dst + i * plan.out_block_bytes[level]),
+                          "Tile fill level [%zu] failed.", level + 1);
+    }
+  }
+  return TileReplicate(dst, x_dim * plan.out_block_bytes[level], mul_dim);
+}
+
+template <typename W>
+uint32_t TileCpuKernel::TileKernelCompute(const CpuKernelContext &ctx, const TilePlan &plan) {
+  Tensor *output = ctx.Output(kFirstOutputIndex);
+  auto input_x_data = static_cast<uint8_t *>(ctx.Input(kFirstInputIndex)->GetData());
+  auto output_data = static_cast<uint8_t *>(output->GetData());
+  if (plan.total_bytes == 0) {
+    return KERNEL_STATUS_OK;
+  }
+  const uint64_t output_data_size = output->GetDataSize();
+  KERNEL_CHECK_FALSE((output_data_size >= static_cast<uint64_t>(plan.total_bytes)), KERNEL_STATUS_INNER_ERROR,
+                     "memcpy size=[%ld] should less or equal to output data size=[%lu]", plan.total_bytes,
+                     output_data_size);
+
+  // Build the first copy of the outermost level, sharded over its sub-blocks, then replicate it.
+  const int64_t x_first_dim = plan.in_dims[0];
+  const int64_t block_bytes = x_first_dim * plan.out_block_bytes[0];
+  if (plan.in_dims.size() == 1) {
+    KERNEL_HANDLE_ERROR(CallCopyHook(output_data, input_x_data, static_cast<size_t>(block_bytes)),
+                        "Tile copy failed.");
+    return TileReplicateParallel(ctx, output_data, block_bytes, plan.multiples[0]);
+  }
+  const int64_t cores = std::max<int64_t>(1, static_cast<int64_t>(CpuKernelUtils::GetCPUNum(ctx)));
+  if (cores == 1 || block_bytes < kTileParallelBytes) {
+    for (int64_t i = 0; i < x_first_dim; ++i) {
+      KERNEL_HANDLE_ERROR(TileFillLevel<W>(plan, 1, input_x_data + i * plan.in_block_bytes[0],
+                                           output_data + i * plan.out_block_bytes[0]),
+                          "Tile fill failed.");
+    }
+  } else {
+    const int64_t unit_bytes = plan.out_block_bytes[0];
+    const int64_t per_unit = std::max((x_first_dim + cores - 1) / cores,
+                                      (kTileMinShardBytes + unit_bytes - 1) / unit_bytes);
+    std::atomic<bool> failed{false};
+    auto shard = [&](int64_t start, int64_t end) {
+      for (int64_t i = start; i < end && !failed.load(std::memory_order_relaxed); ++i) {
+        if (TileFillLevel<W>(plan, 1, input_x_data + i * plan.in_block_bytes[0],
+                             output_data + i * plan.out_block_bytes[0]) != KERNEL_STATUS_OK) {
+          failed.store(true, std::memory_order_relaxed);
+        }
       }
-      break;
-    case kDim4: TILE_COMPUTE_DIM4(input_x_data, input_x_dims, output_data, output_dims); break;
-    case kDim5: TILE_COMPUTE_DIM5(input_x_data, input_x_dims, output_data, output_dims); break;
-    case kDim6: TILE_COMPUTE_DIM6(input_x_data, input_x_dims, output_data, output_dims); break;
-    case kDim7: TILE_COMPUTE_DIM7(input_x_data, input_x_dims, output_data, output_dims); break;
-    case kDim8: TILE_COMPUTE_DIM8(input_x_data, input_x_dims, output_data, output_dims); break;
-    default:
-      KERNEL_LOG_ERROR("Tile : Unhandled input dimensions [%d].", input_rank);
-      return KERNEL_STATUS_INNER_ERROR;
+    };
+    KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, x_first_dim, per_unit, shard),
+                        "Tile ParallelFor failed.");
+    KERNEL_CHECK_FALSE(!failed.load(std::memory_order_relaxed), KERNEL_STATUS_INNER_ERROR, "Tile fill failed.");
   }
-  return KERNEL_STATUS_OK;
+  return TileReplicateParallel(ctx, output_data, block_bytes, plan.multiples[0]);
 }
 
-template <typename T>
-uint32_t TileCpuKernel::TileCheckCopySupported(const CpuKernelContext &ctx) {
+uint32_t TileCpuKernel::TileCheckCopySupported(const CpuKernelContext &ctx, int64_t elem_size) {
 #if defined(RUN_ON_HOST) || defined(OPS_MATH_AICPU_HOST_KERNEL)
+  (void)ctx;
+  (void)elem_size;
   SetCopyHook(false);
 #else
   if (&halSdmaCopy != nullptr) {
     // device and host
-    auto input_x_data = reinterpret_cast<T *>(ctx.Input(kFirstInputIndex)->GetData());
-    auto output_data = reinterpret_cast<T *>(ctx.Output(kFirstOutputIndex)->GetData());
-    auto ret = halSdmaCopy(reinterpret_cast<DVdeviceptr>(output_data), sizeof(T),
-                           reinterpret_cast<DVdeviceptr>(input_x_data), sizeof(T));
+    auto input_x_data = ctx.Input(kFirstInputIndex)->GetData();
+    auto output_data = ctx.Output(kFirstOutputIndex)->GetData();
+    auto ret = halSdmaCopy(reinterpret_cast<DVdeviceptr>(output_data), static_cast<size_t>(elem_size),
+                           reinterpret_cast<DVdeviceptr>(input_x_data), static_cast<size_t>(elem_size));
     if (ret == DRV_ERROR_NOT_SUPPORT) {
       // host use memcpy
       SetCopyHook(false);
@@ -373,10 +256,26 @@ uint32_t TileCpuKernel::TileCheckCopySupported(const CpuKernelContext &ctx) {
 return KERNEL_STATUS_OK;
 }
 
-template <typename T>
-uint32_t TileCpuKernel::TileCompute(const CpuKernelContext &ctx) {
-  KERNEL_HANDLE_ERROR(TileCheckCopySupported<T>(ctx), "check copy supported failed");
-  return TileKernelCompute<T>(ctx);
+uint32_t TileCpuKernel::TileCompute(const CpuKernelContext &ctx, int64_t elem_size) {
+  KERNEL_HANDLE_ERROR(TileCheckCopySupported(ctx, elem_size), "check copy supported failed");
+  TilePlan plan;
+  KERNEL_HANDLE_ERROR(TileBuildPlan(ctx.Input(kFirstInputIndex)->GetTensorShape()->GetDimSizes(), elem_size, plan),
+                      "Tile build plan failed.");
+  switch (elem_size) {
+    case sizeof(uint8_t):
+      return TileKernelCompute<uint8_t>(ctx, plan);
+    case sizeof(uint16_t):
+      return TileKernelCompute<uint16_t>(ctx, plan);
+    case sizeof(uint32_t):
+      return TileKernelCompute<uint32_t>(ctx, plan);
+    case sizeof(uint64_t):
+      return TileKernelCompute<uint64_t>(ctx, plan);
+    case sizeof(TileWord128):
+      return TileKernelCompute<TileWord128>(ctx, plan);
+    default:
+      KERNEL_LOG_ERROR("Tile element size [%ld] not support.", elem_size);
+      return KERNEL_STATUS_PARAM_INVALID;
+  }
 }
 
 uint32_t TileCpuKernel::GetMultiplesValue(Tensor *tensor,
@@ -401,6 +300,7 @@ uint32_t TileCpuKernel::GetMultiplesValue(Tensor *tensor,
 
 uint32_t TileCpuKernel::TileParamCheck(const CpuKernelContext &ctx) {
   is_empty_tensor_ = false;
+  multiples_.clear();
   auto x_tensor = ctx.Input(kFirstInputIndex);
   const std::vector<int64_t> input_x_dims = x_tensor->GetTensorShape()->GetDimSizes();
   if (IsScalar(input_x_dims)) {
@@ -461,25 +361,30 @@ uint32_t TileCpuKernel::Compute(CpuKernelContext &ctx) {
 
   auto x_dtype = ctx.Input(kFirstInputIndex)->GetDataType();
   switch (x_dtype) {
-    TILE_COMPUTE_CASE(DT_BOOL, bool, ctx)
-    TILE_COMPUTE_CASE(DT_INT8, int8_t, ctx)
-    TILE_COMPUTE_CASE(DT_QINT8, int8_t, ctx)
-    TILE_COMPUTE_CASE(DT_UINT8, uint8_t, ctx)
-    TILE_COMPUTE_CASE(DT_QUINT8, uint8_t, ctx)
-    TILE_COMPUTE_CASE(DT_INT16, int16_t, ctx)
-    TILE_COMPUTE_CASE(DT_QINT16, int16_t, ctx)
-    TILE_COMPUTE_CASE(DT_QUINT16, uint16_t, ctx)
-    TILE_COMPUTE_CASE(DT_UINT16, uint16_t, ctx)
-    TILE_COMPUTE_CASE(DT_INT32, int32_t, ctx)
-    TILE_COMPUTE_CASE(DT_QINT32, int32_t, ctx)
-    TILE_COMPUTE_CASE(DT_UINT32, uint32_t, ctx)
-    TILE_COMPUTE_CASE(DT_INT64, int64_t, ctx)
-    TILE_COMPUTE_CASE(DT_UINT64, uint64_t, ctx)
-    TILE_COMPUTE_CASE(DT_FLOAT, float, ctx)
-    TILE_COMPUTE_CASE(DT_DOUBLE, double, ctx)
-    TILE_COMPUTE_CASE(DT_FLOAT16, Eigen::half, ctx)
-    TILE_COMPUTE_CASE(DT_COMPLEX64, std::complex<float>, ctx)
-    TILE_COMPUTE_CASE(DT_COMPLEX128, std::complex<double>, ctx)
+    case DT_BOOL:
+    case DT_INT8:
+    case DT_QINT8:
+    case DT_UINT8:
+    case DT_QUINT8:
+    case DT_INT16:
+    case DT_QINT16:
+    case DT_QUINT16:
+    case DT_UINT16:
+    case DT_INT32:
+    case DT_QINT32:
+    case DT_UINT32:
+    case DT_INT64:
+    case DT_UINT64:
+    case DT_FLOAT:
+    case DT_DOUBLE:
+    case DT_FLOAT16:
+    case DT_COMPLEX64:
+    case DT_COMPLEX128:
+      if (TileCompute(ctx, GetSizeByDataType(x_dtype)) != KERNEL_STATUS_OK) {
+        KERNEL_LOG_ERROR("Tile kernel compute failed.");
+        return KERNEL_STATUS_INNER_ERROR;
+      }
+      break;
     default:
       KERNEL_LOG_ERROR("Tile kernel data type [%u] not support.", x_dtype);
       return KERNEL_STATUS_PARAM_INVALID;
@@ -488,94 +393,4 @@ uint32_t TileCpuKernel::Compute(CpuKernelContext &ctx) {
 }
 
 OPS_MATH_REGISTER_CPU_KERNELV2(kTile, TileCpuKernel);
-
-template <typename T>
-uint32_t TileCpuKernel::TileCompute3DSharderFirst(const CpuKernelContext &ctx, T *input_x_data, T *output_data,
-                                                   int64_t x_first_dim, int64_t x_second_dim, int64_t x_third_dim,
-                                                   int64_t last_axes_dims, int64_t second_axes_dims) {
-  uint32_t result = KERNEL_STATUS_OK;
-  auto sharder = [&](int64_t start, int64_t end) {
-    for (int64_t i = start; i < end; i++) {
-      for (int64_t j = 0; j < x_second_dim; j++) {
-        result = CallCopyHook(output_data + i * last_axes_dims * second_axes_dims + j * last_axes_dims,
-                              input_x_data + i * x_third_dim * x_second_dim + j * x_third_dim,
-                              x_third_dim * sizeof(T));
-      }
-    }
-    return result;
-  };
-  (void)CpuKernelUtils::ParallelFor(ctx, x_first_dim, 1, sharder);
-  return result;
-}
-
-template <typename T>
-uint32_t TileCpuKernel::TileCompute3DSharderSecond(const CpuKernelContext &ctx, T *output_data,
-                                                    int64_t x_first_dim, int64_t x_second_dim, int64_t x_third_dim,
-                                                    int64_t mul_third_dim, int64_t last_axes_dims,
-                                                    int64_t last_two_axes_dims) {
-  uint32_t result = KERNEL_STATUS_OK;
-  auto sharder = [&](int64_t start, int64_t end) {
-    for (int64_t i = start; i < end; i++) {
-      for (int64_t j = 0; j < x_second_dim; j++) {
-        for (int64_t k = 1; k < mul_third_dim; k++) {
-          result = CallCopyHook(output_data + i * last_two_axes_dims + j * last_axes_dims + k * x_third_dim,
-                                output_data + i * last_two_axes_dims + j * last_axes_dims,
-                                x_third_dim * sizeof(T));
-        }
-      }
-    }
-    return result;
-  };
-  (void)CpuKernelUtils::ParallelFor(ctx, x_first_dim, 1, sharder);
-  return result;
-}
-
-template <typename T>
-uint32_t TileCpuKernel::TileCompute3DSharderThird(const CpuKernelContext &ctx, T *output_data,
-                                                   int64_t x_first_dim, int64_t x_second_dim,
-                                                   int64_t mul_second_dim, int64_t last_axes_dims,
-                                                   int64_t last_two_axes_dims) {
-  uint32_t result = KERNEL_STATUS_OK;
-  auto sharder = [&](int64_t start, int64_t end) {
-    for (int64_t i = start; i < end; i++) {
-      for (int64_t j = 1; j < mul_second_dim; j++) {
-        result = CallCopyHook(output_data + i * last_two_axes_dims + j * last_axes_dims * x_second_dim,
-                              output_data + i * last_two_axes_dims, last_axes_dims * x_second_dim * sizeof(T));
-      }
-    }
-    return result;
-  };
-  (void)CpuKernelUtils::ParallelFor(ctx, x_first_dim, 1, sharder);
-  return result;
-}
-
-template <typename T>
-uint32_t TileCpuKernel::TileCompute3DSharderFourth(const CpuKernelContext &ctx, T *output_data,
-                                                    int64_t mul_first_dim, int64_t last_two_axes_dims,
-                                                    int64_t x_first_dim) {
-  uint32_t result = KERNEL_STATUS_OK;
-  auto sharder = [&](int64_t start, int64_t end) {
-    for (int64_t i = start; i < end; i++) {
-      if (i != 0) {
-        result = CallCopyHook(output_data + i * last_two_axes_dims * x_first_dim,
-                              output_data, last_two_axes_dims * x_first_dim * sizeof(T));
-      }
-    }
-    return result;
-  };
-  (void)CpuKernelUtils::ParallelFor(ctx, mul_first_dim, 1, sharder);
-  return result;
-}
-
-template <typename T>
-uint32_t TileCpuKernel::TileComputeWith1D(T *input_x_data, T *output_data, int64_t x_dim, int64_t mul_dim) {
-  for (int64_t i = 0; i < mul_dim; i++) {
-    KERNEL_HANDLE_ERROR(CallCopyHook(output_data + i * x_dim, input_x_data, x_dim * sizeof(T)));
-  }
-  if (mul_dim == 0) {
-    KERNEL_HANDLE_ERROR(CallCopyHook(output_data, input_x_data, x_dim * sizeof(T)));
-  }
-  return KERNEL_STATUS_OK;
-}
-
 }  // namespace aicpu
@@ -1,24 +1,36 @@
 /**
- * Copyright (c) 2026 Huawei Technologies Co., Ltd.
- * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
- * CANN Open Software License Agreement Version 2.0 (the "License").
- * Please refer to the License for details. You may not use this file except in compliance with the License.
- * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
- * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
- * See LICENSE in the root of the software repository for the full text of the License.
- */
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
 
 #ifndef AICPU_KERNELS_DEVICE_TILE_H
 #define AICPU_KERNELS_DEVICE_TILE_H
-#define EIGEN_USE_THREADS
-#include <unsupported/Eigen/CXX11/Tensor>
+
+#include <vector>
 
 #include "cpu_kernel.h"
 #include "cpu_types.h"
-#include "utils/bcast.h"
 #include "driver/ascend_hal.h"
 
 namespace aicpu {
+// Tile as nested levels: level d holds in_dims[d] sub-blocks and repeats them multiples[d] times. Dims with
+// x == 1 and multiple == 1 are dropped, an untiled dim is folded into the level above it and consecutive
+// broadcast dims (x == 1) share one level, so every level really replicates.
+struct TilePlan {
+  int64_t elem_size = 0;
+  std::vector<int64_t> in_dims;
+  std::vector<int64_t> multiples;
+  // Bytes of one input / output sub-block of level d.
+  std::vector<int64_t> in_block_bytes;
+  std::vector<int64_t> out_block_bytes;
+  int64_t total_bytes = 0;
+};
+
 class TileCpuKernel : public CpuKernel {
  public:
   TileCpuKernel() = default;
@@ -41,35 +53,19 @@ class TileCpuKernel : public CpuKernel {
     return (this->*copy_hook_)(dst, src, copy_len);
   }
     uint32_t (TileCpuKernel::*copy_hook_)(void*, void*, size_t) const;
-  template <typename T>
-  uint32_t TileComputeWith2DNotUsingEigen(const CpuKernelContext &ctx);
-  template <typename T>
-  uint32_t TileComputeWith3DNotUsingEigen(const CpuKernelContext &ctx);
-  template <typename T>
-  uint32_t TileCompute3DSharderFirst(const CpuKernelContext &ctx, T *input_x_data, T *output_data,
-                                      int64_t x_first_dim, int64_t x_second_dim, int64_t x_third_dim,
-                                      int64_t last_axes_dims, int64_t second_axes_dims);
-  template <typename T>
-  uint32_t TileCompute3DSharderSecond(const CpuKernelContext &ctx, T *output_data,
-                                       int64_t x_first_dim, int64_t x_second_dim, int64_t x_third_dim,
-                                       int64_t mul_third_dim, int64_t last_axes_dims, int64_t last_two_axes_dims);
-  template <typename T>
-  uint32_t TileCompute3DSharderThird(const CpuKernelContext &ctx, T *output_data,
-                                      int64_t x_first_dim, int64_t x_second_dim, int64_t mul_second_dim,
-                                      int64_t last_axes_dims, int64_t last_two_axes_dims);
-  template <typename T>
-  uint32_t TileCompute3DSharderFourth(const CpuKernelContext &ctx, T *output_data,
-                                       int64_t mul_first_dim, int64_t last_two_axes_dims, int64_t x_first_dim);
-  template <typename T>
-  uint32_t TileComputeWith1D(T *input_x_data, T *output_data, int64_t x_dim, int64_t mul_dim);
-  template <typename T>
-  uint32_t TileCheckCopySupported(const CpuKernelContext &ctx);
-  template <typename T>
-  uint32_t TileKernelCompute(const CpuKernelContext &ctx);
+  uint32_t TileBuildPlan(const std::vector<int64_t> &input_x_dims, int64_t elem_size, TilePlan &plan) const;
+  uint32_t TileReplicate(uint8_t *block, int64_t block_bytes, int64_t multiple);
+  uint32_t TileReplicateParallel(const CpuKernelContext &ctx, uint8_t *block, int64_t block_bytes,
+                                 int64_t multiple);
+  // Dispatched by element byte width, so one instantiation serves every data type of that size.
+  template <typename W>
+  uint32_t TileFillLevel(const TilePlan &plan, size_t level, uint8_t *src, uint8_t *dst);
+  template <typename W>
+  uint32_t TileKernelCompute(const CpuKernelContext &ctx, const TilePlan &plan);
+  uint32_t TileCheckCopySupported(const CpuKernelContext &ctx, int64_t elem_size);
   uint32_t TileParamCheck(const CpuKernelContext &ctx);
   uint32_t GetMultiplesValue(Tensor *tensor, std::vector<int64_t> &mtp_value);
-  template <typename T>
-  uint32_t TileCompute(const CpuKernelContext &ctx);
+  uint32_t TileCompute(const CpuKernelContext &ctx, int64_t elem_size);
 };
 }  // namespace aicpu
 #endif  // AICPU_KERNELS_DEVICE_TILE_H
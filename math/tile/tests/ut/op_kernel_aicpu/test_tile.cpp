@@ -498,3 +498,58 @@ TEST_F(TEST_TILE_UT, DATA_TYPE_INT32_ZERO_MULTIPLE_IN_MIDDLE_SUCC) {
   CREATE_NODEDEF(shapes, data_types, datas);
   RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
 }
+
+// Column broadcast of a large table: every row is one element filled across the row, sharded over rows.
+TEST_F(TEST_TILE_UT, DATA_TYPE_FLOAT16_COLUMN_BROADCAST_SHARDED_SUCC) {
+  vector<DataType> data_types = {DT_FLOAT16, DT_INT64, DT_FLOAT16};
+  vector<vector<int64_t>> shapes = {{4096, 1}, {2}, {4096, 96}};
+  vector<int64_t> multiples = {1, 96};
+  vector<Eigen::half> input0(4096);
+  for (size_t i = 0; i < input0.size(); i++) input0[i] = Eigen::half(static_cast<float>(i % 1000));
+  vector<Eigen::half> output(4096 * 96);
+  vector<Eigen::half> output_exp(4096 * 96);
+  BuildTileExpected(input0.data(), shapes[0], multiples, output_exp.data());
+  vector<void*> datas = {(void*)input0.data(), (void*)multiples.data(), (void*)output.data()};
+  CREATE_NODEDEF(shapes, data_types, datas);
+  RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+  bool compare = CompareResult(output.data(), output_exp.data(), output.size());
+  EXPECT_EQ(compare, true);
+}
+
+// Positional table repeated over a batch: collapses to one level replicated in parallel chunks.
+TEST_F(TEST_TILE_UT, DATA_TYPE_FLOAT_TABLE_REPEAT_SHARDED_SUCC) {
+  vector<DataType> data_types = {DT_FLOAT, DT_INT32, DT_FLOAT};
+  vector<vector<int64_t>> shapes = {{1, 64, 64}, {3}, {24, 64, 64}};
+  int32_t input1[3] = {24, 1, 1};
+  vector<float> input0(64 * 64);
+  for (size_t i = 0; i < input0.size(); i++) input0[i] = static_cast<float>(i) * 0.5f;
+  vector<float> output(24 * 64 * 64);
+  vector<float> output_exp(24 * 64 * 64);
+  BuildTileExpected(input0.data(), shapes[0], vector<int64_t>{24, 1, 1}, output_exp.data());
+  vector<void*> datas = {(void*)input0.data(), (void*)input1, (void*)output.data()};
+  CREATE_NODEDEF(shapes, data_types, datas);
+  RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+  bool compare = CompareResult(output.data(), output_exp.data(), output.size());
+  EXPECT_EQ(compare, true);
+}
+
+// Rank 9 with mixed multiples, large enough to shard the outer level and replicate it in parallel.
+TEST_F(TEST_TILE_UT, DATA_TYPE_INT8_9D_SHARDED_SUCC) {
+  vector<DataType> data_types = {DT_INT8, DT_INT64, DT_INT8};
+  vector<vector<int64_t>> shapes = {{16, 1, 2, 3, 1, 1, 2, 1, 5}, {9}, {32, 3, 2, 6, 1, 2, 4, 1, 15}};
+  vector<int64_t> multiples = {2, 3, 1, 2, 1, 2, 2, 1, 3};
+  vector<int8_t> input0(16 * 2 * 3 * 2 * 5);
+  for (size_t i = 0; i < input0.size(); i++) input0[i] = static_cast<int8_t>(i * 3);
+  const size_t output_size = 32 * 3 * 2 * 6 * 2 * 4 * 15;
+  vector<int8_t> output(output_size);
+  vector<int8_t> output_exp(output_size);
+  BuildTileExpected(input0.data(), shapes[0], multiples, output_exp.data());
+  vector<void*> datas = {(void*)input0.data(), (void*)multiples.data(), (void*)output.data()};
+  CREATE_NODEDEF(shapes, data_types, datas);
+  RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+  bool compare = CompareResult(output.data(), output_exp.data(), output_size);
+  EXPECT_EQ(compare, true);
+}
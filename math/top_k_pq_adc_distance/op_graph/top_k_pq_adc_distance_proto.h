@@ -0,0 +1,53 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef OPS_OP_PROTO_TOP_K_PQ_ADC_DISTANCE_H_
+#define OPS_OP_PROTO_TOP_K_PQ_ADC_DISTANCE_H_
+
+#include "graph/operator_reg.h"
+
+namespace ge {
+/**
+ * @brief Scores a batch of queries against product quantization codes with asymmetric distance computation (ADC)
+ * and returns the "k" smallest or largest distances of every query. \n
+ *
+ * @par Inputs:
+ * @li distance_table: A 3D Tensor of shape [batch, sub_num, centroid_num], the distance between every sub vector of
+ * a query and every centroid of that sub quantizer, centroid_num at most 256. Must be one of the following types:
+ * float32, float16.
+ * @li pq_codes: A 2D Tensor of type uint8 and shape [code_num, sub_num], the centroid id of every sub vector of
+ * every encoded vector. The distance of query b to code n is the sum over m of
+ * distance_table[b][m][pq_codes[n][m]]. \n
+ *
+ * @par Attributes:
+ * @li order: An optional string, "ASC" keeps the k smallest distances, "DES" the k largest. Default: "ASC".
+ * @li k: A required int in range (0, code_num].
+ * @li group_size: A required int. The codes are pruned in groups of group_size, code_num must be a multiple
+ * of it. \n
+ *
+ * @par Outputs:
+ * @li topk_distance: A 2D Tensor of shape [batch, k], sorted by order. Has the same type as distance_table.
+ * @li topk_index: A 2D Tensor of type int32 and shape [batch, k], the row of every distance in pq_codes. \n
+ *
+ * @par Restrictions:
+ * Warning: THIS FUNCTION IS EXPERIMENTAL.  Please do not use.
+ */
+REG_OP(TopKPQAdcDistance)
+    .INPUT(distance_table, TensorType({DT_FLOAT16, DT_FLOAT}))
+    .INPUT(pq_codes, TensorType({DT_UINT8}))
+    .OUTPUT(topk_distance, TensorType({DT_FLOAT16, DT_FLOAT}))
+    .OUTPUT(topk_index, TensorType({DT_INT32}))
+    .ATTR(order, String, "ASC")
+    .REQUIRED_ATTR(k, Int)
+    .REQUIRED_ATTR(group_size, Int)
+    .OP_END_FACTORY_REG(TopKPQAdcDistance)
+} // namespace ge
+
+#endif // OPS_OP_PROTO_TOP_K_PQ_ADC_DISTANCE_H_
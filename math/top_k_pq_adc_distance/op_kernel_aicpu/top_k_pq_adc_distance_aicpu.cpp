@@ -0,0 +1,421 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "top_k_pq_adc_distance_aicpu.h"
+
+#include <algorithm>
+#include <atomic>
+
+#include "aicpu/math_aicpu_register.h"
+#include "cpu_kernel_utils.h"
+#include "cpu_types.h"
+#include "log.h"
+#include "status.h"
+#include "utils/eigen_tensor.h"
+#include "utils/kernel_util.h"
+
+namespace {
+const char* const kTopKPQAdcDistance = "TopKPQAdcDistance";
+constexpr uint32_t kDistanceTableInputIndex = 0;
+constexpr uint32_t kPqCodesInputIndex = 1;
+constexpr uint32_t kTopkDistanceOutputIndex = 0;
+constexpr uint32_t kTopkIndexOutputIndex = 1;
+constexpr uint32_t kInputNum = 2;
+constexpr uint32_t kOutputNum = 2;
+constexpr int32_t kDistanceTableDimNum = 3;
+constexpr int32_t kPqCodesDimNum = 2;
+constexpr int64_t kMaxCentroidNum = 256;
+// Codes scored together: the lookups of one sub quantizer over a block are independent, so the compiler can turn
+// the inner loop into gathers.
+constexpr int64_t kAdcBlockSize = 32;
+// Blocking the codes is only split across cores above this many bytes.
+constexpr int64_t kParallelBlockBytes = 256 * 1024;
+constexpr const char* kOrderAsc = "ASC";
+constexpr const char* kOrderDes = "DES";
+} // namespace
+
+namespace aicpu {
+uint32_t TopKPQAdcDistanceCpuKernel::Compute(CpuKernelContext& ctx)
+{
+    KERNEL_HANDLE_ERROR(NormalCheck(ctx, kInputNum, kOutputNum), "[%s] check input and output failed.",
+                        kTopKPQAdcDistance);
+    KERNEL_HANDLE_ERROR(CheckInputAndAttr(ctx), "[%s] check input and attr failed.", kTopKPQAdcDistance);
+    DataType data_type = ctx.Input(kDistanceTableInputIndex)->GetDataType();
+    uint32_t res = KERNEL_STATUS_OK;
+    switch (data_type) {
+        case DT_FLOAT16:
+            res = DoCompute<Eigen::half>(ctx);
+            break;
+        case DT_FLOAT:
+            res = DoCompute<float>(ctx);
+            break;
+        default:
+            KERNEL_LOG_ERROR("[%s] input distance_table only support type[DT_FLOAT16, DT_FLOAT], but got type[%s].",
+                             kTopKPQAdcDistance, DTypeStr(data_type).c_str());
+            return KERNEL_STATUS_PARAM_INVALID;
+    }
+    if (res != KERNEL_STATUS_OK) {
+        KERNEL_LOG_ERROR("[%s] kernel compute failed, KernelStatus is [%u].", kTopKPQAdcDistance, res);
+    }
+    return res;
+}
+
+uint32_t TopKPQAdcDistanceCpuKernel::CheckInputAndAttr(const CpuKernelContext& ctx)
+{
+    Tensor* table = ctx.Input(kDistanceTableInputIndex);
+    Tensor* codes = ctx.Input(kPqCodesInputIndex);
+    auto table_shape = table->GetTensorShape();
+    auto codes_shape = codes->GetTensorShape();
+    KERNEL_CHECK_NULLPTR(table_shape, KERNEL_STATUS_PARAM_INVALID, "Get input distance_table shape failed.")
+    KERNEL_CHECK_NULLPTR(codes_shape, KERNEL_STATUS_PARAM_INVALID, "Get input pq_codes shape failed.")
+    KERNEL_CHECK_FALSE((table_shape->GetDims() == kDistanceTableDimNum), KERNEL_STATUS_PARAM_INVALID,
+                       "Input distance_table should be 3D, but got dim num[%d].", table_shape->GetDims())
+    KERNEL_CHECK_FALSE((codes_shape->GetDims() == kPqCodesDimNum), KERNEL_STATUS_PARAM_INVALID,
+                       "Input pq_codes should be 2D, but got dim num[%d].", codes_shape->GetDims())
+    KERNEL_CHECK_FALSE((codes->GetDataType() == DT_UINT8), KERNEL_STATUS_PARAM_INVALID,
+                       "Input pq_codes only support type[DT_UINT8], but got type[%s].",
+                       DTypeStr(codes->GetDataType()).c_str())
+
+    batch_ = table_shape->GetDimSize(0);
+    sub_num_ = table_shape->GetDimSize(1);
+    centroid_num_ = table_shape->GetDimSize(2);
+    code_num_ = codes_shape->GetDimSize(0);
+    KERNEL_CHECK_FALSE((sub_num_ > 0 && codes_shape->GetDimSize(1) == sub_num_), KERNEL_STATUS_PARAM_INVALID,
+                       "pq_codes dim 1[%ld] should equal the sub quantizer num[%ld] of distance_table.",
+                       codes_shape->GetDimSize(1), sub_num_)
+    KERNEL_CHECK_FALSE((centroid_num_ > 0 && centroid_num_ <= kMaxCentroidNum), KERNEL_STATUS_PARAM_INVALID,
+                       "distance_table centroid num should be in range (0, %ld], but got [%ld].", kMaxCentroidNum,
+                       centroid_num_)
+    KERNEL_CHECK_FALSE((code_num_ <= INT32_MAX), KERNEL_STATUS_PARAM_INVALID,
+                       "pq_codes num[%ld] should not exceed int32 range.", code_num_)
+    KERNEL_HANDLE_ERROR(ParseAndCheckAttr(ctx), "Parse and check attr failed.");
+    block_num_ = (code_num_ + kAdcBlockSize - 1) / kAdcBlockSize;
+    KERNEL_HANDLE_ERROR(CheckOutput(ctx), "Check output failed.");
+    KERNEL_CHECK_NULLPTR(table->GetData(), KERNEL_STATUS_PARAM_INVALID, "Get input distance_table data failed.")
+    KERNEL_CHECK_NULLPTR(codes->GetData(), KERNEL_STATUS_PARAM_INVALID, "Get input pq_codes data failed.")
+    KERNEL_LOG_DEBUG("[%s] order[%s], batch[%ld], sub_num[%ld], centroid_num[%ld], code_num[%ld], group_size[%d]",
+                     kTopKPQAdcDistance, order_.c_str(), batch_, sub_num_, centroid_num_, code_num_, group_size_);
+    return KERNEL_STATUS_OK;
+}
+
+uint32_t TopKPQAdcDistanceCpuKernel::ParseAndCheckAttr(const CpuKernelContext& ctx)
+{
+    AttrValue* order = ctx.GetAttr("order");
+    order_ = (order == nullptr) ? kOrderAsc : order->GetString();
+    KERNEL_CHECK_FALSE(((order_ == kOrderAsc) || (order_ == kOrderDes)), KERNEL_STATUS_PARAM_INVALID,
+                       "order should be ASC or DES, but got [%s].", order_.c_str())
+    // ASC keeps the k smallest values, so the heap root must hold the largest candidate to evict.
+    is_min_heap_ = (order_ == kOrderAsc) ? false : true;
+
+    AttrValue* k = ctx.GetAttr("k");
+    KERNEL_CHECK_NULLPTR(k, KERNEL_STATUS_PARAM_INVALID, "Get attr [k] failed.")
+    k_ = static_cast<int32_t>(k->GetInt());
+    KERNEL_CHECK_FALSE((k_ > 0 && k_ <= code_num_), KERNEL_STATUS_PARAM_INVALID,
+                       "k should be in range (0, code_num], but got k[%d], code_num[%ld].", k_, code_num_)
+
+    AttrValue* group_size = ctx.GetAttr("group_size");
+    KERNEL_CHECK_NULLPTR(group_size, KERNEL_STATUS_PARAM_INVALID, "Get attr [group_size] failed.")
+    group_size_ = static_cast<int32_t>(group_size->GetInt());
+    if (group_size_ == 0) {
+        KERNEL_LOG_ERROR("[%s] group_size must not be 0.", kTopKPQAdcDistance);
+        return KERNEL_STATUS_PARAM_INVALID;
+    }
+    if (group_size_ < 0) {
+        KERNEL_LOG_ERROR("[%s] group_size should be greater than zero, but got group_size[%d].", kTopKPQAdcDistance,
+                         group_size_);
+        return KERNEL_STATUS_PARAM_INVALID;
+    }
+    if ((code_num_ % static_cast<int64_t>(group_size_)) != 0) {
+        KERNEL_LOG_ERROR("[%s] code num should be an integer multiple of group size, but code_num is [%ld], "
+                         "group_size is [%d].",
+                         kTopKPQAdcDistance, code_num_, group_size_);
+        return KERNEL_STATUS_PARAM_INVALID;
+    }
+    extreme_size_ = static_cast<int32_t>(code_num_ / static_cast<int64_t>(group_size_));
+    init_group_offset_ = k_ % group_size_;
+    return KERNEL_STATUS_OK;
+}
+
+uint32_t TopKPQAdcDistanceCpuKernel::CheckOutput(const CpuKernelContext& ctx) const
+{
+    Tensor* topk_distance = ctx.Output(kTopkDistanceOutputIndex);
+    Tensor* topk_index = ctx.Output(kTopkIndexOutputIndex);
+    DataType table_type = ctx.Input(kDistanceTableInputIndex)->GetDataType();
+    KERNEL_CHECK_FALSE((topk_distance->GetDataType() == table_type), KERNEL_STATUS_PARAM_INVALID,
+                       "Output topk_distance type[%s] must be the same as distance_table type[%s].",
+                       DTypeStr(topk_distance->GetDataType()).c_str(), DTypeStr(table_type).c_str())
+    KERNEL_CHECK_FALSE((topk_index->GetDataType() == DT_INT32), KERNEL_STATUS_PARAM_INVALID,
+                       "Output topk_index only support type[DT_INT32], but got type[%s].",
+                       DTypeStr(topk_index->GetDataType()).c_str())
+    KERNEL_CHECK_FALSE((topk_distance->NumElements() >= batch_ * k_), KERNEL_STATUS_PARAM_INVALID,
+                       "Output topk_distance element num[%ld] is less than batch[%ld] * k[%d].",
+                       topk_distance->NumElements(), batch_, k_)
+    KERNEL_CHECK_FALSE((topk_index->NumElements() >= batch_ * k_), KERNEL_STATUS_PARAM_INVALID,
+                       "Output topk_index element num[%ld] is less than batch[%ld] * k[%d].",
+                       topk_index->NumElements(), batch_, k_)
+    KERNEL_CHECK_NULLPTR(topk_distance->GetData(), KERNEL_STATUS_PARAM_INVALID, "Get output topk_distance data failed.")
+    KERNEL_CHECK_NULLPTR(topk_index->GetData(), KERNEL_STATUS_PARAM_INVALID, "Get output topk_index data failed.")
+    return KERNEL_STATUS_OK;
+}
+
+uint32_t TopKPQAdcDistanceCpuKernel::BlockCodes(const CpuKernelContext& ctx, std::vector<uint8_t>& blocked_codes) const
+{
+    // [code_num, sub_num] -> [block_num, sub_num, kAdcBlockSize], the tail block padded with code 0. Shared by every
+    // query, so the transposition is paid once per call.
+    const uint8_t* codes = static_cast<const uint8_t*>(ctx.Input(kPqCodesInputIndex)->GetData());
+    blocked_codes.assign(static_cast<size_t>(block_num_ * sub_num_ * kAdcBlockSize), 0);
+    std::atomic<bool> code_valid(true);
+    auto shard = [&](int64_t start, int64_t end) {
+        bool valid = true;
+        for (int64_t b = start; b < end; b++) {
+            uint8_t* dst = blocked_codes.data() + b * sub_num_ * kAdcBlockSize;
+            const int64_t count = std::min(kAdcBlockSize, code_num_ - b * kAdcBlockSize);
+            const uint8_t* src = codes + b * kAdcBlockSize * sub_num_;
+            for (int64_t j = 0; j < count; j++) {
+                for (int64_t m = 0; m < sub_num_; m++) {
+                    const uint8_t code = src[j * sub_num_ + m];
+                    valid = valid && (code < centroid_num_);
+                    dst[m * kAdcBlockSize + j] = code;
+                }
+            }
+        }
+        if (!valid) {
+            code_valid = false;
+        }
+    };
+    if (code_num_ * sub_num_ <= kParallelBlockBytes) {
+        shard(0, block_num_);
+    } else {
+        KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, block_num_, 1, shard), "[%s] block codes failed.",
+                            kTopKPQAdcDistance);
+    }
+    KERNEL_CHECK_FALSE(code_valid.load(), KERNEL_STATUS_PARAM_INVALID,
+                       "Input pq_codes holds a code not less than centroid num[%ld].", centroid_num_)
+    return KERNEL_STATUS_OK;
+}
+
+template <typename T>
+uint32_t TopKPQAdcDistanceCpuKernel::DoCompute(const CpuKernelContext& ctx)
+{
+    if (batch_ == 0) {
+        KERNEL_LOG_DEBUG("[%s] batch is zero, nothing to compute.", kTopKPQAdcDistance);
+        return KERNEL_STATUS_OK;
+    }
+    std::vector<uint8_t> blocked_codes;
+    KERNEL_HANDLE_ERROR(BlockCodes(ctx, blocked_codes), "[%s] check pq_codes failed.", kTopKPQAdcDistance);
+
+    // Queries are independent: every shard takes a contiguous run of them.
+    auto sharder = [&](int64_t start, int64_t end) { ComputeWithBlock<T>(ctx, blocked_codes.data(), start, end); };
+    int64_t max_core_num = std::min(batch_, static_cast<int64_t>(CpuKernelUtils::GetCPUNum(ctx)));
+    if (max_core_num <= 0) {
+        max_core_num = 1;
+    }
+    int64_t per_unit_size = CeilMultiple(batch_, max_core_num);
+    KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, batch_, per_unit_size, sharder),
+                        "[%s] parallel compute failed.", kTopKPQAdcDistance);
+    return KERNEL_STATUS_OK;
+}
+
+template <typename T>
+void TopKPQAdcDistanceCpuKernel::ComputeWithBlock(const CpuKernelContext& ctx, const uint8_t* blocked_codes,
+                                                  int64_t start, int64_t end) const
+{
+    const int64_t table_size = sub_num_ * centroid_num_;
+    const T* table_addr = static_cast<const T*>(ctx.Input(kDistanceTableInputIndex)->GetData()) + start * table_size;
+    T* topk_distance_addr = static_cast<T*>(ctx.Output(kTopkDistanceOutputIndex)->GetData()) + start * k_;
+    int32_t* topk_index_addr = static_cast<int32_t*>(ctx.Output(kTopkIndexOutputIndex)->GetData()) + start * k_;
+
+    AdcScratch scratch;
+    scratch.table.resize(static_cast<size_t>(table_size));
+    scratch.distances.resize(static_cast<size_t>(block_num_ * kAdcBlockSize));
+    scratch.extremes.resize(static_cast<size_t>(extreme_size_));
+    scratch.grp_extreme.resize(static_cast<size_t>(k_));
+    scratch.topk.resize(static_cast<size_t>(k_));
+
+    for (int64_t i = start; i < end; i++) {
+        for (int64_t t = 0; t < table_size; t++) {
+            scratch.table[t] = static_cast<float>(table_addr[t]);
+        }
+        ComputeAdcDistances(blocked_codes, scratch.table.data(), scratch.distances.data());
+        ComputeGroupExtremes(scratch.distances.data(), scratch.extremes.data());
+        GetGroupedDistanceTopKHeap(scratch.grp_extreme.data(), scratch.extremes.data());
+        GetDistanceTopKHeap(scratch.topk.data(), scratch.grp_extreme.data(), scratch.distances.data());
+        // Popping the heap yields the extremes in reverse, so fill the output back to front.
+        for (int32_t n = k_; n > 0; n--) {
+            Item res;
+            PopHeap(scratch.topk.data(), n, &res);
+            topk_distance_addr[n - 1] = static_cast<T>(res.val);
+            topk_index_addr[n - 1] = res.idx;
+        }
+        table_addr += table_size;
+        topk_distance_addr += k_;
+        topk_index_addr += k_;
+    }
+}
+
+void TopKPQAdcDistanceCpuKernel::ComputeAdcDistances(const uint8_t* blocked_codes, const float* table,
+                                                     float* distances) const
+{
+    for (int64_t b = 0; b < block_num_; b++) {
+        float acc[kAdcBlockSize] = {0};
+        const uint8_t* block = blocked_codes + b * sub_num_ * kAdcBlockSize;
+        for (int64_t m = 0; m < sub_num_; m++) {
+            const float* sub_table = table + m * centroid_num_;
+            const uint8_t* sub_codes = block + m * kAdcBlockSize;
+            for (int64_t j = 0; j < kAdcBlockSize; j++) {
+                acc[j] += sub_table[sub_codes[j]];
+            }
+        }
+        std::copy(acc, acc + kAdcBlockSize, distances + b * kAdcBlockSize);
+    }
+}
+
+void TopKPQAdcDistanceCpuKernel::ComputeGroupExtremes(const float* distances, float* extremes) const
+{
+    // ASC prunes with the smallest distance of every group, DES with the largest.
+    for (int32_t g = 0; g < extreme_size_; g++) {
+        const float* group = distances + static_cast<int64_t>(g) * group_size_;
+        float extreme = group[0];
+        for (int32_t i = 1; i < group_size_; i++) {
+            extreme = is_min_heap_ ? std::max(extreme, group[i]) : std::min(extreme, group[i]);
+        }
+        extremes[g] = extreme;
+    }
+}
+
+void TopKPQAdcDistanceCpuKernel::InitTopKHeap(int32_t& group_idx, Item topk_ptr[], const Item grp_extreme_ptr[],
+                                              const float* distances) const
+{
+    int32_t cnt = 0;
+    for (; group_idx < k_; group_idx++) {
+        int32_t idx = grp_extreme_ptr[group_idx].idx * group_size_;
+        const float* itemvalptr = distances + idx;
+        for (int32_t index = 0; index < group_size_; index++, cnt++) {
+            if (cnt == k_) {
+                return;
+            }
+            topk_ptr[cnt] = {itemvalptr[index], idx + index};
+        }
+    }
+}
+
+void TopKPQAdcDistanceCpuKernel::GetDistanceTopKHeap(Item topk_ptr[], const Item grp_extreme_ptr[],
+                                                     const float* distances) const
+{
+    int32_t group_idx = 0;
+    InitTopKHeap(group_idx, topk_ptr, grp_extreme_ptr, distances);
+    MakeHeap(topk_ptr, k_);
+    // Offset inside the group that InitTopKHeap stopped at.
+    int32_t index = init_group_offset_;
+    int32_t size = std::min(k_, extreme_size_);
+    for (; group_idx < size; group_idx++, index = 0) {
+        if (is_min_heap_) {
+            if (grp_extreme_ptr[group_idx].val <= topk_ptr[0].val) {
+                continue;
+            }
+        } else if (grp_extreme_ptr[group_idx].val >= topk_ptr[0].val) {
+            continue;
+        }
+        int32_t idx = grp_extreme_ptr[group_idx].idx * group_size_;
+        const float* itemvalptr = distances + idx;
+        for (; index < group_size_; index++) {
+            const float itemval = itemvalptr[index];
+            if (is_min_heap_) {
+                if (itemval <= topk_ptr[0].val) {
+                    continue;
+                }
+            } else if (itemval >= topk_ptr[0].val) {
+                continue;
+            }
+            topk_ptr[0] = {itemval, idx + index};
+            HeapFixdown(topk_ptr, 0, k_);
+        }
+    }
+}
+
+void TopKPQAdcDistanceCpuKernel::GetGroupedDistanceTopKHeap(Item grp_extreme_ptr[], const float* extremes) const
+{
+    int32_t size = std::min(k_, extreme_size_);
+    int32_t idx = 0;
+    for (; idx < size; idx++) {
+        grp_extreme_ptr[idx] = {extremes[idx], idx};
+    }
+    MakeHeap(grp_extreme_ptr, size);
+    for (; idx < extreme_size_; idx++) {
+        float temp = extremes[idx];
+        if (is_min_heap_) {
+            if (grp_extreme_ptr[0].val > temp) {
+                continue;
+            }
+        } else if (grp_extreme_ptr[0].val < temp) {
+            continue;
+        }
+        grp_extreme_ptr[0] = {temp, idx};
+        HeapFixdown(grp_extreme_ptr, 0, size);
+    }
+    SortHeap(grp_extreme_ptr, size);
+}
+
+void TopKPQAdcDistanceCpuKernel::MakeHeap(Item arr_ptr[], const int32_t n) const
+{
+    for (int32_t i = static_cast<int32_t>(static_cast<uint32_t>(n) >> 1) - 1; i >= 0; i--) {
+        HeapFixdown(arr_ptr, i, n);
+    }
+}
+
+void TopKPQAdcDistanceCpuKernel::PopHeap(Item arr_ptr[], const int32_t n, Item* const res) const
+{
+    *res = arr_ptr[0];
+    arr_ptr[0] = arr_ptr[n - 1];
+    HeapFixdown(arr_ptr, 0, n - 1);
+}
+
+void TopKPQAdcDistanceCpuKernel::HeapFixdown(Item a[], const int32_t index, const int32_t n) const
+{
+    int32_t i = index;
+    Item temp = a[i];
+
+    int32_t j = (static_cast<int32_t>(static_cast<uint32_t>(i) << 1)) + 1;
+    while (j < n) {
+        if (is_min_heap_) {
+            if (j + 1 < n && a[j].val > a[j + 1].val) {
+                j++;
+            }
+            if (a[j].val >= temp.val) {
+                break;
+            }
+        } else {
+            if (j + 1 < n && a[j].val < a[j + 1].val) {
+                j++;
+            }
+            if (a[j].val <= temp.val) {
+                break;
+            }
+        }
+
+        a[i] = a[j];
+        i = j;
+        j = (static_cast<int32_t>(static_cast<uint32_t>(i) << 1)) + 1;
+    }
+    a[i] = temp;
+}
+
+void TopKPQAdcDistanceCpuKernel::SortHeap(Item arr_ptr[], const int32_t n) const
+{
+    for (int32_t i = n - 1; i >= 0; i--) {
+        Item temp = arr_ptr[0];
+        arr_ptr[0] = arr_ptr[i];
+        arr_ptr[i] = temp;
+        HeapFixdown(arr_ptr, 0, i);
+    }
+}
+
+OPS_MATH_REGISTER_CPU_KERNELV2(kTopKPQAdcDistance, TopKPQAdcDistanceCpuKernel);
+} // namespace aicpu
@@ -0,0 +1,88 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef AICPU_KERNELS_NORMALIZED_TOP_K_PQ_ADC_DISTANCE_H_
+#define AICPU_KERNELS_NORMALIZED_TOP_K_PQ_ADC_DISTANCE_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "cpu_kernel.h"
+
+namespace aicpu {
+class TopKPQAdcDistanceCpuKernel : public CpuKernel {
+public:
+    TopKPQAdcDistanceCpuKernel() = default;
+    ~TopKPQAdcDistanceCpuKernel() override = default;
+
+    uint32_t Compute(CpuKernelContext& ctx) override;
+
+private:
+    struct Item {
+        float val;
+        int32_t idx;
+    };
+
+    // Per worker buffers, sized once per shard and rewritten for every query.
+    struct AdcScratch {
+        std::vector<float> table;
+        std::vector<float> distances;
+        std::vector<float> extremes;
+        std::vector<Item> grp_extreme;
+        std::vector<Item> topk;
+    };
+
+    std::string order_;
+    int32_t k_ = 0;
+    int32_t group_size_ = 0;
+    int32_t extreme_size_ = 0;
+    int32_t init_group_offset_ = 0;
+    bool is_min_heap_ = true;
+    int64_t batch_ = 0;
+    int64_t sub_num_ = 0;
+    int64_t centroid_num_ = 0;
+    int64_t code_num_ = 0;
+    int64_t block_num_ = 0;
+
+    uint32_t CheckInputAndAttr(const CpuKernelContext& ctx);
+
+    uint32_t ParseAndCheckAttr(const CpuKernelContext& ctx);
+
+    uint32_t CheckOutput(const CpuKernelContext& ctx) const;
+
+    uint32_t BlockCodes(const CpuKernelContext& ctx, std::vector<uint8_t>& blocked_codes) const;
+
+    template <typename T>
+    uint32_t DoCompute(const CpuKernelContext& ctx);
+
+    template <typename T>
+    void ComputeWithBlock(const CpuKernelContext& ctx, const uint8_t* blocked_codes, int64_t start, int64_t end) const;
+
+    void ComputeAdcDistances(const uint8_t* blocked_codes, const float* table, float* distances) const;
+
+    void ComputeGroupExtremes(const float* distances, float* extremes) const;
+
+    void InitTopKHeap(int32_t& group_idx, Item topk_ptr[], const Item grp_extreme_ptr[], const float* distances) const;
+
+    void GetDistanceTopKHeap(Item topk_ptr[], const Item grp_extreme_ptr[], const float* distances) const;
+
+    void GetGroupedDistanceTopKHeap(Item grp_extreme_ptr[], const float* extremes) const;
+
+    void MakeHeap(Item arr_ptr[], int32_t n) const;
+
+    void PopHeap(Item arr_ptr[], int32_t n, Item* res) const;
+
+    void HeapFixdown(Item a[], int32_t index, int32_t n) const;
+
+    void SortHeap(Item arr_ptr[], int32_t n) const;
+};
+} // namespace aicpu
+#endif
@@ -0,0 +1,34 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "register/op_def_registry.h"
+#include "../../../common/inc/aicpu/aicpu_op_def.h"
+
+namespace ops {
+class TopKPQAdcDistance : public OpDef {
+public:
+    explicit TopKPQAdcDistance(const char* name) : OpDef(name)
+    {
+        this->Input("distance_table").DataType({ge::DT_FLOAT16, ge::DT_FLOAT});
+        this->Input("pq_codes").DataType({ge::DT_UINT8, ge::DT_UINT8});
+        this->Output("topk_distance").DataType({ge::DT_FLOAT16, ge::DT_FLOAT});
+        this->Output("topk_index").DataType({ge::DT_INT32, ge::DT_INT32});
+        this->Attr("order").AttrType(OPTIONAL).String("ASC");
+        this->Attr("k").AttrType(REQUIRED).Int();
+        this->Attr("group_size").AttrType(REQUIRED).Int();
+
+        ApplyMathAicpuDefaultCfg(*this);
+        this->AICPU().ExtendCfgInfo(OP_INFO_OPS_FLAG.c_str(), OPEN_OPS_FLAG.c_str());
+        this->AICPU().ExtendCfgInfo(OP_INFO_FORMAT_AGNOSTIC.c_str(), TRUE_FORMAT_AGNOSTIC.c_str());
+    }
+};
+
+OP_ADD(TopKPQAdcDistance);
+} // namespace ops
@@ -0,0 +1,224 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include "gtest/gtest.h"
+#include "utils/aicpu_test_utils.h"
+#include "cpu_kernel_utils.h"
+#include "node_def_builder.h"
+#include "Eigen/Core"
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using namespace aicpu;
+
+class TEST_TOP_K_PQ_ADC_DISTANCE_UT : public testing::Test {};
+
+namespace {
+// order must be wrapped in std::string, a bare literal binds to NodeDefBuilder::Attr(name, bool).
+#define CREATE_NODEDEF(node_def, shapes, data_types, datas, order, k, group_size) \
+    NodeDefBuilder(node_def.get(), "TopKPQAdcDistance", "TopKPQAdcDistance")      \
+        .Input({"distance_table", data_types[0], shapes[0], datas[0]})            \
+        .Input({"pq_codes", data_types[1], shapes[1], datas[1]})                  \
+        .Output({"topk_distance", data_types[2], shapes[2], datas[2]})            \
+        .Output({"topk_index", data_types[3], shapes[3], datas[3]})               \
+        .Attr("order", std::string(order))                                        \
+        .Attr("k", static_cast<int32_t>(k))                                       \
+        .Attr("group_size", static_cast<int32_t>(group_size))
+
+// Brute force: sum the table entries of every code in sub quantizer order, then sort.
+void ReferenceTopK(const vector<float>& table, const vector<uint8_t>& codes, int64_t batch, int64_t sub_num,
+                   int64_t centroid_num, int64_t code_num, int64_t k, bool asc, vector<float>& topk_distance,
+                   vector<int32_t>& topk_index)
+{
+    topk_distance.clear();
+    topk_index.clear();
+    for (int64_t b = 0; b < batch; b++) {
+        vector<pair<float, int32_t>> dist(code_num);
+        for (int64_t n = 0; n < code_num; n++) {
+            float acc = 0;
+            for (int64_t m = 0; m < sub_num; m++) {
+                acc += table[(b * sub_num + m) * centroid_num + codes[n * sub_num + m]];
+            }
+            dist[n] = {acc, static_cast<int32_t>(n)};
+        }
+        sort(dist.begin(), dist.end());
+        if (!asc) {
+            reverse(dist.begin(), dist.end());
+        }
+        for (int64_t i = 0; i < k; i++) {
+            topk_distance.push_back(dist[i].first);
+            topk_index.push_back(dist[i].second);
+        }
+    }
+}
+
+void RandomProblem(int64_t batch, int64_t sub_num, int64_t centroid_num, int64_t code_num, vector<float>& table,
+                   vector<uint8_t>& codes)
+{
+    table.resize(batch * sub_num * centroid_num);
+    SetRandomValue<float>(table.data(), table.size(), 0.0, 10.0);
+    codes.resize(code_num * sub_num);
+    mt19937 gen(2026);
+    uniform_int_distribution<int32_t> dis(0, static_cast<int32_t>(centroid_num - 1));
+    for (auto& code : codes) {
+        code = static_cast<uint8_t>(dis(gen));
+    }
+}
+
+// Equal distances may come out in any order, so every index is checked through the distance it scores.
+void CheckTopKIndex(const vector<float>& table, const vector<uint8_t>& codes, int64_t sub_num, int64_t centroid_num,
+                    int64_t k, const vector<float>& expect_distance, const vector<int32_t>& topk_index)
+{
+    for (size_t i = 0; i < topk_index.size(); i++) {
+        const int64_t b = static_cast<int64_t>(i) / k;
+        float acc = 0;
+        for (int64_t m = 0; m < sub_num; m++) {
+            acc += table[(b * sub_num + m) * centroid_num + codes[topk_index[i] * sub_num + m]];
+        }
+        ASSERT_EQ(acc, expect_distance[i]) << "position " << i;
+    }
+}
+} // namespace
+
+TEST_F(TEST_TOP_K_PQ_ADC_DISTANCE_UT, DATA_TYPE_FLOAT_ASC_DES_SUCC)
+{
+    // Two sub quantizers of 4 centroids; code n scores table[0][c0] + table[1][c1].
+    float table[8] = {0.0f, 1.0f, 2.0f, 3.0f, 0.0f, 10.0f, 20.0f, 30.0f};
+    uint8_t codes[16] = {3, 0, 1, 1, 0, 2, 2, 0, 1, 3, 0, 0, 2, 1, 3, 3};
+    // distances: {3, 11, 20, 2, 31, 0, 12, 33}
+    vector<DataType> data_types = {DT_FLOAT, DT_UINT8, DT_FLOAT, DT_INT32};
+    vector<vector<int64_t>> shapes = {{1, 2, 4}, {8, 2}, {1, 3}, {1, 3}};
+
+    float topk_distance[3] = {0.0f};
+    int32_t topk_index[3] = {0};
+    vector<void*> datas = {(void*)table, (void*)codes, (void*)topk_distance, (void*)topk_index};
+    auto node_def = CpuKernelUtils::CreateNodeDef();
+    CREATE_NODEDEF(node_def, shapes, data_types, datas, "ASC", 3, 2);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    EXPECT_EQ(vector<float>(topk_distance, topk_distance + 3), vector<float>({0.0f, 2.0f, 3.0f}));
+    EXPECT_EQ(vector<int32_t>(topk_index, topk_index + 3), vector<int32_t>({5, 3, 0}));
+
+    {
+        auto node_def = CpuKernelUtils::CreateNodeDef();
+        CREATE_NODEDEF(node_def, shapes, data_types, datas, "DES", 3, 2);
+        RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+        EXPECT_EQ(vector<float>(topk_distance, topk_distance + 3), vector<float>({33.0f, 31.0f, 20.0f}));
+        EXPECT_EQ(vector<int32_t>(topk_index, topk_index + 3), vector<int32_t>({7, 4, 2}));
+    }
+}
+
+TEST_F(TEST_TOP_K_PQ_ADC_DISTANCE_UT, DATA_TYPE_FLOAT_BATCH_PARALLEL_SUCC)
+{
+    const int64_t batch = 16;
+    const int64_t sub_num = 8;
+    const int64_t centroid_num = 256;
+    // 320KB of codes, so the codes are also blocked in parallel.
+    const int64_t code_num = 40000;
+    const int64_t k = 10;
+    vector<float> table;
+    vector<uint8_t> codes;
+    RandomProblem(batch, sub_num, centroid_num, code_num, table, codes);
+    vector<DataType> data_types = {DT_FLOAT, DT_UINT8, DT_FLOAT, DT_INT32};
+    vector<vector<int64_t>> shapes = {{batch, sub_num, centroid_num}, {code_num, sub_num}, {batch, k}, {batch, k}};
+    vector<float> topk_distance(batch * k);
+    vector<int32_t> topk_index(batch * k);
+    vector<void*> datas = {(void*)table.data(), (void*)codes.data(), (void*)topk_distance.data(),
+                           (void*)topk_index.data()};
+    auto node_def = CpuKernelUtils::CreateNodeDef();
+    CREATE_NODEDEF(node_def, shapes, data_types, datas, "ASC", k, 8);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+    vector<float> expect_distance;
+    vector<int32_t> expect_index;
+    ReferenceTopK(table, codes, batch, sub_num, centroid_num, code_num, k, true, expect_distance, expect_index);
+    EXPECT_EQ(topk_distance, expect_distance);
+    CheckTopKIndex(table, codes, sub_num, centroid_num, k, expect_distance, topk_index);
+}
+
+TEST_F(TEST_TOP_K_PQ_ADC_DISTANCE_UT, DATA_TYPE_FLOAT16_DES_TAIL_BLOCK_SUCC)
+{
+    // 100 codes leave a partial block of 4 codes after three full blocks.
+    const int64_t batch = 5;
+    const int64_t sub_num = 4;
+    const int64_t centroid_num = 16;
+    const int64_t code_num = 100;
+    const int64_t k = 7;
+    vector<float> table_f;
+    vector<uint8_t> codes;
+    RandomProblem(batch, sub_num, centroid_num, code_num, table_f, codes);
+    vector<Eigen::half> table(table_f.size());
+    for (size_t i = 0; i < table.size(); i++) {
+        table[i] = Eigen::half(table_f[i]);
+        table_f[i] = static_cast<float>(table[i]);
+    }
+    vector<DataType> data_types = {DT_FLOAT16, DT_UINT8, DT_FLOAT16, DT_INT32};
+    vector<vector<int64_t>> shapes = {{batch, sub_num, centroid_num}, {code_num, sub_num}, {batch, k}, {batch, k}};
+    vector<Eigen::half> topk_distance(batch * k);
+    vector<int32_t> topk_index(batch * k);
+    vector<void*> datas = {(void*)table.data(), (void*)codes.data(), (void*)topk_distance.data(),
+                           (void*)topk_index.data()};
+    auto node_def = CpuKernelUtils::CreateNodeDef();
+    CREATE_NODEDEF(node_def, shapes, data_types, datas, "DES", k, 4);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+    vector<float> expect_distance;
+    vector<int32_t> expect_index;
+    ReferenceTopK(table_f, codes, batch, sub_num, centroid_num, code_num, k, false, expect_distance, expect_index);
+    CheckTopKIndex(table_f, codes, sub_num, centroid_num, k, expect_distance, topk_index);
+    for (int64_t i = 0; i < batch * k; i++) {
+        EXPECT_EQ(static_cast<float>(topk_distance[i]), static_cast<float>(Eigen::half(expect_distance[i])));
+    }
+}
+
+TEST_F(TEST_TOP_K_PQ_ADC_DISTANCE_UT, CODE_OUT_OF_RANGE_FAILED)
+{
+    float table[8] = {0.0f};
+    uint8_t codes[4] = {0, 1, 4, 2};
+    vector<DataType> data_types = {DT_FLOAT, DT_UINT8, DT_FLOAT, DT_INT32};
+    vector<vector<int64_t>> shapes = {{1, 2, 4}, {2, 2}, {1, 1}, {1, 1}};
+    float topk_distance[1] = {0.0f};
+    int32_t topk_index[1] = {0};
+    vector<void*> datas = {(void*)table, (void*)codes, (void*)topk_distance, (void*)topk_index};
+    auto node_def = CpuKernelUtils::CreateNodeDef();
+    CREATE_NODEDEF(node_def, shapes, data_types, datas, "ASC", 1, 1);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
+}
+
+TEST_F(TEST_TOP_K_PQ_ADC_DISTANCE_UT, GROUP_SIZE_NOT_DIVIDE_FAILED)
+{
+    float table[8] = {0.0f};
+    uint8_t codes[6] = {0, 1, 2, 2, 3, 0};
+    vector<DataType> data_types = {DT_FLOAT, DT_UINT8, DT_FLOAT, DT_INT32};
+    vector<vector<int64_t>> shapes = {{1, 2, 4}, {3, 2}, {1, 1}, {1, 1}};
+    float topk_distance[1] = {0.0f};
+    int32_t topk_index[1] = {0};
+    vector<void*> datas = {(void*)table, (void*)codes, (void*)topk_distance, (void*)topk_index};
+    auto node_def = CpuKernelUtils::CreateNodeDef();
+    CREATE_NODEDEF(node_def, shapes, data_types, datas, "ASC", 1, 2);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
+}
+
+TEST_F(TEST_TOP_K_PQ_ADC_DISTANCE_UT, SUB_NUM_MISMATCH_FAILED)
+{
+    float table[8] = {0.0f};
+    uint8_t codes[6] = {0};
+    vector<DataType> data_types = {DT_FLOAT, DT_UINT8, DT_FLOAT, DT_INT32};
+    vector<vector<int64_t>> shapes = {{1, 2, 4}, {2, 3}, {1, 1}, {1, 1}};
+    float topk_distance[1] = {0.0f};
+    int32_t topk_index[1] = {0};
+    vector<void*> datas = {(void*)table, (void*)codes, (void*)topk_distance, (void*)topk_index};
+    auto node_def = CpuKernelUtils::CreateNodeDef();
+    CREATE_NODEDEF(node_def, shapes, data_types, datas, "ASC", 1, 1);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
+}
@@ -63,17 +63,18 @@ uint32_t TopKPQDistanceCpuKernel::DoCompute(const CpuKernelContext& ctx)
         return ret;
     }
 
-    Item<T> grp_extreme_ptr[k_];
-    Item<T> topk_ptr[k_];
-    ret = GetGroupedDistanceTopKHeap(grp_extreme_ptr, input_data);
+    // k comes from an attr, so the heaps live on the heap rather than in stack arrays sized by it.
+    std::vector<Item<T>> grp_extreme(static_cast<size_t>(k_));
+    std::vector<Item<T>> topk(static_cast<size_t>(k_));
+    ret = GetGroupedDistanceTopKHeap(grp_extreme.data(), input_data);
     if (ret != KERNEL_STATUS_OK) {
         return ret;
     }
-    ret = GetDistanceTopKHeap(topk_ptr, grp_extreme_ptr, input_data);
+    ret = GetDistanceTopKHeap(topk.data(), grp_extreme.data(), input_data);
     if (ret != KERNEL_STATUS_OK) {
         return ret;
     }
-    ret = ProcessResult(ctx, input_data, topk_ptr);
+    ret = ProcessResult(ctx, input_data, topk.data());
     if (ret != KERNEL_STATUS_OK) {
         return ret;
     }
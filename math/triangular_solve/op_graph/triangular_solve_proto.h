@@ -0,0 +1,55 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file triangular_solve_proto.h
+ * \brief
+ */
+#ifndef OPS_OP_PROTO_INC_TRIANGULAR_SOLVE_OPS_H_
+#define OPS_OP_PROTO_INC_TRIANGULAR_SOLVE_OPS_H_
+
+#include "graph/operator.h"
+#include "graph/operator_reg.h"
+
+namespace ge {
+/**
+* @brief Solves systems of linear equations op(matrix) * y = rhs with upper or lower triangular matrices by
+* backsubstitution, op(matrix) being matrix or its adjoint. \n
+
+* @par Inputs:
+* @li matrix: A tensor of shape [..., M, M]. Must be one of the following types: float32, double, complex64,
+* complex128.
+* @li rhs: A tensor of shape [..., M, N], with the same type as matrix. The batch dims of matrix and rhs are
+* broadcast. \n
+
+* @par Attributes:
+* @li lower: An optional bool. If true, the lower triangle of matrix is used, otherwise the upper. Default: True.
+* @li adjoint: An optional bool. If true, the adjoint of matrix is solved. Default: False.
+* @li unit_diagonal: An optional bool. If true, the diagonal of matrix is taken as all ones and not read.
+* Default: False. \n
+
+* @par Outputs:
+* y: A tensor of shape [..., M, N], the batch dims being the broadcast batch of matrix and rhs. \n
+
+* @par Third-party framework compatibility
+* Compatible with tensorflow MatrixTriangularSolve operator.
+*/
+REG_OP(MatrixTriangularSolve)
+    .INPUT(matrix, TensorType({DT_FLOAT, DT_DOUBLE, DT_COMPLEX64, DT_COMPLEX128}))
+    .INPUT(rhs, TensorType({DT_FLOAT, DT_DOUBLE, DT_COMPLEX64, DT_COMPLEX128}))
+    .OUTPUT(y, TensorType({DT_FLOAT, DT_DOUBLE, DT_COMPLEX64, DT_COMPLEX128}))
+    .ATTR(lower, Bool, true)
+    .ATTR(adjoint, Bool, false)
+    .ATTR(unit_diagonal, Bool, false)
+    .OP_END_FACTORY_REG(MatrixTriangularSolve)
+
+} // namespace ge
+
+#endif // OPS_OP_PROTO_INC_TRIANGULAR_SOLVE_OPS_H_
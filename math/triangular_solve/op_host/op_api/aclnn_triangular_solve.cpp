@@ -15,14 +15,9 @@
 
 #include "aclnn_triangular_solve.h"
 #include "aclnn_kernels/common/op_error_check.h"
-#include "../../../add/op_api/add.h"
 #include "conversion/broadcast_to/op_api/broadcast_to.h"
 #include "aclnn_kernels/cast.h"
 #include "aclnn_kernels/contiguous.h"
-#include "../../../eye/op_api/eye.h"
-#include "../../../mul/op_api/mul.h"
-#include "../../../ones_like/op_api/ones_like.h"
-#include "../../../sub/op_api/sub.h"
 #include "triangular_solve.h"
 #include "opdev/op_dfx.h"
 
@@ -141,35 +136,6 @@ static aclTensor* BroadcastTensor(const op::Shape dstShape, const aclTensor *src
     return const_cast<aclTensor*>(result);
 }
 
-static aclnnStatus CalcuUnitriangular(const aclTensor *&aBroadcast, aclOpExecutor *executor)
-{
-    // eye仅支持float32数据类型
-    OP_CHECK(aBroadcast->GetDataType() == op::DataType::DT_FLOAT,
-             OP_LOGE(ACLNN_ERR_PARAM_INVALID, "unitriangular mode only support float."),
-             return ACLNN_ERR_PARAM_INVALID);
-    auto aBroadcastShape = aBroadcast->GetViewShape();
-    size_t aBroadcastDimNum = aBroadcastShape.GetDimNum();
-    auto WDim = aBroadcastShape.GetDim(aBroadcastDimNum - 1);
-    op::Shape eyeShape;
-    eyeShape.AppendDim(WDim);
-    eyeShape.AppendDim(WDim);
-    auto out = executor->AllocTensor(eyeShape, aBroadcast->GetDataType());
-    // 生成一个eye矩阵
-    auto eyeResult = l0op::Eye(out, WDim, WDim, executor);
-    CHECK_RET(eyeResult != nullptr, ACLNN_ERR_INNER_NULLPTR);
-    // 生成一个全1矩阵
-    auto ones = l0op::OnesLike(eyeResult, executor);
-    CHECK_RET(ones != nullptr, ACLNN_ERR_INNER_NULLPTR);
-    // aUnitriangular = A * (1 - eye) + eye
-    auto tempSub = l0op::Sub(ones, eyeResult, executor);
-    CHECK_RET(tempSub != nullptr, ACLNN_ERR_INNER_NULLPTR);
-    auto tempMul = l0op::Mul(aBroadcast, tempSub, executor);
-    CHECK_RET(tempMul != nullptr, ACLNN_ERR_INNER_NULLPTR);
-    aBroadcast = l0op::Add(tempMul, eyeResult, executor);
-    CHECK_RET(aBroadcast != nullptr, ACLNN_ERR_INNER_NULLPTR);
-    return ACLNN_SUCCESS;
-}
-
 aclnnStatus aclnnTriangularSolveGetWorkspaceSize(
     const aclTensor *self,
     const aclTensor *A,
@@ -204,33 +170,20 @@ aclnnStatus aclnnTriangularSolveGetWorkspaceSize(
     auto aContiguous = l0op::Contiguous(A, uniqueExecutor.get());
     CHECK_RET(aContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
-    // 若输出tensor形状不同，则进行broadcast
-    const aclTensor *selfBroadcast = selfContiguous;
-    const aclTensor *aBroadcast = aContiguous;
-    if (selfContiguous->GetViewShape() != xOut->GetViewShape()) {
-        selfBroadcast = BroadcastTensor(xOut->GetViewShape(), selfContiguous, uniqueExecutor.get());
-        CHECK_RET(selfBroadcast != nullptr, ACLNN_ERR_INNER_NULLPTR);
-    }
+    // mOut为broadcast之后的A，仅在需要输出mOut时才进行broadcast
     if (mOut != nullptr) {
+        const aclTensor *aBroadcast = aContiguous;
         if (aContiguous->GetViewShape() != mOut->GetViewShape()) {
             aBroadcast = BroadcastTensor(mOut->GetViewShape(), aContiguous, uniqueExecutor.get());
             CHECK_RET(aBroadcast != nullptr, ACLNN_ERR_INNER_NULLPTR);
         }
-
-        // a broadcast之后的结果作为输出mOut
-        auto resultM = aBroadcast;
-        auto viewCopyResultM = l0op::ViewCopy(resultM, mOut, uniqueExecutor.get());
+        auto viewCopyResultM = l0op::ViewCopy(aBroadcast, mOut, uniqueExecutor.get());
         CHECK_RET(viewCopyResultM != nullptr, ACLNN_ERR_INNER_NULLPTR);
     }
 
-    // 若 unitriangular为true，需要归一A主对角线
-    if (unitriangular) {
-        ret = CalcuUnitriangular(aBroadcast, uniqueExecutor.get());
-        CHECK_RET(ret == ACLNN_SUCCESS, ret);
-    }
-
-    // 调用MatrixTriangularSolve
-    auto resultX = l0op::TriangularSolve(selfBroadcast, aBroadcast, upper, transpose, xOut, uniqueExecutor.get());
+    // 调用MatrixTriangularSolve，self与A的batch维在kernel内广播，unitriangular时kernel将A主对角线视为1
+    auto resultX = l0op::TriangularSolve(selfContiguous, aContiguous, upper, transpose, unitriangular, xOut,
+                                         uniqueExecutor.get());
     CHECK_RET(resultX != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
     // 固定写法，将计算结果拷贝到输出xOut, mOut上，可能是非连续的tensor
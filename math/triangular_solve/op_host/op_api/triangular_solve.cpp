@@ -22,17 +22,19 @@ OP_TYPE_REGISTER(TriangularSolve);
 
 // AICPU算子kernel
 static const aclTensor* TriangularSolveAiCPU(const aclTensor *self, const aclTensor *A, bool upper,
-                                             bool transpose, aclTensor *X, aclOpExecutor *executor)
+                                             bool transpose, bool unitriangular, aclTensor *X,
+                                             aclOpExecutor *executor)
 {
     // 使用框架宏ADD_TO_LAUNCHER_LIST，将AiCPU MatrixTriangularSolve
-    // TriangularSolve, self, A, upper, transpose是算子的输入，X是算子的输出
-    L0_DFX(TriangularSolveAiCPU, self, A, upper, transpose, X);
+    // TriangularSolve, self, A, upper, transpose, unitriangular是算子的输入，X是算子的输出
+    // self与A的batch维由kernel直接广播，unitriangular时kernel不读取A的主对角线
+    L0_DFX(TriangularSolveAiCPU, self, A, upper, transpose, unitriangular, X);
     static internal::AicpuTaskSpace space("MatrixTriangularSolve", ge::DEPEND_IN_SHAPE, true);
     auto ret = ADD_TO_LAUNCHER_LIST_AICPU(TriangularSolve,
-                                          OP_ATTR_NAMES({ "lower", "adjoint" }),
+                                          OP_ATTR_NAMES({ "lower", "adjoint", "unit_diagonal" }),
                                           OP_INPUT(A, self),
                                           OP_OUTPUT(X),
-                                          OP_ATTR(!upper, transpose));
+                                          OP_ATTR(!upper, transpose, unitriangular));
     CHECK_RET(ret == ACLNN_SUCCESS, nullptr);
 
     return X;
@@ -40,10 +42,11 @@ static const aclTensor* TriangularSolveAiCPU(const aclTensor *self, const aclTen
 
 // 只支持 AICPU
 const aclTensor* TriangularSolve(const aclTensor *self, const aclTensor *A, bool upper,
-                                 bool transpose, const aclTensor *xOut, aclOpExecutor *executor)
+                                 bool transpose, bool unitriangular, const aclTensor *xOut,
+                                 aclOpExecutor *executor)
 {
     auto X = executor->AllocTensor(xOut->GetViewShape(), self->GetDataType(), self->GetStorageFormat());
-    return TriangularSolveAiCPU(self, A, upper, transpose, X, executor);
+    return TriangularSolveAiCPU(self, A, upper, transpose, unitriangular, X, executor);
 }
 }
 
@@ -15,7 +15,8 @@
 
 namespace l0op {
 const aclTensor* TriangularSolve(const aclTensor *self, const aclTensor *A, bool upper,
-                                 bool transpose, const aclTensor *xOut, aclOpExecutor *executor);
+                                 bool transpose, bool unitriangular, const aclTensor *xOut,
+                                 aclOpExecutor *executor);
 }
 
 #endif // OP_API_INC_LEVEL0_OP_TRIANGULAR_SOLVE_OP_H_
@@ -0,0 +1,274 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "triangular_solve_aicpu.h"
+
+#include <algorithm>
+#include <complex>
+
+#include "aicpu/householder_qr.h"
+#include "cpu_kernel_utils.h"
+#include "utils/kernel_util.h"
+
+namespace {
+const char* const kMatrixTriangularSolve = "MatrixTriangularSolve";
+constexpr int64_t kMatrixRank = 2;
+// Rows of X are solved kTrsmBlockSize at a time; the rows still to be solved are then updated by one GEMM-style pass
+// over that block, so it is streamed from cache rather than once per solved row.
+constexpr int64_t kTrsmBlockSize = 64;
+// When the batch alone cannot feed every core the right-hand sides are split into column slices of at least
+// kTrsmMinSliceCols columns.
+constexpr int64_t kTrsmMinSliceCols = 16;
+// Problems below this many multiply-adds are solved on the calling thread.
+constexpr int64_t kTrsmSerialFlops = 64 * 1024;
+} // namespace
+
+namespace aicpu {
+namespace {
+// Element (i, p) of op(A), A being m x m row-major.
+template <typename T, bool kAdjoint>
+inline T OpElement(const T* a, int64_t m, int64_t i, int64_t p)
+{
+    return kAdjoint ? LinalgTraits<T>::Conj(a[p * m + i]) : a[i * m + p];
+}
+
+// X(i, :) -= op(A)(i, p) * X(p, :) for i in [i0, i1) and p in [p0, p1); rows of X are width wide with stride ldx.
+template <typename T, bool kAdjoint>
+void TrsmUpdate(const T* a, T* x, int64_t m, int64_t ldx, int64_t width, int64_t i0, int64_t i1, int64_t p0,
+                int64_t p1)
+{
+    for (int64_t i = i0; i < i1; i++) {
+        T* xi = x + i * ldx;
+        for (int64_t p = p0; p < p1; p++) {
+            const T aip = OpElement<T, kAdjoint>(a, m, i, p);
+            const T* xp = x + p * ldx;
+            for (int64_t j = 0; j < width; j++) {
+                xi[j] -= aip * xp[j];
+            }
+        }
+    }
+}
+
+template <typename T, bool kAdjoint>
+void TrsmDivide(const T* a, T* x, int64_t m, int64_t ldx, int64_t width, int64_t i)
+{
+    const T d = OpElement<T, kAdjoint>(a, m, i, i);
+    T* xi = x + i * ldx;
+    for (int64_t j = 0; j < width; j++) {
+        xi[j] /= d;
+    }
+}
+
+// Solves op(A) X = X in place. The diagonal of A is not read when unit_diagonal is set.
+template <typename T, bool kAdjoint>
+void TrsmSolve(const T* a, T* x, int64_t m, int64_t ldx, int64_t width, bool lower, bool unit_diagonal)
+{
+    // A^H references the other triangle of A.
+    if (lower != kAdjoint) {
+        for (int64_t k0 = 0; k0 < m; k0 += kTrsmBlockSize) {
+            const int64_t k1 = std::min(m, k0 + kTrsmBlockSize);
+            for (int64_t i = k0; i < k1; i++) {
+                TrsmUpdate<T, kAdjoint>(a, x, m, ldx, width, i, i + 1, k0, i);
+                if (!unit_diagonal) {
+                    TrsmDivide<T, kAdjoint>(a, x, m, ldx, width, i);
+                }
+            }
+            TrsmUpdate<T, kAdjoint>(a, x, m, ldx, width, k1, m, k0, k1);
+        }
+        return;
+    }
+    for (int64_t k1 = m; k1 > 0; k1 -= kTrsmBlockSize) {
+        const int64_t k0 = std::max<int64_t>(0, k1 - kTrsmBlockSize);
+        for (int64_t i = k1 - 1; i >= k0; i--) {
+            TrsmUpdate<T, kAdjoint>(a, x, m, ldx, width, i, i + 1, i + 1, k1);
+            if (!unit_diagonal) {
+                TrsmDivide<T, kAdjoint>(a, x, m, ldx, width, i);
+            }
+        }
+        TrsmUpdate<T, kAdjoint>(a, x, m, ldx, width, 0, k0, k0, k1);
+    }
+}
+} // namespace
+
+uint32_t MatrixTriangularSolveCpuKernel::Compute(CpuKernelContext& ctx)
+{
+    TriangularSolveParams params;
+    KERNEL_HANDLE_ERROR(ParseParams(ctx, params), "[%s] check params failed.", kMatrixTriangularSolve);
+    auto data_type = ctx.Input(kFirstInputIndex)->GetDataType();
+    switch (data_type) {
+        case DT_FLOAT:
+            return TriangularSolveCompute<float>(ctx, params);
+        case DT_DOUBLE:
+            return TriangularSolveCompute<double>(ctx, params);
+        case DT_COMPLEX64:
+            return TriangularSolveCompute<std::complex<float>>(ctx, params);
+        case DT_COMPLEX128:
+            return TriangularSolveCompute<std::complex<double>>(ctx, params);
+        default:
+            KERNEL_LOG_ERROR("[%s] invalid input type [%s]", kMatrixTriangularSolve, DTypeStr(data_type).c_str());
+            return KERNEL_STATUS_PARAM_INVALID;
+    }
+}
+
+uint32_t MatrixTriangularSolveCpuKernel::ParseParams(const CpuKernelContext& ctx, TriangularSolveParams& params) const
+{
+    Tensor* matrix = ctx.Input(kFirstInputIndex);
+    Tensor* rhs = ctx.Input(kSecondInputIndex);
+    Tensor* y = ctx.Output(kFirstOutputIndex);
+    KERNEL_CHECK_NULLPTR(matrix, KERNEL_STATUS_PARAM_INVALID, "[%s] get input matrix failed.", kMatrixTriangularSolve)
+    KERNEL_CHECK_NULLPTR(rhs, KERNEL_STATUS_PARAM_INVALID, "[%s] get input rhs failed.", kMatrixTriangularSolve)
+    KERNEL_CHECK_NULLPTR(y, KERNEL_STATUS_PARAM_INVALID, "[%s] get output y failed.", kMatrixTriangularSolve)
+    KERNEL_CHECK_NULLPTR(matrix->GetTensorShape(), KERNEL_STATUS_PARAM_INVALID, "[%s] get matrix shape failed.",
+                         kMatrixTriangularSolve)
+    KERNEL_CHECK_NULLPTR(rhs->GetTensorShape(), KERNEL_STATUS_PARAM_INVALID, "[%s] get rhs shape failed.",
+                         kMatrixTriangularSolve)
+    KERNEL_CHECK_NULLPTR(y->GetTensorShape(), KERNEL_STATUS_PARAM_INVALID, "[%s] get y shape failed.",
+                         kMatrixTriangularSolve)
+    const DataType data_type = matrix->GetDataType();
+    KERNEL_CHECK_FALSE(rhs->GetDataType() == data_type && y->GetDataType() == data_type, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] rhs [%s] and y [%s] should have the matrix type [%s].", kMatrixTriangularSolve,
+                       DTypeStr(rhs->GetDataType()).c_str(), DTypeStr(y->GetDataType()).c_str(),
+                       DTypeStr(data_type).c_str());
+
+    std::vector<int64_t> a_dims = matrix->GetTensorShape()->GetDimSizes();
+    std::vector<int64_t> b_dims = rhs->GetTensorShape()->GetDimSizes();
+    const int32_t a_rank = static_cast<int32_t>(a_dims.size());
+    const int32_t b_rank = static_cast<int32_t>(b_dims.size());
+    KERNEL_CHECK_FALSE(a_rank >= kMatrixRank && b_rank >= kMatrixRank, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] matrix rank [%d] and rhs rank [%d] should be at least 2.", kMatrixTriangularSolve, a_rank,
+                       b_rank);
+    params.m = a_dims[a_rank - 2];
+    params.n = b_dims[b_rank - 1];
+    KERNEL_CHECK_FALSE(a_dims[a_rank - 1] == params.m && b_dims[b_rank - 2] == params.m, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] matrix [..., %ld, %ld] should be square and match the rows of rhs [..., %ld, %ld].",
+                       kMatrixTriangularSolve, params.m, a_dims[a_rank - 1], b_dims[b_rank - 2], params.n);
+
+    // The batch dims of matrix and rhs broadcast against each other; broadcast dims get a zero matrix stride.
+    const int32_t batch_rank = std::max(a_rank, b_rank) - kMatrixRank;
+    std::vector<int64_t> batch_dims(batch_rank, 1);
+    std::vector<int64_t> a_strides(batch_rank, 0);
+    std::vector<int64_t> b_strides(batch_rank, 0);
+    int64_t a_stride = 1;
+    int64_t b_stride = 1;
+    for (int32_t d = batch_rank - 1; d >= 0; d--) {
+        const int32_t da = d - batch_rank + a_rank - kMatrixRank;
+        const int32_t db = d - batch_rank + b_rank - kMatrixRank;
+        const int64_t a_dim = (da >= 0) ? a_dims[da] : 1;
+        const int64_t b_dim = (db >= 0) ? b_dims[db] : 1;
+        KERNEL_CHECK_FALSE(a_dim == b_dim || a_dim == 1 || b_dim == 1, KERNEL_STATUS_PARAM_INVALID,
+                           "[%s] batch dim [%d] of matrix [%ld] and rhs [%ld] can not broadcast.",
+                           kMatrixTriangularSolve, d, a_dim, b_dim);
+        batch_dims[d] = (a_dim == 1) ? b_dim : a_dim;
+        a_strides[d] = (a_dim == 1) ? 0 : a_stride;
+        b_strides[d] = (b_dim == 1) ? 0 : b_stride;
+        a_stride *= a_dim;
+        b_stride *= b_dim;
+    }
+    std::vector<int64_t> y_dims = batch_dims;
+    y_dims.push_back(params.m);
+    y_dims.push_back(params.n);
+    KERNEL_CHECK_FALSE(y->GetTensorShape()->GetDimSizes() == y_dims, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] y shape should be the broadcast batch of matrix and rhs followed by [%ld, %ld].",
+                       kMatrixTriangularSolve, params.m, params.n);
+    params.batch = 1;
+    for (int64_t dim : batch_dims) {
+        params.batch *= dim;
+    }
+
+    AttrValue* lower_attr = ctx.GetAttr("lower");
+    params.lower = (lower_attr == nullptr) ? true : lower_attr->GetBool();
+    AttrValue* adjoint_attr = ctx.GetAttr("adjoint");
+    params.adjoint = (adjoint_attr == nullptr) ? false : adjoint_attr->GetBool();
+    AttrValue* unit_attr = ctx.GetAttr("unit_diagonal");
+    params.unit_diagonal = (unit_attr == nullptr) ? false : unit_attr->GetBool();
+
+    if (params.batch * params.m * params.n == 0) {
+        return KERNEL_STATUS_OK;
+    }
+    KERNEL_CHECK_NULLPTR(matrix->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] get matrix data failed.",
+                         kMatrixTriangularSolve)
+    KERNEL_CHECK_NULLPTR(rhs->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] get rhs data failed.",
+                         kMatrixTriangularSolve)
+    KERNEL_CHECK_NULLPTR(y->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] get y data failed.", kMatrixTriangularSolve)
+    params.matrix_index.resize(static_cast<size_t>(params.batch));
+    params.rhs_index.resize(static_cast<size_t>(params.batch));
+    std::vector<int64_t> pos(batch_rank, 0);
+    int64_t a_index = 0;
+    int64_t b_index = 0;
+    for (int64_t b = 0; b < params.batch; b++) {
+        params.matrix_index[b] = a_index;
+        params.rhs_index[b] = b_index;
+        for (int32_t d = batch_rank - 1; d >= 0; d--) {
+            a_index += a_strides[d];
+            b_index += b_strides[d];
+            if (++pos[d] < batch_dims[d]) {
+                break;
+            }
+            a_index -= a_strides[d] * batch_dims[d];
+            b_index -= b_strides[d] * batch_dims[d];
+            pos[d] = 0;
+        }
+    }
+    return KERNEL_STATUS_OK;
+}
+
+template <typename T>
+uint32_t MatrixTriangularSolveCpuKernel::TriangularSolveCompute(const CpuKernelContext& ctx,
+                                                                const TriangularSolveParams& params) const
+{
+    const int64_t m = params.m;
+    const int64_t n = params.n;
+    const int64_t batch = params.batch;
+    if (batch * m * n == 0) {
+        return KERNEL_STATUS_OK;
+    }
+    const T* matrix = reinterpret_cast<const T*>(ctx.Input(kFirstInputIndex)->GetData());
+    const T* rhs = reinterpret_cast<const T*>(ctx.Input(kSecondInputIndex)->GetData());
+    T* y = reinterpret_cast<T*>(ctx.Output(kFirstOutputIndex)->GetData());
+
+    // Work units are (batch, column slice) pairs: the columns of X are independent right-hand sides.
+    const int64_t cores = std::max<int64_t>(1, static_cast<int64_t>(CpuKernelUtils::GetCPUNum(ctx)));
+    int64_t slices = 1;
+    if (batch < cores) {
+        slices = std::min((cores + batch - 1) / batch, std::max<int64_t>(1, n / kTrsmMinSliceCols));
+    }
+    const int64_t slice = (n + slices - 1) / slices;
+    slices = (n + slice - 1) / slice;
+    const int64_t units = batch * slices;
+
+    auto solve = [&params, matrix, rhs, y, m, n, slices, slice](int64_t begin, int64_t end) {
+        for (int64_t u = begin; u < end; u++) {
+            const int64_t b = u / slices;
+            const int64_t c0 = (u % slices) * slice;
+            const int64_t width = std::min(n, c0 + slice) - c0;
+            const T* a = matrix + params.matrix_index[b] * m * m;
+            const T* src = rhs + params.rhs_index[b] * m * n + c0;
+            T* x = y + b * m * n + c0;
+            for (int64_t i = 0; i < m; i++) {
+                std::copy(src + i * n, src + i * n + width, x + i * n);
+            }
+            if (params.adjoint) {
+                TrsmSolve<T, true>(a, x, m, n, width, params.lower, params.unit_diagonal);
+            } else {
+                TrsmSolve<T, false>(a, x, m, n, width, params.lower, params.unit_diagonal);
+            }
+        }
+    };
+    if (cores == 1 || units == 1 || batch * m * m * n < kTrsmSerialFlops) {
+        solve(0, units);
+        return KERNEL_STATUS_OK;
+    }
+    KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, units, (units + cores - 1) / cores, solve),
+                        "[%s] ParallelFor failed.", kMatrixTriangularSolve)
+    return KERNEL_STATUS_OK;
+}
+
+REGISTER_CPU_KERNEL(kMatrixTriangularSolve, MatrixTriangularSolveCpuKernel);
+} // namespace aicpu
@@ -0,0 +1,45 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef AICPU_KERNELS_TRIANGULAR_SOLVE_H_
+#define AICPU_KERNELS_TRIANGULAR_SOLVE_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "cpu_kernel.h"
+
+namespace aicpu {
+// Solves op(A) X = B for batch matrices A of m x m and B of m x n; op(A) is A or A^H (adjoint).
+struct TriangularSolveParams {
+    int64_t batch = 0;
+    int64_t m = 0;
+    int64_t n = 0;
+    bool lower = true;
+    bool adjoint = false;
+    bool unit_diagonal = false;
+    // Matrix index of A and B for every batch of the broadcast output.
+    std::vector<int64_t> matrix_index;
+    std::vector<int64_t> rhs_index;
+};
+
+class MatrixTriangularSolveCpuKernel : public CpuKernel {
+public:
+    MatrixTriangularSolveCpuKernel() = default;
+    ~MatrixTriangularSolveCpuKernel() override = default;
+    uint32_t Compute(CpuKernelContext& ctx) override;
+
+private:
+    uint32_t ParseParams(const CpuKernelContext& ctx, TriangularSolveParams& params) const;
+    template <typename T>
+    uint32_t TriangularSolveCompute(const CpuKernelContext& ctx, const TriangularSolveParams& params) const;
+};
+} // namespace aicpu
+#endif // AICPU_KERNELS_TRIANGULAR_SOLVE_H_
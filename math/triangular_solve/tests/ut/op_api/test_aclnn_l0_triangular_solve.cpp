@@ -54,7 +54,7 @@ TEST_F(TriangularSolveTest, TriangularSolve_float_upper_false) {
   auto xOut = CreateContiguousAclTensor({3, 4}, ACL_FLOAT);
   bool upper = false;
   bool transpose = false;
-  auto result = l0op::TriangularSolve(self, A, upper, transpose, xOut, l0Executor);
+  auto result = l0op::TriangularSolve(self, A, upper, transpose, false, xOut, l0Executor);
   ASSERT_NE(result, nullptr);
 
   op::ShapeVector expectShape({3, 4});
@@ -67,7 +67,7 @@ TEST_F(TriangularSolveTest, TriangularSolve_float_upper_true) {
   auto xOut = CreateContiguousAclTensor({3, 4}, ACL_FLOAT);
   bool upper = true;
   bool transpose = false;
-  auto result = l0op::TriangularSolve(self, A, upper, transpose, xOut, l0Executor);
+  auto result = l0op::TriangularSolve(self, A, upper, transpose, false, xOut, l0Executor);
   ASSERT_NE(result, nullptr);
 
   op::ShapeVector expectShape({3, 4});
@@ -80,7 +80,7 @@ TEST_F(TriangularSolveTest, TriangularSolve_transpose_true) {
   auto xOut = CreateContiguousAclTensor({3, 4}, ACL_FLOAT);
   bool upper = true;
   bool transpose = true;
-  auto result = l0op::TriangularSolve(self, A, upper, transpose, xOut, l0Executor);
+  auto result = l0op::TriangularSolve(self, A, upper, transpose, false, xOut, l0Executor);
   ASSERT_NE(result, nullptr);
 
   op::ShapeVector expectShape({3, 4});
@@ -93,7 +93,7 @@ TEST_F(TriangularSolveTest, TriangularSolve_double) {
   auto xOut = CreateContiguousAclTensor({3, 4}, ACL_DOUBLE);
   bool upper = true;
   bool transpose = false;
-  auto result = l0op::TriangularSolve(self, A, upper, transpose, xOut, l0Executor);
+  auto result = l0op::TriangularSolve(self, A, upper, transpose, false, xOut, l0Executor);
   ASSERT_NE(result, nullptr);
 
   op::ShapeVector expectShape({3, 4});
@@ -106,7 +106,7 @@ TEST_F(TriangularSolveTest, TriangularSolve_complex64) {
   auto xOut = CreateContiguousAclTensor({3, 4}, ACL_COMPLEX64);
   bool upper = true;
   bool transpose = false;
-  auto result = l0op::TriangularSolve(self, A, upper, transpose, xOut, l0Executor);
+  auto result = l0op::TriangularSolve(self, A, upper, transpose, false, xOut, l0Executor);
   ASSERT_NE(result, nullptr);
 
   op::ShapeVector expectShape({3, 4});
@@ -119,7 +119,7 @@ TEST_F(TriangularSolveTest, TriangularSolve_complex128) {
   auto xOut = CreateContiguousAclTensor({3, 4}, ACL_COMPLEX128);
   bool upper = true;
   bool transpose = false;
-  auto result = l0op::TriangularSolve(self, A, upper, transpose, xOut, l0Executor);
+  auto result = l0op::TriangularSolve(self, A, upper, transpose, false, xOut, l0Executor);
   ASSERT_NE(result, nullptr);
 
   op::ShapeVector expectShape({3, 4});
@@ -132,7 +132,7 @@ TEST_F(TriangularSolveTest, TriangularSolve_batch) {
   auto xOut = CreateContiguousAclTensor({2, 3, 4}, ACL_FLOAT);
   bool upper = true;
   bool transpose = false;
-  auto result = l0op::TriangularSolve(self, A, upper, transpose, xOut, l0Executor);
+  auto result = l0op::TriangularSolve(self, A, upper, transpose, false, xOut, l0Executor);
   ASSERT_NE(result, nullptr);
 
   op::ShapeVector expectShape({2, 3, 4});
@@ -145,7 +145,7 @@ TEST_F(TriangularSolveTest, TriangularSolve_4d_batch) {
   auto xOut = CreateContiguousAclTensor({1, 1, 3, 4}, ACL_FLOAT);
   bool upper = true;
   bool transpose = false;
-  auto result = l0op::TriangularSolve(self, A, upper, transpose, xOut, l0Executor);
+  auto result = l0op::TriangularSolve(self, A, upper, transpose, false, xOut, l0Executor);
   ASSERT_NE(result, nullptr);
 
   op::ShapeVector expectShape({1, 1, 3, 4});
@@ -158,7 +158,7 @@ TEST_F(TriangularSolveTest, TriangularSolve_single_col) {
   auto xOut = CreateContiguousAclTensor({3, 1}, ACL_FLOAT);
   bool upper = true;
   bool transpose = false;
-  auto result = l0op::TriangularSolve(self, A, upper, transpose, xOut, l0Executor);
+  auto result = l0op::TriangularSolve(self, A, upper, transpose, false, xOut, l0Executor);
   ASSERT_NE(result, nullptr);
 
   op::ShapeVector expectShape({3, 1});
@@ -171,9 +171,36 @@ TEST_F(TriangularSolveTest, TriangularSolve_empty_batch) {
   auto xOut = CreateContiguousAclTensor({0, 3, 4}, ACL_FLOAT);
   bool upper = true;
   bool transpose = false;
-  auto result = l0op::TriangularSolve(self, A, upper, transpose, xOut, l0Executor);
+  auto result = l0op::TriangularSolve(self, A, upper, transpose, false, xOut, l0Executor);
   ASSERT_NE(result, nullptr);
 
   op::ShapeVector expectShape({0, 3, 4});
   EXPECT_EQ(op::ToShapeVector(result->GetViewShape()), expectShape);
-}
\ No newline at end of file
+}
+
+TEST_F(TriangularSolveTest, TriangularSolve_unitriangular_double) {
+  auto self = CreateContiguousAclTensor({3, 4}, ACL_DOUBLE);
+  auto A = CreateContiguousAclTensor({3, 3}, ACL_DOUBLE);
+  auto xOut = CreateContiguousAclTensor({3, 4}, ACL_DOUBLE);
+  bool upper = true;
+  bool transpose = false;
+  bool unitriangular = true;
+  auto result = l0op::TriangularSolve(self, A, upper, transpose, unitriangular, xOut, l0Executor);
+  ASSERT_NE(result, nullptr);
+
+  op::ShapeVector expectShape({3, 4});
+  EXPECT_EQ(op::ToShapeVector(result->GetViewShape()), expectShape);
+}
+
+TEST_F(TriangularSolveTest, TriangularSolve_broadcast_batch) {
+  auto self = CreateContiguousAclTensor({3, 3, 4}, ACL_FLOAT);
+  auto A = CreateContiguousAclTensor({2, 1, 3, 3}, ACL_FLOAT);
+  auto xOut = CreateContiguousAclTensor({2, 3, 3, 4}, ACL_FLOAT);
+  bool upper = false;
+  bool transpose = false;
+  auto result = l0op::TriangularSolve(self, A, upper, transpose, false, xOut, l0Executor);
+  ASSERT_NE(result, nullptr);
+
+  op::ShapeVector expectShape({2, 3, 3, 4});
+  EXPECT_EQ(op::ToShapeVector(result->GetViewShape()), expectShape);
+}
@@ -0,0 +1,278 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <cmath>
+#include <complex>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "utils/aicpu_test_utils.h"
+#include "cpu_kernel_utils.h"
+#include "node_def_builder.h"
+
+using namespace std;
+using namespace aicpu;
+
+class TEST_MATRIX_TRIANGULAR_SOLVE_UT : public testing::Test {};
+
+#define CREATE_NODEDEF(shapes, data_types, datas, lower, adjoint, unit_diagonal)        \
+    auto node_def = CpuKernelUtils::CreateNodeDef();                                    \
+    NodeDefBuilder(node_def.get(), "MatrixTriangularSolve", "MatrixTriangularSolve")    \
+        .Input({"matrix", data_types[0], shapes[0], datas[0]})                          \
+        .Input({"rhs", data_types[1], shapes[1], datas[1]})                             \
+        .Output({"y", data_types[2], shapes[2], datas[2]})                              \
+        .Attr("lower", (bool)(lower))                                                   \
+        .Attr("adjoint", (bool)(adjoint))                                               \
+        .Attr("unit_diagonal", (bool)(unit_diagonal))
+
+namespace {
+template <typename T>
+T Conj(const T& v)
+{
+    return v;
+}
+
+template <typename R>
+complex<R> Conj(const complex<R>& v)
+{
+    return conj(v);
+}
+
+template <typename T>
+vector<T> RandomValues(size_t num)
+{
+    vector<double> values(num);
+    SetRandomValue<double>(values.data(), num, -1.0, 1.0);
+    return vector<T>(values.begin(), values.end());
+}
+
+template <>
+vector<complex<float>> RandomValues<complex<float>>(size_t num)
+{
+    vector<double> re = RandomValues<double>(num);
+    vector<double> im = RandomValues<double>(num);
+    vector<complex<float>> values(num);
+    for (size_t i = 0; i < num; i++) {
+        values[i] = complex<float>(re[i], im[i]);
+    }
+    return values;
+}
+
+// Triangular matrices with a dominant diagonal so that the solve is well conditioned.
+template <typename T>
+vector<T> TriangularMatrices(int64_t batch, int64_t m, bool lower)
+{
+    vector<T> a = RandomValues<T>(static_cast<size_t>(batch * m * m));
+    for (int64_t b = 0; b < batch; b++) {
+        for (int64_t i = 0; i < m; i++) {
+            T* row = a.data() + (b * m + i) * m;
+            row[i] += T(lower ? 2 : -2);
+        }
+    }
+    return a;
+}
+
+// Unblocked substitution of op(A) x = b, A being m x m row-major and b m x n.
+template <typename T>
+vector<T> ReferenceSolve(const T* a, const T* rhs, int64_t m, int64_t n, bool lower, bool adjoint, bool unit)
+{
+    auto op = [a, m, adjoint](int64_t i, int64_t p) { return adjoint ? Conj(a[p * m + i]) : a[i * m + p]; };
+    const bool op_lower = (lower != adjoint);
+    vector<T> x(rhs, rhs + m * n);
+    for (int64_t j = 0; j < n; j++) {
+        for (int64_t s = 0; s < m; s++) {
+            const int64_t i = op_lower ? s : m - 1 - s;
+            T sum = x[i * n + j];
+            const int64_t p0 = op_lower ? 0 : i + 1;
+            const int64_t p1 = op_lower ? i : m;
+            for (int64_t p = p0; p < p1; p++) {
+                sum -= op(i, p) * x[p * n + j];
+            }
+            x[i * n + j] = unit ? sum : sum / op(i, i);
+        }
+    }
+    return x;
+}
+
+template <typename T>
+void ExpectNear(const vector<T>& actual, const vector<T>& expect, double tol)
+{
+    ASSERT_EQ(actual.size(), expect.size());
+    for (size_t i = 0; i < actual.size(); i++) {
+        EXPECT_LE(abs(actual[i] - expect[i]), tol * (1.0 + abs(expect[i]))) << "at " << i;
+    }
+}
+} // namespace
+
+TEST_F(TEST_MATRIX_TRIANGULAR_SOLVE_UT, FLOAT_LOWER_SUCCESS)
+{
+    float a[9] = {2, 0, 0, 1, 4, 0, 3, 2, 1};
+    float b[6] = {2, 4, 5, 12, 9, 14};
+    float y[6] = {0};
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{3, 3}, {3, 2}, {3, 2}};
+    vector<void*> datas = {(void*)a, (void*)b, (void*)y};
+    CREATE_NODEDEF(shapes, data_types, datas, true, false, false);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    float expect[6] = {1, 2, 1, 2.5f, 4, 3};
+    for (int i = 0; i < 6; i++) {
+        EXPECT_FLOAT_EQ(y[i], expect[i]);
+    }
+}
+
+TEST_F(TEST_MATRIX_TRIANGULAR_SOLVE_UT, FLOAT_UPPER_UNIT_DIAGONAL_SUCCESS)
+{
+    // The diagonal must not be read.
+    float a[9] = {7, 2, 3, 0, -5, 4, 0, 0, 0};
+    float b[3] = {1, 2, 3};
+    float y[3] = {0};
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{3, 3}, {3, 1}, {3, 1}};
+    vector<void*> datas = {(void*)a, (void*)b, (void*)y};
+    CREATE_NODEDEF(shapes, data_types, datas, false, false, true);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    EXPECT_FLOAT_EQ(y[2], 3.0f);
+    EXPECT_FLOAT_EQ(y[1], -10.0f);
+    EXPECT_FLOAT_EQ(y[0], 12.0f);
+}
+
+TEST_F(TEST_MATRIX_TRIANGULAR_SOLVE_UT, DOUBLE_UNIT_DIAGONAL_LARGE_SUCCESS)
+{
+    const int64_t m = 150;
+    const int64_t n = 70;
+    for (bool lower : {true, false}) {
+        for (bool adjoint : {false, true}) {
+            vector<double> a = RandomValues<double>(m * m);
+            // Keep the unit triangular system well conditioned.
+            for (auto& v : a) {
+                v *= 0.05;
+            }
+            vector<double> b = RandomValues<double>(m * n);
+            vector<double> y(m * n, 0);
+            vector<DataType> data_types = {DT_DOUBLE, DT_DOUBLE, DT_DOUBLE};
+            vector<vector<int64_t>> shapes = {{m, m}, {m, n}, {m, n}};
+            vector<void*> datas = {(void*)a.data(), (void*)b.data(), (void*)y.data()};
+            CREATE_NODEDEF(shapes, data_types, datas, lower, adjoint, true);
+            RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+            ExpectNear(y, ReferenceSolve(a.data(), b.data(), m, n, lower, adjoint, true), 1e-10);
+        }
+    }
+}
+
+TEST_F(TEST_MATRIX_TRIANGULAR_SOLVE_UT, COMPLEX64_ADJOINT_SUCCESS)
+{
+    const int64_t batch = 3;
+    const int64_t m = 20;
+    const int64_t n = 5;
+    vector<complex<float>> a = TriangularMatrices<complex<float>>(batch, m, true);
+    vector<complex<float>> b = RandomValues<complex<float>>(batch * m * n);
+    vector<complex<float>> y(batch * m * n);
+    vector<DataType> data_types = {DT_COMPLEX64, DT_COMPLEX64, DT_COMPLEX64};
+    vector<vector<int64_t>> shapes = {{batch, m, m}, {batch, m, n}, {batch, m, n}};
+    vector<void*> datas = {(void*)a.data(), (void*)b.data(), (void*)y.data()};
+    CREATE_NODEDEF(shapes, data_types, datas, true, true, false);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    for (int64_t k = 0; k < batch; k++) {
+        vector<complex<float>> expect =
+            ReferenceSolve(a.data() + k * m * m, b.data() + k * m * n, m, n, true, true, false);
+        vector<complex<float>> actual(y.begin() + k * m * n, y.begin() + (k + 1) * m * n);
+        ExpectNear(actual, expect, 1e-4);
+    }
+}
+
+TEST_F(TEST_MATRIX_TRIANGULAR_SOLVE_UT, FLOAT_BROADCAST_BATCH_SUCCESS)
+{
+    // matrix [2, 1, m, m] and rhs [3, m, n] give y [2, 3, m, n] without materialising the broadcast.
+    const int64_t m = 8;
+    const int64_t n = 4;
+    vector<float> a = TriangularMatrices<float>(2, m, false);
+    vector<float> b = RandomValues<float>(3 * m * n);
+    vector<float> y(6 * m * n, 0);
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{2, 1, m, m}, {3, m, n}, {2, 3, m, n}};
+    vector<void*> datas = {(void*)a.data(), (void*)b.data(), (void*)y.data()};
+    CREATE_NODEDEF(shapes, data_types, datas, false, false, false);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    for (int64_t i = 0; i < 2; i++) {
+        for (int64_t j = 0; j < 3; j++) {
+            vector<float> expect = ReferenceSolve(a.data() + i * m * m, b.data() + j * m * n, m, n, false, false, false);
+            vector<float> actual(y.begin() + (i * 3 + j) * m * n, y.begin() + (i * 3 + j + 1) * m * n);
+            ExpectNear(actual, expect, 1e-5);
+        }
+    }
+}
+
+TEST_F(TEST_MATRIX_TRIANGULAR_SOLVE_UT, FLOAT_LARGE_PARALLEL_SUCCESS)
+{
+    const int64_t m = 512;
+    const int64_t n = 512;
+    vector<float> a = TriangularMatrices<float>(1, m, true);
+    for (int64_t i = 0; i < m; i++) {
+        for (int64_t j = 0; j < i; j++) {
+            a[i * m + j] *= 0.05f;
+        }
+    }
+    vector<float> b = RandomValues<float>(m * n);
+    vector<float> y(m * n, 0);
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{m, m}, {m, n}, {m, n}};
+    vector<void*> datas = {(void*)a.data(), (void*)b.data(), (void*)y.data()};
+    CREATE_NODEDEF(shapes, data_types, datas, true, false, false);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    ExpectNear(y, ReferenceSolve(a.data(), b.data(), m, n, true, false, false), 1e-4);
+}
+
+TEST_F(TEST_MATRIX_TRIANGULAR_SOLVE_UT, EMPTY_BATCH_SUCCESS)
+{
+    float a[1] = {0};
+    float b[1] = {0};
+    float y[1] = {0};
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{0, 3, 3}, {0, 3, 2}, {0, 3, 2}};
+    vector<void*> datas = {(void*)a, (void*)b, (void*)y};
+    CREATE_NODEDEF(shapes, data_types, datas, true, false, false);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+}
+
+TEST_F(TEST_MATRIX_TRIANGULAR_SOLVE_UT, BROADCAST_FAILED)
+{
+    float a[18] = {0};
+    float b[18] = {0};
+    float y[18] = {0};
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{2, 3, 3}, {3, 3, 2}, {3, 3, 2}};
+    vector<void*> datas = {(void*)a, (void*)b, (void*)y};
+    CREATE_NODEDEF(shapes, data_types, datas, true, false, false);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
+}
+
+TEST_F(TEST_MATRIX_TRIANGULAR_SOLVE_UT, OUTPUT_SHAPE_FAILED)
+{
+    float a[9] = {0};
+    float b[6] = {0};
+    float y[6] = {0};
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{3, 3}, {3, 2}, {2, 3}};
+    vector<void*> datas = {(void*)a, (void*)b, (void*)y};
+    CREATE_NODEDEF(shapes, data_types, datas, true, false, false);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
+}
+
+TEST_F(TEST_MATRIX_TRIANGULAR_SOLVE_UT, INT32_DTYPE_FAILED)
+{
+    int32_t a[9] = {0};
+    int32_t b[3] = {0};
+    int32_t y[3] = {0};
+    vector<DataType> data_types = {DT_INT32, DT_INT32, DT_INT32};
+    vector<vector<int64_t>> shapes = {{3, 3}, {3, 1}, {3, 1}};
+    vector<void*> datas = {(void*)a, (void*)b, (void*)y};
+    CREATE_NODEDEF(shapes, data_types, datas, true, false, false);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
+}
@@ -0,0 +1,178 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <iostream>
+#include <vector>
+#include "acl/acl.h"
+#include "aclnnop/aclnn_unique_consecutive.h"
+
+#define CHECK_RET(cond, return_expr) \
+  do {                               \
+    if (!(cond)) {                   \
+      return_expr;                   \
+    }                                \
+  } while (0)
+
+#define LOG_PRINT(message,...)     \
+  do {                              \
+    printf(message, ##__VA_ARGS__); \
+  } while (0)
+
+int64_t GetShapeSize(const std::vector<int64_t>& shape) {
+  int64_t shape_size = 1;
+  for (auto i : shape) {
+    shape_size *= i;
+  }
+  return shape_size;
+}
+
+int Init(int32_t deviceId, aclrtStream* stream) {
+  // 固定写法，资源初始化
+  auto ret = aclInit(nullptr);
+  CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclInit failed. ERROR: %d\n", ret); return ret);
+  ret = aclrtSetDevice(deviceId);
+  CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclrtSetDevice failed. ERROR: %d\n", ret); return ret);
+  ret = aclrtCreateStream(stream);
+  CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclrtCreateStream failed. ERROR: %d\n", ret); return ret);
+  return 0;
+}
+
+template <typename T>
+int CreateAclTensor(const std::vector<T>& hostData, const std::vector<int64_t>& shape, void** deviceAddr,
+                    aclDataType dataType, aclTensor** tensor) {
+  auto size = GetShapeSize(shape) * sizeof(T);
+  // 调用aclrtMalloc申请device侧内存
+  auto ret = aclrtMalloc(deviceAddr, size, ACL_MEM_MALLOC_HUGE_FIRST);
+  CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclrtMalloc failed. ERROR: %d\n", ret); return ret);
+
+  // 调用aclrtMemcpy将host侧数据拷贝到device侧内存上
+  ret = aclrtMemcpy(*deviceAddr, size, hostData.data(), size, ACL_MEMCPY_HOST_TO_DEVICE);
+  CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclrtMemcpy failed. ERROR: %d\n", ret); return ret);
+
+  // 计算连续tensor的strides
+  std::vector<int64_t> strides(shape.size(), 1);
+  for (int64_t i = shape.size() - 2; i >= 0; i--) {
+    strides[i] = shape[i + 1] * strides[i + 1];
+  }
+
+  // 调用aclCreateTensor接口创建aclTensor
+  *tensor = aclCreateTensor(shape.data(), shape.size(), dataType, strides.data(), 0, aclFormat::ACL_FORMAT_ND,
+                            shape.data(), shape.size(), *deviceAddr);
+  return 0;
+}
+
+int main() {
+  // 1.（固定写法）device/stream初始化，参考acl API手册
+  // 根据自己的实际device填写deviceId
+  int32_t deviceId = 0;
+  aclrtStream stream;
+  auto ret = Init(deviceId, &stream);
+  // check根据自己的需要处理
+  CHECK_RET(ret == 0, LOG_PRINT("Init acl failed. ERROR: %d\n", ret); return ret);
+
+  // 2.构造输入与输出，需要根据API的接口自定义构造
+  // 输出按全部元素互不相同的最坏情况申请，执行后通过aclGetViewShape获取实际shape
+  std::vector<int64_t> selfShape = {8};
+  std::vector<int64_t> outShape = {8};
+  void* selfDeviceAddr = nullptr;
+  void* valueDeviceAddr = nullptr;
+  void* inverseDeviceAddr = nullptr;
+  void* countsDeviceAddr = nullptr;
+  aclTensor* self = nullptr;
+  aclTensor* valueOut = nullptr;
+  aclTensor* inverseOut = nullptr;
+  aclTensor* countsOut = nullptr;
+  std::vector<int64_t> selfHostData = {1, 1, 2, 2, 3, 1, 1, 2};
+  std::vector<int64_t> valueHostData(8, 0);
+  std::vector<int64_t> inverseHostData(8, 0);
+  std::vector<int64_t> countsHostData(8, 0);
+
+  // 创建self aclTensor
+  ret = CreateAclTensor(selfHostData, selfShape, &selfDeviceAddr, aclDataType::ACL_INT64, &self);
+  CHECK_RET(ret == ACL_SUCCESS, return ret);
+  // 创建valueOut aclTensor
+  ret = CreateAclTensor(valueHostData, outShape, &valueDeviceAddr, aclDataType::ACL_INT64, &valueOut);
+  CHECK_RET(ret == ACL_SUCCESS, return ret);
+  // 创建inverseOut aclTensor
+  ret = CreateAclTensor(inverseHostData, selfShape, &inverseDeviceAddr, aclDataType::ACL_INT64, &inverseOut);
+  CHECK_RET(ret == ACL_SUCCESS, return ret);
+  // 创建countsOut aclTensor
+  ret = CreateAclTensor(countsHostData, outShape, &countsDeviceAddr, aclDataType::ACL_INT64, &countsOut);
+  CHECK_RET(ret == ACL_SUCCESS, return ret);
+  bool returnInverse = true;
+  bool returnCounts = true;
+  // dim取1000表示展平后按元素合并
+  int64_t dim = 1000;
+
+  // 3.调用CANN算子库API，需要修改为具体的API
+  uint64_t workspaceSize = 0;
+  aclOpExecutor* executor;
+  // 调用aclnnUniqueConsecutive第一段接口
+  ret = aclnnUniqueConsecutiveGetWorkspaceSize(self, returnInverse, returnCounts, dim, valueOut, inverseOut, countsOut, &workspaceSize, &executor);
+  CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclnnUniqueConsecutiveGetWorkspaceSize failed. ERROR: %d\n", ret); return ret);
+  // 根据第一段接口计算出的workspaceSize申请device内存
+  void* workspaceAddr = nullptr;
+  if (workspaceSize > 0) {
+    ret = aclrtMalloc(&workspaceAddr, workspaceSize, ACL_MEM_MALLOC_HUGE_FIRST);
+    CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("allocate workspace failed. ERROR: %d\n", ret); return ret;);
+  }
+  // 调用aclnnUniqueConsecutive第二段接口
+  ret = aclnnUniqueConsecutive(workspaceAddr, workspaceSize, executor, stream);
+  CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclnnUniqueConsecutive failed. ERROR: %d\n", ret); return ret);
+  // 4.（固定写法）同步等待任务执行结束
+  ret = aclrtSynchronizeStream(stream);
+  CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclrtSynchronizeStream failed. ERROR: %d\n", ret); return ret);
+  // 5.获取输出的实际shape与值，将device侧内存上的结果拷贝至host侧，需要根据具体API的接口定义修改
+  int64_t* valueDims = nullptr;
+  uint64_t valueDimNum = 0;
+  ret = aclGetViewShape(valueOut, &valueDims, &valueDimNum);
+  CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclGetViewShape failed. ERROR: %d\n", ret); return ret);
+  std::vector<int64_t> valueShape(valueDims, valueDims + valueDimNum);
+  delete[] valueDims;
+  auto size = GetShapeSize(valueShape);
+  std::vector<int64_t> valueData(size, 0);
+  std::vector<int64_t> countsData(size, 0);
+  ret = aclrtMemcpy(valueData.data(), valueData.size() * sizeof(valueData[0]), valueDeviceAddr,
+                    size * sizeof(valueData[0]), ACL_MEMCPY_DEVICE_TO_HOST);
+  CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("copy result from device to host failed. ERROR: %d\n", ret); return ret);
+  ret = aclrtMemcpy(countsData.data(), countsData.size() * sizeof(int64_t), countsDeviceAddr, size * sizeof(int64_t),
+                    ACL_MEMCPY_DEVICE_TO_HOST);
+  CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("copy result from device to host failed. ERROR: %d\n", ret); return ret);
+  for (int64_t i = 0; i < size; i++) {
+    LOG_PRINT("value[%ld] is: %ld, count is: %ld\n", i, valueData[i], countsData[i]);
+  }
+  std::vector<int64_t> inverseData(8, 0);
+  ret = aclrtMemcpy(inverseData.data(), inverseData.size() * sizeof(int64_t), inverseDeviceAddr, 8 * sizeof(int64_t),
+                    ACL_MEMCPY_DEVICE_TO_HOST);
+  CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("copy result from device to host failed. ERROR: %d\n", ret); return ret);
+  for (int64_t i = 0; i < 8; i++) {
+    LOG_PRINT("inverse[%ld] is: %ld\n", i, inverseData[i]);
+  }
+
+  // 6.释放aclTensor，需要根据具体API的接口定义修改
+  aclDestroyTensor(self);
+  aclDestroyTensor(valueOut);
+  aclDestroyTensor(inverseOut);
+  aclDestroyTensor(countsOut);
+
+  // 7.释放device资源，需要根据具体API的接口定义修改
+  aclrtFree(selfDeviceAddr);
+  aclrtFree(valueDeviceAddr);
+  aclrtFree(inverseDeviceAddr);
+  aclrtFree(countsDeviceAddr);
+  if (workspaceSize > 0) {
+    aclrtFree(workspaceAddr);
+  }
+  aclrtDestroyStream(stream);
+  aclrtResetDevice(deviceId);
+  aclFinalize();
+
+  return 0;
+}
@@ -0,0 +1,162 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "aclnn_unique_consecutive.h"
+#include "unique_consecutive.h"
+#include "aclnn_kernels/contiguous.h"
+#include "aclnn/aclnn_base.h"
+#include "opdev/common_types.h"
+#include "opdev/data_type_utils.h"
+#include "opdev/op_dfx.h"
+#include "opdev/op_executor.h"
+#include "opdev/op_log.h"
+#include "opdev/shape_utils.h"
+#include "aclnn_kernels/common/op_error_check.h"
+#include "op_api/op_api_def.h"
+
+using namespace op;
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* UniqueConsecutive 算子的完整计算流程如下:
+ *              self
+ *               |
+ *      Contiguous(workspace_0)
+ *               |
+ *       UniqueConsecutive
+ *      /        |        \
+ * valueOut  inverseOut  countsOut
+ */
+
+static constexpr int64_t DIM_NONE = 1000;
+
+static const std::initializer_list<op::DataType> DTYPE_SUPPORT_LIST = {
+    op::DataType::DT_FLOAT16, op::DataType::DT_BF16,  op::DataType::DT_FLOAT, op::DataType::DT_DOUBLE,
+    op::DataType::DT_INT8,    op::DataType::DT_UINT8, op::DataType::DT_INT16, op::DataType::DT_INT32,
+    op::DataType::DT_INT64};
+
+static bool CheckNotNull(const aclTensor* self, const aclTensor* valueOut, const aclTensor* inverseOut,
+                         const aclTensor* countsOut)
+{
+    OP_CHECK_NULL(self, return false);
+    OP_CHECK_NULL(valueOut, return false);
+    OP_CHECK_NULL(inverseOut, return false);
+    OP_CHECK_NULL(countsOut, return false);
+    return true;
+}
+
+static bool CheckDtypeValid(const aclTensor* self, const aclTensor* valueOut, const aclTensor* inverseOut,
+                            const aclTensor* countsOut)
+{
+    OP_CHECK_DTYPE_NOT_SUPPORT(self, DTYPE_SUPPORT_LIST, return false);
+    OP_CHECK_DTYPE_NOT_MATCH(valueOut, self->GetDataType(), return false);
+    OP_CHECK_DTYPE_NOT_MATCH(inverseOut, op::DataType::DT_INT64, return false);
+    OP_CHECK_DTYPE_NOT_MATCH(countsOut, op::DataType::DT_INT64, return false);
+    return true;
+}
+
+// 输出按最坏情况申请：合并的位置数为展平后的元素个数或dim的长度
+static bool CheckShape(const aclTensor* self, bool returnInverse, bool returnCounts, int64_t dim,
+                       const aclTensor* valueOut, const aclTensor* inverseOut, const aclTensor* countsOut)
+{
+    OP_CHECK_MAX_DIM(self, MAX_SUPPORT_DIMS_NUMS, return false);
+    const int64_t selfDimNum = static_cast<int64_t>(self->GetViewShape().GetDimNum());
+    const int64_t selfSize = self->GetViewShape().GetShapeSize();
+    int64_t positions = selfSize;
+    if (dim != DIM_NONE) {
+        OP_CHECK(dim >= -selfDimNum && dim < selfDimNum,
+                 OP_LOGE(ACLNN_ERR_PARAM_INVALID, "dim %ld is out of range [%ld, %ld).", dim, -selfDimNum,
+                         selfDimNum),
+                 return false);
+        positions = self->GetViewShape().GetDim(dim < 0 ? dim + selfDimNum : dim);
+    }
+    OP_CHECK(valueOut->GetViewShape().GetShapeSize() >= selfSize,
+             OP_LOGE(ACLNN_ERR_PARAM_INVALID, "valueOut holds %ld elements, less than the %ld elements of self.",
+                     valueOut->GetViewShape().GetShapeSize(), selfSize),
+             return false);
+    if (returnInverse) {
+        OP_CHECK(inverseOut->GetViewShape().GetShapeSize() >= positions,
+                 OP_LOGE(ACLNN_ERR_PARAM_INVALID, "inverseOut holds %ld elements, less than the %ld positions.",
+                         inverseOut->GetViewShape().GetShapeSize(), positions),
+                 return false);
+    }
+    if (returnCounts) {
+        OP_CHECK(countsOut->GetViewShape().GetShapeSize() >= positions,
+                 OP_LOGE(ACLNN_ERR_PARAM_INVALID, "countsOut holds %ld elements, less than the %ld positions.",
+                         countsOut->GetViewShape().GetShapeSize(), positions),
+                 return false);
+    }
+    return true;
+}
+
+static aclnnStatus CheckParams(const aclTensor* self, bool returnInverse, bool returnCounts, int64_t dim,
+                               const aclTensor* valueOut, const aclTensor* inverseOut, const aclTensor* countsOut)
+{
+    // 1. 检查参数是否为空指针
+    CHECK_RET(CheckNotNull(self, valueOut, inverseOut, countsOut), ACLNN_ERR_PARAM_NULLPTR);
+
+    // 2. 检查输入输出的数据类型是否在API支持的数据类型范围之内
+    CHECK_RET(CheckDtypeValid(self, valueOut, inverseOut, countsOut), ACLNN_ERR_PARAM_INVALID);
+
+    // 3. 检查dim取值以及输出能否容纳最坏情况下的结果
+    CHECK_RET(CheckShape(self, returnInverse, returnCounts, dim, valueOut, inverseOut, countsOut),
+              ACLNN_ERR_PARAM_INVALID);
+    return ACLNN_SUCCESS;
+}
+
+aclnnStatus aclnnUniqueConsecutiveGetWorkspaceSize(const aclTensor* self, bool returnInverse, bool returnCounts,
+                                                   int64_t dim, aclTensor* valueOut, aclTensor* inverseOut,
+                                                   aclTensor* countsOut, uint64_t* workspaceSize,
+                                                   aclOpExecutor** executor)
+{
+    OP_CHECK_COMM_INPUT(workspaceSize, executor);
+    L2_DFX_PHASE_1(aclnnUniqueConsecutive, DFX_IN(self, returnInverse, returnCounts, dim),
+                   DFX_OUT(valueOut, inverseOut, countsOut));
+
+    auto uniqueExecutor = CREATE_EXECUTOR();
+    CHECK_RET(uniqueExecutor.get() != nullptr, ACLNN_ERR_INNER_CREATE_EXECUTOR);
+
+    auto ret = CheckParams(self, returnInverse, returnCounts, dim, valueOut, inverseOut, countsOut);
+    CHECK_RET(ret == ACLNN_SUCCESS, ret);
+
+    if (self->IsEmpty() && dim == DIM_NONE) {
+        valueOut->SetViewShape(op::Shape{0});
+        if (returnCounts) {
+            countsOut->SetViewShape(op::Shape{0});
+        }
+        *workspaceSize = 0;
+        uniqueExecutor.ReleaseTo(executor);
+        return ACLNN_SUCCESS;
+    }
+
+    auto selfContiguous = l0op::Contiguous(self, uniqueExecutor.get());
+    CHECK_RET(selfContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
+
+    // kernel直接写入用户输出并刷新其shape
+    auto uniqueOut = l0op::UniqueConsecutive(selfContiguous, returnInverse, returnCounts, dim, valueOut, inverseOut,
+                                             countsOut, uniqueExecutor.get());
+    CHECK_RET(uniqueOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
+
+    *workspaceSize = uniqueExecutor->GetWorkspaceSize();
+    uniqueExecutor.ReleaseTo(executor);
+    return ACLNN_SUCCESS;
+}
+
+aclnnStatus aclnnUniqueConsecutive(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor,
+                                   aclrtStream stream)
+{
+    L2_DFX_PHASE_2(aclnnUniqueConsecutive);
+    return CommonOpExecutorRun(workspace, workspaceSize, executor, stream);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,64 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef OP_API_INC_LEVEL2_ACLNN_UNIQUE_CONSECUTIVE_H_
+#define OP_API_INC_LEVEL2_ACLNN_UNIQUE_CONSECUTIVE_H_
+
+#include "aclnn/aclnn_base.h"
+#include "aclnn_util.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief aclnnUniqueConsecutive的第一段接口，根据具体的计算流程，计算workspace大小。
+ * @domain aclnn_ops_infer
+ *
+ * 算子功能：将self中连续出现的相同元素（指定dim时为沿dim连续出现的相同切片）合并为一个，可选输出各位置所属的分组索引
+ * 以及各分组的长度。
+ * @param [in] self: npu device侧的aclTensor，数据类型支持FLOAT16、BFLOAT16、FLOAT、DOUBLE、INT8、UINT8、INT16、
+ * INT32、INT64，支持非连续的Tensor，数据格式支持ND。
+ * @param [in] returnInverse: host侧的BOOL类型，是否输出inverseOut。
+ * @param [in] returnCounts: host侧的BOOL类型，是否输出countsOut。
+ * @param [in] dim: host侧的INT64类型，合并所沿的维度，取值范围为[-self.dim(), self.dim())，为1000时表示展平处理。
+ * @param [in] valueOut: npu device侧的aclTensor，数据类型与self一致，元素个数不小于self，执行后shape刷新为实际结果，
+ * 数据格式支持ND。
+ * @param [in] inverseOut: npu device侧的aclTensor，数据类型支持INT64，展平处理时shape与self一致，否则为
+ * `[self.shape[dim]]`，数据格式支持ND。
+ * @param [in] countsOut: npu device侧的aclTensor，数据类型支持INT64，1维，执行后shape刷新为分组个数，数据格式支持ND。
+ * @param [out] workspaceSize: 返回用户需要在npu device侧申请的workspace大小。
+ * @param [out] executor: 返回op执行器，包含算子计算流程。
+ * @return aclnnStatus: 返回状态码
+ */
+ACLNN_API aclnnStatus aclnnUniqueConsecutiveGetWorkspaceSize(const aclTensor* self, bool returnInverse,
+                                                             bool returnCounts, int64_t dim, aclTensor* valueOut,
+                                                             aclTensor* inverseOut, aclTensor* countsOut,
+                                                             uint64_t* workspaceSize, aclOpExecutor** executor);
+
+/**
+ * @brief aclnnUniqueConsecutive的第二段接口，用于执行计算。
+ *
+ * 算子功能：将self中连续出现的相同元素（指定dim时为沿dim连续出现的相同切片）合并为一个，可选输出各位置所属的分组索引
+ * 以及各分组的长度。
+ * @param [in] workspace: 在npu device侧申请的workspace内存起址。
+ * @param [in] workspaceSize: 在npu device侧申请的workspace大小，由第一段接口aclnnUniqueConsecutiveGetWorkspaceSize获取。
+ * @param [in] executor: op执行器，包含了算子计算流程。
+ * @param [in] stream: acl stream流。
+ * @return aclnnStatus: 返回状态码。
+ */
+ACLNN_API aclnnStatus aclnnUniqueConsecutive(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor,
+                                             aclrtStream stream);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OP_API_INC_LEVEL2_ACLNN_UNIQUE_CONSECUTIVE_H_
@@ -0,0 +1,39 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "unique_consecutive.h"
+#include "opdev/aicpu/aicpu_task.h"
+#include "opdev/make_op_executor.h"
+#include "opdev/op_def.h"
+#include "opdev/op_dfx.h"
+#include "opdev/op_executor.h"
+#include "opdev/op_log.h"
+
+using namespace op;
+
+namespace l0op {
+OP_TYPE_REGISTER(UniqueConsecutive);
+
+const aclTensor* UniqueConsecutive(const aclTensor* self, bool returnIdx, bool returnCounts, int64_t axis,
+                                   aclTensor* valueOut, aclTensor* inverseOut, aclTensor* countsOut,
+                                   aclOpExecutor* executor)
+{
+    L0_DFX(UniqueConsecutive, self, returnIdx, returnCounts, axis, valueOut, inverseOut, countsOut);
+    // 输出shape依赖计算结果，执行后按kernel写回的实际shape刷新各输出
+    static internal::AicpuTaskSpace space("UniqueConsecutive", ge::DEPEND_SHAPE_RANGE);
+    auto ret = ADD_TO_LAUNCHER_LIST_AICPU(UniqueConsecutive, OP_ATTR_NAMES({"return_idx", "return_counts", "axis"}),
+                                          OP_INPUT(self), OP_OUTPUT(valueOut, inverseOut, countsOut),
+                                          OP_ATTR(returnIdx, returnCounts, axis));
+    OP_CHECK(ret == ACLNN_SUCCESS,
+             OP_LOGE(ACLNN_ERR_INNER_NULLPTR, "UniqueConsecutive ADD_TO_LAUNCHER_LIST_AICPU failed."),
+             return nullptr);
+    return valueOut;
+}
+} // namespace l0op
@@ -0,0 +1,23 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef OP_API_INC_LEVEL0_OP_UNIQUE_CONSECUTIVE_OP_H_
+#define OP_API_INC_LEVEL0_OP_UNIQUE_CONSECUTIVE_OP_H_
+
+#include "opdev/op_executor.h"
+
+namespace l0op {
+// 输出按全部位置互不相同的最大shape传入，执行后由kernel刷新为实际shape；axis为1000时按展平处理
+const aclTensor* UniqueConsecutive(const aclTensor* self, bool returnIdx, bool returnCounts, int64_t axis,
+                                   aclTensor* valueOut, aclTensor* inverseOut, aclTensor* countsOut,
+                                   aclOpExecutor* executor);
+}
+
+#endif // OP_API_INC_LEVEL0_OP_UNIQUE_CONSECUTIVE_OP_H_
@@ -0,0 +1,53 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef OPS_OP_PROTO_UNIQUE_CONSECUTIVE_H_
+#define OPS_OP_PROTO_UNIQUE_CONSECUTIVE_H_
+
+#include "graph/operator_reg.h"
+
+namespace ge {
+/**
+ * @brief Collapses every run of consecutive equal elements (or, with an axis, of equal consecutive slices) to one,
+ * optionally returning the run of every input position and the length of every run. \n
+ *
+ * @par Inputs:
+ * x: A Tensor. Must be one of the following types: float16, bfloat16, float32, double, int8, uint8, int16, int32,
+ * int64. \n
+ *
+ * @par Attributes:
+ * @li return_idx: An optional bool. Whether to fill idx. Default: false.
+ * @li return_counts: An optional bool. Whether to fill count. Default: false.
+ * @li axis: An optional int. The axis to collapse slices along, in range [-rank(x), rank(x)); 1000 flattens x and
+ * collapses elements. Default: 1000. \n
+ *
+ * @par Outputs:
+ * @li y: The runs of x. 1D of the run count when x is flattened, otherwise the shape of x with the axis resized to
+ * the run count. Has the same type as x.
+ * @li idx: A Tensor of type int64, the run of every position: the shape of x when x is flattened, otherwise the
+ * length of the axis.
+ * @li count: A 1D Tensor of type int64, the length of every run. \n
+ *
+ * @par Restrictions:
+ * Elements compare as IEEE values: -0 equals +0 and a NaN equals nothing, so every NaN is a run of its own.
+ * Warning: THIS FUNCTION IS EXPERIMENTAL.  Please do not use.
+ */
+REG_OP(UniqueConsecutive)
+    .INPUT(x, TensorType({DT_FLOAT16, DT_BF16, DT_FLOAT, DT_DOUBLE, DT_INT8, DT_UINT8, DT_INT16, DT_INT32, DT_INT64}))
+    .OUTPUT(y, TensorType({DT_FLOAT16, DT_BF16, DT_FLOAT, DT_DOUBLE, DT_INT8, DT_UINT8, DT_INT16, DT_INT32, DT_INT64}))
+    .OUTPUT(idx, TensorType({DT_INT64}))
+    .OUTPUT(count, TensorType({DT_INT64}))
+    .ATTR(return_idx, Bool, false)
+    .ATTR(return_counts, Bool, false)
+    .ATTR(axis, Int, 1000)
+    .OP_END_FACTORY_REG(UniqueConsecutive)
+} // namespace ge
+
+#endif // OPS_OP_PROTO_UNIQUE_CONSECUTIVE_H_
@@ -0,0 +1,245 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "unique_consecutive_aicpu.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "aicpu/unique_compact.h"
+#include "cpu_kernel_utils.h"
+#include "utils/kernel_util.h"
+
+namespace {
+const char* const kUniqueConsecutive = "UniqueConsecutive";
+const char* const kReturnIdx = "return_idx";
+const char* const kReturnCounts = "return_counts";
+const char* const kAxis = "axis";
+// Axis value meaning "flatten x", as in the UniqueConsecutive IR.
+constexpr int64_t kAxisNone = 1000;
+} // namespace
+
+namespace aicpu {
+namespace {
+// IEEE equality as in pytorch: -0 equals +0 and a NaN equals nothing, so every NaN starts a run of its own.
+template <typename T>
+inline bool SameValue(T a, T b)
+{
+    return a == b;
+}
+
+// Flattened x: position i is element i.
+template <typename T>
+struct FlatConsecutiveOp {
+    const T* x;
+    T* y;
+    int64_t* inverse;
+
+    bool IsHead(int64_t i) const
+    {
+        return i == 0 || !SameValue(x[i], x[i - 1]);
+    }
+    void Emit(int64_t group, int64_t i, int64_t) const
+    {
+        y[group] = x[i];
+    }
+    void Assign(int64_t group, int64_t i) const
+    {
+        if (inverse != nullptr) {
+            inverse[i] = group;
+        }
+    }
+};
+
+// Position j is the slice x[:, j, :] of x viewed as [outer, depth, inner]; y is [outer, unique_num, inner].
+template <typename T>
+struct SliceConsecutiveOp {
+    const T* x;
+    T* y;
+    int64_t* inverse;
+    int64_t outer;
+    int64_t depth;
+    int64_t inner;
+
+    bool IsHead(int64_t j) const
+    {
+        if (j == 0) {
+            return true;
+        }
+        for (int64_t o = 0; o < outer; o++) {
+            const T* cur = x + (o * depth + j) * inner;
+            const T* prev = cur - inner;
+            for (int64_t k = 0; k < inner; k++) {
+                if (!SameValue(cur[k], prev[k])) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+    void Emit(int64_t group, int64_t j, int64_t unique_num) const
+    {
+        for (int64_t o = 0; o < outer; o++) {
+            const T* src = x + (o * depth + j) * inner;
+            std::copy(src, src + inner, y + (o * unique_num + group) * inner);
+        }
+    }
+    void Assign(int64_t group, int64_t j) const
+    {
+        if (inverse != nullptr) {
+            inverse[j] = group;
+        }
+    }
+};
+} // namespace
+
+uint32_t UniqueConsecutiveCpuKernel::Compute(CpuKernelContext& ctx)
+{
+    UniqueConsecutiveParams params;
+    KERNEL_HANDLE_ERROR(ParseParams(ctx, params), "[%s] check params failed.", kUniqueConsecutive);
+    auto data_type = ctx.Input(kFirstInputIndex)->GetDataType();
+    switch (data_type) {
+        case DT_FLOAT16:
+            return UniqueCompute<Eigen::half>(ctx, params);
+        case DT_BFLOAT16:
+            return UniqueCompute<Eigen::bfloat16>(ctx, params);
+        case DT_FLOAT:
+            return UniqueCompute<float>(ctx, params);
+        case DT_DOUBLE:
+            return UniqueCompute<double>(ctx, params);
+        case DT_INT8:
+            return UniqueCompute<int8_t>(ctx, params);
+        case DT_UINT8:
+            return UniqueCompute<uint8_t>(ctx, params);
+        case DT_INT16:
+            return UniqueCompute<int16_t>(ctx, params);
+        case DT_INT32:
+            return UniqueCompute<int32_t>(ctx, params);
+        case DT_INT64:
+            return UniqueCompute<int64_t>(ctx, params);
+        default:
+            KERNEL_LOG_ERROR("[%s] invalid input type [%s]", kUniqueConsecutive, DTypeStr(data_type).c_str());
+            return KERNEL_STATUS_PARAM_INVALID;
+    }
+}
+
+uint32_t UniqueConsecutiveCpuKernel::ParseParams(const CpuKernelContext& ctx, UniqueConsecutiveParams& params) const
+{
+    Tensor* x = ctx.Input(kFirstInputIndex);
+    Tensor* y = ctx.Output(kFirstOutputIndex);
+    Tensor* idx = ctx.Output(kSecondOutputIndex);
+    Tensor* count = ctx.Output(kThirdOutputIndex);
+    KERNEL_CHECK_NULLPTR(x, KERNEL_STATUS_PARAM_INVALID, "[%s] get input x failed.", kUniqueConsecutive)
+    KERNEL_CHECK_NULLPTR(y, KERNEL_STATUS_PARAM_INVALID, "[%s] get output y failed.", kUniqueConsecutive)
+    KERNEL_CHECK_NULLPTR(idx, KERNEL_STATUS_PARAM_INVALID, "[%s] get output idx failed.", kUniqueConsecutive)
+    KERNEL_CHECK_NULLPTR(count, KERNEL_STATUS_PARAM_INVALID, "[%s] get output count failed.", kUniqueConsecutive)
+    KERNEL_CHECK_FALSE(y->GetDataType() == x->GetDataType(), KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] y type [%s] should be the same as x type [%s].", kUniqueConsecutive,
+                       DTypeStr(y->GetDataType()).c_str(), DTypeStr(x->GetDataType()).c_str());
+    KERNEL_CHECK_FALSE(idx->GetDataType() == DT_INT64 && count->GetDataType() == DT_INT64,
+                       KERNEL_STATUS_PARAM_INVALID, "[%s] idx type [%s] and count type [%s] should be int64.",
+                       kUniqueConsecutive, DTypeStr(idx->GetDataType()).c_str(),
+                       DTypeStr(count->GetDataType()).c_str());
+    auto x_shape = x->GetTensorShape();
+    KERNEL_CHECK_NULLPTR(x_shape, KERNEL_STATUS_PARAM_INVALID, "[%s] get x shape failed.", kUniqueConsecutive)
+    params.x_dims = x_shape->GetDimSizes();
+
+    AttrValue* return_idx = ctx.GetAttr(kReturnIdx);
+    params.return_idx = (return_idx != nullptr) && return_idx->GetBool();
+    AttrValue* return_counts = ctx.GetAttr(kReturnCounts);
+    params.return_counts = (return_counts != nullptr) && return_counts->GetBool();
+    AttrValue* axis = ctx.GetAttr(kAxis);
+    const int64_t axis_value = (axis == nullptr) ? kAxisNone : axis->GetInt();
+    const int64_t rank = static_cast<int64_t>(params.x_dims.size());
+    const int64_t num = x->NumElements();
+    params.has_axis = (axis_value != kAxisNone);
+    if (params.has_axis) {
+        KERNEL_CHECK_FALSE(axis_value >= -rank && axis_value < rank, KERNEL_STATUS_PARAM_INVALID,
+                           "[%s] axis [%ld] is out of range for x of rank [%ld].", kUniqueConsecutive, axis_value,
+                           rank);
+        params.axis = axis_value < 0 ? axis_value + rank : axis_value;
+        for (int64_t d = 0; d < rank; d++) {
+            if (d < params.axis) {
+                params.outer *= params.x_dims[d];
+            } else if (d > params.axis) {
+                params.inner *= params.x_dims[d];
+            }
+        }
+        params.depth = params.x_dims[params.axis];
+    } else {
+        params.depth = num;
+    }
+
+    // The outputs are allocated for the worst case, every position unique.
+    KERNEL_CHECK_FALSE(y->NumElements() >= num, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] y holds [%ld] elements, less than the [%ld] of x.", kUniqueConsecutive,
+                       y->NumElements(), num);
+    KERNEL_CHECK_FALSE(!params.return_idx || idx->NumElements() >= params.depth, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] idx holds [%ld] elements, less than the [%ld] positions.", kUniqueConsecutive,
+                       idx->NumElements(), params.depth);
+    KERNEL_CHECK_FALSE(!params.return_counts || count->NumElements() >= params.depth, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] count holds [%ld] elements, less than the [%ld] positions.", kUniqueConsecutive,
+                       count->NumElements(), params.depth);
+    if (num > 0) {
+        KERNEL_CHECK_NULLPTR(x->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] get x data failed.",
+                             kUniqueConsecutive)
+        KERNEL_CHECK_NULLPTR(y->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] get y data failed.",
+                             kUniqueConsecutive)
+    }
+    if (params.depth > 0) {
+        KERNEL_CHECK_FALSE(!params.return_idx || idx->GetData() != nullptr, KERNEL_STATUS_PARAM_INVALID,
+                           "[%s] get idx data failed.", kUniqueConsecutive);
+        KERNEL_CHECK_FALSE(!params.return_counts || count->GetData() != nullptr, KERNEL_STATUS_PARAM_INVALID,
+                           "[%s] get count data failed.", kUniqueConsecutive);
+    }
+    return KERNEL_STATUS_OK;
+}
+
+/**
+ * Groups runs of equal neighbours along the axis (or of the flattened x) with UniqueCompact; no sort is needed. The
+ * shape of y is refreshed to the number of runs, idx becomes [depth] when an axis is given and keeps the shape of x
+ * otherwise, and count becomes [unique_num].
+ */
+template <typename T>
+uint32_t UniqueConsecutiveCpuKernel::UniqueCompute(const CpuKernelContext& ctx,
+                                                   const UniqueConsecutiveParams& params) const
+{
+    const T* x = static_cast<const T*>(ctx.Input(kFirstInputIndex)->GetData());
+    T* y = static_cast<T*>(ctx.Output(kFirstOutputIndex)->GetData());
+    int64_t* inverse = params.return_idx ? static_cast<int64_t*>(ctx.Output(kSecondOutputIndex)->GetData()) : nullptr;
+    int64_t* counts = params.return_counts ? static_cast<int64_t*>(ctx.Output(kThirdOutputIndex)->GetData()) : nullptr;
+    int64_t unique_num = 0;
+    if (params.has_axis) {
+        SliceConsecutiveOp<T> op{x, y, inverse, params.outer, params.depth, params.inner};
+        KERNEL_HANDLE_ERROR(UniqueCompact(ctx, op, params.depth, counts, unique_num, kUniqueConsecutive),
+                            "[%s] compaction failed.", kUniqueConsecutive)
+        std::vector<int64_t> y_dims = params.x_dims;
+        y_dims[params.axis] = unique_num;
+        ctx.Output(kFirstOutputIndex)->GetTensorShape()->SetDimSizes(y_dims);
+        if (params.return_idx) {
+            ctx.Output(kSecondOutputIndex)->GetTensorShape()->SetDimSizes({params.depth});
+        }
+    } else {
+        FlatConsecutiveOp<T> op{x, y, inverse};
+        KERNEL_HANDLE_ERROR(UniqueCompact(ctx, op, params.depth, counts, unique_num, kUniqueConsecutive),
+                            "[%s] compaction failed.", kUniqueConsecutive)
+        ctx.Output(kFirstOutputIndex)->GetTensorShape()->SetDimSizes({unique_num});
+        if (params.return_idx) {
+            ctx.Output(kSecondOutputIndex)->GetTensorShape()->SetDimSizes(params.x_dims);
+        }
+    }
+    if (params.return_counts) {
+        ctx.Output(kThirdOutputIndex)->GetTensorShape()->SetDimSizes({unique_num});
+    }
+    return KERNEL_STATUS_OK;
+}
+
+REGISTER_CPU_KERNEL(kUniqueConsecutive, UniqueConsecutiveCpuKernel);
+} // namespace aicpu
@@ -0,0 +1,45 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef AICPU_KERNELS_NORMALIZED_UNIQUE_CONSECUTIVE_H_
+#define AICPU_KERNELS_NORMALIZED_UNIQUE_CONSECUTIVE_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "cpu_kernel.h"
+
+namespace aicpu {
+struct UniqueConsecutiveParams {
+    // Without an axis x is flattened, every element being one position.
+    bool has_axis = false;
+    int64_t axis = 0;
+    // x viewed as [outer, depth, inner], depth being the length of the axis.
+    int64_t outer = 1;
+    int64_t depth = 1;
+    int64_t inner = 1;
+    bool return_idx = false;
+    bool return_counts = false;
+    std::vector<int64_t> x_dims;
+};
+
+class UniqueConsecutiveCpuKernel : public CpuKernel {
+public:
+    UniqueConsecutiveCpuKernel() = default;
+    ~UniqueConsecutiveCpuKernel() override = default;
+    uint32_t Compute(CpuKernelContext& ctx) override;
+
+private:
+    uint32_t ParseParams(const CpuKernelContext& ctx, UniqueConsecutiveParams& params) const;
+    template <typename T>
+    uint32_t UniqueCompute(const CpuKernelContext& ctx, const UniqueConsecutiveParams& params) const;
+};
+} // namespace aicpu
+#endif // AICPU_KERNELS_NORMALIZED_UNIQUE_CONSECUTIVE_H_
@@ -0,0 +1,40 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "register/op_def_registry.h"
+#include "../../../common/inc/aicpu/aicpu_op_def.h"
+
+namespace ops {
+class UniqueConsecutive : public OpDef {
+public:
+    explicit UniqueConsecutive(const char* name) : OpDef(name)
+    {
+        this->Input("x").DataType({ge::DT_FLOAT16, ge::DT_BF16, ge::DT_FLOAT, ge::DT_DOUBLE, ge::DT_INT8,
+                                   ge::DT_UINT8, ge::DT_INT16, ge::DT_INT32, ge::DT_INT64});
+        this->Output("y").DataType({ge::DT_FLOAT16, ge::DT_BF16, ge::DT_FLOAT, ge::DT_DOUBLE, ge::DT_INT8,
+                                    ge::DT_UINT8, ge::DT_INT16, ge::DT_INT32, ge::DT_INT64});
+        this->Output("idx").DataType({ge::DT_INT64, ge::DT_INT64, ge::DT_INT64, ge::DT_INT64, ge::DT_INT64,
+                                      ge::DT_INT64, ge::DT_INT64, ge::DT_INT64, ge::DT_INT64});
+        this->Output("count").DataType({ge::DT_INT64, ge::DT_INT64, ge::DT_INT64, ge::DT_INT64, ge::DT_INT64,
+                                        ge::DT_INT64, ge::DT_INT64, ge::DT_INT64, ge::DT_INT64});
+        this->Attr("return_idx").AttrType(OPTIONAL).Bool(false);
+        this->Attr("return_counts").AttrType(OPTIONAL).Bool(false);
+        this->Attr("axis").AttrType(OPTIONAL).Int(1000);
+
+        ApplyMathAicpuDefaultCfg(*this);
+        // The output shapes depend on the data; the kernel refreshes them within the worst case range.
+        this->AICPU().ExtendCfgInfo(OP_INFO_SUB_TYPE_OF_INFERSHAPE.c_str(), DEFAULT_SUB_TYPE_OF_INFERSHAPE_3.c_str());
+        this->AICPU().ExtendCfgInfo(OP_INFO_OPS_FLAG.c_str(), OPEN_OPS_FLAG.c_str());
+        this->AICPU().ExtendCfgInfo(OP_INFO_FORMAT_AGNOSTIC.c_str(), TRUE_FORMAT_AGNOSTIC.c_str());
+    }
+};
+
+OP_ADD(UniqueConsecutive);
+} // namespace ops
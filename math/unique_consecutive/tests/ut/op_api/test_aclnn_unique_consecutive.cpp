@@ -0,0 +1,191 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "../../../op_api/aclnn_unique_consecutive.h"
+
+#include "op_api_ut_common/op_api_ut.h"
+#include "op_api_ut_common/scalar_desc.h"
+#include "op_api_ut_common/tensor_desc.h"
+
+using namespace std;
+
+namespace {
+// 与aclnn层一致，dim取1000表示展平后去重
+constexpr int64_t DIM_NONE = 1000;
+} // namespace
+
+class l2_unique_consecutive_test : public testing::Test {
+protected:
+    static void SetUpTestCase() { cout << "unique_consecutive_test SetUp" << endl; }
+
+    static void TearDownTestCase() { cout << "unique_consecutive_test TearDown" << endl; }
+};
+
+TEST_F(l2_unique_consecutive_test, case_001_float32_flatten)
+{
+    auto selfDesc = TensorDesc({4, 5}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-2, 2);
+    auto valueDesc = TensorDesc({20}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto inverseDesc = TensorDesc({4, 5}, ACL_INT64, ACL_FORMAT_ND);
+    auto countsDesc = TensorDesc({20}, ACL_INT64, ACL_FORMAT_ND);
+
+    auto ut = OP_API_UT(aclnnUniqueConsecutive, INPUT(selfDesc, true, true, DIM_NONE),
+                        OUTPUT(valueDesc, inverseDesc, countsDesc));
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+}
+
+TEST_F(l2_unique_consecutive_test, case_002_all_dtypes)
+{
+    for (auto dtype : {ACL_FLOAT16, ACL_BF16, ACL_DOUBLE, ACL_INT8, ACL_UINT8, ACL_INT16, ACL_INT32, ACL_INT64}) {
+        auto selfDesc = TensorDesc({12}, dtype, ACL_FORMAT_ND).ValueRange(0, 3);
+        auto valueDesc = TensorDesc({12}, dtype, ACL_FORMAT_ND);
+        auto inverseDesc = TensorDesc({12}, ACL_INT64, ACL_FORMAT_ND);
+        auto countsDesc = TensorDesc({12}, ACL_INT64, ACL_FORMAT_ND);
+
+        auto ut = OP_API_UT(aclnnUniqueConsecutive, INPUT(selfDesc, true, true, DIM_NONE),
+                            OUTPUT(valueDesc, inverseDesc, countsDesc));
+        uint64_t workspaceSize = 0;
+        aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+        EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+    }
+}
+
+// 沿dim合并时inverseOut与countsOut只需容纳dim的长度
+TEST_F(l2_unique_consecutive_test, case_003_with_dim)
+{
+    auto selfDesc = TensorDesc({3, 6, 2}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-2, 2);
+    auto valueDesc = TensorDesc({3, 6, 2}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto inverseDesc = TensorDesc({6}, ACL_INT64, ACL_FORMAT_ND);
+    auto countsDesc = TensorDesc({6}, ACL_INT64, ACL_FORMAT_ND);
+    uint64_t workspaceSize = 0;
+
+    auto ut1 = OP_API_UT(aclnnUniqueConsecutive, INPUT(selfDesc, true, true, 1),
+                         OUTPUT(valueDesc, inverseDesc, countsDesc));
+    EXPECT_EQ(ut1.TestGetWorkspaceSize(&workspaceSize), ACLNN_SUCCESS);
+
+    auto ut2 = OP_API_UT(aclnnUniqueConsecutive, INPUT(selfDesc, true, true, -2),
+                         OUTPUT(valueDesc, inverseDesc, countsDesc));
+    EXPECT_EQ(ut2.TestGetWorkspaceSize(&workspaceSize), ACLNN_SUCCESS);
+}
+
+TEST_F(l2_unique_consecutive_test, case_004_dim_out_of_range)
+{
+    auto selfDesc = TensorDesc({3, 6}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-2, 2);
+    auto valueDesc = TensorDesc({3, 6}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto inverseDesc = TensorDesc({6}, ACL_INT64, ACL_FORMAT_ND);
+    auto countsDesc = TensorDesc({6}, ACL_INT64, ACL_FORMAT_ND);
+    uint64_t workspaceSize = 0;
+
+    auto ut1 = OP_API_UT(aclnnUniqueConsecutive, INPUT(selfDesc, true, true, 2),
+                         OUTPUT(valueDesc, inverseDesc, countsDesc));
+    EXPECT_EQ(ut1.TestGetWorkspaceSize(&workspaceSize), ACLNN_ERR_PARAM_INVALID);
+
+    auto ut2 = OP_API_UT(aclnnUniqueConsecutive, INPUT(selfDesc, true, true, -3),
+                         OUTPUT(valueDesc, inverseDesc, countsDesc));
+    EXPECT_EQ(ut2.TestGetWorkspaceSize(&workspaceSize), ACLNN_ERR_PARAM_INVALID);
+}
+
+TEST_F(l2_unique_consecutive_test, case_005_empty_self)
+{
+    auto selfDesc = TensorDesc({0}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto valueDesc = TensorDesc({0}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto inverseDesc = TensorDesc({0}, ACL_INT64, ACL_FORMAT_ND);
+    auto countsDesc = TensorDesc({0}, ACL_INT64, ACL_FORMAT_ND);
+
+    auto ut = OP_API_UT(aclnnUniqueConsecutive, INPUT(selfDesc, true, true, DIM_NONE),
+                        OUTPUT(valueDesc, inverseDesc, countsDesc));
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+    EXPECT_EQ(workspaceSize, 0U);
+}
+
+TEST_F(l2_unique_consecutive_test, case_006_non_contiguous_self)
+{
+    auto selfDesc = TensorDesc({4, 5}, ACL_FLOAT, ACL_FORMAT_ND, {1, 4}, 0, {5, 4}).ValueRange(-2, 2);
+    auto valueDesc = TensorDesc({20}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto inverseDesc = TensorDesc({4, 5}, ACL_INT64, ACL_FORMAT_ND);
+    auto countsDesc = TensorDesc({20}, ACL_INT64, ACL_FORMAT_ND);
+
+    auto ut = OP_API_UT(aclnnUniqueConsecutive, INPUT(selfDesc, true, true, DIM_NONE),
+                        OUTPUT(valueDesc, inverseDesc, countsDesc));
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+}
+
+TEST_F(l2_unique_consecutive_test, case_007_nullptr)
+{
+    auto selfDesc = TensorDesc({8}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-2, 2);
+    auto valueDesc = TensorDesc({8}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto inverseDesc = TensorDesc({8}, ACL_INT64, ACL_FORMAT_ND);
+    auto countsDesc = TensorDesc({8}, ACL_INT64, ACL_FORMAT_ND);
+    uint64_t workspaceSize = 0;
+
+    auto ut1 = OP_API_UT(aclnnUniqueConsecutive, INPUT((aclTensor*)nullptr, true, true, DIM_NONE),
+                         OUTPUT(valueDesc, inverseDesc, countsDesc));
+    EXPECT_EQ(ut1.TestGetWorkspaceSize(&workspaceSize), ACLNN_ERR_PARAM_NULLPTR);
+
+    auto ut2 = OP_API_UT(aclnnUniqueConsecutive, INPUT(selfDesc, true, true, DIM_NONE),
+                         OUTPUT((aclTensor*)nullptr, inverseDesc, countsDesc));
+    EXPECT_EQ(ut2.TestGetWorkspaceSize(&workspaceSize), ACLNN_ERR_PARAM_NULLPTR);
+}
+
+TEST_F(l2_unique_consecutive_test, case_008_dtype_invalid)
+{
+    auto boolDesc = TensorDesc({8}, ACL_BOOL, ACL_FORMAT_ND);
+    auto selfDesc = TensorDesc({8}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-2, 2);
+    auto valueDesc = TensorDesc({8}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto halfValueDesc = TensorDesc({8}, ACL_FLOAT16, ACL_FORMAT_ND);
+    auto inverseDesc = TensorDesc({8}, ACL_INT64, ACL_FORMAT_ND);
+    auto countsDesc = TensorDesc({8}, ACL_INT64, ACL_FORMAT_ND);
+    auto intCountsDesc = TensorDesc({8}, ACL_INT32, ACL_FORMAT_ND);
+    uint64_t workspaceSize = 0;
+
+    auto ut1 = OP_API_UT(aclnnUniqueConsecutive, INPUT(boolDesc, true, true, DIM_NONE),
+                         OUTPUT(boolDesc, inverseDesc, countsDesc));
+    EXPECT_EQ(ut1.TestGetWorkspaceSize(&workspaceSize), ACLNN_ERR_PARAM_INVALID);
+
+    auto ut2 = OP_API_UT(aclnnUniqueConsecutive, INPUT(selfDesc, true, true, DIM_NONE),
+                         OUTPUT(halfValueDesc, inverseDesc, countsDesc));
+    EXPECT_EQ(ut2.TestGetWorkspaceSize(&workspaceSize), ACLNN_ERR_PARAM_INVALID);
+
+    auto ut3 = OP_API_UT(aclnnUniqueConsecutive, INPUT(selfDesc, true, true, DIM_NONE),
+                         OUTPUT(valueDesc, inverseDesc, intCountsDesc));
+    EXPECT_EQ(ut3.TestGetWorkspaceSize(&workspaceSize), ACLNN_ERR_PARAM_INVALID);
+}
+
+TEST_F(l2_unique_consecutive_test, case_009_outputs_too_small)
+{
+    auto selfDesc = TensorDesc({2, 4}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-2, 2);
+    auto valueDesc = TensorDesc({8}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto smallValueDesc = TensorDesc({7}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto inverseDesc = TensorDesc({2, 4}, ACL_INT64, ACL_FORMAT_ND);
+    auto smallInverseDesc = TensorDesc({3}, ACL_INT64, ACL_FORMAT_ND);
+    auto countsDesc = TensorDesc({8}, ACL_INT64, ACL_FORMAT_ND);
+    uint64_t workspaceSize = 0;
+
+    auto ut1 = OP_API_UT(aclnnUniqueConsecutive, INPUT(selfDesc, true, true, DIM_NONE),
+                         OUTPUT(smallValueDesc, inverseDesc, countsDesc));
+    EXPECT_EQ(ut1.TestGetWorkspaceSize(&workspaceSize), ACLNN_ERR_PARAM_INVALID);
+
+    auto ut2 = OP_API_UT(aclnnUniqueConsecutive, INPUT(selfDesc, true, true, 1),
+                         OUTPUT(valueDesc, smallInverseDesc, countsDesc));
+    EXPECT_EQ(ut2.TestGetWorkspaceSize(&workspaceSize), ACLNN_ERR_PARAM_INVALID);
+
+    // 不返回inverse时不检查inverseOut的大小
+    auto ut3 = OP_API_UT(aclnnUniqueConsecutive, INPUT(selfDesc, false, true, 1),
+                         OUTPUT(valueDesc, smallInverseDesc, countsDesc));
+    EXPECT_EQ(ut3.TestGetWorkspaceSize(&workspaceSize), ACLNN_SUCCESS);
+}
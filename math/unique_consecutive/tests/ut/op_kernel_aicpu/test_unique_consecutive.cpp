@@ -0,0 +1,242 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "gtest/gtest.h"
+#include "utils/aicpu_test_utils.h"
+#include "cpu_kernel_utils.h"
+#include "node_def_builder.h"
+#include "Eigen/Core"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace std;
+using namespace aicpu;
+
+class TEST_UNIQUE_CONSECUTIVE_UT : public testing::Test {};
+
+namespace {
+#define CREATE_NODEDEF(node_def, shapes, data_types, datas, return_idx, return_counts, axis) \
+    NodeDefBuilder(node_def.get(), "UniqueConsecutive", "UniqueConsecutive")                 \
+        .Input({"x", data_types[0], shapes[0], datas[0]})                                    \
+        .Output({"y", data_types[1], shapes[1], datas[1]})                                   \
+        .Output({"idx", data_types[2], shapes[2], datas[2]})                                 \
+        .Output({"count", data_types[3], shapes[3], datas[3]})                               \
+        .Attr("return_idx", (bool)(return_idx))                                              \
+        .Attr("return_counts", (bool)(return_counts))                                        \
+        .Attr("axis", static_cast<int64_t>(axis))
+
+constexpr int64_t kAxisNone = 1000;
+
+// Serial run-length reference of the flattened input.
+template <typename T>
+void ReferenceRuns(const vector<T>& x, vector<T>& y, vector<int64_t>& idx, vector<int64_t>& count)
+{
+    y.clear();
+    count.clear();
+    idx.assign(x.size(), 0);
+    for (size_t i = 0; i < x.size(); i++) {
+        if (i == 0 || x[i] != x[i - 1]) {
+            y.push_back(x[i]);
+            count.push_back(0);
+        }
+        count.back()++;
+        idx[i] = static_cast<int64_t>(y.size()) - 1;
+    }
+}
+
+template <typename T>
+void RunFlatAndCheck(const vector<T>& x, DataType data_type)
+{
+    const int64_t num = static_cast<int64_t>(x.size());
+    vector<T> y(num);
+    vector<int64_t> idx(num, -1);
+    vector<int64_t> count(num, -1);
+    vector<DataType> data_types = {data_type, data_type, DT_INT64, DT_INT64};
+    vector<vector<int64_t>> shapes = {{num}, {num}, {num}, {num}};
+    vector<void*> datas = {(void*)x.data(), (void*)y.data(), (void*)idx.data(), (void*)count.data()};
+    auto node_def = CpuKernelUtils::CreateNodeDef();
+    CREATE_NODEDEF(node_def, shapes, data_types, datas, true, true, kAxisNone);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+    vector<T> expect_y;
+    vector<int64_t> expect_idx;
+    vector<int64_t> expect_count;
+    ReferenceRuns(x, expect_y, expect_idx, expect_count);
+    const int64_t unique_num = static_cast<int64_t>(expect_y.size());
+    EXPECT_EQ(ctx.Output(kFirstOutputIndex)->GetTensorShape()->GetDimSizes(), vector<int64_t>({unique_num}));
+    EXPECT_EQ(ctx.Output(kThirdOutputIndex)->GetTensorShape()->GetDimSizes(), vector<int64_t>({unique_num}));
+    EXPECT_TRUE(equal(expect_y.begin(), expect_y.end(), y.begin()));
+    EXPECT_EQ(idx, expect_idx);
+    EXPECT_TRUE(equal(expect_count.begin(), expect_count.end(), count.begin()));
+}
+} // namespace
+
+TEST_F(TEST_UNIQUE_CONSECUTIVE_UT, INT64_FLAT_SUCCESS)
+{
+    vector<int64_t> x = {1, 1, 2, 2, 3, 1, 1, 2};
+    RunFlatAndCheck(x, DT_INT64);
+}
+
+TEST_F(TEST_UNIQUE_CONSECUTIVE_UT, FLOAT_NAN_ZERO_SUCCESS)
+{
+    const float nan = numeric_limits<float>::quiet_NaN();
+    vector<float> x = {nan, nan, -0.0f, 0.0f, 1.0f, nan};
+    vector<float> y(6);
+    vector<int64_t> idx(6);
+    vector<int64_t> count(6);
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_INT64, DT_INT64};
+    vector<vector<int64_t>> shapes = {{2, 3}, {6}, {2, 3}, {6}};
+    vector<void*> datas = {(void*)x.data(), (void*)y.data(), (void*)idx.data(), (void*)count.data()};
+    auto node_def = CpuKernelUtils::CreateNodeDef();
+    CREATE_NODEDEF(node_def, shapes, data_types, datas, true, true, kAxisNone);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+    // As in pytorch every NaN is a run of its own, while -0 and +0 share one.
+    EXPECT_EQ(ctx.Output(kFirstOutputIndex)->GetTensorShape()->GetDimSizes(), vector<int64_t>({5}));
+    EXPECT_EQ(ctx.Output(kSecondOutputIndex)->GetTensorShape()->GetDimSizes(), vector<int64_t>({2, 3}));
+    EXPECT_TRUE(std::isnan(y[0]));
+    EXPECT_TRUE(std::isnan(y[1]));
+    EXPECT_EQ(y[2], 0.0f);
+    EXPECT_EQ(y[3], 1.0f);
+    EXPECT_TRUE(std::isnan(y[4]));
+    EXPECT_EQ(idx, vector<int64_t>({0, 1, 2, 2, 3, 4}));
+    EXPECT_EQ(vector<int64_t>(count.begin(), count.begin() + 5), vector<int64_t>({1, 1, 2, 1, 1}));
+}
+
+TEST_F(TEST_UNIQUE_CONSECUTIVE_UT, INT32_FLAT_PARALLEL_SUCCESS)
+{
+    vector<int32_t> x(500 * 1024 + 3);
+    mt19937 gen(1);
+    int32_t value = 0;
+    for (size_t i = 0; i < x.size(); i++) {
+        // Runs of 1 to 64 elements, plus one run long enough to cross the compaction chunks.
+        if (gen() % 32 == 0 && (i < 100000 || i > 300000)) {
+            value = static_cast<int32_t>(gen() % 5);
+        }
+        x[i] = value;
+    }
+    RunFlatAndCheck(x, DT_INT32);
+}
+
+TEST_F(TEST_UNIQUE_CONSECUTIVE_UT, OTHER_TYPES_FLAT_SUCCESS)
+{
+    mt19937 gen(2);
+    vector<Eigen::half> xh(2000);
+    vector<double> xd(2000);
+    vector<uint8_t> xu8(2000);
+    for (size_t i = 0; i < 2000; i++) {
+        const uint32_t r = gen() % 3;
+        xh[i] = Eigen::half(static_cast<float>(r));
+        xd[i] = static_cast<double>(r) * 0.5;
+        xu8[i] = static_cast<uint8_t>(r);
+    }
+    RunFlatAndCheck(xh, DT_FLOAT16);
+    RunFlatAndCheck(xd, DT_DOUBLE);
+    RunFlatAndCheck(xu8, DT_UINT8);
+}
+
+TEST_F(TEST_UNIQUE_CONSECUTIVE_UT, INT32_AXIS_SUCCESS)
+{
+    // x is [2, 4, 2]; along axis 1 the slices are A A B A.
+    vector<int32_t> x = {1, 2, 1, 2, 3, 4, 1, 2,
+                         5, 6, 5, 6, 5, 6, 5, 6};
+    vector<int32_t> y(16, -1);
+    vector<int64_t> idx(4, -1);
+    vector<int64_t> count(4, -1);
+    vector<DataType> data_types = {DT_INT32, DT_INT32, DT_INT64, DT_INT64};
+    vector<vector<int64_t>> shapes = {{2, 4, 2}, {2, 4, 2}, {4}, {4}};
+    vector<void*> datas = {(void*)x.data(), (void*)y.data(), (void*)idx.data(), (void*)count.data()};
+    auto node_def = CpuKernelUtils::CreateNodeDef();
+    CREATE_NODEDEF(node_def, shapes, data_types, datas, true, true, -2);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+    EXPECT_EQ(ctx.Output(kFirstOutputIndex)->GetTensorShape()->GetDimSizes(), vector<int64_t>({2, 3, 2}));
+    EXPECT_EQ(ctx.Output(kSecondOutputIndex)->GetTensorShape()->GetDimSizes(), vector<int64_t>({4}));
+    EXPECT_EQ(vector<int32_t>(y.begin(), y.begin() + 12), vector<int32_t>({1, 2, 3, 4, 1, 2, 5, 6, 5, 6, 5, 6}));
+    EXPECT_EQ(idx, vector<int64_t>({0, 0, 1, 2}));
+    EXPECT_EQ(vector<int64_t>(count.begin(), count.begin() + 3), vector<int64_t>({2, 1, 1}));
+}
+
+TEST_F(TEST_UNIQUE_CONSECUTIVE_UT, FLOAT_LAST_AXIS_SUCCESS)
+{
+    // x is [2, 3]; along axis 1 the columns are (1, 4) (1, 4) (2, 4).
+    vector<float> x = {1.0f, 1.0f, 2.0f, 4.0f, 4.0f, 4.0f};
+    vector<float> y(6);
+    vector<int64_t> idx(3);
+    vector<int64_t> count(3);
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_INT64, DT_INT64};
+    vector<vector<int64_t>> shapes = {{2, 3}, {2, 3}, {3}, {3}};
+    vector<void*> datas = {(void*)x.data(), (void*)y.data(), (void*)idx.data(), (void*)count.data()};
+    auto node_def = CpuKernelUtils::CreateNodeDef();
+    CREATE_NODEDEF(node_def, shapes, data_types, datas, false, true, 1);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+    EXPECT_EQ(ctx.Output(kFirstOutputIndex)->GetTensorShape()->GetDimSizes(), vector<int64_t>({2, 2}));
+    EXPECT_EQ(vector<float>(y.begin(), y.begin() + 4), vector<float>({1.0f, 2.0f, 4.0f, 4.0f}));
+    EXPECT_EQ(vector<int64_t>(count.begin(), count.begin() + 2), vector<int64_t>({2, 1}));
+}
+
+TEST_F(TEST_UNIQUE_CONSECUTIVE_UT, FLOAT_AXIS_NAN_SUCCESS)
+{
+    // x is [4, 2]; along axis 0 the rows (NaN, 1) never equal each other, the rows (-0, 2) and (0, 2) do.
+    const float nan = numeric_limits<float>::quiet_NaN();
+    vector<float> x = {nan, 1.0f, nan, 1.0f, -0.0f, 2.0f, 0.0f, 2.0f};
+    vector<float> y(8);
+    vector<int64_t> idx(4, -1);
+    vector<int64_t> count(4, -1);
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_INT64, DT_INT64};
+    vector<vector<int64_t>> shapes = {{4, 2}, {4, 2}, {4}, {4}};
+    vector<void*> datas = {(void*)x.data(), (void*)y.data(), (void*)idx.data(), (void*)count.data()};
+    auto node_def = CpuKernelUtils::CreateNodeDef();
+    CREATE_NODEDEF(node_def, shapes, data_types, datas, true, true, 0);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+    EXPECT_EQ(ctx.Output(kFirstOutputIndex)->GetTensorShape()->GetDimSizes(), vector<int64_t>({3, 2}));
+    EXPECT_EQ(idx, vector<int64_t>({0, 1, 2, 2}));
+    EXPECT_EQ(vector<int64_t>(count.begin(), count.begin() + 3), vector<int64_t>({1, 1, 2}));
+}
+
+TEST_F(TEST_UNIQUE_CONSECUTIVE_UT, EMPTY_INPUT_SUCCESS)
+{
+    vector<float> x;
+    RunFlatAndCheck(x, DT_FLOAT);
+}
+
+TEST_F(TEST_UNIQUE_CONSECUTIVE_UT, AXIS_OUT_OF_RANGE_FAILED)
+{
+    vector<float> x(6, 1.0f);
+    vector<float> y(6);
+    vector<int64_t> idx(6);
+    vector<int64_t> count(6);
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_INT64, DT_INT64};
+    vector<vector<int64_t>> shapes = {{2, 3}, {2, 3}, {3}, {3}};
+    vector<void*> datas = {(void*)x.data(), (void*)y.data(), (void*)idx.data(), (void*)count.data()};
+    auto node_def = CpuKernelUtils::CreateNodeDef();
+    CREATE_NODEDEF(node_def, shapes, data_types, datas, true, true, 2);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
+}
+
+TEST_F(TEST_UNIQUE_CONSECUTIVE_UT, COUNT_TYPE_FAILED)
+{
+    vector<float> x(6, 1.0f);
+    vector<float> y(6);
+    vector<int64_t> idx(6);
+    vector<int32_t> count(6);
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_INT64, DT_INT32};
+    vector<vector<int64_t>> shapes = {{6}, {6}, {6}, {6}};
+    vector<void*> datas = {(void*)x.data(), (void*)y.data(), (void*)idx.data(), (void*)count.data()};
+    auto node_def = CpuKernelUtils::CreateNodeDef();
+    CREATE_NODEDEF(node_def, shapes, data_types, datas, true, true, kAxisNone);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
+}
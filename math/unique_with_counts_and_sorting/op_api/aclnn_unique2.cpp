@@ -0,0 +1,178 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "aclnn_unique2.h"
+#include "unique_with_counts_and_sorting.h"
+#include "math/sort/op_api/sort.h"
+#include "aclnn_kernels/cast.h"
+#include "aclnn_kernels/contiguous.h"
+#include "aclnn_kernels/reshape.h"
+#include "aclnn/aclnn_base.h"
+#include "opdev/common_types.h"
+#include "opdev/data_type_utils.h"
+#include "opdev/op_dfx.h"
+#include "opdev/op_executor.h"
+#include "opdev/op_log.h"
+#include "opdev/shape_utils.h"
+#include "aclnn_kernels/common/op_error_check.h"
+#include "op_api/aclnn_check.h"
+#include "op_api/op_api_def.h"
+
+using namespace op;
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Unique2 算子的完整计算流程如下:
+ *              self
+ *               |
+ *      Contiguous(workspace_0)
+ *               |
+ *      Reshape(workspace_1)
+ *               |
+ *   Sort(AI Core, workspace_2)
+ *        /            \
+ *   sortedSelf    sortedIndices
+ *        |              |
+ *        |      Cast(workspace_3)
+ *         \            /
+ *   UniqueWithCountsAndSorting
+ *      /        |        \
+ * valueOut  inverseOut  countsOut
+ *
+ * AI Core的Sort不支持self时，由UniqueWithCountsAndSorting在AI CPU上一并完成排序与去重。
+ */
+
+static const std::initializer_list<op::DataType> DTYPE_SUPPORT_LIST = {
+    op::DataType::DT_FLOAT16, op::DataType::DT_BF16,  op::DataType::DT_FLOAT, op::DataType::DT_DOUBLE,
+    op::DataType::DT_INT8,    op::DataType::DT_UINT8, op::DataType::DT_INT16, op::DataType::DT_INT32,
+    op::DataType::DT_INT64};
+
+static bool CheckNotNull(const aclTensor* self, const aclTensor* valueOut, const aclTensor* inverseOut,
+                         const aclTensor* countsOut)
+{
+    OP_CHECK_NULL(self, return false);
+    OP_CHECK_NULL(valueOut, return false);
+    OP_CHECK_NULL(inverseOut, return false);
+    OP_CHECK_NULL(countsOut, return false);
+    return true;
+}
+
+static bool CheckDtypeValid(const aclTensor* self, const aclTensor* valueOut, const aclTensor* inverseOut,
+                            const aclTensor* countsOut)
+{
+    OP_CHECK_DTYPE_NOT_SUPPORT(self, DTYPE_SUPPORT_LIST, return false);
+    OP_CHECK_DTYPE_NOT_MATCH(valueOut, self->GetDataType(), return false);
+    OP_CHECK_DTYPE_NOT_MATCH(inverseOut, op::DataType::DT_INT64, return false);
+    OP_CHECK_DTYPE_NOT_MATCH(countsOut, op::DataType::DT_INT64, return false);
+    return true;
+}
+
+// 输出按最坏情况申请：valueOut、countsOut至少容纳self的全部元素
+static bool CheckShape(const aclTensor* self, bool returnInverse, bool returnCounts, const aclTensor* valueOut,
+                       const aclTensor* inverseOut, const aclTensor* countsOut)
+{
+    OP_CHECK_MAX_DIM(self, MAX_SUPPORT_DIMS_NUMS, return false);
+    const int64_t selfSize = self->GetViewShape().GetShapeSize();
+    OP_CHECK(valueOut->GetViewShape().GetShapeSize() >= selfSize,
+             OP_LOGE(ACLNN_ERR_PARAM_INVALID, "valueOut holds %ld elements, less than the %ld elements of self.",
+                     valueOut->GetViewShape().GetShapeSize(), selfSize),
+             return false);
+    if (returnInverse) {
+        OP_CHECK_SHAPE_NOT_EQUAL(inverseOut, self, return false);
+    }
+    if (returnCounts) {
+        OP_CHECK(countsOut->GetViewShape().GetShapeSize() >= selfSize,
+                 OP_LOGE(ACLNN_ERR_PARAM_INVALID, "countsOut holds %ld elements, less than the %ld elements of self.",
+                         countsOut->GetViewShape().GetShapeSize(), selfSize),
+                 return false);
+    }
+    return true;
+}
+
+static aclnnStatus CheckParams(const aclTensor* self, bool returnInverse, bool returnCounts, const aclTensor* valueOut,
+                               const aclTensor* inverseOut, const aclTensor* countsOut)
+{
+    // 1. 检查参数是否为空指针
+    CHECK_RET(CheckNotNull(self, valueOut, inverseOut, countsOut), ACLNN_ERR_PARAM_NULLPTR);
+
+    // 2. 检查输入输出的数据类型是否在API支持的数据类型范围之内
+    CHECK_RET(CheckDtypeValid(self, valueOut, inverseOut, countsOut), ACLNN_ERR_PARAM_INVALID);
+
+    // 3. 检查输出能否容纳最坏情况下的结果
+    CHECK_RET(CheckShape(self, returnInverse, returnCounts, valueOut, inverseOut, countsOut), ACLNN_ERR_PARAM_INVALID);
+    return ACLNN_SUCCESS;
+}
+
+aclnnStatus aclnnUnique2GetWorkspaceSize(const aclTensor* self, bool sorted, bool returnInverse, bool returnCounts,
+                                         aclTensor* valueOut, aclTensor* inverseOut, aclTensor* countsOut,
+                                         uint64_t* workspaceSize, aclOpExecutor** executor)
+{
+    OP_CHECK_COMM_INPUT(workspaceSize, executor);
+    L2_DFX_PHASE_1(aclnnUnique2, DFX_IN(self, sorted, returnInverse, returnCounts),
+                   DFX_OUT(valueOut, inverseOut, countsOut));
+
+    auto uniqueExecutor = CREATE_EXECUTOR();
+    CHECK_RET(uniqueExecutor.get() != nullptr, ACLNN_ERR_INNER_CREATE_EXECUTOR);
+
+    auto ret = CheckParams(self, returnInverse, returnCounts, valueOut, inverseOut, countsOut);
+    CHECK_RET(ret == ACLNN_SUCCESS, ret);
+
+    if (self->IsEmpty()) {
+        valueOut->SetViewShape(op::Shape{0});
+        if (returnCounts) {
+            countsOut->SetViewShape(op::Shape{0});
+        }
+        *workspaceSize = 0;
+        uniqueExecutor.ReleaseTo(executor);
+        return ACLNN_SUCCESS;
+    }
+
+    auto selfContiguous = l0op::Contiguous(self, uniqueExecutor.get());
+    CHECK_RET(selfContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
+
+    const int64_t flatShape[] = {selfContiguous->GetViewShape().GetShapeSize()};
+    auto selfFlat = l0op::Reshape(selfContiguous, uniqueExecutor->AllocIntArray(flatShape, 1), uniqueExecutor.get());
+    CHECK_RET(selfFlat != nullptr, ACLNN_ERR_INNER_NULLPTR);
+
+    const aclTensor* uniqueIn = selfContiguous;
+    const aclTensor* sortedIdx = nullptr;
+    // Sort会回退AI CPU时不如直接走融合的AI CPU kernel
+    if (l0op::IsSortAiCoreSupported(selfFlat, true, false)) {
+        // 展平后在AI Core上稳定升序排序，AI CPU只剩按相邻元素分组的压缩
+        auto sortOut = l0op::Sort(selfFlat, -1, false, true, op::DataType::DT_INT64, uniqueExecutor.get());
+        auto sortedSelf = std::get<0>(sortOut);
+        auto sortedIndices = std::get<1>(sortOut);
+        CHECK_RET(sortedSelf != nullptr && sortedIndices != nullptr, ACLNN_ERR_INNER_NULLPTR);
+        // 非regbase的Sort只输出int32索引
+        sortedIdx = l0op::Cast(sortedIndices, op::DataType::DT_INT64, uniqueExecutor.get());
+        CHECK_RET(sortedIdx != nullptr, ACLNN_ERR_INNER_NULLPTR);
+        uniqueIn = sortedSelf;
+    }
+
+    // kernel直接写入用户输出并刷新其shape
+    auto uniqueOut = l0op::UniqueWithCountsAndSorting(uniqueIn, sortedIdx, sorted, returnInverse, returnCounts,
+                                                      valueOut, inverseOut, countsOut, uniqueExecutor.get());
+    CHECK_RET(uniqueOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
+
+    *workspaceSize = uniqueExecutor->GetWorkspaceSize();
+    uniqueExecutor.ReleaseTo(executor);
+    return ACLNN_SUCCESS;
+}
+
+aclnnStatus aclnnUnique2(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream)
+{
+    L2_DFX_PHASE_2(aclnnUnique2);
+    return CommonOpExecutorRun(workspace, workspaceSize, executor, stream);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,62 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef OP_API_INC_LEVEL2_ACLNN_UNIQUE2_H_
+#define OP_API_INC_LEVEL2_ACLNN_UNIQUE2_H_
+
+#include "aclnn/aclnn_base.h"
+#include "aclnn_util.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief aclnnUnique2的第一段接口，根据具体的计算流程，计算workspace大小。
+ * @domain aclnn_ops_infer
+ *
+ * 算子功能：对self展平后去重，按升序输出互不相同的元素，可选输出self各元素在结果中的索引以及各元素的出现次数。
+ * @param [in] self: npu device侧的aclTensor，数据类型支持FLOAT16、BFLOAT16、FLOAT、DOUBLE、INT8、UINT8、INT16、
+ * INT32、INT64，支持非连续的Tensor，数据格式支持ND。
+ * @param [in] sorted: host侧的BOOL类型，是否按升序输出，当前实现总是按升序输出。
+ * @param [in] returnInverse: host侧的BOOL类型，是否输出inverseOut。
+ * @param [in] returnCounts: host侧的BOOL类型，是否输出countsOut。
+ * @param [in] valueOut: npu device侧的aclTensor，数据类型与self一致，1维，元素个数不小于self，执行后shape刷新为去重后
+ * 的元素个数，数据格式支持ND。
+ * @param [in] inverseOut: npu device侧的aclTensor，数据类型支持INT64，shape与self一致，数据格式支持ND。
+ * @param [in] countsOut: npu device侧的aclTensor，数据类型支持INT64，1维，元素个数不小于self，执行后shape刷新为去重后
+ * 的元素个数，数据格式支持ND。
+ * @param [out] workspaceSize: 返回用户需要在npu device侧申请的workspace大小。
+ * @param [out] executor: 返回op执行器，包含算子计算流程。
+ * @return aclnnStatus: 返回状态码
+ */
+ACLNN_API aclnnStatus aclnnUnique2GetWorkspaceSize(const aclTensor* self, bool sorted, bool returnInverse,
+                                                   bool returnCounts, aclTensor* valueOut, aclTensor* inverseOut,
+                                                   aclTensor* countsOut, uint64_t* workspaceSize,
+                                                   aclOpExecutor** executor);
+
+/**
+ * @brief aclnnUnique2的第二段接口，用于执行计算。
+ *
+ * 算子功能：对self展平后去重，按升序输出互不相同的元素，可选输出self各元素在结果中的索引以及各元素的出现次数。
+ * @param [in] workspace: 在npu device侧申请的workspace内存起址。
+ * @param [in] workspaceSize: 在npu device侧申请的workspace大小，由第一段接口aclnnUnique2GetWorkspaceSize获取。
+ * @param [in] executor: op执行器，包含了算子计算流程。
+ * @param [in] stream: acl stream流。
+ * @return aclnnStatus: 返回状态码。
+ */
+ACLNN_API aclnnStatus aclnnUnique2(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor,
+                                   aclrtStream stream);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OP_API_INC_LEVEL2_ACLNN_UNIQUE2_H_
@@ -0,0 +1,49 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "unique_with_counts_and_sorting.h"
+#include "opdev/aicpu/aicpu_task.h"
+#include "opdev/make_op_executor.h"
+#include "opdev/op_def.h"
+#include "opdev/op_dfx.h"
+#include "opdev/op_executor.h"
+#include "opdev/op_log.h"
+
+using namespace op;
+
+namespace l0op {
+OP_TYPE_REGISTER(UniqueWithCountsAndSorting);
+
+const aclTensor* UniqueWithCountsAndSorting(const aclTensor* self, const aclTensor* sortedIdx, bool sorted,
+                                            bool returnInverse, bool returnCounts, aclTensor* valueOut,
+                                            aclTensor* inverseOut, aclTensor* countsOut, aclOpExecutor* executor)
+{
+    L0_DFX(UniqueWithCountsAndSorting, self, sortedIdx, sorted, returnInverse, returnCounts, valueOut, inverseOut,
+           countsOut);
+    // 输出shape依赖计算结果，执行后按kernel写回的实际shape刷新valueOut与countsOut
+    static internal::AicpuTaskSpace space("UniqueWithCountsAndSorting", ge::DEPEND_SHAPE_RANGE);
+    aclnnStatus ret;
+    if (sortedIdx != nullptr) {
+        ret = ADD_TO_LAUNCHER_LIST_AICPU(UniqueWithCountsAndSorting,
+                                         OP_ATTR_NAMES({"sorted", "return_inverse", "return_counts"}),
+                                         OP_INPUT(self, sortedIdx), OP_OUTPUT(valueOut, inverseOut, countsOut),
+                                         OP_ATTR(sorted, returnInverse, returnCounts));
+    } else {
+        ret = ADD_TO_LAUNCHER_LIST_AICPU(UniqueWithCountsAndSorting,
+                                         OP_ATTR_NAMES({"sorted", "return_inverse", "return_counts"}),
+                                         OP_INPUT(self), OP_OUTPUT(valueOut, inverseOut, countsOut),
+                                         OP_ATTR(sorted, returnInverse, returnCounts));
+    }
+    OP_CHECK(ret == ACLNN_SUCCESS,
+             OP_LOGE(ACLNN_ERR_INNER_NULLPTR, "UniqueWithCountsAndSorting ADD_TO_LAUNCHER_LIST_AICPU failed."),
+             return nullptr);
+    return valueOut;
+}
+} // namespace l0op
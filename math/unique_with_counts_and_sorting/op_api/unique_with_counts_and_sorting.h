@@ -0,0 +1,24 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef OP_API_INC_LEVEL0_OP_UNIQUE_WITH_COUNTS_AND_SORTING_OP_H_
+#define OP_API_INC_LEVEL0_OP_UNIQUE_WITH_COUNTS_AND_SORTING_OP_H_
+
+#include "opdev/op_executor.h"
+
+namespace l0op {
+// 输出按全部元素互不相同的最大shape传入，执行后由kernel刷新为实际shape
+// sortedIdx非空时self须已升序稳定排序，sortedIdx为各元素在原输入中的位置，kernel只做去重压缩
+const aclTensor* UniqueWithCountsAndSorting(const aclTensor* self, const aclTensor* sortedIdx, bool sorted,
+                                            bool returnInverse, bool returnCounts, aclTensor* valueOut,
+                                            aclTensor* inverseOut, aclTensor* countsOut, aclOpExecutor* executor);
+}
+
+#endif // OP_API_INC_LEVEL0_OP_UNIQUE_WITH_COUNTS_AND_SORTING_OP_H_
@@ -0,0 +1,55 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef OPS_OP_PROTO_UNIQUE_WITH_COUNTS_AND_SORTING_H_
+#define OPS_OP_PROTO_UNIQUE_WITH_COUNTS_AND_SORTING_H_
+
+#include "graph/operator_reg.h"
+
+namespace ge {
+/**
+ * @brief Returns the unique elements of the flattened input in ascending order, optionally with the position of
+ * every input element in the unique values and the number of occurrences of every unique value. \n
+ *
+ * @par Inputs:
+ * x: A Tensor. Must be one of the following types: float16, bfloat16, float32, double, int8, uint8, int16, int32,
+ * int64.
+ * sorted_idx: An optional Tensor of type int64 and the shape of x. If provided, x is already sorted stably in
+ * ascending order (e.g. by Sort on the AI Core) and sorted_idx holds the original position of every element, so the
+ * kernel only groups neighbours. \n
+ *
+ * @par Attributes:
+ * @li sorted: An optional bool. Kept for compatibility, y is always sorted in ascending order. Default: true.
+ * @li return_inverse: An optional bool. Whether to fill idx. Default: false.
+ * @li return_counts: An optional bool. Whether to fill count. Default: false. \n
+ *
+ * @par Outputs:
+ * @li y: A 1D Tensor of the unique values of x in ascending order. Has the same type as x.
+ * @li idx: A Tensor of type int64 and the shape of x, the index in y of every element of x.
+ * @li count: A 1D Tensor of type int64 and the length of y, the number of occurrences of every value of y. \n
+ *
+ * @par Restrictions:
+ * Elements compare as IEEE values: -0 equals +0 and a NaN equals nothing, so NaNs sort last and each one is a
+ * unique value of its own.
+ * Warning: THIS FUNCTION IS EXPERIMENTAL.  Please do not use.
+ */
+REG_OP(UniqueWithCountsAndSorting)
+    .INPUT(x, TensorType({DT_FLOAT16, DT_BF16, DT_FLOAT, DT_DOUBLE, DT_INT8, DT_UINT8, DT_INT16, DT_INT32, DT_INT64}))
+    .OPTIONAL_INPUT(sorted_idx, TensorType({DT_INT64}))
+    .OUTPUT(y, TensorType({DT_FLOAT16, DT_BF16, DT_FLOAT, DT_DOUBLE, DT_INT8, DT_UINT8, DT_INT16, DT_INT32, DT_INT64}))
+    .OUTPUT(idx, TensorType({DT_INT64}))
+    .OUTPUT(count, TensorType({DT_INT64}))
+    .ATTR(sorted, Bool, true)
+    .ATTR(return_inverse, Bool, false)
+    .ATTR(return_counts, Bool, false)
+    .OP_END_FACTORY_REG(UniqueWithCountsAndSorting)
+} // namespace ge
+
+#endif // OPS_OP_PROTO_UNIQUE_WITH_COUNTS_AND_SORTING_H_
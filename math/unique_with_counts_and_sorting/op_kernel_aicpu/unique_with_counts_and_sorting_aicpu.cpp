@@ -0,0 +1,298 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "unique_with_counts_and_sorting_aicpu.h"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "aicpu/radix_sort.h"
+#include "aicpu/unique_compact.h"
+#include "cpu_kernel_utils.h"
+#include "utils/kernel_util.h"
+
+namespace {
+const char* const kUniqueWithCountsAndSorting = "UniqueWithCountsAndSorting";
+const char* const kReturnInverse = "return_inverse";
+const char* const kReturnCounts = "return_counts";
+// Up to kUniqueSmallSortNum elements a merge sort beats the fixed cost of the radix histograms.
+constexpr int64_t kUniqueSmallSortNum = 256;
+// Inputs of at least kUniqueParallelSortNum elements are radix sorted by every core.
+constexpr int64_t kUniqueParallelSortNum = 256 * 1024;
+} // namespace
+
+namespace aicpu {
+namespace {
+/**
+ * Positions walk the stably sorted keys, so the first element of every group is its earliest occurrence in x. Equal
+ * keys mean equal values except for NaN: every NaN shares the largest key, but as in pytorch each one is a group of
+ * its own, so x is only read back for that key.
+ */
+template <typename T>
+struct SortedUniqueOp {
+    using Key = typename RadixKey<T>::Key;
+    const KeyIndex<Key>* sorted;
+    const T* x;
+    T* y;
+    int64_t* inverse;
+
+    bool IsHead(int64_t i) const
+    {
+        if (i == 0 || sorted[i].key != sorted[i - 1].key) {
+            return true;
+        }
+        if (sorted[i].key != std::numeric_limits<Key>::max()) {
+            return false;
+        }
+        const T v = x[sorted[i].index];
+        return v != v;
+    }
+    void Emit(int64_t group, int64_t i, int64_t) const
+    {
+        y[group] = x[sorted[i].index];
+    }
+    void Assign(int64_t group, int64_t i) const
+    {
+        if (inverse != nullptr) {
+            inverse[sorted[i].index] = group;
+        }
+    }
+};
+
+// x already sorted on the device (e.g. by the AI Core Sort), positions[i] being the input position of x[i].
+template <typename T>
+struct PresortedUniqueOp {
+    const T* x;
+    const int64_t* positions;
+    T* y;
+    int64_t* inverse;
+
+    bool IsHead(int64_t i) const
+    {
+        return i == 0 || x[i] != x[i - 1];
+    }
+    void Emit(int64_t group, int64_t i, int64_t) const
+    {
+        y[group] = x[i];
+    }
+    void Assign(int64_t group, int64_t i) const
+    {
+        if (inverse != nullptr) {
+            inverse[positions[i]] = group;
+        }
+    }
+};
+} // namespace
+
+uint32_t UniqueWithCountsAndSortingCpuKernel::Compute(CpuKernelContext& ctx)
+{
+    UniqueWithCountsAndSortingParams params;
+    KERNEL_HANDLE_ERROR(ParseParams(ctx, params), "[%s] check params failed.", kUniqueWithCountsAndSorting);
+    auto data_type = ctx.Input(kFirstInputIndex)->GetDataType();
+    switch (data_type) {
+        case DT_FLOAT16:
+            return Dispatch<Eigen::half>(ctx, params);
+        case DT_BFLOAT16:
+            return Dispatch<Eigen::bfloat16>(ctx, params);
+        case DT_FLOAT:
+            return Dispatch<float>(ctx, params);
+        case DT_DOUBLE:
+            return Dispatch<double>(ctx, params);
+        case DT_INT8:
+            return Dispatch<int8_t>(ctx, params);
+        case DT_UINT8:
+            return Dispatch<uint8_t>(ctx, params);
+        case DT_INT16:
+            return Dispatch<int16_t>(ctx, params);
+        case DT_INT32:
+            return Dispatch<int32_t>(ctx, params);
+        case DT_INT64:
+            return Dispatch<int64_t>(ctx, params);
+        default:
+            KERNEL_LOG_ERROR("[%s] invalid input type [%s]", kUniqueWithCountsAndSorting,
+                             DTypeStr(data_type).c_str());
+            return KERNEL_STATUS_PARAM_INVALID;
+    }
+}
+
+template <typename T>
+uint32_t UniqueWithCountsAndSortingCpuKernel::Dispatch(const CpuKernelContext& ctx,
+                                                       const UniqueWithCountsAndSortingParams& params) const
+{
+    return params.presorted ? PresortedUniqueCompute<T>(ctx, params) : UniqueCompute<T>(ctx, params);
+}
+
+uint32_t UniqueWithCountsAndSortingCpuKernel::ParseParams(const CpuKernelContext& ctx,
+                                                          UniqueWithCountsAndSortingParams& params) const
+{
+    Tensor* x = ctx.Input(kFirstInputIndex);
+    Tensor* y = ctx.Output(kFirstOutputIndex);
+    Tensor* idx = ctx.Output(kSecondOutputIndex);
+    Tensor* count = ctx.Output(kThirdOutputIndex);
+    KERNEL_CHECK_NULLPTR(x, KERNEL_STATUS_PARAM_INVALID, "[%s] get input x failed.", kUniqueWithCountsAndSorting)
+    KERNEL_CHECK_NULLPTR(y, KERNEL_STATUS_PARAM_INVALID, "[%s] get output y failed.", kUniqueWithCountsAndSorting)
+    KERNEL_CHECK_NULLPTR(idx, KERNEL_STATUS_PARAM_INVALID, "[%s] get output idx failed.", kUniqueWithCountsAndSorting)
+    KERNEL_CHECK_NULLPTR(count, KERNEL_STATUS_PARAM_INVALID, "[%s] get output count failed.",
+                         kUniqueWithCountsAndSorting)
+    KERNEL_CHECK_FALSE(y->GetDataType() == x->GetDataType(), KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] y type [%s] should be the same as x type [%s].", kUniqueWithCountsAndSorting,
+                       DTypeStr(y->GetDataType()).c_str(), DTypeStr(x->GetDataType()).c_str());
+    KERNEL_CHECK_FALSE(idx->GetDataType() == DT_INT64 && count->GetDataType() == DT_INT64,
+                       KERNEL_STATUS_PARAM_INVALID, "[%s] idx type [%s] and count type [%s] should be int64.",
+                       kUniqueWithCountsAndSorting, DTypeStr(idx->GetDataType()).c_str(),
+                       DTypeStr(count->GetDataType()).c_str());
+
+    AttrValue* return_inverse = ctx.GetAttr(kReturnInverse);
+    params.return_inverse = (return_inverse != nullptr) && return_inverse->GetBool();
+    AttrValue* return_counts = ctx.GetAttr(kReturnCounts);
+    params.return_counts = (return_counts != nullptr) && return_counts->GetBool();
+
+    params.num = x->NumElements();
+    KERNEL_CHECK_FALSE(params.num <= static_cast<int64_t>(std::numeric_limits<uint32_t>::max()),
+                       KERNEL_STATUS_PARAM_INVALID, "[%s] x of [%ld] elements is too large.",
+                       kUniqueWithCountsAndSorting, params.num);
+    KERNEL_HANDLE_ERROR(ParseSortedIdx(ctx, params), "[%s] check sorted_idx failed.", kUniqueWithCountsAndSorting)
+    // The outputs are allocated for the worst case, every element unique.
+    KERNEL_CHECK_FALSE(y->NumElements() >= params.num, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] y holds [%ld] elements, less than the [%ld] of x.", kUniqueWithCountsAndSorting,
+                       y->NumElements(), params.num);
+    KERNEL_CHECK_FALSE(!params.return_inverse || idx->NumElements() == params.num, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] idx must hold [%ld] elements like x, got [%ld].", kUniqueWithCountsAndSorting,
+                       params.num, idx->NumElements());
+    KERNEL_CHECK_FALSE(!params.return_counts || count->NumElements() >= params.num, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] count holds [%ld] elements, less than the [%ld] of x.", kUniqueWithCountsAndSorting,
+                       count->NumElements(), params.num);
+    if (params.num > 0) {
+        KERNEL_CHECK_NULLPTR(x->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] get x data failed.",
+                             kUniqueWithCountsAndSorting)
+        KERNEL_CHECK_NULLPTR(y->GetData(), KERNEL_STATUS_PARAM_INVALID, "[%s] get y data failed.",
+                             kUniqueWithCountsAndSorting)
+        KERNEL_CHECK_FALSE(!params.return_inverse || idx->GetData() != nullptr, KERNEL_STATUS_PARAM_INVALID,
+                           "[%s] get idx data failed.", kUniqueWithCountsAndSorting);
+        KERNEL_CHECK_FALSE(!params.return_counts || count->GetData() != nullptr, KERNEL_STATUS_PARAM_INVALID,
+                           "[%s] get count data failed.", kUniqueWithCountsAndSorting);
+    }
+    return KERNEL_STATUS_OK;
+}
+
+uint32_t UniqueWithCountsAndSortingCpuKernel::ParseSortedIdx(const CpuKernelContext& ctx,
+                                                             UniqueWithCountsAndSortingParams& params) const
+{
+    Tensor* sorted_idx = ctx.Input(kSecondInputIndex);
+    if (sorted_idx == nullptr) {
+        KERNEL_LOG_DEBUG("[%s] optional input sorted_idx is nullptr, x is sorted here.", kUniqueWithCountsAndSorting);
+        return KERNEL_STATUS_OK;
+    }
+    params.presorted = true;
+    KERNEL_CHECK_FALSE(sorted_idx->GetDataType() == DT_INT64, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] sorted_idx type [%s] should be int64.", kUniqueWithCountsAndSorting,
+                       DTypeStr(sorted_idx->GetDataType()).c_str());
+    KERNEL_CHECK_FALSE(sorted_idx->NumElements() == params.num, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] sorted_idx must hold [%ld] elements like x, got [%ld].", kUniqueWithCountsAndSorting,
+                       params.num, sorted_idx->NumElements());
+    if (params.num == 0 || !params.return_inverse) {
+        return KERNEL_STATUS_OK;
+    }
+    // The positions index idx, so a bad permutation must not write out of bounds.
+    const int64_t* positions = static_cast<const int64_t*>(sorted_idx->GetData());
+    KERNEL_CHECK_NULLPTR(positions, KERNEL_STATUS_PARAM_INVALID, "[%s] get sorted_idx data failed.",
+                         kUniqueWithCountsAndSorting)
+    auto bounds = std::minmax_element(positions, positions + params.num);
+    KERNEL_CHECK_FALSE(*bounds.first >= 0 && *bounds.second < params.num, KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] sorted_idx values [%ld, %ld] out of range [0, %ld).", kUniqueWithCountsAndSorting,
+                       *bounds.first, *bounds.second, params.num);
+    return KERNEL_STATUS_OK;
+}
+
+/**
+ * The elements are sorted stably as (key, position) pairs with the radix sort shared with SegmentSort, then equal
+ * neighbours are grouped by UniqueCompact. y is always ascending, whatever the sorted attribute, and its shape is
+ * refreshed to the number of unique values, as is the shape of count when counts are returned.
+ */
+template <typename T>
+uint32_t UniqueWithCountsAndSortingCpuKernel::UniqueCompute(const CpuKernelContext& ctx,
+                                                            const UniqueWithCountsAndSortingParams& params) const
+{
+    using Key = typename RadixKey<T>::Key;
+    const int64_t num = params.num;
+    const T* x = static_cast<const T*>(ctx.Input(kFirstInputIndex)->GetData());
+    const int64_t cores = static_cast<int64_t>(std::max(1U, CpuKernelUtils::GetCPUNum(ctx)));
+    std::vector<KeyIndex<Key>> data(static_cast<size_t>(num));
+    std::vector<KeyIndex<Key>> tmp(static_cast<size_t>(num));
+    auto encode = [&data, x](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; i++) {
+            data[i].key = RadixKey<T>::Encode(x[i]);
+            data[i].index = static_cast<uint32_t>(i);
+        }
+    };
+
+    const KeyIndex<Key>* sorted = data.data();
+    if (num <= kUniqueSmallSortNum) {
+        encode(0, num);
+        std::stable_sort(data.begin(), data.end(),
+                         [](const KeyIndex<Key>& a, const KeyIndex<Key>& b) { return a.key < b.key; });
+    } else if (cores == 1 || num < kUniqueParallelSortNum) {
+        encode(0, num);
+        sorted = RadixSortSerial(data.data(), tmp.data(), num);
+    } else {
+        KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, num, (num + cores - 1) / cores, encode),
+                            "[%s] encode pass failed.", kUniqueWithCountsAndSorting)
+        KeyIndex<Key>* result = nullptr;
+        KERNEL_HANDLE_ERROR(RadixSortParallel(ctx, data.data(), tmp.data(), num, cores, &result,
+                                              kUniqueWithCountsAndSorting),
+                            "[%s] radix sort failed.", kUniqueWithCountsAndSorting)
+        sorted = result;
+    }
+
+    SortedUniqueOp<T> op;
+    op.sorted = sorted;
+    op.x = x;
+    op.y = static_cast<T*>(ctx.Output(kFirstOutputIndex)->GetData());
+    op.inverse = params.return_inverse ? static_cast<int64_t*>(ctx.Output(kSecondOutputIndex)->GetData()) : nullptr;
+    int64_t* counts = params.return_counts ? static_cast<int64_t*>(ctx.Output(kThirdOutputIndex)->GetData()) : nullptr;
+    int64_t unique_num = 0;
+    KERNEL_HANDLE_ERROR(UniqueCompact(ctx, op, num, counts, unique_num, kUniqueWithCountsAndSorting),
+                        "[%s] compaction failed.", kUniqueWithCountsAndSorting)
+
+    ctx.Output(kFirstOutputIndex)->GetTensorShape()->SetDimSizes({unique_num});
+    if (params.return_counts) {
+        ctx.Output(kThirdOutputIndex)->GetTensorShape()->SetDimSizes({unique_num});
+    }
+    return KERNEL_STATUS_OK;
+}
+
+/**
+ * The sort already ran on the device, so equal values are neighbours and only the compaction is left. Values are
+ * compared with IEEE ==, so a NaN is a group of its own wherever the sort put it.
+ */
+template <typename T>
+uint32_t UniqueWithCountsAndSortingCpuKernel::PresortedUniqueCompute(
+    const CpuKernelContext& ctx, const UniqueWithCountsAndSortingParams& params) const
+{
+    PresortedUniqueOp<T> op;
+    op.x = static_cast<const T*>(ctx.Input(kFirstInputIndex)->GetData());
+    op.positions = static_cast<const int64_t*>(ctx.Input(kSecondInputIndex)->GetData());
+    op.y = static_cast<T*>(ctx.Output(kFirstOutputIndex)->GetData());
+    op.inverse = params.return_inverse ? static_cast<int64_t*>(ctx.Output(kSecondOutputIndex)->GetData()) : nullptr;
+    int64_t* counts = params.return_counts ? static_cast<int64_t*>(ctx.Output(kThirdOutputIndex)->GetData()) : nullptr;
+    int64_t unique_num = 0;
+    KERNEL_HANDLE_ERROR(UniqueCompact(ctx, op, params.num, counts, unique_num, kUniqueWithCountsAndSorting),
+                        "[%s] compaction failed.", kUniqueWithCountsAndSorting)
+
+    ctx.Output(kFirstOutputIndex)->GetTensorShape()->SetDimSizes({unique_num});
+    if (params.return_counts) {
+        ctx.Output(kThirdOutputIndex)->GetTensorShape()->SetDimSizes({unique_num});
+    }
+    return KERNEL_STATUS_OK;
+}
+
+REGISTER_CPU_KERNEL(kUniqueWithCountsAndSorting, UniqueWithCountsAndSortingCpuKernel);
+} // namespace aicpu
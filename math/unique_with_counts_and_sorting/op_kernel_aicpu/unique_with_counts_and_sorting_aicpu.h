@@ -0,0 +1,44 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef AICPU_KERNELS_NORMALIZED_UNIQUE_WITH_COUNTS_AND_SORTING_H_
+#define AICPU_KERNELS_NORMALIZED_UNIQUE_WITH_COUNTS_AND_SORTING_H_
+
+#include <cstdint>
+
+#include "cpu_kernel.h"
+
+namespace aicpu {
+struct UniqueWithCountsAndSortingParams {
+    int64_t num = 0;
+    // x arrives stably sorted with its original positions in sorted_idx, only the compaction is left.
+    bool presorted = false;
+    bool return_inverse = false;
+    bool return_counts = false;
+};
+
+class UniqueWithCountsAndSortingCpuKernel : public CpuKernel {
+public:
+    UniqueWithCountsAndSortingCpuKernel() = default;
+    ~UniqueWithCountsAndSortingCpuKernel() override = default;
+    uint32_t Compute(CpuKernelContext& ctx) override;
+
+private:
+    uint32_t ParseParams(const CpuKernelContext& ctx, UniqueWithCountsAndSortingParams& params) const;
+    uint32_t ParseSortedIdx(const CpuKernelContext& ctx, UniqueWithCountsAndSortingParams& params) const;
+    template <typename T>
+    uint32_t Dispatch(const CpuKernelContext& ctx, const UniqueWithCountsAndSortingParams& params) const;
+    template <typename T>
+    uint32_t UniqueCompute(const CpuKernelContext& ctx, const UniqueWithCountsAndSortingParams& params) const;
+    template <typename T>
+    uint32_t PresortedUniqueCompute(const CpuKernelContext& ctx, const UniqueWithCountsAndSortingParams& params) const;
+};
+} // namespace aicpu
+#endif // AICPU_KERNELS_NORMALIZED_UNIQUE_WITH_COUNTS_AND_SORTING_H_
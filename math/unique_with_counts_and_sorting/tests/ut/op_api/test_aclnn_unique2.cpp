@@ -0,0 +1,269 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "../../../op_api/aclnn_unique2.h"
+
+#include "op_api_ut_common/op_api_ut.h"
+#include "op_api_ut_common/scalar_desc.h"
+#include "op_api_ut_common/tensor_desc.h"
+#include "opdev/platform.h"
+
+using namespace std;
+
+class l2_unique2_test : public testing::Test {
+protected:
+    static void SetUpTestCase() { cout << "unique2_test SetUp" << endl; }
+
+    static void TearDownTestCase() { cout << "unique2_test TearDown" << endl; }
+
+    // 部分用例切换平台以覆盖AI Core Sort与AI CPU回退两条路径
+    void TearDown() override { op::SetPlatformSocVersion(op::SocVersion::ASCEND910B); }
+};
+
+// 910B上float32走AI Core Sort + AI CPU压缩
+TEST_F(l2_unique2_test, case_001_float32_aicore_sort)
+{
+    auto selfDesc = TensorDesc({4, 5}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-5, 5);
+    auto valueDesc = TensorDesc({20}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto inverseDesc = TensorDesc({4, 5}, ACL_INT64, ACL_FORMAT_ND);
+    auto countsDesc = TensorDesc({20}, ACL_INT64, ACL_FORMAT_ND);
+
+    auto ut = OP_API_UT(aclnnUnique2, INPUT(selfDesc, true, true, true), OUTPUT(valueDesc, inverseDesc, countsDesc));
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+}
+
+TEST_F(l2_unique2_test, case_002_float16_values_only)
+{
+    auto selfDesc = TensorDesc({64}, ACL_FLOAT16, ACL_FORMAT_ND).ValueRange(-5, 5);
+    auto valueDesc = TensorDesc({64}, ACL_FLOAT16, ACL_FORMAT_ND);
+    auto inverseDesc = TensorDesc({64}, ACL_INT64, ACL_FORMAT_ND);
+    auto countsDesc = TensorDesc({64}, ACL_INT64, ACL_FORMAT_ND);
+
+    auto ut = OP_API_UT(aclnnUnique2, INPUT(selfDesc, true, false, false), OUTPUT(valueDesc, inverseDesc, countsDesc));
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+}
+
+// AI Core Sort不支持的double与int32回退融合的AI CPU kernel
+TEST_F(l2_unique2_test, case_003_double_int32_aicpu_fallback)
+{
+    for (auto dtype : {ACL_DOUBLE, ACL_INT32}) {
+        auto selfDesc = TensorDesc({3, 7}, dtype, ACL_FORMAT_ND).ValueRange(-5, 5);
+        auto valueDesc = TensorDesc({21}, dtype, ACL_FORMAT_ND);
+        auto inverseDesc = TensorDesc({3, 7}, ACL_INT64, ACL_FORMAT_ND);
+        auto countsDesc = TensorDesc({21}, ACL_INT64, ACL_FORMAT_ND);
+
+        auto ut =
+            OP_API_UT(aclnnUnique2, INPUT(selfDesc, true, true, true), OUTPUT(valueDesc, inverseDesc, countsDesc));
+        uint64_t workspaceSize = 0;
+        aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+        EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+    }
+}
+
+// 910的AI Core Sort不支持float32，回退AI CPU
+TEST_F(l2_unique2_test, case_004_ascend910_float32_aicpu_fallback)
+{
+    op::SetPlatformSocVersion(op::SocVersion::ASCEND910);
+    auto selfDesc = TensorDesc({16}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-5, 5);
+    auto valueDesc = TensorDesc({16}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto inverseDesc = TensorDesc({16}, ACL_INT64, ACL_FORMAT_ND);
+    auto countsDesc = TensorDesc({16}, ACL_INT64, ACL_FORMAT_ND);
+
+    auto ut = OP_API_UT(aclnnUnique2, INPUT(selfDesc, true, true, true), OUTPUT(valueDesc, inverseDesc, countsDesc));
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+}
+
+// regbase上整数类型也走AI Core Sort
+TEST_F(l2_unique2_test, case_005_ascend950_int64_aicore_sort)
+{
+    op::SetPlatformSocVersion(op::SocVersion::ASCEND950);
+    auto selfDesc = TensorDesc({2, 8}, ACL_INT64, ACL_FORMAT_ND).ValueRange(-5, 5);
+    auto valueDesc = TensorDesc({16}, ACL_INT64, ACL_FORMAT_ND);
+    auto inverseDesc = TensorDesc({2, 8}, ACL_INT64, ACL_FORMAT_ND);
+    auto countsDesc = TensorDesc({16}, ACL_INT64, ACL_FORMAT_ND);
+
+    auto ut = OP_API_UT(aclnnUnique2, INPUT(selfDesc, true, true, true), OUTPUT(valueDesc, inverseDesc, countsDesc));
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+}
+
+// regbase上AI Core Sort未注册double，与Sort一致回退AI CPU
+TEST_F(l2_unique2_test, case_005_ascend950_double_aicpu_fallback)
+{
+    op::SetPlatformSocVersion(op::SocVersion::ASCEND950);
+    auto selfDesc = TensorDesc({2, 8}, ACL_DOUBLE, ACL_FORMAT_ND).ValueRange(-5, 5);
+    auto valueDesc = TensorDesc({16}, ACL_DOUBLE, ACL_FORMAT_ND);
+    auto inverseDesc = TensorDesc({2, 8}, ACL_INT64, ACL_FORMAT_ND);
+    auto countsDesc = TensorDesc({16}, ACL_INT64, ACL_FORMAT_ND);
+
+    auto ut = OP_API_UT(aclnnUnique2, INPUT(selfDesc, true, true, true), OUTPUT(valueDesc, inverseDesc, countsDesc));
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+}
+
+// 单个元素不经过Sort
+TEST_F(l2_unique2_test, case_006_single_element)
+{
+    auto selfDesc = TensorDesc({1}, ACL_FLOAT, ACL_FORMAT_ND).Value(vector<float>{3.0f});
+    auto valueDesc = TensorDesc({1}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto inverseDesc = TensorDesc({1}, ACL_INT64, ACL_FORMAT_ND);
+    auto countsDesc = TensorDesc({1}, ACL_INT64, ACL_FORMAT_ND);
+
+    auto ut = OP_API_UT(aclnnUnique2, INPUT(selfDesc, true, true, true), OUTPUT(valueDesc, inverseDesc, countsDesc));
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+}
+
+TEST_F(l2_unique2_test, case_007_empty_self)
+{
+    auto selfDesc = TensorDesc({0, 3}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto valueDesc = TensorDesc({0}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto inverseDesc = TensorDesc({0, 3}, ACL_INT64, ACL_FORMAT_ND);
+    auto countsDesc = TensorDesc({0}, ACL_INT64, ACL_FORMAT_ND);
+
+    auto ut = OP_API_UT(aclnnUnique2, INPUT(selfDesc, true, true, true), OUTPUT(valueDesc, inverseDesc, countsDesc));
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+    EXPECT_EQ(workspaceSize, 0U);
+}
+
+TEST_F(l2_unique2_test, case_008_non_contiguous_self)
+{
+    auto selfDesc = TensorDesc({4, 5}, ACL_FLOAT, ACL_FORMAT_ND, {1, 4}, 0, {5, 4}).ValueRange(-5, 5);
+    auto valueDesc = TensorDesc({20}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto inverseDesc = TensorDesc({4, 5}, ACL_INT64, ACL_FORMAT_ND);
+    auto countsDesc = TensorDesc({20}, ACL_INT64, ACL_FORMAT_ND);
+
+    auto ut = OP_API_UT(aclnnUnique2, INPUT(selfDesc, true, true, true), OUTPUT(valueDesc, inverseDesc, countsDesc));
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+}
+
+TEST_F(l2_unique2_test, case_009_self_nullptr)
+{
+    auto valueDesc = TensorDesc({8}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto inverseDesc = TensorDesc({8}, ACL_INT64, ACL_FORMAT_ND);
+    auto countsDesc = TensorDesc({8}, ACL_INT64, ACL_FORMAT_ND);
+
+    auto ut = OP_API_UT(aclnnUnique2, INPUT((aclTensor*)nullptr, true, true, true),
+                        OUTPUT(valueDesc, inverseDesc, countsDesc));
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_NULLPTR);
+}
+
+TEST_F(l2_unique2_test, case_010_counts_nullptr)
+{
+    auto selfDesc = TensorDesc({8}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-5, 5);
+    auto valueDesc = TensorDesc({8}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto inverseDesc = TensorDesc({8}, ACL_INT64, ACL_FORMAT_ND);
+
+    auto ut = OP_API_UT(aclnnUnique2, INPUT(selfDesc, true, true, true),
+                        OUTPUT(valueDesc, inverseDesc, (aclTensor*)nullptr));
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_NULLPTR);
+}
+
+TEST_F(l2_unique2_test, case_011_bool_self_unsupported)
+{
+    auto selfDesc = TensorDesc({8}, ACL_BOOL, ACL_FORMAT_ND);
+    auto valueDesc = TensorDesc({8}, ACL_BOOL, ACL_FORMAT_ND);
+    auto inverseDesc = TensorDesc({8}, ACL_INT64, ACL_FORMAT_ND);
+    auto countsDesc = TensorDesc({8}, ACL_INT64, ACL_FORMAT_ND);
+
+    auto ut = OP_API_UT(aclnnUnique2, INPUT(selfDesc, true, true, true), OUTPUT(valueDesc, inverseDesc, countsDesc));
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+}
+
+TEST_F(l2_unique2_test, case_012_value_dtype_mismatch)
+{
+    auto selfDesc = TensorDesc({8}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-5, 5);
+    auto valueDesc = TensorDesc({8}, ACL_FLOAT16, ACL_FORMAT_ND);
+    auto inverseDesc = TensorDesc({8}, ACL_INT64, ACL_FORMAT_ND);
+    auto countsDesc = TensorDesc({8}, ACL_INT64, ACL_FORMAT_ND);
+
+    auto ut = OP_API_UT(aclnnUnique2, INPUT(selfDesc, true, true, true), OUTPUT(valueDesc, inverseDesc, countsDesc));
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+}
+
+TEST_F(l2_unique2_test, case_013_inverse_int32_unsupported)
+{
+    auto selfDesc = TensorDesc({8}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-5, 5);
+    auto valueDesc = TensorDesc({8}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto inverseDesc = TensorDesc({8}, ACL_INT32, ACL_FORMAT_ND);
+    auto countsDesc = TensorDesc({8}, ACL_INT64, ACL_FORMAT_ND);
+
+    auto ut = OP_API_UT(aclnnUnique2, INPUT(selfDesc, true, true, true), OUTPUT(valueDesc, inverseDesc, countsDesc));
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+}
+
+// valueOut与countsOut须容纳self全部元素，inverseOut须与self同shape
+TEST_F(l2_unique2_test, case_014_outputs_too_small)
+{
+    auto selfDesc = TensorDesc({2, 4}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-5, 5);
+    auto valueDesc = TensorDesc({8}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto smallValueDesc = TensorDesc({4}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto inverseDesc = TensorDesc({2, 4}, ACL_INT64, ACL_FORMAT_ND);
+    auto flatInverseDesc = TensorDesc({8}, ACL_INT64, ACL_FORMAT_ND);
+    auto countsDesc = TensorDesc({8}, ACL_INT64, ACL_FORMAT_ND);
+    auto smallCountsDesc = TensorDesc({4}, ACL_INT64, ACL_FORMAT_ND);
+    uint64_t workspaceSize = 0;
+
+    auto ut1 =
+        OP_API_UT(aclnnUnique2, INPUT(selfDesc, true, true, true), OUTPUT(smallValueDesc, inverseDesc, countsDesc));
+    EXPECT_EQ(ut1.TestGetWorkspaceSize(&workspaceSize), ACLNN_ERR_PARAM_INVALID);
+
+    auto ut2 =
+        OP_API_UT(aclnnUnique2, INPUT(selfDesc, true, true, true), OUTPUT(valueDesc, flatInverseDesc, countsDesc));
+    EXPECT_EQ(ut2.TestGetWorkspaceSize(&workspaceSize), ACLNN_ERR_PARAM_INVALID);
+
+    auto ut3 =
+        OP_API_UT(aclnnUnique2, INPUT(selfDesc, true, true, true), OUTPUT(valueDesc, inverseDesc, smallCountsDesc));
+    EXPECT_EQ(ut3.TestGetWorkspaceSize(&workspaceSize), ACLNN_ERR_PARAM_INVALID);
+
+    // 不返回counts时不检查countsOut的大小
+    auto ut4 =
+        OP_API_UT(aclnnUnique2, INPUT(selfDesc, true, true, false), OUTPUT(valueDesc, inverseDesc, smallCountsDesc));
+    EXPECT_EQ(ut4.TestGetWorkspaceSize(&workspaceSize), ACLNN_SUCCESS);
+}
+
+TEST_F(l2_unique2_test, case_015_self_over_max_dims)
+{
+    auto selfDesc = TensorDesc({1, 1, 1, 1, 1, 1, 1, 1, 2}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-5, 5);
+    auto valueDesc = TensorDesc({2}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto inverseDesc = TensorDesc({1, 1, 1, 1, 1, 1, 1, 1, 2}, ACL_INT64, ACL_FORMAT_ND);
+    auto countsDesc = TensorDesc({2}, ACL_INT64, ACL_FORMAT_ND);
+
+    auto ut = OP_API_UT(aclnnUnique2, INPUT(selfDesc, true, true, true), OUTPUT(valueDesc, inverseDesc, countsDesc));
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+}
@@ -0,0 +1,316 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "gtest/gtest.h"
+#include "utils/aicpu_test_utils.h"
+#include "cpu_kernel_utils.h"
+#include "node_def_builder.h"
+#include "Eigen/Core"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <random>
+#include <vector>
+
+using namespace std;
+using namespace aicpu;
+
+class TEST_UNIQUE_WITH_COUNTS_AND_SORTING_UT : public testing::Test {};
+
+namespace {
+#define CREATE_NODEDEF(node_def, shapes, data_types, datas, return_inverse, return_counts)          \
+    NodeDefBuilder(node_def.get(), "UniqueWithCountsAndSorting", "UniqueWithCountsAndSorting")      \
+        .Input({"x", data_types[0], shapes[0], datas[0]})                                           \
+        .Output({"y", data_types[1], shapes[1], datas[1]})                                          \
+        .Output({"idx", data_types[2], shapes[2], datas[2]})                                        \
+        .Output({"count", data_types[3], shapes[3], datas[3]})                                      \
+        .Attr("sorted", true)                                                                       \
+        .Attr("return_inverse", (bool)(return_inverse))                                             \
+        .Attr("return_counts", (bool)(return_counts))
+
+// std::map keyed on the numbers, then every NaN as a group of its own after all numbers.
+template <typename T>
+void CheckUnique(const vector<T>& x, const vector<T>& y, const vector<int64_t>& idx, const vector<int64_t>& count,
+                 int64_t unique_num)
+{
+    map<double, int64_t> groups;
+    int64_t nan_num = 0;
+    for (const T& v : x) {
+        const double d = static_cast<double>(static_cast<float>(v));
+        const double w = is_integral<T>::value || is_same<T, double>::value ? static_cast<double>(v) : d;
+        if (std::isnan(w)) {
+            nan_num++;
+        } else {
+            groups[w == 0 ? 0.0 : w]++;
+        }
+    }
+    ASSERT_EQ(unique_num, static_cast<int64_t>(groups.size()) + nan_num);
+    int64_t g = 0;
+    for (const auto& item : groups) {
+        const double v = static_cast<double>(static_cast<float>(y[g]));
+        const double w = is_integral<T>::value || is_same<T, double>::value ? static_cast<double>(y[g]) : v;
+        EXPECT_EQ(w, item.first) << "group " << g;
+        EXPECT_EQ(count[g], item.second) << "group " << g;
+        g++;
+    }
+    vector<bool> nan_seen(static_cast<size_t>(nan_num), false);
+    for (; g < unique_num; g++) {
+        EXPECT_TRUE(std::isnan(static_cast<double>(static_cast<float>(y[g])))) << "group " << g;
+        EXPECT_EQ(count[g], 1) << "group " << g;
+    }
+    for (size_t i = 0; i < x.size(); i++) {
+        ASSERT_GE(idx[i], 0);
+        ASSERT_LT(idx[i], unique_num);
+        const T ref = y[idx[i]];
+        const double a = static_cast<double>(static_cast<float>(x[i]));
+        const double b = static_cast<double>(static_cast<float>(ref));
+        if (is_integral<T>::value || is_same<T, double>::value) {
+            ASSERT_EQ(static_cast<double>(x[i]), static_cast<double>(ref)) << "element " << i;
+        } else if (std::isnan(a)) {
+            const int64_t k = idx[i] - static_cast<int64_t>(groups.size());
+            ASSERT_TRUE(std::isnan(b) && k >= 0 && !nan_seen[k]) << "element " << i;
+            nan_seen[k] = true;
+        } else {
+            ASSERT_EQ(a, b) << "element " << i;
+        }
+    }
+}
+
+template <typename T>
+void RunAndCheck(const vector<T>& x, DataType data_type)
+{
+    const int64_t num = static_cast<int64_t>(x.size());
+    vector<T> y(num);
+    vector<int64_t> idx(num, -1);
+    vector<int64_t> count(num, -1);
+    vector<DataType> data_types = {data_type, data_type, DT_INT64, DT_INT64};
+    vector<vector<int64_t>> shapes = {{num}, {num}, {num}, {num}};
+    vector<void*> datas = {(void*)x.data(), (void*)y.data(), (void*)idx.data(), (void*)count.data()};
+    auto node_def = CpuKernelUtils::CreateNodeDef();
+    CREATE_NODEDEF(node_def, shapes, data_types, datas, true, true);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    auto y_dims = ctx.Output(kFirstOutputIndex)->GetTensorShape()->GetDimSizes();
+    auto count_dims = ctx.Output(kThirdOutputIndex)->GetTensorShape()->GetDimSizes();
+    ASSERT_EQ(y_dims.size(), 1U);
+    EXPECT_EQ(count_dims, y_dims);
+    CheckUnique(x, y, idx, count, y_dims[0]);
+}
+
+// Sorts x stably on the host the way the device Sort does (NaN last) and hands the permutation in as sorted_idx.
+uint32_t RunPresorted(const vector<float>& x, vector<int64_t>& perm, vector<float>& y, vector<int64_t>& idx,
+                      vector<int64_t>& count)
+{
+    const int64_t num = static_cast<int64_t>(x.size());
+    vector<float> sorted_x(num);
+    for (int64_t i = 0; i < num; i++) {
+        // Positions out of range are left for the kernel to reject.
+        sorted_x[i] = (perm[i] >= 0 && perm[i] < num) ? x[perm[i]] : 0.0f;
+    }
+    y.assign(num, 0.0f);
+    idx.assign(num, -1);
+    count.assign(num, -1);
+    auto node_def = CpuKernelUtils::CreateNodeDef();
+    NodeDefBuilder(node_def.get(), "UniqueWithCountsAndSorting", "UniqueWithCountsAndSorting")
+        .Input({"x", DT_FLOAT, {num}, (void*)sorted_x.data()})
+        .Input({"sorted_idx", DT_INT64, {num}, (void*)perm.data()})
+        .Output({"y", DT_FLOAT, {num}, (void*)y.data()})
+        .Output({"idx", DT_INT64, {num}, (void*)idx.data()})
+        .Output({"count", DT_INT64, {num}, (void*)count.data()})
+        .Attr("sorted", true)
+        .Attr("return_inverse", true)
+        .Attr("return_counts", true);
+    CpuKernelContext ctx(HOST);
+    EXPECT_EQ(ctx.Init(node_def.get()), KERNEL_STATUS_OK);
+    uint32_t ret = CpuKernelRegister::Instance().RunCpuKernel(ctx);
+    if (ret == KERNEL_STATUS_OK) {
+        const int64_t unique_num = ctx.Output(kFirstOutputIndex)->GetTensorShape()->GetDimSizes()[0];
+        CheckUnique(x, y, idx, count, unique_num);
+    }
+    return ret;
+}
+
+vector<int64_t> StableSortPerm(const vector<float>& x)
+{
+    vector<int64_t> perm(x.size());
+    for (size_t i = 0; i < perm.size(); i++) {
+        perm[i] = static_cast<int64_t>(i);
+    }
+    stable_sort(perm.begin(), perm.end(), [&x](int64_t a, int64_t b) {
+        return std::isnan(x[b]) ? !std::isnan(x[a]) : x[a] < x[b];
+    });
+    return perm;
+}
+} // namespace
+
+TEST_F(TEST_UNIQUE_WITH_COUNTS_AND_SORTING_UT, INT64_SMALL_SUCCESS)
+{
+    vector<int64_t> x = {2, 3, 1, 3, 2, -7, 2};
+    vector<int64_t> y(7);
+    vector<int64_t> idx(7);
+    vector<int64_t> count(7);
+    vector<DataType> data_types = {DT_INT64, DT_INT64, DT_INT64, DT_INT64};
+    vector<vector<int64_t>> shapes = {{7}, {7}, {7}, {7}};
+    vector<void*> datas = {(void*)x.data(), (void*)y.data(), (void*)idx.data(), (void*)count.data()};
+    auto node_def = CpuKernelUtils::CreateNodeDef();
+    CREATE_NODEDEF(node_def, shapes, data_types, datas, true, true);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+    EXPECT_EQ(ctx.Output(kFirstOutputIndex)->GetTensorShape()->GetDimSizes(), vector<int64_t>({4}));
+    EXPECT_EQ(vector<int64_t>(y.begin(), y.begin() + 4), vector<int64_t>({-7, 1, 2, 3}));
+    EXPECT_EQ(idx, vector<int64_t>({2, 3, 1, 3, 2, 0, 2}));
+    EXPECT_EQ(vector<int64_t>(count.begin(), count.begin() + 4), vector<int64_t>({1, 1, 3, 2}));
+}
+
+TEST_F(TEST_UNIQUE_WITH_COUNTS_AND_SORTING_UT, FLOAT_NAN_ZERO_SUCCESS)
+{
+    const float nan = numeric_limits<float>::quiet_NaN();
+    vector<float> x = {nan, 1.0f, -0.0f, 0.0f, nan, -numeric_limits<float>::infinity(), 1.0f};
+    RunAndCheck(x, DT_FLOAT);
+}
+
+TEST_F(TEST_UNIQUE_WITH_COUNTS_AND_SORTING_UT, FLOAT_RADIX_SUCCESS)
+{
+    vector<float> x(20000);
+    mt19937 gen(1);
+    for (auto& v : x) {
+        v = static_cast<float>(static_cast<int>(gen() % 3001) - 1500) * 0.5f;
+    }
+    for (size_t i = 0; i < x.size(); i += 997) {
+        x[i] = numeric_limits<float>::quiet_NaN();
+    }
+    RunAndCheck(x, DT_FLOAT);
+}
+
+TEST_F(TEST_UNIQUE_WITH_COUNTS_AND_SORTING_UT, INT32_PARALLEL_SUCCESS)
+{
+    vector<int32_t> x(600 * 1024 + 11);
+    mt19937 gen(2);
+    for (auto& v : x) {
+        v = static_cast<int32_t>(gen() % 50000) - 25000;
+    }
+    // Long runs of one value make groups span the compaction chunks.
+    for (size_t i = 100000; i < 400000; i++) {
+        x[i] = 7;
+    }
+    RunAndCheck(x, DT_INT32);
+}
+
+TEST_F(TEST_UNIQUE_WITH_COUNTS_AND_SORTING_UT, OTHER_TYPES_SUCCESS)
+{
+    mt19937 gen(3);
+    vector<Eigen::half> xh(3000);
+    vector<Eigen::bfloat16> xb(3000);
+    vector<double> xd(3000);
+    vector<int8_t> x8(3000);
+    vector<uint8_t> xu8(3000);
+    vector<int16_t> x16(3000);
+    for (size_t i = 0; i < 3000; i++) {
+        const uint32_t r = gen();
+        xh[i] = Eigen::half(static_cast<float>(static_cast<int>(r % 200) - 100) * 0.25f);
+        xb[i] = Eigen::bfloat16(static_cast<float>(static_cast<int>(r % 100) - 50));
+        xd[i] = static_cast<double>(static_cast<int>(r % 777) - 300) * 1e-3;
+        x8[i] = static_cast<int8_t>(r);
+        xu8[i] = static_cast<uint8_t>(r >> 8);
+        x16[i] = static_cast<int16_t>(r % 1000);
+    }
+    RunAndCheck(xh, DT_FLOAT16);
+    RunAndCheck(xb, DT_BFLOAT16);
+    RunAndCheck(xd, DT_DOUBLE);
+    RunAndCheck(x8, DT_INT8);
+    RunAndCheck(xu8, DT_UINT8);
+    RunAndCheck(x16, DT_INT16);
+}
+
+TEST_F(TEST_UNIQUE_WITH_COUNTS_AND_SORTING_UT, VALUES_ONLY_SUCCESS)
+{
+    vector<int32_t> x = {5, 5, 4, 4, 6};
+    vector<int32_t> y(5);
+    vector<int64_t> idx(5, -1);
+    vector<int64_t> count(5, -1);
+    vector<DataType> data_types = {DT_INT32, DT_INT32, DT_INT64, DT_INT64};
+    vector<vector<int64_t>> shapes = {{5}, {5}, {5}, {5}};
+    vector<void*> datas = {(void*)x.data(), (void*)y.data(), (void*)idx.data(), (void*)count.data()};
+    auto node_def = CpuKernelUtils::CreateNodeDef();
+    CREATE_NODEDEF(node_def, shapes, data_types, datas, false, false);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    EXPECT_EQ(ctx.Output(kFirstOutputIndex)->GetTensorShape()->GetDimSizes(), vector<int64_t>({3}));
+    EXPECT_EQ(vector<int32_t>(y.begin(), y.begin() + 3), vector<int32_t>({4, 5, 6}));
+    EXPECT_EQ(idx, vector<int64_t>(5, -1));
+    EXPECT_EQ(count, vector<int64_t>(5, -1));
+}
+
+TEST_F(TEST_UNIQUE_WITH_COUNTS_AND_SORTING_UT, EMPTY_INPUT_SUCCESS)
+{
+    vector<float> x;
+    RunAndCheck(x, DT_FLOAT);
+}
+
+TEST_F(TEST_UNIQUE_WITH_COUNTS_AND_SORTING_UT, Y_TYPE_FAILED)
+{
+    vector<float> x(4, 1.0f);
+    vector<double> y(4);
+    vector<int64_t> idx(4);
+    vector<int64_t> count(4);
+    vector<DataType> data_types = {DT_FLOAT, DT_DOUBLE, DT_INT64, DT_INT64};
+    vector<vector<int64_t>> shapes = {{4}, {4}, {4}, {4}};
+    vector<void*> datas = {(void*)x.data(), (void*)y.data(), (void*)idx.data(), (void*)count.data()};
+    auto node_def = CpuKernelUtils::CreateNodeDef();
+    CREATE_NODEDEF(node_def, shapes, data_types, datas, true, true);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
+}
+
+TEST_F(TEST_UNIQUE_WITH_COUNTS_AND_SORTING_UT, Y_TOO_SMALL_FAILED)
+{
+    vector<float> x(4, 1.0f);
+    vector<float> y(2);
+    vector<int64_t> idx(4);
+    vector<int64_t> count(4);
+    vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_INT64, DT_INT64};
+    vector<vector<int64_t>> shapes = {{2, 2}, {2}, {2, 2}, {4}};
+    vector<void*> datas = {(void*)x.data(), (void*)y.data(), (void*)idx.data(), (void*)count.data()};
+    auto node_def = CpuKernelUtils::CreateNodeDef();
+    CREATE_NODEDEF(node_def, shapes, data_types, datas, true, true);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
+}
+
+TEST_F(TEST_UNIQUE_WITH_COUNTS_AND_SORTING_UT, PRESORTED_FLOAT_SUCCESS)
+{
+    const float nan = numeric_limits<float>::quiet_NaN();
+    vector<float> x = {nan, 1.0f, -0.0f, 0.0f, nan, -numeric_limits<float>::infinity(), 1.0f};
+    vector<int64_t> perm = StableSortPerm(x);
+    vector<float> y;
+    vector<int64_t> idx;
+    vector<int64_t> count;
+    EXPECT_EQ(RunPresorted(x, perm, y, idx, count), KERNEL_STATUS_OK);
+
+    vector<float> big(300000);
+    mt19937 gen(4);
+    for (auto& v : big) {
+        v = static_cast<float>(static_cast<int>(gen() % 4001) - 2000) * 0.25f;
+    }
+    for (size_t i = 0; i < big.size(); i += 1009) {
+        big[i] = nan;
+    }
+    perm = StableSortPerm(big);
+    EXPECT_EQ(RunPresorted(big, perm, y, idx, count), KERNEL_STATUS_OK);
+}
+
+TEST_F(TEST_UNIQUE_WITH_COUNTS_AND_SORTING_UT, PRESORTED_IDX_OUT_OF_RANGE_FAILED)
+{
+    vector<float> x = {3.0f, 1.0f, 2.0f};
+    vector<int64_t> perm = {1, 2, 3};
+    vector<float> y;
+    vector<int64_t> idx;
+    vector<int64_t> count;
+    EXPECT_EQ(RunPresorted(x, perm, y, idx, count), KERNEL_STATUS_PARAM_INVALID);
+}